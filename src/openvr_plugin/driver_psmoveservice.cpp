@@ -51,6 +51,16 @@
 static const float k_fScalePSMoveAPIToMeters = 0.01f;  // psmove driver in cm
 static const float k_fRadiansToDegrees = 180.f / 3.14159265f;
 
+// How long the pose update thread sleeps in the network reactor before waking
+// up to poll again. Pose data arrives over the shared memory ring, which is a
+// lock-free seqlock with nothing to wake the reactor, so this bounds the worst
+// case pose pickup latency rather than just exit/rumble servicing.
+static const int k_nPoseUpdatePollTimeoutMilliseconds = 1;
+
+// Cap on how far ahead a controller pose gets extrapolated toward photon time.
+// Anything longer amplifies filter noise into visible swim.
+static const float k_fMaxPosePredictionSeconds = 0.05f;
+
 static const int k_touchpadTouchMapping = (vr::EVRButtonId)31;
 
 static const char *k_PSButtonNames[CPSMoveControllerLatest::k_EPSButtonID_Count] = {
@@ -283,6 +293,8 @@ static PSMovePose openvrMatrixExtractPSMovePose(const vr::HmdMatrix34_t &openVRT
 CServerDriver_PSMoveService::CServerDriver_PSMoveService()
     : m_bLaunchedPSMoveMonitor(false)
 	, m_bInitialized(false)
+	, m_bExitPoseUpdateThread(false)
+	, m_bPoseUpdateThreadStarted(false)
 {
 }
 
@@ -331,6 +343,13 @@ vr::EVRInitError CServerDriver_PSMoveService::Init(
 			m_strPSMoveHMDSerialNo = boost::to_upper_copy<std::string>(buf);
 		}
 
+		if (initError == vr::VRInitError_None)
+		{
+			// All client API traffic gets pumped by the pose update thread
+			// from here on out so poses reach vrserver as soon as they arrive
+			StartPoseUpdateThread();
+		}
+
 		m_bInitialized = true;
 	}
 	else
@@ -378,6 +397,9 @@ void CServerDriver_PSMoveService::Cleanup()
 {
 	if (m_bInitialized)
 	{
+		// Stop pumping the client API before tearing the connection down
+		StopPoseUpdateThread();
+
 		DriverLog("CServerDriver_PSMoveService::Cleanup - Shutting down connection...\n");
 		ClientPSMoveAPI::shutdown();
 		DriverLog("CServerDriver_PSMoveService::Cleanup - Shutdown complete\n");
@@ -393,12 +415,16 @@ const char * const *CServerDriver_PSMoveService::GetInterfaceVersions()
 
 uint32_t CServerDriver_PSMoveService::GetTrackedDeviceCount()
 {
+    std::lock_guard<std::recursive_mutex> lock(m_TrackedDeviceListMutex);
+
     return static_cast<uint32_t>(m_vecTrackedDevices.size());
 }
 
-vr::ITrackedDeviceServerDriver * CServerDriver_PSMoveService::GetTrackedDeviceDriver( 
+vr::ITrackedDeviceServerDriver * CServerDriver_PSMoveService::GetTrackedDeviceDriver(
     uint32_t unWhich)
 {
+    std::lock_guard<std::recursive_mutex> lock(m_TrackedDeviceListMutex);
+
     if (unWhich < m_vecTrackedDevices.size())
     {
         return m_vecTrackedDevices[unWhich];
@@ -410,6 +436,8 @@ vr::ITrackedDeviceServerDriver * CServerDriver_PSMoveService::GetTrackedDeviceDr
 vr::ITrackedDeviceServerDriver * CServerDriver_PSMoveService::FindTrackedDeviceDriver(
     const char * pchId)
 {
+    std::lock_guard<std::recursive_mutex> lock(m_TrackedDeviceListMutex);
+
     for (auto it = m_vecTrackedDevices.begin(); it != m_vecTrackedDevices.end(); ++it)
     {
         if ( 0 == strcmp( ( *it )->GetSerialNumber(), pchId ) )
@@ -423,45 +451,93 @@ vr::ITrackedDeviceServerDriver * CServerDriver_PSMoveService::FindTrackedDeviceD
 
 void CServerDriver_PSMoveService::RunFrame()
 {
-    // Poll any events from the service
-    ClientPSMoveAPI::update();
+    // Nothing to do here anymore - service messages and pose updates are
+    // handled by the pose update thread (see PoseUpdateThreadFunction) the
+    // moment they arrive, so they don't inherit vrserver's frame cadence
+}
 
-    // Poll events queued up by the call to ClientPSMoveAPI::update()
-    ClientPSMoveAPI::Message message;
-    while (ClientPSMoveAPI::poll_next_message(&message, sizeof(message)))
+// -- Pose Update Thread -----
+void CServerDriver_PSMoveService::StartPoseUpdateThread()
+{
+    if (!m_bPoseUpdateThreadStarted)
     {
-        switch (message.payload_type)
-        {
-        case ClientPSMoveAPI::_messagePayloadType_Response:
-            HandleClientPSMoveResponse(&message.response_data);
-            break;
-        case ClientPSMoveAPI::_messagePayloadType_Event:
-            HandleClientPSMoveEvent(&message.event_data);
-            break;
-        }
+        DriverLog("CServerDriver_PSMoveService::StartPoseUpdateThread - Starting pose update thread\n");
+
+        m_bExitPoseUpdateThread = false;
+        m_poseUpdateThread = std::thread(&CServerDriver_PSMoveService::PoseUpdateThreadFunction, this);
+        m_bPoseUpdateThreadStarted = true;
     }
+}
 
-    // Update all active tracked devices
-    for (auto it = m_vecTrackedDevices.begin(); it != m_vecTrackedDevices.end(); ++it)
+void CServerDriver_PSMoveService::StopPoseUpdateThread()
+{
+    if (m_bPoseUpdateThreadStarted)
     {
-        CPSMoveTrackedDeviceLatest *pTrackedDevice = *it;
+        DriverLog("CServerDriver_PSMoveService::StopPoseUpdateThread - Stopping pose update thread...\n");
+
+        // The thread sleeps in the network reactor for at most the poll
+        // timeout, so this join resolves quickly
+        m_bExitPoseUpdateThread = true;
+        m_poseUpdateThread.join();
+        m_bPoseUpdateThreadStarted = false;
 
-        switch (pTrackedDevice->GetTrackedDeviceClass())
+        DriverLog("CServerDriver_PSMoveService::StopPoseUpdateThread - Pose update thread stopped\n");
+    }
+}
+
+void CServerDriver_PSMoveService::PoseUpdateThreadFunction()
+{
+    while (!m_bExitPoseUpdateThread)
+    {
+        // Sleep in the network reactor until a data frame or service message
+        // arrives. The timeout keeps exit requests and pending rumble
+        // serviced when the connection goes quiet.
+        ClientPSMoveAPI::update_blocking(k_nPoseUpdatePollTimeoutMilliseconds);
+
+        // Handle events/responses queued up by the update.
+        // The message payloads only stay valid until the next update call,
+        // so they have to be consumed here and now.
+        ClientPSMoveAPI::Message message;
+        while (ClientPSMoveAPI::poll_next_message(&message, sizeof(message)))
         {
-        case vr::TrackedDeviceClass_Controller:
+            switch (message.payload_type)
             {
-                CPSMoveControllerLatest *pController = static_cast<CPSMoveControllerLatest *>(pTrackedDevice);
+            case ClientPSMoveAPI::_messagePayloadType_Response:
+                HandleClientPSMoveResponse(&message.response_data);
+                break;
+            case ClientPSMoveAPI::_messagePayloadType_Event:
+                HandleClientPSMoveEvent(&message.event_data);
+                break;
+            }
+        }
+
+        // Push the freshly applied device state out to vrserver immediately
+        // rather than waiting for its next RunFrame() callback
+        {
+            std::lock_guard<std::recursive_mutex> lock(m_TrackedDeviceListMutex);
 
-                pController->Update();
-            } break;
-        case vr::TrackedDeviceClass_TrackingReference:
+            for (auto it = m_vecTrackedDevices.begin(); it != m_vecTrackedDevices.end(); ++it)
             {
-                CPSMoveTrackerLatest *pTracker = static_cast<CPSMoveTrackerLatest *>(pTrackedDevice);
+                CPSMoveTrackedDeviceLatest *pTrackedDevice = *it;
 
-                pTracker->Update();
-            } break;
-        default:
-            assert(0 && "unreachable");
+                switch (pTrackedDevice->GetTrackedDeviceClass())
+                {
+                case vr::TrackedDeviceClass_Controller:
+                    {
+                        CPSMoveControllerLatest *pController = static_cast<CPSMoveControllerLatest *>(pTrackedDevice);
+
+                        pController->Update();
+                    } break;
+                case vr::TrackedDeviceClass_TrackingReference:
+                    {
+                        CPSMoveTrackerLatest *pTracker = static_cast<CPSMoveTrackerLatest *>(pTrackedDevice);
+
+                        pTracker->Update();
+                    } break;
+                default:
+                    assert(0 && "unreachable");
+                }
+            }
         }
     }
 }
@@ -582,6 +658,8 @@ void CServerDriver_PSMoveService::HandleDisconnectedFromPSMoveService()
 {
 	DriverLog("CServerDriver_PSMoveService::HandleDisconnectedFromPSMoveService - Called\n");
 
+    std::lock_guard<std::recursive_mutex> lock(m_TrackedDeviceListMutex);
+
     for (auto it = m_vecTrackedDevices.begin(); it != m_vecTrackedDevices.end(); ++it)
     {
         CPSMoveTrackedDeviceLatest *pDevice = *it;
@@ -693,6 +771,8 @@ void CServerDriver_PSMoveService::SetHMDTrackingSpace(
 
     // Tell all the devices that the relationship between the psmove and the OpenVR
     // tracking spaces changed
+    std::lock_guard<std::recursive_mutex> lock(m_TrackedDeviceListMutex);
+
     for (auto it = m_vecTrackedDevices.begin(); it != m_vecTrackedDevices.end(); ++it)
     {
         CPSMoveTrackedDeviceLatest *pDevice = *it;
@@ -713,6 +793,8 @@ void CServerDriver_PSMoveService::AllocateUniquePSMoveController(int ControllerI
     char buf[256];
     GenerateControllerSerialNumber(buf, sizeof(buf), ControllerID);
 
+    std::lock_guard<std::recursive_mutex> lock(m_TrackedDeviceListMutex);
+
     if ( !FindTrackedDeviceDriver(buf) )
     {
 		const auto &ControllerResponse = response->result_controller_list().controllers(ControllerListIndex);
@@ -739,6 +821,8 @@ void CServerDriver_PSMoveService::AllocateUniquePSNaviController(int ControllerI
     char buf[256];
     GenerateControllerSerialNumber(buf, sizeof(buf), ControllerID);
 
+    std::lock_guard<std::recursive_mutex> lock(m_TrackedDeviceListMutex);
+
     if (!FindTrackedDeviceDriver(buf))
     {
         DriverLog("added new ps navi controller %s\n", buf);
@@ -756,6 +840,8 @@ void CServerDriver_PSMoveService::AllocateUniqueDualShock4Controller(int Control
     char buf[256];
     GenerateControllerSerialNumber(buf, sizeof(buf), ControllerID);
 
+    std::lock_guard<std::recursive_mutex> lock(m_TrackedDeviceListMutex);
+
     if (!FindTrackedDeviceDriver(buf))
     {
         DriverLog("added new ps dualshock4 controller %s\n", buf);
@@ -778,6 +864,8 @@ void CServerDriver_PSMoveService::AllocateUniquePSMoveTracker(const ClientTracke
     char buf[256];
     GenerateTrackerSerialNumber(buf, sizeof(buf), trackerInfo.tracker_id);
 
+    std::lock_guard<std::recursive_mutex> lock(m_TrackedDeviceListMutex);
+
     if (!FindTrackedDeviceDriver(buf))
     {
         DriverLog("added new device %s\n", buf);
@@ -1321,6 +1409,9 @@ CPSMoveControllerLatest::CPSMoveControllerLatest( vr::IServerDriverHost * pDrive
 	, m_bDelayAfterTouchpadPress(false)
 	, m_bTouchpadWasActive(false)
 	, m_touchpadDirectionsUsed(false)
+	, m_bEnablePosePrediction(true)
+	, m_fDisplayFrequency(90.f)
+	, m_fSecondsFromVsyncToPhotons(0.011f)
 {
     char buf[256];
     GenerateControllerSerialNumber(buf, sizeof(buf), controllerId);
@@ -1392,6 +1483,11 @@ CPSMoveControllerLatest::CPSMoveControllerLatest( vr::IServerDriverHost * pDrive
 		m_fVirtuallExtendControllersY = pSettings->GetFloat("psmove_settings", "psmove_extend_y", 0.0f, &fetchError);
 		m_fVirtuallExtendControllersZ = pSettings->GetFloat("psmove_settings", "psmove_extend_z", 0.0f, &fetchError);
 
+		// Pose prediction settings (see UpdateTrackingState)
+		m_bEnablePosePrediction = pSettings->GetBool("psmove_settings", "psmove_enable_pose_prediction", true, &fetchError);
+		m_fDisplayFrequency = pSettings->GetFloat("psmove_settings", "psmove_display_frequency", 90.f, &fetchError);
+		m_fSecondsFromVsyncToPhotons = pSettings->GetFloat("psmove_settings", "psmove_seconds_from_vsync_to_photons", 0.011f, &fetchError);
+
 	
 
 		#if LOG_TOUCHPAD_EMULATION != 0
@@ -1475,10 +1571,16 @@ vr::EVRInitError CPSMoveControllerLatest::Activate(uint32_t unObjectId)
 
 		g_ServerTrackedDeviceProvider.LaunchPSMoveMonitor();
 
+        // The driver always runs on the same machine as the service, so pose
+        // data comes in over the shared memory ring instead of UDP - no
+        // serialization and no network manager thread hops on the
+        // motion-to-photon path. The TCP channel stays for configuration.
         ClientPSMoveAPI::register_callback(
             ClientPSMoveAPI::start_controller_data_stream(
-                m_controller_view, 
-                ClientPSMoveAPI::includePositionData | ClientPSMoveAPI::includePhysicsData),
+                m_controller_view,
+                ClientPSMoveAPI::includePositionData |
+                ClientPSMoveAPI::includePhysicsData |
+                ClientPSMoveAPI::useSharedMemory),
             CPSMoveControllerLatest::start_controller_response_callback,
             this);
     }
@@ -2264,13 +2366,40 @@ void CPSMoveControllerLatest::UpdateTrackingState()
     m_Pose.willDriftInYaw = false;
     m_Pose.shouldApplyHeadModel = false;
 
+    // Compute how far ahead of the last data frame the pose should be
+    // extrapolated so it lands on the photons the next scanout emits,
+    // instead of where the controller was when the sample left the service
+    float fPredictedSecondsFromNow = 0.f;
+    if (m_bEnablePosePrediction)
+    {
+        float fSecondsSinceLastVsync = 0.f;
+        uint64_t ulFrameCounter = 0;
+
+        if (m_pDriverHost->GetTimeSinceLastVsync(&fSecondsSinceLastVsync, &ulFrameCounter))
+        {
+            const float fFrameDuration = 1.f / m_fDisplayFrequency;
+
+            // Time remaining until the next vsync, plus the scanout delay after it
+            fPredictedSecondsFromNow = (fFrameDuration - fSecondsSinceLastVsync) + m_fSecondsFromVsyncToPhotons;
+
+            // Long extrapolations amplify filter noise into visible swim
+            fPredictedSecondsFromNow = fmaxf(fminf(fPredictedSecondsFromNow, k_fMaxPosePredictionSeconds), 0.f);
+        }
+    }
+
     switch (m_controller_view->GetControllerViewType())
     {
     case ClientControllerView::eControllerType::PSMove:
         {
             const ClientPSMoveView &view= m_controller_view->GetPSMoveView();
 
-            // No prediction since that's already handled in the psmove service
+            // Extrapolate the pose out to the photon time ourselves so the
+            // 10-20ms between the data frame and the display doesn't read
+            // as controller lag
+            const PSMovePose predictedPose = m_controller_view->GetPoseAtTime(fPredictedSecondsFromNow);
+
+            // The pose below is already photon-time aligned,
+            // so no additional runtime-side prediction is requested
             m_Pose.poseTimeOffset = 0.f;
 
             // No transform due to the current HMD orientation
@@ -2284,7 +2413,7 @@ void CPSMoveControllerLatest::UpdateTrackingState()
 
             // Set position
             {
-                const PSMovePosition &position = view.GetPosition();
+                const PSMovePosition &position = predictedPose.Position;
 
                 m_Pose.vecPosition[0] = position.x * k_fScalePSMoveAPIToMeters;
                 m_Pose.vecPosition[1] = position.y * k_fScalePSMoveAPIToMeters;
@@ -2294,7 +2423,7 @@ void CPSMoveControllerLatest::UpdateTrackingState()
 			// virtual extend controllers
 			if (m_fVirtuallExtendControllersY != 0.0f || m_fVirtuallExtendControllersZ != 0.0f)
 			{
-				const PSMoveQuaternion &orientation = view.GetOrientation();
+				const PSMoveQuaternion &orientation = predictedPose.Orientation;
 
 				PSMoveFloatVector3 shift;
 				shift = shift.create((float)m_Pose.vecPosition[0], (float)m_Pose.vecPosition[1], (float)m_Pose.vecPosition[2]);
@@ -2322,7 +2451,7 @@ void CPSMoveControllerLatest::UpdateTrackingState()
 
             // Set rotational coordinates
             {
-                const PSMoveQuaternion &orientation = view.GetOrientation();
+                const PSMoveQuaternion &orientation = predictedPose.Orientation;
 
                 m_Pose.qRotation.w = orientation.w;
                 m_Pose.qRotation.x = orientation.x;
@@ -2367,7 +2496,9 @@ void CPSMoveControllerLatest::UpdateTrackingState()
         {
             const ClientPSDualShock4View &view = m_controller_view->GetPSDualShock4View();
 
-            // No prediction since that's already handled in the psmove service
+            // No photon-time extrapolation for the DS4 - its filtered physics
+            // state is still too noisy (see the zeroed velocities below) and
+            // extrapolating along it just turns that noise into jitter
             m_Pose.poseTimeOffset = 0.f;
 
             // Rotate -90 degrees about the x-axis from the current HMD orientation
@@ -5,7 +5,10 @@
 #include "ClientPSMoveAPI.h"
 #include <string>
 #include <vector>
+#include <atomic>
 #include <chrono>
+#include <mutex>
+#include <thread>
 
 //-- pre-declarations -----
 class CPSMoveTrackedDeviceLatest;
@@ -43,6 +46,11 @@ private:
     void AllocateUniquePSMoveTracker(const ClientTrackerInfo &trackerInfo);
     bool ReconnectToPSMoveService();
 
+    // Pose Update Thread
+    void StartPoseUpdateThread();
+    void StopPoseUpdateThread();
+    void PoseUpdateThreadFunction();
+
     // Event Handling
     void HandleClientPSMoveEvent(const ClientPSMoveAPI::EventMessage *event);
     void HandleConnectedToPSMoveService();
@@ -68,6 +76,19 @@ private:
 
     std::vector< CPSMoveTrackedDeviceLatest * > m_vecTrackedDevices;
 
+    // Guards m_vecTrackedDevices - devices get allocated on the pose update
+    // thread (while handling list responses) while vrserver queries them from
+    // its own thread. Recursive because device updates made under the lock
+    // can re-enter through SetHMDTrackingSpace()
+    std::recursive_mutex m_TrackedDeviceListMutex;
+
+    // Pose update thread - blocks on incoming data frames and publishes pose
+    // updates to vrserver the moment they arrive instead of waiting for the
+    // next RunFrame() callback
+    std::thread m_poseUpdateThread;
+    std::atomic_bool m_bExitPoseUpdateThread;
+    bool m_bPoseUpdateThreadStarted;
+
     // HMD Tracking Space
     PSMovePose m_worldFromDriverPose;
 };
@@ -290,6 +311,13 @@ private:
 	// is held when it's being calibrated.
 	float m_fControllerMetersInFrontOfHmdAtCallibration;
 
+	// Settings values: used to extrapolate the pose out to the photon time of
+	// the next scanout instead of submitting it where the data frame left it
+	// (see UpdateTrackingState).
+	bool m_bEnablePosePrediction;
+	float m_fDisplayFrequency;
+	float m_fSecondsFromVsyncToPhotons;
+
 	// The position of the controller in meters in driver space relative to its own rotation
 	// at the time when the touchpad was most recently pressed (after being up).
 	PSMoveFloatVector3 m_posMetersAtTouchpadPressTime;
@@ -1,12 +1,19 @@
 //-- includes -----
 #include "ClientControllerView.h"
+#include "ClientLog.h"
 #include "ClientNetworkManager.h"
+#include "ClientPSMoveAPI.h"
+#include "ControllerStreamPacket.h"
 #include "PSMoveProtocolInterface.h"
 #include "PSMoveProtocol.pb.h"
 #include "MathUtility.h"
+#include "SharedControllerState.h"
+#include <boost/interprocess/shared_memory_object.hpp>
+#include <boost/interprocess/mapped_region.hpp>
 #include <chrono>
 #include <algorithm>
 #include <assert.h>
+#include <stdio.h>
 
 //-- pre-declarations -----
 
@@ -19,9 +26,99 @@ const PSDualShock4CalibratedSensorData k_empty_ds4_calibrated_sensor_data = { {
 const PSMoveFloatVector3 k_identity_gravity_calibration_direction= {0.f, 1.f, 0.f};
 const PSMoveRawTrackerData k_empty_raw_tracker_data = { 0 };
 
+// How often an otherwise idle controller stream sends an input data frame
+// purely to echo the newest service timestamp back for latency measurement
+const long long k_service_timestamp_echo_interval_ms = 500;
+
 //-- prototypes ----
 static void update_button_state(PSMoveButtonState &button, unsigned int button_bitmask, unsigned int button_bit);
 
+//-- shared memory stream access -----
+/// Maps the stream packet ring published by a same-host service
+class SharedControllerStateReadOnlyAccessor
+{
+public:
+    SharedControllerStateReadOnlyAccessor()
+        : m_shared_memory_object(nullptr)
+        , m_region(nullptr)
+    {
+        m_shared_memory_name[0]= '\0';
+    }
+
+    ~SharedControllerStateReadOnlyAccessor()
+    {
+        dispose();
+    }
+
+    bool initialize(const char *shared_memory_name)
+    {
+        bool bSuccess = false;
+
+        try
+        {
+            CLIENT_LOG_INFO("SharedMemory::initialize()") << "Opening shared memory: " << shared_memory_name;
+
+            // Remember the name of the shared memory
+            strncpy(m_shared_memory_name, shared_memory_name, sizeof(m_shared_memory_name)-1);
+            m_shared_memory_name[sizeof(m_shared_memory_name) - 1] = '\0';
+
+            // Open the shared memory object created by the service
+            m_shared_memory_object =
+                new boost::interprocess::shared_memory_object(
+                    boost::interprocess::open_only,
+                    shared_memory_name,
+                    boost::interprocess::read_only);
+
+            // Map all of the shared memory for read access
+            m_region = new boost::interprocess::mapped_region(*m_shared_memory_object, boost::interprocess::read_only);
+
+            bSuccess = true;
+        }
+        catch (boost::interprocess::interprocess_exception &ex)
+        {
+            dispose();
+            CLIENT_LOG_ERROR("SharedMemory::initialize()") << "Failed to open shared memory: " << m_shared_memory_name
+                << ", reason: " << ex.what();
+        }
+        catch (std::exception &ex)
+        {
+            dispose();
+            CLIENT_LOG_ERROR("SharedMemory::initialize()") << "Failed to open shared memory: " << m_shared_memory_name
+                << ", reason: " << ex.what();
+        }
+
+        return bSuccess;
+    }
+
+    void dispose()
+    {
+        if (m_region != nullptr)
+        {
+            delete m_region;
+            m_region = nullptr;
+        }
+
+        if (m_shared_memory_object != nullptr)
+        {
+            delete m_shared_memory_object;
+            m_shared_memory_object = nullptr;
+        }
+    }
+
+    bool readLatestPacket(ControllerStreamPacket &out_packet)
+    {
+        const SharedControllerStateBuffer *state_buffer=
+            reinterpret_cast<const SharedControllerStateBuffer *>(m_region->get_address());
+
+        return state_buffer->readLatestPacket(out_packet);
+    }
+
+private:
+    char m_shared_memory_name[256];
+    boost::interprocess::shared_memory_object *m_shared_memory_object;
+    boost::interprocess::mapped_region *m_region;
+};
+
 //-- implementation -----
 
 //-- ClientPSMoveView -----
@@ -267,6 +364,168 @@ void ClientPSMoveView::ApplyControllerDataFrame(
     }
 }
 
+void ClientPSMoveView::ApplyControllerStreamPacket(
+    const ControllerStreamPacket *packet)
+{
+    if ((packet->flags & CONTROLLER_STREAM_PACKET_FLAG_CONNECTED) != 0)
+    {
+        const ControllerStreamPacket_PSMoveState &psmove_packet= packet->state.psmove;
+
+        this->bHasValidHardwareCalibration= psmove_packet.bValidHardwareCalibration != 0;
+        this->bIsTrackingEnabled= psmove_packet.bIsTrackingEnabled != 0;
+        this->bIsCurrentlyTracking= psmove_packet.bIsCurrentlyTracking != 0;
+        this->bIsOrientationValid = psmove_packet.bIsOrientationValid != 0;
+        this->bIsPositionValid = psmove_packet.bIsPositionValid != 0;
+
+        this->Pose.Orientation.w= psmove_packet.orientation.w;
+        this->Pose.Orientation.x= psmove_packet.orientation.x;
+        this->Pose.Orientation.y= psmove_packet.orientation.y;
+        this->Pose.Orientation.z= psmove_packet.orientation.z;
+
+        this->Pose.Position.x= psmove_packet.position_cm.x;
+        this->Pose.Position.y= psmove_packet.position_cm.y;
+        this->Pose.Position.z= psmove_packet.position_cm.z;
+
+        if ((packet->flags & CONTROLLER_STREAM_PACKET_FLAG_HAS_RAW_SENSOR_DATA) != 0)
+        {
+            this->RawSensorData.Magnetometer.i= psmove_packet.raw_magnetometer.i;
+            this->RawSensorData.Magnetometer.j= psmove_packet.raw_magnetometer.j;
+            this->RawSensorData.Magnetometer.k= psmove_packet.raw_magnetometer.k;
+
+            this->RawSensorData.Accelerometer.i= psmove_packet.raw_accelerometer.i;
+            this->RawSensorData.Accelerometer.j= psmove_packet.raw_accelerometer.j;
+            this->RawSensorData.Accelerometer.k= psmove_packet.raw_accelerometer.k;
+
+            this->RawSensorData.Gyroscope.i= psmove_packet.raw_gyroscope.i;
+            this->RawSensorData.Gyroscope.j= psmove_packet.raw_gyroscope.j;
+            this->RawSensorData.Gyroscope.k= psmove_packet.raw_gyroscope.k;
+        }
+        else
+        {
+            this->RawSensorData.Clear();
+        }
+
+        if ((packet->flags & CONTROLLER_STREAM_PACKET_FLAG_HAS_CALIBRATED_SENSOR_DATA) != 0)
+        {
+            this->CalibratedSensorData.Magnetometer.i = psmove_packet.calibrated_magnetometer.i;
+            this->CalibratedSensorData.Magnetometer.j = psmove_packet.calibrated_magnetometer.j;
+            this->CalibratedSensorData.Magnetometer.k = psmove_packet.calibrated_magnetometer.k;
+
+            this->CalibratedSensorData.Accelerometer.i = psmove_packet.calibrated_accelerometer.i;
+            this->CalibratedSensorData.Accelerometer.j = psmove_packet.calibrated_accelerometer.j;
+            this->CalibratedSensorData.Accelerometer.k = psmove_packet.calibrated_accelerometer.k;
+
+            this->CalibratedSensorData.Gyroscope.i = psmove_packet.calibrated_gyroscope.i;
+            this->CalibratedSensorData.Gyroscope.j = psmove_packet.calibrated_gyroscope.j;
+            this->CalibratedSensorData.Gyroscope.k = psmove_packet.calibrated_gyroscope.k;
+        }
+        else
+        {
+            this->CalibratedSensorData.Clear();
+        }
+
+        if ((packet->flags & CONTROLLER_STREAM_PACKET_FLAG_HAS_RAW_TRACKER_DATA) != 0)
+        {
+            const ControllerStreamPacket_RawTrackerData &raw_tracker_data= psmove_packet.raw_tracker_data;
+
+            this->RawTrackerData.ValidTrackerLocations =
+                std::min(raw_tracker_data.valid_tracker_count, PSMOVESERVICE_MAX_TRACKER_COUNT);
+
+            for (int listIndex = 0; listIndex < this->RawTrackerData.ValidTrackerLocations; ++listIndex)
+            {
+                const ControllerStreamPacket_Pixel &locationOnTracker = raw_tracker_data.screen_locations[listIndex];
+                const ControllerStreamPacket_Position &positionOnTracker = raw_tracker_data.relative_positions_cm[listIndex];
+                const ControllerStreamPacket_Quaternion &orientationOnTracker = raw_tracker_data.relative_orientations[listIndex];
+                const ControllerStreamPacket_TrackingProjection &packetProjection = raw_tracker_data.projections[listIndex];
+
+                this->RawTrackerData.TrackerIDs[listIndex]= raw_tracker_data.tracker_ids[listIndex];
+                this->RawTrackerData.ScreenLocations[listIndex] =
+                    PSMoveScreenLocation::create(locationOnTracker.x, locationOnTracker.y);
+                this->RawTrackerData.RelativePositionsCm[listIndex] =
+                    PSMovePosition::create(
+                        positionOnTracker.x, positionOnTracker.y, positionOnTracker.z);
+				this->RawTrackerData.RelativeOrientations[listIndex] =
+					PSMoveQuaternion::create(
+						orientationOnTracker.w, orientationOnTracker.x, orientationOnTracker.y, orientationOnTracker.z);
+
+                if (packetProjection.shape_type == ControllerStreamPacketProjectionType_Ellipse)
+                {
+                    PSMoveTrackingProjection &projection= this->RawTrackerData.TrackingProjections[listIndex];
+
+                    projection.shape.ellipse.center.x = packetProjection.shape.ellipse.center.x;
+                    projection.shape.ellipse.center.y = packetProjection.shape.ellipse.center.y;
+                    projection.shape.ellipse.half_x_extent = packetProjection.shape.ellipse.half_x_extent;
+                    projection.shape.ellipse.half_y_extent = packetProjection.shape.ellipse.half_y_extent;
+                    projection.shape.ellipse.angle = packetProjection.shape.ellipse.angle;
+                    projection.shape_type = PSMoveTrackingProjection::eShapeType::Ellipse;
+                }
+                else
+                {
+                    PSMoveTrackingProjection &projection = this->RawTrackerData.TrackingProjections[listIndex];
+
+                    projection.shape_type = PSMoveTrackingProjection::eShapeType::INVALID_PROJECTION;
+                }
+            }
+
+			if (raw_tracker_data.bValidMulticamPosition != 0)
+			{
+				this->RawTrackerData.MulticamPositionCm.x = raw_tracker_data.multicam_position_cm.x;
+				this->RawTrackerData.MulticamPositionCm.y = raw_tracker_data.multicam_position_cm.y;
+				this->RawTrackerData.MulticamPositionCm.z = raw_tracker_data.multicam_position_cm.z;
+				this->RawTrackerData.bMulticamPositionValid = true;
+			}
+        }
+        else
+        {
+            this->RawTrackerData.Clear();
+        }
+
+        if ((packet->flags & CONTROLLER_STREAM_PACKET_FLAG_HAS_PHYSICS_DATA) != 0)
+        {
+            const ControllerStreamPacket_PhysicsData &packet_physics_data= psmove_packet.physics_data;
+
+            this->PhysicsData.VelocityCmPerSec.i = packet_physics_data.velocity_cm_per_sec.i;
+            this->PhysicsData.VelocityCmPerSec.j = packet_physics_data.velocity_cm_per_sec.j;
+            this->PhysicsData.VelocityCmPerSec.k = packet_physics_data.velocity_cm_per_sec.k;
+
+            this->PhysicsData.AccelerationCmPerSecSqr.i = packet_physics_data.acceleration_cm_per_sec_sqr.i;
+            this->PhysicsData.AccelerationCmPerSecSqr.j = packet_physics_data.acceleration_cm_per_sec_sqr.j;
+            this->PhysicsData.AccelerationCmPerSecSqr.k = packet_physics_data.acceleration_cm_per_sec_sqr.k;
+
+            this->PhysicsData.AngularVelocityRadPerSec.i = packet_physics_data.angular_velocity_rad_per_sec.i;
+            this->PhysicsData.AngularVelocityRadPerSec.j = packet_physics_data.angular_velocity_rad_per_sec.j;
+            this->PhysicsData.AngularVelocityRadPerSec.k = packet_physics_data.angular_velocity_rad_per_sec.k;
+
+            this->PhysicsData.AngularAccelerationRadPerSecSqr.i = packet_physics_data.angular_acceleration_rad_per_sec_sqr.i;
+            this->PhysicsData.AngularAccelerationRadPerSecSqr.j = packet_physics_data.angular_acceleration_rad_per_sec_sqr.j;
+            this->PhysicsData.AngularAccelerationRadPerSecSqr.k = packet_physics_data.angular_acceleration_rad_per_sec_sqr.k;
+        }
+        else
+        {
+            this->PhysicsData.Clear();
+        }
+
+        unsigned int button_bitmask= packet->button_down_bitmask;
+        update_button_state(TriangleButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_TRIANGLE);
+        update_button_state(CircleButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_CIRCLE);
+        update_button_state(CrossButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_CROSS);
+        update_button_state(SquareButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_SQUARE);
+        update_button_state(SelectButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_SELECT);
+        update_button_state(StartButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_START);
+        update_button_state(PSButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_PS);
+        update_button_state(MoveButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_MOVE);
+        update_button_state(TriggerButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_TRIGGER);
+
+        this->TriggerValue= psmove_packet.trigger_value;
+
+        this->bValid= true;
+    }
+    else
+    {
+        Clear();
+    }
+}
+
 void ClientPSMoveView::Publish(
     PSMoveProtocol::DeviceInputDataFrame_ControllerDataPacket *data_frame)
 {
@@ -358,6 +617,37 @@ void ClientPSNaviView::ApplyControllerDataFrame(const PSMoveProtocol::DeviceOutp
     }
 }
 
+void ClientPSNaviView::ApplyControllerStreamPacket(const ControllerStreamPacket *packet)
+{
+    if ((packet->flags & CONTROLLER_STREAM_PACKET_FLAG_CONNECTED) != 0)
+    {
+        const ControllerStreamPacket_PSNaviState &psnavi_packet= packet->state.psnavi;
+
+        unsigned int button_bitmask= packet->button_down_bitmask;
+        update_button_state(L1Button, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_L1);
+        update_button_state(L2Button, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_L2);
+        update_button_state(L3Button, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_L3);
+        update_button_state(CircleButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_CIRCLE);
+        update_button_state(CrossButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_CROSS);
+        update_button_state(PSButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_PS);
+        update_button_state(TriggerButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_TRIGGER);
+        update_button_state(DPadUpButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_UP);
+        update_button_state(DPadRightButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_RIGHT);
+        update_button_state(DPadDownButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_DOWN);
+        update_button_state(DPadLeftButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_LEFT);
+
+        this->TriggerValue= psnavi_packet.trigger_value;
+        this->Stick_XAxis= psnavi_packet.stick_xaxis;
+        this->Stick_YAxis= psnavi_packet.stick_yaxis;
+
+        this->bValid= true;
+    }
+    else
+    {
+        Clear();
+    }
+}
+
 void ClientPSNaviView::Publish(PSMoveProtocol::DeviceInputDataFrame_ControllerDataPacket *data_frame)
 {
     // Nothing to publish
@@ -608,6 +898,192 @@ void ClientPSDualShock4View::ApplyControllerDataFrame(const PSMoveProtocol::Devi
     }
 }
 
+void ClientPSDualShock4View::ApplyControllerStreamPacket(const ControllerStreamPacket *packet)
+{
+    if ((packet->flags & CONTROLLER_STREAM_PACKET_FLAG_CONNECTED) != 0)
+    {
+        const ControllerStreamPacket_PSDualShock4State &psds4_packet= packet->state.psdualshock4;
+
+        this->bHasValidHardwareCalibration = psds4_packet.bValidHardwareCalibration != 0;
+        this->bIsTrackingEnabled = psds4_packet.bIsTrackingEnabled != 0;
+        this->bIsCurrentlyTracking = psds4_packet.bIsCurrentlyTracking != 0;
+        this->bIsOrientationValid = psds4_packet.bIsOrientationValid != 0;
+        this->bIsPositionValid = psds4_packet.bIsPositionValid != 0;
+
+        this->Pose.Orientation.w = psds4_packet.orientation.w;
+        this->Pose.Orientation.x = psds4_packet.orientation.x;
+        this->Pose.Orientation.y = psds4_packet.orientation.y;
+        this->Pose.Orientation.z = psds4_packet.orientation.z;
+
+        this->Pose.Position.x = psds4_packet.position_cm.x;
+        this->Pose.Position.y = psds4_packet.position_cm.y;
+        this->Pose.Position.z = psds4_packet.position_cm.z;
+
+        if ((packet->flags & CONTROLLER_STREAM_PACKET_FLAG_HAS_RAW_SENSOR_DATA) != 0)
+        {
+            this->RawSensorData.Accelerometer.i = psds4_packet.raw_accelerometer.i;
+            this->RawSensorData.Accelerometer.j = psds4_packet.raw_accelerometer.j;
+            this->RawSensorData.Accelerometer.k = psds4_packet.raw_accelerometer.k;
+
+            this->RawSensorData.Gyroscope.i = psds4_packet.raw_gyroscope.i;
+            this->RawSensorData.Gyroscope.j = psds4_packet.raw_gyroscope.j;
+            this->RawSensorData.Gyroscope.k = psds4_packet.raw_gyroscope.k;
+        }
+        else
+        {
+            this->RawSensorData.Clear();
+        }
+
+        if ((packet->flags & CONTROLLER_STREAM_PACKET_FLAG_HAS_CALIBRATED_SENSOR_DATA) != 0)
+        {
+            this->CalibratedSensorData.Accelerometer.i = psds4_packet.calibrated_accelerometer.i;
+            this->CalibratedSensorData.Accelerometer.j = psds4_packet.calibrated_accelerometer.j;
+            this->CalibratedSensorData.Accelerometer.k = psds4_packet.calibrated_accelerometer.k;
+
+            this->CalibratedSensorData.Gyroscope.i = psds4_packet.calibrated_gyroscope.i;
+            this->CalibratedSensorData.Gyroscope.j = psds4_packet.calibrated_gyroscope.j;
+            this->CalibratedSensorData.Gyroscope.k = psds4_packet.calibrated_gyroscope.k;
+        }
+        else
+        {
+            this->CalibratedSensorData.Clear();
+        }
+
+        if ((packet->flags & CONTROLLER_STREAM_PACKET_FLAG_HAS_RAW_TRACKER_DATA) != 0)
+        {
+            const ControllerStreamPacket_RawTrackerData &raw_tracker_data= psds4_packet.raw_tracker_data;
+
+            this->RawTrackerData.ValidTrackerLocations =
+                std::min(raw_tracker_data.valid_tracker_count, PSMOVESERVICE_MAX_TRACKER_COUNT);
+
+            for (int listIndex = 0; listIndex < this->RawTrackerData.ValidTrackerLocations; ++listIndex)
+            {
+                const ControllerStreamPacket_Pixel &locationOnTracker = raw_tracker_data.screen_locations[listIndex];
+                const ControllerStreamPacket_Position &positionOnTrackerCm = raw_tracker_data.relative_positions_cm[listIndex];
+                const ControllerStreamPacket_Quaternion &orientationOnTracker = raw_tracker_data.relative_orientations[listIndex];
+                const ControllerStreamPacket_TrackingProjection &packetProjection = raw_tracker_data.projections[listIndex];
+
+                this->RawTrackerData.TrackerIDs[listIndex] = raw_tracker_data.tracker_ids[listIndex];
+                this->RawTrackerData.ScreenLocations[listIndex] =
+                    PSMoveScreenLocation::create(locationOnTracker.x, locationOnTracker.y);
+                this->RawTrackerData.RelativePositionsCm[listIndex] =
+                    PSMovePosition::create(
+                        positionOnTrackerCm.x, positionOnTrackerCm.y, positionOnTrackerCm.z);
+                this->RawTrackerData.RelativeOrientations[listIndex] =
+                    PSMoveQuaternion::create(
+                        orientationOnTracker.w, orientationOnTracker.x, orientationOnTracker.y, orientationOnTracker.z);
+
+                if (packetProjection.shape_type == ControllerStreamPacketProjectionType_LightBar)
+                {
+                    PSMoveTrackingProjection &projection = this->RawTrackerData.TrackingProjections[listIndex];
+
+                    projection.shape_type = PSMoveTrackingProjection::LightBar;
+
+                    for (int vert_index = 0; vert_index < 3; ++vert_index)
+                    {
+                        projection.shape.lightbar.triangle[vert_index].x = packetProjection.shape.lightbar.triangle[vert_index].x;
+                        projection.shape.lightbar.triangle[vert_index].y = packetProjection.shape.lightbar.triangle[vert_index].y;
+                    }
+                    for (int vert_index = 0; vert_index < 4; ++vert_index)
+                    {
+                        projection.shape.lightbar.quad[vert_index].x = packetProjection.shape.lightbar.quad[vert_index].x;
+                        projection.shape.lightbar.quad[vert_index].y = packetProjection.shape.lightbar.quad[vert_index].y;
+                    }
+                }
+                else
+                {
+                    PSMoveTrackingProjection &projection = this->RawTrackerData.TrackingProjections[listIndex];
+
+                    projection.shape_type = PSMoveTrackingProjection::eShapeType::INVALID_PROJECTION;
+                }
+            }
+
+			if (raw_tracker_data.bValidMulticamPosition != 0)
+			{
+				this->RawTrackerData.MulticamPositionCm.x = raw_tracker_data.multicam_position_cm.x;
+				this->RawTrackerData.MulticamPositionCm.y = raw_tracker_data.multicam_position_cm.y;
+				this->RawTrackerData.MulticamPositionCm.z = raw_tracker_data.multicam_position_cm.z;
+				this->RawTrackerData.bMulticamPositionValid = true;
+			}
+
+			if (raw_tracker_data.bValidMulticamOrientation != 0)
+			{
+				this->RawTrackerData.MulticamOrientation.w = raw_tracker_data.multicam_orientation.w;
+				this->RawTrackerData.MulticamOrientation.x = raw_tracker_data.multicam_orientation.x;
+				this->RawTrackerData.MulticamOrientation.y = raw_tracker_data.multicam_orientation.y;
+				this->RawTrackerData.MulticamOrientation.z = raw_tracker_data.multicam_orientation.z;
+				this->RawTrackerData.bMulticamOrientationValid = true;
+			}
+        }
+        else
+        {
+            this->RawTrackerData.Clear();
+        }
+
+        if ((packet->flags & CONTROLLER_STREAM_PACKET_FLAG_HAS_PHYSICS_DATA) != 0)
+        {
+            const ControllerStreamPacket_PhysicsData &packet_physics_data= psds4_packet.physics_data;
+
+            this->PhysicsData.VelocityCmPerSec.i = packet_physics_data.velocity_cm_per_sec.i;
+            this->PhysicsData.VelocityCmPerSec.j = packet_physics_data.velocity_cm_per_sec.j;
+            this->PhysicsData.VelocityCmPerSec.k = packet_physics_data.velocity_cm_per_sec.k;
+
+            this->PhysicsData.AccelerationCmPerSecSqr.i = packet_physics_data.acceleration_cm_per_sec_sqr.i;
+            this->PhysicsData.AccelerationCmPerSecSqr.j = packet_physics_data.acceleration_cm_per_sec_sqr.j;
+            this->PhysicsData.AccelerationCmPerSecSqr.k = packet_physics_data.acceleration_cm_per_sec_sqr.k;
+
+            this->PhysicsData.AngularVelocityRadPerSec.i = packet_physics_data.angular_velocity_rad_per_sec.i;
+            this->PhysicsData.AngularVelocityRadPerSec.j = packet_physics_data.angular_velocity_rad_per_sec.j;
+            this->PhysicsData.AngularVelocityRadPerSec.k = packet_physics_data.angular_velocity_rad_per_sec.k;
+
+            this->PhysicsData.AngularAccelerationRadPerSecSqr.i = packet_physics_data.angular_acceleration_rad_per_sec_sqr.i;
+            this->PhysicsData.AngularAccelerationRadPerSecSqr.j = packet_physics_data.angular_acceleration_rad_per_sec_sqr.j;
+            this->PhysicsData.AngularAccelerationRadPerSecSqr.k = packet_physics_data.angular_acceleration_rad_per_sec_sqr.k;
+        }
+        else
+        {
+            this->PhysicsData.Clear();
+        }
+
+        unsigned int button_bitmask = packet->button_down_bitmask;
+        update_button_state(DPadUpButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_UP);
+        update_button_state(DPadDownButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_DOWN);
+        update_button_state(DPadLeftButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_LEFT);
+        update_button_state(DPadRightButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_RIGHT);
+
+        update_button_state(L1Button, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_L1);
+        update_button_state(R1Button, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_R1);
+        update_button_state(L2Button, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_L2);
+        update_button_state(R2Button, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_R2);
+        update_button_state(L3Button, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_L3);
+        update_button_state(R3Button, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_R3);
+
+        update_button_state(TriangleButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_TRIANGLE);
+        update_button_state(CircleButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_CIRCLE);
+        update_button_state(CrossButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_CROSS);
+        update_button_state(SquareButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_SQUARE);
+
+        update_button_state(ShareButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_SHARE);
+        update_button_state(OptionsButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_OPTIONS);
+
+        update_button_state(PSButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_PS);
+        update_button_state(TrackPadButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_TRACKPAD);
+
+        this->LeftAnalogX = psds4_packet.left_thumbstick_x;
+        this->LeftAnalogY = psds4_packet.left_thumbstick_y;
+        this->RightAnalogX = psds4_packet.right_thumbstick_x;
+        this->RightAnalogY = psds4_packet.right_thumbstick_y;
+        this->LeftTriggerValue = psds4_packet.left_trigger_value;
+        this->RightTriggerValue = psds4_packet.right_trigger_value;
+
+        this->bValid = true;
+    }
+    else
+    {
+        Clear();
+    }
+}
+
 void ClientPSDualShock4View::Publish(
     PSMoveProtocol::DeviceInputDataFrame_ControllerDataPacket *data_frame)
 {
@@ -694,11 +1170,73 @@ const PSMoveRawTrackerData &ClientPSDualShock4View::GetRawTrackerData() const
 
 //-- ClientControllerView -----
 ClientControllerView::ClientControllerView(int PSMoveID)
+    : m_shared_memory_accesor(nullptr)
 {
     Clear();
     this->ControllerID= PSMoveID;
 }
 
+ClientControllerView::~ClientControllerView()
+{
+    CloseSharedMemoryStream();
+}
+
+bool ClientControllerView::OpenSharedMemoryStream()
+{
+    if (m_shared_memory_accesor == nullptr)
+    {
+        char shared_memory_name[64];
+
+        // The service publishes one ring per controller under a well known name
+        snprintf(shared_memory_name, sizeof(shared_memory_name), "controller_view_%d", ControllerID);
+
+        m_shared_memory_accesor= new SharedControllerStateReadOnlyAccessor();
+
+        if (!m_shared_memory_accesor->initialize(shared_memory_name))
+        {
+            delete m_shared_memory_accesor;
+            m_shared_memory_accesor= nullptr;
+        }
+    }
+
+    return m_shared_memory_accesor != nullptr;
+}
+
+void ClientControllerView::CloseSharedMemoryStream()
+{
+    if (m_shared_memory_accesor != nullptr)
+    {
+        delete m_shared_memory_accesor;
+        m_shared_memory_accesor= nullptr;
+    }
+}
+
+bool ClientControllerView::GetIsSharedMemoryStreamOpen() const
+{
+    return m_shared_memory_accesor != nullptr;
+}
+
+bool ClientControllerView::PollSharedMemoryStream()
+{
+    bool bAppliedNewPacket= false;
+
+    if (m_shared_memory_accesor != nullptr)
+    {
+        ControllerStreamPacket packet;
+
+        // Only apply packets we haven't seen yet so re-reading the same
+        // slot between publishes doesn't skew the receive rate statistics
+        if (m_shared_memory_accesor->readLatestPacket(packet) &&
+            packet.sequence_num > OutputSequenceNum)
+        {
+            ApplyControllerStreamPacket(&packet);
+            bAppliedNewPacket= true;
+        }
+    }
+
+    return bAppliedNewPacket;
+}
+
 void ClientControllerView::Clear()
 {
     ControllerID = -1;
@@ -711,14 +1249,29 @@ void ClientControllerView::Clear()
     ControllerViewType= None;
     memset(&ViewState, 0, sizeof(ViewState));
 
-    data_frame_last_received_time= 
+    data_frame_last_received_time=
         std::chrono::duration_cast< std::chrono::milliseconds >(
                 std::chrono::system_clock::now().time_since_epoch()).count();
     data_frame_average_fps= 0.f;
+
+    LastServiceTimestampUs= 0;
+    HasUnechoedServiceTimestamp= false;
+    LastEchoSentTimeMs= 0;
+
+    LastPublishTickId= -1;
+
+    TrackingQuality= 0.f;
+    AvgProjectionFitError= 0.f;
+    AvgMulticamDisagreementCm= 0.f;
+    AvgFilterInnovationCm= 0.f;
+
+    PoseHistoryHead= 0;
+    PoseHistoryCount= 0;
 }
 
 void ClientControllerView::ApplyControllerDataFrame(
-    const PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket *data_frame)
+    const PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket *data_frame,
+    long long publish_tick_id)
 {
     assert(data_frame->controller_id() == ControllerID);
 
@@ -745,6 +1298,11 @@ void ClientControllerView::ApplyControllerDataFrame(
         this->OutputSequenceNum= data_frame->sequence_num();
         this->IsConnected= data_frame->isconnected();
 
+        if (publish_tick_id > 0)
+        {
+            this->LastPublishTickId= publish_tick_id;
+        }
+
         switch(data_frame->controller_type())
         {
         case PSMoveProtocol::PSMOVE:
@@ -768,6 +1326,80 @@ void ClientControllerView::ApplyControllerDataFrame(
             default:
                 assert(0 && "Unhandled controller type");
         }
+
+        RecordPoseHistorySample();
+    }
+}
+
+void ClientControllerView::ApplyControllerStreamPacket(
+    const ControllerStreamPacket *packet)
+{
+    assert(packet->controller_id == ControllerID);
+
+    // Compute the data frame receive window statistics if we have received enough samples
+    {
+        long long now =
+            std::chrono::duration_cast< std::chrono::milliseconds >(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+        long long diff= now - data_frame_last_received_time;
+
+        if (diff > 0)
+        {
+            float seconds= static_cast<float>(diff) / 1000.f;
+            float fps= 1.f / seconds;
+
+            data_frame_average_fps= (0.9f)*data_frame_average_fps + (0.1f)*fps;
+        }
+
+        data_frame_last_received_time= now;
+    }
+
+    if (packet->sequence_num > this->OutputSequenceNum)
+    {
+        this->OutputSequenceNum= packet->sequence_num;
+        this->IsConnected= (packet->flags & CONTROLLER_STREAM_PACKET_FLAG_CONNECTED) != 0;
+
+        this->TrackingQuality= packet->tracking_quality;
+        this->AvgProjectionFitError= packet->avg_projection_fit_error;
+        this->AvgMulticamDisagreementCm= packet->avg_multicam_disagreement_cm;
+        this->AvgFilterInnovationCm= packet->avg_filter_innovation_cm;
+
+        if (packet->service_timestamp_us > 0)
+        {
+            this->LastServiceTimestampUs= static_cast<long long>(packet->service_timestamp_us);
+            this->HasUnechoedServiceTimestamp= true;
+        }
+
+        if (packet->publish_tick_id > 0)
+        {
+            this->LastPublishTickId= static_cast<long long>(packet->publish_tick_id);
+        }
+
+        switch(packet->controller_type)
+        {
+        case ControllerStreamPacketControllerType_PSMove:
+            {
+                this->ControllerViewType= PSMove;
+                this->ViewState.PSMoveView.ApplyControllerStreamPacket(packet);
+            } break;
+
+        case ControllerStreamPacketControllerType_PSNavi:
+            {
+                this->ControllerViewType= PSNavi;
+                this->ViewState.PSNaviView.ApplyControllerStreamPacket(packet);
+            } break;
+
+            case ControllerStreamPacketControllerType_PSDualShock4:
+            {
+                this->ControllerViewType = PSDualShock4;
+                this->ViewState.PSDualShock4View.ApplyControllerStreamPacket(packet);
+            } break;
+
+            default:
+                assert(0 && "Unhandled controller type");
+        }
+
+        RecordPoseHistorySample();
     }
 }
 
@@ -793,15 +1425,46 @@ bool ClientControllerView::GetHasUnpublishedState() const
 
 void ClientControllerView::Publish()
 {
-    if (GetHasUnpublishedState())
+    const long long now_ms =
+        std::chrono::duration_cast< std::chrono::milliseconds >(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    bool bSendDataFrame= GetHasUnpublishedState();
+
+    // With no state changes to push, still send a frame periodically to echo
+    // the newest service timestamp back so the service can keep its latency
+    // estimate for this connection fresh. Re-sending the current rumble/led
+    // state is harmless - the values haven't changed.
+    if (!bSendDataFrame &&
+        HasUnechoedServiceTimestamp &&
+        now_ms - LastEchoSentTimeMs >= k_service_timestamp_echo_interval_ms)
     {
-        DeviceInputDataFramePtr data_frame(new PSMoveProtocol::DeviceInputDataFrame);
+        bSendDataFrame= true;
+    }
+
+    if (bSendDataFrame)
+    {
+        IEmbeddedServiceInterface *embedded_service= ClientPSMoveAPI::get_embedded_service();
+
+        // Frames come from a reuse pool so steady state publishing doesn't allocate.
+        // In embedded mode there is no network manager to pool frames -
+        // allocate one (state publishes are rare enough not to matter).
+        DeviceInputDataFramePtr data_frame=
+            (embedded_service == nullptr)
+            ? ClientNetworkManager::get_instance()->acquire_input_data_frame()
+            : DeviceInputDataFramePtr(new PSMoveProtocol::DeviceInputDataFrame);
         data_frame->set_device_category(PSMoveProtocol::DeviceInputDataFrame_DeviceCategory_CONTROLLER);
 
         auto *controller_data_packet= data_frame->mutable_controller_data_packet();
         controller_data_packet->set_controller_id(ControllerID);
         controller_data_packet->set_sequence_num(++InputSequenceNum);
 
+        if (LastServiceTimestampUs > 0)
+        {
+            controller_data_packet->set_echoed_service_timestamp_us(LastServiceTimestampUs);
+            HasUnechoedServiceTimestamp= false;
+            LastEchoSentTimeMs= now_ms;
+        }
+
         switch (ControllerViewType)
         {
         case eControllerType::PSMove:
@@ -820,8 +1483,16 @@ void ClientControllerView::Publish()
             assert(0 && "Unhandled controller type");
         }
 
-        // Send the controller data frame over the network
-        ClientNetworkManager::get_instance()->send_device_data_frame(data_frame);
+        if (embedded_service != nullptr)
+        {
+            // Hand the controller data frame straight to the in-process service
+            embedded_service->handle_input_data_frame(data_frame);
+        }
+        else
+        {
+            // Send the controller data frame over the network
+            ClientNetworkManager::get_instance()->send_device_data_frame(data_frame);
+        }
     }
 }
 
@@ -842,6 +1513,138 @@ const PSMovePose &ClientControllerView::GetPose() const
     }
 }
 
+PSMovePose ClientControllerView::GetPoseAtTime(float time_offset_seconds) const
+{
+    const PSMovePose &pose= GetPose();
+    const PSMovePhysicsData &physics= GetPhysicsData();
+    const float t= time_offset_seconds;
+
+    PSMovePose predicted_pose;
+
+    // Extrapolate the position along the filtered velocity and acceleration:
+    // p(t) = p + v*t + (1/2)*a*t^2
+    predicted_pose.Position=
+        pose.Position
+        + physics.VelocityCmPerSec * t
+        + physics.AccelerationCmPerSecSqr * (0.5f * t * t);
+
+    // Integrate the angular velocity over the offset with the usual
+    // first order quaternion derivative: q(t) = q + (1/2)*w_quat*q*t
+    const PSMoveFloatVector3 w= physics.AngularVelocityRadPerSec;
+    const PSMoveQuaternion &q= pose.Orientation;
+    const PSMoveQuaternion omega_q= PSMoveQuaternion::create(0.f, w.i, w.j, w.k);
+    PSMoveQuaternion q_derivative= (omega_q * q);
+
+    predicted_pose.Orientation=
+        PSMoveQuaternion::create(
+            q.w + q_derivative.w * 0.5f * t,
+            q.x + q_derivative.x * 0.5f * t,
+            q.y + q_derivative.y * 0.5f * t,
+            q.z + q_derivative.z * 0.5f * t);
+    predicted_pose.Orientation.normalize_with_default(q);
+
+    return predicted_pose;
+}
+
+void ClientControllerView::RecordPoseHistorySample()
+{
+    // Only valid tracked poses are worth resampling against
+    if (!GetIsPoseValid())
+    {
+        return;
+    }
+
+    TimestampedPose &sample= PoseHistory[PoseHistoryHead];
+    sample.pose= GetPose();
+    sample.timestamp_us=
+        std::chrono::duration_cast< std::chrono::microseconds >(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+
+    PoseHistoryHead= (PoseHistoryHead + 1) % k_pose_history_size;
+    if (PoseHistoryCount < k_pose_history_size)
+    {
+        ++PoseHistoryCount;
+    }
+}
+
+static PSMovePose blend_timestamped_poses(
+    const PSMovePose &older_pose, const PSMovePose &newer_pose, float u)
+{
+    PSMovePose blended_pose;
+
+    blended_pose.Position=
+        older_pose.Position + (newer_pose.Position - older_pose.Position)*u;
+
+    // Normalized component-wise blend (nlerp). The samples are one data
+    // frame apart so the arc is far too small for slerp to matter.
+    const PSMoveQuaternion &qa= older_pose.Orientation;
+    PSMoveQuaternion qb= newer_pose.Orientation;
+    const float dot= qa.w*qb.w + qa.x*qb.x + qa.y*qb.y + qa.z*qb.z;
+    if (dot < 0.f)
+    {
+        // Take the short way around
+        qb= PSMoveQuaternion::create(-qb.w, -qb.x, -qb.y, -qb.z);
+    }
+
+    blended_pose.Orientation=
+        PSMoveQuaternion::create(
+            qa.w + (qb.w - qa.w)*u,
+            qa.x + (qb.x - qa.x)*u,
+            qa.y + (qb.y - qa.y)*u,
+            qa.z + (qb.z - qa.z)*u);
+    blended_pose.Orientation.normalize_with_default(qa);
+
+    return blended_pose;
+}
+
+PSMovePose ClientControllerView::GetInterpolatedPose(float time_offset_seconds) const
+{
+    if (PoseHistoryCount == 0)
+    {
+        return GetPoseAtTime(time_offset_seconds);
+    }
+
+    const long long now_us=
+        std::chrono::duration_cast< std::chrono::microseconds >(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    const long long target_us= now_us + static_cast<long long>(time_offset_seconds*1.0e6f);
+
+    // The newest sample sits just behind the ring head
+    const int newest_index= (PoseHistoryHead + k_pose_history_size - 1) % k_pose_history_size;
+    const TimestampedPose &newest= PoseHistory[newest_index];
+
+    // Past the newest sample - extrapolate along the filtered physics
+    if (target_us >= newest.timestamp_us || PoseHistoryCount < 2)
+    {
+        return GetPoseAtTime(static_cast<float>(target_us - newest.timestamp_us)*1.0e-6f);
+    }
+
+    // Walk back in time for the pair of samples bracketing the target
+    for (int step= 1; step < PoseHistoryCount; ++step)
+    {
+        const int newer_index= (newest_index + k_pose_history_size - (step - 1)) % k_pose_history_size;
+        const int older_index= (newest_index + k_pose_history_size - step) % k_pose_history_size;
+        const TimestampedPose &newer= PoseHistory[newer_index];
+        const TimestampedPose &older= PoseHistory[older_index];
+
+        if (target_us >= older.timestamp_us)
+        {
+            const long long interval_us= newer.timestamp_us - older.timestamp_us;
+            const float u=
+                (interval_us > 0)
+                ? static_cast<float>(target_us - older.timestamp_us) / static_cast<float>(interval_us)
+                : 1.f;
+
+            return blend_timestamped_poses(older.pose, newer.pose, u);
+        }
+    }
+
+    // Older than everything we kept - clamp to the oldest sample
+    const int oldest_index= (newest_index + k_pose_history_size - (PoseHistoryCount - 1)) % k_pose_history_size;
+
+    return PoseHistory[oldest_index].pose;
+}
+
 const PSMovePosition &ClientControllerView::GetPosition() const
 {
     switch (ControllerViewType)
@@ -15,6 +15,7 @@ namespace PSMoveProtocol
     class DeviceInputDataFrame;
     class DeviceInputDataFrame_ControllerDataPacket;
 };
+struct ControllerStreamPacket;
 
 //-- constants -----
 enum PSMoveButtonState {
@@ -216,6 +217,7 @@ private:
 public:
     void Clear();
     void ApplyControllerDataFrame(const PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket *data_frame);
+    void ApplyControllerStreamPacket(const struct ControllerStreamPacket *packet);
     void Publish(PSMoveProtocol::DeviceInputDataFrame_ControllerDataPacket *data_frame);
 
     void SetRumble(float rumbleFraction);
@@ -366,6 +368,7 @@ private:
 public:
     void Clear();
     void ApplyControllerDataFrame(const PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket *data_frame);
+    void ApplyControllerStreamPacket(const struct ControllerStreamPacket *packet);
     void Publish(PSMoveProtocol::DeviceInputDataFrame_ControllerDataPacket *data_frame);
 
     inline bool IsValid() const
@@ -544,6 +547,7 @@ private:
 public:
     void Clear();
     void ApplyControllerDataFrame(const PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket *data_frame);
+    void ApplyControllerStreamPacket(const struct ControllerStreamPacket *packet);
     void Publish(PSMoveProtocol::DeviceInputDataFrame_ControllerDataPacket *data_frame);
 
     void SetBigRumble(float rumbleFraction);
@@ -773,13 +777,65 @@ private:
     long long data_frame_last_received_time;
     float data_frame_average_fps;
 
+    // Service timestamp carried by the most recently received stream packet,
+    // echoed back in the next input data frame so the service can measure
+    // this connection's delivery latency (see Publish)
+    long long LastServiceTimestampUs;
+    bool HasUnechoedServiceTimestamp;
+    long long LastEchoSentTimeMs;
+
+    // Id of the service publish pass that produced the most recently applied
+    // packet (-1 until one arrives). Packets from different controllers that
+    // share a publish tick id were generated by the same service update
+    // (see ClientPSMoveAPI::get_coherent_controller_snapshot)
+    long long LastPublishTickId;
+
+    // Rolling tracking quality telemetry computed on the service
+    // (only carried by the fixed-layout controller stream packets)
+    float TrackingQuality;
+    float AvgProjectionFitError;
+    float AvgMulticamDisagreementCm;
+    float AvgFilterInnovationCm;
+
+    // Number of timestamped pose samples kept for GetInterpolatedPose()
+    enum { k_pose_history_size= 8 };
+
+    // Ring buffer of the most recently received poses, stamped with the
+    // receive time in microseconds. Head is the next write slot.
+    struct TimestampedPose
+    {
+        PSMovePose pose;
+        long long timestamp_us;
+    };
+    TimestampedPose PoseHistory[k_pose_history_size];
+    int PoseHistoryHead;
+    int PoseHistoryCount;
+
+    // Only allocated when the client opted into the shared memory stream
+    class SharedControllerStateReadOnlyAccessor *m_shared_memory_accesor;
+
+    // Append the current pose to the history ring after a new data frame
+    void RecordPoseHistorySample();
+
 public:
     ClientControllerView(int ControllerID);
+    ~ClientControllerView();
 
     void Clear();
-    void ApplyControllerDataFrame(const PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket *data_frame);
+    // publish_tick_id comes from the enclosing DeviceOutputDataFrame
+    // (0 when talking to a service that doesn't stamp it)
+    void ApplyControllerDataFrame(
+        const PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket *data_frame,
+        long long publish_tick_id);
+    void ApplyControllerStreamPacket(const struct ControllerStreamPacket *packet);
     void Publish();
 
+    // Shared memory stream access for same-host clients
+    bool OpenSharedMemoryStream();
+    void CloseSharedMemoryStream();
+    bool GetIsSharedMemoryStreamOpen() const;
+    bool PollSharedMemoryStream();
+
     // Listener State
     inline void IncListenerCount()
     {
@@ -861,6 +917,16 @@ public:
     }
 
     const PSMovePose &GetPose() const;
+    // Extrapolate the current pose along the filtered physics state by
+    // time_offset_seconds. Good for the few milliseconds between data frames;
+    // asking for long extrapolations gets a correspondingly rough answer.
+    PSMovePose GetPoseAtTime(float time_offset_seconds) const;
+    // Resample the pose at time_offset_seconds relative to now: offsets in
+    // the recent past blend between the buffered historical poses bracketing
+    // that instant (smooth stepping-free poses for render loops running
+    // faster than the update rate), while offsets past the newest sample
+    // fall back to the physics extrapolation of GetPoseAtTime().
+    PSMovePose GetInterpolatedPose(float time_offset_seconds) const;
     const PSMovePosition &GetPosition() const;
     const PSMoveQuaternion &GetOrientation() const;
     const PSMovePhysicsData &GetPhysicsData() const;
@@ -878,6 +944,37 @@ public:
     {
         return data_frame_average_fps;
     }
+
+    // Service publish tick of the most recently applied packet, -1 until
+    // one arrives (0-stamped packets from older services never update it)
+    inline long long GetLastPublishTickId() const
+    {
+        return LastPublishTickId;
+    }
+
+    // Rolling tracking quality computed on the service: a 0..1 composite
+    // of projection fit error, multicam disagreement and filter innovation
+    // (0 = not tracking, 1 = clean lock). Stays 0 for clients consuming
+    // the legacy protobuf data frames, which don't carry the telemetry.
+    inline float GetTrackingQuality() const
+    {
+        return TrackingQuality;
+    }
+
+    inline float GetAvgProjectionFitError() const
+    {
+        return AvgProjectionFitError;
+    }
+
+    inline float GetAvgMulticamDisagreementCm() const
+    {
+        return AvgMulticamDisagreementCm;
+    }
+
+    inline float GetAvgFilterInnovationCm() const
+    {
+        return AvgFilterInnovationCm;
+    }
 };
 
 #endif
@@ -1,6 +1,8 @@
 //-- includes -----
 #include "ClientNetworkManager.h"
+#include "ClientConstants.h"
 #include "ClientLog.h"
+#include "ControllerStreamPacket.h"
 #include "PackedMessage.h"
 #include "PSMoveProtocol.pb.h"
 #include <cassert>
@@ -14,6 +16,10 @@
 #include <boost/shared_ptr.hpp>
 #include <boost/cstdint.hpp>
 
+//-- constants -----
+// Upper bound on recycled input data frame messages kept around for reuse
+static const size_t k_max_pooled_input_data_frames= 16;
+
 //-- pre-declarations -----
 using namespace std;
 namespace asio = boost::asio;
@@ -44,7 +50,9 @@ public:
         , m_udp_socket(m_io_service, udp::endpoint(udp::v4(), 0))
         , m_udp_server_endpoint()
         , m_udp_remote_endpoint()
+        , m_input_data_frame_pool()
         , m_connection_stopped(false)
+        , m_wait_deadline_elapsed(false)
         , m_has_pending_tcp_read(false)
         , m_has_pending_tcp_write(false)
         , m_has_pending_udp_read(false)
@@ -65,6 +73,8 @@ public:
         , m_pending_requests()
     {
         memset(m_output_data_frame_buffer, 0, sizeof(m_output_data_frame_buffer));
+        memset(m_controller_stream_base_packets, 0, sizeof(m_controller_stream_base_packets));
+        memset(m_controller_stream_has_base, 0, sizeof(m_controller_stream_has_base));
     }
 
     bool start()
@@ -93,6 +103,27 @@ public:
         start_udp_queued_data_frame_write();
     }
 
+    DeviceInputDataFramePtr acquire_input_data_frame()
+    {
+        DeviceInputDataFramePtr data_frame;
+
+        if (m_input_data_frame_pool.size() > 0)
+        {
+            data_frame= m_input_data_frame_pool.back();
+            m_input_data_frame_pool.pop_back();
+
+            // Clear() keeps the memory the submessages already allocated,
+            // so steady state publishing stops hitting the allocator
+            data_frame->Clear();
+        }
+        else
+        {
+            data_frame= DeviceInputDataFramePtr(new PSMoveProtocol::DeviceInputDataFrame);
+        }
+
+        return data_frame;
+    }
+
     void poll()
     {
         bool keep_polling = true;
@@ -120,6 +151,56 @@ public:
 
     }
 
+    // Block in the reactor until at least one network event handler runs or
+    // the timeout elapses, then drain whatever else became ready. Returns
+    // true if a network event was processed before the deadline. This wakes
+    // the instant a data frame lands instead of eating a poll interval.
+    bool poll_or_wait(int timeout_ms)
+    {
+        bool bProcessedNetworkEvent= false;
+
+        if (!m_connection_stopped)
+        {
+            // Start any pending writes on the UDP socket that can be started
+            start_udp_queued_data_frame_write();
+
+            asio::deadline_timer deadline(m_io_service);
+
+            m_wait_deadline_elapsed= false;
+            deadline.expires_from_now(boost::posix_time::milliseconds(timeout_ms));
+            deadline.async_wait(boost::bind(&ClientNetworkManagerImpl::handle_wait_deadline_elapsed, this, _1));
+
+            // run_one() sleeps in the OS reactor until some handler is ready.
+            // If that handler wasn't the deadline then a socket event fired.
+            m_io_service.run_one();
+
+            if (!m_wait_deadline_elapsed)
+            {
+                bProcessedNetworkEvent= true;
+
+                // Retire the deadline handler before the timer goes out of
+                // scope - cancel() queues it with operation_aborted
+                deadline.cancel();
+
+                while (!m_wait_deadline_elapsed)
+                {
+                    m_io_service.run_one();
+                }
+            }
+        }
+
+        // Drain anything else that became ready while we slept
+        poll();
+
+        return bProcessedNetworkEvent;
+    }
+
+    void handle_wait_deadline_elapsed(const boost::system::error_code& /*ec*/)
+    {
+        // Runs for both expiration and cancellation - either way the wait is over
+        m_wait_deadline_elapsed= true;
+    }
+
     void stop()
     {
         // drain any pending requests
@@ -627,7 +708,12 @@ private:
             // no longer is there a pending write
             m_has_pending_udp_write = false;
 
-            // Remove the dataframe from the pending send queue now that it's sent
+            // Remove the dataframe from the pending send queue now that it's
+            // sent and return it to the reuse pool for the next Publish()
+            if (m_input_data_frame_pool.size() < k_max_pooled_input_data_frames)
+            {
+                m_input_data_frame_pool.push_back(m_pending_data_frames.front());
+            }
             m_pending_data_frames.pop_front();
         }
         else
@@ -646,13 +732,14 @@ private:
                 asio::buffer(m_output_data_frame_buffer, sizeof(m_output_data_frame_buffer)),
                 m_udp_server_endpoint,
                 boost::bind(
-                    &ClientNetworkManagerImpl::handle_udp_read_data_frame, 
+                    &ClientNetworkManagerImpl::handle_udp_read_data_frame,
                     this,
-                    asio::placeholders::error));
+                    asio::placeholders::error,
+                    asio::placeholders::bytes_transferred));
         }
     }
 
-    void handle_udp_read_data_frame(const boost::system::error_code& error)
+    void handle_udp_read_data_frame(const boost::system::error_code& error, std::size_t bytes_transferred)
     {
         if (m_connection_stopped)
             return;
@@ -661,8 +748,8 @@ private:
         {
             CLIENT_LOG_DEBUG("ClientNetworkManager::handle_udp_read_data_frame") << "Received DataFrame" << std::endl;
 
-            // Process the data frame now that we have received all of it
-            handle_udp_data_frame_received();
+            // Process the data frames now that we have received all of them
+            handle_udp_data_frame_received(static_cast<unsigned>(bytes_transferred));
 
             // Start reading the next incoming data frame
             start_udp_read_data_frame();
@@ -680,38 +767,162 @@ private:
         }
     }
 
-    // Called when enough data was read into m_data_frame_read_buffer for a complete data frame message. 
-    // Parse the data_frame and forward it on to the response handler.
-    void handle_udp_data_frame_received()
+    // Called for each delta-encoded stream record found in an incoming datagram.
+    // Reconstructs the full packet against the stored keyframe and dispatches it.
+    // Deltas that arrive before their keyframe (or after a dropped one) are
+    // discarded - the stream self-heals at the next keyframe.
+    void handle_controller_stream_delta(const uint8_t *record, unsigned record_len)
     {
-        // No longer is there a pending read
-        m_has_pending_udp_read= false;
+        if (record_len < sizeof(ControllerStreamDeltaHeader))
+        {
+            CLIENT_LOG_ERROR("ClientNetworkManager::handle_controller_stream_delta") << "Error truncated stream delta record" << std::endl;
+            return;
+        }
 
-        CLIENT_LOG_DEBUG("ClientNetworkManager::handle_udp_data_frame_received") << "Parsing DataFrame" << std::endl;
-        
-        // TODO: Switch on data frame type to choose which m_packed_data_frame_X to use.
-        unsigned msg_len = m_packed_output_data_frame.decode_header(m_output_data_frame_buffer, sizeof(m_output_data_frame_buffer));
-        unsigned total_len= HEADER_SIZE+msg_len;
-        CLIENT_LOG_DEBUG("    ") << show_hex(m_output_data_frame_buffer, total_len) << std::endl;
-        CLIENT_LOG_DEBUG("    ") << msg_len << " bytes" << std::endl;
+        const ControllerStreamDeltaHeader *header=
+            reinterpret_cast<const ControllerStreamDeltaHeader *>(record);
 
-        // Parse the response buffer
-        if (m_packed_output_data_frame.unpack(m_output_data_frame_buffer, total_len))
+        if (header->version != PSM_CONTROLLER_STREAM_PACKET_VERSION)
         {
-            const PSMoveProtocol::DeviceOutputDataFrame *data_frame = m_packed_output_data_frame.get_msg().get();
+            // A server built against a different packet layout - drop the record
+            CLIENT_LOG_ERROR("ClientNetworkManager::handle_controller_stream_delta") << "Error mismatched stream delta version" << std::endl;
+            return;
+        }
 
-            m_data_frame_listener->handle_data_frame(data_frame);
+        if (record_len != sizeof(ControllerStreamDeltaHeader) + header->chunk_count*CONTROLLER_STREAM_DELTA_CHUNK_SIZE)
+        {
+            CLIENT_LOG_ERROR("ClientNetworkManager::handle_controller_stream_delta") << "Error mismatched stream delta length" << std::endl;
+            return;
         }
-        else
+
+        if (header->controller_id < 0 || header->controller_id >= PSMOVESERVICE_MAX_CONTROLLER_COUNT)
         {
-            CLIENT_LOG_ERROR("ClientNetworkManager::handle_udp_data_frame_received") << "Error malformed response" << std::endl;
-            stop();
+            CLIENT_LOG_ERROR("ClientNetworkManager::handle_controller_stream_delta") << "Error invalid stream delta controller id" << std::endl;
+            return;
+        }
 
-            if (m_netEventListener)
+        if (!m_controller_stream_has_base[header->controller_id] ||
+            m_controller_stream_base_packets[header->controller_id].sequence_num != header->base_sequence_num)
+        {
+            // We never saw the keyframe this delta builds on
+            // (dropped datagram or we joined the stream mid-interval).
+            // Skip it and wait for the next keyframe.
+            CLIENT_LOG_DEBUG("ClientNetworkManager::handle_controller_stream_delta") << "Dropping stream delta with no matching keyframe" << std::endl;
+            return;
+        }
+
+        // Overlay the changed chunks onto a copy of the keyframe
+        ControllerStreamPacket reconstructed_packet= m_controller_stream_base_packets[header->controller_id];
+        uint8_t *packet_bytes= reinterpret_cast<uint8_t *>(&reconstructed_packet);
+        const uint8_t *chunk_read_ptr= record + sizeof(ControllerStreamDeltaHeader);
+
+        for (int chunk_index= 0; chunk_index < CONTROLLER_STREAM_DELTA_CHUNK_COUNT; ++chunk_index)
+        {
+            if ((header->chunk_mask & (1u << chunk_index)) != 0)
             {
-                //###HipsterSloth $TODO pick a better error code that means "malformed data"
-                m_netEventListener->handle_server_connection_socket_error(boost::asio::error::message_size);
+                memcpy(packet_bytes + chunk_index*CONTROLLER_STREAM_DELTA_CHUNK_SIZE, chunk_read_ptr, CONTROLLER_STREAM_DELTA_CHUNK_SIZE);
+                chunk_read_ptr+= CONTROLLER_STREAM_DELTA_CHUNK_SIZE;
+            }
+        }
+
+        m_data_frame_listener->handle_controller_stream_packet(&reconstructed_packet);
+    }
+
+    // Called when a datagram of one or more coalesced data frame messages was
+    // read into m_output_data_frame_buffer.
+    // Parse each data_frame and forward it on to the response handler.
+    void handle_udp_data_frame_received(unsigned datagram_len)
+    {
+        // No longer is there a pending read
+        m_has_pending_udp_read= false;
+
+        CLIENT_LOG_DEBUG("ClientNetworkManager::handle_udp_data_frame_received") << "Parsing DataFrame(s)" << std::endl;
+
+        // Walk the length-prefixed data frame records packed into the datagram
+        unsigned record_offset= 0;
+        while (record_offset + HEADER_SIZE <= datagram_len)
+        {
+            // TODO: Switch on data frame type to choose which m_packed_data_frame_X to use.
+            unsigned msg_len = m_packed_output_data_frame.decode_header(
+                m_output_data_frame_buffer + record_offset, datagram_len - record_offset);
+            unsigned total_len= HEADER_SIZE+msg_len;
+
+            if (record_offset + total_len > datagram_len)
+            {
+                CLIENT_LOG_ERROR("ClientNetworkManager::handle_udp_data_frame_received") << "Error truncated data frame record" << std::endl;
+                stop();
+
+                if (m_netEventListener)
+                {
+                    m_netEventListener->handle_server_connection_socket_error(boost::asio::error::message_size);
+                }
+
+                return;
+            }
+
+            CLIENT_LOG_DEBUG("    ") << show_hex(m_output_data_frame_buffer + record_offset, total_len) << std::endl;
+            CLIENT_LOG_DEBUG("    ") << msg_len << " bytes" << std::endl;
+
+            // Fixed-layout controller stream packets get read in place with no parse step
+            if (m_output_data_frame_buffer[record_offset + HEADER_SIZE] == CONTROLLER_STREAM_PACKET_MAGIC)
+            {
+                const ControllerStreamPacket *packet=
+                    reinterpret_cast<const ControllerStreamPacket *>(m_output_data_frame_buffer + record_offset + HEADER_SIZE);
+
+                if (msg_len == sizeof(ControllerStreamPacket) &&
+                    packet->version == PSM_CONTROLLER_STREAM_PACKET_VERSION)
+                {
+                    // Full packets double as keyframes - remember this one as
+                    // the base any following delta records get applied against
+                    if (packet->controller_id >= 0 && packet->controller_id < PSMOVESERVICE_MAX_CONTROLLER_COUNT)
+                    {
+                        m_controller_stream_base_packets[packet->controller_id]= *packet;
+                        m_controller_stream_has_base[packet->controller_id]= true;
+                    }
+
+                    m_data_frame_listener->handle_controller_stream_packet(packet);
+                }
+                else
+                {
+                    // A server built against a different packet layout - drop the record
+                    CLIENT_LOG_ERROR("ClientNetworkManager::handle_udp_data_frame_received") << "Error mismatched stream packet version" << std::endl;
+                }
+
+                record_offset+= total_len;
+                continue;
+            }
+
+            // Delta-encoded stream records overlay changed chunks onto the last keyframe
+            if (m_output_data_frame_buffer[record_offset + HEADER_SIZE] == CONTROLLER_STREAM_DELTA_MAGIC)
+            {
+                handle_controller_stream_delta(m_output_data_frame_buffer + record_offset + HEADER_SIZE, msg_len);
+
+                record_offset+= total_len;
+                continue;
+            }
+
+            // Parse the response buffer
+            if (m_packed_output_data_frame.unpack(m_output_data_frame_buffer + record_offset, total_len))
+            {
+                const PSMoveProtocol::DeviceOutputDataFrame *data_frame = m_packed_output_data_frame.get_msg().get();
+
+                m_data_frame_listener->handle_data_frame(data_frame);
+            }
+            else
+            {
+                CLIENT_LOG_ERROR("ClientNetworkManager::handle_udp_data_frame_received") << "Error malformed response" << std::endl;
+                stop();
+
+                if (m_netEventListener)
+                {
+                    //###HipsterSloth $TODO pick a better error code that means "malformed data"
+                    m_netEventListener->handle_server_connection_socket_error(boost::asio::error::message_size);
+                }
+
+                return;
             }
+
+            record_offset+= total_len;
         }
     }
 
@@ -728,7 +939,11 @@ private:
     udp::endpoint m_udp_remote_endpoint;
     bool m_udp_connection_result_read_buffer;
 
+    // Sent input data frames waiting to be reused by the next Publish()
+    vector<DeviceInputDataFramePtr> m_input_data_frame_pool;
+
     bool m_connection_stopped;
+    bool m_wait_deadline_elapsed;
     bool m_has_pending_tcp_read;
     bool m_has_pending_tcp_write;
     bool m_has_pending_udp_read;
@@ -737,9 +952,13 @@ private:
     vector<uint8_t> m_response_read_buffer;
     PackedMessage<PSMoveProtocol::Response> m_packed_response;
 
-    uint8_t m_output_data_frame_buffer[HEADER_SIZE+MAX_OUTPUT_DATA_FRAME_MESSAGE_SIZE];
+    uint8_t m_output_data_frame_buffer[MAX_OUTPUT_DATA_FRAME_DATAGRAM_SIZE];
     PackedMessage<PSMoveProtocol::DeviceOutputDataFrame> m_packed_output_data_frame;
 
+    // Last keyframe packet received per controller, the base delta records apply to
+    ControllerStreamPacket m_controller_stream_base_packets[PSMOVESERVICE_MAX_CONTROLLER_COUNT];
+    bool m_controller_stream_has_base[PSMOVESERVICE_MAX_CONTROLLER_COUNT];
+
     uint8_t m_input_data_frame_buffer[HEADER_SIZE + MAX_INPUT_DATA_FRAME_MESSAGE_SIZE];
     PackedMessage<PSMoveProtocol::DeviceInputDataFrame> m_packed_input_data_frame;
     
@@ -805,6 +1024,16 @@ void ClientNetworkManager::update()
     m_implementation_ptr->poll();
 }
 
+bool ClientNetworkManager::update_blocking(int timeout_ms)
+{
+    return m_implementation_ptr->poll_or_wait(timeout_ms);
+}
+
+DeviceInputDataFramePtr ClientNetworkManager::acquire_input_data_frame()
+{
+    return m_implementation_ptr->acquire_input_data_frame();
+}
+
 void ClientNetworkManager::shutdown()
 {
     m_implementation_ptr->stop();
@@ -26,7 +26,9 @@ public:
     bool startup();
     void send_request(RequestPtr request);
     void send_device_data_frame(DeviceInputDataFramePtr data_frame);
+    DeviceInputDataFramePtr acquire_input_data_frame();
     void update();
+    bool update_blocking(int timeout_ms);
     void shutdown();
 
 private:
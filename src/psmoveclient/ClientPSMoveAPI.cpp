@@ -4,10 +4,14 @@
 #include "ClientNetworkManager.h"
 #include "ClientControllerView.h"
 #include "ClientHMDView.h"
+#include "ControllerStreamPacket.h"
 #include "PSMoveProtocol.pb.h"
+#include <atomic>
+#include <cstdint>
+#include <deque>
 #include <iostream>
 #include <map>
-#include <deque>
+#include <set>
 
 //-- typedefs -----
 typedef std::map<int, ClientControllerView *> t_controller_view_map;
@@ -22,9 +26,89 @@ typedef std::map<int, ClientHMDView *> t_hmd_view_map;
 typedef std::map<int, ClientHMDView *>::iterator t_hmd_view_map_iterator;
 typedef std::pair<int, ClientHMDView *> t_id_hmd_view_pair;
 
-typedef std::deque<ClientPSMoveAPI::Message> t_message_queue;
 typedef std::vector<ResponsePtr> t_event_reference_cache;
 
+typedef std::deque<ClientPSMoveAPI::CoherentControllerSample> t_coherent_sample_history;
+typedef std::map<int, t_coherent_sample_history> t_coherent_sample_history_map;
+
+//-- constants -----
+// Publish ticks of controller state kept per controller while coherent
+// snapshot mode is enabled (see get_coherent_controller_snapshot)
+static const int k_coherent_snapshot_history_length= 8;
+
+//-- definitions -----
+/// Bounded lock-free single-producer/single-consumer queue of API messages.
+/// The network pump produces, poll_next_message() consumes. Both indices
+/// increment forever and get masked into the entry array, the same scheme
+/// the service uses for its HID poll thread state queue. Messages that
+/// arrive while the ring is full are counted and dropped.
+class ClientMessageQueue
+{
+public:
+    /// Capacity of the message ring (must be a power of two)
+    static const int k_max_queued_messages= 64;
+
+    ClientMessageQueue()
+        : m_write_index(0)
+        , m_read_index(0)
+        , m_dropped_message_count(0)
+    {
+    }
+
+    /// Producer side. Returns false (and counts the drop) if the ring was full.
+    bool push(const ClientPSMoveAPI::Message &message)
+    {
+        const std::uint32_t write_index= m_write_index.load(std::memory_order_relaxed);
+        const std::uint32_t read_index= m_read_index.load(std::memory_order_acquire);
+
+        if (write_index - read_index >= static_cast<std::uint32_t>(k_max_queued_messages))
+        {
+            m_dropped_message_count.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        m_messages[write_index % k_max_queued_messages]= message;
+        m_write_index.store(write_index + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /// Consumer side. Returns false if the ring was empty.
+    bool pop(ClientPSMoveAPI::Message &out_message)
+    {
+        const std::uint32_t read_index= m_read_index.load(std::memory_order_relaxed);
+        const std::uint32_t write_index= m_write_index.load(std::memory_order_acquire);
+
+        if (read_index == write_index)
+        {
+            return false;
+        }
+
+        out_message= m_messages[read_index % k_max_queued_messages];
+        m_read_index.store(read_index + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /// Consumer side. Drop everything queued so far.
+    void clear()
+    {
+        m_read_index.store(m_write_index.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    /// Total number of messages dropped because the ring was full
+    std::uint32_t getDroppedMessageCount() const
+    {
+        return m_dropped_message_count.load(std::memory_order_relaxed);
+    }
+
+private:
+    ClientPSMoveAPI::Message m_messages[k_max_queued_messages];
+    std::atomic<std::uint32_t> m_write_index;
+    std::atomic<std::uint32_t> m_read_index;
+    std::atomic<std::uint32_t> m_dropped_message_count;
+};
+
 //-- internal implementation -----
 class ClientPSMoveAPIImpl : 
     public IDataFrameListener,
@@ -45,7 +129,16 @@ public:
             this, // INotificationListener
             &m_request_manager, // IResponseListener
             this) // IClientNetworkEventListener
+        , m_embedded_service(nullptr)
         , m_controller_view_map()
+        , m_shared_memory_controller_ids()
+        , m_controller_data_callback(nullptr)
+        , m_controller_data_callback_userdata(nullptr)
+        , m_controller_button_callback(nullptr)
+        , m_controller_button_callback_userdata(nullptr)
+        , m_bounded_latency_frame_limit(0)
+        , m_stale_data_frame_drop_count(0)
+        , m_coherent_snapshot_enabled(false)
     {
     }
 
@@ -80,6 +173,34 @@ public:
         return success;
     }
 
+    bool startup_embedded(
+        IEmbeddedServiceInterface *embedded_service,
+        e_log_severity_level log_level)
+    {
+        log_init(log_level);
+
+        // Bind the request path straight to the in-process request handler
+        m_embedded_service= embedded_service;
+        m_request_manager.set_embedded_service(embedded_service);
+
+        // Async responses and notifications arrive through this callback
+        // instead of over a TCP socket
+        embedded_service->set_response_callback(ClientPSMoveAPIImpl::handle_embedded_response, this);
+
+        // Run the same connection-opened bookkeeping a network client gets:
+        // register the stream capabilities and queue the connected event
+        handle_server_connection_opened();
+
+        CLIENT_LOG_INFO("ClientPSMoveAPI") << "Successfully initialized ClientPSMoveAPI against an in-process service" << std::endl;
+
+        return true;
+    }
+
+    IEmbeddedServiceInterface *get_embedded_service() const
+    {
+        return m_embedded_service;
+    }
+
     void update()
     {
         // Drop an unread messages from the previous call to update
@@ -94,8 +215,109 @@ public:
         // Publish modified device state back to the service
         publish();
 
-        // Process incoming/outgoing networking requests
-        m_network_manager.update();
+        if (m_embedded_service != nullptr)
+        {
+            // Tick the in-process service - responses and notifications
+            // arrive synchronously through handle_embedded_response
+            m_embedded_service->update();
+        }
+        else
+        {
+            // Process incoming/outgoing networking requests
+            m_network_manager.update();
+        }
+
+        // In bounded latency mode, deliver the surviving staged data frames
+        // now that the whole backlog has been trimmed
+        flush_staged_data_frames();
+
+        // Poll the shared memory rings for any same-host streams
+        poll_shared_memory_streams();
+    }
+
+    bool update_blocking(int timeout_ms)
+    {
+        // Drop an unread messages from the previous call to update
+        m_message_queue.clear();
+
+        // Drop all of the message parameters
+        // NOTE: std::vector::clear() calls the destructor on each element in the vector
+        // This will decrement the last ref count to the parameter data, causing them to get cleaned up.
+        m_request_manager.flush_response_cache();
+        m_event_reference_cache.clear();
+
+        // Publish modified device state back to the service
+        publish();
+
+        bool bProcessedNetworkEvent;
+        if (m_embedded_service != nullptr)
+        {
+            // There is no network reactor to sleep in - run a service tick
+            // and treat it as having produced data
+            m_embedded_service->update();
+            bProcessedNetworkEvent= true;
+        }
+        else
+        {
+            // Sleep in the network reactor until a message arrives or the deadline hits
+            bProcessedNetworkEvent= m_network_manager.update_blocking(timeout_ms);
+        }
+
+        // In bounded latency mode, deliver the surviving staged data frames
+        // now that the whole backlog has been trimmed
+        flush_staged_data_frames();
+
+        // Poll the shared memory rings for any same-host streams
+        poll_shared_memory_streams();
+
+        return bProcessedNetworkEvent;
+    }
+
+    void register_controller_data_callback(
+        ClientPSMoveAPI::t_controller_data_callback callback,
+        void *callback_userdata)
+    {
+        m_controller_data_callback= callback;
+        m_controller_data_callback_userdata= callback_userdata;
+    }
+
+    void register_controller_button_callback(
+        ClientPSMoveAPI::t_controller_button_callback callback,
+        void *callback_userdata)
+    {
+        m_controller_button_callback= callback;
+        m_controller_button_callback_userdata= callback_userdata;
+    }
+
+    void poll_shared_memory_streams()
+    {
+        for (std::set<int>::const_iterator iter= m_shared_memory_controller_ids.begin();
+            iter != m_shared_memory_controller_ids.end();
+            ++iter)
+        {
+            t_controller_view_map_iterator view_entry= m_controller_view_map.find(*iter);
+
+            if (view_entry != m_controller_view_map.end())
+            {
+                ClientControllerView *controllerView= view_entry->second;
+
+                // The ring doesn't exist until the service handles the start
+                // stream request, so keep retrying the open until it succeeds
+                if (controllerView->GetIsSharedMemoryStreamOpen() ||
+                    controllerView->OpenSharedMemoryStream())
+                {
+                    if (controllerView->PollSharedMemoryStream())
+                    {
+                        record_coherent_controller_sample(controllerView);
+
+                        if (m_controller_data_callback != nullptr)
+                        {
+                            m_controller_data_callback(controllerView->GetControllerID(), m_controller_data_callback_userdata);
+                        }
+                    }
+                }
+            }
+        }
     }
 
     void publish()
@@ -115,16 +337,11 @@ public:
     {
         bool bHasMessage = false;
 
-        if (m_message_queue.size() > 0)
-        {
-            const ClientPSMoveAPI::Message &first = m_message_queue.front();
-
-            assert(sizeof(ClientPSMoveAPI::Message) == message_size);
-            assert(message != nullptr);
-            memcpy(message, &first, sizeof(ClientPSMoveAPI::Message));
-
-            m_message_queue.pop_front();
+        assert(sizeof(ClientPSMoveAPI::Message) == message_size);
+        assert(message != nullptr);
 
+        if (m_message_queue.pop(*message))
+        {
             // NOTE: We intentionally keep the message parameters around in the 
             // m_response_reference_cache and m_event_reference_cache since the
             // messages contain raw void pointers to the parameters, which
@@ -138,8 +355,19 @@ public:
 
     void shutdown()
     {
-        // Close all active network connections
-        m_network_manager.shutdown();
+        if (m_embedded_service != nullptr)
+        {
+            // Unbind from the in-process service host (the hosting tool
+            // owns the host's shutdown)
+            m_embedded_service->set_response_callback(nullptr, nullptr);
+            m_request_manager.set_embedded_service(nullptr);
+            m_embedded_service= nullptr;
+        }
+        else
+        {
+            // Close all active network connections
+            m_network_manager.shutdown();
+        }
 
         // Drop an unread messages from the previous call to update
         m_message_queue.clear();
@@ -191,6 +419,9 @@ public:
         // If no one is listening to this controller anymore, free it from the map
         if (view->GetListenerCount() <= 0)
         {
+            // Drop any coherent snapshot history recorded for this controller
+            m_coherent_sample_history.erase(view->GetControllerID());
+
             // Free the controller view allocated in allocate_controller_view
             delete view_entry->second;
             view_entry->second= nullptr;
@@ -218,12 +449,17 @@ public:
         // Don't include controllers connected via USB for normal controller list requests
         request->mutable_request_get_controller_list()->set_include_usb_controllers(false);
 
+        // Attach the generation cookie of any cached list so the service can
+        // answer with a cheap revalidation instead of the full list
+        request->mutable_request_get_controller_list()->set_cached_list_generation(
+            m_request_manager.get_cached_controller_list_generation());
+
         m_request_manager.send_request(request);
 
         return request->request_id();
     }
 
-    ClientPSMoveAPI::t_request_id start_controller_data_stream(ClientControllerView * view, unsigned int flags)
+    ClientPSMoveAPI::t_request_id start_controller_data_stream(ClientControllerView * view, unsigned int flags, float max_update_rate)
     {
         CLIENT_LOG_INFO("start_controller_data_stream") << "requesting controller stream start for ControllerID: " << view->GetControllerID() << std::endl;
 
@@ -262,6 +498,21 @@ public:
 			request->mutable_request_start_psmove_data_stream()->set_disable_roi(true);
 		}
 
+        // Ask the service to throttle the stream if we don't need every update
+        if (max_update_rate > 0.f)
+        {
+            request->mutable_request_start_psmove_data_stream()->set_max_update_rate(max_update_rate);
+        }
+
+        // Same-host clients can poll the shared memory ring instead of UDP.
+        // An embedded client has no UDP socket at all, so the ring is the
+        // only way controller data can reach it.
+        if ((flags & ClientPSMoveAPI::useSharedMemory) > 0 || m_embedded_service != nullptr)
+        {
+            request->mutable_request_start_psmove_data_stream()->set_use_shared_memory(true);
+            m_shared_memory_controller_ids.insert(view->GetControllerID());
+        }
+
         m_request_manager.send_request(request);
 
         return request->request_id();
@@ -271,6 +522,12 @@ public:
     {
         CLIENT_LOG_INFO("stop_controller_data_stream") << "requesting controller stream stop for ControllerID: " << view->GetControllerID() << std::endl;
 
+        // Unmap the shared memory ring if this stream was using one
+        if (m_shared_memory_controller_ids.erase(view->GetControllerID()) > 0)
+        {
+            view->CloseSharedMemoryStream();
+        }
+
         // Tell the psmove service that we are releasing this controller
         RequestPtr request(new PSMoveProtocol::Request());
         request->set_type(PSMoveProtocol::Request_RequestType_STOP_CONTROLLER_DATA_STREAM);
@@ -385,12 +642,18 @@ public:
         RequestPtr request(new PSMoveProtocol::Request());
         request->set_type(PSMoveProtocol::Request_RequestType_GET_TRACKER_LIST);
 
+        // Attach the generation cookie of any cached list so the service can
+        // answer with a cheap revalidation instead of the full list
+        request->mutable_request_get_tracker_list()->set_cached_list_generation(
+            m_request_manager.get_cached_tracker_list_generation());
+
         m_request_manager.send_request(request);
 
         return request->request_id();
     }
 
-    ClientPSMoveAPI::t_request_id start_tracker_data_stream(ClientTrackerView *view)
+    ClientPSMoveAPI::t_request_id start_tracker_data_stream(
+        ClientTrackerView *view, ClientPSMoveAPI::eTrackerStreamQuality stream_quality)
     {
         CLIENT_LOG_INFO("start_tracker_data_stream") << "requesting tracker stream start for TrackerID: " << view->getTrackerId() << std::endl;
 
@@ -398,6 +661,7 @@ public:
         RequestPtr request(new PSMoveProtocol::Request());
         request->set_type(PSMoveProtocol::Request_RequestType_START_TRACKER_DATA_STREAM);
         request->mutable_request_start_tracker_data_stream()->set_tracker_id(view->getTrackerId());
+        request->mutable_request_start_tracker_data_stream()->set_stream_quality(static_cast<int>(stream_quality));
 
         m_request_manager.send_request(request);
 
@@ -549,6 +813,30 @@ public:
     
     // IDataFrameListener
     virtual void handle_data_frame(const PSMoveProtocol::DeviceOutputDataFrame *data_frame) override
+    {
+        if (m_bounded_latency_frame_limit > 0)
+        {
+            stage_data_frame(data_frame);
+        }
+        else
+        {
+            dispatch_data_frame(data_frame);
+        }
+    }
+
+    virtual void handle_controller_stream_packet(const ControllerStreamPacket *packet) override
+    {
+        if (m_bounded_latency_frame_limit > 0)
+        {
+            stage_controller_stream_packet(packet);
+        }
+        else
+        {
+            dispatch_controller_stream_packet(packet);
+        }
+    }
+
+    void dispatch_data_frame(const PSMoveProtocol::DeviceOutputDataFrame *data_frame)
     {
         switch (data_frame->device_category())
         {
@@ -566,7 +854,13 @@ public:
                 {
                     ClientControllerView * view = view_entry->second;
 
-                    view->ApplyControllerDataFrame(&controller_packet);
+                    view->ApplyControllerDataFrame(&controller_packet, data_frame->publish_tick_id());
+                    record_coherent_controller_sample(view);
+
+                    if (m_controller_data_callback != nullptr)
+                    {
+                        m_controller_data_callback(controller_packet.controller_id(), m_controller_data_callback_userdata);
+                    }
                 }
             } break;
         case PSMoveProtocol::DeviceOutputDataFrame::TRACKER:
@@ -607,11 +901,278 @@ public:
         }
     }
 
+    void dispatch_controller_stream_packet(const ControllerStreamPacket *packet)
+    {
+        CLIENT_LOG_TRACE("handle_controller_stream_packet")
+            << "received stream packet for ControllerID: "
+            << packet->controller_id << std::endl;
+
+        t_controller_view_map_iterator view_entry = m_controller_view_map.find(packet->controller_id);
+
+        if (view_entry != m_controller_view_map.end())
+        {
+            ClientControllerView * view = view_entry->second;
+
+            view->ApplyControllerStreamPacket(packet);
+            record_coherent_controller_sample(view);
+
+            if (m_controller_data_callback != nullptr)
+            {
+                m_controller_data_callback(packet->controller_id, m_controller_data_callback_userdata);
+            }
+        }
+    }
+
+    // -- Bounded latency mode -----
+    // In bounded latency mode incoming data frames accumulate in per-device
+    // staging queues during the network pump instead of dispatching
+    // immediately; only the newest m_bounded_latency_frame_limit per device
+    // survive to the flush at the end of update(). A momentarily stalled app
+    // resumes with fresh poses instead of replaying the backlog one frame at
+    // a time. Control messages (responses, events) never pass through here.
+
+    static int get_data_frame_device_id(const PSMoveProtocol::DeviceOutputDataFrame *data_frame)
+    {
+        switch (data_frame->device_category())
+        {
+        case PSMoveProtocol::DeviceOutputDataFrame::CONTROLLER:
+            return data_frame->controller_data_packet().controller_id();
+        case PSMoveProtocol::DeviceOutputDataFrame::TRACKER:
+            return data_frame->tracker_data_packet().tracker_id();
+        case PSMoveProtocol::DeviceOutputDataFrame::HMD:
+            return data_frame->hmd_data_packet().hmd_id();
+        default:
+            return 0;
+        }
+    }
+
+    void stage_data_frame(const PSMoveProtocol::DeviceOutputDataFrame *data_frame)
+    {
+        // Key on category and id so e.g. controller 0 and tracker 0
+        // don't share a staging queue
+        const int staging_key=
+            (static_cast<int>(data_frame->device_category()) << 8) | get_data_frame_device_id(data_frame);
+        std::deque<PSMoveProtocol::DeviceOutputDataFrame> &staged_frames= m_staged_data_frames[staging_key];
+
+        staged_frames.push_back(*data_frame);
+
+        while (staged_frames.size() > static_cast<size_t>(m_bounded_latency_frame_limit))
+        {
+            staged_frames.pop_front();
+            ++m_stale_data_frame_drop_count;
+        }
+    }
+
+    void stage_controller_stream_packet(const ControllerStreamPacket *packet)
+    {
+        std::deque<ControllerStreamPacket> &staged_packets= m_staged_controller_stream_packets[packet->controller_id];
+
+        staged_packets.push_back(*packet);
+
+        while (staged_packets.size() > static_cast<size_t>(m_bounded_latency_frame_limit))
+        {
+            staged_packets.pop_front();
+            ++m_stale_data_frame_drop_count;
+        }
+    }
+
+    // Deliver everything still staged, oldest first so per-device ordering
+    // (and the views' sequence number checks) hold up
+    void flush_staged_data_frames()
+    {
+        if (m_bounded_latency_frame_limit <= 0)
+        {
+            return;
+        }
+
+        for (std::map<int, std::deque<PSMoveProtocol::DeviceOutputDataFrame> >::iterator iter= m_staged_data_frames.begin();
+            iter != m_staged_data_frames.end();
+            ++iter)
+        {
+            std::deque<PSMoveProtocol::DeviceOutputDataFrame> &staged_frames= iter->second;
+
+            while (!staged_frames.empty())
+            {
+                dispatch_data_frame(&staged_frames.front());
+                staged_frames.pop_front();
+            }
+        }
+
+        for (std::map<int, std::deque<ControllerStreamPacket> >::iterator iter= m_staged_controller_stream_packets.begin();
+            iter != m_staged_controller_stream_packets.end();
+            ++iter)
+        {
+            std::deque<ControllerStreamPacket> &staged_packets= iter->second;
+
+            while (!staged_packets.empty())
+            {
+                dispatch_controller_stream_packet(&staged_packets.front());
+                staged_packets.pop_front();
+            }
+        }
+    }
+
+    // -- Coherent snapshot mode -----
+    // Each controller's data frames are independent, so the "latest" states
+    // of several controllers can straddle service ticks. While snapshot mode
+    // is on, every applied controller packet appends a state sample keyed by
+    // the publish tick that produced it to a short per-controller history,
+    // and get_coherent_controller_snapshot intersects those histories for
+    // the newest tick every requested controller has a sample for.
+
+    void record_coherent_controller_sample(ClientControllerView *view)
+    {
+        if (!m_coherent_snapshot_enabled)
+        {
+            return;
+        }
+
+        const long long publish_tick_id= view->GetLastPublishTickId();
+
+        // Nothing to key on - the service predates the tick stamp
+        if (publish_tick_id <= 0)
+        {
+            return;
+        }
+
+        t_coherent_sample_history &history= m_coherent_sample_history[view->GetControllerID()];
+
+        // A packet rejected by the view's sequence check leaves the tick
+        // unchanged - don't duplicate the sample already recorded for it
+        if (!history.empty() && history.back().publish_tick_id == publish_tick_id)
+        {
+            return;
+        }
+
+        ClientPSMoveAPI::CoherentControllerSample sample;
+        sample.controller_id= view->GetControllerID();
+        sample.publish_tick_id= publish_tick_id;
+        sample.bIsConnected= view->GetIsConnected();
+        sample.bIsCurrentlyTracking= view->GetIsCurrentlyTracking();
+        sample.bIsPoseValid= view->GetIsPoseValid();
+        sample.pose= view->GetPose();
+        sample.physics_data= view->GetPhysicsData();
+
+        history.push_back(sample);
+
+        while (history.size() > static_cast<size_t>(k_coherent_snapshot_history_length))
+        {
+            history.pop_front();
+        }
+    }
+
+    void set_coherent_snapshot_mode(bool bEnabled)
+    {
+        m_coherent_snapshot_enabled= bEnabled;
+
+        if (!bEnabled)
+        {
+            m_coherent_sample_history.clear();
+        }
+    }
+
+    long long get_coherent_controller_snapshot(
+        const int *controller_ids, int controller_count,
+        ClientPSMoveAPI::CoherentControllerSample *out_samples)
+    {
+        if (!m_coherent_snapshot_enabled || controller_count <= 0)
+        {
+            return -1;
+        }
+
+        t_coherent_sample_history_map::const_iterator first_history_iter=
+            m_coherent_sample_history.find(controller_ids[0]);
+
+        if (first_history_iter == m_coherent_sample_history.end())
+        {
+            return -1;
+        }
+
+        // The newest complete tick can't be newer than the first
+        // controller's newest sample, so walk its history newest first and
+        // take the first tick every other controller also has a sample for
+        const t_coherent_sample_history &first_history= first_history_iter->second;
+
+        for (t_coherent_sample_history::const_reverse_iterator candidate_iter= first_history.rbegin();
+            candidate_iter != first_history.rend();
+            ++candidate_iter)
+        {
+            const long long candidate_tick_id= candidate_iter->publish_tick_id;
+            bool bCompleteSet= true;
+
+            out_samples[0]= *candidate_iter;
+
+            for (int list_index= 1; bCompleteSet && list_index < controller_count; ++list_index)
+            {
+                t_coherent_sample_history_map::const_iterator history_iter=
+                    m_coherent_sample_history.find(controller_ids[list_index]);
+
+                bCompleteSet= false;
+
+                if (history_iter != m_coherent_sample_history.end())
+                {
+                    const t_coherent_sample_history &history= history_iter->second;
+
+                    for (t_coherent_sample_history::const_reverse_iterator sample_iter= history.rbegin();
+                        sample_iter != history.rend();
+                        ++sample_iter)
+                    {
+                        if (sample_iter->publish_tick_id == candidate_tick_id)
+                        {
+                            out_samples[list_index]= *sample_iter;
+                            bCompleteSet= true;
+                            break;
+                        }
+                    }
+                }
+            }
+
+            if (bCompleteSet)
+            {
+                return candidate_tick_id;
+            }
+        }
+
+        return -1;
+    }
+
+    void set_bounded_latency_mode(int max_frames_per_device)
+    {
+        // Deliver anything already staged under the old limit first
+        flush_staged_data_frames();
+
+        m_bounded_latency_frame_limit= max_frames_per_device;
+    }
+
+    unsigned long long get_stale_data_frame_drop_count() const
+    {
+        return m_stale_data_frame_drop_count;
+    }
+
     // INotificationListener
     virtual void handle_notification(ResponsePtr notification) override
     {
         assert(notification->request_id() == -1);
 
+        // Compressed video frames arrive at video rates - route them straight
+        // to the tracker view rather than flooding the client event queue
+        if (notification->type() == PSMoveProtocol::Response_ResponseType_TRACKER_VIDEO_FRAME)
+        {
+            const PSMoveProtocol::Response_ResultTrackerVideoFrame &video_frame =
+                notification->result_tracker_video_frame();
+
+            t_tracker_view_map_iterator view_entry = m_tracker_view_map.find(video_frame.tracker_id());
+
+            if (view_entry != m_tracker_view_map.end())
+            {
+                ClientTrackerView * view = view_entry->second;
+
+                view->applyCompressedVideoFrame(&video_frame);
+            }
+
+            return;
+        }
+
         ClientPSMoveAPI::eEventType specificEventType= ClientPSMoveAPI::opaqueServiceEvent;
 
         // See if we can translate this to an event type a client without protocol access can see
@@ -620,6 +1181,26 @@ public:
         case PSMoveProtocol::Response_ResponseType_CONTROLLER_LIST_UPDATED:
             specificEventType= ClientPSMoveAPI::controllerListUpdated;
             break;
+        case PSMoveProtocol::Response_ResponseType_CONTROLLER_BUTTON_EVENT:
+            {
+                specificEventType= ClientPSMoveAPI::controllerButtonEvent;
+
+                // Fire the registered button callback right away rather than
+                // making the app diff bitmasks out of the event queue
+                if (m_controller_button_callback != nullptr)
+                {
+                    const PSMoveProtocol::Response_ResultControllerButtonEvent &button_event =
+                        notification->result_controller_button_event();
+
+                    m_controller_button_callback(
+                        button_event.controller_id(),
+                        static_cast<unsigned int>(button_event.pressed_buttons()),
+                        static_cast<unsigned int>(button_event.released_buttons()),
+                        static_cast<unsigned int>(button_event.all_buttons()),
+                        m_controller_button_callback_userdata);
+                }
+            }
+            break;
         case PSMoveProtocol::Response_ResponseType_TRACKER_LIST_UPDATED:
             specificEventType = ClientPSMoveAPI::trackerListUpdated;
             break;
@@ -636,6 +1217,21 @@ public:
     {
         CLIENT_LOG_INFO("handle_server_connection_opened") << "Connected to service" << std::endl;
 
+        // Advertise the streaming wire formats this client build can consume
+        // before any streams start, so the server can pick the cheapest one
+        // it shares with us instead of assuming the lowest common denominator
+        {
+            RequestPtr request(new PSMoveProtocol::Request());
+            request->set_type(PSMoveProtocol::Request_RequestType_REGISTER_STREAM_CAPABILITIES);
+            request->mutable_request_register_stream_capabilities()->set_supported_stream_formats(
+                PSM_SUPPORTED_STREAM_FORMATS_MASK);
+
+            m_request_manager.send_request(request);
+
+            // The registration is fire-and-forget - swallow the response
+            register_callback(request->request_id(), ClientPSMoveAPI::null_response_callback, nullptr);
+        }
+
         enqueue_event_message(ClientPSMoveAPI::connectedToService, ResponsePtr());
     }
 
@@ -683,6 +1279,25 @@ public:
         }
     }
 
+    // Embedded Service Callback
+    static void handle_embedded_response(
+        ResponsePtr response,
+        void *userdata)
+    {
+        ClientPSMoveAPIImpl *this_ptr = reinterpret_cast<ClientPSMoveAPIImpl *>(userdata);
+
+        if (response->request_id() != -1)
+        {
+            // A request that completed asynchronously on the service
+            this_ptr->m_request_manager.handle_response(response);
+        }
+        else
+        {
+            // An unsolicited notification
+            this_ptr->handle_notification(response);
+        }
+    }
+
     // Message Helpers
     //-----------------
     void enqueue_event_message(
@@ -715,7 +1330,11 @@ public:
         }
 
         // Add the message to the message queue
-        m_message_queue.push_back(message);
+        if (!m_message_queue.push(message))
+        {
+            CLIENT_LOG_ERROR("ClientPSMoveAPI") << "Event message queue overflow! "
+                << m_message_queue.getDroppedMessageCount() << " message(s) dropped so far" << std::endl;
+        }
     }
 
     bool register_callback(
@@ -782,7 +1401,26 @@ public:
         message.response_data= *response_message;
 
         // Add the message to the message queue
-        m_message_queue.push_back(message);
+        if (!m_message_queue.push(message))
+        {
+            CLIENT_LOG_ERROR("ClientPSMoveAPI") << "Response message queue overflow! "
+                << m_message_queue.getDroppedMessageCount() << " message(s) dropped so far" << std::endl;
+        }
+    }
+
+    bool is_request_pending(ClientPSMoveAPI::t_request_id request_id)
+    {
+        if (request_id == ClientPSMoveAPI::INVALID_REQUEST_ID)
+        {
+            return false;
+        }
+
+        // A request is outstanding while its response hasn't come back from
+        // the service, or while the registered response callback hasn't
+        // fired yet
+        return
+            m_request_manager.is_request_pending(request_id) ||
+            m_pending_request_map.find(request_id) != m_pending_request_map.end();
     }
 
     bool cancel_callback(ClientPSMoveAPI::t_request_id request_id)
@@ -821,10 +1459,17 @@ private:
     
     //-- Session Management -----
     ClientNetworkManager m_network_manager;
-    
+
+    // Non-null when bound to an in-process service host instead of a
+    // network connection - see startup_embedded()
+    IEmbeddedServiceInterface *m_embedded_service;
+
     //-- Controller Views -----
     t_controller_view_map m_controller_view_map;
 
+    // Controller IDs streaming through shared memory instead of UDP
+    std::set<int> m_shared_memory_controller_ids;
+
     //-- Tracker Views -----
     t_tracker_view_map m_tracker_view_map;
     
@@ -842,10 +1487,40 @@ private:
 
     t_pending_request_map m_pending_request_map;
 
+    //-- Data Callbacks -----
+    // Optional callback fired the moment new controller data gets applied
+    ClientPSMoveAPI::t_controller_data_callback m_controller_data_callback;
+    void *m_controller_data_callback_userdata;
+
+    // Optional callback fired the moment a button event notification arrives
+    ClientPSMoveAPI::t_controller_button_callback m_controller_button_callback;
+    void *m_controller_button_callback_userdata;
+
+    //-- Bounded latency mode -----
+    // Maximum staged data frames per device (0 = deliver every frame the
+    // moment it arrives, the default)
+    int m_bounded_latency_frame_limit;
+
+    // Total data frames trimmed by bounded latency mode
+    unsigned long long m_stale_data_frame_drop_count;
+
+    // Staging queues, keyed on (device_category << 8) | device_id for the
+    // protobuf frames and on controller_id for the packed stream packets
+    std::map<int, std::deque<PSMoveProtocol::DeviceOutputDataFrame> > m_staged_data_frames;
+    std::map<int, std::deque<ControllerStreamPacket> > m_staged_controller_stream_packets;
+
+    //-- Coherent snapshot mode -----
+    // Whether controller samples are being recorded for coherent snapshots
+    bool m_coherent_snapshot_enabled;
+
+    // Recent controller state samples keyed by controller id, each entry
+    // stamped with the service publish tick that produced it
+    t_coherent_sample_history_map m_coherent_sample_history;
+
     //-- Messages -----
     // Queue of message received from the most recent call to update()
     // This queue will be emptied automatically at the next call to update().
-    t_message_queue m_message_queue;
+    ClientMessageQueue m_message_queue;
 
     // These vectors are used solely to keep the ref counted pointers to the 
     // response and event parameter data valid until the next update call.
@@ -872,6 +1547,32 @@ bool ClientPSMoveAPI::startup(
     return success;
 }
 
+bool ClientPSMoveAPI::startup_embedded(
+    IEmbeddedServiceInterface *embedded_service,
+    e_log_severity_level log_level)
+{
+    bool success= true;
+
+    if (ClientPSMoveAPI::m_implementation_ptr == nullptr)
+    {
+        // The network manager gets constructed (it's a by-value member) but
+        // its connection never gets started
+        ClientPSMoveAPI::m_implementation_ptr =
+            new ClientPSMoveAPIImpl(PSMOVESERVICE_DEFAULT_ADDRESS, PSMOVESERVICE_DEFAULT_PORT);
+        success= ClientPSMoveAPI::m_implementation_ptr->startup_embedded(embedded_service, log_level);
+    }
+
+    return success;
+}
+
+IEmbeddedServiceInterface *ClientPSMoveAPI::get_embedded_service()
+{
+    return
+        (ClientPSMoveAPI::m_implementation_ptr != nullptr)
+        ? ClientPSMoveAPI::m_implementation_ptr->get_embedded_service()
+        : nullptr;
+}
+
 bool ClientPSMoveAPI::has_started()
 {
     return ClientPSMoveAPI::m_implementation_ptr != nullptr;
@@ -885,6 +1586,62 @@ void ClientPSMoveAPI::update()
     }
 }
 
+bool ClientPSMoveAPI::update_blocking(int timeout_ms)
+{
+    bool bResult = false;
+
+    if (ClientPSMoveAPI::m_implementation_ptr != nullptr)
+    {
+        bResult= ClientPSMoveAPI::m_implementation_ptr->update_blocking(timeout_ms);
+    }
+
+    return bResult;
+}
+
+void ClientPSMoveAPI::set_bounded_latency_mode(int max_frames_per_device)
+{
+    if (ClientPSMoveAPI::m_implementation_ptr != nullptr)
+    {
+        ClientPSMoveAPI::m_implementation_ptr->set_bounded_latency_mode(max_frames_per_device);
+    }
+}
+
+unsigned long long ClientPSMoveAPI::get_stale_data_frame_drop_count()
+{
+    unsigned long long count = 0;
+
+    if (ClientPSMoveAPI::m_implementation_ptr != nullptr)
+    {
+        count= ClientPSMoveAPI::m_implementation_ptr->get_stale_data_frame_drop_count();
+    }
+
+    return count;
+}
+
+void ClientPSMoveAPI::set_coherent_snapshot_mode(bool bEnabled)
+{
+    if (ClientPSMoveAPI::m_implementation_ptr != nullptr)
+    {
+        ClientPSMoveAPI::m_implementation_ptr->set_coherent_snapshot_mode(bEnabled);
+    }
+}
+
+long long ClientPSMoveAPI::get_coherent_controller_snapshot(
+    const int *controller_ids, int controller_count,
+    ClientPSMoveAPI::CoherentControllerSample *out_samples)
+{
+    long long publish_tick_id= -1;
+
+    if (ClientPSMoveAPI::m_implementation_ptr != nullptr)
+    {
+        publish_tick_id=
+            ClientPSMoveAPI::m_implementation_ptr->get_coherent_controller_snapshot(
+                controller_ids, controller_count, out_samples);
+    }
+
+    return publish_tick_id;
+}
+
 bool ClientPSMoveAPI::poll_next_message(ClientPSMoveAPI::Message *message, size_t message_size)
 {
     bool bResult = false;
@@ -955,13 +1712,14 @@ ClientPSMoveAPI::get_controller_list()
 ClientPSMoveAPI::t_request_id 
 ClientPSMoveAPI::start_controller_data_stream(
     ClientControllerView * view, 
-    unsigned int flags)
+    unsigned int flags,
+    float max_update_rate)
 {
     ClientPSMoveAPI::t_request_id request_id= ClientPSMoveAPI::INVALID_REQUEST_ID;
 
     if (ClientPSMoveAPI::m_implementation_ptr != nullptr)
     {
-        request_id= ClientPSMoveAPI::m_implementation_ptr->start_controller_data_stream(view, flags);
+        request_id= ClientPSMoveAPI::m_implementation_ptr->start_controller_data_stream(view, flags, max_update_rate);
     }
 
     return request_id;
@@ -1059,14 +1817,15 @@ ClientPSMoveAPI::get_tracker_list()
     return request_id;
 }
 
-ClientPSMoveAPI::t_request_id 
-ClientPSMoveAPI::start_tracker_data_stream(ClientTrackerView *view)
+ClientPSMoveAPI::t_request_id
+ClientPSMoveAPI::start_tracker_data_stream(
+    ClientTrackerView *view, ClientPSMoveAPI::eTrackerStreamQuality stream_quality)
 {
     ClientPSMoveAPI::t_request_id request_id = ClientPSMoveAPI::INVALID_REQUEST_ID;
 
     if (ClientPSMoveAPI::m_implementation_ptr != nullptr)
     {
-        request_id = ClientPSMoveAPI::m_implementation_ptr->start_tracker_data_stream(view);
+        request_id = ClientPSMoveAPI::m_implementation_ptr->start_tracker_data_stream(view, stream_quality);
     }
 
     return request_id;
@@ -1176,6 +1935,19 @@ bool ClientPSMoveAPI::register_callback(
     return bSuccess;
 }
 
+bool ClientPSMoveAPI::is_request_pending(
+    ClientPSMoveAPI::t_request_id request_id)
+{
+    bool bPending = false;
+
+    if (ClientPSMoveAPI::m_implementation_ptr != nullptr)
+    {
+        bPending= ClientPSMoveAPI::m_implementation_ptr->is_request_pending(request_id);
+    }
+
+    return bPending;
+}
+
 bool ClientPSMoveAPI::cancel_callback(
     ClientPSMoveAPI::t_request_id request_id)
 {
@@ -1193,3 +1965,23 @@ bool ClientPSMoveAPI::eat_response(ClientPSMoveAPI::t_request_id request_id)
 {
     return ClientPSMoveAPI::register_callback(request_id, ClientPSMoveAPI::null_response_callback, nullptr);
 }
+
+void ClientPSMoveAPI::register_controller_data_callback(
+    ClientPSMoveAPI::t_controller_data_callback callback,
+    void *callback_userdata)
+{
+    if (ClientPSMoveAPI::m_implementation_ptr != nullptr)
+    {
+        ClientPSMoveAPI::m_implementation_ptr->register_controller_data_callback(callback, callback_userdata);
+    }
+}
+
+void ClientPSMoveAPI::register_controller_button_callback(
+    ClientPSMoveAPI::t_controller_button_callback callback,
+    void *callback_userdata)
+{
+    if (ClientPSMoveAPI::m_implementation_ptr != nullptr)
+    {
+        ClientPSMoveAPI::m_implementation_ptr->register_controller_button_callback(callback, callback_userdata);
+    }
+}
@@ -45,6 +45,7 @@ public:
         includeCalibratedSensorData = 0x08,
         includeRawTrackerData = 0x10,
 		disableROI = 0x20,
+        useSharedMemory = 0x40,
     };    
 
     enum eControllerRumbleChannel
@@ -54,6 +55,20 @@ public:
         channelRight
     };
 
+    enum eTrackerStreamQuality
+    {
+        // Publish video frames at the camera's native resolution
+        fullResolutionVideo = 0,
+        // Publish 2x-downscaled frames - quarter the shared memory copy and
+        // texture upload cost when only a rough preview is needed
+        halfResolutionVideo = 1,
+        // Push MJPEG-compressed frames over the TCP connection instead of
+        // the shared memory block. The only video option when the client
+        // runs on a different host than the service; the application is
+        // responsible for decoding the JPEG frames.
+        compressedVideo = 2,
+    };
+
     // Service Events
     //--------------
     enum eEventType
@@ -67,7 +82,11 @@ public:
         opaqueServiceEvent, // Need to have protocol access to see what kind of event this is
         controllerListUpdated,
         trackerListUpdated,
-        hmdListUpdated
+        hmdListUpdated,
+        // A controller button transition arrived on the reliable channel.
+        // The pressed/released bitmasks are in the protocol payload; clients
+        // that just want a callback can use register_controller_button_callback
+        controllerButtonEvent
     };
 
     typedef const void *t_event_data_handle;
@@ -186,6 +205,25 @@ public:
         const std::string &host,
         const std::string &port,
         e_log_severity_level log_level = _log_severity_level_info);
+
+    /**<
+        Binds the client to an in-process service host instead of a network
+        connection. Requests go straight to the service's request handler on
+        the calling thread and controller/tracker data arrives over the
+        same-host shared memory streams, so no sockets or serialization are
+        involved. The host must already be started (EmbeddedServiceHost in
+        psmoveservice); each call to update() ticks it.
+    */
+    static bool startup_embedded(
+        class IEmbeddedServiceInterface *embedded_service,
+        e_log_severity_level log_level = _log_severity_level_info);
+
+    /**<
+        The in-process service host the API was started against, or nullptr
+        when talking to a networked service. Used internally by the views to
+        route device input publishes.
+    */
+    static class IEmbeddedServiceInterface *get_embedded_service();
     static bool has_started();
 
     /**< 
@@ -193,6 +231,58 @@ public:
         Fires off callbacks for any registered request_id that got responses.
     */
     static void update();  
+    /**< 
+        Same as update() but sleeps in the network reactor until a message
+        arrives or timeout_ms elapses, instead of returning immediately.
+        Returns true if a network event was processed before the deadline.
+    */
+    static bool update_blocking(int timeout_ms);
+    /**<
+        Bounded latency mode: when max_frames_per_device > 0, device data
+        frames that piled up while the app was stalled get trimmed to the
+        newest max_frames_per_device per device before delivery at the next
+        update(), so the app resumes with fresh poses instead of replaying
+        the backlog. Control messages (responses, events) are never dropped.
+        0 (the default) delivers every data frame.
+    */
+    static void set_bounded_latency_mode(int max_frames_per_device);
+    /**< Total data frames dropped by bounded latency mode since startup */
+    static unsigned long long get_stale_data_frame_drop_count();
+    /**<
+        One controller's state captured at a single service publish tick,
+        returned by get_coherent_controller_snapshot
+    */
+    struct CoherentControllerSample
+    {
+        int controller_id;
+        long long publish_tick_id;
+        bool bIsConnected;
+        bool bIsCurrentlyTracking;
+        bool bIsPoseValid;
+        PSMovePose pose;
+        PSMovePhysicsData physics_data;
+    };
+    /**<
+        Coherent snapshot mode: when enabled the API keeps a short history of
+        every streaming controller's state keyed by the service publish tick
+        that produced it. Each controller's data frame is independent, so the
+        "latest" states of N controllers can straddle server ticks - the
+        history lets get_coherent_controller_snapshot hand back a set that
+        all came from the same tick. Off by default; enabling it costs one
+        small state copy per received controller data frame.
+    */
+    static void set_coherent_snapshot_mode(bool bEnabled);
+    /**<
+        Fill out_samples (controller_count entries) with the newest complete
+        controller set for a single service tick: the most recent publish
+        tick for which a sample from every listed controller is buffered.
+        Returns that tick id, or -1 when no complete set exists yet (snapshot
+        mode off, streams still starting, or a controller stalled long enough
+        to age out of the history).
+    */
+    static long long get_coherent_controller_snapshot(
+        const int *controller_ids, int controller_count,
+        CoherentControllerSample *out_samples);
     /**< Poll the next message from the service in the queue */
     static bool poll_next_message(Message *message, size_t message_size);
 
@@ -203,7 +293,7 @@ public:
     static void free_controller_view(ClientControllerView *view);
 
     static t_request_id get_controller_list();
-    static t_request_id start_controller_data_stream(ClientControllerView *view, unsigned int data_stream_flags);
+    static t_request_id start_controller_data_stream(ClientControllerView *view, unsigned int data_stream_flags, float max_update_rate= 0.f);
     static t_request_id stop_controller_data_stream(ClientControllerView *view);
     static t_request_id set_led_tracking_color(ClientControllerView *view, PSMoveTrackingColorType tracking_color);
     static t_request_id reset_orientation(ClientControllerView *view, const PSMoveQuaternion& q_pose);
@@ -215,7 +305,8 @@ public:
 
 	static t_request_id get_tracking_space_settings();
 	static t_request_id get_tracker_list();
-    static t_request_id start_tracker_data_stream(ClientTrackerView *view);
+    static t_request_id start_tracker_data_stream(
+        ClientTrackerView *view, eTrackerStreamQuality stream_quality = fullResolutionVideo);
     static t_request_id stop_tracker_data_stream(ClientTrackerView *view);
     
     /// HMD Methods
@@ -232,6 +323,37 @@ public:
     /// Used to send register a callback to get called when an async request is completed
     typedef void(*t_response_callback)(const ClientPSMoveAPI::ResponseMessage *response, void *userdata);
     static bool register_callback(ClientPSMoveAPI::t_request_id request_id, t_response_callback callback, void *callback_userdata);
+
+    /**<
+        True while the given request is in flight or its registered callback
+        hasn't fired yet. Requests pipeline over the TCP connection, so any
+        number can be outstanding at once; issue a batch and poll this (or
+        wait via PSM_WaitForCallbacks) to collect them all in one round trip.
+    */
+    static bool is_request_pending(ClientPSMoveAPI::t_request_id request_id);
+
+    /**<
+        Optional callback fired from inside update()/update_blocking() the
+        moment new controller data gets applied to a view, before the app
+        gets around to polling the view state. Pass nullptr to unregister.
+    */
+    typedef void(*t_controller_data_callback)(int controller_id, void *userdata);
+    static void register_controller_data_callback(t_controller_data_callback callback, void *callback_userdata);
+
+    /**<
+        Optional callback fired from inside update()/update_blocking() the
+        moment a controller button event notification arrives, without the
+        app having to diff the data frame button bitmasks every frame.
+        The bitmasks use the same button bit layout as the data frame.
+        Pass nullptr to unregister.
+    */
+    typedef void(*t_controller_button_callback)(
+        int controller_id,
+        unsigned int pressed_buttons,
+        unsigned int released_buttons,
+        unsigned int all_buttons,
+        void *userdata);
+    static void register_controller_button_callback(t_controller_button_callback callback, void *callback_userdata);
     static bool cancel_callback(ClientPSMoveAPI::t_request_id request_id);
     static bool eat_response(ClientPSMoveAPI::t_request_id request_id);
 
@@ -30,9 +30,17 @@ public:
         , m_callback_userdata(userdata)
         , m_pending_requests()
         , m_next_request_id(0)
+        , m_cached_controller_list_generation(0)
+        , m_cached_tracker_list_generation(0)
+        , m_embedded_service(nullptr)
     {
     }
 
+    void set_embedded_service(IEmbeddedServiceInterface *embedded_service)
+    {
+        m_embedded_service= embedded_service;
+    }
+
     void flush_response_cache()
     {
         // Drop all of the request/response references,
@@ -56,8 +64,39 @@ public:
         assert(m_pending_requests.find(request->request_id()) == m_pending_requests.end());
         m_pending_requests.insert(t_id_request_context_pair(request->request_id(), context));
 
-        // Send the request off to the network manager to get sent to the server
-        ClientNetworkManager::get_instance()->send_request(request);
+        if (m_embedded_service != nullptr)
+        {
+            // The in-process request handler answers most requests on the
+            // spot; a null response means the request completes
+            // asynchronously and its response arrives through the embedded
+            // response callback
+            ResponsePtr response= m_embedded_service->handle_request(request);
+
+            if (response)
+            {
+                handle_response(response);
+            }
+        }
+        else
+        {
+            // Send the request off to the network manager to get sent to the server
+            ClientNetworkManager::get_instance()->send_request(request);
+        }
+    }
+
+    bool is_request_pending(int request_id) const
+    {
+        return m_pending_requests.find(request_id) != m_pending_requests.end();
+    }
+
+    int get_cached_controller_list_generation() const
+    {
+        return m_cached_controller_list_generation;
+    }
+
+    int get_cached_tracker_list_generation() const
+    {
+        return m_cached_tracker_list_generation;
     }
 
     void handle_request_canceled(RequestPtr request)
@@ -188,6 +227,15 @@ public:
         int src_controller_count = 0;
         int dest_controller_count= 0;
 
+        // The service said our cached copy of the list is still current -
+        // the response carries no controller entries, so serve the cache
+        if (response->result_controller_list().cached_list_valid())
+        {
+            assert(m_cached_controller_list_generation != 0);
+            *controller_list= m_cached_controller_list;
+            return;
+        }
+
         // Copy the controller entries into the response payload
         while (src_controller_count < response->result_controller_list().controllers_size()
                 && src_controller_count < PSMOVESERVICE_MAX_CONTROLLER_COUNT)
@@ -227,6 +275,11 @@ public:
 
         // Record how many controllers we copied into the payload
         controller_list->count = dest_controller_count;
+
+        // Remember this list so a later request can revalidate it
+        // with just the generation cookie
+        m_cached_controller_list= *controller_list;
+        m_cached_controller_list_generation= response->result_controller_list().list_generation();
     }
 
     inline PSMovePose protocol_pose_to_psmove_pose(const PSMoveProtocol::Pose &pose)
@@ -251,6 +304,15 @@ public:
     {
         int tracker_count = 0;
 
+        // The service said our cached copy of the list is still current -
+        // the response carries no tracker entries, so serve the cache
+        if (response->result_tracker_list().cached_list_valid())
+        {
+            assert(m_cached_tracker_list_generation != 0);
+            *tracker_list= m_cached_tracker_list;
+            return;
+        }
+
         // Copy the controller entries into the response payload
         while (tracker_count < response->result_tracker_list().trackers_size()
             && tracker_count < PSMOVESERVICE_MAX_TRACKER_COUNT)
@@ -265,6 +327,9 @@ public:
             case PSMoveProtocol::TrackerType::PS3EYE:
                 TrackerInfo.tracker_type = eTrackerType::PS3Eye;
                 break;
+            case PSMoveProtocol::TrackerType::VIRTUAL_TRACKER:
+                TrackerInfo.tracker_type = eTrackerType::VirtualTracker;
+                break;
             default:
                 assert(0 && "unreachable");
             }
@@ -325,6 +390,11 @@ public:
 
 		// Copy over the tracking space properties
 		tracker_list->global_forward_degrees= response->result_tracker_list().global_forward_degrees();
+
+        // Remember this list so a later request can revalidate it
+        // with just the generation cookie
+        m_cached_tracker_list= *tracker_list;
+        m_cached_tracker_list_generation= response->result_tracker_list().list_generation();
     }
 
 	void build_hmd_list_response_message(
@@ -377,6 +447,18 @@ private:
     t_request_context_map m_pending_requests;
     int m_next_request_id;
 
+    // When non-null, requests get handled by this in-process service host
+    // instead of being serialized to the network manager
+    IEmbeddedServiceInterface *m_embedded_service;
+
+    // Cached copies of the last full controller/tracker list payloads and
+    // the service generation cookies they were built from. Served back to
+    // the API when the service revalidates a list instead of resending it.
+    ClientPSMoveAPI::ResponsePayload_ControllerList m_cached_controller_list;
+    int m_cached_controller_list_generation;
+    ClientPSMoveAPI::ResponsePayload_TrackerList m_cached_tracker_list;
+    int m_cached_tracker_list_generation;
+
     // These vectors is used solely to keep the ref counted pointers to the 
     // request/response parameter data valid until the next update call.
     // The ClientAPI message queue contains raw void pointers to the request/response and event data.
@@ -409,6 +491,26 @@ void ClientRequestManager::send_request(
     m_implementation_ptr->send_request(request);
 }
 
+void ClientRequestManager::set_embedded_service(IEmbeddedServiceInterface *embedded_service)
+{
+    m_implementation_ptr->set_embedded_service(embedded_service);
+}
+
+bool ClientRequestManager::is_request_pending(int request_id) const
+{
+    return m_implementation_ptr->is_request_pending(request_id);
+}
+
+int ClientRequestManager::get_cached_controller_list_generation() const
+{
+    return m_implementation_ptr->get_cached_controller_list_generation();
+}
+
+int ClientRequestManager::get_cached_tracker_list_generation() const
+{
+    return m_implementation_ptr->get_cached_tracker_list_generation();
+}
+
 void ClientRequestManager::handle_request_canceled(RequestPtr request)
 {
     m_implementation_ptr->handle_request_canceled(request);
@@ -17,6 +17,22 @@ public:
 
     void send_request(RequestPtr request);
 
+    // Routes subsequent requests to an in-process service host instead of
+    // the network manager (nullptr = back to the network manager).
+    // See ClientPSMoveAPI::startup_embedded().
+    void set_embedded_service(IEmbeddedServiceInterface *embedded_service);
+
+    // Returns true while the given request is awaiting its response from
+    // the service. Requests pipeline: any number can be in flight at once.
+    bool is_request_pending(int request_id) const;
+
+    // Generation cookies of the cached controller/tracker list payloads,
+    // attached to outgoing list requests so the service can answer with a
+    // cheap "cache still valid" response instead of the full list.
+    // 0 = nothing cached yet.
+    int get_cached_controller_list_generation() const;
+    int get_cached_tracker_list_generation() const;
+
     virtual void handle_request_canceled(RequestPtr request) override;
     virtual void handle_response(ResponsePtr response) override;
 
@@ -9,7 +9,6 @@
 #include <sstream>
 #include <boost/interprocess/shared_memory_object.hpp>
 #include <boost/interprocess/mapped_region.hpp>
-#include <boost/interprocess/sync/scoped_lock.hpp>
 #include <thread>
 #include <memory>
 
@@ -33,6 +32,12 @@ public:
         , m_frame_height(0)
         , m_frame_stride(0)
         , m_last_frame_index(0)
+        , m_frames_read_count(0)
+        , m_frames_dropped_count(0)
+        , m_torn_read_count(0)
+        , m_last_capture_timestamp_us(0)
+        , m_consumer_slot(-1)
+        , m_consumer_nonce(0)
     {}
 
     ~SharedVideoFrameReadOnlyAccessor()
@@ -62,6 +67,22 @@ public:
             // Map all of the shared memory for read/write access
             m_region = new boost::interprocess::mapped_region(*m_shared_memory_object, boost::interprocess::read_write);
 
+            // Register with the stream by claiming a consumer slot. The
+            // steady clock in microseconds makes a good-enough unique nonce;
+            // the |1 keeps it from ever being the "free slot" value.
+            const unsigned long long now_us=
+                static_cast<unsigned long long>(
+                    std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch()).count());
+            m_consumer_nonce = static_cast<unsigned int>(now_us) | 1;
+            m_consumer_slot = getFrameHeader()->claimConsumerSlot(m_consumer_nonce, now_us);
+
+            if (m_consumer_slot == -1)
+            {
+                CLIENT_LOG_WARNING("SharedMemory::initialize()") << "All consumer slots taken on shared memory: "
+                    << m_shared_memory_name << ", reading unregistered";
+            }
+
             bSuccess = true;
         }
         catch (boost::interprocess::interprocess_exception &ex)
@@ -84,6 +105,13 @@ public:
     {
         if (m_region != nullptr)
         {
+            // Hand our consumer slot back before unmapping
+            if (m_consumer_slot != -1)
+            {
+                getFrameHeader()->releaseConsumerSlot(m_consumer_slot, m_consumer_nonce);
+                m_consumer_slot = -1;
+            }
+
             delete m_region;
             m_region = nullptr;
         }
@@ -105,7 +133,18 @@ public:
     {
         bool bNewFrame = false;
         SharedVideoFrameHeader *sharedFrameState = getFrameHeader();
-        boost::interprocess::scoped_lock<boost::interprocess::interprocess_mutex> lock(sharedFrameState->mutex);
+
+        // Let the writer know this consumer is still alive so it doesn't
+        // reclaim our slot
+        if (m_consumer_slot != -1)
+        {
+            const unsigned long long now_us=
+                static_cast<unsigned long long>(
+                    std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch()).count());
+
+            sharedFrameState->publishConsumerHeartbeat(m_consumer_slot, m_consumer_nonce, now_us);
+        }
 
         // Make sure the target buffer is big enough to read the video frame into
         size_t buffer_size =
@@ -117,6 +156,7 @@ public:
         assert(m_region->get_size() >= total_shared_mem_size);
 
         // Re-allocate the buffer if any of the video properties changed
+        // (the geometry is written once when the stream starts)
         if (m_frame_width != sharedFrameState->width ||
             m_frame_height != sharedFrameState->height ||
             m_frame_stride != sharedFrameState->stride)
@@ -130,17 +170,55 @@ public:
             allocateVideoBuffer();
         }
 
-        // Copy over the video frame if the frame index changed
-        if (m_last_frame_index != sharedFrameState->frame_index)
+        // Copy out of the last published buffer if it holds a frame we haven't seen
+        const int buffer_index= sharedFrameState->last_written_buffer_index;
+
+        if (buffer_index >= 0)
         {
-            if (buffer_size > 0)
+            const int shared_frame_index= sharedFrameState->frame_index[buffer_index];
+
+            if (m_last_frame_index != shared_frame_index && buffer_size > 0)
             {
-                std::memcpy(m_bgr_frame_buffer, sharedFrameState->getBufferMutable(), buffer_size);
+                const unsigned int sequence_before= sharedFrameState->write_sequence[buffer_index];
+
+                if ((sequence_before & 1) == 0)
+                {
+                    std::memcpy(m_bgr_frame_buffer, sharedFrameState->getBuffer(buffer_index), buffer_size);
+
+                    // The copy is only good if the writer didn't lap us mid-read;
+                    // if it did we just try again on the next poll
+                    if (sharedFrameState->write_sequence[buffer_index] == sequence_before)
+                    {
+                        // Every frame index we skipped past was overwritten before we saw it.
+                        // The gap on the very first read is the stream's back history, not a drop.
+                        if (m_frames_read_count > 0 && shared_frame_index > m_last_frame_index + 1)
+                        {
+                            m_frames_dropped_count += shared_frame_index - m_last_frame_index - 1;
+                        }
+
+                        m_last_frame_index = shared_frame_index;
+                        m_last_capture_timestamp_us = sharedFrameState->capture_timestamp_us[buffer_index];
+                        ++m_frames_read_count;
+
+                        // Publish our read progress for the writer's diagnostics
+                        if (m_consumer_slot != -1)
+                        {
+                            sharedFrameState->publishConsumerReadCursor(
+                                m_consumer_slot, m_consumer_nonce, m_last_frame_index);
+                        }
+
+                        bNewFrame = true;
+                    }
+                    else
+                    {
+                        ++m_torn_read_count;
+                    }
+                }
+                else
+                {
+                    ++m_torn_read_count;
+                }
             }
-
-            m_last_frame_index = sharedFrameState->frame_index;
-
-            bNewFrame = true;
         }
 
         return bNewFrame;
@@ -172,6 +250,10 @@ public:
     inline int getVideoFrameHeight() const { return m_frame_height; }
     inline int getVideoFrameStride() const { return m_frame_stride; }
     inline int getLastVideoFrameIndex() const { return m_last_frame_index; }
+    inline int getVideoFramesReadCount() const { return m_frames_read_count; }
+    inline int getVideoFramesDroppedCount() const { return m_frames_dropped_count; }
+    inline int getVideoFrameTornReadCount() const { return m_torn_read_count; }
+    inline unsigned long long getLastVideoFrameCaptureTimestampUs() const { return m_last_capture_timestamp_us; }
 
 protected:
     SharedVideoFrameHeader *getFrameHeader()
@@ -186,6 +268,17 @@ private:
     unsigned char *m_bgr_frame_buffer;
     int m_frame_width, m_frame_height, m_frame_stride;
     int m_last_frame_index;
+
+    // Reader-side statistics. These live here rather than in the shared header
+    // because every reader mapping the stream keeps its own drop accounting.
+    int m_frames_read_count;
+    int m_frames_dropped_count;
+    int m_torn_read_count;
+    unsigned long long m_last_capture_timestamp_us;
+
+    // Consumer slot claimed in the shared header (-1 = reading unregistered)
+    int m_consumer_slot;
+    unsigned int m_consumer_nonce;
 };
 
 // -- ClientTrackerView ------
@@ -194,6 +287,8 @@ ClientTrackerView::ClientTrackerView(const ClientTrackerInfo &trackerInfo)
     , m_shared_memory_accesor(nullptr)
     , m_listener_count(0)
     , m_is_connected(false)
+    , m_compressed_frame_buffer(nullptr)
+    , m_compressed_frame_capacity(0)
 {
     clearTrackerDataFrameState();
 }
@@ -201,6 +296,11 @@ ClientTrackerView::ClientTrackerView(const ClientTrackerInfo &trackerInfo)
 ClientTrackerView::~ClientTrackerView()
 {
     closeVideoStream();
+
+    if (m_compressed_frame_buffer != nullptr)
+    {
+        delete[] m_compressed_frame_buffer;
+    }
 }
 
 void ClientTrackerView::applyTrackerDataFrame(
@@ -239,6 +339,9 @@ void ClientTrackerView::applyTrackerDataFrame(
             //this->ViewState.PSMoveView.ApplyControllerDataFrame(data_frame);
         } break;
 
+        case PSMoveProtocol::VIRTUAL_TRACKER:
+            break;
+
         default:
             assert(0 && "Unhandled controller type");
         }
@@ -251,6 +354,46 @@ void ClientTrackerView::clearTrackerDataFrameState()
     m_is_connected= false;
     m_data_frame_last_received_time= -1;
     data_frame_average_fps= 0.f;
+
+    // The frame buffer allocation is kept around for reuse
+    m_compressed_frame_size= 0;
+    m_compressed_frame_width= 0;
+    m_compressed_frame_height= 0;
+    m_compressed_frame_sequence_num= -1;
+}
+
+void ClientTrackerView::applyCompressedVideoFrame(
+    const PSMoveProtocol::Response_ResultTrackerVideoFrame *video_frame)
+{
+    assert(video_frame->tracker_id() == getTrackerId());
+
+    const std::string &jpeg_data = video_frame->jpeg_data();
+    const int jpeg_size = static_cast<int>(jpeg_data.size());
+
+    if (jpeg_size <= 0)
+    {
+        return;
+    }
+
+    // Grow the frame buffer as needed, but never shrink it - JPEG frame
+    // sizes wobble around a steady state and reallocating every frame
+    // would churn the heap for nothing
+    if (jpeg_size > m_compressed_frame_capacity)
+    {
+        if (m_compressed_frame_buffer != nullptr)
+        {
+            delete[] m_compressed_frame_buffer;
+        }
+
+        m_compressed_frame_buffer= new unsigned char[jpeg_size];
+        m_compressed_frame_capacity= jpeg_size;
+    }
+
+    std::memcpy(m_compressed_frame_buffer, jpeg_data.data(), jpeg_size);
+    m_compressed_frame_size= jpeg_size;
+    m_compressed_frame_width= video_frame->width();
+    m_compressed_frame_height= video_frame->height();
+    m_compressed_frame_sequence_num= video_frame->sequence_num();
 }
 
 bool ClientTrackerView::openVideoStream()
@@ -334,6 +477,26 @@ const unsigned char *ClientTrackerView::getVideoFrameBuffer() const
     return (m_shared_memory_accesor != nullptr) ? m_shared_memory_accesor->getVideoFrameBuffer() : nullptr;
 }
 
+int ClientTrackerView::getVideoFramesReadCount() const
+{
+    return (m_shared_memory_accesor != nullptr) ? m_shared_memory_accesor->getVideoFramesReadCount() : 0;
+}
+
+int ClientTrackerView::getVideoFramesDroppedCount() const
+{
+    return (m_shared_memory_accesor != nullptr) ? m_shared_memory_accesor->getVideoFramesDroppedCount() : 0;
+}
+
+int ClientTrackerView::getVideoFrameTornReadCount() const
+{
+    return (m_shared_memory_accesor != nullptr) ? m_shared_memory_accesor->getVideoFrameTornReadCount() : 0;
+}
+
+unsigned long long ClientTrackerView::getLastVideoFrameCaptureTimestampUs() const
+{
+    return (m_shared_memory_accesor != nullptr) ? m_shared_memory_accesor->getLastVideoFrameCaptureTimestampUs() : 0;
+}
+
 PSMoveFrustum ClientTrackerView::getTrackerFrustum() const
 {
     PSMoveFrustum frustum;
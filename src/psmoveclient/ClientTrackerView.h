@@ -11,12 +11,14 @@ namespace PSMoveProtocol
 {
     class DeviceOutputDataFrame;
     class DeviceOutputDataFrame_TrackerDataPacket;
+    class Response_ResultTrackerVideoFrame;
 };
 
 //-- constants -----
 enum eTrackerType
 {
-    PS3Eye
+    PS3Eye,
+    VirtualTracker
 };
 
 enum eTrackerDriver
@@ -80,6 +82,15 @@ private:
     long long m_data_frame_last_received_time;
     float data_frame_average_fps;
 
+    // Latest JPEG frame received over the compressed TCP video stream.
+    // The buffer is grown on demand and reused across frames.
+    unsigned char *m_compressed_frame_buffer;
+    int m_compressed_frame_size;
+    int m_compressed_frame_capacity;
+    int m_compressed_frame_width;
+    int m_compressed_frame_height;
+    int m_compressed_frame_sequence_num;
+
 public:
     ClientTrackerView(const ClientTrackerInfo &trackerInfo);
     ~ClientTrackerView();
@@ -88,6 +99,11 @@ public:
     void applyTrackerDataFrame(const PSMoveProtocol::DeviceOutputDataFrame_TrackerDataPacket *data_frame);
     void clearTrackerDataFrameState();
 
+    // Apply an MJPEG frame notification pushed over the TCP connection.
+    // These only arrive when the tracker stream was started with the
+    // compressed video quality option.
+    void applyCompressedVideoFrame(const PSMoveProtocol::Response_ResultTrackerVideoFrame *video_frame);
+
     // Used to apply tracker property changes after config tools run
     inline ClientTrackerInfo &getTrackerInfoMutable()
     {
@@ -176,6 +192,47 @@ public:
     int getVideoFrameStride() const;
     const unsigned char *getVideoFrameBuffer() const;
 
+    // Compressed video frame accessors. The buffer holds one complete JPEG
+    // image; decoding it is left to the application since the client library
+    // carries no image codec dependency.
+    inline bool hasCompressedVideoFrame() const
+    {
+        return m_compressed_frame_size > 0;
+    }
+
+    inline const unsigned char *getCompressedVideoFrameBuffer() const
+    {
+        return m_compressed_frame_buffer;
+    }
+
+    inline int getCompressedVideoFrameSize() const
+    {
+        return m_compressed_frame_size;
+    }
+
+    inline int getCompressedVideoFrameWidth() const
+    {
+        return m_compressed_frame_width;
+    }
+
+    inline int getCompressedVideoFrameHeight() const
+    {
+        return m_compressed_frame_height;
+    }
+
+    inline int getCompressedVideoFrameSequenceNum() const
+    {
+        return m_compressed_frame_sequence_num;
+    }
+
+    // Video stream statistics: frames copied out, frames the writer overwrote
+    // before we saw them, seqlock reads abandoned mid-copy, and the writer's
+    // steady-clock timestamp (microseconds) on the last frame we copied
+    int getVideoFramesReadCount() const;
+    int getVideoFramesDroppedCount() const;
+    int getVideoFrameTornReadCount() const;
+    unsigned long long getLastVideoFrameCaptureTimestampUs() const;
+
     PSMoveFrustum getTrackerFrustum() const;
     
     inline class SharedVideoFrameReadOnlyAccessor *getSharedMemoryAccessor() const
@@ -85,6 +85,9 @@ bool g_bHasControllerListChanged= false;
 bool g_bHasTrackerListChanged= false;
 bool g_bHasHMDListChanged= false;
 
+PSMControllerDataCallback g_controller_data_callback= nullptr;
+void *g_controller_data_callback_userdata= nullptr;
+
 // -- public interface -----
 const char* PSM_GetVersionString()
 {
@@ -253,6 +256,63 @@ PSMResult PSM_Update()
     return result;
 }
 
+PSMResult PSM_UpdateBlockingWithTimeout(int timeout_ms)
+{
+    PSMResult result= PSMResult_Error;
+
+    if (ClientPSMoveAPI::has_started())
+    {
+        // Sleep in the network reactor until a message arrives from the
+        // service or the deadline hits
+        const bool bProcessedNetworkEvent= ClientPSMoveAPI::update_blocking(timeout_ms);
+
+        for (PSMControllerID controller_id= 0; controller_id < PSMOVESERVICE_MAX_CONTROLLER_COUNT; ++controller_id)
+        {
+            PSMController *controller= &g_controllers[controller_id];
+            ClientControllerView * view = g_controller_views[controller_id];
+
+            if (view != nullptr)
+            {
+                extractControllerState(view, controller);
+            }
+        }
+
+        for (PSMTrackerID tracker_id= 0; tracker_id < PSMOVESERVICE_MAX_TRACKER_COUNT; ++tracker_id)
+        {
+            PSMTracker *tracker= &g_trackers[tracker_id];
+            ClientTrackerView * view = g_tracker_views[tracker_id];
+
+            if (view != nullptr)
+            {
+                extractTrackerState(view, tracker);
+            }
+        }
+
+        ClientPSMoveAPI::Message message;
+        while(ClientPSMoveAPI::poll_next_message(&message, sizeof(message)))
+        {
+            switch(message.payload_type)
+            {
+                case ClientPSMoveAPI::eMessagePayloadType::_messagePayloadType_Event:
+                    // Only handle events
+                    processEvent(&message.event_data);
+                    break;
+                case ClientPSMoveAPI::eMessagePayloadType::_messagePayloadType_Response:
+                    // Any response that didn't get a callback executed get dropped on the floor
+                    CLIENT_LOG_INFO("PSM_UpdateBlockingWithTimeout") << "Dropping response to request id: " << message.response_data.request_id;
+                    break;
+                default:
+                    assert(0 && "unreachable");
+                    break;
+            }
+        }
+
+        result= bProcessedNetworkEvent ? PSMResult_Success : PSMResult_Timeout;
+    }
+
+    return result;
+}
+
 PSMResult PSM_UpdateNoPollMessages()
 {
     PSMResult result= PSMResult_Error;
@@ -289,6 +349,37 @@ PSMResult PSM_UpdateNoPollMessages()
     return result;
 }
 
+static void controller_data_callback_trampoline(int controller_id, void *userdata)
+{
+    if (IS_VALID_CONTROLLER_INDEX(controller_id))
+    {
+        ClientControllerView * view = g_controller_views[controller_id];
+
+        if (view != nullptr)
+        {
+            // Refresh the C-facing state copy before handing control to the client
+            extractControllerState(view, &g_controllers[controller_id]);
+        }
+    }
+
+    if (g_controller_data_callback != nullptr)
+    {
+        g_controller_data_callback(controller_id, g_controller_data_callback_userdata);
+    }
+}
+
+PSMResult PSM_RegisterControllerDataCallback(PSMControllerDataCallback callback, void *callback_userdata)
+{
+    g_controller_data_callback= callback;
+    g_controller_data_callback_userdata= callback_userdata;
+
+    ClientPSMoveAPI::register_controller_data_callback(
+        (callback != nullptr) ? controller_data_callback_trampoline : nullptr,
+        nullptr);
+
+    return PSMResult_Success;
+}
+
 PSMController *PSM_GetController(PSMControllerID controller_id)
 {
     PSMController *controller= nullptr;
@@ -608,6 +699,106 @@ PSMResult PSM_ResetControllerOrientation(PSMControllerID controller_id, PSMQuatf
     return result;
 }
 
+PSMResult PSM_GetControllerPoseAtTime(PSMControllerID controller_id, float time_offset_seconds, PSMPosef *out_pose)
+{
+    PSMResult result= PSMResult_Error;
+
+    assert(out_pose);
+
+    if (IS_VALID_CONTROLLER_INDEX(controller_id))
+    {
+        ClientControllerView *view = g_controller_views[controller_id];
+
+        if (view != nullptr && view->GetIsPoseValid())
+        {
+            // Extrapolation lives on the view so the C++ API clients
+            // (like the OpenVR driver) can share it
+            const PSMovePose predicted_pose= view->GetPoseAtTime(time_offset_seconds);
+
+            out_pose->Position= {predicted_pose.Position.x, predicted_pose.Position.y, predicted_pose.Position.z};
+            out_pose->Orientation= {predicted_pose.Orientation.x, predicted_pose.Orientation.y, predicted_pose.Orientation.z, predicted_pose.Orientation.w};
+
+            result= PSMResult_Success;
+        }
+    }
+
+    return result;
+}
+
+PSMResult PSM_GetInterpolatedPose(PSMControllerID controller_id, float render_time_offset_seconds, PSMPosef *out_pose)
+{
+    PSMResult result= PSMResult_Error;
+
+    assert(out_pose);
+
+    if (IS_VALID_CONTROLLER_INDEX(controller_id))
+    {
+        ClientControllerView *view = g_controller_views[controller_id];
+
+        if (view != nullptr && view->GetIsPoseValid())
+        {
+            // The resampling lives on the view so the C++ API clients
+            // (like the OpenVR driver) can share it
+            const PSMovePose interpolated_pose= view->GetInterpolatedPose(render_time_offset_seconds);
+
+            out_pose->Position= {interpolated_pose.Position.x, interpolated_pose.Position.y, interpolated_pose.Position.z};
+            out_pose->Orientation= {interpolated_pose.Orientation.x, interpolated_pose.Orientation.y, interpolated_pose.Orientation.z, interpolated_pose.Orientation.w};
+
+            result= PSMResult_Success;
+        }
+    }
+
+    return result;
+}
+
+PSMResult PSM_GetAllControllerPoses(PSMVector3f *out_positions, PSMQuatf *out_orientations, bool *out_pose_valid_flags, int controller_count)
+{
+    PSMResult result= PSMResult_Error;
+
+    assert(out_positions);
+    assert(out_orientations);
+
+    if (ClientPSMoveAPI::has_started() && controller_count > 0)
+    {
+        const int write_count=
+            (controller_count < PSMOVESERVICE_MAX_CONTROLLER_COUNT)
+            ? controller_count : PSMOVESERVICE_MAX_CONTROLLER_COUNT;
+
+        for (PSMControllerID controller_id= 0; controller_id < write_count; ++controller_id)
+        {
+            ClientControllerView * view = g_controller_views[controller_id];
+
+            if (view != nullptr && view->GetIsPoseValid())
+            {
+                const PSMovePosition &position= view->GetPosition();
+                const PSMoveQuaternion &orientation= view->GetOrientation();
+
+                out_positions[controller_id]= {position.x, position.y, position.z};
+                out_orientations[controller_id]= {orientation.x, orientation.y, orientation.z, orientation.w};
+
+                if (out_pose_valid_flags != nullptr)
+                {
+                    out_pose_valid_flags[controller_id]= true;
+                }
+            }
+            else
+            {
+                out_positions[controller_id]= {0.f, 0.f, 0.f};
+                out_orientations[controller_id]= {0.f, 0.f, 0.f, 1.f};
+
+                if (out_pose_valid_flags != nullptr)
+                {
+                    out_pose_valid_flags[controller_id]= false;
+                }
+            }
+        }
+
+        result= PSMResult_Success;
+    }
+
+    return result;
+}
+
 /// Tracker Pool
 PSMTracker *PSM_GetTracker(PSMTrackerID tracker_id)
 {
@@ -944,6 +1135,54 @@ PSMResult PSM_EatResponse(PSMRequestID request_id)
     return ClientPSMoveAPI::eat_response(static_cast<ClientPSMoveAPI::t_request_id>(request_id)) ? PSMResult_Success : PSMResult_Error;
 }
 
+bool PSM_IsRequestPending(PSMRequestID request_id)
+{
+    return ClientPSMoveAPI::is_request_pending(static_cast<ClientPSMoveAPI::t_request_id>(request_id));
+}
+
+PSMResult PSM_WaitForCallbacks(const PSMRequestID *request_ids, int request_count, int timeout_ms)
+{
+    PSMResult result= PSMResult_Error;
+
+    if (request_ids != nullptr && request_count > 0)
+    {
+        CallbackTimeout timeout(timeout_ms);
+
+        result= PSMResult_Success;
+        while (true)
+        {
+            bool bAnyPending= false;
+
+            for (int list_index= 0; list_index < request_count; ++list_index)
+            {
+                if (PSM_IsRequestPending(request_ids[list_index]))
+                {
+                    bAnyPending= true;
+                    break;
+                }
+            }
+
+            if (!bAnyPending)
+            {
+                break;
+            }
+
+            if (timeout.HasElapsed())
+            {
+                result= PSMResult_Timeout;
+                break;
+            }
+
+            // Sleep in the network reactor until the next batch of responses
+            // lands rather than polling on a fixed interval - the whole
+            // pipelined batch typically completes in one wakeup
+            PSM_UpdateBlockingWithTimeout(10);
+        }
+    }
+
+    return result;
+}
+
 // -- Async Messaging Helpers -----
 static PSMResult blockUntilResponse(ClientPSMoveAPI::t_request_id req_id, int timeout_ms)
 {
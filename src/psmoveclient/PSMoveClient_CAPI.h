@@ -76,7 +76,8 @@ typedef enum _PSMControllerType
 typedef enum _PSMTrackerType
 {
     PSMTracker_None= -1,
-    PSMTracker_PS3Eye
+    PSMTracker_PS3Eye,
+    PSMTracker_Virtual
 } PSMTrackerType;
 
 typedef enum _PSMHmdType
@@ -476,6 +477,10 @@ typedef struct _PSMResponseMessage
 
 typedef void(*PSMResponseCallback)(const PSMResponseMessage *response, void *userdata);
 
+/// Fired from inside an update call the moment new data for a controller
+/// gets applied, before the update returns
+typedef void(*PSMControllerDataCallback)(PSMControllerID controller_id, void *userdata);
+
 // Message Container
 //------------------
 typedef struct _PSMMessage
@@ -507,6 +512,11 @@ PSM_PUBLIC_FUNCTION(PSMResult) PSM_InitializeAsync(const char* host, const char*
 // Update
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_Update();
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_UpdateNoPollMessages();
+/// Same as PSM_Update but sleeps until a message arrives from the service or
+/// the timeout elapses, waking the instant a new data frame lands instead of
+/// eating up to a poll interval of latency. Returns PSMResult_Timeout if the
+/// deadline passed without any network traffic.
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_UpdateBlockingWithTimeout(int timeout_ms);
 
 // System Queries
 PSM_PUBLIC_FUNCTION(const char*) PSM_GetVersionString();
@@ -520,8 +530,21 @@ PSM_PUBLIC_FUNCTION(bool) PSM_HasHMDListChanged();
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_PollNextMessage(PSMMessage *message, size_t message_size);
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_SendOpaqueRequest(PSMRequestHandle request_handle, PSMRequestID *out_request_id);
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_RegisterCallback(PSMRequestID request_id, PSMResponseCallback callback, void *callback_userdata);
+/// Register an optional callback fired whenever new controller data gets
+/// applied during an update call. Pass a null callback to unregister.
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_RegisterControllerDataCallback(PSMControllerDataCallback callback, void *callback_userdata);
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_CancelCallback(PSMRequestID request_id);
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_EatResponse(PSMRequestID request_id);
+/// True while the given request is in flight or its registered callback
+/// hasn't fired yet
+PSM_PUBLIC_FUNCTION(bool) PSM_IsRequestPending(PSMRequestID request_id);
+/// Block until every request in the given list has completed (fired its
+/// registered callback) or timeout_ms elapses. Requests pipeline over the
+/// TCP connection, so issuing a batch of Async requests and waiting on them
+/// here completes in one service round trip instead of one per request -
+/// use this for bulk configuration reads. Returns PSMResult_Timeout if any
+/// request was still outstanding at the deadline.
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_WaitForCallbacks(const PSMRequestID *request_ids, int request_count, int timeout_ms);
 
 /// Controller Pool
 PSM_PUBLIC_FUNCTION(PSMController *) PSM_GetController(PSMControllerID controller_id);
@@ -534,6 +557,28 @@ PSM_PUBLIC_FUNCTION(PSMResult) PSM_StartControllerDataStream(PSMControllerID con
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_StopControllerDataStream(PSMControllerID controller_id, int timeout_ms);
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_SetControllerLEDColor(PSMControllerID controller_id, PSMTrackingColorType tracking_color, int timeout_ms);
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_ResetControllerOrientation(PSMControllerID controller_id, PSMQuatf *q_pose, int timeout_ms);
+/// Extrapolate the controller pose time_offset_seconds past the last received
+/// data frame using the streamed physics state (velocity/acceleration/angular
+/// velocity), letting a client rendering faster than the update rate predict
+/// poses locally instead of round-tripping to the service. Fails if the
+/// controller has no valid filtered pose yet.
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetControllerPoseAtTime(PSMControllerID controller_id, float time_offset_seconds, PSMPosef *out_pose);
+/// Resample the controller pose at render_time_offset_seconds relative to
+/// now. Offsets in the recent past blend between the timestamped poses the
+/// client buffered from the data stream, so a render loop running faster
+/// than the update rate (e.g. 120Hz against 60Hz updates) gets smooth
+/// stepping-free poses; offsets past the newest sample extrapolate along the
+/// streamed physics like PSM_GetControllerPoseAtTime. Fails if the
+/// controller has no valid filtered pose yet.
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetInterpolatedPose(PSMControllerID controller_id, float render_time_offset_seconds, PSMPosef *out_pose);
+/// Write the current pose of every controller slot into caller-provided
+/// contiguous arrays (structure-of-arrays layout) in one pass. Entry i holds
+/// controller id i. Slots without an allocated listener, or whose filtered
+/// pose isn't valid yet, get the identity pose and a false valid flag.
+/// controller_count says how many entries each array holds; entries past
+/// PSMOVESERVICE_MAX_CONTROLLER_COUNT are left untouched. out_pose_valid_flags
+/// may be null if the caller doesn't care.
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetAllControllerPoses(PSMVector3f *out_positions, PSMQuatf *out_orientations, bool *out_pose_valid_flags, int controller_count);
 
 /// Async Controller Methods
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetControllerListAsync(PSMRequestID *out_request_id);
@@ -0,0 +1,877 @@
+//-- includes -----
+#include "ClientPSMoveAPI.h"
+#include "ClientControllerView.h"
+#include "PSMoveProtocolInterface.h"
+#include "PSMoveProtocol.pb.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#if defined(__linux) || defined (__APPLE__)
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+//-- constants -----
+// Keep these in sync with the interactive calibration stages in the config tool
+static const double k_stabilize_wait_time_ms = 1000.f;
+static const int k_desired_gyro_noise_sample_count = 1000;
+static const float k_default_drift_sampling_time_ms = 30.f * 1000.f;
+static const int k_max_accelerometer_samples = 500;
+
+static const char *k_tracking_color_names[MAX_PSMOVE_COLOR_TYPES] = {
+    "magenta",
+    "cyan",
+    "yellow",
+    "red",
+    "green",
+    "blue"
+};
+
+enum eCliCommand
+{
+    command_invalid,
+    command_calibrate_gyro,
+    command_calibrate_accelerometer,
+    command_set_color_preset
+};
+
+//-- definitions -----
+struct CliOptions
+{
+    eCliCommand command;
+    std::string host;
+    std::string port;
+    int controller_id;
+    int tracker_id;
+    float drift_sampling_time_ms;
+
+    // Color preset settings
+    PSMoveTrackingColorType color_type;
+    float hue_center, hue_range;
+    float saturation_center, saturation_range;
+    float value_center, value_range;
+
+    CliOptions()
+        : command(command_invalid)
+        , host("localhost")
+        , port("9512")
+        , controller_id(0)
+        , tracker_id(0)
+        , drift_sampling_time_ms(k_default_drift_sampling_time_ms)
+        , color_type(Magenta)
+        , hue_center(300.f), hue_range(10.f)
+        , saturation_center(255.f), saturation_range(32.f)
+        , value_center(255.f), value_range(32.f)
+    {
+    }
+};
+
+// Mirrors GyroscopeNoiseSamples in AppStage_GyroscopeCalibration
+struct GyroscopeNoiseSamples
+{
+    PSMoveFloatVector3 omega_samples[k_desired_gyro_noise_sample_count];
+    PSMoveFloatVector3 drift_rotation;
+    std::chrono::time_point<std::chrono::high_resolution_clock> sampleStartTime;
+    int sample_count;
+
+    float variance; // Max sensor variance (raw_sensor_units/s/s for DS4, rad/s/s for PSMove)
+    float drift; // Max drift rate (raw_sensor_units/s for DS4, rad/s for PSMove)
+
+    void clear()
+    {
+        drift_rotation= PSMoveFloatVector3::create(0, 0, 0);
+        sample_count= 0;
+        variance= 0.f;
+        drift= 0.f;
+    }
+
+    void computeStatistics(std::chrono::duration<float, std::milli> sampleDurationMilli)
+    {
+        const float sampleDurationSeconds= sampleDurationMilli.count() / 1000.f;
+        const float N = static_cast<float>(sample_count);
+
+        // Compute the mean of the error samples, where "error" = abs(omega_sample)
+        // If we took the mean of the signed omega samples we'd get a value very
+        // close to zero since the the gyro at rest over a short period has mean-zero noise
+        PSMoveFloatVector3 mean_omega_error= PSMoveFloatVector3::create(0.f, 0.f, 0.f);
+        for (int sample_index = 0; sample_index < sample_count; sample_index++)
+        {
+            PSMoveFloatVector3 error_sample= omega_samples[sample_index].abs();
+
+            mean_omega_error= mean_omega_error + error_sample;
+        }
+        mean_omega_error= mean_omega_error.unsafe_divide(N);
+
+        // Compute the variance of the (unsigned) sample error, where "error" = abs(omega_sample)
+        PSMoveFloatVector3 var_omega= PSMoveFloatVector3::create(0.f, 0.f, 0.f);
+        for (int sample_index = 0; sample_index < sample_count; sample_index++)
+        {
+            PSMoveFloatVector3 error_sample= omega_samples[sample_index].abs();
+            PSMoveFloatVector3 diff_from_mean= error_sample - mean_omega_error;
+
+            var_omega= var_omega + diff_from_mean.square();
+        }
+        var_omega= var_omega.unsafe_divide(N - 1);
+
+        // Use the max variance of all three axes (should be close)
+        variance= var_omega.maxValue();
+
+        // Compute the max drift rate we got across a three axis
+        PSMoveFloatVector3 drift_rate= drift_rotation.unsafe_divide(sampleDurationSeconds);
+        drift= drift_rate.abs().maxValue();
+    }
+};
+
+// Mirrors AccelerometerStatistics in AppStage_AccelerometerCalibration
+struct AccelerometerNoiseSamples
+{
+    PSMoveFloatVector3 accelerometer_samples[k_max_accelerometer_samples];
+    PSMoveFloatVector3 avg_accelerometer_sample;
+    float noise_variance;
+    float noise_radius;
+    int sample_count;
+
+    void clear()
+    {
+        avg_accelerometer_sample= PSMoveFloatVector3::create(0.f, 0.f, 0.f);
+        sample_count= 0;
+        noise_variance= 0.f;
+        noise_radius= 0.f;
+    }
+
+    bool getIsComplete() const
+    {
+        return sample_count >= k_max_accelerometer_samples;
+    }
+
+    void addSample(const PSMoveFloatVector3 &sample)
+    {
+        if (getIsComplete())
+        {
+            return;
+        }
+
+        accelerometer_samples[sample_count]= sample;
+        ++sample_count;
+
+        if (getIsComplete())
+        {
+            computeStatistics();
+        }
+    }
+
+    void computeStatistics()
+    {
+        const float N = static_cast<float>(sample_count);
+
+        // Compute the mean of the accelerometer readings
+        avg_accelerometer_sample= PSMoveFloatVector3::create(0.f, 0.f, 0.f);
+        for (int sample_index = 0; sample_index < sample_count; ++sample_index)
+        {
+            avg_accelerometer_sample= avg_accelerometer_sample + accelerometer_samples[sample_index];
+        }
+        avg_accelerometer_sample= avg_accelerometer_sample.unsafe_divide(N);
+
+        // Compute the variance and bounding radius of the accelerometer noise
+        PSMoveFloatVector3 var_accelerometer= PSMoveFloatVector3::create(0.f, 0.f, 0.f);
+        noise_radius= 0.f;
+        for (int sample_index = 0; sample_index < sample_count; ++sample_index)
+        {
+            PSMoveFloatVector3 error= accelerometer_samples[sample_index] - avg_accelerometer_sample;
+
+            var_accelerometer= var_accelerometer + error.square();
+            noise_radius= fmaxf(noise_radius, error.length());
+        }
+        var_accelerometer= var_accelerometer.unsafe_divide(N - 1);
+        noise_variance= var_accelerometer.maxValue();
+    }
+};
+
+//-- implementation -----
+class PSMoveConfigCliApp
+{
+public:
+    PSMoveConfigCliApp(const CliOptions &options)
+        : m_options(options)
+        , m_keepRunning(true)
+        , m_exitCode(0)
+        , m_controllerView(nullptr)
+        , m_isControllerStreamActive(false)
+        , m_lastControllerSeqNum(-1)
+        , m_bIsStable(false)
+        , m_bLastSampleTimeValid(false)
+        , m_bSampling(false)
+        , m_lastReportedProgressPercent(-1)
+        , m_pending_request_id(ClientPSMoveAPI::INVALID_REQUEST_ID)
+    {
+        m_gyroNoiseSamples.clear();
+        m_accelerometerNoiseSamples.clear();
+    }
+
+    int run()
+    {
+        // Attempt to start and run the client
+        try
+        {
+            if (startup())
+            {
+                while (m_keepRunning)
+                {
+                    update();
+
+                    sleep_millisecond(1);
+                }
+            }
+            else
+            {
+                std::cerr << "Failed to startup the PSMove Client" << std::endl;
+                m_exitCode= 1;
+            }
+        }
+        catch (std::exception& e)
+        {
+            std::cerr << e.what() << std::endl;
+            m_exitCode= 1;
+        }
+
+        // Attempt to shutdown the client
+        try
+        {
+           shutdown();
+        }
+        catch (std::exception& e)
+        {
+            std::cerr << e.what() << std::endl;
+            m_exitCode= 1;
+        }
+
+        return m_exitCode;
+    }
+
+private:
+    void sleep_millisecond(int sleepMs)
+    {
+    #if defined(__linux) || defined (__APPLE__)
+        usleep(sleepMs * 1000);
+    #endif
+    #ifdef _WIN32
+        Sleep(sleepMs);
+    #endif
+    }
+
+    bool startup()
+    {
+        bool success= true;
+
+        // Attempt to connect to the server
+        if (!ClientPSMoveAPI::startup(m_options.host, m_options.port))
+        {
+            std::cerr << "psmoveconfigcli - Failed to initialize the client network manager" << std::endl;
+            success= false;
+        }
+
+        return success;
+    }
+
+    void update()
+    {
+        // Process incoming/outgoing networking requests
+        ClientPSMoveAPI::update();
+
+        // Poll events queued up by the call to ClientPSMoveAPI::update()
+        ClientPSMoveAPI::Message message;
+        while (ClientPSMoveAPI::poll_next_message(&message, sizeof(message)))
+        {
+            switch (message.payload_type)
+            {
+            case ClientPSMoveAPI::_messagePayloadType_Response:
+                if (m_pending_request_id != ClientPSMoveAPI::INVALID_REQUEST_ID &&
+                    message.response_data.request_id == m_pending_request_id)
+                {
+                    m_pending_request_id= ClientPSMoveAPI::INVALID_REQUEST_ID;
+                    handle_pending_response(&message.response_data);
+                }
+                break;
+            case ClientPSMoveAPI::_messagePayloadType_Event:
+                handle_client_psmove_event(message.event_data.event_type);
+                break;
+            }
+        }
+
+        if (m_isControllerStreamActive &&
+            m_controllerView->GetOutputSequenceNum() != m_lastControllerSeqNum)
+        {
+            m_lastControllerSeqNum= m_controllerView->GetOutputSequenceNum();
+
+            switch (m_options.command)
+            {
+            case command_calibrate_gyro:
+                update_gyro_calibration();
+                break;
+            case command_calibrate_accelerometer:
+                update_accelerometer_calibration();
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    void shutdown()
+    {
+        // Free any allocated controller views
+        if (m_controllerView)
+        {
+            if (m_isControllerStreamActive)
+            {
+                ClientPSMoveAPI::eat_response(ClientPSMoveAPI::stop_controller_data_stream(m_controllerView));
+                m_isControllerStreamActive= false;
+            }
+
+            ClientPSMoveAPI::free_controller_view(m_controllerView);
+            m_controllerView= nullptr;
+        }
+
+        // Close all active network connections
+        ClientPSMoveAPI::shutdown();
+    }
+
+    void fail(const char *reason)
+    {
+        std::cerr << "psmoveconfigcli - " << reason << std::endl;
+        m_exitCode= 1;
+        m_keepRunning= false;
+    }
+
+    void complete(const char *message)
+    {
+        std::cout << "psmoveconfigcli - " << message << std::endl;
+        m_keepRunning= false;
+    }
+
+    // ClientPSMoveAPI event handling
+    void handle_client_psmove_event(ClientPSMoveAPI::eEventType event_type)
+    {
+        switch (event_type)
+        {
+        case ClientPSMoveAPI::connectedToService:
+            std::cout << "psmoveconfigcli - Connected to service" << std::endl;
+            start_command();
+            break;
+        case ClientPSMoveAPI::failedToConnectToService:
+            fail("Failed to connect to service");
+            break;
+        case ClientPSMoveAPI::disconnectedFromService:
+            fail("Disconnected from service");
+            break;
+        case ClientPSMoveAPI::opaqueServiceEvent:
+        case ClientPSMoveAPI::controllerListUpdated:
+        case ClientPSMoveAPI::trackerListUpdated:
+        case ClientPSMoveAPI::hmdListUpdated:
+            // Device lists changing mid-calibration is unusual on a rack
+            // station but harmless for the commands we run - carry on
+            break;
+        default:
+            break;
+        }
+    }
+
+    void start_command()
+    {
+        switch (m_options.command)
+        {
+        case command_calibrate_gyro:
+        case command_calibrate_accelerometer:
+            {
+                std::cout << "psmoveconfigcli - Starting data stream for controller "
+                    << m_options.controller_id << std::endl;
+
+                // Once created, updates will automatically get pushed into this view
+                m_controllerView= ClientPSMoveAPI::allocate_controller_view(m_options.controller_id);
+
+                // The DS4 needs optical data for its stability test - request it
+                // unconditionally since it is cheap for the PSMove too
+                m_pending_request_id=
+                    ClientPSMoveAPI::start_controller_data_stream(
+                        m_controllerView,
+                        ClientPSMoveAPI::includePositionData
+                        | ClientPSMoveAPI::includeRawSensorData
+                        | ClientPSMoveAPI::includeCalibratedSensorData);
+            }
+            break;
+        case command_set_color_preset:
+            request_set_color_preset();
+            break;
+        default:
+            fail("No command given");
+            break;
+        }
+    }
+
+    void handle_pending_response(const ClientPSMoveAPI::ResponseMessage *response)
+    {
+        if (response->result_code != ClientPSMoveAPI::_clientPSMoveResultCode_ok)
+        {
+            fail("Service request failed");
+            return;
+        }
+
+        switch (m_options.command)
+        {
+        case command_calibrate_gyro:
+        case command_calibrate_accelerometer:
+            {
+                // The stream is up - wait for the controller to hold still
+                m_isControllerStreamActive= true;
+                m_lastControllerSeqNum= -1;
+
+                std::cout << "psmoveconfigcli - Stream started."
+                    << " Leave the controller on a level surface..." << std::endl;
+            }
+            break;
+        case command_set_color_preset:
+            complete("Color preset applied");
+            break;
+        default:
+            break;
+        }
+    }
+
+    // Stability gate shared by both sensor calibrations.
+    // Returns true once the controller has been stable for the wait period.
+    bool update_stability_gate(const std::chrono::time_point<std::chrono::high_resolution_clock> &now)
+    {
+        if (m_controllerView->GetIsStable())
+        {
+            if (m_bIsStable)
+            {
+                std::chrono::duration<double, std::milli> stableDuration = now - m_stableStartTime;
+
+                if (stableDuration.count() >= k_stabilize_wait_time_ms)
+                {
+                    return true;
+                }
+            }
+            else
+            {
+                m_bIsStable= true;
+                m_stableStartTime= now;
+            }
+        }
+        else
+        {
+            if (m_bIsStable)
+            {
+                std::cout << "psmoveconfigcli - Controller moved, waiting for it to settle again" << std::endl;
+                m_bIsStable= false;
+            }
+        }
+
+        return false;
+    }
+
+    void report_progress_percent(int percent)
+    {
+        // Only print when the integer percentage ticks over so scripted
+        // captures don't drown in output
+        if (percent != m_lastReportedProgressPercent)
+        {
+            std::cout << "psmoveconfigcli - Sampling: " << percent << "%" << std::endl;
+            m_lastReportedProgressPercent= percent;
+        }
+    }
+
+    PSMoveFloatVector3 get_calibrated_gyroscope() const
+    {
+        switch (m_controllerView->GetControllerViewType())
+        {
+        case ClientControllerView::PSDualShock4:
+            return m_controllerView->GetPSDualShock4View().GetCalibratedSensorData().Gyroscope;
+        case ClientControllerView::PSMove:
+            return m_controllerView->GetPSMoveView().GetCalibratedSensorData().Gyroscope;
+        default:
+            return PSMoveFloatVector3::create(0.f, 0.f, 0.f);
+        }
+    }
+
+    PSMoveFloatVector3 get_calibrated_accelerometer() const
+    {
+        switch (m_controllerView->GetControllerViewType())
+        {
+        case ClientControllerView::PSDualShock4:
+            return m_controllerView->GetPSDualShock4View().GetCalibratedSensorData().Accelerometer;
+        case ClientControllerView::PSMove:
+            return m_controllerView->GetPSMoveView().GetCalibratedSensorData().Accelerometer;
+        default:
+            return PSMoveFloatVector3::create(0.f, 0.f, 0.f);
+        }
+    }
+
+    void update_gyro_calibration()
+    {
+        const std::chrono::time_point<std::chrono::high_resolution_clock> now =
+            std::chrono::high_resolution_clock::now();
+        std::chrono::duration<float, std::milli> sampleTimeDeltaMilli(0);
+
+        if (m_bLastSampleTimeValid)
+        {
+            sampleTimeDeltaMilli = now - m_lastSampleTime;
+        }
+        m_lastSampleTime= now;
+        m_bLastSampleTimeValid= true;
+
+        if (!m_bSampling)
+        {
+            if (update_stability_gate(now))
+            {
+                std::cout << "psmoveconfigcli - Controller stable, sampling gyro drift for "
+                    << static_cast<int>(m_options.drift_sampling_time_ms / 1000.f)
+                    << " seconds" << std::endl;
+
+                m_gyroNoiseSamples.clear();
+                m_gyroNoiseSamples.sampleStartTime= now;
+                m_bSampling= true;
+            }
+
+            return;
+        }
+
+        if (!m_controllerView->GetIsStable())
+        {
+            // Whoops! The controller got moved - restart the sampling period
+            std::cout << "psmoveconfigcli - Controller moved during sampling, restarting" << std::endl;
+            m_bIsStable= false;
+            m_bSampling= false;
+            return;
+        }
+
+        const std::chrono::duration<float, std::milli> sampleDurationMilli = now - m_gyroNoiseSamples.sampleStartTime;
+        const float deltaTimeSeconds= sampleTimeDeltaMilli.count()/1000.f;
+        const PSMoveFloatVector3 calibratedGyro= get_calibrated_gyroscope();
+
+        // Accumulate the drift total
+        if (deltaTimeSeconds > 0.f)
+        {
+            m_gyroNoiseSamples.drift_rotation=
+                m_gyroNoiseSamples.drift_rotation
+                + calibratedGyro*deltaTimeSeconds;
+        }
+
+        // Record the next noise sample
+        if (m_gyroNoiseSamples.sample_count < k_desired_gyro_noise_sample_count)
+        {
+            m_gyroNoiseSamples.omega_samples[m_gyroNoiseSamples.sample_count]= calibratedGyro;
+            ++m_gyroNoiseSamples.sample_count;
+        }
+
+        report_progress_percent(
+            std::min(static_cast<int>(100.f * sampleDurationMilli.count() / m_options.drift_sampling_time_ms), 100));
+
+        // See if we have completed the sampling period
+        if (sampleDurationMilli.count() >= m_options.drift_sampling_time_ms)
+        {
+            // Compute bias and drift statistics
+            m_gyroNoiseSamples.computeStatistics(sampleDurationMilli);
+
+            std::cout << "psmoveconfigcli - Gyro drift: " << m_gyroNoiseSamples.drift
+                << ", variance: " << m_gyroNoiseSamples.variance << std::endl;
+
+            // Update the gyro config on the service
+            request_set_gyroscope_calibration(
+                m_gyroNoiseSamples.drift,
+                m_gyroNoiseSamples.variance);
+
+            m_isControllerStreamActive= false;
+            complete("Gyroscope calibration saved");
+        }
+    }
+
+    void update_accelerometer_calibration()
+    {
+        const std::chrono::time_point<std::chrono::high_resolution_clock> now =
+            std::chrono::high_resolution_clock::now();
+
+        if (!m_bSampling)
+        {
+            if (update_stability_gate(now))
+            {
+                std::cout << "psmoveconfigcli - Controller stable, sampling accelerometer noise" << std::endl;
+
+                m_accelerometerNoiseSamples.clear();
+                m_bSampling= true;
+            }
+
+            return;
+        }
+
+        if (!m_controllerView->GetIsStable())
+        {
+            // Whoops! The controller got moved - restart the sample batch
+            std::cout << "psmoveconfigcli - Controller moved during sampling, restarting" << std::endl;
+            m_bIsStable= false;
+            m_bSampling= false;
+            return;
+        }
+
+        // Store the new sample
+        m_accelerometerNoiseSamples.addSample(get_calibrated_accelerometer());
+
+        report_progress_percent(
+            (100 * m_accelerometerNoiseSamples.sample_count) / k_max_accelerometer_samples);
+
+        // See if we filled all of the samples
+        if (m_accelerometerNoiseSamples.getIsComplete())
+        {
+            std::cout << "psmoveconfigcli - Accelerometer noise radius: " << m_accelerometerNoiseSamples.noise_radius
+                << ", variance: " << m_accelerometerNoiseSamples.noise_variance << std::endl;
+
+            // Tell the service what the new calibration constraints are
+            request_set_accelerometer_calibration(
+                m_accelerometerNoiseSamples.noise_radius,
+                m_accelerometerNoiseSamples.noise_variance);
+
+            m_isControllerStreamActive= false;
+            complete("Accelerometer calibration saved");
+        }
+    }
+
+    // Service requests - these mirror the config tool calibration stages
+    void request_set_gyroscope_calibration(
+        const float drift,
+        const float variance)
+    {
+        RequestPtr request(new PSMoveProtocol::Request());
+        request->set_type(PSMoveProtocol::Request_RequestType_SET_CONTROLLER_GYROSCOPE_CALIBRATION);
+
+        PSMoveProtocol::Request_RequestSetControllerGyroscopeCalibration *calibration =
+            request->mutable_set_controller_gyroscope_calibration_request();
+
+        calibration->set_controller_id(m_options.controller_id);
+
+        calibration->set_drift(drift);
+        calibration->set_variance(variance);
+        calibration->set_gyro_gain_setting(""); // keep existing gain
+
+        ClientPSMoveAPI::eat_response(ClientPSMoveAPI::send_opaque_request(&request));
+    }
+
+    void request_set_accelerometer_calibration(
+        const float noise_radius,
+        const float noise_variance)
+    {
+        RequestPtr request(new PSMoveProtocol::Request());
+        request->set_type(PSMoveProtocol::Request_RequestType_SET_CONTROLLER_ACCELEROMETER_CALIBRATION);
+
+        PSMoveProtocol::Request_RequestSetControllerAccelerometerCalibration *calibration =
+            request->mutable_set_controller_accelerometer_calibration_request();
+
+        calibration->set_controller_id(m_options.controller_id);
+        calibration->set_noise_radius(noise_radius);
+        calibration->set_variance(noise_variance);
+
+        ClientPSMoveAPI::eat_response(ClientPSMoveAPI::send_opaque_request(&request));
+    }
+
+    void request_set_color_preset()
+    {
+        std::cout << "psmoveconfigcli - Applying " << k_tracking_color_names[m_options.color_type]
+            << " preset on tracker " << m_options.tracker_id
+            << " for controller " << m_options.controller_id << std::endl;
+
+        RequestPtr request(new PSMoveProtocol::Request());
+        request->set_type(PSMoveProtocol::Request_RequestType_SET_TRACKER_COLOR_PRESET);
+        request->mutable_request_set_tracker_color_preset()->set_tracker_id(m_options.tracker_id);
+        request->mutable_request_set_tracker_color_preset()->set_device_id(m_options.controller_id);
+        request->mutable_request_set_tracker_color_preset()->set_device_category(
+            PSMoveProtocol::Request_RequestSetTrackerColorPreset_DeviceCategory_CONTROLLER);
+
+        {
+            PSMoveProtocol::TrackingColorPreset* tracking_color_preset =
+                request->mutable_request_set_tracker_color_preset()->mutable_color_preset();
+
+            tracking_color_preset->set_color_type(static_cast<PSMoveProtocol::TrackingColorType>(m_options.color_type));
+            tracking_color_preset->set_hue_center(m_options.hue_center);
+            tracking_color_preset->set_hue_range(m_options.hue_range);
+            tracking_color_preset->set_saturation_center(m_options.saturation_center);
+            tracking_color_preset->set_saturation_range(m_options.saturation_range);
+            tracking_color_preset->set_value_center(m_options.value_center);
+            tracking_color_preset->set_value_range(m_options.value_range);
+        }
+
+        m_pending_request_id= ClientPSMoveAPI::send_opaque_request(&request);
+    }
+
+private:
+    CliOptions m_options;
+    bool m_keepRunning;
+    int m_exitCode;
+
+    ClientControllerView *m_controllerView;
+    bool m_isControllerStreamActive;
+    int m_lastControllerSeqNum;
+
+    // Stability gate state
+    bool m_bIsStable;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_stableStartTime;
+
+    // Sampling state
+    bool m_bLastSampleTimeValid;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_lastSampleTime;
+    bool m_bSampling;
+    int m_lastReportedProgressPercent;
+
+    GyroscopeNoiseSamples m_gyroNoiseSamples;
+    AccelerometerNoiseSamples m_accelerometerNoiseSamples;
+
+    ClientPSMoveAPI::t_request_id m_pending_request_id;
+};
+
+//-- entry point -----
+static void print_usage()
+{
+    std::cout <<
+        "usage: psmoveconfigcli <command> [options]\n"
+        "\n"
+        "Headless calibration front-end for PSMoveService. Commands:\n"
+        "  calibrate-gyro           Measure gyro bias/drift with the controller at rest\n"
+        "                           and save it to the service\n"
+        "  calibrate-accelerometer  Measure accelerometer noise with the controller at\n"
+        "                           rest and save it to the service\n"
+        "  set-color-preset         Save a tracking color preset for a tracker\n"
+        "\n"
+        "common options:\n"
+        "  --host <address>         Service address (default localhost)\n"
+        "  --port <port>            Service port (default 9512)\n"
+        "  --controller <id>        Controller id (default 0)\n"
+        "\n"
+        "calibrate-gyro options:\n"
+        "  --seconds <n>            Drift sampling duration (default 30)\n"
+        "\n"
+        "set-color-preset options:\n"
+        "  --tracker <id>           Tracker id (default 0)\n"
+        "  --color <name>           magenta|cyan|yellow|red|green|blue\n"
+        "  --hue <center> <range>   Hue filter center and range\n"
+        "  --saturation <center> <range>\n"
+        "  --value <center> <range>\n"
+        << std::endl;
+}
+
+static bool parse_arguments(int argc, char *argv[], CliOptions &options)
+{
+    if (argc < 2)
+    {
+        return false;
+    }
+
+    if (strcmp(argv[1], "calibrate-gyro") == 0)
+    {
+        options.command= command_calibrate_gyro;
+    }
+    else if (strcmp(argv[1], "calibrate-accelerometer") == 0)
+    {
+        options.command= command_calibrate_accelerometer;
+    }
+    else if (strcmp(argv[1], "set-color-preset") == 0)
+    {
+        options.command= command_set_color_preset;
+    }
+    else
+    {
+        std::cerr << "Unknown command: " << argv[1] << std::endl;
+        return false;
+    }
+
+    for (int arg_index= 2; arg_index < argc; ++arg_index)
+    {
+        const char *arg= argv[arg_index];
+        const int args_remaining= argc - arg_index - 1;
+
+        if (strcmp(arg, "--host") == 0 && args_remaining >= 1)
+        {
+            options.host= argv[++arg_index];
+        }
+        else if (strcmp(arg, "--port") == 0 && args_remaining >= 1)
+        {
+            options.port= argv[++arg_index];
+        }
+        else if (strcmp(arg, "--controller") == 0 && args_remaining >= 1)
+        {
+            options.controller_id= atoi(argv[++arg_index]);
+        }
+        else if (strcmp(arg, "--tracker") == 0 && args_remaining >= 1)
+        {
+            options.tracker_id= atoi(argv[++arg_index]);
+        }
+        else if (strcmp(arg, "--seconds") == 0 && args_remaining >= 1)
+        {
+            options.drift_sampling_time_ms= static_cast<float>(atof(argv[++arg_index])) * 1000.f;
+        }
+        else if (strcmp(arg, "--color") == 0 && args_remaining >= 1)
+        {
+            const char *color_name= argv[++arg_index];
+            bool bFoundColor= false;
+
+            for (int color_index= 0; color_index < MAX_PSMOVE_COLOR_TYPES; ++color_index)
+            {
+                if (strcmp(color_name, k_tracking_color_names[color_index]) == 0)
+                {
+                    options.color_type= static_cast<PSMoveTrackingColorType>(color_index);
+                    bFoundColor= true;
+                    break;
+                }
+            }
+
+            if (!bFoundColor)
+            {
+                std::cerr << "Unknown color: " << color_name << std::endl;
+                return false;
+            }
+        }
+        else if (strcmp(arg, "--hue") == 0 && args_remaining >= 2)
+        {
+            options.hue_center= static_cast<float>(atof(argv[++arg_index]));
+            options.hue_range= static_cast<float>(atof(argv[++arg_index]));
+        }
+        else if (strcmp(arg, "--saturation") == 0 && args_remaining >= 2)
+        {
+            options.saturation_center= static_cast<float>(atof(argv[++arg_index]));
+            options.saturation_range= static_cast<float>(atof(argv[++arg_index]));
+        }
+        else if (strcmp(arg, "--value") == 0 && args_remaining >= 2)
+        {
+            options.value_center= static_cast<float>(atof(argv[++arg_index]));
+            options.value_range= static_cast<float>(atof(argv[++arg_index]));
+        }
+        else
+        {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    CliOptions options;
+
+    if (!parse_arguments(argc, argv, options))
+    {
+        print_usage();
+        return 1;
+    }
+
+    PSMoveConfigCliApp app(options);
+
+    return app.run();
+}
@@ -5,6 +5,16 @@
 #include "Renderer.h"
 #include "Logger.h"
 
+#include "SDL_timer.h"
+
+//-- constants -----
+// Re-render at least this often even when nothing is marked dirty so that
+// timers and spinners (stable-wait countdowns, progress bars) keep advancing
+static const double k_max_render_idle_time_ms= 100.0;
+
+//-- prototypes -----
+static void mark_render_dirty_callback(int controller_id, void *userdata);
+
 //-- public methods -----
 App::App()
     : m_renderer(new Renderer())
@@ -16,6 +26,8 @@ App::App()
     , m_appStageName(nullptr)
     , m_appStage(nullptr)
     , m_bShutdownRequested(false)
+    , m_bRenderDirty(true)
+    , m_lastRenderTime()
 {
 }
 
@@ -40,24 +52,55 @@ int App::exec(int argc, char** argv, const char *initial_state_name)
 
         setAppStage(initial_state_name);
 
-        while (!m_bShutdownRequested) 
+        while (!m_bShutdownRequested)
         {
-            if (SDL_PollEvent(&e)) 
+            bool bQuitRequested= false;
+
+            // Drain all pending input events - any input invalidates the frame
+            while (SDL_PollEvent(&e))
             {
-                if (e.type == SDL_QUIT || 
-                    (e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_ESCAPE)) 
+                if (e.type == SDL_QUIT ||
+                    (e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_ESCAPE))
                 {
                     Log_INFO("App::exec", "QUIT message received");
+                    bQuitRequested= true;
                     break;
                 }
-                else 
+                else
                 {
                     onSDLEvent(e);
+                    markRenderDirty();
                 }
             }
 
+            if (bQuitRequested)
+            {
+                break;
+            }
+
             update();
-            render();
+
+            // Render on the loop's own clock rather than the data arrival
+            // cadence: only re-render when something was marked dirty or the
+            // idle repaint interval has run out
+            const std::chrono::time_point<std::chrono::high_resolution_clock> now=
+                std::chrono::high_resolution_clock::now();
+            const std::chrono::duration<double, std::milli> timeSinceRender= now - m_lastRenderTime;
+
+            if (m_bRenderDirty || timeSinceRender.count() >= k_max_render_idle_time_ms)
+            {
+                // When nothing was marked dirty this is just a periodic
+                // re-present - the UI can be replayed from the draw data cache
+                render(!m_bRenderDirty);
+
+                m_bRenderDirty= false;
+                m_lastRenderTime= now;
+            }
+            else
+            {
+                // Nothing changed - don't burn the GPU re-drawing it
+                SDL_Delay(1);
+            }
         }
     }
     else
@@ -78,11 +121,18 @@ bool App::reconnectToService()
         ClientPSMoveAPI::shutdown();
     }
 
-    bool success= 
+    bool success=
         ClientPSMoveAPI::startup(
-            PSMOVESERVICE_DEFAULT_ADDRESS, //###bwalker $TODO put in config 
-            PSMOVESERVICE_DEFAULT_PORT, //###bwalker $TODO put in config 
-            _log_severity_level_info); //###bwalker $TODO put in config 
+            PSMOVESERVICE_DEFAULT_ADDRESS, //###bwalker $TODO put in config
+            PSMOVESERVICE_DEFAULT_PORT, //###bwalker $TODO put in config
+            _log_severity_level_info); //###bwalker $TODO put in config
+
+    if (success)
+    {
+        // Controller data frames don't flow through the message queue -
+        // hook the data callback so fresh poses/sensor data invalidate the frame
+        ClientPSMoveAPI::register_controller_data_callback(mark_render_dirty_callback, this);
+    }
 
     return success;
 }
@@ -128,6 +178,8 @@ void App::setAppStage(const char *appStageName)
     {
         m_appStage->enter();
     }
+
+    markRenderDirty();
 }
 
 //-- private methods -----
@@ -268,6 +320,9 @@ void App::update()
             onClientPSMoveEvent(&message.event_data);
             break;
         }
+
+        // Any service traffic can change what's on screen
+        markRenderDirty();
     }
 
     // Update the current app stage last
@@ -277,7 +332,7 @@ void App::update()
     }
 }
 
-void App::render()
+void App::render(bool bIdleRepaint)
 {
     m_renderer->renderBegin();
 
@@ -288,12 +343,25 @@ void App::render()
     }
     m_renderer->renderStageEnd();
 
-    m_renderer->renderUIBegin();
-    if (m_appStage != NULL)
+    // On idle repaints replay the UI vertex stream cached from the last
+    // rebuilt frame rather than re-running the ImGui code for the screen
+    if (!bIdleRepaint || !m_renderer->renderUICached())
     {
-        m_appStage->renderUI();
+        m_renderer->renderUIBegin();
+        if (m_appStage != NULL)
+        {
+            m_appStage->renderUI();
+        }
+        m_renderer->renderUIEnd();
     }
-    m_renderer->renderUIEnd();
 
     m_renderer->renderEnd();
+}
+
+//-- private functions -----
+static void mark_render_dirty_callback(int controller_id, void *userdata)
+{
+    App *app= static_cast<App *>(userdata);
+
+    app->markRenderDirty();
 }
\ No newline at end of file
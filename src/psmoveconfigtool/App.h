@@ -8,6 +8,7 @@
 
 #include "Camera.h"
 
+#include <chrono>
 #include <map>
 #include <utility> // std::pair
 
@@ -39,6 +40,12 @@ public:
     inline void requestShutdown()
     { m_bShutdownRequested= true; }
 
+    // Flag that something visible changed (new device data, video frame, ...)
+    // and the next loop iteration should actually re-render.
+    // Input events and service messages mark the frame dirty automatically.
+    inline void markRenderDirty()
+    { m_bRenderDirty= true; }
+
     bool reconnectToService();
     void setCameraType(eCameraType cameraType);
     void setAppStage(const char *appStageName);
@@ -73,7 +80,9 @@ protected:
     void onClientPSMoveResponse(const ClientPSMoveAPI::ResponseMessage *response);
 
     void update();
-    void render();
+    // bIdleRepaint - nothing changed since the last frame; the UI half of
+    // the frame may be replayed from the renderer's draw data cache
+    void render(bool bIdleRepaint= false);
 
 private:
     // Contexts
@@ -106,6 +115,11 @@ private:
 
     // Flag requesting that we exit the update loop
     bool m_bShutdownRequested;
+
+    // Render invalidation state - when nothing is dirty the loop skips the
+    // GPU work and sleeps instead of re-rendering unchanged widgets
+    bool m_bRenderDirty;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_lastRenderTime;
 };
 
 #endif // APP_H
\ No newline at end of file
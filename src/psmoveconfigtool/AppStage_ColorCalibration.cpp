@@ -214,6 +214,9 @@ void AppStage_ColorCalibration::update()
     {
         if (m_trackerView->pollVideoStream())
         {
+            // New video frame - the preview texture is about to change
+            m_app->markRenderDirty();
+
             const int frameWidth = m_trackerView->getVideoFrameWidth();
             const int frameHeight = m_trackerView->getVideoFrameHeight();
             const unsigned char *video_buffer = m_trackerView->getVideoFrameBuffer();
@@ -544,6 +544,8 @@ void AppStage_ComputeTrackerPoses::update_tracker_video()
         {
             m_renderTrackerIter->second.textureAsset->copyBufferIntoTexture(
                 m_renderTrackerIter->second.trackerView->getVideoFrameBuffer());
+
+            m_app->markRenderDirty();
         }
     }
 }
@@ -891,9 +893,12 @@ void AppStage_ComputeTrackerPoses::request_tracker_start_stream(
     // Increment the number of requests we're waiting to get back
     ++m_pendingTrackerStartCount;
 
-    // Request data to start streaming to the tracker
+    // Request data to start streaming to the tracker.
+    // The tracker feeds here are just small previews, so the half resolution
+    // stream is plenty and keeps four simultaneous feeds cheap.
     ClientPSMoveAPI::register_callback(
-        ClientPSMoveAPI::start_tracker_data_stream(trackerState.trackerView),
+        ClientPSMoveAPI::start_tracker_data_stream(
+            trackerState.trackerView, ClientPSMoveAPI::halfResolutionVideo),
         AppStage_ComputeTrackerPoses::handle_tracker_start_stream_response, this);
 }
 
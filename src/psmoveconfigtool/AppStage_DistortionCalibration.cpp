@@ -23,6 +23,9 @@
 #include "opencv2/opencv.hpp"
 #include "opencv2/calib3d/calib3d.hpp"
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #ifdef _MSC_VER
@@ -155,101 +158,83 @@ public:
             cv::INTER_LINEAR, cv::BORDER_CONSTANT);
     }
 
-    void findAndAppendNewChessBoard(bool appWantsAppend)
+    // Fold a set of refined corners found by the detector thread into the
+    // capture state. The detection itself happens off the UI thread - this
+    // just runs the cheap stationary/new-location/straightness checks.
+    void handleChessBoardResult(const std::vector<cv::Point2f> &new_image_points, bool appWantsAppend)
     {
-        
+
         if (capturedBoardCount < DESIRED_CAPTURE_BOARD_COUNT)
         {
-            std::vector<cv::Point2f> new_image_points;
-
-            // Find chessboard corners:
-            if (cv::findChessboardCorners(
-                    *gsBuffer, 
-                    cv::Size(PATTERN_W, PATTERN_H), 
-                    new_image_points, // output corners
-                    cv::CALIB_CB_ADAPTIVE_THRESH 
-                    + cv::CALIB_CB_FILTER_QUADS 
-                    // + cv::CALIB_CB_NORMALIZE_IMAGE is suuuper slow
-                    + cv::CALIB_CB_FAST_CHECK))
+            // Append the new chessboard corner pixels into the image_points matrix
+            // Append the corresponding 3d chessboard corners into the object_points matrix
+            if (new_image_points.size() == CORNER_COUNT)
             {
-                // Get subpixel accuracy on those corners
-                cv::cornerSubPix(
-                    *gsBuffer, 
-                    new_image_points, // corners to refine
-                    cv::Size(11, 11), // winSize- Half of the side length of the search window
-                    cv::Size(-1, -1), // zeroZone- (-1,-1) means no dead zone in search
-                    cv::TermCriteria(cv::TermCriteria::EPS + cv::TermCriteria::MAX_ITER, 30, 0.1));
-
-                // Append the new chessboard corner pixels into the image_points matrix
-                // Append the corresponding 3d chessboard corners into the object_points matrix
-                if (new_image_points.size() == CORNER_COUNT) 
+                bCurrentImagePointsValid= false;
+                // See if the board is stationary (didn't move much since last frame)
+                if (currentImagePoints.size() > 0)
                 {
-                    bCurrentImagePointsValid= false;
-                    // See if the board is stationary (didn't move much since last frame)
-                    if (currentImagePoints.size() > 0)
+                    float error_sum= 0.f;
+
+                    for (int corner_index= 0; corner_index < CORNER_COUNT; ++corner_index)
                     {
-                        float error_sum= 0.f;
+                        float squared_error= static_cast<float>(cv::norm(new_image_points[corner_index] - currentImagePoints[corner_index]));
 
-                        for (int corner_index= 0; corner_index < CORNER_COUNT; ++corner_index)
-                        {
-                            float squared_error= static_cast<float>(cv::norm(new_image_points[corner_index] - currentImagePoints[corner_index]));
+                        error_sum+= squared_error;
+                    }
 
-                            error_sum+= squared_error;
-                        }
+                    bCurrentImagePointsValid= error_sum <= BOARD_MOVED_ERROR_SUM;
+                }
+                else
+                {
+                    // We don't have previous capture.
+                    bCurrentImagePointsValid= true;
+                }
 
-                        bCurrentImagePointsValid= error_sum <= BOARD_MOVED_ERROR_SUM;
-                    }
-                    else
+                // See if the board moved far enough from the last valid location
+                if (bCurrentImagePointsValid)
+                {
+                    if (lastValidImagePoints.size() > 0)
                     {
-                        // We don't have previous capture.
-                        bCurrentImagePointsValid= true;
-                    }
+                        float error_sum= 0.f;
 
-                    // See if the board moved far enough from the last valid location
-                    if (bCurrentImagePointsValid)
-                    {
-                        if (lastValidImagePoints.size() > 0)
+                        for (int corner_index= 0; corner_index < CORNER_COUNT; ++corner_index)
                         {
-                            float error_sum= 0.f;
-
-                            for (int corner_index= 0; corner_index < CORNER_COUNT; ++corner_index)
-                            {
-                                float squared_error= static_cast<float>(cv::norm(new_image_points[corner_index] - lastValidImagePoints[corner_index]));
+                            float squared_error= static_cast<float>(cv::norm(new_image_points[corner_index] - lastValidImagePoints[corner_index]));
 
-                                error_sum+= squared_error;
-                            }
-
-                            bCurrentImagePointsValid= error_sum >= BOARD_NEW_LOCATION_ERROR_SUM;
+                            error_sum+= squared_error;
                         }
-                    }
 
-                    if (bCurrentImagePointsValid)
-                    {
-                        bCurrentImagePointsValid= areGridLinesStraight(new_image_points);
+                        bCurrentImagePointsValid= error_sum >= BOARD_NEW_LOCATION_ERROR_SUM;
                     }
+                }
 
-                    // If it's a valid new location, append it to the board list
-                    if (bCurrentImagePointsValid && appWantsAppend)
-                    {
-                        // Keep track of the corners of all of the chessboards we sample
-                        quadList.push_back(new_image_points[0]);
-                        quadList.push_back(new_image_points[PATTERN_W - 1]);
-                        quadList.push_back(new_image_points[CORNER_COUNT-1]);
-                        quadList.push_back(new_image_points[CORNER_COUNT-PATTERN_W]);                        
+                if (bCurrentImagePointsValid)
+                {
+                    bCurrentImagePointsValid= areGridLinesStraight(new_image_points);
+                }
 
-                        // Append the new images points and object points
-                        imagePointsList.push_back(new_image_points);
+                // If it's a valid new location, append it to the board list
+                if (bCurrentImagePointsValid && appWantsAppend)
+                {
+                    // Keep track of the corners of all of the chessboards we sample
+                    quadList.push_back(new_image_points[0]);
+                    quadList.push_back(new_image_points[PATTERN_W - 1]);
+                    quadList.push_back(new_image_points[CORNER_COUNT-1]);
+                    quadList.push_back(new_image_points[CORNER_COUNT-PATTERN_W]);                        
 
-                        // Remember the last valid captured points
-                        lastValidImagePoints= currentImagePoints;
+                    // Append the new images points and object points
+                    imagePointsList.push_back(new_image_points);
 
-                        // Keep track of how many boards have been captured so far
-                        capturedBoardCount++;
-                    }
+                    // Remember the last valid captured points
+                    lastValidImagePoints= currentImagePoints;
 
-                    // Remember the last set of valid corners
-                    currentImagePoints= new_image_points;
+                    // Keep track of how many boards have been captured so far
+                    capturedBoardCount++;
                 }
+
+                // Remember the last set of valid corners
+                currentImagePoints= new_image_points;
             }
         }
     }
@@ -375,6 +360,173 @@ public:
     cv::Mat *distortionMapY;
 };
 
+// Runs chessboard corner detection off the UI thread so that the video
+// preview keeps its frame rate while the operator lines up board poses.
+// The input slot holds at most one frame - a newer frame always replaces
+// an older one the worker hasn't picked up yet (latest-frame-wins).
+class ChessboardDetectorThread
+{
+public:
+    ChessboardDetectorThread()
+        : m_bExitThread(false)
+        , m_bHasPendingFrame(false)
+        , m_bHasResult(false)
+        , m_bResultFound(false)
+    {
+        m_workerThread= std::thread(&ChessboardDetectorThread::workerThreadFunc, this);
+    }
+
+    ~ChessboardDetectorThread()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_bExitThread= true;
+        }
+        m_frameAvailableCondition.notify_one();
+        m_workerThread.join();
+    }
+
+    // Hand the latest grayscale frame to the worker, replacing any frame
+    // it hasn't started on yet
+    void submitFrame(const cv::Mat &gsFrame)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            gsFrame.copyTo(m_pendingFrame);
+            m_bHasPendingFrame= true;
+        }
+        m_frameAvailableCondition.notify_one();
+    }
+
+    // Fetch the most recently completed detection, if there is a fresh one.
+    // Returns false when the worker hasn't finished a new frame yet.
+    bool pollResult(bool &out_found, std::vector<cv::Point2f> &out_image_points)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        bool bHadResult= m_bHasResult;
+
+        if (bHadResult)
+        {
+            out_found= m_bResultFound;
+            out_image_points= m_resultImagePoints;
+            m_bHasResult= false;
+        }
+
+        return bHadResult;
+    }
+
+protected:
+    void workerThreadFunc()
+    {
+        cv::Mat gsFrame;
+
+        while (true)
+        {
+            // Wait for a frame to show up in the input slot
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+
+                m_frameAvailableCondition.wait(
+                    lock, [this]{ return m_bHasPendingFrame || m_bExitThread; });
+
+                if (m_bExitThread)
+                {
+                    break;
+                }
+
+                m_pendingFrame.copyTo(gsFrame);
+                m_bHasPendingFrame= false;
+            }
+
+            // Run the detection outside the lock
+            std::vector<cv::Point2f> image_points;
+            const bool bFound= findChessboard(gsFrame, image_points);
+
+            // Publish the result for the UI thread to pick up
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+
+                m_bResultFound= bFound;
+                m_resultImagePoints= image_points;
+                m_bHasResult= true;
+            }
+        }
+    }
+
+    static bool findChessboard(const cv::Mat &gsFrame, std::vector<cv::Point2f> &out_image_points)
+    {
+        const int detection_flags=
+            cv::CALIB_CB_ADAPTIVE_THRESH
+            + cv::CALIB_CB_FILTER_QUADS
+            // + cv::CALIB_CB_NORMALIZE_IMAGE is suuuper slow
+            + cv::CALIB_CB_FAST_CHECK;
+
+        bool bFound= false;
+
+        // Look for the board in a half resolution image first -
+        // a quarter of the pixels to threshold and walk
+        cv::Mat gsHalfFrame;
+        cv::pyrDown(gsFrame, gsHalfFrame);
+
+        std::vector<cv::Point2f> half_image_points;
+        if (cv::findChessboardCorners(
+                gsHalfFrame,
+                cv::Size(PATTERN_W, PATTERN_H),
+                half_image_points, // output corners
+                detection_flags))
+        {
+            // Scale the corners back up to full resolution coordinates.
+            // cornerSubPix below recovers the precision lost to the downscale.
+            for (const cv::Point2f &corner : half_image_points)
+            {
+                out_image_points.push_back(corner * 2.f);
+            }
+
+            bFound= true;
+        }
+        else
+        {
+            // A distant or oblique board can fail the half resolution pass -
+            // fall back to a full resolution search
+            bFound=
+                cv::findChessboardCorners(
+                    gsFrame,
+                    cv::Size(PATTERN_W, PATTERN_H),
+                    out_image_points, // output corners
+                    detection_flags);
+        }
+
+        if (bFound)
+        {
+            // Get subpixel accuracy on those corners
+            cv::cornerSubPix(
+                gsFrame,
+                out_image_points, // corners to refine
+                cv::Size(11, 11), // winSize- Half of the side length of the search window
+                cv::Size(-1, -1), // zeroZone- (-1,-1) means no dead zone in search
+                cv::TermCriteria(cv::TermCriteria::EPS + cv::TermCriteria::MAX_ITER, 30, 0.1));
+        }
+
+        return bFound;
+    }
+
+private:
+    std::thread m_workerThread;
+    std::mutex m_mutex;
+    std::condition_variable m_frameAvailableCondition;
+    bool m_bExitThread;
+
+    // Single-entry input slot
+    cv::Mat m_pendingFrame;
+    bool m_bHasPendingFrame;
+
+    // Most recently completed detection
+    bool m_bHasResult;
+    bool m_bResultFound;
+    std::vector<cv::Point2f> m_resultImagePoints;
+};
+
 //-- public methods -----
 AppStage_DistortionCalibration::AppStage_DistortionCalibration(App *app)
     : AppStage(app)
@@ -387,6 +539,7 @@ AppStage_DistortionCalibration::AppStage_DistortionCalibration(App *app)
     , m_tracker_view(nullptr)
     , m_video_texture(nullptr)
     , m_opencv_state(nullptr)
+    , m_chessboard_detector(nullptr)
 { }
 
 void AppStage_DistortionCalibration::enter()
@@ -411,6 +564,13 @@ void AppStage_DistortionCalibration::exit()
 {
     m_menuState = AppStage_DistortionCalibration::inactive;
 
+    // Shut down the detector thread before freeing the buffers it reads from
+    if (m_chessboard_detector != nullptr)
+    {
+        delete m_chessboard_detector;
+        m_chessboard_detector= nullptr;
+    }
+
     if (m_opencv_state != nullptr)
     {
         delete m_opencv_state;
@@ -457,12 +617,24 @@ void AppStage_DistortionCalibration::update()
                 break;
             }
 
+            m_app->markRenderDirty();
+
             if (m_menuState == AppStage_DistortionCalibration::capture)
             {
-                
-                // Update the chess board capture state
-                ImGuiIO io_state = ImGui::GetIO();
-                m_opencv_state->findAndAppendNewChessBoard(io_state.KeysDown[32]);
+                // Queue the latest grayscale frame for the detector thread.
+                // A newer frame replaces any the worker hasn't started on yet.
+                m_chessboard_detector->submitFrame(*m_opencv_state->gsBuffer);
+
+                // Pick up whatever detection the worker finished since the last frame
+                bool bFoundChessboard= false;
+                std::vector<cv::Point2f> new_image_points;
+
+                if (m_chessboard_detector->pollResult(bFoundChessboard, new_image_points) && bFoundChessboard)
+                {
+                    // Update the chess board capture state
+                    ImGuiIO io_state = ImGui::GetIO();
+                    m_opencv_state->handleChessBoardResult(new_image_points, io_state.KeysDown[32]);
+                }
 
                 if (m_opencv_state->capturedBoardCount >= DESIRED_CAPTURE_BOARD_COUNT)
                 {
@@ -881,9 +1053,12 @@ void AppStage_DistortionCalibration::handle_tracker_start_stream_response(
                     GL_BGR, // buffer format
                     nullptr);
 
-                // Allocate an opencv buffer 
+                // Allocate an opencv buffer
                 thisPtr->m_opencv_state = new OpenCVBufferState(trackerInfo);
 
+                // Spin up the chessboard detector worker thread
+                thisPtr->m_chessboard_detector = new ChessboardDetectorThread();
+
 				// Warn the user if they are about to change the distortion calibration settings for the PS3EYE
 				if (trackerInfo.tracker_type == eTrackerType::PS3Eye)
 				{
@@ -86,6 +86,7 @@ private:
     class ClientTrackerView *m_tracker_view;
     class TextureAsset *m_video_texture;
     class OpenCVBufferState *m_opencv_state;
+    class ChessboardDetectorThread *m_chessboard_detector;
 };
 
 #endif // APP_STAGE_DISTORTION_CALIBRATION_H
\ No newline at end of file
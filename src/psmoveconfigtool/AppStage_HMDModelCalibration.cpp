@@ -33,6 +33,7 @@
 namespace SICP
 {
 	typedef Eigen::Matrix<double, 3, Eigen::Dynamic> Vertices;
+	typedef nanoflann::KDTreeAdaptor<Vertices, 3, nanoflann::metric_L2_Simple> VerticesKdtree;
 };
 
 //-- statics ----
@@ -163,6 +164,7 @@ public:
 		, m_ledSampleSet(new LEDModelSamples[trackerLEDCount])
 		, m_seenLEDCount(0)
 		, m_totalLEDSampleCount(0)
+		, m_icpTargetKdtree(nullptr)
 	{
 		m_icpTransform = Eigen::Affine3d::Identity();
 
@@ -174,6 +176,7 @@ public:
 
 	~HMDModelState()
 	{
+		delete m_icpTargetKdtree;
 		delete[] m_ledSampleSet;
 	}
 
@@ -214,23 +217,23 @@ public:
 						icpSourceVertices(2, source_index) = point.z();
 					}
 
-					// Build kd-tree of the current set of target vertices
-					nanoflann::KDTreeAdaptor<SICP::Vertices, 3, nanoflann::metric_L2_Simple> kdtree(m_icpTargetVertices);
-
 					// Attempt to align the new triangulated points with the previously found LED locations
-					// using the ICP algorithm
+					// using the ICP algorithm.
+					// The kd-tree over the target vertices is built in rebuildTargetVertices()
+					// and shared with the correspondence searches below, rather than rebuilt
+					// from scratch for every recorded sample.
 					SICP::Parameters params;
 					params.p = .5;
 					params.max_icp = 15;
 					params.print_icpn = true;
-					SICP::point_to_point(icpSourceVertices, m_icpTargetVertices, params);
+					SICP::point_to_point(icpSourceVertices, m_icpTargetVertices, *m_icpTargetKdtree, params);
 
 					// Update the LED models based on the alignment
 					bool bUpdateTargetVertices = false;
 					for (int source_index = 0; source_index < icpSourceVertices.cols(); ++source_index)
 					{
 						const Eigen::Vector3d source_vertex = icpSourceVertices.col(source_index).cast<double>();
-						const int closest_led_index = kdtree.closest(source_vertex.data());
+						const int closest_led_index = m_icpTargetKdtree->closest(source_vertex.data());
 						const Eigen::Vector3d closest_led_position = m_ledSampleSet[closest_led_index].average_position.cast<double>();
 						const double cloest_distance_sqrd = (closest_led_position - source_vertex).squaredNorm();
 
@@ -329,6 +332,12 @@ protected:
 			m_icpTargetVertices(1, led_index) = ledSample.y();
 			m_icpTargetVertices(2, led_index) = ledSample.z();
 		}
+
+		// Rebuild the kd-tree over the new target vertices.
+		// This only happens when the LED model changes, so sample frames
+		// in between get the tree for free.
+		delete m_icpTargetKdtree;
+		m_icpTargetKdtree = new SICP::VerticesKdtree(m_icpTargetVertices);
 	}
 
 private:
@@ -340,6 +349,7 @@ private:
 	LEDModelSamples *m_ledSampleSet;
 
 	SICP::Vertices m_icpTargetVertices;
+	SICP::VerticesKdtree *m_icpTargetKdtree;
 	Eigen::Affine3d m_icpTransform;
 };
 
@@ -820,6 +830,8 @@ void AppStage_HMDModelCalibration::update_tracker_video()
 		trackerState.trackerView->pollVideoStream())
 	{
 		trackerState.textureAsset->copyBufferIntoTexture(trackerState.trackerView->getVideoFrameBuffer());
+
+		m_app->markRenderDirty();
 	}
 }
 
@@ -32,6 +32,7 @@ static const double k_stabilize_wait_time_ms= 1000.f;
 static const int k_max_identity_magnetometer_samples= 100;
 static const int k_min_sample_distance= 20;
 static const int k_min_sample_distance_sq= k_min_sample_distance*k_min_sample_distance;
+static const int k_incremental_refit_sample_interval= 10;
 
 enum eEllipseFitMethod
 {
@@ -55,6 +56,10 @@ struct MagnetometerBoundsStatistics
     EigenFitEllipsoid sampleFitEllipsoid;
     int ellipseFitMethod;
 
+    // Running scatter matrix for the incremental least squares ellipsoid fit.
+    // Updated in O(1) per sample so the live preview never re-walks the sample set.
+    Eigen::Matrix<double, 10, 10> ellipsoidFitScatter;
+
 	MagnetometerBoundsStatistics()
 		: sampleCount(0)
 		, samplePercentage(0)
@@ -79,6 +84,7 @@ struct MagnetometerBoundsStatistics
 		maxSampleExtent= *k_psmove_int_vector3_zero;
 
 		sampleFitEllipsoid.clear();
+		eigen_alignment_ellipsoid_fit_scatter_reset(ellipsoidFitScatter);
 	}
 
 	bool addSample(const PSMoveIntVector3 &sample)
@@ -111,6 +117,10 @@ struct MagnetometerBoundsStatistics
             magnetometerEigenSamples[sampleCount] = psmove_int_vector3_to_eigen_vector3(sample);
             ++sampleCount;
 
+            // Fold the sample into the running least squares scatter matrix
+            eigen_alignment_ellipsoid_fit_scatter_add_sample(
+                ellipsoidFitScatter, magnetometerEigenSamples[sampleCount - 1]);
+
             // Compute a best fit ellipsoid for the sample points
             switch (ellipseFitMethod)
             {
@@ -119,8 +129,24 @@ struct MagnetometerBoundsStatistics
                     magnetometerEigenSamples, sampleCount, sampleFitEllipsoid);
                 break;
             case _ellipse_fit_method_min_volume:
-                eigen_alignment_fit_min_volume_ellipsoid(
-                    magnetometerEigenSamples, sampleCount, 0.0001f, sampleFitEllipsoid);
+                // The exact min volume fit is too expensive to re-run per sample.
+                // Drive the live preview off the incremental least squares fit
+                // instead, refreshed every few samples and on the final one.
+                // The exact fit can still be requested from the fitting mode UI.
+                if ((sampleCount % k_incremental_refit_sample_interval) == 0 || getIsComplete())
+                {
+                    EigenFitEllipsoid leastSquaresEllipsoid;
+
+                    if (eigen_alignment_fit_least_squares_ellipsoid(
+                            ellipsoidFitScatter, leastSquaresEllipsoid))
+                    {
+                        leastSquaresEllipsoid.error =
+                            eigen_alignment_compute_ellipsoid_fit_error(
+                                magnetometerEigenSamples, sampleCount, leastSquaresEllipsoid);
+                        sampleFitEllipsoid = leastSquaresEllipsoid;
+                    }
+                    // else: too few/degenerate samples - keep the previous fit
+                }
                 break;
             }
 
@@ -71,6 +71,9 @@ void AppStage_TestTracker::update()
         if (m_tracker_view->pollVideoStream())
         {
             m_video_texture->copyBufferIntoTexture(m_tracker_view->getVideoFrameBuffer());
+
+            // A fresh video frame means the preview needs a repaint
+            m_app->markRenderDirty();
         }
     }
 }
@@ -20,11 +20,14 @@
 const char *AppStage_TrackerSettings::APP_STAGE_NAME= "CameraSettings";
 
 //-- constants -----
+// How often the tracker settings screen refreshes the per-thread CPU bars
+static const float k_service_statistics_interval_seconds = 1.f;
 
 //-- public methods -----
-AppStage_TrackerSettings::AppStage_TrackerSettings(App *app) 
+AppStage_TrackerSettings::AppStage_TrackerSettings(App *app)
     : AppStage(app)
     , m_menuState(AppStage_TrackerSettings::inactive)
+    , m_bPendingServiceStatistics(false)
     , m_selectedTrackerIndex(-1)
 	, m_selectedControllerIndex(-1)
 	, m_selectedHmdIndex(-1)
@@ -43,6 +46,18 @@ void AppStage_TrackerSettings::exit()
 
 void AppStage_TrackerSettings::update()
 {
+    // Keep the per-thread CPU utilization bars live while the screen is idle
+    if (m_menuState == AppStage_TrackerSettings::idle)
+    {
+        std::chrono::time_point<std::chrono::high_resolution_clock> now = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<float> timeSinceLastRequest = now - m_lastStatisticsRequestTime;
+
+        if (!m_bPendingServiceStatistics &&
+            timeSinceLastRequest.count() >= k_service_statistics_interval_seconds)
+        {
+            request_service_statistics();
+        }
+    }
 }
     
 void AppStage_TrackerSettings::render()
@@ -58,6 +73,7 @@ void AppStage_TrackerSettings::render()
             switch (trackerInfo.tracker_type)
             {
             case PSMoveProtocol::PS3EYE:
+            case PSMoveProtocol::VIRTUAL_TRACKER: // reuse the PS3Eye model for synthetic trackers
                 {
                     glm::mat4 scale3 = glm::scale(glm::mat4(1.f), glm::vec3(3.f, 3.f, 3.f));
                     drawPS3EyeModel(scale3);
@@ -127,7 +143,7 @@ void AppStage_TrackerSettings::renderUI()
     case eTrackerMenuState::idle:
     {
         ImGui::SetNextWindowPosCenter();
-        ImGui::SetNextWindowSize(ImVec2(300, 400));
+        ImGui::SetNextWindowSize(ImVec2(300, 500));
         ImGui::Begin(k_window_title, nullptr, window_flags);
 
         //###HipsterSloth $TODO The tracker restart currently takes longer than it does
@@ -170,6 +186,10 @@ void AppStage_TrackerSettings::renderUI()
                 {
                     ImGui::BulletText("Controller Type: PS3 Eye");
                 } break;
+            case eTrackerType::VirtualTracker:
+                {
+                    ImGui::BulletText("Controller Type: Virtual Tracker");
+                } break;
             default:
                 assert(0 && "Unreachable");
             }
@@ -354,6 +374,19 @@ void AppStage_TrackerSettings::renderUI()
 			}
         }
 
+        if (m_threadCpuInfos.size() > 0)
+        {
+            ImGui::Separator();
+            ImGui::Text("Service Thread CPU");
+
+            for (const ThreadCpuInfo &threadCpuInfo : m_threadCpuInfos)
+            {
+                ImGui::ProgressBar(threadCpuInfo.CpuFraction, ImVec2(120, 14));
+                ImGui::SameLine();
+                ImGui::Text("%s", threadCpuInfo.ThreadName.c_str());
+            }
+        }
+
         ImGui::Separator();
 
         if (ImGui::Button("Return to Main Menu"))
@@ -674,3 +707,58 @@ void AppStage_TrackerSettings::handle_search_for_new_trackers_response(
 
     thisPtr->request_tracker_list();
 }
+
+void AppStage_TrackerSettings::request_service_statistics()
+{
+    m_bPendingServiceStatistics = true;
+    m_lastStatisticsRequestTime = std::chrono::high_resolution_clock::now();
+
+    // Ask the psmove service for its runtime statistics (we only use the per-thread CPU samples here)
+    RequestPtr request(new PSMoveProtocol::Request());
+    request->set_type(PSMoveProtocol::Request_RequestType_GET_SERVICE_STATISTICS);
+
+    ClientPSMoveAPI::register_callback(
+        ClientPSMoveAPI::send_opaque_request(&request),
+        AppStage_TrackerSettings::handle_service_statistics_response, this);
+}
+
+void AppStage_TrackerSettings::handle_service_statistics_response(
+    const ClientPSMoveAPI::ResponseMessage *response_message,
+    void *userdata)
+{
+    AppStage_TrackerSettings *thisPtr = static_cast<AppStage_TrackerSettings *>(userdata);
+
+    const ClientPSMoveAPI::eClientPSMoveResultCode ResultCode = response_message->result_code;
+    const ClientPSMoveAPI::t_response_handle response_handle = response_message->opaque_response_handle;
+
+    thisPtr->m_bPendingServiceStatistics = false;
+
+    switch (ResultCode)
+    {
+    case ClientPSMoveAPI::_clientPSMoveResultCode_ok:
+        {
+            const PSMoveProtocol::Response *response = GET_PSMOVEPROTOCOL_RESPONSE(response_handle);
+            const auto &statistics = response->result_service_statistics();
+
+            thisPtr->m_threadCpuInfos.clear();
+
+            for (int thread_index = 0; thread_index < statistics.thread_cpu_usage_size(); ++thread_index)
+            {
+                const auto &ThreadCpuResponse = statistics.thread_cpu_usage(thread_index);
+
+                AppStage_TrackerSettings::ThreadCpuInfo ThreadCpuInfo;
+
+                ThreadCpuInfo.ThreadName = ThreadCpuResponse.thread_name();
+                ThreadCpuInfo.CpuFraction = ThreadCpuResponse.cpu_fraction();
+
+                thisPtr->m_threadCpuInfos.push_back(ThreadCpuInfo);
+            }
+        } break;
+
+    case ClientPSMoveAPI::_clientPSMoveResultCode_error:
+    case ClientPSMoveAPI::_clientPSMoveResultCode_canceled:
+        {
+            // Keep showing the last good samples; the next interval will retry
+        } break;
+    }
+}
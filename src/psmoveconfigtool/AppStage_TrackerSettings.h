@@ -5,6 +5,8 @@
 #include "AppStage.h"
 #include "ClientTrackerView.h"
 
+#include <chrono>
+
 //-- definitions -----
 class AppStage_TrackerSettings : public AppStage
 {
@@ -23,6 +25,12 @@ public:
 		ClientHMDView::eHMDViewType HmdType;
 	};
 
+	struct ThreadCpuInfo
+	{
+		std::string ThreadName;
+		float CpuFraction;
+	};
+
     AppStage_TrackerSettings(class App *app);
 
     inline const ClientTrackerInfo *getSelectedTrackerInfo() const
@@ -67,6 +75,11 @@ protected:
         const ClientPSMoveAPI::ResponseMessage *response,
         void *userdata);
 
+    void request_service_statistics();
+    static void handle_service_statistics_response(
+        const ClientPSMoveAPI::ResponseMessage *response_message,
+        void *userdata);
+
 	const ControllerInfo *get_selected_controller();
 	const HMDInfo *get_selected_hmd();
 
@@ -90,6 +103,11 @@ protected:
 	std::vector<ControllerInfo> m_controllerInfos;
 	std::vector<HMDInfo> m_hmdInfos;
 
+	// Per-thread service CPU usage refreshed by a periodic GET_SERVICE_STATISTICS request
+	std::vector<ThreadCpuInfo> m_threadCpuInfos;
+	bool m_bPendingServiceStatistics;
+	std::chrono::time_point<std::chrono::high_resolution_clock> m_lastStatisticsRequestTime;
+
     int m_selectedTrackerIndex;
 	int m_selectedControllerIndex;
 	int m_selectedHmdIndex;
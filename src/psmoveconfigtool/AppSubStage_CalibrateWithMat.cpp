@@ -22,6 +22,7 @@
 #include "opencv2/calib3d/calib3d.hpp"
 
 #include <imgui.h>
+#include <thread>
 #include <vector>
 
 //-- constants -----
@@ -146,6 +147,8 @@ struct TrackerRelativePoseStatistics
 //-- private methods -----
 static bool computeTrackerCameraPose(
     const ClientTrackerView *trackerView,
+    const std::vector<cv::Point3f> &cvObjectPoints,
+    const cv::Mat &cvDistCoeffs,
     TrackerRelativePoseStatistics &trackerCoregData);
 
 //-- public methods -----
@@ -295,16 +298,58 @@ void AppSubStage_CalibrateWithMat::update()
         {
             bool bSuccess = true;
 
-            // Compute and the pose transform for each tracker
+            // The sample locations on the mat and the distortion coefficients
+            // are the same for every tracker - build them once up front
+            std::vector<cv::Point3f> cvObjectPoints;
+            for (int locationIndex = 0; locationIndex < k_mat_sample_location_count; ++locationIndex)
+            {
+                const PSMovePosition &worldPoint = k_sample_3d_locations[locationIndex];
+
+                // Add in the psmove calibration origin offset
+                cvObjectPoints.push_back(cv::Point3f(worldPoint.x, worldPoint.y, worldPoint.z));
+            }
+
+            // Assume no distortion
+            // TODO: Probably should get the distortion coefficients out of the tracker
+            cv::Mat cvDistCoeffs(4, 1, cv::DataType<float>::type);
+            cvDistCoeffs.at<float>(0) = 0;
+            cvDistCoeffs.at<float>(1) = 0;
+            cvDistCoeffs.at<float>(2) = 0;
+            cvDistCoeffs.at<float>(3) = 0;
+
+            // Dispatch the pose solve for each tracker on its own thread.
+            // Each solve only reads its own sample statistics and writes its
+            // own result block so they are independent of one another.
+            std::vector<std::thread> solverThreads;
             for (AppStage_ComputeTrackerPoses::t_tracker_state_map_iterator iter = m_parentStage->m_trackerViews.begin();
-                bSuccess && iter != m_parentStage->m_trackerViews.end();
+                iter != m_parentStage->m_trackerViews.end();
                 ++iter)
             {
                 const int trackerIndex = iter->second.listIndex;
                 const ClientTrackerView *trackerView = iter->second.trackerView;
-                TrackerRelativePoseStatistics &trackerSampleData = *m_psmoveTrackerPoseStats[trackerIndex];
+                TrackerRelativePoseStatistics *trackerSampleData = m_psmoveTrackerPoseStats[trackerIndex];
+
+                solverThreads.push_back(
+                    std::thread(
+                        [trackerView, &cvObjectPoints, &cvDistCoeffs, trackerSampleData]{
+                            computeTrackerCameraPose(
+                                trackerView, cvObjectPoints, cvDistCoeffs, *trackerSampleData);
+                        }));
+            }
 
-                bSuccess&= computeTrackerCameraPose(trackerView, trackerSampleData);
+            // Wait for all of the solves to finish, then check the results
+            for (std::thread &solverThread : solverThreads)
+            {
+                solverThread.join();
+            }
+
+            for (AppStage_ComputeTrackerPoses::t_tracker_state_map_iterator iter = m_parentStage->m_trackerViews.begin();
+                iter != m_parentStage->m_trackerViews.end();
+                ++iter)
+            {
+                const int trackerIndex = iter->second.listIndex;
+
+                bSuccess&= m_psmoveTrackerPoseStats[trackerIndex]->bValidTrackerPose;
             }
 
             if (bSuccess)
@@ -581,6 +626,8 @@ void AppSubStage_CalibrateWithMat::onEnterState(
 static bool
 computeTrackerCameraPose(
     const ClientTrackerView *trackerView,
+    const std::vector<cv::Point3f> &cvObjectPoints,
+    const cv::Mat &cvDistCoeffs,
     TrackerRelativePoseStatistics &trackerCoregData)
 {
     // Get the pixel width and height of the tracker image
@@ -590,32 +637,19 @@ computeTrackerCameraPose(
     const PSMoveMatrix3x3 cameraMatrix = trackerView->getTrackerIntrinsicMatrix();
     cv::Matx33f cvCameraMatrix = psmove_matrix3x3_to_cv_mat33f(cameraMatrix);
 
-    // Copy the object/image point mappings into OpenCV format
-    std::vector<cv::Point3f> cvObjectPoints;
+    // Copy this tracker's image points into OpenCV format.
+    // The matching object points are shared across trackers and passed in.
     std::vector<cv::Point2f> cvImagePoints;
     for (int locationIndex = 0; locationIndex < k_mat_sample_location_count; ++locationIndex)
     {
         const PSMoveScreenLocation &screenPoint =
             trackerCoregData.avgScreenSpacePointAtLocation[locationIndex];
-        const PSMovePosition &worldPoint =
-            k_sample_3d_locations[locationIndex];
-
-        // Add in the psmove calibration origin offset
-        cvObjectPoints.push_back(cv::Point3f(worldPoint.x, worldPoint.y, worldPoint.z));
 
 		//###HipsterSloth $TODO for some reason I need to invert the y points to get the correct tracker locations
 		// I suspect this has something to do with how I am constructing the intrinsic matrix
         cvImagePoints.push_back(cv::Point2f(screenPoint.x, trackerPixelDimensions.j - screenPoint.y));
     }
 
-    // Assume no distortion
-    // TODO: Probably should get the distortion coefficients out of the tracker
-    cv::Mat cvDistCoeffs(4, 1, cv::DataType<float>::type);
-    cvDistCoeffs.at<float>(0) = 0;
-    cvDistCoeffs.at<float>(1) = 0;
-    cvDistCoeffs.at<float>(2) = 0;
-    cvDistCoeffs.at<float>(3) = 0;
-
     // Solve the Project N-Point problem:
     // Given a set of 3D points and their corresponding 2D pixel projections,
     // solve for the cameras position and orientation that would allow
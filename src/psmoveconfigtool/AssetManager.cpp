@@ -1,5 +1,6 @@
 //-- includes -----
 #include "AssetManager.h"
+#include "GlExtensions.h"
 #include "Logger.h"
 
 #define STB_TRUETYPE_IMPLEMENTATION
@@ -19,6 +20,21 @@ static const char *k_psnavi_texture_filename= "./assets/textures/PSNaviDiffuse.j
 static const char *k_psdualshock4_texture_filename = "./assets/textures/PSDS4Diffuse.jpg";
 static const char *k_morpheus_texture_filename = "./assets/textures/MorpheusDiffuse.jpg";
 
+static const char *k_psmovebody_mesh_filename= "./assets/models/psmovebody.psmesh";
+static const char *k_psmovebulb_mesh_filename= "./assets/models/psmovebulb.psmesh";
+static const char *k_psnavi_mesh_filename= "./assets/models/psnavi.psmesh";
+static const char *k_ds4body_mesh_filename= "./assets/models/ds4body.psmesh";
+static const char *k_ds4lightbar_mesh_filename= "./assets/models/ds4lightbar.psmesh";
+static const char *k_morpheus_mesh_filename= "./assets/models/morpheus.psmesh";
+static const char *k_ps3eye_mesh_filename= "./assets/models/ps3eye.psmesh";
+
+// .psmesh binary header - see source_assets/model_header_to_psmesh.py
+static const unsigned int k_psmesh_magic= 0x484D5350; // 'PSMH'
+static const unsigned int k_psmesh_version= 1;
+static const unsigned int k_psmesh_flag_has_normals= 0x1;
+static const unsigned int k_psmesh_flag_has_texcoords= 0x2;
+static const unsigned int k_psmesh_max_vertex_count= 4*(1<<20);
+
 static const char *k_default_font_filename= "./assets/fonts/OpenSans-Regular.ttf";
 static const float k_default_font_pixel_height= 24.f;
 
@@ -37,6 +53,13 @@ AssetManager::AssetManager()
     , m_psnaviTexture()
     , m_psdualshock4Texture()
     , m_morpheusTexture()
+    , m_psmovebodyMesh()
+    , m_psmovebulbMesh()
+    , m_psnaviMesh()
+    , m_ds4bodyMesh()
+    , m_ds4lightbarMesh()
+    , m_morpheusMesh()
+    , m_ps3eyeMesh()
     , m_defaultFont()
 {
 }
@@ -69,7 +92,42 @@ bool AssetManager::init()
     {
         success = loadTexture(k_morpheus_texture_filename, &m_morpheusTexture);
     }
-    
+
+    if (success)
+    {
+        success= loadMesh(k_psmovebody_mesh_filename, &m_psmovebodyMesh);
+    }
+
+    if (success)
+    {
+        success= loadMesh(k_psmovebulb_mesh_filename, &m_psmovebulbMesh);
+    }
+
+    if (success)
+    {
+        success= loadMesh(k_psnavi_mesh_filename, &m_psnaviMesh);
+    }
+
+    if (success)
+    {
+        success= loadMesh(k_ds4body_mesh_filename, &m_ds4bodyMesh);
+    }
+
+    if (success)
+    {
+        success= loadMesh(k_ds4lightbar_mesh_filename, &m_ds4lightbarMesh);
+    }
+
+    if (success)
+    {
+        success= loadMesh(k_morpheus_mesh_filename, &m_morpheusMesh);
+    }
+
+    if (success)
+    {
+        success= loadMesh(k_ps3eye_mesh_filename, &m_ps3eyeMesh);
+    }
+
     if (success)
     {
         success= loadFont(k_default_font_filename, k_default_font_pixel_height, &m_defaultFont);
@@ -98,6 +156,13 @@ void AssetManager::destroy()
     m_psnaviTexture.dispose();
     m_psdualshock4Texture.dispose();
     m_morpheusTexture.dispose();
+    m_psmovebodyMesh.dispose();
+    m_psmovebulbMesh.dispose();
+    m_psnaviMesh.dispose();
+    m_ds4bodyMesh.dispose();
+    m_ds4lightbarMesh.dispose();
+    m_morpheusMesh.dispose();
+    m_ps3eyeMesh.dispose();
     m_defaultFont.dispose();
 
     m_instance= NULL;
@@ -134,6 +199,23 @@ bool AssetManager::loadTexture(const char *filename, TextureAsset *textureAsset)
     return success;
 }
 
+bool AssetManager::loadMesh(const char *filename, MeshAsset *meshAsset)
+{
+    bool success= meshAsset->init(filename);
+
+    if (success)
+    {
+        // Upload the mesh into a static vertex buffer when the driver allows it
+        meshAsset->createVertexBuffer();
+    }
+    else
+    {
+        Log_ERROR("AssetManager::loadMesh", "Failed to load mesh: %s", filename);
+    }
+
+    return success;
+}
+
 bool AssetManager::loadFont(const char *filename, const float pixelHeight, FontAsset *fontAsset)
 {
     unsigned char *temp_ttf_buffer = NULL;
@@ -197,6 +279,115 @@ bool AssetManager::loadFont(const char *filename, const float pixelHeight, FontA
     return success;
 }
 
+//-- Mesh Asset -----
+bool MeshAsset::init(const char *filename)
+{
+    bool success= false;
+
+    FILE *fp= fopen(filename, "rb");
+    if (fp != NULL)
+    {
+        unsigned int header[4]; // magic, version, vertex_count, flags
+
+        success= fread(header, sizeof(header), 1, fp) == 1;
+
+        if (success &&
+            (header[0] != k_psmesh_magic ||
+             header[1] != k_psmesh_version ||
+             header[2] == 0 || header[2] > k_psmesh_max_vertex_count))
+        {
+            Log_ERROR("MeshAsset::init", "Invalid .psmesh header (%s)", filename);
+            success= false;
+        }
+
+        if (success)
+        {
+            const unsigned int flags= header[3];
+
+            vertex_count= header[2];
+            vertices.resize(3*vertex_count);
+            success= fread(vertices.data(), sizeof(float), vertices.size(), fp) == vertices.size();
+
+            if (success && (flags & k_psmesh_flag_has_normals) != 0)
+            {
+                normals.resize(3*vertex_count);
+                success= fread(normals.data(), sizeof(float), normals.size(), fp) == normals.size();
+            }
+
+            if (success && (flags & k_psmesh_flag_has_texcoords) != 0)
+            {
+                texCoords.resize(2*vertex_count);
+                success= fread(texCoords.data(), sizeof(float), texCoords.size(), fp) == texCoords.size();
+            }
+
+            if (!success)
+            {
+                Log_ERROR("MeshAsset::init", "Truncated .psmesh data (%s)", filename);
+                dispose();
+            }
+        }
+
+        fclose(fp);
+    }
+    else
+    {
+        Log_ERROR("MeshAsset::init", "Failed to open mesh file (%s)", filename);
+    }
+
+    return success;
+}
+
+void MeshAsset::createVertexBuffer()
+{
+    if (!GlExtensions::getIsBufferExtensionAvailable() || vertex_count == 0)
+    {
+        return;
+    }
+
+    const GLsizeiptr vertices_byte_count= (GLsizeiptr)(vertices.size()*sizeof(float));
+    const GLsizeiptr normals_byte_count= (GLsizeiptr)(normals.size()*sizeof(float));
+    const GLsizeiptr texcoords_byte_count= (GLsizeiptr)(texCoords.size()*sizeof(float));
+
+    normals_byte_offset= (unsigned int)vertices_byte_count;
+    texcoords_byte_offset= (unsigned int)(vertices_byte_count + normals_byte_count);
+
+    GlExtensions::glGenBuffersFn(1, &buffer_id);
+    GlExtensions::glBindBufferFn(GL_ARRAY_BUFFER, buffer_id);
+    GlExtensions::glBufferDataFn(
+        GL_ARRAY_BUFFER,
+        vertices_byte_count + normals_byte_count + texcoords_byte_count,
+        NULL,
+        GL_STATIC_DRAW);
+    GlExtensions::glBufferSubDataFn(GL_ARRAY_BUFFER, 0, vertices_byte_count, vertices.data());
+    if (normals_byte_count > 0)
+    {
+        GlExtensions::glBufferSubDataFn(
+            GL_ARRAY_BUFFER, normals_byte_offset, normals_byte_count, normals.data());
+    }
+    if (texcoords_byte_count > 0)
+    {
+        GlExtensions::glBufferSubDataFn(
+            GL_ARRAY_BUFFER, texcoords_byte_offset, texcoords_byte_count, texCoords.data());
+    }
+    GlExtensions::glBindBufferFn(GL_ARRAY_BUFFER, 0);
+}
+
+void MeshAsset::dispose()
+{
+    if (buffer_id != 0)
+    {
+        GlExtensions::glDeleteBuffersFn(1, &buffer_id);
+        buffer_id= 0;
+    }
+
+    vertex_count= 0;
+    normals_byte_offset= 0;
+    texcoords_byte_offset= 0;
+    std::vector<float>().swap(vertices);
+    std::vector<float>().swap(normals);
+    std::vector<float>().swap(texCoords);
+}
+
 //-- Font Asset -----
 bool TextureAsset::init(
     unsigned int width,
@@ -237,10 +428,41 @@ bool TextureAsset::init(
     return success;
 }
 
+static size_t computeTextureBufferByteCount(
+    unsigned int width, unsigned int height, unsigned int buffer_format)
+{
+    size_t bytes_per_pixel;
+
+    switch (buffer_format)
+    {
+    case GL_ALPHA:
+    case GL_LUMINANCE:
+        bytes_per_pixel= 1;
+        break;
+    case GL_RGB:
+    case GL_BGR:
+        bytes_per_pixel= 3;
+        break;
+    case GL_RGBA:
+    case GL_BGRA:
+        bytes_per_pixel= 4;
+        break;
+    default:
+        bytes_per_pixel= 4;
+        break;
+    }
+
+    return (size_t)width*(size_t)height*bytes_per_pixel;
+}
+
 void TextureAsset::copyBufferIntoTexture(const unsigned char *pixels)
 {
     if (texture_id != 0)
     {
+        const size_t buffer_byte_count=
+            computeTextureBufferByteCount(texture_width, texture_height, buffer_format);
+        const unsigned char *upload_source= pixels;
+
         glPixelStorei(GL_UNPACK_SWAP_BYTES, GL_FALSE);
         glPixelStorei(GL_UNPACK_LSB_FIRST, GL_TRUE);
         glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
@@ -248,6 +470,29 @@ void TextureAsset::copyBufferIntoTexture(const unsigned char *pixels)
         glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
         glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
+        if (GlExtensions::getIsBufferExtensionAvailable())
+        {
+            // Stage the pixels in a pixel unpack buffer so the
+            // glTexSubImage2D below returns without waiting for the
+            // transfer. Two buffers alternate so writing this frame never
+            // blocks on the DMA still draining from the previous one.
+            if (pixel_buffer_ids[0] == 0)
+            {
+                GlExtensions::glGenBuffersFn(2, pixel_buffer_ids);
+            }
+
+            pixel_buffer_write_index= (pixel_buffer_write_index + 1) % 2;
+            GlExtensions::glBindBufferFn(
+                GL_PIXEL_UNPACK_BUFFER, pixel_buffer_ids[pixel_buffer_write_index]);
+            GlExtensions::glBufferDataFn(
+                GL_PIXEL_UNPACK_BUFFER, buffer_byte_count, NULL, GL_STREAM_DRAW);
+            GlExtensions::glBufferSubDataFn(
+                GL_PIXEL_UNPACK_BUFFER, 0, buffer_byte_count, pixels);
+
+            // While an unpack buffer is bound the pixel pointer is an offset
+            upload_source= NULL;
+        }
+
         glBindTexture(GL_TEXTURE_2D, texture_id);
         glTexSubImage2D(
             GL_TEXTURE_2D,
@@ -258,8 +503,13 @@ void TextureAsset::copyBufferIntoTexture(const unsigned char *pixels)
             texture_height,
             buffer_format,
             GL_UNSIGNED_BYTE,
-            pixels);
+            upload_source);
         glBindTexture(GL_TEXTURE_2D, 0);
+
+        if (GlExtensions::getIsBufferExtensionAvailable())
+        {
+            GlExtensions::glBindBufferFn(GL_PIXEL_UNPACK_BUFFER, 0);
+        }
     }
 }
 
@@ -275,6 +525,14 @@ void TextureAsset::dispose()
         texture_format = 0;
         buffer_format = 0;
     }
+
+    if (pixel_buffer_ids[0] != 0)
+    {
+        GlExtensions::glDeleteBuffersFn(2, pixel_buffer_ids);
+        pixel_buffer_ids[0] = 0;
+        pixel_buffer_ids[1] = 0;
+        pixel_buffer_write_index = 0;
+    }
 }
 
 //-- Font Asset -----
@@ -3,6 +3,41 @@
 
 #include "stb_truetype.h"
 
+#include <vector>
+
+class MeshAsset
+{
+public:
+    unsigned int vertex_count;
+    std::vector<float> vertices;  // 3 floats per vertex
+    std::vector<float> normals;   // 3 floats per vertex, empty if not present
+    std::vector<float> texCoords; // 2 floats per vertex, empty if not present
+
+    // Static vertex buffer holding all channels back to back.
+    // buffer_id is 0 when VBOs are unavailable and the draw functions
+    // fall back to the client-side arrays above.
+    unsigned int buffer_id;
+    unsigned int normals_byte_offset;
+    unsigned int texcoords_byte_offset;
+
+    MeshAsset()
+        : vertex_count(0)
+        , buffer_id(0)
+        , normals_byte_offset(0)
+        , texcoords_byte_offset(0)
+    {}
+
+    inline bool hasNormals() const
+    { return !normals.empty(); }
+
+    inline bool hasTexCoords() const
+    { return !texCoords.empty(); }
+
+    bool init(const char *filename);
+    void createVertexBuffer();
+    void dispose();
+};
+
 class TextureAsset
 {
 public:
@@ -12,13 +47,23 @@ public:
     unsigned int texture_format;
     unsigned int buffer_format;
 
+    // Double-buffered pixel unpack buffers used to overlap video frame
+    // uploads with rendering. Both ids stay 0 when PBOs are unavailable
+    // and copyBufferIntoTexture uploads synchronously from client memory.
+    unsigned int pixel_buffer_ids[2];
+    int pixel_buffer_write_index;
+
     TextureAsset()
         : texture_id(0)
         , texture_width(0)
         , texture_height(0)
         , texture_format(0)
         , buffer_format(0)
-    {}
+        , pixel_buffer_write_index(0)
+    {
+        pixel_buffer_ids[0]= 0;
+        pixel_buffer_ids[1]= 0;
+    }
     ~TextureAsset()
     { dispose(); }
 
@@ -63,13 +108,35 @@ public:
     { return &m_psnaviTexture; }
 
     const TextureAsset *getMorpheusTextureAsset()
-    { return &m_morpheusTexture; }    
-    
+    { return &m_morpheusTexture; }
+
+    const MeshAsset *getPSMoveBodyMeshAsset()
+    { return &m_psmovebodyMesh; }
+
+    const MeshAsset *getPSMoveBulbMeshAsset()
+    { return &m_psmovebulbMesh; }
+
+    const MeshAsset *getPSNaviMeshAsset()
+    { return &m_psnaviMesh; }
+
+    const MeshAsset *getPSDualShock4BodyMeshAsset()
+    { return &m_ds4bodyMesh; }
+
+    const MeshAsset *getPSDualShock4LightBarMeshAsset()
+    { return &m_ds4lightbarMesh; }
+
+    const MeshAsset *getMorpheusMeshAsset()
+    { return &m_morpheusMesh; }
+
+    const MeshAsset *getPS3EyeMeshAsset()
+    { return &m_ps3eyeMesh; }
+
     const FontAsset *getDefaultFont()
     { return &m_defaultFont; }
 
 private:
     bool loadTexture(const char *filename, TextureAsset *textureAsset);
+    bool loadMesh(const char *filename, MeshAsset *meshAsset);
     bool loadFont(const char *filename, float pixelHeight, FontAsset *fontAsset);
 
     // Utility Textures
@@ -78,6 +145,15 @@ private:
     TextureAsset m_psdualshock4Texture;
     TextureAsset m_morpheusTexture;
 
+    // Device Meshes
+    MeshAsset m_psmovebodyMesh;
+    MeshAsset m_psmovebulbMesh;
+    MeshAsset m_psnaviMesh;
+    MeshAsset m_ds4bodyMesh;
+    MeshAsset m_ds4lightbarMesh;
+    MeshAsset m_morpheusMesh;
+    MeshAsset m_ps3eyeMesh;
+
     // Font Rendering
     FontAsset m_defaultFont;
 
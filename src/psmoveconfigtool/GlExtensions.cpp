@@ -0,0 +1,52 @@
+//-- includes -----
+#include "GlExtensions.h"
+#include "Logger.h"
+
+#include "SDL_video.h"
+
+//-- statics -----
+PFNGLGENBUFFERSPROC GlExtensions::glGenBuffersFn= NULL;
+PFNGLDELETEBUFFERSPROC GlExtensions::glDeleteBuffersFn= NULL;
+PFNGLBINDBUFFERPROC GlExtensions::glBindBufferFn= NULL;
+PFNGLBUFFERDATAPROC GlExtensions::glBufferDataFn= NULL;
+PFNGLBUFFERSUBDATAPROC GlExtensions::glBufferSubDataFn= NULL;
+
+static bool g_buffer_extension_available= false;
+
+//-- public implementation -----
+bool GlExtensions::initBufferExtensions()
+{
+    glGenBuffersFn= (PFNGLGENBUFFERSPROC)SDL_GL_GetProcAddress("glGenBuffers");
+    glDeleteBuffersFn= (PFNGLDELETEBUFFERSPROC)SDL_GL_GetProcAddress("glDeleteBuffers");
+    glBindBufferFn= (PFNGLBINDBUFFERPROC)SDL_GL_GetProcAddress("glBindBuffer");
+    glBufferDataFn= (PFNGLBUFFERDATAPROC)SDL_GL_GetProcAddress("glBufferData");
+    glBufferSubDataFn= (PFNGLBUFFERSUBDATAPROC)SDL_GL_GetProcAddress("glBufferSubData");
+
+    g_buffer_extension_available=
+        glGenBuffersFn != NULL &&
+        glDeleteBuffersFn != NULL &&
+        glBindBufferFn != NULL &&
+        glBufferDataFn != NULL &&
+        glBufferSubDataFn != NULL;
+
+    if (!g_buffer_extension_available)
+    {
+        // Clear any partially resolved set so callers only have to test one flag
+        glGenBuffersFn= NULL;
+        glDeleteBuffersFn= NULL;
+        glBindBufferFn= NULL;
+        glBufferDataFn= NULL;
+        glBufferSubDataFn= NULL;
+
+        Log_INFO(
+            "GlExtensions::initBufferExtensions",
+            "Vertex buffer objects unavailable - falling back to client vertex arrays");
+    }
+
+    return g_buffer_extension_available;
+}
+
+bool GlExtensions::getIsBufferExtensionAvailable()
+{
+    return g_buffer_extension_available;
+}
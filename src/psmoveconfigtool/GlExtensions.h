@@ -0,0 +1,28 @@
+#ifndef GL_EXTENSIONS_H
+#define GL_EXTENSIONS_H
+
+//-- includes -----
+#include "SDL_opengl.h"
+
+//-- interface -----
+// Vertex buffer object entry points resolved from the driver after the GL
+// context is created (see Renderer::init). On Windows these are core GL 1.5
+// functions but still have to be fetched through the extension mechanism.
+// All pointers stay null when the driver doesn't expose them, in which case
+// callers fall back to client-side vertex arrays.
+namespace GlExtensions
+{
+    extern PFNGLGENBUFFERSPROC glGenBuffersFn;
+    extern PFNGLDELETEBUFFERSPROC glDeleteBuffersFn;
+    extern PFNGLBINDBUFFERPROC glBindBufferFn;
+    extern PFNGLBUFFERDATAPROC glBufferDataFn;
+    extern PFNGLBUFFERSUBDATAPROC glBufferSubDataFn;
+
+    // Resolve the buffer entry points from the current GL context.
+    // Returns false when vertex buffer objects aren't available.
+    bool initBufferExtensions();
+
+    bool getIsBufferExtensionAvailable();
+};
+
+#endif // GL_EXTENSIONS_H
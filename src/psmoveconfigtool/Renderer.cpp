@@ -3,6 +3,7 @@
 #include "ClientGeometry.h"
 #include "ClientTrackerView.h"
 #include "AssetManager.h"
+#include "GlExtensions.h"
 #include "Logger.h"
 #include "ProtocolVersion.h"
 #include "UIConstants.h"
@@ -18,15 +19,8 @@
 
 #include <imgui.h>
 
-#include "psmovebody_3dmodel.h"
-#include "psmovebulb_3dmodel.h"
-#include "psnavi_3dmodel.h"
-#include "ps3eye_3dmodel.h"
-#include "ds4body_3dmodel.h"
-#include "ds4lightbar_3dmodel.h"
-#include "morpheus_3dmodel.h"
-
 #include <algorithm>
+#include <vector>
 
 #ifdef _MSC_VER
 #pragma warning (disable: 4505) // unreferenced local function has been removed (stb stuff)
@@ -46,13 +40,51 @@ static const ImVec4 k_clear_color = ImColor(114, 144, 154);
 
 static const glm::vec3 k_psmove_frustum_color = glm::vec3(0.1f, 0.7f, 0.3f);
 
+// Initial capacity of the vertex buffer used to stream per-frame geometry
+// (calibration point clouds and line strips). Grows on demand.
+static const size_t k_stream_vertex_buffer_initial_byte_count= 64*1024;
+
 //-- statics -----
 Renderer *Renderer::m_instance= NULL;
 
+// Shared streaming vertex buffer for dynamic geometry. The buffer is
+// orphaned (glBufferData with NULL) before every refill so the driver can
+// hand back fresh storage instead of stalling on in-flight draws.
+static GLuint g_stream_vertex_buffer= 0;
+static size_t g_stream_vertex_buffer_byte_capacity= 0;
+
+// Frame-scoped batch of screen space glyph quads (interleaved x,y,u,v).
+// Every piece of text drawn during the stage render lands here and is
+// flushed with a single font atlas bind and one draw call when the stage
+// render ends, instead of one state setup + immediate mode submission per
+// drawTextAtWorldPosition call.
+static std::vector<float> g_text_quad_vertices;
+
+// Deep copy of the ImGui command lists from the last rebuilt UI frame.
+// Settings screens are static between input/service events, so idle
+// repaints replay this copy instead of re-running the whole UI build and
+// regenerating the vertex stream (see Renderer::renderUICached)
+struct CachedUIDrawList
+{
+    std::vector<ImDrawCmd> cmd_buffer;
+    std::vector<ImDrawIdx> idx_buffer;
+    std::vector<ImDrawVert> vtx_buffer;
+};
+static std::vector<CachedUIDrawList> g_cached_ui_draw_lists;
+static bool g_bHasCachedUIDrawData= false;
+static ImVec2 g_cached_ui_display_size(0.f, 0.f);
+static float g_cached_ui_fb_height= 0.f;
+
 //-- prototypes -----
 static const char* ImGui_ImplSdl_GetClipboardText();
 static void ImGui_ImplSdl_SetClipboardText(const char* text);
 static void ImGui_ImplSdl_RenderDrawLists(ImDrawData* draw_data);
+static void ImGui_ImplSdl_RenderCachedDrawLists();
+
+static const GLvoid *streamVertexData(const float *data, size_t byte_count);
+static void unbindVertexBuffers();
+static void setMeshArrayPointers(const class MeshAsset *mesh, bool bUseNormals, bool bUseTexCoords);
+static void flushTextQuadBatch();
 
 //-- public methods -----
 Renderer::Renderer()
@@ -173,6 +205,10 @@ bool Renderer::init()
 
     if (success)
     {
+        // Resolve the vertex buffer entry points now that a context exists.
+        // Failure is non-fatal - drawing falls back to client vertex arrays.
+        GlExtensions::initBufferExtensions();
+
         glClearColor(k_clear_color.x, k_clear_color.y, k_clear_color.z, k_clear_color.w);
         glViewport(0, 0, m_windowWidth, m_windowHeight);
 
@@ -204,6 +240,13 @@ void Renderer::destroy()
 
     ImGui::Shutdown();
 
+    if (g_stream_vertex_buffer != 0)
+    {
+        GlExtensions::glDeleteBuffersFn(1, &g_stream_vertex_buffer);
+        g_stream_vertex_buffer= 0;
+        g_stream_vertex_buffer_byte_capacity= 0;
+    }
+
     if (m_glContext != NULL)
     {
         SDL_GL_DeleteContext(m_glContext);
@@ -291,6 +334,9 @@ void Renderer::renderStageBegin()
 
 void Renderer::renderStageEnd()
 {
+    // Draw all the text accumulated during the stage render in one batch
+    flushTextQuadBatch();
+
     m_isRenderingStage= false;
 }
 
@@ -363,19 +409,110 @@ void Renderer::renderUIBegin()
 
 void Renderer::renderUIEnd()
 {
-    glViewport(0, 0, (int)ImGui::GetIO().DisplaySize.x, (int)ImGui::GetIO().DisplaySize.y);    
+    glViewport(0, 0, (int)ImGui::GetIO().DisplaySize.x, (int)ImGui::GetIO().DisplaySize.y);
     glClear(GL_DEPTH_BUFFER_BIT);
     ImGui::Render();
 
     m_isRenderingUI= false;
 }
 
+bool Renderer::renderUICached()
+{
+    if (!g_bHasCachedUIDrawData)
+    {
+        return false;
+    }
+
+    // A resize since the cache was captured invalidates the vertex stream
+    int w, h;
+    SDL_GetWindowSize(m_window, &w, &h);
+    if ((float)w != g_cached_ui_display_size.x || (float)h != g_cached_ui_display_size.y)
+    {
+        return false;
+    }
+
+    glViewport(0, 0, w, h);
+    glClear(GL_DEPTH_BUFFER_BIT);
+    ImGui_ImplSdl_RenderCachedDrawLists();
+
+    return true;
+}
+
 void Renderer::renderEnd()
 {
     SDL_GL_SwapWindow(m_window);
 }
 
 //-- Drawing Methods -----
+static const GLvoid *streamVertexData(const float *data, size_t byte_count)
+{
+    if (!GlExtensions::getIsBufferExtensionAvailable())
+    {
+        // No buffer support - draw straight from client memory
+        return data;
+    }
+
+    if (g_stream_vertex_buffer == 0)
+    {
+        GlExtensions::glGenBuffersFn(1, &g_stream_vertex_buffer);
+    }
+
+    if (byte_count > g_stream_vertex_buffer_byte_capacity)
+    {
+        g_stream_vertex_buffer_byte_capacity= k_stream_vertex_buffer_initial_byte_count;
+        while (g_stream_vertex_buffer_byte_capacity < byte_count)
+        {
+            g_stream_vertex_buffer_byte_capacity*= 2;
+        }
+    }
+
+    GlExtensions::glBindBufferFn(GL_ARRAY_BUFFER, g_stream_vertex_buffer);
+    // Orphan the previous contents so the refill never waits on the GPU
+    GlExtensions::glBufferDataFn(
+        GL_ARRAY_BUFFER, g_stream_vertex_buffer_byte_capacity, NULL, GL_STREAM_DRAW);
+    GlExtensions::glBufferSubDataFn(GL_ARRAY_BUFFER, 0, byte_count, data);
+
+    // Vertex pointers are buffer offsets while the buffer is bound
+    return (const GLvoid *)0;
+}
+
+static void unbindVertexBuffers()
+{
+    if (GlExtensions::getIsBufferExtensionAvailable())
+    {
+        GlExtensions::glBindBufferFn(GL_ARRAY_BUFFER, 0);
+    }
+}
+
+static void setMeshArrayPointers(const MeshAsset *mesh, bool bUseNormals, bool bUseTexCoords)
+{
+    if (mesh->buffer_id != 0)
+    {
+        GlExtensions::glBindBufferFn(GL_ARRAY_BUFFER, mesh->buffer_id);
+        glVertexPointer(3, GL_FLOAT, 0, (const GLvoid *)0);
+        if (bUseNormals)
+        {
+            glNormalPointer(GL_FLOAT, 0, (const GLvoid *)(size_t)mesh->normals_byte_offset);
+        }
+        if (bUseTexCoords)
+        {
+            glTexCoordPointer(2, GL_FLOAT, 0, (const GLvoid *)(size_t)mesh->texcoords_byte_offset);
+        }
+    }
+    else
+    {
+        glVertexPointer(3, GL_FLOAT, 0, mesh->vertices.data());
+        if (bUseNormals)
+        {
+            glNormalPointer(GL_FLOAT, 0, mesh->normals.data());
+        }
+        if (bUseTexCoords)
+        {
+            glTexCoordPointer(2, GL_FLOAT, 0, mesh->texCoords.data());
+        }
+    }
+}
+
 void drawArrow(
     const glm::mat4 &transform,
     const glm::vec3 &start, 
@@ -457,29 +594,11 @@ void drawTextAtWorldPosition(
     text[sizeof(text)-1] = 0;
     va_end(args);
 
-    // Save a back up of the projection matrix and replace with an orthographic projection,
-    // Where units = screen pixels, origin at top left
-    glMatrixMode(GL_PROJECTION);
-    glPushMatrix();
-    const glm::mat4 ortho_projection= glm::ortho(
-        0.f, (float)screenWidth, // left, right
-        (float)screenHeight, 0.f, // bottom, top
-        -1.0f, 1.0f); // zNear, zFar
-    glLoadMatrixf(glm::value_ptr(ortho_projection));
-
-    // Save a backup of the modelview matrix and replace with the identity matrix
-    glMatrixMode(GL_MODELVIEW);
-    glPushMatrix();
-    glLoadIdentity();
-
-    // Bind the font texture
-    glBindTexture(GL_TEXTURE_2D, font->texture_id);
-    glColor3f(1.f, 1.f, 1.f);
-
-    // Render the text quads
-    glBegin(GL_QUADS);
+    // Append the glyph quads to the frame's text batch. Nothing is drawn
+    // here - the whole batch goes out in one draw call when the stage render
+    // ends (see flushTextQuadBatch)
     char *next_character= text;
-    while (*next_character) 
+    while (*next_character)
     {
         char ascii_character= *next_character;
 
@@ -489,16 +608,21 @@ void drawTextAtWorldPosition(
             int char_index= (int)ascii_character - 32;
 
             stbtt_GetBakedQuad(
-                const_cast<stbtt_bakedchar *>(font->cdata), 
-                font->texture_width, font->texture_height, 
-                char_index, 
+                const_cast<stbtt_bakedchar *>(font->cdata),
+                font->texture_width, font->texture_height,
+                char_index,
                 &screenCoords.x, &screenCoords.y, // x position advances with character by the glyph pixel widthorbit
                 &glyph_quad,
                 1); // opengl_fillrule= true
-            glTexCoord2f(glyph_quad.s0,glyph_quad.t0); glVertex2f(glyph_quad.x0,glyph_quad.y0);
-            glTexCoord2f(glyph_quad.s1,glyph_quad.t0); glVertex2f(glyph_quad.x1,glyph_quad.y0);
-            glTexCoord2f(glyph_quad.s1,glyph_quad.t1); glVertex2f(glyph_quad.x1,glyph_quad.y1);
-            glTexCoord2f(glyph_quad.s0,glyph_quad.t1); glVertex2f(glyph_quad.x0,glyph_quad.y1);
+
+            const float quad_vertices[16]= {
+                glyph_quad.x0, glyph_quad.y0, glyph_quad.s0, glyph_quad.t0,
+                glyph_quad.x1, glyph_quad.y0, glyph_quad.s1, glyph_quad.t0,
+                glyph_quad.x1, glyph_quad.y1, glyph_quad.s1, glyph_quad.t1,
+                glyph_quad.x0, glyph_quad.y1, glyph_quad.s0, glyph_quad.t1 };
+
+            g_text_quad_vertices.insert(
+                g_text_quad_vertices.end(), quad_vertices, quad_vertices + 16);
         }
         else if (ascii_character == '\n')
         {
@@ -508,7 +632,49 @@ void drawTextAtWorldPosition(
 
         ++next_character;
     }
-    glEnd();
+}
+
+static void flushTextQuadBatch()
+{
+    if (g_text_quad_vertices.size() == 0)
+    {
+        return;
+    }
+
+    const FontAsset *font= AssetManager::getInstance()->getDefaultFont();
+    const int screenWidth= static_cast<int>(ImGui::GetIO().DisplaySize.x);
+    const int screenHeight= static_cast<int>(ImGui::GetIO().DisplaySize.y);
+
+    // Save a back up of the projection matrix and replace with an orthographic projection,
+    // Where units = screen pixels, origin at top left
+    glMatrixMode(GL_PROJECTION);
+    glPushMatrix();
+    const glm::mat4 ortho_projection= glm::ortho(
+        0.f, (float)screenWidth, // left, right
+        (float)screenHeight, 0.f, // bottom, top
+        -1.0f, 1.0f); // zNear, zFar
+    glLoadMatrixf(glm::value_ptr(ortho_projection));
+
+    // Save a backup of the modelview matrix and replace with the identity matrix
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
+    glLoadIdentity();
+
+    // One font atlas bind and one draw call for every piece of text this frame
+    glBindTexture(GL_TEXTURE_2D, font->texture_id);
+    glColor3f(1.f, 1.f, 1.f);
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    const GLvoid *vertex_base=
+        streamVertexData(g_text_quad_vertices.data(), g_text_quad_vertices.size()*sizeof(float));
+    glVertexPointer(2, GL_FLOAT, 4*sizeof(float), vertex_base);
+    glTexCoordPointer(2, GL_FLOAT, 4*sizeof(float),
+        (const GLvoid *)((const unsigned char *)vertex_base + 2*sizeof(float)));
+    glDrawArrays(GL_QUADS, 0, (GLsizei)(g_text_quad_vertices.size() / 4));
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    unbindVertexBuffers();
 
     // rebind the default texture
     glBindTexture(GL_TEXTURE_2D, 0);
@@ -520,6 +686,8 @@ void drawTextAtWorldPosition(
     // Restore the modelview matrix
     glMatrixMode(GL_MODELVIEW);
     glPopMatrix();
+
+    g_text_quad_vertices.clear();
 }
 
 void drawFullscreenTexture(const unsigned int texture_id)
@@ -838,9 +1006,10 @@ void drawPointCloud(const glm::mat4 &transform, const glm::vec3 &color, const fl
     glMultMatrixf(glm::value_ptr(transform));
     glEnableClientState(GL_VERTEX_ARRAY);
     glPointSize(5);
-    glVertexPointer(3, GL_FLOAT, 0, points);
+    glVertexPointer(3, GL_FLOAT, 0, streamVertexData(points, (size_t)point_count*3*sizeof(float)));
     glDrawArrays(GL_POINTS, 0, point_count);
     glDisableClientState(GL_VERTEX_ARRAY);
+    unbindVertexBuffers();
     glPopMatrix();
 }
 
@@ -914,12 +1083,11 @@ void drawLineStrip(const glm::mat4 &transform, const glm::vec3 &color, const flo
     glPushMatrix();
         glMultMatrixf(glm::value_ptr(transform));
 
-        glBegin(GL_LINE_STRIP);
-        for (int sampleIndex= 0; sampleIndex < point_count; ++sampleIndex)
-        {
-            glVertex3fv(&points[sampleIndex*3]);
-        }
-        glEnd();
+        glEnableClientState(GL_VERTEX_ARRAY);
+        glVertexPointer(3, GL_FLOAT, 0, streamVertexData(points, (size_t)point_count*3*sizeof(float)));
+        glDrawArrays(GL_LINE_STRIP, 0, point_count);
+        glDisableClientState(GL_VERTEX_ARRAY);
+        unbindVertexBuffers();
     glPopMatrix();
 }
 
@@ -1059,34 +1227,44 @@ void drawOpenCVChessBoard(const float trackerWidth, const float trackerHeight, c
 
 void drawPoseArrayStrip(const struct PSMovePose *poses, const int poseCount, const glm::vec3 &color)
 {
-    glColor3fv(glm::value_ptr(color));
-    glBegin(GL_LINE_STRIP);
+    // Scratch buffer for gathering the pose positions into a contiguous array
+    static std::vector<float> scratch_points;
 
+    scratch_points.resize((size_t)poseCount*3);
     for (int sampleIndex = 0; sampleIndex < poseCount; ++sampleIndex)
     {
         const PSMovePose &pose = poses[sampleIndex];
 
-        glVertex3f(pose.Position.x, pose.Position.y, pose.Position.z);
+        scratch_points[sampleIndex*3 + 0]= pose.Position.x;
+        scratch_points[sampleIndex*3 + 1]= pose.Position.y;
+        scratch_points[sampleIndex*3 + 2]= pose.Position.z;
     }
 
-    glEnd();
+    glColor3fv(glm::value_ptr(color));
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glVertexPointer(3, GL_FLOAT, 0, streamVertexData(scratch_points.data(), scratch_points.size()*sizeof(float)));
+    glDrawArrays(GL_LINE_STRIP, 0, poseCount);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    unbindVertexBuffers();
 }
 
 void drawPS3EyeModel(const glm::mat4 &transform)
 {
     assert(Renderer::getIsRenderingStage());
 
+    const MeshAsset *mesh= AssetManager::getInstance()->getPS3EyeMeshAsset();
+
     glColor3f(1.f, 1.f, 1.f);
 
     glPushMatrix();
         glMultMatrixf(glm::value_ptr(transform));
         glEnableClientState(GL_VERTEX_ARRAY);
         glEnableClientState(GL_NORMAL_ARRAY);
-        glVertexPointer(3, GL_FLOAT, 0, ps3eyeVerts);
-        glNormalPointer(GL_FLOAT, 0, ps3eyeNormals);
-        glDrawArrays(GL_TRIANGLES, 0, ps3eyeNumVerts);
+        setMeshArrayPointers(mesh, true, false);
+        glDrawArrays(GL_TRIANGLES, 0, mesh->vertex_count);
         glDisableClientState(GL_VERTEX_ARRAY);
         glDisableClientState(GL_NORMAL_ARRAY);
+        unbindVertexBuffers();
     glPopMatrix();
 }
 
@@ -1095,6 +1273,8 @@ void drawPSMoveModel(const glm::mat4 &transform, const glm::vec3 &color)
     assert(Renderer::getIsRenderingStage());
 
     int textureID= AssetManager::getInstance()->getPSMoveTextureAsset()->texture_id;
+    const MeshAsset *bodyMesh= AssetManager::getInstance()->getPSMoveBodyMeshAsset();
+    const MeshAsset *bulbMesh= AssetManager::getInstance()->getPSMoveBulbMeshAsset();
 
     glBindTexture(GL_TEXTURE_2D, textureID);
 
@@ -1103,19 +1283,18 @@ void drawPSMoveModel(const glm::mat4 &transform, const glm::vec3 &color)
 
         glEnableClientState(GL_VERTEX_ARRAY);
         glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-        
+
         glColor3f(1.f, 1.f, 1.f);
-        glVertexPointer(3, GL_FLOAT, 0, psmovebodyVerts);
-        glTexCoordPointer(2, GL_FLOAT, 0, psmovebodyTexCoords);
-        glDrawArrays(GL_TRIANGLES, 0, psmovebodyNumVerts);
+        setMeshArrayPointers(bodyMesh, false, true);
+        glDrawArrays(GL_TRIANGLES, 0, bodyMesh->vertex_count);
 
         glColor3fv(glm::value_ptr(color));
-        glVertexPointer(3, GL_FLOAT, 0, psmovebulbVerts);
-        glTexCoordPointer(2, GL_FLOAT, 0, psmovebulbTexCoords);
-        glDrawArrays(GL_TRIANGLES, 0, psmovebulbNumVerts);
+        setMeshArrayPointers(bulbMesh, false, true);
+        glDrawArrays(GL_TRIANGLES, 0, bulbMesh->vertex_count);
 
         glDisableClientState(GL_VERTEX_ARRAY);
         glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+        unbindVertexBuffers();
 
     glPopMatrix();
 
@@ -1128,6 +1307,7 @@ void drawPSNaviModel(const glm::mat4 &transform)
     assert(Renderer::getIsRenderingStage());
 
     int textureID= AssetManager::getInstance()->getPSNaviTextureAsset()->texture_id;
+    const MeshAsset *mesh= AssetManager::getInstance()->getPSNaviMeshAsset();
 
     glBindTexture(GL_TEXTURE_2D, textureID);
     glColor3f(1.f, 1.f, 1.f);
@@ -1136,11 +1316,11 @@ void drawPSNaviModel(const glm::mat4 &transform)
         glMultMatrixf(glm::value_ptr(transform));
         glEnableClientState(GL_VERTEX_ARRAY);
         glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-        glVertexPointer(3, GL_FLOAT, 0, psnaviVerts);
-        glTexCoordPointer(2, GL_FLOAT, 0, psnaviTexCoords);
-        glDrawArrays(GL_TRIANGLES, 0, psnaviNumVerts);
+        setMeshArrayPointers(mesh, false, true);
+        glDrawArrays(GL_TRIANGLES, 0, mesh->vertex_count);
         glDisableClientState(GL_VERTEX_ARRAY);
         glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+        unbindVertexBuffers();
     glPopMatrix();
 
     // rebind the default texture
@@ -1152,6 +1332,8 @@ void drawPSDualShock4Model(const glm::mat4 &transform, const glm::vec3 &color)
     assert(Renderer::getIsRenderingStage());
 
     int textureID = AssetManager::getInstance()->getPSDualShock4TextureAsset()->texture_id;
+    const MeshAsset *bodyMesh= AssetManager::getInstance()->getPSDualShock4BodyMeshAsset();
+    const MeshAsset *lightbarMesh= AssetManager::getInstance()->getPSDualShock4LightBarMeshAsset();
 
     glBindTexture(GL_TEXTURE_2D, textureID);
     glColor3f(1.f, 1.f, 1.f);
@@ -1160,18 +1342,18 @@ void drawPSDualShock4Model(const glm::mat4 &transform, const glm::vec3 &color)
         glMultMatrixf(glm::value_ptr(transform));
         glEnableClientState(GL_VERTEX_ARRAY);
         glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-        
-		glVertexPointer(3, GL_FLOAT, 0, ds4bodyVerts);
-        glTexCoordPointer(2, GL_FLOAT, 0, ds4bodyTexCoords);
-        glDrawArrays(GL_TRIANGLES, 0, ds4bodyNumVerts);
+
+		setMeshArrayPointers(bodyMesh, false, true);
+        glDrawArrays(GL_TRIANGLES, 0, bodyMesh->vertex_count);
 
 		glDisableClientState(GL_TEXTURE_COORD_ARRAY);
 
 		glColor3fv(glm::value_ptr(color));
-		glVertexPointer(3, GL_FLOAT, 0, ds4lightbarVerts);
-		glDrawArrays(GL_TRIANGLES, 0, ds4lightbarNumVerts);
+		setMeshArrayPointers(lightbarMesh, false, false);
+		glDrawArrays(GL_TRIANGLES, 0, lightbarMesh->vertex_count);
 
         glDisableClientState(GL_VERTEX_ARRAY);
+        unbindVertexBuffers();
     glPopMatrix();
 
     // rebind the default texture
@@ -1212,6 +1394,7 @@ void drawMorpheusModel(const glm::mat4 &transform)
     assert(Renderer::getIsRenderingStage());
 
     int textureID= AssetManager::getInstance()->getMorpheusTextureAsset()->texture_id;
+    const MeshAsset *mesh= AssetManager::getInstance()->getMorpheusMeshAsset();
 
     glBindTexture(GL_TEXTURE_2D, textureID);
 
@@ -1220,14 +1403,14 @@ void drawMorpheusModel(const glm::mat4 &transform)
 
         glEnableClientState(GL_VERTEX_ARRAY);
         glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-        
+
         glColor3f(1.f, 1.f, 1.f);
-        glVertexPointer(3, GL_FLOAT, 0, morpheusVerts);
-        glTexCoordPointer(2, GL_FLOAT, 0, morpheusTexCoords);
-        glDrawArrays(GL_TRIANGLES, 0, morpheusNumVerts);
+        setMeshArrayPointers(mesh, false, true);
+        glDrawArrays(GL_TRIANGLES, 0, mesh->vertex_count);
 
         glDisableClientState(GL_VERTEX_ARRAY);
         glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+        unbindVertexBuffers();
 
     glPopMatrix();
 
@@ -1246,15 +1429,14 @@ static void ImGui_ImplSdl_SetClipboardText(const char* text)
     SDL_SetClipboardText(text);
 }
 
-// This is the main rendering function that you have to implement and provide to ImGui (via setting up 'RenderDrawListsFn' in the ImGuiIO structure)
-// If text or lines are blurry when integrating ImGui in your engine:
-// - in your Render function, try translating your projection matrix by (0.5f,0.5f) or (0.375f,0.375f)
-static void ImGui_ImplSdl_RenderDrawLists(ImDrawData* draw_data)
+// Setup render state shared by the live and cached-replay UI paths:
+// alpha-blending enabled, no face culling, no depth testing, scissor enabled,
+// vertex/texcoord/color pointers, orthographic projection.
+static void ImGui_ImplSdl_RenderStateSetup(const ImVec2 &display_size, GLint &last_texture, GLint *last_viewport)
 {
     // We are using the OpenGL fixed pipeline to make the example code simpler to read!
-    // Setup render state: alpha-blending enabled, no face culling, no depth testing, scissor enabled, vertex/texcoord/color pointers.
-    GLint last_texture; glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture);
-    GLint last_viewport[4]; glGetIntegerv(GL_VIEWPORT, last_viewport);
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture);
+    glGetIntegerv(GL_VIEWPORT, last_viewport);
     glPushAttrib(GL_ENABLE_BIT | GL_COLOR_BUFFER_BIT | GL_TRANSFORM_BIT);
     glEnable(GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
@@ -1267,61 +1449,144 @@ static void ImGui_ImplSdl_RenderDrawLists(ImDrawData* draw_data)
     glEnable(GL_TEXTURE_2D);
     //glUseProgram(0); // You may want this if using this code in an OpenGL 3+ context
 
-    // Handle cases of screen coordinates != from framebuffer coordinates (e.g. retina displays)
-    ImGuiIO& io = ImGui::GetIO();
-    float fb_height = io.DisplaySize.y * io.DisplayFramebufferScale.y;
-    draw_data->ScaleClipRects(io.DisplayFramebufferScale);
-
     // Setup viewport, orthographic projection matrix
-    glViewport(0, 0, (GLsizei)io.DisplaySize.x, (GLsizei)io.DisplaySize.y);
+    glViewport(0, 0, (GLsizei)display_size.x, (GLsizei)display_size.y);
     glMatrixMode(GL_PROJECTION);
     glPushMatrix();
     glLoadIdentity();
-    glOrtho(0.0f, io.DisplaySize.x, io.DisplaySize.y, 0.0f, -1.0f, +1.0f);
+    glOrtho(0.0f, display_size.x, display_size.y, 0.0f, -1.0f, +1.0f);
     glMatrixMode(GL_MODELVIEW);
     glPushMatrix();
     glLoadIdentity();
+}
+
+static void ImGui_ImplSdl_RenderStateRestore(GLint last_texture, const GLint *last_viewport)
+{
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glBindTexture(GL_TEXTURE_2D, last_texture);
+    glMatrixMode(GL_MODELVIEW);
+    glPopMatrix();
+    glMatrixMode(GL_PROJECTION);
+    glPopMatrix();
+    glPopAttrib();
+    glViewport(last_viewport[0], last_viewport[1], (GLsizei)last_viewport[2], (GLsizei)last_viewport[3]);
+}
 
-    // Render command lists
+// Draw a single command list from raw buffer pointers so the cached replay
+// path can feed its deep-copied buffers through the same code. cmd_list is
+// null when replaying the cache (frames with user callbacks aren't cached).
+static void ImGui_ImplSdl_RenderDrawList(
+    const ImDrawList *cmd_list,
+    const ImDrawVert *vtx_buffer_begin,
+    const ImDrawIdx *idx_buffer_begin,
+    const ImDrawCmd *commands,
+    const int command_count,
+    const float fb_height)
+{
     #define OFFSETOF(TYPE, ELEMENT) ((size_t)&(((TYPE *)0)->ELEMENT))
+    const unsigned char* vtx_buffer = (const unsigned char*)vtx_buffer_begin;
+    const ImDrawIdx* idx_buffer = idx_buffer_begin;
+    glVertexPointer(2, GL_FLOAT, sizeof(ImDrawVert), (void*)(vtx_buffer + OFFSETOF(ImDrawVert, pos)));
+    glTexCoordPointer(2, GL_FLOAT, sizeof(ImDrawVert), (void*)(vtx_buffer + OFFSETOF(ImDrawVert, uv)));
+    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(ImDrawVert), (void*)(vtx_buffer + OFFSETOF(ImDrawVert, col)));
+    #undef OFFSETOF
+
+    for (int cmd_i = 0; cmd_i < command_count; cmd_i++)
+    {
+        const ImDrawCmd* pcmd = &commands[cmd_i];
+        if (pcmd->UserCallback)
+        {
+            if (cmd_list != nullptr)
+            {
+                pcmd->UserCallback(cmd_list, pcmd);
+            }
+        }
+        else
+        {
+            glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->TextureId);
+            glScissor((int)pcmd->ClipRect.x, (int)(fb_height - pcmd->ClipRect.w), (int)(pcmd->ClipRect.z - pcmd->ClipRect.x), (int)(pcmd->ClipRect.w - pcmd->ClipRect.y));
+            glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, idx_buffer);
+        }
+        idx_buffer += pcmd->ElemCount;
+    }
+}
+
+// This is the main rendering function that you have to implement and provide to ImGui (via setting up 'RenderDrawListsFn' in the ImGuiIO structure)
+// If text or lines are blurry when integrating ImGui in your engine:
+// - in your Render function, try translating your projection matrix by (0.5f,0.5f) or (0.375f,0.375f)
+static void ImGui_ImplSdl_RenderDrawLists(ImDrawData* draw_data)
+{
+    // Handle cases of screen coordinates != from framebuffer coordinates (e.g. retina displays)
+    ImGuiIO& io = ImGui::GetIO();
+    float fb_height = io.DisplaySize.y * io.DisplayFramebufferScale.y;
+    draw_data->ScaleClipRects(io.DisplayFramebufferScale);
+
+    // Deep copy the command lists so idle repaints can re-present this frame
+    // without re-running the UI build (see Renderer::renderUICached). Frames
+    // carrying user callbacks can't be safely replayed and aren't cached.
+    g_bHasCachedUIDrawData= true;
+    g_cached_ui_display_size= io.DisplaySize;
+    g_cached_ui_fb_height= fb_height;
+    g_cached_ui_draw_lists.resize(draw_data->CmdListsCount);
+
+    GLint last_texture;
+    GLint last_viewport[4];
+    ImGui_ImplSdl_RenderStateSetup(io.DisplaySize, last_texture, last_viewport);
+
+    // Render the command lists, caching each as it's drawn
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* cmd_list = draw_data->CmdLists[n];
-        const unsigned char* vtx_buffer = (const unsigned char*)&cmd_list->VtxBuffer.front();
-        const ImDrawIdx* idx_buffer = &cmd_list->IdxBuffer.front();
-        glVertexPointer(2, GL_FLOAT, sizeof(ImDrawVert), (void*)(vtx_buffer + OFFSETOF(ImDrawVert, pos)));
-        glTexCoordPointer(2, GL_FLOAT, sizeof(ImDrawVert), (void*)(vtx_buffer + OFFSETOF(ImDrawVert, uv)));
-        glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(ImDrawVert), (void*)(vtx_buffer + OFFSETOF(ImDrawVert, col)));
+        CachedUIDrawList &cached_list = g_cached_ui_draw_lists[n];
+
+        cached_list.cmd_buffer.assign(cmd_list->CmdBuffer.begin(), cmd_list->CmdBuffer.end());
+        cached_list.idx_buffer.assign(cmd_list->IdxBuffer.begin(), cmd_list->IdxBuffer.end());
+        cached_list.vtx_buffer.assign(cmd_list->VtxBuffer.begin(), cmd_list->VtxBuffer.end());
 
         for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.size(); cmd_i++)
         {
-            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
-            if (pcmd->UserCallback)
+            if (cmd_list->CmdBuffer[cmd_i].UserCallback != nullptr)
             {
-                pcmd->UserCallback(cmd_list, pcmd);
-            }
-            else
-            {
-                glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->TextureId);
-                glScissor((int)pcmd->ClipRect.x, (int)(fb_height - pcmd->ClipRect.w), (int)(pcmd->ClipRect.z - pcmd->ClipRect.x), (int)(pcmd->ClipRect.w - pcmd->ClipRect.y));
-                glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, idx_buffer);
+                g_bHasCachedUIDrawData= false;
             }
-            idx_buffer += pcmd->ElemCount;
         }
+
+        ImGui_ImplSdl_RenderDrawList(
+            cmd_list,
+            &cmd_list->VtxBuffer.front(), &cmd_list->IdxBuffer.front(),
+            &cmd_list->CmdBuffer.front(), cmd_list->CmdBuffer.size(),
+            fb_height);
     }
-    #undef OFFSETOF
 
-    // Restore modified state
-    glDisableClientState(GL_COLOR_ARRAY);
-    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
-    glDisableClientState(GL_VERTEX_ARRAY);
-    glBindTexture(GL_TEXTURE_2D, last_texture);
-    glMatrixMode(GL_MODELVIEW);
-    glPopMatrix();
-    glMatrixMode(GL_PROJECTION);
-    glPopMatrix();
-    glPopAttrib();
-    glViewport(last_viewport[0], last_viewport[1], (GLsizei)last_viewport[2], (GLsizei)last_viewport[3]);
+    ImGui_ImplSdl_RenderStateRestore(last_texture, last_viewport);
+}
+
+// Replay the deep-copied command lists from the last rebuilt UI frame
+static void ImGui_ImplSdl_RenderCachedDrawLists()
+{
+    GLint last_texture;
+    GLint last_viewport[4];
+    ImGui_ImplSdl_RenderStateSetup(g_cached_ui_display_size, last_texture, last_viewport);
+
+    for (size_t n = 0; n < g_cached_ui_draw_lists.size(); n++)
+    {
+        const CachedUIDrawList &cached_list = g_cached_ui_draw_lists[n];
+
+        if (cached_list.vtx_buffer.size() == 0 || cached_list.cmd_buffer.size() == 0)
+        {
+            continue;
+        }
+
+        ImGui_ImplSdl_RenderDrawList(
+            nullptr,
+            &cached_list.vtx_buffer[0], &cached_list.idx_buffer[0],
+            &cached_list.cmd_buffer[0], static_cast<int>(cached_list.cmd_buffer.size()),
+            g_cached_ui_fb_height);
+    }
+
+    ImGui_ImplSdl_RenderStateRestore(last_texture, last_viewport);
 }
 
 
@@ -34,6 +34,10 @@ public:
     void renderStageEnd();
     void renderUIBegin();
     void renderUIEnd();
+    // Re-present the UI draw data cached from the last rebuilt frame instead
+    // of re-running the ImGui build. Returns false when no usable cache
+    // exists (first frame, window resized) - render the UI normally then.
+    bool renderUICached();
     void renderEnd();
 
     static bool getIsRenderingStage() 
@@ -1,417 +0,0 @@
-/*
-created with obj2opengl.pl
-
-source file    : DS4/lightbar.obj
-vertices       : 34
-faces          : 32
-normals        : 5
-texture coords : 34
-
-
-// include generated arrays
-#import "DS4/lightbar.h"
-
-// set input data to arrays
-glVertexPointer(3, GL_FLOAT, 0, ds4lightbarVerts);
-glNormalPointer(GL_FLOAT, 0, ds4lightbarNormals);
-glTexCoordPointer(2, GL_FLOAT, 0, ds4lightbarTexCoords);
-
-// draw data
-glDrawArrays(GL_TRIANGLES, 0, ds4lightbarNumVerts);
-*/
-
-unsigned int ds4lightbarNumVerts = 96;
-
-float ds4lightbarVerts [] = {
-  // f 31/1/1 22/2/1 19/3/1
-  1.823991, 0.269423, -0.022554,
-  1.864584, -0.007793, -0.029844,
-  1.696778, -0.152642, -0.033653,
-  // f 18/4/1 34/5/1 19/3/1
-  1.433376, -0.223206, -0.035508,
-  1.62912, 0.361086, -0.020139,
-  1.696778, -0.152642, -0.033653,
-  // f 13/6/1 12/7/1 9/8/1
-  0.203751, -0.552565, -0.04417,
-  0.036064, -0.585907, -0.045046,
-  -0.472835, -0.552566, -0.044169,
-  // f 11/9/1 10/10/1 12/7/1
-  -0.134541, -0.597087, -0.04534,
-  -0.304877, -0.585944, -0.045046,
-  0.036064, -0.585907, -0.045046,
-  // f 9/8/1 8/11/1 28/12/1
-  -0.472835, -0.552566, -0.044169,
-  -0.966282, -0.4204, -0.04069,
-  -1.722138, 0.361081, -0.020125,
-  // f 24/13/1 23/14/2 17/15/1
-  -1.965864, -0.152648, -0.033641,
-  -2.04177, -0.118612, -0.032746,
-  -2.064218, -0.098063, -0.032204,
-  // f 17/15/1 16/16/1 7/17/1
-  -2.064218, -0.098063, -0.032204,
-  -2.103195, -0.06237, -0.031266,
-  -2.147271, 0.129758, -0.026213,
-  // f 15/18/1 7/17/1 16/16/1
-  -2.143798, 0.010329, -0.029353,
-  -2.147271, 0.129758, -0.026213,
-  -2.103195, -0.06237, -0.031266,
-  // f 6/19/3 5/20/1 7/17/1
-  -2.148574, 0.174722, -0.025028,
-  -2.112266, 0.249695, -0.023056,
-  -2.147271, 0.129758, -0.026213,
-  // f 4/21/1 3/22/1 7/17/1
-  -2.054232, 0.309425, -0.021484,
-  -1.980361, 0.347847, -0.020473,
-  -2.147271, 0.129758, -0.026213,
-  // f 14/23/1 13/6/1 9/8/1
-  0.357208, -0.511469, -0.043089,
-  0.203751, -0.552565, -0.04417,
-  -0.472835, -0.552566, -0.044169,
-  // f 3/22/1 2/24/1 7/17/1
-  -1.980361, 0.347847, -0.020473,
-  -1.89822, 0.361097, -0.020125,
-  -2.147271, 0.129758, -0.026213,
-  // f 1/25/1 28/12/1 24/13/1
-  -1.840886, 0.361081, -0.020125,
-  -1.722138, 0.361081, -0.020125,
-  -1.965864, -0.152648, -0.033641,
-  // f 33/26/1 32/27/1 31/1/1
-  1.711266, 0.347842, -0.02049,
-  1.785125, 0.309417, -0.021502,
-  1.823991, 0.269423, -0.022554,
-  // f 31/1/1 30/28/4 29/29/1
-  1.823991, 0.269423, -0.022554,
-  1.843184, 0.2497, -0.023074,
-  1.879504, 0.17474, -0.025044,
-  // f 27/30/1 26/31/5 25/32/1
-  1.888142, 0.109041, -0.026772,
-  1.890372, 0.09213, -0.027216,
-  1.874709, 0.010333, -0.029368,
-  // f 31/1/1 29/29/1 27/30/1
-  1.823991, 0.269423, -0.022554,
-  1.879504, 0.17474, -0.025044,
-  1.888142, 0.109041, -0.026772,
-  // f 14/23/1 9/8/1 28/12/1
-  0.357208, -0.511469, -0.043089,
-  -0.472835, -0.552566, -0.044169,
-  -1.722138, 0.361081, -0.020125,
-  // f 5/20/1 4/21/1 7/17/1
-  -2.112266, 0.249695, -0.023056,
-  -2.054232, 0.309425, -0.021484,
-  -2.147271, 0.129758, -0.026213,
-  // f 17/15/1 7/17/1 24/13/1
-  -2.064218, -0.098063, -0.032204,
-  -2.147271, 0.129758, -0.026213,
-  -1.965864, -0.152648, -0.033641,
-  // f 8/11/1 24/13/1 28/12/1
-  -0.966282, -0.4204, -0.04069,
-  -1.965864, -0.152648, -0.033641,
-  -1.722138, 0.361081, -0.020125,
-  // f 12/7/1 10/10/1 9/8/1
-  0.036064, -0.585907, -0.045046,
-  -0.304877, -0.585944, -0.045046,
-  -0.472835, -0.552566, -0.044169,
-  // f 34/5/1 33/26/1 31/1/1
-  1.62912, 0.361086, -0.020139,
-  1.711266, 0.347842, -0.02049,
-  1.823991, 0.269423, -0.022554,
-  // f 21/33/1 20/34/1 22/2/1
-  1.83409, -0.062379, -0.03128,
-  1.772692, -0.118606, -0.032758,
-  1.864584, -0.007793, -0.029844,
-  // f 25/32/1 22/2/1 27/30/1
-  1.874709, 0.010333, -0.029368,
-  1.864584, -0.007793, -0.029844,
-  1.888142, 0.109041, -0.026772,
-  // f 31/1/1 27/30/1 22/2/1
-  1.823991, 0.269423, -0.022554,
-  1.888142, 0.109041, -0.026772,
-  1.864584, -0.007793, -0.029844,
-  // f 2/24/1 24/13/1 7/17/1
-  -1.89822, 0.361097, -0.020125,
-  -1.965864, -0.152648, -0.033641,
-  -2.147271, 0.129758, -0.026213,
-  // f 24/13/1 2/24/1 1/25/1
-  -1.965864, -0.152648, -0.033641,
-  -1.89822, 0.361097, -0.020125,
-  -1.840886, 0.361081, -0.020125,
-  // f 34/5/1 31/1/1 19/3/1
-  1.62912, 0.361086, -0.020139,
-  1.823991, 0.269423, -0.022554,
-  1.696778, -0.152642, -0.033653,
-  // f 22/2/1 20/34/1 19/3/1
-  1.864584, -0.007793, -0.029844,
-  1.772692, -0.118606, -0.032758,
-  1.696778, -0.152642, -0.033653,
-  // f 14/23/1 28/12/1 34/5/1
-  0.357208, -0.511469, -0.043089,
-  -1.722138, 0.361081, -0.020125,
-  1.62912, 0.361086, -0.020139,
-  // f 34/5/1 18/4/1 14/23/1
-  1.62912, 0.361086, -0.020139,
-  1.433376, -0.223206, -0.035508,
-  0.357208, -0.511469, -0.043089,
-};
-
-float ds4lightbarNormals [] = {
-  // f 31/1/1 22/2/1 19/3/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 18/4/1 34/5/1 19/3/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 13/6/1 12/7/1 9/8/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 11/9/1 10/10/1 12/7/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 9/8/1 8/11/1 28/12/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 24/13/1 23/14/2 17/15/1
-  0, 0.0262987931760711, -0.999654126924649,
-  9.99951473532456e-005, 0.0263987189012568, -0.999651488090396,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 17/15/1 16/16/1 7/17/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 15/18/1 7/17/1 16/16/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 6/19/3 5/20/1 7/17/1
-  -9.99951473532456e-005, 0.0263987189012568, -0.999651488090396,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 4/21/1 3/22/1 7/17/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 14/23/1 13/6/1 9/8/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 3/22/1 2/24/1 7/17/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 1/25/1 28/12/1 24/13/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 33/26/1 32/27/1 31/1/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 31/1/1 30/28/4 29/29/1
-  0, 0.0262987931760711, -0.999654126924649,
-  -9.99956732808237e-005, 0.0261988663995758, -0.999656745788394,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 27/30/1 26/31/5 25/32/1
-  0, 0.0262987931760711, -0.999654126924649,
-  9.99954108159285e-005, 0.0262987930445892, -0.999654121926837,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 31/1/1 29/29/1 27/30/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 14/23/1 9/8/1 28/12/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 5/20/1 4/21/1 7/17/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 17/15/1 7/17/1 24/13/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 8/11/1 24/13/1 28/12/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 12/7/1 10/10/1 9/8/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 34/5/1 33/26/1 31/1/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 21/33/1 20/34/1 22/2/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 25/32/1 22/2/1 27/30/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 31/1/1 27/30/1 22/2/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 2/24/1 24/13/1 7/17/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 24/13/1 2/24/1 1/25/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 34/5/1 31/1/1 19/3/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 22/2/1 20/34/1 19/3/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 14/23/1 28/12/1 34/5/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  // f 34/5/1 18/4/1 14/23/1
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-  0, 0.0262987931760711, -0.999654126924649,
-};
-
-float ds4lightbarTexCoords [] = {
-  // f 31/1/1 22/2/1 19/3/1
-  0.399800, 0.3407,
-  0.390600, 0.3386,
-  0.385800, 0.347,
-  // f 18/4/1 34/5/1 19/3/1
-  0.383400, 0.3603,
-  0.402800, 0.3506,
-  0.385800, 0.347,
-  // f 13/6/1 12/7/1 9/8/1
-  0.372300, 0.4223,
-  0.371200, 0.4308,
-  0.372200, 0.4565,
-  // f 11/9/1 10/10/1 12/7/1
-  0.370800, 0.4394,
-  0.371100, 0.448,
-  0.371200, 0.4308,
-  // f 9/8/1 8/11/1 28/12/1
-  0.372200, 0.4565,
-  0.376400, 0.4815,
-  0.402100, 0.5199,
-  // f 24/13/1 23/14/2 17/15/1
-  0.385100, 0.532,
-  0.386200, 0.5359,
-  0.386900, 0.537,
-  // f 17/15/1 16/16/1 7/17/1
-  0.386900, 0.537,
-  0.388000, 0.539,
-  0.394400, 0.5413,
-  // f 15/18/1 7/17/1 16/16/1
-  0.390400, 0.5411,
-  0.394400, 0.5413,
-  0.388000, 0.539,
-  // f 6/19/3 5/20/1 7/17/1
-  0.395900, 0.5413,
-  0.398300, 0.5395,
-  0.394400, 0.5413,
-  // f 4/21/1 3/22/1 7/17/1
-  0.400300, 0.5366,
-  0.401600, 0.5329,
-  0.394400, 0.5413,
-  // f 14/23/1 13/6/1 9/8/1
-  0.373700, 0.4146,
-  0.372300, 0.4223,
-  0.372200, 0.4565,
-  // f 3/22/1 2/24/1 7/17/1
-  0.401600, 0.5329,
-  0.402100, 0.5288,
-  0.394400, 0.5413,
-  // f 1/25/1 28/12/1 24/13/1
-  0.402100, 0.5259,
-  0.402100, 0.5199,
-  0.385100, 0.532,
-  // f 33/26/1 32/27/1 31/1/1
-  0.402300, 0.3464,
-  0.401100, 0.3427,
-  0.399800, 0.3407,
-  // f 31/1/1 30/28/4 29/29/1
-  0.399800, 0.3407,
-  0.399100, 0.3397,
-  0.396700, 0.3379,
-  // f 27/30/1 26/31/5 25/32/1
-  0.394500, 0.3374,
-  0.393900, 0.3373,
-  0.391200, 0.3381,
-  // f 31/1/1 29/29/1 27/30/1
-  0.399800, 0.3407,
-  0.396700, 0.3379,
-  0.394500, 0.3374,
-  // f 14/23/1 9/8/1 28/12/1
-  0.373700, 0.4146,
-  0.372200, 0.4565,
-  0.402100, 0.5199,
-  // f 5/20/1 4/21/1 7/17/1
-  0.398300, 0.5395,
-  0.400300, 0.5366,
-  0.394400, 0.5413,
-  // f 17/15/1 7/17/1 24/13/1
-  0.386900, 0.537,
-  0.394400, 0.5413,
-  0.385100, 0.532,
-  // f 8/11/1 24/13/1 28/12/1
-  0.376400, 0.4815,
-  0.385100, 0.532,
-  0.402100, 0.5199,
-  // f 12/7/1 10/10/1 9/8/1
-  0.371200, 0.4308,
-  0.371100, 0.448,
-  0.372200, 0.4565,
-  // f 34/5/1 33/26/1 31/1/1
-  0.402800, 0.3506,
-  0.402300, 0.3464,
-  0.399800, 0.3407,
-  // f 21/33/1 20/34/1 22/2/1
-  0.388800, 0.3401,
-  0.386900, 0.3432,
-  0.390600, 0.3386,
-  // f 25/32/1 22/2/1 27/30/1
-  0.391200, 0.3381,
-  0.390600, 0.3386,
-  0.394500, 0.3374,
-  // f 31/1/1 27/30/1 22/2/1
-  0.399800, 0.3407,
-  0.394500, 0.3374,
-  0.390600, 0.3386,
-  // f 2/24/1 24/13/1 7/17/1
-  0.402100, 0.5288,
-  0.385100, 0.532,
-  0.394400, 0.5413,
-  // f 24/13/1 2/24/1 1/25/1
-  0.385100, 0.532,
-  0.402100, 0.5288,
-  0.402100, 0.5259,
-  // f 34/5/1 31/1/1 19/3/1
-  0.402800, 0.3506,
-  0.399800, 0.3407,
-  0.385800, 0.347,
-  // f 22/2/1 20/34/1 19/3/1
-  0.390600, 0.3386,
-  0.386900, 0.3432,
-  0.385800, 0.347,
-  // f 14/23/1 28/12/1 34/5/1
-  0.373700, 0.4146,
-  0.402100, 0.5199,
-  0.402800, 0.3506,
-  // f 34/5/1 18/4/1 14/23/1
-  0.402800, 0.3506,
-  0.383400, 0.3603,
-  0.373700, 0.4146,
-};
-
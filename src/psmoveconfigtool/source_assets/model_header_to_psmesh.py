@@ -0,0 +1,89 @@
+#!/usr/bin/env python
+"""Convert an obj2opengl-generated C header into a binary .psmesh asset.
+
+obj2opengl.pl emits the model as giant C float arrays (<prefix>Verts,
+<prefix>Normals, <prefix>TexCoords plus <prefix>NumVerts). Compiling those
+into the config tool bloated build times and binary size, so the tool now
+loads a compact binary format at runtime instead (see AssetManager.cpp).
+
+Usage:
+    python model_header_to_psmesh.py <header.h> <prefix> <out.psmesh> <channels>
+
+<channels> selects which arrays get written, e.g. "vt" for vertices +
+texture coordinates, "vn" for vertices + normals, "v" for vertices only.
+
+.psmesh layout (little-endian):
+    uint32 magic    'PSMH' (0x484D5350)
+    uint32 version  1
+    uint32 vertex_count
+    uint32 flags    bit 0 = has normals, bit 1 = has texcoords
+    float  vertices [3 * vertex_count]
+    float  normals  [3 * vertex_count]   (when flag bit 0)
+    float  texcoords[2 * vertex_count]   (when flag bit 1)
+"""
+
+import re
+import struct
+import sys
+
+PSMESH_MAGIC = 0x484D5350
+PSMESH_VERSION = 1
+FLAG_NORMALS = 0x1
+FLAG_TEXCOORDS = 0x2
+
+
+def parse_float_array(source, array_name):
+    match = re.search(
+        r'float\s+%s\s*\[\]\s*=\s*\{(.*?)\};' % re.escape(array_name),
+        source, re.DOTALL)
+    if match is None:
+        raise SystemExit("array '%s' not found" % array_name)
+
+    body = re.sub(r'//[^\n]*', '', match.group(1))
+    return [float(token) for token in body.replace(',', ' ').split()]
+
+
+def main():
+    if len(sys.argv) != 5:
+        raise SystemExit(__doc__)
+
+    header_path, prefix, out_path, channels = sys.argv[1:5]
+
+    with open(header_path, 'r') as header_file:
+        source = header_file.read()
+
+    count_match = re.search(
+        r'unsigned\s+int\s+%sNumVerts\s*=\s*(\d+)\s*;' % re.escape(prefix), source)
+    if count_match is None:
+        raise SystemExit("'%sNumVerts' not found" % prefix)
+    vertex_count = int(count_match.group(1))
+
+    vertices = parse_float_array(source, prefix + 'Verts')
+    assert len(vertices) == 3 * vertex_count, "vertex array size mismatch"
+
+    flags = 0
+    normals = []
+    texcoords = []
+    if 'n' in channels:
+        flags |= FLAG_NORMALS
+        normals = parse_float_array(source, prefix + 'Normals')
+        assert len(normals) == 3 * vertex_count, "normal array size mismatch"
+    if 't' in channels:
+        flags |= FLAG_TEXCOORDS
+        texcoords = parse_float_array(source, prefix + 'TexCoords')
+        assert len(texcoords) == 2 * vertex_count, "texcoord array size mismatch"
+
+    with open(out_path, 'wb') as out_file:
+        out_file.write(struct.pack(
+            '<IIII', PSMESH_MAGIC, PSMESH_VERSION, vertex_count, flags))
+        out_file.write(struct.pack('<%df' % len(vertices), *vertices))
+        if normals:
+            out_file.write(struct.pack('<%df' % len(normals), *normals))
+        if texcoords:
+            out_file.write(struct.pack('<%df' % len(texcoords), *texcoords))
+
+    print('%s: %d vertices -> %s' % (prefix, vertex_count, out_path))
+
+
+if __name__ == '__main__':
+    main()
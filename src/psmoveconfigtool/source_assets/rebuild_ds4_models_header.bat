@@ -1,3 +1,5 @@
 perl ../../../thirdparty/HBehrens-obj2opengl/obj2opengl.pl -noScale -noMove -nameOfObject ds4body DS4/ds4.obj
 perl ../../../thirdparty/HBehrens-obj2opengl/obj2opengl.pl -noScale -noMove -nameOfObject ds4lightbar DS4/lightbar.obj
+python model_header_to_psmesh.py DS4/ds4.h ds4body ../assets/models/ds4body.psmesh vt
+python model_header_to_psmesh.py DS4/lightbar.h ds4lightbar ../assets/models/ds4lightbar.psmesh v
 pause
\ No newline at end of file
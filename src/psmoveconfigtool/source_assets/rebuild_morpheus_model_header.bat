@@ -1,2 +1,3 @@
 perl ../../../thirdparty/HBehrens-obj2opengl/obj2opengl.pl -noScale -noMove -nameOfObject morpheus Morpheus/morpheus2.obj
+python model_header_to_psmesh.py Morpheus/morpheus2.h morpheus ../assets/models/morpheus.psmesh vt
 pause
\ No newline at end of file
@@ -1,2 +1,3 @@
 perl ../../../thirdparty/HBehrens-obj2opengl/obj2opengl.pl -noScale -noMove -nameOfObject ps3eye PS3EyeCamera.obj
+python model_header_to_psmesh.py PS3EyeCamera.h ps3eye ../assets/models/ps3eye.psmesh vn
 pause
\ No newline at end of file
@@ -1,3 +1,5 @@
 perl ../../../thirdparty/HBehrens-obj2opengl/obj2opengl.pl -noScale -noMove -nameOfObject psmovebody PSMoveMotionControllerBody.obj
 perl ../../../thirdparty/HBehrens-obj2opengl/obj2opengl.pl -noScale -noMove -nameOfObject psmovebulb PSMoveMotionControllerBulb.obj
+python model_header_to_psmesh.py PSMoveMotionControllerBody.h psmovebody ../assets/models/psmovebody.psmesh vt
+python model_header_to_psmesh.py PSMoveMotionControllerBulb.h psmovebulb ../assets/models/psmovebulb.psmesh vt
 pause
\ No newline at end of file
@@ -1,2 +1,3 @@
 perl ../../../thirdparty/HBehrens-obj2opengl/obj2opengl.pl -noScale -noMove -nameOfObject psnavi PSNaviController.obj
+python model_header_to_psmesh.py PSNaviController.h psnavi ../assets/models/psnavi.psmesh vt
 pause
\ No newline at end of file
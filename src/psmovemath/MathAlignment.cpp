@@ -306,6 +306,100 @@ eigen_alignment_fit_min_volume_ellipsoid(
     }
 }
 
+void
+eigen_alignment_ellipsoid_fit_scatter_reset(
+    Eigen::Matrix<double, 10, 10> &scatter)
+{
+    scatter.setZero();
+}
+
+void
+eigen_alignment_ellipsoid_fit_scatter_add_sample(
+    Eigen::Matrix<double, 10, 10> &scatter,
+    const Eigen::Vector3f &point)
+{
+    const double x = static_cast<double>(point.x());
+    const double y = static_cast<double>(point.y());
+    const double z = static_cast<double>(point.z());
+
+    // Design vector for the general quadric:
+    // Ax^2 + By^2 + Cz^2 + Dxy + Exz + Fyz + Gx + Hy + Iz + J = 0
+    Eigen::Matrix<double, 10, 1> D;
+    D << x*x, y*y, z*z, x*y, x*z, y*z, x, y, z, 1.0;
+
+    // Rank-1 update of the scatter matrix: scatter = sum(D*D')
+    scatter += D * D.transpose();
+}
+
+// Minimize |scatter_design_matrix * quadric_params| via the eigenvector of the
+// scatter matrix with the smallest eigenvalue, then recover center/basis/extents
+// from the quadric coefficients.
+bool
+eigen_alignment_fit_least_squares_ellipsoid(
+    const Eigen::Matrix<double, 10, 10> &scatter,
+    EigenFitEllipsoid &out_ellipsoid)
+{
+    bool success = false;
+
+    const Eigen::SelfAdjointEigenSolver<Eigen::Matrix<double, 10, 10>> solver(scatter);
+
+    if (solver.info() == Eigen::Success)
+    {
+        // Eigenvalues come back sorted ascending - the smallest one's
+        // eigenvector is the least-squares quadric solution
+        const Eigen::Matrix<double, 10, 1> v = solver.eigenvectors().col(0);
+
+        // Quadric matrix form: p'*A*p + 2*b'*p + c = 0
+        Eigen::Matrix3d A;
+        A << v(0), v(3) / 2.0, v(4) / 2.0,
+             v(3) / 2.0, v(1), v(5) / 2.0,
+             v(4) / 2.0, v(5) / 2.0, v(2);
+        const Eigen::Vector3d b(v(6) / 2.0, v(7) / 2.0, v(8) / 2.0);
+        const double c = v(9);
+
+        const double det_A = A.determinant();
+
+        if (fabs(det_A) > k_real64_epsilon)
+        {
+            // The quadric center is where the gradient vanishes: A*center = -b
+            const Eigen::Vector3d center = A.fullPivLu().solve(-b);
+
+            // Normalization constant so that (p-center)'*(A/k)*(p-center) = 1
+            const double k = -(c + b.dot(center));
+
+            if (fabs(k) > k_real64_epsilon)
+            {
+                const Eigen::Matrix3d A_norm = A / k;
+                const Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> axis_solver(A_norm);
+
+                if (axis_solver.info() == Eigen::Success)
+                {
+                    const Eigen::Vector3d eigenvalues = axis_solver.eigenvalues();
+
+                    // All eigenvalues positive means the quadric really is an
+                    // ellipsoid (not a hyperboloid/paraboloid from a degenerate
+                    // sample set)
+                    if (eigenvalues(0) > 0.0 && eigenvalues(1) > 0.0 && eigenvalues(2) > 0.0)
+                    {
+                        out_ellipsoid.center = center.cast<float>();
+                        out_ellipsoid.basis = axis_solver.eigenvectors().cast<float>();
+                        out_ellipsoid.extents =
+                            Eigen::Vector3f(
+                                static_cast<float>(1.0 / sqrt(eigenvalues(0))),
+                                static_cast<float>(1.0 / sqrt(eigenvalues(1))),
+                                static_cast<float>(1.0 / sqrt(eigenvalues(2))));
+                        out_ellipsoid.error = 0.f;
+
+                        success = true;
+                    }
+                }
+            }
+        }
+    }
+
+    return success;
+}
+
 Eigen::Vector3f
 eigen_alignment_project_point_on_ellipsoid_basis(
     const Eigen::Vector3f &point,
@@ -369,20 +463,25 @@ eigen_alignment_fit_least_squares_ellipse(
     bool bSuccess = false;
 
     // See http://autotrace.sourceforge.net/WSCG98.pdf
-    Eigen::MatrixXf D1(point_count, 3);
-    Eigen::MatrixXf D2(point_count, 3);
+    // Accumulate the scatter matrices S1 = D1'*D1, S2 = D1'*D2 and S3 = D2'*D2
+    // in one pass over the points instead of building the point_count x 3
+    // design matrices on the heap and multiplying them out. The fixed size
+    // outer products get vectorized by Eigen and the per-call dynamic matrix
+    // allocations disappear from the vision hot path.
+    Eigen::Matrix3f S1 = Eigen::Matrix3f::Zero();
+    Eigen::Matrix3f S2 = Eigen::Matrix3f::Zero();
+    Eigen::Matrix3f S3 = Eigen::Matrix3f::Zero();
     for (int ix = 0; ix < point_count; ++ix) {
-        D1.row(ix)[0] = points[ix].x() * points[ix].x();
-        D1.row(ix)[1] = points[ix].x() * points[ix].y();
-        D1.row(ix)[2] = points[ix].y() * points[ix].y();
-        D2.row(ix)[0] = points[ix].x();
-        D2.row(ix)[1] = points[ix].y();
-        D2.row(ix)[2] = 1;
+        const float x = points[ix].x();
+        const float y = points[ix].y();
+        const Eigen::Vector3f quadratic_terms(x*x, x*y, y*y);
+        const Eigen::Vector3f linear_terms(x, y, 1.f);
+
+        S1.noalias() += quadratic_terms * quadratic_terms.transpose();
+        S2.noalias() += quadratic_terms * linear_terms.transpose();
+        S3.noalias() += linear_terms * linear_terms.transpose();
     }
 
-    Eigen::Matrix3f S1 = D1.transpose() * D1;
-    Eigen::Matrix3f S2 = D1.transpose() * D2;
-    Eigen::Matrix3f S3 = D2.transpose() * D2;
     Eigen::Matrix3f T = -S3.colPivHouseholderQr().solve(S2.transpose());
     //                        Eigen::Matrix3f T = -S3.inverse() * S2.transpose();
     Eigen::Matrix3f M = S2*T + S1;
@@ -712,8 +811,10 @@ eigen_quaternion_compute_normalized_weighted_average(
     else if (count > 2)
     {
         // http://stackoverflow.com/questions/12374087/average-of-multiple-quaternions
-        Eigen::MatrixXf q(4, count);
-        Eigen::MatrixXf q_transpose(count, 4);
+        // Accumulate the 4x4 moment matrix M = sum(q_i * q_i^T) from fixed-size
+        // outer products rather than materializing 4xN scratch matrices.
+        // This gets called from per-frame filter code so it must not allocate.
+        Eigen::Matrix4f M= Eigen::Matrix4f::Zero();
 
         float total_weight= 0.f;
 		if (weights != nullptr)
@@ -732,39 +833,23 @@ eigen_quaternion_compute_normalized_weighted_average(
 			const float weight = (weights != nullptr) ? weights[index] : 0.f;
             const float normalized_weight= safe_divide_with_default(weight, total_weight, 1.f);
 
-            const float w= sample.w() * normalized_weight;
-            const float x= sample.x() * normalized_weight;
-            const float y= sample.y() * normalized_weight;
-            const float z= sample.z() * normalized_weight;
+            const Eigen::Vector4f q(
+                sample.w() * normalized_weight,
+                sample.x() * normalized_weight,
+                sample.y() * normalized_weight,
+                sample.z() * normalized_weight);
 
-            q(0, index) = w;
-            q(1, index) = x;
-            q(2, index) = y;
-            q(3, index) = z;
-
-            q_transpose(index, 0) = w;
-            q_transpose(index, 1) = x;
-            q_transpose(index, 2) = y;
-            q_transpose(index, 3) = z;
+            M.noalias() += q * q.transpose();
         }
 
-        Eigen::Matrix4f M= q*q_transpose;
-
-        Eigen::EigenSolver<Eigen::Matrix4f> eigsolv(M);
+        // M is symmetric by construction so the self adjoint solver applies.
+        // It works entirely in real arithmetic (the general EigenSolver goes
+        // through complex eigenvalues) and sorts the eigenvalues ascending,
+        // so the dominant eigenvector is always the last column.
+        Eigen::SelfAdjointEigenSolver<Eigen::Matrix4f> eigsolv(M);
         if (eigsolv.info() == Eigen::Success)
         {
-            int largest_row = 0;
-            float largest_eigenvalue = eigsolv.eigenvalues()[0].real();
-            for (int row_ix = 1; row_ix < 4; ++row_ix) 
-            {
-                if (eigsolv.eigenvalues()[row_ix].real() > largest_eigenvalue)
-                {
-                    largest_eigenvalue = eigsolv.eigenvalues()[row_ix].real();
-                    largest_row = row_ix;
-                }                
-            }
-
-            Eigen::Vector4f largest_eigenvector = eigsolv.eigenvectors().col(largest_row).real();
+            Eigen::Vector4f largest_eigenvector = eigsolv.eigenvectors().col(3);
             float w= largest_eigenvector(0);
             float x= largest_eigenvector(1);
             float y= largest_eigenvector(2);
@@ -795,8 +880,10 @@ eigen_quaternion_compute_weighted_average(
     else
     {
         // http://stackoverflow.com/questions/12374087/average-of-multiple-quaternions
-        Eigen::MatrixXd q(4, count);
-        Eigen::MatrixXd q_transpose(count, 4);
+        // Accumulate the 4x4 moment matrix M = sum(q_i * q_i^T) from fixed-size
+        // outer products rather than materializing 4xN scratch matrices.
+        // This gets called from per-tick filter code so it must not allocate.
+        Eigen::Matrix4d M= Eigen::Matrix4d::Zero();
 
         for (int index = 0; index < count; ++index)
         {
@@ -804,41 +891,23 @@ eigen_quaternion_compute_weighted_average(
 			const double signed_weight= (weights != nullptr) ? weights[index] : 1.f;
             const double unsigned_weight= fabs(signed_weight);
 
-            const double w= sample.w() * unsigned_weight;
-			// For negative weights, use the conjugate of the quaternion 
+			// For negative weights, use the conjugate of the quaternion
 			// (i.e. flip the rotation axis)
-            const double x= sample.x() * signed_weight;
-            const double y= sample.y() * signed_weight;
-            const double z= sample.z() * signed_weight;
-
-            q(0, index) = w;
-            q(1, index) = x;
-            q(2, index) = y;
-            q(3, index) = z;
-
-            q_transpose(index, 0) = w;
-            q_transpose(index, 1) = x;
-            q_transpose(index, 2) = y;
-            q_transpose(index, 3) = z;
-        }
+            const Eigen::Vector4d q(
+                sample.w() * unsigned_weight,
+                sample.x() * signed_weight,
+                sample.y() * signed_weight,
+                sample.z() * signed_weight);
 
-        Eigen::Matrix4d M= q*q_transpose;
+            M.noalias() += q * q.transpose();
+        }
 
-        Eigen::EigenSolver<Eigen::Matrix4d> eigsolv(M);
+        // See the float variant above: M is symmetric, so use the real-valued
+        // self adjoint solver and take the last (largest eigenvalue) column.
+        Eigen::SelfAdjointEigenSolver<Eigen::Matrix4d> eigsolv(M);
         if (eigsolv.info() == Eigen::Success)
         {
-            int largest_row = 0;
-            double largest_eigenvalue = eigsolv.eigenvalues()[0].real();
-            for (int row_ix = 1; row_ix < 4; ++row_ix) 
-            {
-                if (eigsolv.eigenvalues()[row_ix].real() > largest_eigenvalue)
-                {
-                    largest_eigenvalue = eigsolv.eigenvalues()[row_ix].real();
-                    largest_row = row_ix;
-                }                
-            }
-
-            Eigen::Vector4d largest_eigenvector = eigsolv.eigenvectors().col(largest_row).real();
+            Eigen::Vector4d largest_eigenvector = eigsolv.eigenvectors().col(3);
             double w= largest_eigenvector(0);
             double x= largest_eigenvector(1);
             double y= largest_eigenvector(2);
@@ -852,7 +921,61 @@ eigen_quaternion_compute_weighted_average(
     return success;
 }
 
-void 
+bool
+eigen_quaternion_compute_weighted_average(
+    const Eigen::Quaternionf *quaternions,
+    const float *weights,
+    const int count,
+    Eigen::Quaternionf *out_result)
+{
+    bool success = false;
+
+    if (count == 1)
+    {
+        *out_result= quaternions[0];
+        success= true;
+    }
+    else
+    {
+        // Same signed-weight moment matrix accumulation as the double
+        // variant above, in single precision
+        Eigen::Matrix4f M= Eigen::Matrix4f::Zero();
+
+        for (int index = 0; index < count; ++index)
+        {
+            const Eigen::Quaternionf &sample = quaternions[index];
+			const float signed_weight= (weights != nullptr) ? weights[index] : 1.f;
+            const float unsigned_weight= fabsf(signed_weight);
+
+			// For negative weights, use the conjugate of the quaternion
+			// (i.e. flip the rotation axis)
+            const Eigen::Vector4f q(
+                sample.w() * unsigned_weight,
+                sample.x() * signed_weight,
+                sample.y() * signed_weight,
+                sample.z() * signed_weight);
+
+            M.noalias() += q * q.transpose();
+        }
+
+        Eigen::SelfAdjointEigenSolver<Eigen::Matrix4f> eigsolv(M);
+        if (eigsolv.info() == Eigen::Success)
+        {
+            Eigen::Vector4f largest_eigenvector = eigsolv.eigenvectors().col(3);
+            float w= largest_eigenvector(0);
+            float x= largest_eigenvector(1);
+            float y= largest_eigenvector(2);
+            float z= largest_eigenvector(3);
+
+            *out_result= Eigen::Quaternionf(w, x, y, z).normalized();
+            success= true;
+        }
+    }
+
+    return success;
+}
+
+void
 eigen_vector3f_compute_mean_and_variance(
 	const Eigen::Vector3f *samples,
     const int sample_count,
@@ -1094,3 +1217,47 @@ eigen_alignment_project_points_on_plane(
 
 	return total_error;
 }
+
+bool
+eigen_alignment_compute_point_closest_to_rays(
+	const Eigen::Vector3f *ray_origins,
+	const Eigen::Vector3f *ray_directions,
+	const int ray_count,
+	Eigen::Vector3f *out_point)
+{
+	bool bSuccess= false;
+
+	if (ray_count >= 2)
+	{
+		// Minimizing the summed squared distance to every ray leads to the
+		// normal equations A*x = b where each ray contributes its
+		// perpendicular projector (I - d*d^T) to A and that projector applied
+		// to its origin to b. Everything accumulates into fixed-size
+		// matrices, so the whole solve is allocation free.
+		Eigen::Matrix3f A= Eigen::Matrix3f::Zero();
+		Eigen::Vector3f b= Eigen::Vector3f::Zero();
+
+		for (int ray_index = 0; ray_index < ray_count; ++ray_index)
+		{
+			const Eigen::Vector3f &direction= ray_directions[ray_index];
+			assert_eigen_vector3f_is_normalized(direction);
+
+			const Eigen::Matrix3f projector=
+				Eigen::Matrix3f::Identity() - direction*direction.transpose();
+
+			A.noalias() += projector;
+			b.noalias() += projector*ray_origins[ray_index];
+		}
+
+		// A is singular when all of the rays are parallel - there is no
+		// unique closest point along the shared direction
+		if (!is_nearly_zero(A.determinant()))
+		{
+			// A is symmetric positive definite here, so a Cholesky factorization applies
+			*out_point= A.ldlt().solve(b);
+			bSuccess= true;
+		}
+	}
+
+	return bSuccess;
+}
@@ -74,6 +74,25 @@ eigen_alignment_fit_min_volume_ellipsoid(
     const float tolerance,
     EigenFitEllipsoid &out_ellipsoid);
 
+// Incremental least-squares ellipsoid fitting.
+// Accumulate samples one at a time into a 10x10 scatter matrix, then solve
+// for the best fit quadric whenever a refreshed ellipsoid is wanted.
+// The per-sample accumulation is O(1) so the fit can be maintained live
+// while samples stream in.
+void
+eigen_alignment_ellipsoid_fit_scatter_reset(
+    Eigen::Matrix<double, 10, 10> &scatter);
+
+void
+eigen_alignment_ellipsoid_fit_scatter_add_sample(
+    Eigen::Matrix<double, 10, 10> &scatter,
+    const Eigen::Vector3f &point);
+
+bool
+eigen_alignment_fit_least_squares_ellipsoid(
+    const Eigen::Matrix<double, 10, 10> &scatter,
+    EigenFitEllipsoid &out_ellipsoid);
+
 Eigen::Vector3f
 eigen_alignment_project_point_on_ellipsoid_basis(
     const Eigen::Vector3f &point,
@@ -140,6 +159,14 @@ eigen_quaternion_compute_weighted_average(
     const int count,
     Eigen::Quaterniond *out_result);
 
+// Single precision overload for filter code built with a float FilterScalar
+bool
+eigen_quaternion_compute_weighted_average(
+    const Eigen::Quaternionf *quaternions,
+    const float *weights,
+    const int count,
+    Eigen::Quaternionf *out_result);
+
 void 
 eigen_vector3f_compute_mean_and_variance(
 	const Eigen::Vector3f *samples,
@@ -171,4 +198,15 @@ eigen_alignment_project_points_on_plane(
 	const Eigen::Vector3f &centroid, const Eigen::Vector3f &normal,
 	Eigen::Vector3f *samples, const int sample_count);
 
+// Computes the point with the smallest summed squared distance to a batch of
+// rays (i.e. triangulation from N cameras) in a single 3x3 linear solve.
+// Ray directions are assumed normalized.
+// Fails when the rays are parallel (or there are fewer than two).
+bool
+eigen_alignment_compute_point_closest_to_rays(
+	const Eigen::Vector3f *ray_origins,
+	const Eigen::Vector3f *ray_directions,
+	const int ray_count,
+	Eigen::Vector3f *out_point);
+
 #endif // MATH_UTILITY_H
@@ -20,15 +20,6 @@ eigen_quaternion_angle_axis(float radians, const Eigen::Vector3f &axis)
 	return Eigen::Quaternionf(Eigen::AngleAxisf(radians, axis));
 }
 
-Eigen::Quaternionf
-eigen_quaternion_normalized_lerp(const Eigen::Quaternionf &a, const Eigen::Quaternionf &b, const float u)
-{	
-	Eigen::Quaternionf q(a.coeffs()*(1.f - u) + b.coeffs()*u);
-	q.normalize();
-
-	return q;
-}
-
 Eigen::Quaternionf
 eigen_quaternion_safe_divide_with_default(const Eigen::Quaternionf &q, const float divisor, const Eigen::Quaternionf &default_result)
 {
@@ -161,17 +152,6 @@ eigen_vector3d_normalize_with_default(Eigen::Vector3d &v, const Eigen::Vector3d
 	return length;
 }
 
-float
-eigen_quaternion_unsigned_angle_between(const Eigen::Quaternionf &a, const Eigen::Quaternionf &b)
-{
-	assert_eigen_quaternion_is_normalized(a);
-	assert_eigen_quaternion_is_normalized(b);
-
-	const float radian_diff = fabsf(a.angularDistance(b));
-
-	return radian_diff;
-}
-
 Eigen::Quaternionf
 eigen_angular_velocity_to_quaternion_derivative(
 	const Eigen::Quaternionf &current_orientation,
@@ -94,8 +94,16 @@ eigen_quaternion_concatenate(const Eigen::Quaternion<T> &first, const Eigen::Qua
 	return first * second;
 }
 
-Eigen::Quaternionf
-eigen_quaternion_normalized_lerp(const Eigen::Quaternionf &a, const Eigen::Quaternionf &b, const float u);
+// Inlined - called every filter tick and small enough that the coefficient
+// blend should fold into the caller without a temporary quaternion.
+inline Eigen::Quaternionf
+eigen_quaternion_normalized_lerp(const Eigen::Quaternionf &a, const Eigen::Quaternionf &b, const float u)
+{
+	Eigen::Quaternionf q(a.coeffs()*(1.f - u) + b.coeffs()*u);
+	q.normalize();
+
+	return q;
+}
 
 Eigen::Quaternionf
 eigen_quaternion_safe_divide_with_default(const Eigen::Quaternionf &q, const float divisor, const Eigen::Quaternionf &default_result);
@@ -139,8 +147,17 @@ eigen_vector3f_normalize_with_default(Eigen::Vector3f &v, const Eigen::Vector3f
 double 
 eigen_vector3d_normalize_with_default(Eigen::Vector3d &v, const Eigen::Vector3d &default_value);
 
-float
-eigen_quaternion_unsigned_angle_between(const Eigen::Quaternionf &a, const Eigen::Quaternionf &b);
+// Inlined - per-tick angular distance check in the orientation filters
+inline float
+eigen_quaternion_unsigned_angle_between(const Eigen::Quaternionf &a, const Eigen::Quaternionf &b)
+{
+	assert_eigen_quaternion_is_normalized(a);
+	assert_eigen_quaternion_is_normalized(b);
+
+	const float radian_diff = fabsf(a.angularDistance(b));
+
+	return radian_diff;
+}
 
 Eigen::Quaternionf
 eigen_angular_velocity_to_quaternion_derivative(
@@ -180,5 +197,65 @@ eigen_quaterniond_to_euler_angles(const Eigen::Quaterniond &q);
 Eigen::EulerAnglesf
 eigen_quaternionf_to_euler_angles(const Eigen::Quaternionf &q);
 
+//-- scalar-generic overloads -----
+// Same-name overloads of the float/double helper pairs above, for code whose
+// scalar type is selected at compile time (e.g. the Kalman filter internals).
+inline Eigen::Vector3f
+eigen_vector3_clockwise_rotate(const Eigen::Quaternionf &q, const Eigen::Vector3f &v)
+{
+	return eigen_vector3f_clockwise_rotate(q, v);
+}
+
+inline Eigen::Vector3d
+eigen_vector3_clockwise_rotate(const Eigen::Quaterniond &q, const Eigen::Vector3d &v)
+{
+	return eigen_vector3d_clockwise_rotate(q, v);
+}
+
+inline float
+eigen_vector3_normalize_with_default(Eigen::Vector3f &v, const Eigen::Vector3f &default_value)
+{
+	return eigen_vector3f_normalize_with_default(v, default_value);
+}
+
+inline double
+eigen_vector3_normalize_with_default(Eigen::Vector3d &v, const Eigen::Vector3d &default_value)
+{
+	return eigen_vector3d_normalize_with_default(v, default_value);
+}
+
+inline Eigen::Quaterniond
+eigen_angular_velocity_to_quaternion_derivative(
+	const Eigen::Quaterniond &current_orientation,
+	const Eigen::Vector3d &ang_vel)
+{
+	return eigen_angular_velocity_to_quaterniond_derivative(current_orientation, ang_vel);
+}
+
+inline Eigen::Vector3d
+eigen_quaternion_derivative_to_angular_velocity(
+	const Eigen::Quaterniond &current_orientation,
+	const Eigen::Quaterniond &quaternion_derivative)
+{
+	return eigen_quaterniond_derivative_to_angular_velocity(current_orientation, quaternion_derivative);
+}
+
+inline Eigen::Quaterniond
+eigen_angle_axis_to_quaternion(const Eigen::Vector3d &angle_axis)
+{
+	return eigen_angle_axis_to_quaterniond(angle_axis);
+}
+
+inline Eigen::EulerAnglesf
+eigen_quaternion_to_euler_angles(const Eigen::Quaternionf &q)
+{
+	return eigen_quaternionf_to_euler_angles(q);
+}
+
+inline Eigen::EulerAnglesd
+eigen_quaternion_to_euler_angles(const Eigen::Quaterniond &q)
+{
+	return eigen_quaterniond_to_euler_angles(q);
+}
 
 #endif // MATH_EIGEN_H
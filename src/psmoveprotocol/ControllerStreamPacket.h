@@ -0,0 +1,273 @@
+#ifndef CONTROLLER_STREAM_PACKET_H
+#define CONTROLLER_STREAM_PACKET_H
+
+//-- includes -----
+#include "ProtocolVersion.h"
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+//-- constants -----
+// First byte of every controller stream packet.
+// The high bit is always set so the byte can never collide with the low
+// field-tag bytes that start a serialized protobuf DeviceOutputDataFrame,
+// which is how the client tells the two payload formats apart.
+#define CONTROLLER_STREAM_PACKET_MAGIC 0xB1
+
+// First byte of a delta-encoded controller stream record (see
+// ControllerStreamDeltaHeader below). High bit set for the same reason.
+#define CONTROLLER_STREAM_DELTA_MAGIC 0xB2
+
+// Must match TrackerManager::k_max_devices
+#define CONTROLLER_STREAM_PACKET_MAX_TRACKERS 4
+
+// Which optional data blocks in the packet contain valid data
+#define CONTROLLER_STREAM_PACKET_FLAG_CONNECTED 0x01
+#define CONTROLLER_STREAM_PACKET_FLAG_HAS_RAW_SENSOR_DATA 0x02
+#define CONTROLLER_STREAM_PACKET_FLAG_HAS_CALIBRATED_SENSOR_DATA 0x04
+#define CONTROLLER_STREAM_PACKET_FLAG_HAS_RAW_TRACKER_DATA 0x08
+#define CONTROLLER_STREAM_PACKET_FLAG_HAS_PHYSICS_DATA 0x10
+
+enum eControllerStreamPacketControllerType
+{
+    ControllerStreamPacketControllerType_PSMove= 0,
+    ControllerStreamPacketControllerType_PSNavi= 1,
+    ControllerStreamPacketControllerType_PSDualShock4= 2
+};
+
+enum eControllerStreamPacketProjectionType
+{
+    ControllerStreamPacketProjectionType_Invalid= 0,
+    ControllerStreamPacketProjectionType_Ellipse= 1,
+    ControllerStreamPacketProjectionType_LightBar= 2
+};
+
+//-- definitions -----
+// A fixed-layout binary alternative to the protobuf DeviceOutputDataFrame
+// controller data packet, used on the high frequency UDP streaming path only.
+// The control channel (requests, responses and notifications) stays protobuf.
+//
+// The layout is read in place on the client with no parse step and no
+// allocations, so it must be identical on both ends of the wire:
+// * Every member is naturally aligned and padding is always explicit,
+//   which gives the same layout under MSVC, GCC and Clang.
+// * Multi-byte members are stored in host byte order. Server and client
+//   both run on little-endian hardware for every supported platform.
+// * Any change to these structs must bump PSM_CONTROLLER_STREAM_PACKET_VERSION
+//   in ProtocolVersion.h. The client drops packets whose version byte
+//   doesn't match the one it was compiled against.
+
+struct ControllerStreamPacket_Vector3f
+{
+    float i, j, k;
+};
+
+struct ControllerStreamPacket_Vector3i
+{
+    int32_t i, j, k;
+};
+
+struct ControllerStreamPacket_Position
+{
+    float x, y, z;
+};
+
+struct ControllerStreamPacket_Quaternion
+{
+    float w, x, y, z;
+};
+
+struct ControllerStreamPacket_Pixel
+{
+    float x, y;
+};
+
+struct ControllerStreamPacket_PhysicsData
+{
+    ControllerStreamPacket_Vector3f velocity_cm_per_sec;
+    ControllerStreamPacket_Vector3f acceleration_cm_per_sec_sqr;
+    ControllerStreamPacket_Vector3f angular_velocity_rad_per_sec;
+    ControllerStreamPacket_Vector3f angular_acceleration_rad_per_sec_sqr;
+};
+
+struct ControllerStreamPacket_TrackingProjection
+{
+    int32_t shape_type; // eControllerStreamPacketProjectionType
+
+    union
+    {
+        struct
+        {
+            ControllerStreamPacket_Pixel center;
+            float half_x_extent;
+            float half_y_extent;
+            float angle;
+        } ellipse;
+
+        struct
+        {
+            ControllerStreamPacket_Pixel triangle[3];
+            ControllerStreamPacket_Pixel quad[4];
+        } lightbar;
+    } shape;
+};
+
+struct ControllerStreamPacket_RawTrackerData
+{
+    int32_t valid_tracker_count;
+    int32_t tracker_ids[CONTROLLER_STREAM_PACKET_MAX_TRACKERS];
+    ControllerStreamPacket_Pixel screen_locations[CONTROLLER_STREAM_PACKET_MAX_TRACKERS];
+    ControllerStreamPacket_Position relative_positions_cm[CONTROLLER_STREAM_PACKET_MAX_TRACKERS];
+    // Identity for controllers whose projection carries no orientation (PSMove)
+    ControllerStreamPacket_Quaternion relative_orientations[CONTROLLER_STREAM_PACKET_MAX_TRACKERS];
+    ControllerStreamPacket_TrackingProjection projections[CONTROLLER_STREAM_PACKET_MAX_TRACKERS];
+    ControllerStreamPacket_Position multicam_position_cm;
+    ControllerStreamPacket_Quaternion multicam_orientation;
+    uint8_t bValidMulticamPosition;
+    uint8_t bValidMulticamOrientation;
+    uint8_t pad[2];
+};
+
+struct ControllerStreamPacket_PSMoveState
+{
+    ControllerStreamPacket_Quaternion orientation;
+    ControllerStreamPacket_Position position_cm;
+    ControllerStreamPacket_Vector3i raw_magnetometer;
+    ControllerStreamPacket_Vector3i raw_accelerometer;
+    ControllerStreamPacket_Vector3i raw_gyroscope;
+    ControllerStreamPacket_Vector3f calibrated_magnetometer;
+    ControllerStreamPacket_Vector3f calibrated_accelerometer;
+    ControllerStreamPacket_Vector3f calibrated_gyroscope;
+    ControllerStreamPacket_PhysicsData physics_data;
+    ControllerStreamPacket_RawTrackerData raw_tracker_data;
+    uint8_t bValidHardwareCalibration;
+    uint8_t bIsCurrentlyTracking;
+    uint8_t bIsTrackingEnabled;
+    uint8_t bIsOrientationValid;
+    uint8_t bIsPositionValid;
+    uint8_t trigger_value;
+    uint8_t pad[2];
+};
+
+struct ControllerStreamPacket_PSNaviState
+{
+    uint8_t trigger_value;
+    uint8_t stick_xaxis;
+    uint8_t stick_yaxis;
+    uint8_t pad;
+};
+
+struct ControllerStreamPacket_PSDualShock4State
+{
+    ControllerStreamPacket_Quaternion orientation;
+    ControllerStreamPacket_Position position_cm;
+    ControllerStreamPacket_Vector3i raw_accelerometer;
+    ControllerStreamPacket_Vector3i raw_gyroscope;
+    ControllerStreamPacket_Vector3f calibrated_accelerometer;
+    ControllerStreamPacket_Vector3f calibrated_gyroscope;
+    float left_thumbstick_x;
+    float left_thumbstick_y;
+    float right_thumbstick_x;
+    float right_thumbstick_y;
+    float left_trigger_value;
+    float right_trigger_value;
+    ControllerStreamPacket_PhysicsData physics_data;
+    ControllerStreamPacket_RawTrackerData raw_tracker_data;
+    uint8_t bValidHardwareCalibration;
+    uint8_t bIsCurrentlyTracking;
+    uint8_t bIsTrackingEnabled;
+    uint8_t bIsOrientationValid;
+    uint8_t bIsPositionValid;
+    uint8_t pad[3];
+};
+
+struct ControllerStreamPacket
+{
+    uint8_t magic; // CONTROLLER_STREAM_PACKET_MAGIC
+    uint8_t version; // PSM_CONTROLLER_STREAM_PACKET_VERSION
+    uint8_t controller_type; // eControllerStreamPacketControllerType
+    uint8_t flags; // CONTROLLER_STREAM_PACKET_FLAG_*
+    int32_t controller_id;
+    int32_t sequence_num;
+    // Same bit assignments as the protobuf ControllerDataPacket ButtonType enum
+    uint32_t button_down_bitmask;
+
+    // Rolling tracking quality telemetry, EMA smoothed on the service
+    // (see ServerControllerView::updateTrackingQuality).
+    // tracking_quality is a 0..1 composite of the raw metrics below;
+    // 0 = not tracking, 1 = clean lock
+    float tracking_quality;
+    // Goodness-of-fit of the contributing 2D projections. Shape dependent
+    // units: mean algebraic ellipse residual per contour point for spheres,
+    // mean corner reprojection error in pixels for lightbars
+    float avg_projection_fit_error;
+    // Worst distance from the blended multicam position to any contributing
+    // tracker's observation ray (0 with fewer than two trackers)
+    float avg_multicam_disagreement_cm;
+    // Distance between the optical observation and the pose filter's
+    // prediction at the time the observation arrived
+    float avg_filter_innovation_cm;
+    // Steady clock timestamp (microseconds) taken on the service when this
+    // packet was generated. Clients echo the newest value back in their next
+    // DeviceInputDataFrame so the service can measure per-connection
+    // delivery latency. Carved out of the old 16 byte reserved block, which
+    // the layout rules above permit without a version bump.
+    uint64_t service_timestamp_us;
+    // Id of the service publish pass this packet was generated on. Every
+    // device packet sent during one service tick carries the same id, so a
+    // client reading several devices can group packets back into coherent
+    // per-tick frames instead of matching timestamps. Truncated to 32 bits
+    // on the wire; coherence matching only ever compares ids a few ticks
+    // apart. Carved out of the reserved block, no version bump needed.
+    uint32_t publish_tick_id;
+    // Pads the fixed header out to a whole delta chunk; room for future
+    // telemetry without another version bump
+    uint8_t reserved[4];
+
+    union
+    {
+        ControllerStreamPacket_PSMoveState psmove;
+        ControllerStreamPacket_PSNaviState psnavi;
+        ControllerStreamPacket_PSDualShock4State psdualshock4;
+    } state;
+};
+typedef std::shared_ptr<ControllerStreamPacket> ControllerStreamPacketPtr;
+
+// A delta-encoded stream record. The packet is treated as an array of
+// fixed-size chunks; only the chunks that changed since the last keyframe
+// (a full ControllerStreamPacket) follow the header, lowest chunk first.
+// The receiver overlays them onto its stored copy of that keyframe and
+// drops the record if it never saw the keyframe the delta builds on.
+#define CONTROLLER_STREAM_DELTA_CHUNK_SIZE 32
+#define CONTROLLER_STREAM_DELTA_CHUNK_COUNT 20
+
+struct ControllerStreamDeltaHeader
+{
+    uint8_t magic; // CONTROLLER_STREAM_DELTA_MAGIC
+    uint8_t version; // PSM_CONTROLLER_STREAM_PACKET_VERSION
+    uint8_t chunk_count; // number of chunks following the header
+    uint8_t pad;
+    int32_t controller_id;
+    int32_t base_sequence_num; // sequence_num of the keyframe this applies to
+    uint32_t chunk_mask; // bit i set -> chunk i changed and is included
+};
+
+// A packed delta record (header + changed chunks) ready for the wire
+typedef std::shared_ptr<std::vector<uint8_t> > ControllerStreamDeltaBufferPtr;
+
+// Catch any compiler that doesn't produce the wire layout described above
+static_assert(sizeof(ControllerStreamPacket_Vector3f) == 12, "unexpected ControllerStreamPacket_Vector3f layout");
+static_assert(sizeof(ControllerStreamPacket_Vector3i) == 12, "unexpected ControllerStreamPacket_Vector3i layout");
+static_assert(sizeof(ControllerStreamPacket_Quaternion) == 16, "unexpected ControllerStreamPacket_Quaternion layout");
+static_assert(sizeof(ControllerStreamPacket_PhysicsData) == 48, "unexpected ControllerStreamPacket_PhysicsData layout");
+static_assert(sizeof(ControllerStreamPacket_TrackingProjection) == 60, "unexpected ControllerStreamPacket_TrackingProjection layout");
+static_assert(sizeof(ControllerStreamPacket_RawTrackerData) == 436, "unexpected ControllerStreamPacket_RawTrackerData layout");
+static_assert(sizeof(ControllerStreamPacket_PSMoveState) == 592, "unexpected ControllerStreamPacket_PSMoveState layout");
+static_assert(sizeof(ControllerStreamPacket_PSDualShock4State) == 592, "unexpected ControllerStreamPacket_PSDualShock4State layout");
+static_assert(sizeof(ControllerStreamPacket) == 640, "unexpected ControllerStreamPacket layout");
+static_assert(sizeof(ControllerStreamDeltaHeader) == 16, "unexpected ControllerStreamDeltaHeader layout");
+static_assert(
+    sizeof(ControllerStreamPacket) == CONTROLLER_STREAM_DELTA_CHUNK_SIZE*CONTROLLER_STREAM_DELTA_CHUNK_COUNT,
+    "stream packet must divide evenly into delta chunks");
+
+#endif // CONTROLLER_STREAM_PACKET_H
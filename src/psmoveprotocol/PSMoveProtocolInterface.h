@@ -7,6 +7,11 @@
 //-- constants -----
 #define MAX_OUTPUT_DATA_FRAME_MESSAGE_SIZE 500
 #define MAX_INPUT_DATA_FRAME_MESSAGE_SIZE 64
+
+// Size of a coalesced device data frame datagram. Multiple length-prefixed
+// data frame records get packed into one datagram up to this size, which is
+// kept under the common 1500 byte ethernet MTU to avoid IP fragmentation.
+#define MAX_OUTPUT_DATA_FRAME_DATAGRAM_SIZE 1400
  
 //-- pre-declarations -----
 namespace PSMoveProtocol
@@ -16,6 +21,7 @@ namespace PSMoveProtocol
 	class Request;
 	class Response;
 };
+struct ControllerStreamPacket;
 
 typedef std::shared_ptr<PSMoveProtocol::DeviceOutputDataFrame> DeviceOutputDataFramePtr;
 typedef std::shared_ptr<PSMoveProtocol::DeviceInputDataFrame> DeviceInputDataFramePtr;
@@ -33,6 +39,7 @@ class IDataFrameListener
 {
 public:
     virtual void handle_data_frame(const PSMoveProtocol::DeviceOutputDataFrame *data_frame) = 0;
+    virtual void handle_controller_stream_packet(const ControllerStreamPacket *packet) = 0;
 };
 
 class IResponseListener
@@ -42,4 +49,30 @@ public:
 	virtual void handle_response(ResponsePtr response) = 0;
 };
 
+/// Implemented by an in-process service host (see EmbeddedServiceHost in
+/// psmoveservice). A client that links the service can bind request handling
+/// directly to function calls through this interface instead of going
+/// through the network stack - see ClientPSMoveAPI::startup_embedded().
+class IEmbeddedServiceInterface
+{
+public:
+    /// Signature of the client callback that receives responses the service
+    /// emits outside of handle_request() (async completions, notifications)
+    typedef void (*t_embedded_response_callback)(ResponsePtr response, void *userdata);
+
+    /// Handle a request on the calling thread.
+    /// Returns the response, or nullptr if the request completes
+    /// asynchronously (its response arrives via the response callback)
+    virtual ResponsePtr handle_request(RequestPtr request) = 0;
+
+    /// Handle a device input data frame (rumble, LED overrides)
+    virtual void handle_input_data_frame(DeviceInputDataFramePtr data_frame) = 0;
+
+    /// Registers the callback for async responses and notifications
+    virtual void set_response_callback(t_embedded_response_callback callback, void *userdata) = 0;
+
+    /// Run one service tick (device polling, tracking, stream publishing)
+    virtual void update() = 0;
+};
+
 #endif  // PSMOVEPROTOCOL_INTERFACE_H
@@ -0,0 +1,37 @@
+#ifndef PROTOCOL_MESSAGE_ARENA_H
+#define PROTOCOL_MESSAGE_ARENA_H
+
+//-- includes -----
+#include <google/protobuf/arena.h>
+#include <memory>
+
+//-- helpers -----
+/// Allocate a protocol message on its own protobuf arena, returning a
+/// shared_ptr whose deleter frees the arena.
+///
+/// Every nested submessage, repeated field entry and string the message grows
+/// while being filled in comes out of the arena's block instead of being an
+/// individual heap allocation, and the whole tree is released with one free
+/// when the last reference drops. Response messages like the tracker list or
+/// service statistics carry dozens of submessages, so this turns dozens of
+/// mallocs per message into one.
+///
+/// The arena is owned by the returned pointer rather than being shared and
+/// reset per connection: responses sit in the asynchronous TCP write queue
+/// and requests cross to the service thread with shared_ptr lifetime, so
+/// there is no point at which a connection-wide arena is provably quiescent.
+template <typename t_message_type>
+std::shared_ptr<t_message_type> allocate_message_on_arena()
+{
+    google::protobuf::Arena *arena = new google::protobuf::Arena();
+    t_message_type *message = google::protobuf::Arena::CreateMessage<t_message_type>(arena);
+
+    return std::shared_ptr<t_message_type>(
+        message,
+        [arena](t_message_type *) {
+            // The message lives inside the arena; freeing the arena frees it
+            delete arena;
+        });
+}
+
+#endif // PROTOCOL_MESSAGE_ARENA_H
@@ -8,6 +8,23 @@
     #define PSM_STRINGIZE(x)     PSM_STRINGIZEIMPL(x)
 #endif
 
+/// Version of the fixed-layout controller stream packet format.
+/// Bump whenever the struct layout in ControllerStreamPacket.h changes.
+#define PSM_CONTROLLER_STREAM_PACKET_VERSION 2
+
+/// Capability bits a client advertises at connect for the streaming wire
+/// formats it can consume (see REGISTER_STREAM_CAPABILITIES). The server
+/// records the mask per connection and streams each client the cheapest
+/// format in the intersection with its own supported set, so new formats
+/// can roll out without lockstep upgrades of every machine.
+#define PSM_STREAM_FORMAT_FLAG_PROTOBUF 0x01
+#define PSM_STREAM_FORMAT_FLAG_PACKED   0x02
+#define PSM_STREAM_FORMAT_FLAG_DELTA    0x04
+
+/// Every streaming wire format this build can produce and consume
+#define PSM_SUPPORTED_STREAM_FORMATS_MASK \
+    (PSM_STREAM_FORMAT_FLAG_PROTOBUF | PSM_STREAM_FORMAT_FLAG_PACKED | PSM_STREAM_FORMAT_FLAG_DELTA)
+
 #define PSM_PRODUCT_VERSION 0
 #define PSM_MAJOR_VERSION   9
 #define PSM_PHASE           alpha
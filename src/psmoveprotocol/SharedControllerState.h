@@ -0,0 +1,87 @@
+#ifndef SHARED_CONTROLLER_STATE_H
+#define SHARED_CONTROLLER_STATE_H
+
+//-- includes -----
+#include "ControllerStreamPacket.h"
+
+#include <string.h>
+
+//-- definitions -----
+/// Lock-free shared memory ring of controller stream packets.
+/// The service writes every published update into the ring; same-host clients
+/// that opted in map the block and poll it directly, skipping the localhost
+/// UDP hop on the latency-critical driver path.
+///
+/// Each slot carries a write sequence counter that the writer bumps to an odd
+/// value before copying the packet in and back to an even value afterwards.
+/// A reader that sees an odd sequence, or a sequence that changed across its
+/// copy, discards the torn read and tries again on the next poll.
+class SharedControllerStateBuffer
+{
+public:
+    static const int k_slot_count= 4;
+
+    struct Slot
+    {
+        volatile unsigned int write_sequence; ///< odd while a write is in flight
+        ControllerStreamPacket packet;
+    };
+
+    SharedControllerStateBuffer()
+        : last_written_slot(-1)
+    {
+        memset(slots, 0, sizeof(slots));
+    }
+
+    /// Index of the most recently completed slot, -1 until the first write.
+    /// Published after the slot contents so readers never chase an unwritten slot.
+    volatile int last_written_slot;
+
+    Slot slots[k_slot_count];
+
+    /// Called by the service every time a stream packet is published
+    void writePacket(const ControllerStreamPacket &packet)
+    {
+        const int next_slot_index= (last_written_slot + 1) % k_slot_count;
+        Slot &slot= slots[next_slot_index];
+
+        ++slot.write_sequence; // odd: write in progress
+        memcpy(&slot.packet, &packet, sizeof(ControllerStreamPacket));
+        ++slot.write_sequence; // even: stable
+
+        last_written_slot= next_slot_index;
+    }
+
+    /// Called by a client to copy out the most recent stable packet.
+    /// Returns false if nothing has been written yet or the read tore.
+    bool readLatestPacket(ControllerStreamPacket &out_packet) const
+    {
+        const int slot_index= last_written_slot;
+
+        if (slot_index < 0)
+        {
+            return false;
+        }
+
+        const Slot &slot= slots[slot_index];
+        const unsigned int sequence_before= slot.write_sequence;
+
+        if ((sequence_before & 1) != 0)
+        {
+            // A write is in flight on this slot
+            return false;
+        }
+
+        memcpy(&out_packet, &slot.packet, sizeof(ControllerStreamPacket));
+
+        // The copy is only good if the writer didn't lap us mid-read
+        return slot.write_sequence == sequence_before;
+    }
+
+    static size_t computeTotalSize()
+    {
+        return sizeof(SharedControllerStateBuffer);
+    }
+};
+
+#endif // SHARED_CONTROLLER_STATE_H
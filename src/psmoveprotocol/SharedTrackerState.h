@@ -5,37 +5,178 @@
 #define BOOST_INTERPROCESS_SHARED_DIR_PATH "shared_mem"
 #endif // WIN32
 
-#include <boost/interprocess/sync/interprocess_mutex.hpp>
-
+/// Lock-free triple buffered shared memory video frame.
+/// The service rotates its writes through the buffers and publishes the index
+/// of the last completed one; a client copies out of the published buffer and
+/// uses the per-buffer write sequence to detect (and discard) a torn copy.
+/// Neither side ever blocks the other - a client stalled in a GL upload can
+/// at worst lose a frame, never hold up the server's frame write.
 class SharedVideoFrameHeader
 {
 public:
+    static const int k_buffer_count= 3;
+    static const int k_max_consumers= 4;
+
     SharedVideoFrameHeader()
-        : mutex()
-        , width(0)
+        : width(0)
         , height(0)
         , stride(0)
-        , frame_index(0)
+        , last_written_buffer_index(-1)
+        , write_generation(0)
     {
+        for (int buffer_index= 0; buffer_index < k_buffer_count; ++buffer_index)
+        {
+            write_sequence[buffer_index]= 0;
+            frame_index[buffer_index]= 0;
+            capture_timestamp_us[buffer_index]= 0;
+        }
+
+        for (int slot_index= 0; slot_index < k_max_consumers; ++slot_index)
+        {
+            consumer_claim_nonce[slot_index]= 0;
+            consumer_read_frame_index[slot_index]= 0;
+            consumer_heartbeat_us[slot_index]= 0;
+        }
     }
-    
-    //Mutex to protect access to the shared memory
-    boost::interprocess::interprocess_mutex mutex;
 
     int width;
     int height;
     int stride;
-    int frame_index;
-    // Buffer stored past the end of the header
 
-    const unsigned char *getBuffer() const
+    /// Index of the most recently completed buffer, -1 until the first write.
+    /// Published after the buffer contents so readers never chase an unwritten buffer.
+    volatile int last_written_buffer_index;
+
+    /// Odd while a write to the matching buffer is in flight (seqlock)
+    volatile unsigned int write_sequence[k_buffer_count];
+
+    /// Monotonic frame counter stamped into the buffer it was written to
+    int frame_index[k_buffer_count];
+
+    /// Total completed buffer writes since the stream started. A reader can
+    /// compare its own read count against this to tell how many frames the
+    /// writer produced that it never saw.
+    volatile unsigned int write_generation;
+
+    /// Steady-clock microseconds when the frame was written to each buffer.
+    /// Same-host readers subtract it from their own steady clock to measure
+    /// capture-to-read latency.
+    unsigned long long capture_timestamp_us[k_buffer_count];
+
+    /// Consumer slot table. Every attached reader claims a slot when it
+    /// opens the stream and publishes its read cursor and a liveness
+    /// heartbeat there, so several diagnostic consumers can watch the same
+    /// stream at once while the writer can see how many readers are
+    /// attached and how far behind each one is. The writer never waits on
+    /// a cursor - a slow consumer just sees a bigger frame gap.
+    /// A nonzero nonce marks a claimed slot. Claims use a write-then-verify
+    /// handshake since readers share no lock; the loser of a simultaneous
+    /// claim just moves on to the next slot.
+    volatile unsigned int consumer_claim_nonce[k_max_consumers];
+    /// frame_index of the frame each consumer most recently copied out
+    volatile int consumer_read_frame_index[k_max_consumers];
+    /// Steady-clock microseconds of each consumer's last poll. The writer
+    /// reclaims slots whose owner stopped polling (a crashed consumer
+    /// would otherwise pin its slot until the stream restarts)
+    volatile unsigned long long consumer_heartbeat_us[k_max_consumers];
+
+    /// Claim a free consumer slot with the caller's (nonzero) nonce.
+    /// Returns the claimed slot index, or -1 when every slot is taken -
+    /// the caller can still read the stream, it just goes unregistered.
+    int claimConsumerSlot(unsigned int nonce, unsigned long long now_us)
+    {
+        for (int slot_index= 0; slot_index < k_max_consumers; ++slot_index)
+        {
+            if (consumer_claim_nonce[slot_index] == 0)
+            {
+                consumer_claim_nonce[slot_index]= nonce;
+
+                // Re-read to catch another consumer claiming the slot at
+                // the same instant; whoever's nonce stuck owns it
+                if (consumer_claim_nonce[slot_index] == nonce)
+                {
+                    consumer_read_frame_index[slot_index]= 0;
+                    consumer_heartbeat_us[slot_index]= now_us;
+
+                    return slot_index;
+                }
+            }
+        }
+
+        return -1;
+    }
+
+    void releaseConsumerSlot(int slot_index, unsigned int nonce)
+    {
+        if (slot_index >= 0 && slot_index < k_max_consumers &&
+            consumer_claim_nonce[slot_index] == nonce)
+        {
+            consumer_claim_nonce[slot_index]= 0;
+        }
+    }
+
+    /// Called by the owning consumer on every poll. The nonce check keeps
+    /// a consumer whose slot was reclaimed (and possibly re-claimed by
+    /// someone else) from scribbling over the new owner's slot.
+    void publishConsumerHeartbeat(int slot_index, unsigned int nonce, unsigned long long now_us)
+    {
+        if (consumer_claim_nonce[slot_index] == nonce)
+        {
+            consumer_heartbeat_us[slot_index]= now_us;
+        }
+    }
+
+    /// Called by the owning consumer after it copies a frame out
+    void publishConsumerReadCursor(int slot_index, unsigned int nonce, int read_frame_index)
+    {
+        if (consumer_claim_nonce[slot_index] == nonce)
+        {
+            consumer_read_frame_index[slot_index]= read_frame_index;
+        }
+    }
+
+    /// Free every claimed slot whose heartbeat is older than the timeout.
+    /// Only the writer calls this; consumers never touch other slots.
+    void reclaimStaleConsumerSlots(unsigned long long now_us, unsigned long long timeout_us)
+    {
+        for (int slot_index= 0; slot_index < k_max_consumers; ++slot_index)
+        {
+            if (consumer_claim_nonce[slot_index] != 0 &&
+                now_us > consumer_heartbeat_us[slot_index] &&
+                now_us - consumer_heartbeat_us[slot_index] > timeout_us)
+            {
+                consumer_claim_nonce[slot_index]= 0;
+            }
+        }
+    }
+
+    int getAttachedConsumerCount() const
+    {
+        int count= 0;
+
+        for (int slot_index= 0; slot_index < k_max_consumers; ++slot_index)
+        {
+            if (consumer_claim_nonce[slot_index] != 0)
+            {
+                ++count;
+            }
+        }
+
+        return count;
+    }
+
+    // Video buffers stored past the end of the header, k_buffer_count of them back to back
+
+    const unsigned char *getBuffer(int buffer_index) const
     {
-        return reinterpret_cast<const unsigned char *>(this) + sizeof(SharedVideoFrameHeader);
+        return reinterpret_cast<const unsigned char *>(this)
+            + sizeof(SharedVideoFrameHeader)
+            + computeVideoBufferSize(stride, height)*buffer_index;
     }
 
-    unsigned char *getBufferMutable()
+    unsigned char *getBufferMutable(int buffer_index)
     {
-        return const_cast<unsigned char *>(getBuffer());
+        return const_cast<unsigned char *>(getBuffer(buffer_index));
     }
 
     static size_t computeVideoBufferSize(int stride, int height)
@@ -45,8 +186,8 @@ public:
 
     static size_t computeTotalSize(int stride, int height)
     {
-        return sizeof(SharedVideoFrameHeader) + computeVideoBufferSize(stride, height);
+        return sizeof(SharedVideoFrameHeader) + computeVideoBufferSize(stride, height)*k_buffer_count;
     }
 };
 
-#endif // SHARED_TRACKER_STATE_H
\ No newline at end of file
+#endif // SHARED_TRACKER_STATE_H
@@ -22,20 +22,42 @@ USBDeviceInfo g_supported_controller_infos[MAX_CONTROLLER_TYPE_INDEX] = {
 };
 
 // -- ControllerDeviceEnumerator -----
-ControllerDeviceEnumerator::ControllerDeviceEnumerator()
+ControllerDeviceEnumerator::ControllerDeviceEnumerator(const std::string &virtual_controller_input_log)
     : DeviceEnumerator(CommonDeviceState::PSMove)
     , devs(nullptr)
     , cur_dev(nullptr)
+    , virtual_input_log(virtual_controller_input_log)
+    , virtual_controller_index(-1)
+    , cached_entry_index(-1)
+    , record_scan_results(false)
 {
     assert(m_deviceType >= 0 && GET_DEVICE_TYPE_INDEX(m_deviceType) < MAX_CONTROLLER_TYPE_INDEX);
 
-    USBDeviceInfo &dev_info = g_supported_controller_infos[GET_DEVICE_TYPE_INDEX(m_deviceType)];
-    devs = hid_enumerate(dev_info.vendor_id, dev_info.product_id);
-    cur_dev = devs;
-
-    if (!is_valid())
+    // Startup fast pass: replay the controller paths the last session's full
+    // scan recorded instead of walking the whole HID tree (which opens every
+    // candidate device just to read its strings). A verification mismatch on
+    // any cached path falls through to the full scan below.
+    if (DeviceTopologyCache::consumeVerifiedControllerStartupPass(cached_entries))
     {
-        next();
+        cached_entry_index = 0;
+        m_deviceType = static_cast<CommonDeviceState::eDeviceType>(cached_entries[0].device_type);
+    }
+    else
+    {
+        record_scan_results = true;
+
+        USBDeviceInfo &dev_info = g_supported_controller_infos[GET_DEVICE_TYPE_INDEX(m_deviceType)];
+        devs = hid_enumerate(dev_info.vendor_id, dev_info.product_id);
+        cur_dev = devs;
+
+        if (!is_valid())
+        {
+            next();
+        }
+        else
+        {
+            record_current_scan_result();
+        }
     }
 }
 
@@ -43,6 +65,10 @@ ControllerDeviceEnumerator::ControllerDeviceEnumerator(CommonDeviceState::eDevic
     : DeviceEnumerator(deviceType)
     , devs(nullptr)
     , cur_dev(nullptr)
+    , virtual_input_log()
+    , virtual_controller_index(-1)
+    , cached_entry_index(-1)
+    , record_scan_results(false)
 {
     assert(m_deviceType >= 0 && GET_DEVICE_TYPE_INDEX(m_deviceType) < MAX_CONTROLLER_TYPE_INDEX);
 
@@ -58,14 +84,54 @@ ControllerDeviceEnumerator::ControllerDeviceEnumerator(CommonDeviceState::eDevic
 
 ControllerDeviceEnumerator::~ControllerDeviceEnumerator()
 {
+    // Feed the completed full scan back into the topology cache so the next
+    // session's startup can fast pass it. A scan abandoned mid-iteration is
+    // not recorded - it would look like the missing devices were unplugged.
+    if (record_scan_results && !is_valid())
+    {
+        DeviceTopologyCache::recordControllerScanResults(scan_results);
+    }
+
     if (devs != nullptr)
     {
         hid_free_enumeration(devs);
     }
 }
 
+void ControllerDeviceEnumerator::record_current_scan_result()
+{
+    if (!record_scan_results || cur_dev == nullptr)
+    {
+        return;
+    }
+
+    DeviceTopologyCache::ControllerEntry entry;
+
+    entry.device_type = m_deviceType;
+    entry.path = (cur_dev->path != nullptr) ? cur_dev->path : "";
+
+    char mb_serial[256];
+    if (cur_dev->serial_number != nullptr &&
+        ServerUtility::convert_wcs_to_mbs(cur_dev->serial_number, mb_serial, sizeof(mb_serial)))
+    {
+        entry.serial = mb_serial;
+    }
+
+    scan_results.push_back(entry);
+}
+
 const char *ControllerDeviceEnumerator::get_path() const
 {
+    if (virtual_controller_index >= 0)
+    {
+        return virtual_input_log.c_str();
+    }
+
+    if (cached_entry_index >= 0 && cached_entry_index < static_cast<int>(cached_entries.size()))
+    {
+        return cached_entries[cached_entry_index].path.c_str();
+    }
+
     return (cur_dev != nullptr) ? cur_dev->path : nullptr;
 }
 
@@ -73,7 +139,17 @@ bool ControllerDeviceEnumerator::get_serial_number(char *out_mb_serial, const si
 {
     bool success = false;
 
-    if (cur_dev != nullptr && cur_dev->serial_number != nullptr)
+    if (cached_entry_index >= 0 && cached_entry_index < static_cast<int>(cached_entries.size()))
+    {
+        const std::string &serial = cached_entries[cached_entry_index].serial;
+
+        if (serial.length() > 0 && serial.length() < mb_buffer_size)
+        {
+            strncpy(out_mb_serial, serial.c_str(), mb_buffer_size);
+            success = true;
+        }
+    }
+    else if (cur_dev != nullptr && cur_dev->serial_number != nullptr)
     {
         success = ServerUtility::convert_wcs_to_mbs(cur_dev->serial_number, out_mb_serial, mb_buffer_size);
     }
@@ -83,6 +159,18 @@ bool ControllerDeviceEnumerator::get_serial_number(char *out_mb_serial, const si
 
 bool ControllerDeviceEnumerator::is_valid() const
 {
+    if (virtual_controller_index >= 0)
+    {
+        return virtual_controller_index == 0;
+    }
+
+    // Cached entries were filtered by this very function when they were
+    // recorded, so the fast pass trusts them as-is
+    if (cached_entry_index >= 0)
+    {
+        return cached_entry_index < static_cast<int>(cached_entries.size());
+    }
+
     bool bIsValid = cur_dev != nullptr;
 
 	//###HipsterSloth $TODO Disable the navi until it actually works
@@ -110,6 +198,40 @@ bool ControllerDeviceEnumerator::next()
 {
     bool foundValid = false;
 
+    // There is at most one virtual controller entry and it comes last;
+    // step past it so the iteration terminates
+    if (virtual_controller_index >= 0)
+    {
+        ++virtual_controller_index;
+        return false;
+    }
+
+    // Fast pass: step through the verified cached entries
+    if (cached_entry_index >= 0)
+    {
+        ++cached_entry_index;
+
+        if (cached_entry_index < static_cast<int>(cached_entries.size()))
+        {
+            m_deviceType =
+                static_cast<CommonDeviceState::eDeviceType>(
+                    cached_entries[cached_entry_index].device_type);
+
+            return true;
+        }
+
+        // Cached entries exhausted - emit the virtual controller entry, if any
+        if (virtual_input_log.length() > 0)
+        {
+            virtual_controller_index = 0;
+            m_deviceType = CommonDeviceState::PSMove;
+
+            return true;
+        }
+
+        return false;
+    }
+
     while (!foundValid && m_deviceType < CommonDeviceState::SUPPORTED_CONTROLLER_TYPE_COUNT)
     {
         if (cur_dev != nullptr)
@@ -144,5 +266,19 @@ bool ControllerDeviceEnumerator::next()
         }
     }
 
+    if (foundValid)
+    {
+        record_current_scan_result();
+    }
+
+    // Once the HID scan is exhausted, emit a replay-backed virtual controller
+    // entry if a recorded input log was configured
+    if (!foundValid && virtual_input_log.length() > 0)
+    {
+        virtual_controller_index = 0;
+        m_deviceType = CommonDeviceState::PSMove;
+        foundValid = true;
+    }
+
     return foundValid;
 }
\ No newline at end of file
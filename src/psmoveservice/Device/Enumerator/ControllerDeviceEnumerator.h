@@ -2,11 +2,15 @@
 #define CONTROLLER_DEVICE_ENUMERATOR_H
 
 #include "DeviceEnumerator.h"
+#include "DeviceTopologyCache.h"
+
+#include <string>
+#include <vector>
 
 class ControllerDeviceEnumerator : public DeviceEnumerator
 {
 public:
-    ControllerDeviceEnumerator();
+    ControllerDeviceEnumerator(const std::string &virtual_controller_input_log = std::string());
     ControllerDeviceEnumerator(CommonDeviceState::eDeviceType deviceType);
     ~ControllerDeviceEnumerator();
 
@@ -16,8 +20,33 @@ public:
 
     bool get_serial_number(char *out_mb_serial, const size_t mb_buffer_size) const;
 
+    // True when the enumerator is on the replay-backed virtual controller entry
+    // emitted after the HID scan (see VirtualController.h)
+    inline bool get_is_virtual_controller() const
+    {
+        return virtual_controller_index >= 0;
+    }
+
 private:
+    // Append the current (valid) device to the scan results fed back to the
+    // topology cache when this full scan finishes
+    void record_current_scan_result();
+
     struct hid_device_info *devs, *cur_dev;
+
+    // Input report log to enumerate as a virtual controller (empty = none)
+    std::string virtual_input_log;
+    int virtual_controller_index;
+
+    // Startup fast pass: verified device entries replayed from the topology
+    // cache instead of a full HID tree walk (-1 = normal full scan)
+    std::vector<DeviceTopologyCache::ControllerEntry> cached_entries;
+    int cached_entry_index;
+
+    // Full scans from the primary constructor refresh the topology cache
+    // with their results when the enumerator is destroyed
+    bool record_scan_results;
+    std::vector<DeviceTopologyCache::ControllerEntry> scan_results;
 };
 
 #endif // CONTROLLER_DEVICE_ENUMERATOR_H
\ No newline at end of file
@@ -0,0 +1,338 @@
+//-- includes -----
+#include "DeviceTopologyCache.h"
+#include "PSMoveConfig.h"
+#include "ServerLog.h"
+#include "ServerUtility.h"
+#include "hidapi.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+
+//-- constants -----
+static const uint32_t k_topology_cache_magic = 0x43545350; // 'PSTC'
+static const uint32_t k_topology_cache_version = 1;
+
+//-- statics -----
+static std::vector<DeviceTopologyCache::ControllerEntry> g_controller_entries;
+static std::vector<DeviceTopologyCache::TrackerEntry> g_tracker_entries;
+static bool g_bControllerPassArmed = false;
+static bool g_bTrackerPassArmed = false;
+
+//-- private implementation -----
+static std::string get_cache_file_path()
+{
+    return PSMoveConfig::getConfigDirPath() + "/device_topology_cache.bin";
+}
+
+static void write_string(std::ofstream &out, const std::string &value)
+{
+    const uint32_t length = static_cast<uint32_t>(value.length());
+
+    out.write(reinterpret_cast<const char *>(&length), sizeof(length));
+    out.write(value.data(), length);
+}
+
+static bool read_string(std::ifstream &in, std::string &out_value)
+{
+    uint32_t length = 0;
+
+    in.read(reinterpret_cast<char *>(&length), sizeof(length));
+    if (!in.good() || length > 4096)
+    {
+        return false;
+    }
+
+    out_value.resize(length);
+    if (length > 0)
+    {
+        in.read(&out_value[0], length);
+    }
+
+    return in.good() || length == 0;
+}
+
+static void save_cache_file()
+{
+    std::ofstream out(
+        get_cache_file_path(),
+        std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+
+    if (!out.is_open())
+    {
+        return;
+    }
+
+    const uint32_t controller_count = static_cast<uint32_t>(g_controller_entries.size());
+    const uint32_t tracker_count = static_cast<uint32_t>(g_tracker_entries.size());
+
+    out.write(reinterpret_cast<const char *>(&k_topology_cache_magic), sizeof(k_topology_cache_magic));
+    out.write(reinterpret_cast<const char *>(&k_topology_cache_version), sizeof(k_topology_cache_version));
+
+    out.write(reinterpret_cast<const char *>(&controller_count), sizeof(controller_count));
+    for (const DeviceTopologyCache::ControllerEntry &entry : g_controller_entries)
+    {
+        const int32_t device_type = entry.device_type;
+
+        out.write(reinterpret_cast<const char *>(&device_type), sizeof(device_type));
+        write_string(out, entry.path);
+        write_string(out, entry.serial);
+    }
+
+    out.write(reinterpret_cast<const char *>(&tracker_count), sizeof(tracker_count));
+    for (const DeviceTopologyCache::TrackerEntry &entry : g_tracker_entries)
+    {
+        const uint32_t vendor_id = entry.vendor_id;
+        const uint32_t product_id = entry.product_id;
+
+        out.write(reinterpret_cast<const char *>(&vendor_id), sizeof(vendor_id));
+        out.write(reinterpret_cast<const char *>(&product_id), sizeof(product_id));
+        write_string(out, entry.port_path);
+    }
+}
+
+static bool controller_entries_equal(
+    const std::vector<DeviceTopologyCache::ControllerEntry> &a,
+    const std::vector<DeviceTopologyCache::ControllerEntry> &b)
+{
+    if (a.size() != b.size())
+    {
+        return false;
+    }
+
+    for (size_t index = 0; index < a.size(); ++index)
+    {
+        if (a[index].device_type != b[index].device_type ||
+            a[index].path != b[index].path ||
+            a[index].serial != b[index].serial)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool tracker_entries_equal(
+    const std::vector<DeviceTopologyCache::TrackerEntry> &a,
+    const std::vector<DeviceTopologyCache::TrackerEntry> &b)
+{
+    if (a.size() != b.size())
+    {
+        return false;
+    }
+
+    for (size_t index = 0; index < a.size(); ++index)
+    {
+        if (a[index].vendor_id != b[index].vendor_id ||
+            a[index].product_id != b[index].product_id ||
+            a[index].port_path != b[index].port_path)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// Open the cached HID path and, when a serial was cached with it, make sure
+/// the device at that path still reports the same one - the cheap check that
+/// catches a different device having moved onto the path between sessions
+static bool verify_controller_entry(const DeviceTopologyCache::ControllerEntry &entry)
+{
+    hid_device *device = hid_open_path(entry.path.c_str());
+
+    if (device == nullptr)
+    {
+        return false;
+    }
+
+    bool bVerified = true;
+
+    if (entry.serial.length() > 0)
+    {
+        wchar_t wide_serial[256];
+        char mb_serial[256];
+
+        bVerified =
+            hid_get_serial_number_string(device, wide_serial, sizeof(wide_serial)/sizeof(wchar_t)) == 0 &&
+            ServerUtility::convert_wcs_to_mbs(wide_serial, mb_serial, sizeof(mb_serial)) &&
+            entry.serial == mb_serial;
+    }
+
+    hid_close(device);
+
+    return bVerified;
+}
+
+//-- public implementation -----
+std::string DeviceTopologyCache::makeTrackerPortPath(
+    int bus_number, const unsigned char *port_numbers, int port_number_count)
+{
+    char path[64];
+    int written = snprintf(path, sizeof(path), "%d", bus_number);
+
+    for (int port_index = 0; port_index < port_number_count && written < static_cast<int>(sizeof(path)); ++port_index)
+    {
+        written += snprintf(
+            path + written, sizeof(path) - written,
+            "%c%d", (port_index == 0) ? ':' : '.', port_numbers[port_index]);
+    }
+
+    return std::string(path);
+}
+
+void DeviceTopologyCache::loadAtStartup()
+{
+    g_controller_entries.clear();
+    g_tracker_entries.clear();
+    g_bControllerPassArmed = false;
+    g_bTrackerPassArmed = false;
+
+    std::ifstream in(get_cache_file_path(), std::ifstream::in | std::ifstream::binary);
+
+    if (!in.is_open())
+    {
+        return;
+    }
+
+    uint32_t magic = 0;
+    uint32_t version = 0;
+
+    in.read(reinterpret_cast<char *>(&magic), sizeof(magic));
+    in.read(reinterpret_cast<char *>(&version), sizeof(version));
+
+    if (!in.good() || magic != k_topology_cache_magic || version != k_topology_cache_version)
+    {
+        SERVER_LOG_WARNING("DeviceTopologyCache::loadAtStartup") <<
+            "Ignoring device topology cache with unexpected header";
+        return;
+    }
+
+    uint32_t controller_count = 0;
+    in.read(reinterpret_cast<char *>(&controller_count), sizeof(controller_count));
+    for (uint32_t index = 0; in.good() && index < controller_count && controller_count <= 64; ++index)
+    {
+        ControllerEntry entry;
+        int32_t device_type = 0;
+
+        in.read(reinterpret_cast<char *>(&device_type), sizeof(device_type));
+        entry.device_type = device_type;
+
+        if (!read_string(in, entry.path) || !read_string(in, entry.serial))
+        {
+            g_controller_entries.clear();
+            break;
+        }
+
+        g_controller_entries.push_back(entry);
+    }
+
+    uint32_t tracker_count = 0;
+    in.read(reinterpret_cast<char *>(&tracker_count), sizeof(tracker_count));
+    for (uint32_t index = 0; in.good() && index < tracker_count && tracker_count <= 64; ++index)
+    {
+        TrackerEntry entry;
+        uint32_t vendor_id = 0;
+        uint32_t product_id = 0;
+
+        in.read(reinterpret_cast<char *>(&vendor_id), sizeof(vendor_id));
+        in.read(reinterpret_cast<char *>(&product_id), sizeof(product_id));
+        entry.vendor_id = static_cast<unsigned short>(vendor_id);
+        entry.product_id = static_cast<unsigned short>(product_id);
+
+        if (!read_string(in, entry.port_path))
+        {
+            g_tracker_entries.clear();
+            break;
+        }
+
+        g_tracker_entries.push_back(entry);
+    }
+
+    g_bControllerPassArmed = g_controller_entries.size() > 0;
+    g_bTrackerPassArmed = g_tracker_entries.size() > 0;
+
+    SERVER_LOG_INFO("DeviceTopologyCache::loadAtStartup") <<
+        "Loaded device topology cache (" <<
+        g_controller_entries.size() << " controllers, " <<
+        g_tracker_entries.size() << " camera ports)";
+}
+
+bool DeviceTopologyCache::consumeVerifiedControllerStartupPass(
+    std::vector<ControllerEntry> &out_entries)
+{
+    out_entries.clear();
+
+    if (!g_bControllerPassArmed)
+    {
+        return false;
+    }
+
+    // One-shot: later enumerations are rescans and always walk the full tree
+    g_bControllerPassArmed = false;
+
+    for (const ControllerEntry &entry : g_controller_entries)
+    {
+        if (!verify_controller_entry(entry))
+        {
+            SERVER_LOG_INFO("DeviceTopologyCache::consumeVerifiedControllerStartupPass") <<
+                "Cached controller path no longer verifies (" << entry.path <<
+                ") - falling back to a full scan";
+            out_entries.clear();
+            return false;
+        }
+
+        out_entries.push_back(entry);
+    }
+
+    SERVER_LOG_INFO("DeviceTopologyCache::consumeVerifiedControllerStartupPass") <<
+        "Verified all " << out_entries.size() << " cached controller paths";
+
+    return true;
+}
+
+bool DeviceTopologyCache::consumeTrackerStartupPass()
+{
+    const bool bArmed = g_bTrackerPassArmed;
+
+    g_bTrackerPassArmed = false;
+
+    return bArmed;
+}
+
+bool DeviceTopologyCache::isTrackerPortKnownGood(
+    unsigned short vendor_id, unsigned short product_id, const std::string &port_path)
+{
+    for (const TrackerEntry &entry : g_tracker_entries)
+    {
+        if (entry.vendor_id == vendor_id &&
+            entry.product_id == product_id &&
+            entry.port_path == port_path)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void DeviceTopologyCache::recordControllerScanResults(
+    const std::vector<ControllerEntry> &entries)
+{
+    if (!controller_entries_equal(entries, g_controller_entries))
+    {
+        g_controller_entries = entries;
+        save_cache_file();
+    }
+}
+
+void DeviceTopologyCache::recordTrackerScanResults(
+    const std::vector<TrackerEntry> &entries)
+{
+    if (!tracker_entries_equal(entries, g_tracker_entries))
+    {
+        g_tracker_entries = entries;
+        save_cache_file();
+    }
+}
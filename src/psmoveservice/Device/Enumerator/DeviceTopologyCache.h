@@ -0,0 +1,72 @@
+#ifndef DEVICE_TOPOLOGY_CACHE_H
+#define DEVICE_TOPOLOGY_CACHE_H
+
+//-- includes -----
+#include <string>
+#include <vector>
+
+//-- definitions -----
+/**
+Persistent cache of the USB/HID device topology seen by the last full
+enumeration scan.
+
+Walking the full device tree dominates startup time on stations with many
+devices: every HID enumeration opens each candidate to read its strings and
+every camera candidate gets a test open. At startup the enumerators instead
+probe the device paths the last session recorded - a cheap open/descriptor
+check per cached device - and only fall back to the full tree walk when the
+cached topology no longer matches. Every full scan rewrites the cache, so
+it self-heals after any hardware change.
+
+The fast pass is one-shot per service run: hotplug events and the periodic
+reconnect rescans always use full scans, so a device plugged in while the
+service was down is picked up on the first rescan after startup.
+*/
+namespace DeviceTopologyCache
+{
+    /// One HID controller recorded by the last full scan
+    struct ControllerEntry
+    {
+        int device_type; // CommonDeviceState::eDeviceType
+        std::string path;
+        std::string serial; // empty when the device reported none
+    };
+
+    /// One camera port location verified good by the last full scan
+    struct TrackerEntry
+    {
+        unsigned short vendor_id;
+        unsigned short product_id;
+        std::string port_path; // "bus:port.port..." (see makeTrackerPortPath)
+    };
+
+    /// Canonical cache key for a camera's physical location on the bus
+    std::string makeTrackerPortPath(
+        int bus_number, const unsigned char *port_numbers, int port_number_count);
+
+    //-- startup side -----
+    /// Read the cache file and arm the one-shot startup fast passes
+    void loadAtStartup();
+
+    /// Consume the controller fast pass. Probes every cached controller path
+    /// with an open/serial check; returns true (and the verified entries)
+    /// only when the whole cached topology checks out, so a partial match
+    /// falls back to the full scan rather than hiding a moved device.
+    bool consumeVerifiedControllerStartupPass(std::vector<ControllerEntry> &out_entries);
+
+    /// Consume the tracker fast pass. While armed, camera candidates whose
+    /// vid/pid and port path match a cached entry skip the per-device test
+    /// open (the descriptor read the scan already did is the verification).
+    bool consumeTrackerStartupPass();
+
+    /// True when the loaded cache marked this camera port known-good
+    bool isTrackerPortKnownGood(
+        unsigned short vendor_id, unsigned short product_id, const std::string &port_path);
+
+    //-- refresh side -----
+    /// Record the results of a full scan; rewrites the cache file on change
+    void recordControllerScanResults(const std::vector<ControllerEntry> &entries);
+    void recordTrackerScanResults(const std::vector<TrackerEntry> &entries);
+};
+
+#endif // DEVICE_TOPOLOGY_CACHE_H
@@ -17,12 +17,13 @@
 // -- globals -----
 USBDeviceInfo g_supported_tracker_infos[MAX_CAMERA_TYPE_INDEX] = {
     { 0x1415, 0x2000 }, // PS3Eye
+    { 0x0000, 0x0000 }, // VirtualTracker (synthetic, never matched by vid/pid)
     //{0x2833, 0x0201 }, // RiftDK2 Sensor
     //{0x045e, 0x02ae}, // V1 Kinect
 };
 
 // -- methods -----
-TrackerDeviceEnumerator::TrackerDeviceEnumerator()
+TrackerDeviceEnumerator::TrackerDeviceEnumerator(int virtual_tracker_count)
     : DeviceEnumerator(CommonDeviceState::PS3EYE)
     , usb_context(nullptr)
     , devs(nullptr)
@@ -30,6 +31,10 @@ TrackerDeviceEnumerator::TrackerDeviceEnumerator()
     , dev_index(0)
     , dev_count(0)
     , camera_index(-1)
+    , virtual_tracker_count(virtual_tracker_count)
+    , virtual_tracker_index(-1)
+    , use_topology_cache(DeviceTopologyCache::consumeTrackerStartupPass())
+    , record_scan_results(true)
 {
     assert(m_deviceType >= 0 && GET_DEVICE_TYPE_INDEX(m_deviceType) < MAX_CAMERA_TYPE_INDEX);
 
@@ -57,6 +62,10 @@ TrackerDeviceEnumerator::TrackerDeviceEnumerator(CommonDeviceState::eDeviceType
     , dev_count(0)
     , camera_index(-1)
     , dev_valid(false)
+    , virtual_tracker_count(0)
+    , virtual_tracker_index(-1)
+    , use_topology_cache(false)
+    , record_scan_results(false)
 {
     assert(m_deviceType >= 0 && GET_DEVICE_TYPE_INDEX(m_deviceType) < MAX_CAMERA_TYPE_INDEX);
 
@@ -79,6 +88,14 @@ TrackerDeviceEnumerator::TrackerDeviceEnumerator(CommonDeviceState::eDeviceType
 
 TrackerDeviceEnumerator::~TrackerDeviceEnumerator()
 {
+    // Feed the known-good camera ports back into the topology cache so the
+    // next session's startup scan can skip the per-device test opens. Only
+    // recorded when the scan ran to completion.
+    if (record_scan_results && !is_valid())
+    {
+        DeviceTopologyCache::recordTrackerScanResults(scan_results);
+    }
+
     if (devs != nullptr)
     {
         libusb_free_device_list(devs, 1);
@@ -91,7 +108,15 @@ const char *TrackerDeviceEnumerator::get_path() const
 {
     const char *result = nullptr;
 
-    if (cur_dev != nullptr)
+    if (virtual_tracker_index >= 0)
+    {
+        snprintf(
+            (char *)(cur_path), sizeof(cur_path),
+            "VIRTUAL\\%d", virtual_tracker_index);
+
+        result = cur_path;
+    }
+    else if (cur_dev != nullptr)
     {
         struct libusb_device_descriptor dev_desc;
         libusb_get_device_descriptor(cur_dev, &dev_desc);
@@ -109,7 +134,31 @@ const char *TrackerDeviceEnumerator::get_path() const
 
 bool TrackerDeviceEnumerator::is_valid() const
 {
-    return dev_valid;
+    return dev_valid || (virtual_tracker_index >= 0 && virtual_tracker_index < virtual_tracker_count);
+}
+
+int TrackerDeviceEnumerator::get_usb_bus_number() const
+{
+    int bus_number = -1;
+
+    if (virtual_tracker_index < 0 && cur_dev != nullptr)
+    {
+        bus_number = static_cast<int>(libusb_get_bus_number(cur_dev));
+    }
+
+    return bus_number;
+}
+
+int TrackerDeviceEnumerator::get_usb_device_speed() const
+{
+    int device_speed = LIBUSB_SPEED_UNKNOWN;
+
+    if (virtual_tracker_index < 0 && cur_dev != nullptr)
+    {
+        device_speed = libusb_get_device_speed(cur_dev);
+    }
+
+    return device_speed;
 }
 
 bool TrackerDeviceEnumerator::recompute_current_device_validity()
@@ -138,22 +187,52 @@ bool TrackerDeviceEnumerator::recompute_current_device_validity()
                 // (i.e. has a different device port path)
                 if (memcmp(port_numbers, dev_port_numbers, sizeof(port_numbers)) != 0)
                 {
-                    libusb_device_handle *devhandle;
+                    const std::string port_path =
+                        DeviceTopologyCache::makeTrackerPortPath(
+                            static_cast<int>(libusb_get_bus_number(cur_dev)),
+                            port_numbers, elements_filled);
+
+                    // Startup fast pass: ports the last session verified good
+                    // skip the test open - the descriptor read above is the
+                    // cheap verification
+                    if (use_topology_cache &&
+                        DeviceTopologyCache::isTrackerPortKnownGood(
+                            dev_desc.idVendor, dev_desc.idProduct, port_path))
+                    {
+                        memcpy(dev_port_numbers, port_numbers, sizeof(port_numbers));
 
-                    // Finally need to test that we can actually open the device
-                    // (or see that device is already open)
-                    libusb_result = libusb_open(cur_dev, &devhandle);
-                    if (libusb_result == LIBUSB_SUCCESS || libusb_result == LIBUSB_ERROR_ACCESS)
+                        dev_valid = true;
+                    }
+                    else
                     {
-                        if (libusb_result == LIBUSB_SUCCESS)
+                        libusb_device_handle *devhandle;
+
+                        // Finally need to test that we can actually open the device
+                        // (or see that device is already open)
+                        libusb_result = libusb_open(cur_dev, &devhandle);
+                        if (libusb_result == LIBUSB_SUCCESS || libusb_result == LIBUSB_ERROR_ACCESS)
                         {
-                            libusb_close(devhandle);
+                            if (libusb_result == LIBUSB_SUCCESS)
+                            {
+                                libusb_close(devhandle);
+                            }
+
+                            // Cache the port number for the last valid device found
+                            memcpy(dev_port_numbers, port_numbers, sizeof(port_numbers));
+
+                            dev_valid = true;
                         }
+                    }
 
-                        // Cache the port number for the last valid device found
-                        memcpy(dev_port_numbers, port_numbers, sizeof(port_numbers));
+                    if (dev_valid && record_scan_results)
+                    {
+                        DeviceTopologyCache::TrackerEntry entry;
 
-                        dev_valid = true;
+                        entry.vendor_id = dev_desc.idVendor;
+                        entry.product_id = dev_desc.idProduct;
+                        entry.port_path = port_path;
+
+                        scan_results.push_back(entry);
                     }
                 }
             }
@@ -175,9 +254,10 @@ bool TrackerDeviceEnumerator::next()
 
         // If there are more device types to scan
         // move on to the next vid/pid device enumeration
+        // (VirtualTracker entries are emitted after the USB scan, not probed by vid/pid)
         if (cur_dev == nullptr &&
             GET_DEVICE_TYPE_CLASS(m_deviceType + 1) == CommonDeviceState::TrackingCamera &&
-            (m_deviceType + 1) < CommonDeviceState::SUPPORTED_CAMERA_TYPE_COUNT)
+            (m_deviceType + 1) < CommonDeviceState::VirtualTracker)
         {
             m_deviceType = static_cast<CommonDeviceState::eDeviceType>(m_deviceType + 1);
 
@@ -188,6 +268,20 @@ bool TrackerDeviceEnumerator::next()
         }
     }
 
+    // Once the physical cameras are exhausted, hand out the configured
+    // number of synthetic virtual trackers
+    if (!foundValid && virtual_tracker_index + 1 < virtual_tracker_count)
+    {
+        ++virtual_tracker_index;
+        m_deviceType = CommonDeviceState::VirtualTracker;
+        foundValid = true;
+    }
+    else if (!foundValid && virtual_tracker_index >= 0)
+    {
+        // Step past the last virtual entry so the iteration terminates
+        ++virtual_tracker_index;
+    }
+
     if (foundValid)
     {
         ++camera_index;
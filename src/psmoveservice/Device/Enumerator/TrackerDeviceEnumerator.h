@@ -2,11 +2,14 @@
 #define TRACKER_DEVICE_ENUMERATOR_H
 
 #include "DeviceEnumerator.h"
+#include "DeviceTopologyCache.h"
+
+#include <vector>
 
 class TrackerDeviceEnumerator : public DeviceEnumerator
 {
 public:
-    TrackerDeviceEnumerator();
+    TrackerDeviceEnumerator(int virtual_tracker_count = 0);
     TrackerDeviceEnumerator(CommonDeviceState::eDeviceType deviceType);
     ~TrackerDeviceEnumerator();
 
@@ -14,6 +17,14 @@ public:
     bool next() override;
     const char *get_path() const override;
     inline int get_camera_index() const { return camera_index; }
+    inline int get_virtual_tracker_index() const { return virtual_tracker_index; }
+
+    // USB topology of the current device, for bandwidth planning.
+    // Bus number identifies the host controller the camera shares
+    // isochronous bandwidth on (-1 for virtual trackers)
+    int get_usb_bus_number() const;
+    // One of the LIBUSB_SPEED_* values (LIBUSB_SPEED_UNKNOWN for virtual trackers)
+    int get_usb_device_speed() const;
 
 protected:
     bool recompute_current_device_validity();
@@ -26,6 +37,19 @@ private:
     int dev_index, dev_count;
     int camera_index;
     bool dev_valid;
+
+    // Synthetic VirtualTracker entries emitted after the USB scan is exhausted
+    // (-1 = still enumerating physical cameras)
+    int virtual_tracker_count;
+    int virtual_tracker_index;
+
+    // Startup fast pass: camera ports the topology cache marked known-good
+    // skip the per-device test open (see DeviceTopologyCache)
+    bool use_topology_cache;
+    // Scans from the primary constructor feed their known-good ports back
+    // into the topology cache when the enumerator is destroyed
+    bool record_scan_results;
+    std::vector<DeviceTopologyCache::TrackerEntry> scan_results;
 };
 
 #endif // TRACKER_DEVICE_ENUMERATOR_H
\ No newline at end of file
@@ -2,8 +2,10 @@
 #define DEVICE_INTERFACE_H
 
 // -- includes -----
+#include <chrono>
 #include <string>
 #include <tuple>
+#include <vector>
 
 // -- pre-declarations ----
 namespace PSMoveProtocol
@@ -147,6 +149,24 @@ struct CommonDeviceScreenLocation
     }
 };
 
+struct CommonScreenRect
+{
+    float x, y, w, h;
+
+    inline void clear()
+    {
+        x = y = w = h = 0.f;
+    }
+
+    inline void set(float _x, float _y, float _w, float _h)
+    {
+        x = _x;
+        y = _y;
+        w = _w;
+        h = _h;
+    }
+};
+
 struct CommonDeviceQuaternion
 {
     float x, y, z, w;
@@ -203,7 +223,8 @@ struct CommonDeviceState
         SUPPORTED_CONTROLLER_TYPE_COUNT = Controller + 0x03,
         
         PS3EYE = TrackingCamera + 0x00,
-        SUPPORTED_CAMERA_TYPE_COUNT = TrackingCamera + 0x01,
+        VirtualTracker = TrackingCamera + 0x01, // synthetic load-test camera, never on the USB bus
+        SUPPORTED_CAMERA_TYPE_COUNT = TrackingCamera + 0x02,
         
         Morpheus = HeadMountedDisplay + 0x00,
         SUPPORTED_HMD_TYPE_COUNT = HeadMountedDisplay + 0x01        
@@ -241,6 +262,9 @@ struct CommonDeviceState
         case PS3EYE:
             result = "PSEYE";
             break;
+        case VirtualTracker:
+            result = "VirtualTracker";
+            break;
         case Morpheus:
             result = "Morpheus";
             break;        
@@ -282,8 +306,12 @@ struct CommonControllerState : CommonDeviceState
     enum BatteryLevel Battery;
     unsigned int AllButtons;                    // all-buttons, used to detect changes
 
-    //TODO: high-precision timestamp. Need to do in hidapi?
-    
+    // Time the input report was drained off the HID device.
+    // hidapi doesn't expose the true arrival time, but the reports are drained
+    // every millisecond or so which makes this a good proxy for it.
+    std::chrono::time_point<std::chrono::high_resolution_clock> PollTimestamp;
+    bool bPollTimestampValid;
+
     inline CommonControllerState()
     {
         clear();
@@ -295,6 +323,8 @@ struct CommonControllerState : CommonDeviceState
         DeviceType= SUPPORTED_CONTROLLER_TYPE_COUNT; // invalid
         Battery= Batt_MAX;
         AllButtons= 0;
+        PollTimestamp= std::chrono::time_point<std::chrono::high_resolution_clock>();
+        bPollTimestampValid= false;
     }
 };
 
@@ -449,6 +479,10 @@ public:
 	// Sets the tracking color enum of the controller
 	virtual bool setTrackingColorID(const eCommonTrackingColorID tracking_color_id) = 0;
 
+	// Persist the pose filter's converged covariance/bias state in the controller
+	// config so the filter can warm-start on the next service startup
+	virtual bool setFilterWarmStartState(const std::vector<double> &values) = 0;
+
     // -- Getters
     // Returns true if the device is connected via Bluetooth, false if by USB
     virtual bool getIsBluetooth() const = 0;
@@ -510,6 +544,22 @@ public:
     // Returns a pointer to the last video frame buffer captured
     virtual const unsigned char *getVideoFrameBuffer() const = 0;
 
+    // Returns true if getVideoFrameBuffer() returns a raw single-channel Bayer
+    // frame (to be debayered by the consumer) rather than a BGR frame
+    virtual bool getIsVideoFrameBayer() const = 0;
+
+    // Returns the time the current video frame was delivered by the camera
+    // driver, as opposed to when the service thread got around to polling it
+    virtual std::chrono::time_point<std::chrono::high_resolution_clock> getVideoFrameCaptureTimestamp() const = 0;
+
+    // Capture health telemetry for fleet monitoring: the frame delivery rate
+    // measured at the camera driver, and the number of delivered frames that
+    // were overwritten before the service consumed them. A camera silently
+    // renegotiated to a lower frame rate by USB contention shows up here
+    // before tracking visibly degrades.
+    virtual float getMeasuredCaptureRateFps() const = 0;
+    virtual uint64_t getDroppedFrameCount() const = 0;
+
     static const char *getDriverTypeString(eDriverType device_type)
     {
         const char *result = nullptr;
@@ -568,6 +618,12 @@ public:
     virtual void gatherTrackingColorPresets(const std::string &controller_serial, PSMoveProtocol::Response_ResultTrackerSettings* settings) const = 0;
     virtual void setTrackingColorPreset(const std::string &controller_serial, eCommonTrackingColorID color, const CommonHSVColorRange *preset) = 0;
     virtual void getTrackingColorPreset(const std::string &controller_serial, eCommonTrackingColorID color, CommonHSVColorRange *out_preset) const = 0;
+
+    // Screen space areas (static reflective surfaces in the playspace) whose
+    // pixels get masked out of the color thresholds before contour extraction
+    enum { MAX_EXCLUSION_AREAS = 16 };
+    virtual void setExclusionAreas(const CommonScreenRect *areas, int area_count) = 0;
+    virtual int getExclusionAreas(CommonScreenRect *out_areas, int max_area_count) const = 0;
 };
 
 /// Abstract class for HMD interface. Implemented HMD classes
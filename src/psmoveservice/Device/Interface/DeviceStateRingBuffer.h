@@ -0,0 +1,75 @@
+#ifndef DEVICE_STATE_RING_BUFFER_H
+#define DEVICE_STATE_RING_BUFFER_H
+
+//-- includes -----
+#include <assert.h>
+
+//-- definitions -----
+/// Fixed-capacity ring of device state slots holding the recent input
+/// report history. All slots are allocated up front with the device, so
+/// the poll path writes into recycled storage instead of heap-allocating
+/// per report the way a deque does.
+template <typename t_state_type, int t_capacity>
+class DeviceStateRingBuffer
+{
+public:
+    DeviceStateRingBuffer()
+        : m_next_write_index(0)
+        , m_count(0)
+    {
+    }
+
+    void clear()
+    {
+        m_next_write_index= 0;
+        m_count= 0;
+    }
+
+    inline int getCount() const
+    {
+        return m_count;
+    }
+
+    inline bool empty() const
+    {
+        return m_count == 0;
+    }
+
+    /// The most recently written state, or nullptr while the ring is empty
+    inline const t_state_type *back() const
+    {
+        return getLookBackState(0);
+    }
+
+    /// The state lookBack entries behind the most recent one, or nullptr
+    /// when the history doesn't reach back that far
+    inline const t_state_type *getLookBackState(int lookBack) const
+    {
+        assert(lookBack >= 0);
+
+        return
+            (lookBack >= 0 && lookBack < m_count)
+            ? &m_states[(m_next_write_index + t_capacity - 1 - lookBack) % t_capacity]
+            : nullptr;
+    }
+
+    /// Copy the state into the next slot, recycling the oldest slot once
+    /// the ring is full
+    void push(const t_state_type &state)
+    {
+        m_states[m_next_write_index]= state;
+        m_next_write_index= (m_next_write_index + 1) % t_capacity;
+
+        if (m_count < t_capacity)
+        {
+            ++m_count;
+        }
+    }
+
+private:
+    t_state_type m_states[t_capacity];
+    int m_next_write_index;
+    int m_count;
+};
+
+#endif // DEVICE_STATE_RING_BUFFER_H
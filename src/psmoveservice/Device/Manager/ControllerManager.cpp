@@ -2,6 +2,7 @@
 #include "ControllerManager.h"
 #include "BluetoothQueries.h"
 #include "ControllerDeviceEnumerator.h"
+#include "HitchWatchdog.h"
 #include "OrientationFilter.h"
 #include "PSMoveProtocol.pb.h"
 #include "ServerLog.h"
@@ -9,6 +10,7 @@
 #include "ServerDeviceView.h"
 #include "ServerNetworkManager.h"
 #include "ServerUtility.h"
+#include "TrackerManager.h"
 #include "hidapi.h"
 
 //-- methods -----
@@ -66,22 +68,46 @@ ControllerManager::shutdown()
 void
 ControllerManager::updateStateAndPredict(TrackerManager* tracker_manager)
 {
+    TrackerPoseEstimationWorkerPool &worker_pool = tracker_manager->getPoseEstimationWorkerPool();
+
+    // Stage 1: Optical pose estimation.
+    // Each view fans its per-tracker projection work across the worker pool
+    // internally, so the devices are processed one after another here.
     for (int device_id = 0; device_id < getMaxDevices(); ++device_id)
     {
         ServerControllerViewPtr controllerView = getControllerViewPtr(device_id);
 
 		if (controllerView->getIsOpen() && controllerView->getIsBluetooth())
 		{
+			HitchWatchdog::setActiveDeviceId(device_id);
 			controllerView->updateOpticalPoseEstimation(tracker_manager);
-			controllerView->updateStateAndPredict();
+			HitchWatchdog::setActiveDeviceId(-1);
+		}
+    }
+
+    // Stage 2: Filter state update.
+    // Each job only touches its own controller view (sensor history + filters),
+    // so the per-device updates can run concurrently on the pool.
+    for (int device_id = 0; device_id < getMaxDevices(); ++device_id)
+    {
+        ServerControllerViewPtr controllerView = getControllerViewPtr(device_id);
+
+		if (controllerView->getIsOpen() && controllerView->getIsBluetooth())
+		{
+			worker_pool.addJob(
+				[controllerView]
+				{
+					controllerView->updateStateAndPredict();
+				});
 		}
     }
+    worker_pool.waitForAllJobs();
 }
 
 DeviceEnumerator *
 ControllerManager::allocate_device_enumerator()
 {
-    return new ControllerDeviceEnumerator;
+    return new ControllerDeviceEnumerator(virtual_controller_input_log);
 }
 
 void
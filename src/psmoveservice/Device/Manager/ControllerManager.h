@@ -35,6 +35,10 @@ public:
         return ControllerManager::k_max_devices;
     }
 
+    /// Recorded input report log to enumerate as a replay-backed virtual
+    /// controller (empty = none). Assigned from the DeviceManagerConfig.
+    std::string virtual_controller_input_log;
+
     inline std::string getCachedBluetoothHostAddress() const
     {
         return m_bluetooth_host_address;
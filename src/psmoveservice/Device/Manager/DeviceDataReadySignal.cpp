@@ -0,0 +1,34 @@
+//-- includes -----
+#include "DeviceDataReadySignal.h"
+
+//-- statics -----
+std::mutex DeviceDataReadySignal::m_signal_mutex;
+std::condition_variable DeviceDataReadySignal::m_data_ready_condition;
+bool DeviceDataReadySignal::m_bDataReady= false;
+
+//-- public methods -----
+void DeviceDataReadySignal::notifyDataReady()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_signal_mutex);
+
+        m_bDataReady= true;
+    }
+
+    m_data_ready_condition.notify_one();
+}
+
+bool DeviceDataReadySignal::waitForDataUntil(
+    const std::chrono::steady_clock::time_point &deadline)
+{
+    std::unique_lock<std::mutex> lock(m_signal_mutex);
+
+    const bool bSignaled=
+        m_data_ready_condition.wait_until(lock, deadline, [] { return m_bDataReady; });
+
+    // Coalesce any signals that piled up while the service thread was busy -
+    // one update() pass consumes everything the producers published
+    m_bDataReady= false;
+
+    return bSignaled;
+}
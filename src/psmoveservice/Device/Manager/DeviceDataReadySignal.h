@@ -0,0 +1,33 @@
+#ifndef DEVICE_DATA_READY_SIGNAL_H
+#define DEVICE_DATA_READY_SIGNAL_H
+
+//-- includes -----
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+//-- definitions -----
+/// Lets producer threads (HID poll, async frame capture, network inbound)
+/// wake the service thread the moment new data arrives, instead of leaving it
+/// asleep until the next tick boundary. The service thread waits with its
+/// tick deadline as a fallback so a quiet system still services the loop at
+/// the configured rate.
+class DeviceDataReadySignal
+{
+public:
+    /// Called from a producer thread when it has published data for the
+    /// service thread to consume
+    static void notifyDataReady();
+
+    /// Block the calling (service) thread until a producer signals or the
+    /// deadline passes. Consumes the pending signal.
+    /// Returns true when woken by a producer.
+    static bool waitForDataUntil(const std::chrono::steady_clock::time_point &deadline);
+
+private:
+    static std::mutex m_signal_mutex;
+    static std::condition_variable m_data_ready_condition;
+    static bool m_bDataReady;
+};
+
+#endif // DEVICE_DATA_READY_SIGNAL_H
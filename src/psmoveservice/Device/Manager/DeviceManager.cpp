@@ -3,6 +3,8 @@
 
 #include "ControllerManager.h"
 #include "DeviceEnumerator.h"
+#include "DeviceHotplugListener.h"
+#include "DeviceTopologyCache.h"
 #include "HMDManager.h"
 #include "OrientationFilter.h"
 #include "ServerControllerView.h"
@@ -13,9 +15,13 @@
 #include "ServerDeviceView.h"
 #include "ServerNetworkManager.h"
 #include "ServerUtility.h"
+#include "SessionCapture.h"
+#include "StartupPhaseProfiler.h"
+#include "ThreadCpuMonitor.h"
 #include "PSMoveProtocol.pb.h"
 #include "PSMoveConfig.h"
 #include "TrackerManager.h"
+#include "WarmRestartSnapshot.h"
 #include <chrono>
 
 //-- constants -----
@@ -25,6 +31,19 @@ static const int k_default_tracker_reconnect_interval= 10000; // ms
 static const int k_default_tracker_poll_interval= 13; // 1000/75 ms
 static const int k_default_hmd_reconnect_interval= 10000; // ms
 static const int k_default_hmd_poll_interval= 2; // ms
+static const int k_default_service_thread_priority= 0; // platform default
+static const int k_default_session_capture_frame_divisor= 4; // record every 4th camera frame
+static const int k_default_tick_budget_ms= 0; // frame budget governor disabled
+static const bool k_default_apply_client_latency_prediction= false;
+
+// Frame budget governor policy: consecutive over-budget ticks before optical
+// work is shed another notch, consecutive comfortably-under-budget ticks
+// before a notch is restored (~2s at 60Hz so quality doesn't oscillate at the
+// threshold), and the fraction of the budget a tick must come in under to
+// count toward restoring
+static const int k_governor_ticks_to_degrade= 5;
+static const int k_governor_ticks_to_restore= 120;
+static const float k_governor_restore_fraction= 0.75f;
 
 class DeviceManagerConfig : public PSMoveConfig
 {
@@ -36,7 +55,11 @@ public:
         , tracker_reconnect_interval(k_default_tracker_reconnect_interval)
         , tracker_poll_interval(k_default_tracker_poll_interval)
         , hmd_reconnect_interval(k_default_hmd_reconnect_interval)
-        , hmd_poll_interval(k_default_hmd_poll_interval)        
+        , hmd_poll_interval(k_default_hmd_poll_interval)
+        , service_thread_priority(k_default_service_thread_priority)
+        , session_capture_frame_divisor(k_default_session_capture_frame_divisor)
+        , tick_budget_ms(k_default_tick_budget_ms)
+        , apply_client_latency_prediction(k_default_apply_client_latency_prediction)
     {};
 
     const boost::property_tree::ptree
@@ -49,7 +72,13 @@ public:
         pt.put("tracker_reconnect_interval", tracker_reconnect_interval);
         pt.put("tracker_poll_interval", tracker_poll_interval);
         pt.put("hmd_reconnect_interval", hmd_reconnect_interval);
-        pt.put("hmd_poll_interval", hmd_poll_interval);        
+        pt.put("hmd_poll_interval", hmd_poll_interval);
+        pt.put("service_thread_priority", service_thread_priority);
+        pt.put("virtual_controller_input_log", virtual_controller_input_log);
+        pt.put("session_capture_file", session_capture_file);
+        pt.put("session_capture_frame_divisor", session_capture_frame_divisor);
+        pt.put("tick_budget_ms", tick_budget_ms);
+        pt.put("apply_client_latency_prediction", apply_client_latency_prediction);
 
         return pt;
     }
@@ -62,7 +91,13 @@ public:
         tracker_reconnect_interval = pt.get<int>("tracker_reconnect_interval", k_default_tracker_reconnect_interval);
         tracker_poll_interval = pt.get<int>("tracker_poll_interval", k_default_tracker_poll_interval);
         hmd_reconnect_interval = pt.get<int>("hmd_reconnect_interval", k_default_hmd_reconnect_interval);
-        hmd_poll_interval = pt.get<int>("hmd_poll_interval", k_default_hmd_poll_interval);        
+        hmd_poll_interval = pt.get<int>("hmd_poll_interval", k_default_hmd_poll_interval);
+        service_thread_priority = pt.get<int>("service_thread_priority", k_default_service_thread_priority);
+        virtual_controller_input_log = pt.get<std::string>("virtual_controller_input_log", "");
+        session_capture_file = pt.get<std::string>("session_capture_file", "");
+        session_capture_frame_divisor = pt.get<int>("session_capture_frame_divisor", k_default_session_capture_frame_divisor);
+        tick_budget_ms = pt.get<int>("tick_budget_ms", k_default_tick_budget_ms);
+        apply_client_latency_prediction = pt.get<bool>("apply_client_latency_prediction", k_default_apply_client_latency_prediction);
     }
 
     int controller_reconnect_interval;
@@ -70,7 +105,28 @@ public:
     int tracker_reconnect_interval;
     int tracker_poll_interval;
     int hmd_reconnect_interval;
-    int hmd_poll_interval;    
+    int hmd_poll_interval;
+    // Priority offset applied to the service thread at startup
+    // (see ServerUtility::set_current_thread_priority)
+    int service_thread_priority;
+    // Recorded input report log to replay through a VirtualController
+    // (empty = no virtual controller)
+    std::string virtual_controller_input_log;
+    // Record the whole session (camera frames + controller reports) to this
+    // file while the service runs (empty = off); see SessionCapture.h
+    std::string session_capture_file;
+    int session_capture_frame_divisor;
+    // Per-tick time budget (ms) the frame budget governor holds the update
+    // loop to (0 = governor disabled). Under sustained overload the governor
+    // sheds the cheapest-to-degrade optical work first (coarse ellipse fit,
+    // then optical updates on alternate ticks) instead of letting every
+    // stage jitter; IMU filtering and the publish cadence are never degraded.
+    int tick_budget_ms;
+    // When true, each connection's controller stream packets are generated
+    // with the pose predicted ahead by that connection's measured delivery
+    // latency (timestamp echo in the data stream) on top of the controller's
+    // configured prediction_time
+    bool apply_client_latency_prediction;
 };
 
 // DeviceManager - This is the interface used by PSMoveService
@@ -78,6 +134,11 @@ DeviceManager *DeviceManager::m_instance= nullptr;
 
 DeviceManager::DeviceManager()
     : m_config() // NULL config until startup
+    , m_hotplug_listener(nullptr)
+    , m_tick_overrun_streak(0)
+    , m_tick_recovered_streak(0)
+    , m_bApplyClientLatencyPrediction(false)
+    , m_publish_tick_id(0)
     , m_controller_manager(new ControllerManager())
     , m_tracker_manager(new TrackerManager())
     , m_hmd_manager(new HMDManager())
@@ -96,6 +157,8 @@ DeviceManager::startup()
 {
     bool success= true;
 
+    StartupPhaseProfiler::beginPhase("config_load");
+
     m_config = DeviceManagerConfigPtr(new DeviceManagerConfig);
 
 	// Load the config from disk
@@ -103,19 +166,78 @@ DeviceManager::startup()
 
 	// Save the config back out again in case defaults changed
 	m_config->save();
-    
+
+    // Apply the configured scheduling priority to the service thread and
+    // register it with the multimedia scheduler class so the compositor
+    // can't starve the update loop under desktop load
+    if (m_config->service_thread_priority != 0)
+    {
+        if (!ServerUtility::set_current_thread_priority(m_config->service_thread_priority))
+        {
+            SERVER_LOG_WARNING("DeviceManager::startup") <<
+                "Failed to apply service thread priority offset " << m_config->service_thread_priority;
+        }
+    }
+    ServerUtility::register_current_thread_multimedia_class("Games");
+    ThreadCpuMonitor::registerCurrentThread("service_main");
+
+    StartupPhaseProfiler::beginPhase("snapshot_restore");
+
+    // Pick up any runtime state snapshot a recently shut down service left
+    // behind; devices restore from it as they reopen
+    WarmRestartSnapshot::loadAtStartup();
+
+    // Arm the startup enumeration fast passes from the last session's
+    // recorded device topology (full scans refresh the cache as they run)
+    DeviceTopologyCache::loadAtStartup();
+
+    // Record the whole session to disk when asked to (field repros)
+    if (m_config->session_capture_file.length() > 0)
+    {
+        SessionCapture::startRecording(
+            m_config->session_capture_file,
+            m_config->session_capture_frame_divisor);
+    }
+
+    m_bApplyClientLatencyPrediction = m_config->apply_client_latency_prediction;
+
+    StartupPhaseProfiler::beginPhase("controller_manager");
     m_controller_manager->reconnect_interval = m_config->controller_reconnect_interval;
     m_controller_manager->poll_interval = m_config->controller_poll_interval;
+    m_controller_manager->virtual_controller_input_log = m_config->virtual_controller_input_log;
     success &= m_controller_manager->startup();
-    
+
+    StartupPhaseProfiler::beginPhase("tracker_manager");
     m_tracker_manager->reconnect_interval = m_config->tracker_reconnect_interval;
     m_tracker_manager->poll_interval = m_config->tracker_poll_interval;
     success &= m_tracker_manager->startup();
 
+    StartupPhaseProfiler::beginPhase("hmd_manager");
     m_hmd_manager->reconnect_interval = m_config->hmd_reconnect_interval;
     m_hmd_manager->poll_interval = m_config->hmd_poll_interval;
-    success &= m_hmd_manager->startup();    
-    
+    success &= m_hmd_manager->startup();
+
+    StartupPhaseProfiler::beginPhase("hotplug_listener");
+
+    // If the platform can tell us about device arrival/removal, let those
+    // events drive the enumerator rescans instead of the reconnect timers
+    m_hotplug_listener = allocate_device_hotplug_listener();
+    if (m_hotplug_listener->startup())
+    {
+        m_controller_manager->set_hotplug_driven(true);
+        m_tracker_manager->set_hotplug_driven(true);
+        m_hmd_manager->set_hotplug_driven(true);
+    }
+
+    // After a warm restart, don't wait out any reconnect interval - rescan
+    // on the very first poll so the snapshotted devices reopen immediately
+    if (WarmRestartSnapshot::getWasLoaded())
+    {
+        m_controller_manager->handle_device_change_event();
+        m_tracker_manager->handle_device_change_event();
+        m_hmd_manager->handle_device_change_event();
+    }
+
     m_instance= this;
     
     return success;
@@ -124,16 +246,95 @@ DeviceManager::startup()
 void
 DeviceManager::update()
 {
+    const std::chrono::time_point<std::chrono::high_resolution_clock> tick_start_time=
+        std::chrono::high_resolution_clock::now();
+
+    if (m_hotplug_listener->fetchAndClearDeviceChangeFlag())
+    {
+        // Something was plugged in or unplugged - schedule rescans
+        m_controller_manager->handle_device_change_event();
+        m_tracker_manager->handle_device_change_event();
+        m_hmd_manager->handle_device_change_event();
+    }
+
     m_controller_manager->poll(); // Update controller counts and poll button/IMU state
     m_tracker_manager->poll(); // Update tracker count and poll video frames
     m_hmd_manager->poll(); // Update HMD count and poll IMU state
 
+    m_tracker_manager->advanceUpdatePhase(); // Rotate which trackers get projection work when interleaving is enabled
+    m_tracker_manager->prepareSharedSegmentationPasses(); // Segment each tracker frame once for all tracked controllers and HMDs
+
     m_controller_manager->updateStateAndPredict(m_tracker_manager); // Compute pose/prediction of tracking blob+IMU state
     m_hmd_manager->updateStateAndPredict(m_tracker_manager); // Compute pose/prediction of tracking blobs+IMU state
 
+    // Everything published below is stamped with the same tick id, marking
+    // the per-device packets of this pass as one coherent frame group
+    ++m_publish_tick_id;
+
     m_controller_manager->publish(); // publish controller state to any listening clients  (common case)
     m_tracker_manager->publish(); // publish tracker state to any listening clients (probably only used by ConfigTool)
     m_hmd_manager->publish(); // publish hmd state to any listening clients (common case)
+
+    if (m_config->tick_budget_ms > 0)
+    {
+        updateFrameBudgetGovernor(tick_start_time); // Shed/restore optical work based on how this tick fit the budget
+    }
+}
+
+void
+DeviceManager::updateFrameBudgetGovernor(
+    const std::chrono::time_point<std::chrono::high_resolution_clock> &tick_start_time)
+{
+    const std::chrono::time_point<std::chrono::high_resolution_clock> now=
+        std::chrono::high_resolution_clock::now();
+    const float tick_duration_ms=
+        std::chrono::duration_cast<std::chrono::duration<float, std::milli>>(now - tick_start_time).count();
+    const float budget_ms= static_cast<float>(m_config->tick_budget_ms);
+    const int degradation_level= m_tracker_manager->getOpticalDegradationLevel();
+
+    if (tick_duration_ms > budget_ms)
+    {
+        m_tick_recovered_streak= 0;
+        ++m_tick_overrun_streak;
+
+        // Under sustained overload shed the cheapest-to-degrade optical work
+        // first; IMU filtering and the publish cadence are never touched
+        if (m_tick_overrun_streak >= k_governor_ticks_to_degrade && degradation_level < 2)
+        {
+            m_tracker_manager->setOpticalDegradationLevel(degradation_level + 1);
+            m_tick_overrun_streak= 0;
+
+            SERVER_LOG_WARNING("DeviceManager::update") <<
+                "Tick budget of " << budget_ms << "ms overrun (last tick " << tick_duration_ms <<
+                "ms), degrading optical tracking to level " << (degradation_level + 1) <<
+                " (1=coarse ellipse fit, 2=alternate-tick optical)";
+        }
+    }
+    else if (tick_duration_ms < budget_ms*k_governor_restore_fraction)
+    {
+        m_tick_overrun_streak= 0;
+
+        if (degradation_level > 0)
+        {
+            ++m_tick_recovered_streak;
+
+            if (m_tick_recovered_streak >= k_governor_ticks_to_restore)
+            {
+                m_tracker_manager->setOpticalDegradationLevel(degradation_level - 1);
+                m_tick_recovered_streak= 0;
+
+                SERVER_LOG_INFO("DeviceManager::update") <<
+                    "Tick budget recovered, restoring optical tracking to level " << (degradation_level - 1);
+            }
+        }
+    }
+    else
+    {
+        // In the hysteresis band between the budget and the restore
+        // threshold - hold the current level
+        m_tick_overrun_streak= 0;
+        m_tick_recovered_streak= 0;
+    }
 }
 
 void
@@ -141,10 +342,41 @@ DeviceManager::shutdown()
 {
     m_config->save();
 
+    // Snapshot per-device runtime tracking state before anything closes so a
+    // service restarted within the next minute can warm-reopen from it
+    WarmRestartSnapshot::beginCapture();
+    for (int device_id = 0; device_id < m_controller_manager->getMaxDevices(); ++device_id)
+    {
+        ServerControllerViewPtr controller_view = getControllerViewPtr(device_id);
+
+        if (controller_view && controller_view->getIsOpen())
+        {
+            controller_view->captureWarmRestartState();
+        }
+    }
+    for (int device_id = 0; device_id < m_hmd_manager->getMaxDevices(); ++device_id)
+    {
+        ServerHMDViewPtr hmd_view = getHMDViewPtr(device_id);
+
+        if (hmd_view && hmd_view->getIsOpen())
+        {
+            hmd_view->captureWarmRestartState();
+        }
+    }
+    WarmRestartSnapshot::endCapture();
+
+    m_hotplug_listener->shutdown();
+    delete m_hotplug_listener;
+    m_hotplug_listener = nullptr;
+
     m_controller_manager->shutdown();
     m_tracker_manager->shutdown();
     m_hmd_manager->shutdown();
 
+    SessionCapture::stopRecording();
+
+    ThreadCpuMonitor::unregisterCurrentThread();
+
     m_instance= nullptr;
 }
 
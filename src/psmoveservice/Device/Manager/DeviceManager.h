@@ -4,6 +4,7 @@
 //-- includes -----
 #include <memory>
 #include <chrono>
+#include <cstdint>
 //#include "PSMoveProtocol.pb.h"
 
 //-- typedefs -----
@@ -31,6 +32,14 @@ public:
     void update();  /**< Poll all connected devices for each specific manager. */
     void shutdown();/**< Shutdown the interfaces for each specific manager. */
 
+protected:
+    /// Adjust the optical degradation level from the measured tick duration.
+    /// Called at the end of update() when a tick budget is configured.
+    void updateFrameBudgetGovernor(
+        const std::chrono::time_point<std::chrono::high_resolution_clock> &tick_start_time);
+
+public:
+
     static inline DeviceManager *getInstance()
     { return m_instance; }
 
@@ -41,10 +50,37 @@ public:
     ServerControllerViewPtr getControllerViewPtr(int controller_id);
     ServerTrackerViewPtr getTrackerViewPtr(int tracker_id);
     ServerHMDViewPtr getHMDViewPtr(int hmd_id);
-    
+
+    /// True when controller stream packets should be predicted ahead by the
+    /// receiving connection's measured delivery latency
+    /// (see ServerRequestHandler's publish_controller_stream_packet)
+    inline bool getApplyClientLatencyPrediction() const
+    { return m_bApplyClientLatencyPrediction; }
+
+    /// Monotonic id of the current publish pass, bumped once per update()
+    /// tick. Every data frame and stream packet sent during one pass
+    /// carries the same id, letting clients group per-device packets back
+    /// into coherent multi-device frames
+    inline uint64_t getPublishTickId() const
+    { return m_publish_tick_id; }
+
 private:
     DeviceManagerConfigPtr m_config;
 
+    /// Platform hotplug notification listener.
+    /// When running, device change events trigger the enumerator rescans.
+    class DeviceHotplugListener *m_hotplug_listener;
+
+    /// Frame budget governor state (see updateFrameBudgetGovernor)
+    int m_tick_overrun_streak;
+    int m_tick_recovered_streak;
+
+    /// Cached from the config at startup (see getApplyClientLatencyPrediction)
+    bool m_bApplyClientLatencyPrediction;
+
+    /// Coherent frame-group marker (see getPublishTickId)
+    uint64_t m_publish_tick_id;
+
     /// Singleton instance of the class
     /// Assigned in startup, cleared in teardown
     static DeviceManager *m_instance;
@@ -5,14 +5,28 @@
 #include "ServerLog.h"
 #include "ServerDeviceView.h"
 #include "ServerNetworkManager.h"
+#include "ServerTracer.h"
 #include "ServerUtility.h"
+#include "ServiceClock.h"
 #include "ServerRequestHandler.h"
 
+#include <string>
+#include <thread>
+#include <vector>
+
+//-- constants -----
+// When hotplug notifications are available the periodic rescan only exists
+// to catch a missed notification, so it can run much less often
+static const int k_hotplug_fallback_rescan_multiplier = 30;
+
 //-- methods -----
 /// Constructor and set intervals (ms) for reconnect and polling
 DeviceTypeManager::DeviceTypeManager(const int recon_int, const int poll_int)
     : reconnect_interval(recon_int)
     , poll_interval(poll_int)
+    , m_bHotplugDriven(false)
+    , m_bDeviceChangePending(false)
+    , m_device_list_generation(1)
     , m_deviceViews(nullptr)
 {
 }
@@ -70,7 +84,9 @@ DeviceTypeManager::shutdown()
 void
 DeviceTypeManager::poll()
 {
-    std::chrono::time_point<std::chrono::high_resolution_clock> now = std::chrono::high_resolution_clock::now();
+    SERVER_TRACE_SCOPE("DeviceTypeManager::poll");
+
+    std::chrono::time_point<std::chrono::high_resolution_clock> now = ServiceClock::now();
 
     // See if it's time to poll controllers for data
     std::chrono::duration<double, std::milli> update_diff = now - m_last_poll_time;
@@ -81,17 +97,37 @@ DeviceTypeManager::poll()
         m_last_poll_time = now;
     }
 
-    // See if it's time to try update the list of connected devices
+    // See if it's time to try update the list of connected devices.
+    // In hotplug-driven mode the rescan normally fires off a pending device
+    // change notification and the timer only acts as a rare safety net.
     std::chrono::duration<double, std::milli> reconnect_diff = now - m_last_reconnect_time;
-    if (reconnect_diff.count() >= reconnect_interval)
+    const int rescan_interval =
+        m_bHotplugDriven
+        ? reconnect_interval * k_hotplug_fallback_rescan_multiplier
+        : reconnect_interval;
+
+    if (m_bDeviceChangePending || reconnect_diff.count() >= rescan_interval)
     {
         if (update_connected_devices())
         {
+            m_bDeviceChangePending = false;
             m_last_reconnect_time = now;
         }
     }
 }
 
+void
+DeviceTypeManager::handle_device_change_event()
+{
+    m_bDeviceChangePending = true;
+}
+
+void
+DeviceTypeManager::set_hotplug_driven(bool bHotplugDriven)
+{
+    m_bHotplugDriven = bHotplugDriven;
+}
+
 bool
 DeviceTypeManager::update_connected_devices()
 {
@@ -100,14 +136,28 @@ DeviceTypeManager::update_connected_devices()
     // Don't do any connection opening/closing until all pending bluetooth operations are finished
     if (can_update_connected_devices())
     {
+        // A newly enumerated device that hasn't been opened yet.
+        // The open itself runs on a transient worker thread in step 1b since
+        // it can block for seconds (USB negotiation, flash calibration reads).
+        struct PendingDeviceOpen
+        {
+            int device_id;
+            std::string device_path;
+            DeviceEnumerator *enumerator; // re-positioned at the matching entry
+            bool bOpened;
+        };
+
         const int maxDeviceCount = getMaxDevices();
         bool exists_in_enumerator[64];
+        bool claimed_by_pending_open[64];
+        std::vector<PendingDeviceOpen> pending_opens;
         bool bSendControllerUpdatedNotification = false;
 
         // Initialize temp table used to keep track of open devices
         // still found in the enumerator
         assert(maxDeviceCount <= 64);
         memset(exists_in_enumerator, 0, sizeof(exists_in_enumerator));
+        memset(claimed_by_pending_open, 0, sizeof(claimed_by_pending_open));
 
         // Step 1
         // Mark any open devices that still show up in the enumerator.
@@ -127,39 +177,37 @@ DeviceTypeManager::update_connected_devices()
                     exists_in_enumerator[device_id]= true;
                 }
                 // New controller connected case
-                else
+                else if (can_open_enumerated_device(enumerator))
                 {
-                    int device_id_ = find_first_closed_device_device_id();
-
-                    if (device_id_ != -1)
+                    // Find a closed slot not already claimed by another pending open
+                    int device_id_ = -1;
+                    for (int test_device_id = 0; test_device_id < maxDeviceCount; ++test_device_id)
                     {
-                        // Fetch the controller from it's existing controller slot
-                        ServerDeviceViewPtr availableDeviceView = getDeviceViewPtr(device_id_);
+                        ServerDeviceViewPtr device = getDeviceViewPtr(test_device_id);
 
-                        // Attempt to open the device
-                        if (availableDeviceView->open(enumerator))
-                        {
-                            const char *device_type_name =
-                                CommonDeviceState::getDeviceTypeString(availableDeviceView->getDevice()->getDeviceType());
-
-                            SERVER_LOG_INFO("DeviceTypeManager::update_connected_devices") <<
-                                "Device device_id " << device_id_ << " (" << device_type_name << ") opened";
-
-                            // Mark the device as having showed up in the enumerator
-                            exists_in_enumerator[device_id_] = true;
-
-                            // Send notificiation to clients that a new device was added
-                            bSendControllerUpdatedNotification = true;
-                        }
-                        else
+                        if (device && !device->getIsOpen() && !claimed_by_pending_open[test_device_id])
                         {
-                            SERVER_LOG_ERROR("DeviceTypeManager::update_connected_devices") << 
-                                "Device device_id " << device_id_ << " (" << enumerator->get_path() << ") failed to open!";
+                            device_id_ = test_device_id;
+                            break;
                         }
                     }
+
+                    if (device_id_ != -1)
+                    {
+                        // Defer the actual open to step 1b so that multiple new
+                        // devices get opened concurrently rather than one at a time
+                        PendingDeviceOpen pending;
+                        pending.device_id = device_id_;
+                        pending.device_path = enumerator->get_path();
+                        pending.enumerator = nullptr;
+                        pending.bOpened = false;
+
+                        pending_opens.push_back(pending);
+                        claimed_by_pending_open[device_id_] = true;
+                    }
                     else
                     {
-                        SERVER_LOG_ERROR("DeviceTypeManager::update_connected_devices") << 
+                        SERVER_LOG_ERROR("DeviceTypeManager::update_connected_devices") <<
                             "Can't connect any more new devices. Too many open device.";
                         break;
                     }
@@ -171,6 +219,93 @@ DeviceTypeManager::update_connected_devices()
             free_device_enumerator(enumerator);
         }
 
+        // Step 1b
+        // Open all of the newly enumerated devices concurrently.
+        // Opening is the slow part (each PS3Eye open negotiates USB and each
+        // PSMove open reads flash calibration), so a multi-camera multi-controller
+        // rig comes up in roughly the time of the slowest single open.
+        if (pending_opens.size() > 0)
+        {
+            // Give each pending open its own enumerator advanced to the matching
+            // entry. Enumeration is cheap and isn't guaranteed thread safe, so
+            // it stays on this thread - only the open() calls run concurrently.
+            for (PendingDeviceOpen &pending : pending_opens)
+            {
+                DeviceEnumerator *enumerator = allocate_device_enumerator();
+
+                while (enumerator->is_valid() && pending.device_path != enumerator->get_path())
+                {
+                    enumerator->next();
+                }
+
+                if (enumerator->is_valid())
+                {
+                    pending.enumerator = enumerator;
+                }
+                else
+                {
+                    // The device vanished between the scan and now.
+                    // The next rescan will sort it out.
+                    free_device_enumerator(enumerator);
+                }
+            }
+
+            {
+                std::vector<std::thread> open_threads;
+
+                for (PendingDeviceOpen &pending : pending_opens)
+                {
+                    if (pending.enumerator != nullptr)
+                    {
+                        ServerDeviceViewPtr availableDeviceView = getDeviceViewPtr(pending.device_id);
+
+                        open_threads.push_back(std::thread(
+                            [availableDeviceView, &pending]
+                            {
+                                pending.bOpened = availableDeviceView->open(pending.enumerator);
+                            }));
+                    }
+                }
+
+                for (std::thread &open_thread : open_threads)
+                {
+                    open_thread.join();
+                }
+            }
+
+            // Merge the results back on this thread under the usual notification
+            for (PendingDeviceOpen &pending : pending_opens)
+            {
+                if (pending.enumerator == nullptr)
+                {
+                    continue;
+                }
+
+                if (pending.bOpened)
+                {
+                    ServerDeviceViewPtr openedDeviceView = getDeviceViewPtr(pending.device_id);
+                    const char *device_type_name =
+                        CommonDeviceState::getDeviceTypeString(openedDeviceView->getDevice()->getDeviceType());
+
+                    SERVER_LOG_INFO("DeviceTypeManager::update_connected_devices") <<
+                        "Device device_id " << pending.device_id << " (" << device_type_name << ") opened";
+
+                    // Mark the device as having showed up in the enumerator
+                    exists_in_enumerator[pending.device_id] = true;
+
+                    // Send notificiation to clients that a new device was added
+                    bSendControllerUpdatedNotification = true;
+                }
+                else
+                {
+                    SERVER_LOG_ERROR("DeviceTypeManager::update_connected_devices") <<
+                        "Device device_id " << pending.device_id << " (" << pending.device_path << ") failed to open!";
+                }
+
+                free_device_enumerator(pending.enumerator);
+            }
+        }
+
         // Step 2
         // Close any device that is open and wasn't found in the enumerator
         for (int device_id = 0; device_id < maxDeviceCount; ++device_id)
@@ -206,6 +341,8 @@ DeviceTypeManager::update_connected_devices()
 void
 DeviceTypeManager::publish()
 {
+    SERVER_TRACE_SCOPE("DeviceTypeManager::publish");
+
     // Publish any new data to client connections
     for (int device_id = 0; device_id < getMaxDevices(); ++device_id)
     {
@@ -218,6 +355,9 @@ DeviceTypeManager::publish()
 void
 DeviceTypeManager::send_device_list_changed_notification()
 {
+    // Any cached copy of the device list a client holds is now stale
+    bumpDeviceListGeneration();
+
     ResponsePtr response(new PSMoveProtocol::Response);
     response->set_type(static_cast<PSMoveProtocol::Response_ResponseType>(getListUpdatedResponseType()));
     response->set_request_id(-1);
@@ -238,6 +378,12 @@ DeviceTypeManager::can_update_connected_devices()
     return !ServerRequestHandler::get_instance()->any_active_bluetooth_requests();
 }
 
+bool
+DeviceTypeManager::can_open_enumerated_device(const DeviceEnumerator *enumerator)
+{
+    return true;
+}
+
 void
 DeviceTypeManager::poll_devices()
 {
@@ -263,11 +409,37 @@ DeviceTypeManager::find_open_device_device_id(const DeviceEnumerator *enumerator
 {
     int result_device_id = -1;
 
+    // Fetch the candidate's path once. The loop fast-rejects on the path each
+    // view cached at open() so only a path match pays for the virtual
+    // device-level confirmation - this runs per candidate on every rescan.
+    const char *enumerator_path = enumerator->get_path();
+
     for (int device_id = 0; device_id < getMaxDevices(); ++device_id)
     {
         ServerDeviceViewPtr device = getDeviceViewPtr(device_id);
 
-        if (device && device->matchesDeviceEnumerator(enumerator))
+        if (!device)
+        {
+            continue;
+        }
+
+        const std::string &device_path = device->getDevicePath();
+
+        if (!device_path.empty() && enumerator_path != nullptr)
+        {
+#ifdef _WIN32
+            const bool bPathMatches = _stricmp(device_path.c_str(), enumerator_path) == 0;
+#else
+            const bool bPathMatches = strcmp(device_path.c_str(), enumerator_path) == 0;
+#endif
+
+            if (!bPathMatches)
+            {
+                continue;
+            }
+        }
+
+        if (device->matchesDeviceEnumerator(enumerator))
         {
             result_device_id = device_id;
             break;
@@ -23,6 +23,14 @@ public:
     void poll();
     void publish();
 
+    /// Called when a platform hotplug notification fired.
+    /// Schedules an enumerator rescan on the next poll.
+    void handle_device_change_event();
+
+    /// When hotplug notifications drive enumeration the periodic rescan is
+    /// demoted to a rare fallback in case a notification was missed
+    void set_hotplug_driven(bool bHotplugDriven);
+
     virtual int getMaxDevices() const = 0;
 
     /**
@@ -34,6 +42,21 @@ public:
     */
     ServerDeviceViewPtr getDeviceViewPtr(int device_id);
 
+    /// Generation cookie for the device list. Incremented whenever the set of
+    /// devices or any list-visible device property changes, so clients can
+    /// revalidate a cached list response instead of refetching it.
+    inline int getDeviceListGeneration() const
+    {
+        return m_device_list_generation;
+    }
+
+    /// Called by request handlers that mutate a property surfaced in the
+    /// device list response (tracking color, filters, pose, intrinsics, ...)
+    inline void bumpDeviceListGeneration()
+    {
+        ++m_device_list_generation;
+    }
+
     int reconnect_interval;
     int poll_interval;
 
@@ -49,6 +72,9 @@ protected:
 
     virtual bool can_poll_connected_devices();
     virtual bool can_update_connected_devices();
+    // True if the device the enumerator is currently pointed at should be
+    // opened by this process (see the tracker shard partitioning)
+    virtual bool can_open_enumerated_device(const class DeviceEnumerator *enumerator);
     virtual class DeviceEnumerator *allocate_device_enumerator() = 0;
     virtual void free_device_enumerator(class DeviceEnumerator *) = 0;
     virtual ServerDeviceView *allocate_device_view(int device_id) = 0;
@@ -63,6 +89,11 @@ protected:
     std::chrono::time_point<std::chrono::high_resolution_clock> m_last_reconnect_time;
     std::chrono::time_point<std::chrono::high_resolution_clock> m_last_poll_time;
 
+    bool m_bHotplugDriven;
+    bool m_bDeviceChangePending;
+
+    int m_device_list_generation;
+
     ServerDeviceViewPtr *m_deviceViews;
 };
 
@@ -4,6 +4,7 @@
 #include "ServerLog.h"
 #include "ServerHMDView.h"
 #include "ServerDeviceView.h"
+#include "TrackerManager.h"
 
 //-- methods -----
 HMDManager::HMDManager()
@@ -33,6 +34,10 @@ HMDManager::shutdown()
 void
 HMDManager::updateStateAndPredict(TrackerManager* tracker_manager)
 {
+	TrackerPoseEstimationWorkerPool &worker_pool = tracker_manager->getPoseEstimationWorkerPool();
+
+	// Stage 1: Optical pose estimation, one device at a time
+	// (each fans per-tracker work across the worker pool internally)
 	for (int device_id = 0; device_id < getMaxDevices(); ++device_id)
 	{
 		ServerHMDViewPtr hmdView = getHMDViewPtr(device_id);
@@ -40,9 +45,25 @@ HMDManager::updateStateAndPredict(TrackerManager* tracker_manager)
 		if (hmdView->getIsOpen())
 		{
 			hmdView->updateOpticalPoseEstimation(tracker_manager);
-			hmdView->updateStateAndPredict();
 		}
 	}
+
+	// Stage 2: Filter state updates run concurrently - each job only
+	// touches its own HMD view
+	for (int device_id = 0; device_id < getMaxDevices(); ++device_id)
+	{
+		ServerHMDViewPtr hmdView = getHMDViewPtr(device_id);
+
+		if (hmdView->getIsOpen())
+		{
+			worker_pool.addJob(
+				[hmdView]
+				{
+					hmdView->updateStateAndPredict();
+				});
+		}
+	}
+	worker_pool.waitForAllJobs();
 }
 
 ServerHMDViewPtr
@@ -1,13 +1,39 @@
 //-- includes -----
 #include "TrackerManager.h"
 #include "TrackerDeviceEnumerator.h"
+#include "ControllerManager.h"
+#include "HMDManager.h"
 #include "ServerLog.h"
 #include "ServerTrackerView.h"
+#include "TrackerShardExchange.h"
 #include "ServerDeviceView.h"
 #include "MathUtility.h"
 #include "PSMoveProtocol.pb.h"
 
+#include <algorithm>
+
 //-- constants -----
+// Isochronous bandwidth model used by the USB bandwidth planner. A PS3Eye
+// streams single-byte Bayer pixels, so the payload bitrate of one camera is
+// width*height*fps*8 bits; isochronous framing adds roughly 15% on top.
+static const float k_usb_iso_protocol_overhead = 1.15f;
+
+// Practical isochronous budget of one high-speed (USB 2.0) host controller.
+// The theoretical bus rate is 480Mbps but periodic transfers can only claim
+// about 80% of each microframe.
+static const float k_usb_high_speed_iso_budget_mbps = 384.f;
+
+// Frame rates the PS3Eye can run at 640x480, best first; the planner reports
+// the highest one that fits the per-bus budget
+static const int k_planner_frame_rates[] = { 60, 50, 40, 30, 25, 15 };
+static const int k_planner_frame_rate_count = sizeof(k_planner_frame_rates) / sizeof(k_planner_frame_rates[0]);
+
+static const int k_planner_frame_width = 640;
+static const int k_planner_frame_height = 480;
+
+// Contour point budget the sphere ellipse fit drops to when the frame budget
+// governor puts optical tracking in coarse mode (see DeviceManager::update)
+static const int k_coarse_contour_fit_point_count = 12;
 
 //-- Tracker Manager Config -----
 const int TrackerManagerConfig::CONFIG_VERSION = 2;
@@ -16,12 +42,32 @@ TrackerManagerConfig::TrackerManagerConfig(const std::string &fnamebase)
     : PSMoveConfig(fnamebase)
 {
 	ignore_pose_from_one_tracker = false;
+	use_parallel_optical_tracking = true;
+	tracker_interleave_period = 1;
+	capture_thread_affinity_mask = 0;
+	vision_thread_affinity_mask = 0;
+	capture_thread_priority = 0;
+	vision_thread_priority = 0;
+	shared_memory_use_large_pages = false;
+	shared_memory_numa_node = -1;
+	max_contour_fit_points = 32;
     optical_tracking_timeout= 100;
 	tracker_sleep_ms = 1;
 	use_bgr_to_hsv_lookup_table = true;
 	exclude_opposed_cameras = false;
 	min_valid_projection_area= 16;
 	disable_roi = false;
+	virtual_tracker_count = 0;
+	tracker_shard_index = 0;
+	tracker_shard_count = 1;
+	default_capture_mode = 0; // 640x480 @ 60Hz
+	compressed_video_quality = 60;
+	compressed_video_max_fps = 15;
+	enable_color_auto_tuning = false;
+	color_auto_tuning_rate = 0.05f;
+	color_auto_tuning_max_drift = 10.f;
+	color_auto_tuning_save_interval = 300.f;
+	enable_auto_exposure_calibration = false;
     default_tracker_profile.exposure = 32;
     default_tracker_profile.gain = 32;
 	default_tracker_profile.color_preset_table.table_name= "default_tracker_profile";
@@ -40,6 +86,15 @@ TrackerManagerConfig::config2ptree()
     pt.put("version", TrackerManagerConfig::CONFIG_VERSION);
 
 	pt.put("ignore_pose_from_one_tracker", ignore_pose_from_one_tracker);
+	pt.put("use_parallel_optical_tracking", use_parallel_optical_tracking);
+	pt.put("tracker_interleave_period", tracker_interleave_period);
+	pt.put("capture_thread_affinity_mask", capture_thread_affinity_mask);
+	pt.put("vision_thread_affinity_mask", vision_thread_affinity_mask);
+	pt.put("capture_thread_priority", capture_thread_priority);
+	pt.put("vision_thread_priority", vision_thread_priority);
+	pt.put("shared_memory_use_large_pages", shared_memory_use_large_pages);
+	pt.put("shared_memory_numa_node", shared_memory_numa_node);
+	pt.put("max_contour_fit_points", max_contour_fit_points);
     pt.put("optical_tracking_timeout", optical_tracking_timeout);
 	pt.put("use_bgr_to_hsv_lookup_table", use_bgr_to_hsv_lookup_table);
 	pt.put("tracker_sleep_ms", tracker_sleep_ms);
@@ -49,7 +104,23 @@ TrackerManagerConfig::config2ptree()
 	pt.put("min_valid_projection_area", min_valid_projection_area);	
 
 	pt.put("disable_roi", disable_roi);
-    
+
+	pt.put("virtual_tracker_count", virtual_tracker_count);
+
+	pt.put("tracker_shard_index", tracker_shard_index);
+	pt.put("tracker_shard_count", tracker_shard_count);
+
+	pt.put("default_capture_mode", default_capture_mode);
+
+	pt.put("compressed_video_quality", compressed_video_quality);
+	pt.put("compressed_video_max_fps", compressed_video_max_fps);
+
+	pt.put("enable_color_auto_tuning", enable_color_auto_tuning);
+	pt.put("color_auto_tuning_rate", color_auto_tuning_rate);
+	pt.put("color_auto_tuning_max_drift", color_auto_tuning_max_drift);
+	pt.put("color_auto_tuning_save_interval", color_auto_tuning_save_interval);
+	pt.put("enable_auto_exposure_calibration", enable_auto_exposure_calibration);
+
     pt.put("default_tracker_profile.exposure", default_tracker_profile.exposure);
     pt.put("default_tracker_profile.gain", default_tracker_profile.gain);
 
@@ -68,12 +139,32 @@ TrackerManagerConfig::ptree2config(const boost::property_tree::ptree &pt)
     if (version == TrackerManagerConfig::CONFIG_VERSION)
     {
 		ignore_pose_from_one_tracker = pt.get<bool>("ignore_pose_from_one_tracker", ignore_pose_from_one_tracker);
+		use_parallel_optical_tracking = pt.get<bool>("use_parallel_optical_tracking", use_parallel_optical_tracking);
+		tracker_interleave_period = std::max(pt.get<int>("tracker_interleave_period", tracker_interleave_period), 1);
+		capture_thread_affinity_mask = pt.get<int>("capture_thread_affinity_mask", capture_thread_affinity_mask);
+		vision_thread_affinity_mask = pt.get<int>("vision_thread_affinity_mask", vision_thread_affinity_mask);
+		capture_thread_priority = pt.get<int>("capture_thread_priority", capture_thread_priority);
+		vision_thread_priority = pt.get<int>("vision_thread_priority", vision_thread_priority);
+		shared_memory_use_large_pages = pt.get<bool>("shared_memory_use_large_pages", shared_memory_use_large_pages);
+		shared_memory_numa_node = pt.get<int>("shared_memory_numa_node", shared_memory_numa_node);
+		max_contour_fit_points = std::max(pt.get<int>("max_contour_fit_points", max_contour_fit_points), 0);
         optical_tracking_timeout= pt.get<int>("optical_tracking_timeout", optical_tracking_timeout);
 		use_bgr_to_hsv_lookup_table = pt.get<bool>("use_bgr_to_hsv_lookup_table", use_bgr_to_hsv_lookup_table);
 		tracker_sleep_ms = pt.get<int>("tracker_sleep_ms", tracker_sleep_ms);
 		exclude_opposed_cameras = pt.get<bool>("excluded_opposed_cameras", exclude_opposed_cameras);
 		min_valid_projection_area = pt.get<float>("min_valid_projection_area", min_valid_projection_area);	
 		disable_roi = pt.get<bool>("disable_roi", disable_roi);
+		virtual_tracker_count = std::min(std::max(pt.get<int>("virtual_tracker_count", virtual_tracker_count), 0), TrackerManager::k_max_devices);
+		tracker_shard_count = std::min(std::max(pt.get<int>("tracker_shard_count", tracker_shard_count), 1), TrackerShardExchange::k_max_shards);
+		tracker_shard_index = std::min(std::max(pt.get<int>("tracker_shard_index", tracker_shard_index), 0), tracker_shard_count - 1);
+		default_capture_mode = std::max(pt.get<int>("default_capture_mode", default_capture_mode), 0);
+		compressed_video_quality = std::min(std::max(pt.get<int>("compressed_video_quality", compressed_video_quality), 1), 100);
+		compressed_video_max_fps = std::max(pt.get<int>("compressed_video_max_fps", compressed_video_max_fps), 1);
+		enable_color_auto_tuning = pt.get<bool>("enable_color_auto_tuning", enable_color_auto_tuning);
+		color_auto_tuning_rate = std::min(std::max(pt.get<float>("color_auto_tuning_rate", color_auto_tuning_rate), 0.f), 1.f);
+		color_auto_tuning_max_drift = std::max(pt.get<float>("color_auto_tuning_max_drift", color_auto_tuning_max_drift), 0.f);
+		color_auto_tuning_save_interval = std::max(pt.get<float>("color_auto_tuning_save_interval", color_auto_tuning_save_interval), 1.f);
+		enable_auto_exposure_calibration = pt.get<bool>("enable_auto_exposure_calibration", enable_auto_exposure_calibration);
         default_tracker_profile.exposure = pt.get<float>("default_tracker_profile.exposure", 32);
         default_tracker_profile.gain = pt.get<float>("default_tracker_profile.gain", 32);
 
@@ -128,8 +219,30 @@ TrackerManagerConfig::get_global_down_axis() const
 //-- Tracker Manager -----
 TrackerManager::TrackerManager()
     : DeviceTypeManager(10000, 13)
+    , m_config_generation(0)
+    , m_update_phase(0)
+    , m_optical_degradation_level(0)
     , m_tracker_list_dirty(false)
+    , m_shard_exchange(nullptr)
 {
+    // Publish a snapshot of the defaults so getConfigSnapshot() never
+    // returns null, even before startup() loads the config from disk
+    publishConfigSnapshot();
+}
+
+void
+TrackerManager::publishConfigSnapshot()
+{
+    std::shared_ptr<ConfigSnapshot> snapshot = std::make_shared<ConfigSnapshot>();
+
+    snapshot->generation = ++m_config_generation;
+    snapshot->config = cfg;
+
+    // Readers holding the previous snapshot keep it alive through their
+    // frame; the shared_ptr swap retires it once the last of them drops it
+    std::atomic_store(
+        &m_config_snapshot,
+        std::shared_ptr<const ConfigSnapshot>(std::move(snapshot)));
 }
 
 bool 
@@ -145,13 +258,142 @@ TrackerManager::startup()
         // Save back out the config in case there were updated defaults
         cfg.save();
 
+        // Replace the default-constructed snapshot with the loaded config
+        publishConfigSnapshot();
+
         // Refresh the tracker list
         mark_tracker_list_dirty();
+
+        // Spin up the optical pose estimation worker pool.
+        // Besides the per-tracker projection jobs the pool also runs the
+        // per-device filter update batches, so size it for the largest batch
+        // it can be handed (a full arena of controllers), capped by the core
+        // count so the workers don't oversubscribe smaller machines.
+        if (cfg.use_parallel_optical_tracking)
+        {
+            const int core_count = static_cast<int>(std::thread::hardware_concurrency());
+            const int max_batch_size = std::max(
+                k_max_devices,
+                std::max(ControllerManager::k_max_devices, HMDManager::k_max_devices));
+            const int worker_count = std::min(max_batch_size, std::max(core_count - 1, 1));
+
+            m_pose_estimation_worker_pool.startup(
+                worker_count,
+                static_cast<unsigned int>(cfg.vision_thread_affinity_mask),
+                cfg.vision_thread_priority);
+        }
+
+        // Bring up the multi-instance observation exchange when this
+        // instance is configured as one shard of a larger camera rig
+        if (cfg.tracker_shard_count > 1)
+        {
+            SERVER_LOG_INFO("TrackerManager::startup")
+                << "Tracker sharding enabled: shard " << cfg.tracker_shard_index
+                << " of " << cfg.tracker_shard_count;
+
+            m_shard_exchange = new TrackerShardExchange();
+
+            if (!m_shard_exchange->initialize(cfg.tracker_shard_index, cfg.tracker_shard_count))
+            {
+                SERVER_LOG_ERROR("TrackerManager::startup")
+                    << "Failed to initialize the tracker shard exchange, sharding disabled";
+
+                delete m_shard_exchange;
+                m_shard_exchange = nullptr;
+            }
+        }
     }
 
     return bSuccess;
 }
 
+void
+TrackerManager::shutdown()
+{
+    m_pose_estimation_worker_pool.shutdown();
+
+    if (m_shard_exchange != nullptr)
+    {
+        delete m_shard_exchange;
+        m_shard_exchange = nullptr;
+    }
+
+    DeviceTypeManager::shutdown();
+}
+
+void
+TrackerManager::advanceUpdatePhase()
+{
+    const int interleave_period = getEffectiveInterleavePeriod();
+
+    if (interleave_period > 1)
+    {
+        m_update_phase = (m_update_phase + 1) % interleave_period;
+    }
+    else
+    {
+        m_update_phase = 0;
+    }
+}
+
+bool
+TrackerManager::getIsTrackerScheduledThisTick(int tracker_id) const
+{
+    const int interleave_period = getEffectiveInterleavePeriod();
+
+    // With a period of N, tracker i gets projection work on ticks where
+    // (i % N) matches the current phase - i.e. every Nth tick, staggered
+    // so that roughly 1/N of the trackers are processed each tick.
+    return
+        interleave_period <= 1 ||
+        (tracker_id % interleave_period) == m_update_phase;
+}
+
+void
+TrackerManager::setOpticalDegradationLevel(int level)
+{
+    m_optical_degradation_level = std::min(std::max(level, 0), 2);
+}
+
+int
+TrackerManager::getEffectiveInterleavePeriod() const
+{
+    // At degradation level 2 every tracker gets optical work at most every
+    // other tick, even if interleaving is normally disabled
+    return
+        (m_optical_degradation_level >= 2)
+        ? std::max(cfg.tracker_interleave_period, 2)
+        : cfg.tracker_interleave_period;
+}
+
+int
+TrackerManager::getEffectiveMaxContourFitPoints() const
+{
+    if (m_optical_degradation_level >= 1)
+    {
+        return
+            (cfg.max_contour_fit_points > 0)
+            ? std::min(cfg.max_contour_fit_points, k_coarse_contour_fit_point_count)
+            : k_coarse_contour_fit_point_count;
+    }
+
+    return cfg.max_contour_fit_points;
+}
+
+void
+TrackerManager::prepareSharedSegmentationPasses()
+{
+    for (int tracker_id = 0; tracker_id < k_max_devices; ++tracker_id)
+    {
+        ServerTrackerViewPtr tracker_view = getTrackerViewPtr(tracker_id);
+
+        if (tracker_view->getIsOpen() && getIsTrackerScheduledThisTick(tracker_id))
+        {
+            tracker_view->prepareSharedSegmentationPass();
+        }
+    }
+}
+
 void
 TrackerManager::closeAllTrackers()
 {
@@ -178,6 +420,23 @@ TrackerManager::can_update_connected_devices()
     return m_tracker_list_dirty && DeviceTypeManager::can_update_connected_devices();
 }
 
+bool
+TrackerManager::can_open_enumerated_device(const DeviceEnumerator *enumerator)
+{
+    // When tracker sharding is active this instance only opens the cameras
+    // its shard owns - the other instances' observations of them arrive
+    // through the shard exchange instead
+    if (cfg.tracker_shard_count > 1)
+    {
+        const TrackerDeviceEnumerator *tracker_enumerator =
+            static_cast<const TrackerDeviceEnumerator *>(enumerator);
+
+        return (tracker_enumerator->get_camera_index() % cfg.tracker_shard_count) == cfg.tracker_shard_index;
+    }
+
+    return true;
+}
+
 void 
 TrackerManager::mark_tracker_list_dirty()
 {
@@ -187,7 +446,7 @@ TrackerManager::mark_tracker_list_dirty()
 DeviceEnumerator *
 TrackerManager::allocate_device_enumerator()
 {
-    return new TrackerDeviceEnumerator;
+    return new TrackerDeviceEnumerator(cfg.virtual_tracker_count);
 }
 
 void
@@ -197,6 +456,93 @@ TrackerManager::free_device_enumerator(DeviceEnumerator *enumerator)
 
     // Tracker list is no longer dirty after we have iterated through the list of cameras
     m_tracker_list_dirty = false;
+
+    // The set of connected cameras may have changed - re-plan the USB bandwidth
+    compute_usb_bandwidth_plan();
+}
+
+void
+TrackerManager::compute_usb_bandwidth_plan()
+{
+    m_usb_bus_bandwidth.clear();
+
+    // Count the physical cameras attached to each USB host controller
+    // (virtual trackers report bus -1 and consume no USB bandwidth)
+    for (TrackerDeviceEnumerator enumerator; enumerator.is_valid(); enumerator.next())
+    {
+        const int bus_number = enumerator.get_usb_bus_number();
+
+        if (bus_number < 0)
+        {
+            continue;
+        }
+
+        USBBusBandwidthInfo *bus_info = nullptr;
+        for (USBBusBandwidthInfo &existing_bus_info : m_usb_bus_bandwidth)
+        {
+            if (existing_bus_info.bus_number == bus_number)
+            {
+                bus_info = &existing_bus_info;
+                break;
+            }
+        }
+
+        if (bus_info == nullptr)
+        {
+            USBBusBandwidthInfo new_bus_info;
+            new_bus_info.bus_number = bus_number;
+            new_bus_info.camera_count = 0;
+            new_bus_info.estimated_mbps = 0.f;
+            new_bus_info.budget_mbps = k_usb_high_speed_iso_budget_mbps;
+            new_bus_info.oversubscribed = false;
+            new_bus_info.feasible_frame_rate = k_planner_frame_rates[0];
+
+            m_usb_bus_bandwidth.push_back(new_bus_info);
+            bus_info = &m_usb_bus_bandwidth.back();
+        }
+
+        ++bus_info->camera_count;
+    }
+
+    // Estimate the load on each bus at full rate and find the highest frame
+    // rate the cameras on it could all run at without oversubscribing
+    for (USBBusBandwidthInfo &bus_info : m_usb_bus_bandwidth)
+    {
+        const float mbps_per_camera_per_fps =
+            static_cast<float>(k_planner_frame_width * k_planner_frame_height * 8) *
+            k_usb_iso_protocol_overhead / (1000.f*1000.f);
+
+        bus_info.estimated_mbps =
+            mbps_per_camera_per_fps *
+            static_cast<float>(k_planner_frame_rates[0]) *
+            static_cast<float>(bus_info.camera_count);
+        bus_info.oversubscribed = bus_info.estimated_mbps > bus_info.budget_mbps;
+
+        bus_info.feasible_frame_rate = k_planner_frame_rates[k_planner_frame_rate_count - 1];
+        for (int rate_index = 0; rate_index < k_planner_frame_rate_count; ++rate_index)
+        {
+            const float rate_mbps =
+                mbps_per_camera_per_fps *
+                static_cast<float>(k_planner_frame_rates[rate_index]) *
+                static_cast<float>(bus_info.camera_count);
+
+            if (rate_mbps <= bus_info.budget_mbps)
+            {
+                bus_info.feasible_frame_rate = k_planner_frame_rates[rate_index];
+                break;
+            }
+        }
+
+        if (bus_info.oversubscribed)
+        {
+            SERVER_LOG_WARNING("TrackerManager::compute_usb_bandwidth_plan")
+                << bus_info.camera_count << " cameras on USB bus " << bus_info.bus_number
+                << " need ~" << bus_info.estimated_mbps << "Mbps of the ~" << bus_info.budget_mbps
+                << "Mbps isochronous budget at 640x480@" << k_planner_frame_rates[0]
+                << " - expect silent frame drops. Spread the cameras across host controllers"
+                << " or drop them to " << bus_info.feasible_frame_rate << "fps.";
+        }
+    }
 }
 
 ServerDeviceView *
@@ -2,11 +2,14 @@
 #define TRACKER_MANAGER_H
 
 //-- includes -----
+#include <cstdint>
 #include <memory>
+#include <vector>
 #include "DeviceTypeManager.h"
 #include "DeviceEnumerator.h"
 #include "DeviceInterface.h"
 #include "PSMoveConfig.h"
+#include "TrackerPoseEstimationWorkerPool.h"
 
 //-- typedefs -----
 
@@ -14,6 +17,23 @@ class ServerTrackerView;
 typedef std::shared_ptr<ServerTrackerView> ServerTrackerViewPtr;
 
 //-- definitions -----
+/// Estimated isochronous load of the cameras sharing one USB host controller,
+/// recomputed each time the tracker list changes. When a bus is oversubscribed
+/// the cameras on it silently drop frames, so the plan is surfaced through the
+/// tracker list response and a startup warning instead of looking like a
+/// vision bug.
+struct USBBusBandwidthInfo
+{
+    int bus_number;
+    int camera_count;
+    float estimated_mbps;
+    float budget_mbps;
+    bool oversubscribed;
+    // Highest standard frame rate (at 640x480) each camera on this bus could
+    // run at without oversubscribing the controller
+    int feasible_frame_rate;
+};
+
 struct TrackerProfile
 {
     float exposure;
@@ -43,6 +63,33 @@ public:
     virtual void ptree2config(const boost::property_tree::ptree &pt);
 
 	bool ignore_pose_from_one_tracker;
+	bool use_parallel_optical_tracking;
+	// Process each tracker every Nth service tick, phase-staggered by tracker
+	// id (1 = every tracker every tick). Lets rigs with many cameras trade
+	// per-camera update rate for a bounded per-tick projection cost.
+	int tracker_interleave_period;
+	// CPU core bitmasks the camera capture threads and the vision worker
+	// threads are pinned to (0 = let the OS schedule them). Useful when the
+	// service is given dedicated cores so other processes can't preempt the
+	// 60Hz vision deadline.
+	int capture_thread_affinity_mask;
+	int vision_thread_affinity_mask;
+	// Scheduling priority offsets for the same threads
+	// (-2..2, 0 = platform default)
+	int capture_thread_priority;
+	int vision_thread_priority;
+	// Page placement hints for the shared video frame regions (Linux only).
+	// Large pages cut TLB pressure on the per-frame copies; binding the pages
+	// to the NUMA node the vision threads run on keeps the 60Hz frame reads
+	// off the cross-socket interconnect on multi-socket machines
+	// (numa_node -1 = leave the kernel's default placement).
+	bool shared_memory_use_large_pages;
+	int shared_memory_numa_node;
+	// Upper bound on the number of convex hull points fed into the sphere
+	// undistortion and ellipse fit (0 = unlimited). Fit quality saturates
+	// around 30 well-spread points, so budgeting the contour cuts that
+	// stage's cost roughly proportionally on close-up blobs.
+	int max_contour_fit_points;
     long version;
     int optical_tracking_timeout;
 	int tracker_sleep_ms;
@@ -50,6 +97,45 @@ public:
 	bool exclude_opposed_cameras;
 	int min_valid_projection_area;
 	bool disable_roi;
+	// Number of synthetic VirtualTracker devices to enumerate in addition to
+	// any physical cameras (0 = disabled). Lets multi-camera scaling be
+	// load-tested on machines with no tracking hardware attached.
+	int virtual_tracker_count;
+	// Multi-instance tracker sharding. One service process tops out around
+	// four cameras, so larger rigs run several instances side by side: each
+	// instance only opens the cameras where
+	// (camera_index % tracker_shard_count) == tracker_shard_index and the
+	// instances trade optical observations through a small shared memory
+	// exchange (see TrackerShardExchange). Shard 0 is the primary - it folds
+	// the other shards' observations into its pose filters and is the
+	// instance clients connect to. A count of 1 disables sharding.
+	int tracker_shard_index;
+	int tracker_shard_count;
+	// Capture mode (PS3EyeTrackerConfig::eCaptureMode index) newly connected
+	// cameras start in. Cameras with a saved per-camera config keep their own.
+	int default_capture_mode;
+	// JPEG quality (1-100) and frame rate cap for the compressed video
+	// stream served to remote clients. The defaults keep a 640x480 stream
+	// around 2MB/s; raise them for fidelity at the cost of bandwidth and
+	// encoder CPU.
+	int compressed_video_quality;
+	int compressed_video_max_fps;
+	// When enabled, trackers periodically sample the HSV statistics of the
+	// blob they are tracking and nudge the color preset toward them, so
+	// segmentation stays tight as the venue lighting drifts over the day.
+	// The tuned center never moves more than max_drift from the calibrated
+	// preset, and the result is persisted via the tracker config at most
+	// once per save_interval seconds.
+	bool enable_color_auto_tuning;
+	float color_auto_tuning_rate;
+	float color_auto_tuning_max_drift;
+	float color_auto_tuning_save_interval;
+	// When enabled, a tracker runs a short exposure/gain optimization sweep
+	// the first time a tracked device claims a tracking color on it: the
+	// service steps through candidate settings while scoring blob
+	// signal-to-noise and pixel saturation via the threshold stage, then
+	// locks the best pair and persists it in the tracker's config.
+	bool enable_auto_exposure_calibration;
     TrackerProfile default_tracker_profile;
 	float global_forward_degrees;
 
@@ -64,9 +150,21 @@ public:
 class TrackerManager : public DeviceTypeManager
 {
 public:
+    /// Immutable generation-stamped copy of the tracker manager config,
+    /// published for lock-free readers. The service thread builds a fresh
+    /// snapshot after every config mutation and swaps the shared pointer
+    /// atomically (read-copy-update), so the vision loop and its worker
+    /// threads can read a coherent config without taking a mutex mid-frame.
+    struct ConfigSnapshot
+    {
+        uint64_t generation;
+        TrackerManagerConfig config;
+    };
+
     TrackerManager();
 
     bool startup() override;
+    void shutdown() override;
 
     void closeAllTrackers();
 
@@ -82,20 +180,77 @@ public:
     {
         cfg.default_tracker_profile = *profile;
         cfg.save();
+        publishConfigSnapshot();
     }
 
     inline const TrackerProfile *getDefaultTrackerProfile() const
     {
-        return &cfg.default_tracker_profile; 
+        return &cfg.default_tracker_profile;
     }
 
+    /// The live config. Service-thread use only (startup, request handling) -
+    /// per-frame and worker-thread readers go through getConfigSnapshot()
+    /// instead, since the request handler can mutate this object mid-frame.
     inline const TrackerManagerConfig& getConfig() const
     {
         return cfg;
     }
 
+    /// The current config snapshot. Hot paths fetch the pointer once per
+    /// frame and read every config value through it, so a concurrent
+    /// republish can never hand them a half-written config.
+    inline std::shared_ptr<const ConfigSnapshot> getConfigSnapshot() const
+    {
+        return std::atomic_load(&m_config_snapshot);
+    }
+
+    /// Copy the live config into a fresh generation-stamped snapshot and
+    /// atomically swap it in for the lock-free readers
+    void publishConfigSnapshot();
+
+    inline TrackerPoseEstimationWorkerPool &getPoseEstimationWorkerPool()
+    {
+        return m_pose_estimation_worker_pool;
+    }
+
+    /// Advance the interleave phase. Called once per service update tick.
+    void advanceUpdatePhase();
+
+    /// True if the given tracker is assigned to the current interleave slot.
+    /// Trackers outside their slot keep their previous pose estimates this tick.
+    bool getIsTrackerScheduledThisTick(int tracker_id) const;
+
+    /// Run the shared segmentation pre-pass on every tracker scheduled this
+    /// tick, before the controller and HMD views request their projections
+    void prepareSharedSegmentationPasses();
+
+    /// Frame-budget governor hook (driven from DeviceManager::update).
+    /// Level 0 = full quality, 1 = coarse ellipse fit contour budget,
+    /// 2 = coarse fit plus optical updates on alternate ticks only.
+    /// IMU filtering and state publishing are never degraded.
+    void setOpticalDegradationLevel(int level);
+    inline int getOpticalDegradationLevel() const { return m_optical_degradation_level; }
+
+    /// Contour point budget for the sphere ellipse fit, honoring the
+    /// governor's coarse mode (see TrackerManagerConfig::max_contour_fit_points)
+    int getEffectiveMaxContourFitPoints() const;
+
+    /// Per-USB-bus bandwidth estimates from the last enumeration pass
+    inline const std::vector<USBBusBandwidthInfo> &getUSBBusBandwidthInfo() const
+    {
+        return m_usb_bus_bandwidth;
+    }
+
+    /// The multi-instance observation exchange, or null when sharding is off
+    /// (see TrackerManagerConfig::tracker_shard_count)
+    inline class TrackerShardExchange *getShardExchange() const
+    {
+        return m_shard_exchange;
+    }
+
 protected:
     bool can_update_connected_devices() override;
+    bool can_open_enumerated_device(const DeviceEnumerator *enumerator) override;
     void mark_tracker_list_dirty();
 
     DeviceEnumerator *allocate_device_enumerator() override;
@@ -103,9 +258,27 @@ protected:
     ServerDeviceView *allocate_device_view(int device_id) override;
 	int getListUpdatedResponseType() override;
 
+    /// Walk the USB topology and estimate the isochronous load the connected
+    /// cameras put on each host controller, warning when oversubscribed
+    void compute_usb_bandwidth_plan();
+
+    /// The configured interleave period, widened to at least 2 when the
+    /// governor has optical tracking on alternate ticks
+    int getEffectiveInterleavePeriod() const;
+
 private:
     TrackerManagerConfig cfg;
+    // The published read-copy-update snapshot of cfg. Readers go through
+    // std::atomic_load; only publishConfigSnapshot() replaces it.
+    std::shared_ptr<const ConfigSnapshot> m_config_snapshot;
+    // Writer-side only - stamps each published snapshot
+    uint64_t m_config_generation;
+    TrackerPoseEstimationWorkerPool m_pose_estimation_worker_pool;
+    int m_update_phase;
+    int m_optical_degradation_level;
     bool m_tracker_list_dirty;
+    std::vector<USBBusBandwidthInfo> m_usb_bus_bandwidth;
+    class TrackerShardExchange *m_shard_exchange;
 };
 
 #endif // TRACKER_MANAGER_H
\ No newline at end of file
@@ -0,0 +1,160 @@
+//-- includes -----
+#include "TrackerPoseEstimationWorkerPool.h"
+#include "ServerLog.h"
+#include "ServerUtility.h"
+#include "ThreadCpuMonitor.h"
+
+//-- methods -----
+TrackerPoseEstimationWorkerPool::TrackerPoseEstimationWorkerPool()
+    : m_thread_affinity_mask(0)
+    , m_thread_priority_offset(0)
+    , m_jobs_in_flight(0)
+    , m_shutdown_requested(false)
+{
+}
+
+TrackerPoseEstimationWorkerPool::~TrackerPoseEstimationWorkerPool()
+{
+    shutdown();
+}
+
+bool
+TrackerPoseEstimationWorkerPool::startup(int thread_count, unsigned int affinity_mask, int priority_offset)
+{
+    assert(m_worker_threads.size() == 0);
+
+    m_shutdown_requested = false;
+    m_jobs_in_flight = 0;
+    m_thread_affinity_mask = affinity_mask;
+    m_thread_priority_offset = priority_offset;
+
+    for (int thread_index = 0; thread_index < thread_count; ++thread_index)
+    {
+        m_worker_threads.push_back(
+            std::thread(&TrackerPoseEstimationWorkerPool::workerThreadProc, this));
+    }
+
+    if (thread_count > 0)
+    {
+        SERVER_LOG_INFO("TrackerPoseEstimationWorkerPool::startup") <<
+            "Started " << thread_count << " optical pose estimation worker threads";
+    }
+
+    return true;
+}
+
+void
+TrackerPoseEstimationWorkerPool::shutdown()
+{
+    if (m_worker_threads.size() > 0)
+    {
+        // Make sure no batch is still in flight before tearing down the threads
+        waitForAllJobs();
+
+        {
+            std::lock_guard<std::mutex> lock(m_queue_mutex);
+            m_shutdown_requested = true;
+        }
+        m_worker_wake_signal.notify_all();
+
+        for (std::thread &worker_thread : m_worker_threads)
+        {
+            worker_thread.join();
+        }
+
+        m_worker_threads.clear();
+    }
+}
+
+void
+TrackerPoseEstimationWorkerPool::addJob(t_projection_job job)
+{
+    if (getIsRunning())
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_queue_mutex);
+            m_pending_jobs.push_back(std::move(job));
+            ++m_jobs_in_flight;
+        }
+        m_worker_wake_signal.notify_one();
+    }
+    else
+    {
+        // No worker threads - fall back to running the job on the service thread
+        job();
+    }
+}
+
+void
+TrackerPoseEstimationWorkerPool::waitForAllJobs()
+{
+    std::unique_lock<std::mutex> lock(m_queue_mutex);
+
+    m_batch_complete_signal.wait(
+        lock,
+        [this]
+        {
+            return m_jobs_in_flight == 0;
+        });
+}
+
+void
+TrackerPoseEstimationWorkerPool::workerThreadProc()
+{
+    ThreadCpuMonitor::registerCurrentThread("pose_worker");
+
+    // Apply the configured scheduling constraints before taking any jobs so
+    // the vision deadline isn't at the mercy of whatever else wakes up on
+    // the same core
+    if (m_thread_affinity_mask != 0 &&
+        !ServerUtility::set_current_thread_affinity_mask(m_thread_affinity_mask))
+    {
+        SERVER_LOG_WARNING("TrackerPoseEstimationWorkerPool::workerThreadProc") <<
+            "Failed to apply vision thread affinity mask " << m_thread_affinity_mask;
+    }
+    if (m_thread_priority_offset != 0 &&
+        !ServerUtility::set_current_thread_priority(m_thread_priority_offset))
+    {
+        SERVER_LOG_WARNING("TrackerPoseEstimationWorkerPool::workerThreadProc") <<
+            "Failed to apply vision thread priority offset " << m_thread_priority_offset;
+    }
+    ServerUtility::register_current_thread_multimedia_class("Games");
+
+    for (;;)
+    {
+        t_projection_job job;
+
+        {
+            std::unique_lock<std::mutex> lock(m_queue_mutex);
+
+            m_worker_wake_signal.wait(
+                lock,
+                [this]
+                {
+                    return m_shutdown_requested || m_pending_jobs.size() > 0;
+                });
+
+            if (m_shutdown_requested && m_pending_jobs.size() == 0)
+            {
+                break;
+            }
+
+            job = std::move(m_pending_jobs.back());
+            m_pending_jobs.pop_back();
+        }
+
+        job();
+
+        {
+            std::lock_guard<std::mutex> lock(m_queue_mutex);
+            --m_jobs_in_flight;
+
+            if (m_jobs_in_flight == 0)
+            {
+                m_batch_complete_signal.notify_all();
+            }
+        }
+    }
+
+    ThreadCpuMonitor::unregisterCurrentThread();
+}
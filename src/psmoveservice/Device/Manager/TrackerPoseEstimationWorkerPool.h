@@ -0,0 +1,55 @@
+#ifndef TRACKER_POSE_ESTIMATION_WORKER_POOL_H
+#define TRACKER_POSE_ESTIMATION_WORKER_POOL_H
+
+//-- includes -----
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//-- definitions -----
+/// A fixed pool of worker threads used to run per-tracker blob extraction and
+/// projection math concurrently while the service thread blocks on the batch.
+/// Jobs queued within one batch must touch disjoint tracker/controller state.
+class TrackerPoseEstimationWorkerPool
+{
+public:
+    typedef std::function<void()> t_projection_job;
+
+    TrackerPoseEstimationWorkerPool();
+    ~TrackerPoseEstimationWorkerPool();
+
+    /// Spin up the worker threads. A thread_count of 0 leaves the pool
+    /// stopped, in which case addJob() runs the job on the calling thread.
+    /// Workers pin themselves to the cores in affinity_mask and apply the
+    /// priority offset on startup (0 = leave scheduling to the OS).
+    bool startup(int thread_count, unsigned int affinity_mask, int priority_offset);
+    void shutdown();
+
+    inline bool getIsRunning() const
+    {
+        return m_worker_threads.size() > 0;
+    }
+
+    /// Queue a projection job for execution on the pool
+    void addJob(t_projection_job job);
+
+    /// Block the calling (service) thread until every queued job has run
+    void waitForAllJobs();
+
+private:
+    void workerThreadProc();
+
+    std::vector<std::thread> m_worker_threads;
+    std::vector<t_projection_job> m_pending_jobs;
+    unsigned int m_thread_affinity_mask;
+    int m_thread_priority_offset;
+    std::mutex m_queue_mutex;
+    std::condition_variable m_worker_wake_signal;
+    std::condition_variable m_batch_complete_signal;
+    int m_jobs_in_flight;
+    bool m_shutdown_requested;
+};
+
+#endif // TRACKER_POSE_ESTIMATION_WORKER_POOL_H
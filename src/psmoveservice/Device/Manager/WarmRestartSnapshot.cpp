@@ -0,0 +1,226 @@
+//-- includes -----
+#include "WarmRestartSnapshot.h"
+#include "PSMoveConfig.h"
+#include "ServerLog.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+
+//-- constants -----
+static const uint32_t k_warm_restart_magic = 0x52575350; // 'PSWR'
+static const uint32_t k_warm_restart_version = 1;
+
+// Snapshots older than this are ignored - the devices may well have moved
+static const uint64_t k_warm_restart_max_age_seconds = 60;
+
+//-- statics -----
+static std::vector<WarmRestartSnapshot::DeviceEntry> g_capture_entries;
+static std::vector<WarmRestartSnapshot::DeviceEntry> g_restored_entries;
+static bool g_bSnapshotLoaded = false;
+
+//-- private implementation -----
+static std::string get_snapshot_file_path()
+{
+    return PSMoveConfig::getConfigDirPath() + "/warm_restart_snapshot.bin";
+}
+
+static uint64_t get_wall_clock_seconds()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+static void write_string(std::ofstream &out, const std::string &value)
+{
+    const uint32_t length = static_cast<uint32_t>(value.length());
+
+    out.write(reinterpret_cast<const char *>(&length), sizeof(length));
+    out.write(value.data(), length);
+}
+
+static bool read_string(std::ifstream &in, std::string &out_value)
+{
+    uint32_t length = 0;
+
+    in.read(reinterpret_cast<char *>(&length), sizeof(length));
+    if (!in.good() || length > 4096)
+    {
+        return false;
+    }
+
+    out_value.resize(length);
+    if (length > 0)
+    {
+        in.read(&out_value[0], length);
+    }
+
+    return in.good() || length == 0;
+}
+
+//-- public implementation -----
+void WarmRestartSnapshot::beginCapture()
+{
+    g_capture_entries.clear();
+}
+
+void WarmRestartSnapshot::addDeviceEntry(const DeviceEntry &entry)
+{
+    g_capture_entries.push_back(entry);
+}
+
+void WarmRestartSnapshot::endCapture()
+{
+    std::ofstream out(
+        get_snapshot_file_path(),
+        std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+
+    if (!out.is_open())
+    {
+        return;
+    }
+
+    const uint64_t timestamp = get_wall_clock_seconds();
+    // The tracker entries are dumped raw, so record the struct sizes and
+    // refuse the snapshot if a rebuild ever changes the layout
+    const uint32_t tracker_entry_size = static_cast<uint32_t>(sizeof(TrackerEntry));
+    const uint32_t device_count = static_cast<uint32_t>(g_capture_entries.size());
+
+    out.write(reinterpret_cast<const char *>(&k_warm_restart_magic), sizeof(k_warm_restart_magic));
+    out.write(reinterpret_cast<const char *>(&k_warm_restart_version), sizeof(k_warm_restart_version));
+    out.write(reinterpret_cast<const char *>(&timestamp), sizeof(timestamp));
+    out.write(reinterpret_cast<const char *>(&tracker_entry_size), sizeof(tracker_entry_size));
+    out.write(reinterpret_cast<const char *>(&device_count), sizeof(device_count));
+
+    for (const DeviceEntry &entry : g_capture_entries)
+    {
+        const int32_t device_kind = entry.device_kind;
+        const uint32_t tracker_count = static_cast<uint32_t>(entry.tracker_entries.size());
+
+        out.write(reinterpret_cast<const char *>(&device_kind), sizeof(device_kind));
+        write_string(out, entry.device_path);
+        out.write(reinterpret_cast<const char *>(&tracker_count), sizeof(tracker_count));
+
+        if (tracker_count > 0)
+        {
+            out.write(
+                reinterpret_cast<const char *>(entry.tracker_entries.data()),
+                static_cast<std::streamsize>(tracker_count)*sizeof(TrackerEntry));
+        }
+    }
+
+    g_capture_entries.clear();
+}
+
+void WarmRestartSnapshot::loadAtStartup()
+{
+    const std::string snapshotPath = get_snapshot_file_path();
+
+    g_restored_entries.clear();
+    g_bSnapshotLoaded = false;
+
+    {
+        std::ifstream in(snapshotPath, std::ifstream::in | std::ifstream::binary);
+
+        if (!in.is_open())
+        {
+            return;
+        }
+
+        uint32_t magic = 0, version = 0, tracker_entry_size = 0, device_count = 0;
+        uint64_t timestamp = 0;
+
+        in.read(reinterpret_cast<char *>(&magic), sizeof(magic));
+        in.read(reinterpret_cast<char *>(&version), sizeof(version));
+        in.read(reinterpret_cast<char *>(&timestamp), sizeof(timestamp));
+        in.read(reinterpret_cast<char *>(&tracker_entry_size), sizeof(tracker_entry_size));
+        in.read(reinterpret_cast<char *>(&device_count), sizeof(device_count));
+
+        const uint64_t now = get_wall_clock_seconds();
+        const bool bHeaderValid =
+            in.good() &&
+            magic == k_warm_restart_magic &&
+            version == k_warm_restart_version &&
+            tracker_entry_size == sizeof(TrackerEntry) &&
+            now >= timestamp && (now - timestamp) <= k_warm_restart_max_age_seconds;
+
+        if (bHeaderValid)
+        {
+            bool bEntriesValid = true;
+
+            for (uint32_t entry_index = 0; bEntriesValid && entry_index < device_count; ++entry_index)
+            {
+                DeviceEntry entry;
+                int32_t device_kind = 0;
+                uint32_t tracker_count = 0;
+
+                in.read(reinterpret_cast<char *>(&device_kind), sizeof(device_kind));
+                bEntriesValid = in.good() && read_string(in, entry.device_path);
+
+                if (bEntriesValid)
+                {
+                    in.read(reinterpret_cast<char *>(&tracker_count), sizeof(tracker_count));
+                    bEntriesValid = in.good() && tracker_count <= 64;
+                }
+
+                if (bEntriesValid && tracker_count > 0)
+                {
+                    entry.tracker_entries.resize(tracker_count);
+                    in.read(
+                        reinterpret_cast<char *>(entry.tracker_entries.data()),
+                        static_cast<std::streamsize>(tracker_count)*sizeof(TrackerEntry));
+                    bEntriesValid = in.good();
+                }
+
+                if (bEntriesValid)
+                {
+                    entry.device_kind = device_kind;
+                    g_restored_entries.push_back(entry);
+                }
+            }
+
+            if (bEntriesValid)
+            {
+                g_bSnapshotLoaded = true;
+                SERVER_LOG_INFO("WarmRestartSnapshot::loadAtStartup") <<
+                    "Restored warm restart snapshot (" << g_restored_entries.size() <<
+                    " devices, " << (now - timestamp) << "s old)";
+            }
+            else
+            {
+                g_restored_entries.clear();
+            }
+        }
+    }
+
+    // The snapshot is one-shot: never let the same state restore twice
+    std::remove(snapshotPath.c_str());
+}
+
+bool WarmRestartSnapshot::getWasLoaded()
+{
+    return g_bSnapshotLoaded;
+}
+
+bool WarmRestartSnapshot::fetchDeviceEntry(
+    eDeviceKind device_kind,
+    const std::string &device_path,
+    DeviceEntry &out_entry)
+{
+    for (std::vector<DeviceEntry>::iterator iter = g_restored_entries.begin();
+         iter != g_restored_entries.end();
+         ++iter)
+    {
+        if (iter->device_kind == device_kind && iter->device_path == device_path)
+        {
+            out_entry = *iter;
+            g_restored_entries.erase(iter);
+
+            return true;
+        }
+    }
+
+    return false;
+}
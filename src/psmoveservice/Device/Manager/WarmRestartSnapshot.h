@@ -0,0 +1,67 @@
+#ifndef WARM_RESTART_SNAPSHOT_H
+#define WARM_RESTART_SNAPSHOT_H
+
+//-- includes -----
+#include "DeviceInterface.h"
+
+#include <string>
+#include <vector>
+
+//-- definitions -----
+/**
+Shutdown snapshot of per-device runtime tracking state.
+
+A clean shutdown captures the last optical pose estimate (projection,
+position, orientation, tracking flag) of every open controller and HMD,
+keyed by device path. A service restarting shortly afterwards finds the
+snapshot, restores those estimates when the same device reopens, and forces
+an immediate enumerator rescan - so the tracker ROI search resumes at the
+last known screen location instead of a full-frame re-acquisition scan.
+
+The snapshot is one-shot: it is deleted as soon as it is read, and ignored
+entirely when older than k_warm_restart_max_age_seconds, so stale state can
+never leak into a session where the devices have actually moved. Restored
+estimates that turn out to be wrong are discarded by the normal tracking
+loss handling within a frame or two.
+*/
+namespace WarmRestartSnapshot
+{
+    enum eDeviceKind
+    {
+        DeviceKind_Controller = 0,
+        DeviceKind_HMD = 1
+    };
+
+    /// Last optical state of one device as seen from one tracker
+    struct TrackerEntry
+    {
+        bool bCurrentlyTracking;
+        bool bOrientationValid;
+        CommonDevicePosition position_cm;
+        CommonDeviceQuaternion orientation;
+        CommonDeviceTrackingProjection projection;
+    };
+
+    struct DeviceEntry
+    {
+        int device_kind;
+        std::string device_path;
+        std::vector<TrackerEntry> tracker_entries;
+    };
+
+    //-- shutdown side -----
+    void beginCapture();
+    void addDeviceEntry(const DeviceEntry &entry);
+    /// Write the captured entries out to the snapshot file
+    void endCapture();
+
+    //-- startup side -----
+    /// Read (and delete) the snapshot file; a no-op when missing or stale
+    void loadAtStartup();
+    /// True when loadAtStartup found a fresh snapshot this run
+    bool getWasLoaded();
+    /// Fetch (and consume) the entry for the given device, if the snapshot had one
+    bool fetchDeviceEntry(eDeviceKind device_kind, const std::string &device_path, DeviceEntry &out_entry);
+};
+
+#endif // WARM_RESTART_SNAPSHOT_H
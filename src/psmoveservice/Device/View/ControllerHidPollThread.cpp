@@ -0,0 +1,434 @@
+//-- includes -----
+#include "ControllerHidPollThread.h"
+#include "DeviceDataReadySignal.h"
+#include "ServerLog.h"
+#include "ServerUtility.h"
+#include "ThreadCpuMonitor.h"
+
+#include "PSDualShock4Controller.h"
+#include "PSMoveController.h"
+#include "PSNaviController.h"
+
+#include <assert.h>
+#include <chrono>
+#include <new>
+
+//-- constants -----
+// Pause between hid_read drains until a report cadence has been learned.
+// Controller reports arrive at most every millisecond or so, so sleeping any
+// longer just adds latency.
+static const int k_poll_sleep_milliseconds= 1;
+
+// Exponential moving average weight applied to each new inter-report sample
+static const double k_report_interval_ema_alpha= 0.1;
+
+// Wake up this much before the expected report arrival so the drain happens
+// just after the report lands rather than just before
+static const double k_poll_wakeup_margin_micro= 250.0;
+
+// Sanity bounds on an inter-report sample. Anything outside these is a radio
+// hiccup or a burst of catch-up reports, not the steady device cadence.
+static const double k_min_report_interval_micro= 1000.0;    // DS4 at full rate is 1.25ms
+static const double k_max_report_interval_micro= 20000.0;   // PSMove over a bad link
+
+// Every concrete controller state has to fit in a queue slot
+static_assert(sizeof(PSMoveControllerState) <= ControllerHidPollThread::k_max_state_size, "PSMoveControllerState too large for the poll queue");
+static_assert(sizeof(PSNaviControllerState) <= ControllerHidPollThread::k_max_state_size, "PSNaviControllerState too large for the poll queue");
+static_assert(sizeof(PSDualShock4ControllerState) <= ControllerHidPollThread::k_max_state_size, "PSDualShock4ControllerState too large for the poll queue");
+
+//-- public implementation -----
+ControllerHidPollThread::ControllerHidPollThread(
+    IControllerInterface *controller,
+    int device_id)
+    : m_controller(controller)
+    , m_device_id(device_id)
+    , m_write_index(0)
+    , m_read_index(0)
+    , m_bLatestPoppedStateValid(false)
+    , m_last_queued_sequence_number(-1)
+    , m_bPollFailure(false)
+    , m_poll_no_data_count(0)
+    , m_desired_led_color(k_output_not_set)
+    , m_desired_rumble(k_output_not_set)
+    , m_last_applied_led_color(k_output_not_set)
+    , m_last_applied_rumble(k_output_not_set)
+    , m_bLastNewDataTimeValid(false)
+    , m_average_report_interval_micro(0.0)
+    , m_bReportIntervalValid(false)
+    , m_shutdown_requested(false)
+    , m_poll_thread_started(false)
+{
+}
+
+ControllerHidPollThread::~ControllerHidPollThread()
+{
+    shutdown();
+}
+
+bool ControllerHidPollThread::startup()
+{
+    if (!m_poll_thread_started)
+    {
+        m_write_index= 0;
+        m_read_index= 0;
+        m_bLatestPoppedStateValid= false;
+        m_last_queued_sequence_number= -1;
+        m_bPollFailure= false;
+        m_poll_no_data_count= 0;
+        m_desired_led_color= k_output_not_set;
+        m_desired_rumble= k_output_not_set;
+        m_last_applied_led_color= k_output_not_set;
+        m_last_applied_rumble= k_output_not_set;
+        m_bLastNewDataTimeValid= false;
+        m_average_report_interval_micro= 0.0;
+        m_bReportIntervalValid= false;
+
+        m_shutdown_requested= false;
+        m_poll_thread = std::thread(&ControllerHidPollThread::pollThreadFunc, this);
+        m_poll_thread_started= true;
+
+        SERVER_LOG_INFO("ControllerHidPollThread::startup") <<
+            "Started polling thread for controller id " << m_device_id;
+    }
+
+    return m_poll_thread_started;
+}
+
+void ControllerHidPollThread::shutdown()
+{
+    if (m_poll_thread_started)
+    {
+        m_shutdown_requested= true;
+        m_poll_thread.join();
+        m_poll_thread_started= false;
+
+        SERVER_LOG_INFO("ControllerHidPollThread::shutdown") <<
+            "Stopped polling thread for controller id " << m_device_id;
+    }
+}
+
+int ControllerHidPollThread::getQueuedStateCount() const
+{
+    const std::uint32_t write_index= m_write_index.load(std::memory_order_acquire);
+    const std::uint32_t read_index= m_read_index.load(std::memory_order_relaxed);
+
+    return static_cast<int>(write_index - read_index);
+}
+
+bool ControllerHidPollThread::popQueuedState()
+{
+    const std::uint32_t read_index= m_read_index.load(std::memory_order_relaxed);
+
+    if (read_index == m_write_index.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+
+    m_latest_popped_state= m_state_queue[read_index % k_max_queued_states];
+    m_bLatestPoppedStateValid= true;
+
+    m_read_index.store(read_index + 1, std::memory_order_release);
+
+    return true;
+}
+
+const CommonControllerState *ControllerHidPollThread::getLatestPoppedState() const
+{
+    return m_bLatestPoppedStateValid ? m_latest_popped_state.getState() : nullptr;
+}
+
+void ControllerHidPollThread::setDesiredLEDColor(
+    unsigned char r, unsigned char g, unsigned char b)
+{
+    const std::uint32_t led_color=
+        (static_cast<std::uint32_t>(r) << 16) |
+        (static_cast<std::uint32_t>(g) << 8) |
+        static_cast<std::uint32_t>(b);
+
+    m_desired_led_color.store(led_color, std::memory_order_release);
+}
+
+void ControllerHidPollThread::setDesiredRumble(
+    CommonControllerState::RumbleChannel channel,
+    unsigned char rumble_byte)
+{
+    // Single producer, so a read-modify-write of the untouched channel is safe
+    const std::uint32_t old_rumble= m_desired_rumble.load(std::memory_order_relaxed);
+    std::uint32_t left= (old_rumble != k_output_not_set) ? (old_rumble & 0x00FF) : 0;
+    std::uint32_t right= (old_rumble != k_output_not_set) ? ((old_rumble >> 8) & 0x00FF) : 0;
+
+    if (channel == CommonControllerState::RumbleChannel::ChannelLeft ||
+        channel == CommonControllerState::RumbleChannel::ChannelAll)
+    {
+        left= rumble_byte;
+    }
+
+    if (channel == CommonControllerState::RumbleChannel::ChannelRight ||
+        channel == CommonControllerState::RumbleChannel::ChannelAll)
+    {
+        right= rumble_byte;
+    }
+
+    m_desired_rumble.store(left | (right << 8), std::memory_order_release);
+}
+
+//-- protected methods -----
+void ControllerHidPollThread::pollThreadFunc()
+{
+    char thread_name[32];
+    ServerUtility::format_string(thread_name, sizeof(thread_name), "hid_poll_%d", m_device_id);
+    ThreadCpuMonitor::registerCurrentThread(thread_name);
+
+    // HID reports arrive on a ~1ms cadence; the Pro Audio MMCSS class gets
+    // this thread the same low-latency treatment as an audio render thread
+    ServerUtility::register_current_thread_multimedia_class("Pro Audio");
+
+    // On Linux the hidapi device path is the /dev/hidrawN node itself, so a
+    // second handle on it can sit in epoll and wake this thread the moment a
+    // report lands. Elsewhere this fails and the timed drain schedule is used.
+    m_hidraw_waiter.openDevicePath(m_controller->getUSBDevicePath().c_str());
+
+    while (!m_shutdown_requested)
+    {
+        switch (m_controller->poll())
+        {
+        case IDeviceInterface::_PollResultSuccessNoData:
+            {
+                m_poll_no_data_count.fetch_add(1, std::memory_order_release);
+            }
+            break;
+
+        case IDeviceInterface::_PollResultSuccessNewData:
+            {
+                m_poll_no_data_count.store(0, std::memory_order_release);
+                updateReportIntervalEstimate();
+                enqueueNewStates();
+
+                // Wake the service thread so the new states get filtered now
+                // rather than at the next tick boundary
+                DeviceDataReadySignal::notifyDataReady();
+            }
+            break;
+
+        case IDeviceInterface::_PollResultFailure:
+            {
+                // Flag the failure for the service thread and stop touching
+                // the dead device handle. The service thread closes the device.
+                m_bPollFailure.store(true, std::memory_order_release);
+                m_hidraw_waiter.close();
+                ThreadCpuMonitor::unregisterCurrentThread();
+                return;
+            }
+            break;
+        }
+
+        // Apply any LED/rumble state the service thread asked for since the
+        // last lap, so a stalled hid_write only ever blocks this thread
+        flushDesiredOutputState();
+
+        sleepUntilNextExpectedReport();
+    }
+
+    m_hidraw_waiter.close();
+    ThreadCpuMonitor::unregisterCurrentThread();
+}
+
+void ControllerHidPollThread::updateReportIntervalEstimate()
+{
+    const std::chrono::time_point<std::chrono::high_resolution_clock> now=
+        std::chrono::high_resolution_clock::now();
+
+    if (m_bLastNewDataTimeValid)
+    {
+        const std::chrono::duration<double, std::micro> interval= now - m_last_new_data_time;
+        const double interval_micro= interval.count();
+
+        // Only fold in plausible steady-state samples
+        if (interval_micro >= k_min_report_interval_micro &&
+            interval_micro <= k_max_report_interval_micro)
+        {
+            if (m_bReportIntervalValid)
+            {
+                m_average_report_interval_micro=
+                    m_average_report_interval_micro*(1.0 - k_report_interval_ema_alpha)
+                    + interval_micro*k_report_interval_ema_alpha;
+            }
+            else
+            {
+                m_average_report_interval_micro= interval_micro;
+                m_bReportIntervalValid= true;
+            }
+        }
+    }
+
+    m_last_new_data_time= now;
+    m_bLastNewDataTimeValid= true;
+}
+
+void ControllerHidPollThread::sleepUntilNextExpectedReport()
+{
+    // Event-driven path: block in epoll until the device actually has a
+    // report, with the learned cadence only capping the wait so a dead link
+    // still gets re-polled (and the shutdown flag re-checked) promptly
+    if (m_hidraw_waiter.getIsOpen())
+    {
+        const double timeout_micro=
+            m_bReportIntervalValid
+            ? m_average_report_interval_micro*2.0
+            : k_max_report_interval_micro;
+
+        m_hidraw_waiter.waitForInputReport(static_cast<int>(timeout_micro/1000.0) + 1);
+        return;
+    }
+
+    double sleep_micro= static_cast<double>(k_poll_sleep_milliseconds)*1000.0;
+
+    if (m_bReportIntervalValid)
+    {
+        const std::chrono::time_point<std::chrono::high_resolution_clock> now=
+            std::chrono::high_resolution_clock::now();
+        const std::chrono::duration<double, std::micro> elapsed= now - m_last_new_data_time;
+
+        // Aim the next drain just ahead of the expected report arrival
+        sleep_micro= m_average_report_interval_micro - k_poll_wakeup_margin_micro - elapsed.count();
+
+        // Report is due (or overdue) - re-poll at the margin interval rather
+        // than spinning while we wait for it to land
+        if (sleep_micro < k_poll_wakeup_margin_micro)
+        {
+            sleep_micro= k_poll_wakeup_margin_micro;
+        }
+    }
+
+    std::this_thread::sleep_for(
+        std::chrono::microseconds(static_cast<long long>(sleep_micro)));
+}
+
+void ControllerHidPollThread::flushDesiredOutputState()
+{
+    const std::uint32_t desired_led_color= m_desired_led_color.load(std::memory_order_acquire);
+    const std::uint32_t desired_rumble= m_desired_rumble.load(std::memory_order_acquire);
+    const bool bWriteLEDColor= (desired_led_color != k_output_not_set && desired_led_color != m_last_applied_led_color);
+    const bool bWriteRumble= (desired_rumble != k_output_not_set && desired_rumble != m_last_applied_rumble);
+
+    if (!bWriteLEDColor && !bWriteRumble)
+    {
+        return;
+    }
+
+    const unsigned char r= static_cast<unsigned char>((desired_led_color >> 16) & 0x00FF);
+    const unsigned char g= static_cast<unsigned char>((desired_led_color >> 8) & 0x00FF);
+    const unsigned char b= static_cast<unsigned char>(desired_led_color & 0x00FF);
+    const unsigned char rumble_left= static_cast<unsigned char>(desired_rumble & 0x00FF);
+    const unsigned char rumble_right= static_cast<unsigned char>((desired_rumble >> 8) & 0x00FF);
+
+    switch (m_controller->getDeviceType())
+    {
+    case CommonDeviceState::PSMove:
+        {
+            PSMoveController *controller= static_cast<PSMoveController *>(m_controller);
+
+            if (bWriteLEDColor)
+            {
+                controller->setLED(r, g, b);
+            }
+
+            if (bWriteRumble)
+            {
+                controller->setRumbleIntensity(rumble_left);
+            }
+        } break;
+    case CommonDeviceState::PSNavi:
+        {
+            // No LED or rumble on the navi
+        } break;
+    case CommonDeviceState::PSDualShock4:
+        {
+            PSDualShock4Controller *controller= static_cast<PSDualShock4Controller *>(m_controller);
+
+            if (bWriteLEDColor)
+            {
+                controller->setLED(r, g, b);
+            }
+
+            if (bWriteRumble)
+            {
+                controller->setLeftRumbleIntensity(rumble_left);
+                controller->setRightRumbleIntensity(rumble_right);
+            }
+        } break;
+    default:
+        assert(0 && "Unhandled controller type");
+    }
+
+    if (bWriteLEDColor)
+    {
+        m_last_applied_led_color= desired_led_color;
+    }
+
+    if (bWriteRumble)
+    {
+        m_last_applied_rumble= desired_rumble;
+    }
+}
+
+void ControllerHidPollThread::enqueueNewStates()
+{
+    // Look backward in time to find the first controller state with a poll
+    // sequence number newer than the last state we copied into the queue
+    int firstLookBackIndex = -1;
+    int testLookBack = 0;
+    const CommonControllerState *state= static_cast<const CommonControllerState *>(m_controller->getState(testLookBack));
+    while (state != nullptr && state->PollSequenceNumber > m_last_queued_sequence_number)
+    {
+        firstLookBackIndex= testLookBack;
+        testLookBack++;
+        state= static_cast<const CommonControllerState *>(m_controller->getState(testLookBack));
+    }
+
+    // Copy the new states into the queue oldest first
+    for (int lookBackIndex= firstLookBackIndex; lookBackIndex >= 0; --lookBackIndex)
+    {
+        const CommonControllerState *controllerState=
+            static_cast<const CommonControllerState *>(m_controller->getState(lookBackIndex));
+
+        const std::uint32_t write_index= m_write_index.load(std::memory_order_relaxed);
+
+        if (write_index - m_read_index.load(std::memory_order_acquire) >= k_max_queued_states)
+        {
+            // The service thread fell behind by several ticks worth of states.
+            // Drop the remaining states rather than stomping unconsumed entries.
+            SERVER_LOG_WARNING("ControllerHidPollThread::enqueueNewStates") <<
+                "State queue for controller id " << m_device_id << " is full. Dropping new states.";
+            break;
+        }
+
+        QueuedStateEntry &entry= m_state_queue[write_index % k_max_queued_states];
+
+        // Copy-construct the concrete state type into the queue slot.
+        // All controller states are trivially destructible so the slot
+        // can simply be reused on the next lap around the ring.
+        switch (controllerState->DeviceType)
+        {
+        case CommonControllerState::PSMove:
+            new (entry.state_buffer) PSMoveControllerState(
+                *static_cast<const PSMoveControllerState *>(controllerState));
+            break;
+        case CommonControllerState::PSNavi:
+            new (entry.state_buffer) PSNaviControllerState(
+                *static_cast<const PSNaviControllerState *>(controllerState));
+            break;
+        case CommonControllerState::PSDualShock4:
+            new (entry.state_buffer) PSDualShock4ControllerState(
+                *static_cast<const PSDualShock4ControllerState *>(controllerState));
+            break;
+        default:
+            assert(0 && "Unhandled controller type");
+            continue;
+        }
+
+        m_write_index.store(write_index + 1, std::memory_order_release);
+
+        m_last_queued_sequence_number= controllerState->PollSequenceNumber;
+    }
+}
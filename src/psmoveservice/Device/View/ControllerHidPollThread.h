@@ -0,0 +1,144 @@
+#ifndef CONTROLLER_HID_POLL_THREAD_H
+#define CONTROLLER_HID_POLL_THREAD_H
+
+//-- includes -----
+#include "DeviceInterface.h"
+#include "HidrawInputWaiter.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+//-- definitions -----
+/// Owns a polling thread that continuously drains hid_read for one open
+/// controller into a lock-free single-producer/single-consumer queue of
+/// controller states. The service thread consumes the queued states in
+/// ServerControllerView::updateStateAndPredict, so one slow Bluetooth radio
+/// no longer stalls the polling of every other device.
+class ControllerHidPollThread
+{
+public:
+    /// Capacity of the state queue (must be a power of two).
+    /// At controller report rates this is several service ticks of slack.
+    static const int k_max_queued_states= 64;
+
+    /// Big enough to hold any concrete CommonControllerState subclass
+    /// (enforced with static_asserts in the translation unit)
+    static const int k_max_state_size= 1024;
+
+    ControllerHidPollThread(IControllerInterface *controller, int device_id);
+    ~ControllerHidPollThread();
+
+    /// Spin up the polling thread. Returns false if the thread failed to start.
+    bool startup();
+
+    /// Stop and join the polling thread. Safe to call when not running.
+    void shutdown();
+
+    inline bool getIsRunning() const
+    {
+        return m_poll_thread_started;
+    }
+
+    // -- Poll status (readable from the service thread) --
+    /// True if the polling thread hit a read failure and stopped polling
+    inline bool getHasPollFailure() const
+    {
+        return m_bPollFailure.load(std::memory_order_acquire);
+    }
+
+    /// Number of consecutive polls that returned no data
+    inline int getPollNoDataCount() const
+    {
+        return m_poll_no_data_count.load(std::memory_order_acquire);
+    }
+
+    // -- State queue (service thread side only) --
+    /// Number of polled states waiting to be consumed
+    int getQueuedStateCount() const;
+
+    /// Copy the oldest queued state into the latest-popped slot and advance the
+    /// read index. Returns false if the queue was empty.
+    bool popQueuedState();
+
+    /// The state most recently removed from the queue with popQueuedState().
+    /// Stays valid until the next pop. Returns nullptr if nothing was popped yet.
+    const CommonControllerState *getLatestPoppedState() const;
+
+    // -- Desired output state (service thread side only) --
+    /// Store the LED color to apply on the polling thread. Newest value wins;
+    /// the service thread never blocks on the hid_write.
+    void setDesiredLEDColor(unsigned char r, unsigned char g, unsigned char b);
+
+    /// Store the rumble intensity to apply on the polling thread for the given
+    /// channel. Newest value per channel wins.
+    void setDesiredRumble(CommonControllerState::RumbleChannel channel, unsigned char rumble_byte);
+
+protected:
+    void pollThreadFunc();
+    void enqueueNewStates();
+    void flushDesiredOutputState();
+    void updateReportIntervalEstimate();
+    void sleepUntilNextExpectedReport();
+
+private:
+    /// One queue slot. The state is stored by value in a raw byte buffer so the
+    /// queue can hold any concrete controller state type without allocation.
+    struct QueuedStateEntry
+    {
+        unsigned char state_buffer[k_max_state_size];
+
+        inline const CommonControllerState *getState() const
+        { return reinterpret_cast<const CommonControllerState *>(state_buffer); }
+    };
+
+    IControllerInterface *m_controller;
+    int m_device_id;
+
+    // SPSC ring buffer. The polling thread only writes m_write_index, the
+    // service thread only writes m_read_index; both indices increment forever
+    // and get masked into the entry array.
+    QueuedStateEntry m_state_queue[k_max_queued_states];
+    std::atomic<std::uint32_t> m_write_index;
+    std::atomic<std::uint32_t> m_read_index;
+
+    // Most recently popped state, owned by the service thread
+    QueuedStateEntry m_latest_popped_state;
+    bool m_bLatestPoppedStateValid;
+
+    // Highest poll sequence number copied into the queue so far.
+    // Only touched by the polling thread.
+    int m_last_queued_sequence_number;
+
+    std::atomic_bool m_bPollFailure;
+    std::atomic_int m_poll_no_data_count;
+
+    // One-slot coalescing output state. The service thread stores the newest
+    // desired value; the polling thread applies it when it differs from the
+    // last value written to the device. k_output_not_set means "never set".
+    static const std::uint32_t k_output_not_set= 0xFFFFFFFF;
+    std::atomic<std::uint32_t> m_desired_led_color;     // 0x00RRGGBB
+    std::atomic<std::uint32_t> m_desired_rumble;        // left | (right << 8)
+    std::uint32_t m_last_applied_led_color;             // polling thread only
+    std::uint32_t m_last_applied_rumble;                // polling thread only
+
+    // Learned device report cadence, polling thread only. The DS4 delivers at
+    // ~250Hz while a PSMove over Bluetooth can be closer to 60Hz, so the drain
+    // schedule adapts to the measured inter-report arrival time instead of
+    // using one fixed sleep for every controller type.
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_last_new_data_time;
+    bool m_bLastNewDataTimeValid;
+    double m_average_report_interval_micro;
+    bool m_bReportIntervalValid;
+
+    // Event-driven wakeup on the controller's hidraw node (Linux only).
+    // When open, the polling thread blocks in epoll until a report lands
+    // instead of sleeping on the learned cadence. Polling thread only.
+    HidrawInputWaiter m_hidraw_waiter;
+
+    std::thread m_poll_thread;
+    std::atomic_bool m_shutdown_requested;
+    bool m_poll_thread_started;
+};
+
+#endif // CONTROLLER_HID_POLL_THREAD_H
@@ -0,0 +1,84 @@
+//-- includes -----
+#include "LatencyHistogram.h"
+
+//-- public implementation -----
+LatencyHistogram::LatencyHistogram()
+{
+    clear();
+}
+
+void LatencyHistogram::clear()
+{
+    for (int bucket_index= 0; bucket_index < k_bucket_count; ++bucket_index)
+    {
+        m_bucket_counts[bucket_index].store(0, std::memory_order_relaxed);
+    }
+
+    m_sample_count.store(0, std::memory_order_relaxed);
+    m_total_micro.store(0, std::memory_order_relaxed);
+    m_max_micro.store(0, std::memory_order_relaxed);
+}
+
+void LatencyHistogram::addSampleMicroseconds(const double sample_micro)
+{
+    if (sample_micro < 0.0)
+    {
+        return;
+    }
+
+    const std::uint64_t sample= static_cast<std::uint64_t>(sample_micro);
+
+    // Bucket index is the position of the highest set bit, clamped to the
+    // last bucket for samples beyond the covered range
+    int bucket_index= 0;
+    {
+        std::uint64_t remaining= sample;
+
+        while (remaining > 1 && bucket_index < k_bucket_count - 1)
+        {
+            remaining>>= 1;
+            ++bucket_index;
+        }
+    }
+
+    m_bucket_counts[bucket_index].fetch_add(1, std::memory_order_relaxed);
+    m_sample_count.fetch_add(1, std::memory_order_relaxed);
+    m_total_micro.fetch_add(sample, std::memory_order_relaxed);
+
+    // Racy compare-and-bump of the max; losing a race just means another
+    // thread recorded an equal-or-larger sample first
+    std::uint64_t observed_max= m_max_micro.load(std::memory_order_relaxed);
+    while (sample > observed_max &&
+           !m_max_micro.compare_exchange_weak(observed_max, sample, std::memory_order_relaxed))
+    {
+    }
+}
+
+std::uint64_t LatencyHistogram::getBucketSampleCount(const int bucket_index) const
+{
+    return m_bucket_counts[bucket_index].load(std::memory_order_relaxed);
+}
+
+std::uint64_t LatencyHistogram::getTotalSampleCount() const
+{
+    return m_sample_count.load(std::memory_order_relaxed);
+}
+
+double LatencyHistogram::getMeanMicroseconds() const
+{
+    const std::uint64_t sample_count= m_sample_count.load(std::memory_order_relaxed);
+
+    return (sample_count > 0)
+        ? static_cast<double>(m_total_micro.load(std::memory_order_relaxed)) / static_cast<double>(sample_count)
+        : 0.0;
+}
+
+double LatencyHistogram::getMaxMicroseconds() const
+{
+    return static_cast<double>(m_max_micro.load(std::memory_order_relaxed));
+}
+
+double LatencyHistogram::getBucketMaxMicroseconds(const int bucket_index)
+{
+    return static_cast<double>(1ull << (bucket_index + 1));
+}
@@ -0,0 +1,45 @@
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+//-- includes -----
+#include <atomic>
+#include <cstdint>
+
+//-- definitions -----
+/// Lock-free latency histogram with power-of-two microsecond buckets.
+/// Bucket n counts samples in [2^n, 2^(n+1)) microseconds, with the first and
+/// last buckets absorbing anything below/above the covered range. Writers only
+/// do relaxed atomic increments so samples can be recorded from the polling
+/// and service threads while the request handler reads a (slightly stale but
+/// tear-free) snapshot for reporting.
+class LatencyHistogram
+{
+public:
+    /// Bucket count covers 1us up to ~8.4 seconds
+    static const int k_bucket_count= 24;
+
+    LatencyHistogram();
+
+    /// Zero out all buckets and summary counters
+    void clear();
+
+    /// Record one latency sample. Negative samples (clock skew) are dropped.
+    void addSampleMicroseconds(const double sample_micro);
+
+    // -- reader side --
+    std::uint64_t getBucketSampleCount(const int bucket_index) const;
+    std::uint64_t getTotalSampleCount() const;
+    double getMeanMicroseconds() const;
+    double getMaxMicroseconds() const;
+
+    /// Upper bound (exclusive) of the given bucket in microseconds
+    static double getBucketMaxMicroseconds(const int bucket_index);
+
+private:
+    std::atomic<std::uint64_t> m_bucket_counts[k_bucket_count];
+    std::atomic<std::uint64_t> m_sample_count;
+    std::atomic<std::uint64_t> m_total_micro;
+    std::atomic<std::uint64_t> m_max_micro;
+};
+
+#endif // LATENCY_HISTOGRAM_H
@@ -2,7 +2,10 @@
 #include "ServerControllerView.h"
 
 #include "BluetoothRequests.h"
+#include "ControllerDeviceEnumerator.h"
+#include "ControllerHidPollThread.h"
 #include "ControllerManager.h"
+#include "ControllerStreamPacket.h"
 #include "DeviceManager.h"
 #include "MathAlignment.h"
 #include "ServerLog.h"
@@ -13,22 +16,141 @@
 #include "PSDualShock4Controller.h"
 #include "PSMoveController.h"
 #include "PSNaviController.h"
+#include "VirtualController.h"
 #include "PSMoveProtocolInterface.h"
 #include "PSMoveProtocol.pb.h"
+#include "ServerTracer.h"
 #include "ServerUtility.h"
+#include "ServiceClock.h"
 #include "ServerTrackerView.h"
+#include "SharedControllerState.h"
+#include "TrackerShardExchange.h"
+#include "WarmRestartSnapshot.h"
+
+#include <boost/interprocess/shared_memory_object.hpp>
+#include <boost/interprocess/mapped_region.hpp>
 
 #include <glm/glm.hpp>
 
+#include <algorithm>
+#include <cstring>
+
 //-- constants -----
 static const float k_min_time_delta_seconds = 1 / 120.f;
 static const float k_max_time_delta_seconds = 1 / 30.f;
 
+// EMA blend weight for the rolling tracking quality metrics
+// (roughly a 20 optical-update smoothing window)
+static const float k_tracking_quality_ema_alpha = 0.05f;
+// Normalization scales for the composite quality score: a raw metric
+// sitting at its scale value halves the score contribution
+static const float k_quality_fit_error_scale = 0.05f;
+static const float k_quality_disagreement_scale_cm = 2.f;
+static const float k_quality_innovation_scale_cm = 5.f;
+
 //-- macros -----
 #define SET_BUTTON_BIT(bitmask, bit_index, button_state) \
     bitmask|= (button_state == CommonControllerState::Button_DOWN || button_state == CommonControllerState::Button_PRESSED) ? (0x1 << (bit_index)) : 0x0;
 
 //-- private methods -----
+/// Owns the shared memory block that same-host clients poll for stream packets
+class SharedControllerStateWriteAccessor
+{
+public:
+    SharedControllerStateWriteAccessor()
+        : m_shared_memory_object(nullptr)
+        , m_region(nullptr)
+    {}
+
+    ~SharedControllerStateWriteAccessor()
+    {
+        dispose();
+    }
+
+    bool initialize(const char *shared_memory_name)
+    {
+        bool bSuccess = false;
+
+        try
+        {
+            SERVER_LOG_INFO("SharedMemory::initialize()") << "Allocating shared memory: " << shared_memory_name;
+
+            // Remember the name of the shared memory
+            m_shared_memory_name = shared_memory_name;
+
+            // Make sure the shared memory block has been removed first
+            boost::interprocess::shared_memory_object::remove(shared_memory_name);
+
+            // Allow non admin-level processed to access the shared memory
+            boost::interprocess::permissions permissions;
+            permissions.set_unrestricted();
+
+            // Create the shared memory object
+            m_shared_memory_object =
+                new boost::interprocess::shared_memory_object(
+                    boost::interprocess::create_only,
+                    shared_memory_name,
+                    boost::interprocess::read_write,
+                    permissions);
+
+            // Resize the shared memory
+            m_shared_memory_object->truncate(SharedControllerStateBuffer::computeTotalSize());
+
+            // Map all of the shared memory for read/write access
+            m_region = new boost::interprocess::mapped_region(*m_shared_memory_object, boost::interprocess::read_write);
+
+            // Initialize the ring buffer (call constructor using placement new)
+            new (getStateBuffer()) SharedControllerStateBuffer();
+
+            bSuccess = true;
+        }
+        catch (boost::interprocess::interprocess_exception* e)
+        {
+            dispose();
+            SERVER_LOG_ERROR("SharedMemory::initialize()") << "Failed to allocated shared memory: " << m_shared_memory_name
+                << ", reason: " << e->what();
+        }
+
+        return bSuccess;
+    }
+
+    void dispose()
+    {
+        if (m_region != nullptr)
+        {
+            delete m_region;
+            m_region = nullptr;
+        }
+
+        if (m_shared_memory_object != nullptr)
+        {
+            delete m_shared_memory_object;
+            m_shared_memory_object = nullptr;
+        }
+
+        if (!boost::interprocess::shared_memory_object::remove(m_shared_memory_name.c_str()))
+        {
+            SERVER_LOG_ERROR("SharedMemory::dispose") << "Failed to free shared memory: " << m_shared_memory_name;
+        }
+    }
+
+    void writeStreamPacket(const ControllerStreamPacket &packet)
+    {
+        getStateBuffer()->writePacket(packet);
+    }
+
+protected:
+    SharedControllerStateBuffer *getStateBuffer()
+    {
+        return reinterpret_cast<SharedControllerStateBuffer *>(m_region->get_address());
+    }
+
+private:
+    std::string m_shared_memory_name;
+    boost::interprocess::shared_memory_object *m_shared_memory_object;
+    boost::interprocess::mapped_region *m_region;
+};
+
 static IPoseFilter *pose_filter_factory(
 	const CommonDeviceState::eDeviceType deviceType,
 	const std::string &position_filter_type,
@@ -41,9 +163,10 @@ static void init_filters_for_psmove(
     IPoseFilter **out_pose_filter);
 static void update_filters_for_psmove(
     const PSMoveController *psmoveController, const PSMoveControllerState *psmoveState, const float delta_time,
-    const ControllerOpticalPoseEstimation *positionEstimation, 
+    const ControllerOpticalPoseEstimation *positionEstimation,
 	const PoseFilterSpace *poseFilterSpace,
-    IPoseFilter *pose_filter);
+    IPoseFilter *pose_filter,
+	PoseSensorPacketQueue &imu_packet_queue, const bool bIsFinalStateThisTick);
 
 static void init_filters_for_psdualshock4(
     const PSDualShock4Controller *psdualshock4Controller, 
@@ -53,14 +176,15 @@ static void update_filters_for_psdualshock4(
     const PSDualShock4Controller *psdualshock4Controller, const PSDualShock4ControllerState *psmoveState, const float delta_time,
     const ControllerOpticalPoseEstimation *positionEstimation,
 	const PoseFilterSpace *poseFilterSpace,
-    IPoseFilter *pose_filter);
+    IPoseFilter *pose_filter,
+	PoseSensorPacketQueue &imu_packet_queue, const bool bIsFinalStateThisTick);
 
-static void generate_psmove_data_frame_for_stream(
-    const ServerControllerView *controller_view, const ControllerStreamInfo *stream_info, PSMoveProtocol::DeviceOutputDataFrame *data_frame);
-static void generate_psnavi_data_frame_for_stream(
-    const ServerControllerView *controller_view, const ControllerStreamInfo *stream_info, PSMoveProtocol::DeviceOutputDataFrame *data_frame);
-static void generate_psdualshock4_data_frame_for_stream(
-    const ServerControllerView *controller_view, const ControllerStreamInfo *stream_info, PSMoveProtocol::DeviceOutputDataFrame *data_frame);
+static void generate_psmove_stream_packet(
+    const ServerControllerView *controller_view, const ControllerStreamInfo *stream_info, ControllerStreamPacket *packet);
+static void generate_psnavi_stream_packet(
+    const ServerControllerView *controller_view, const ControllerStreamInfo *stream_info, ControllerStreamPacket *packet);
+static void generate_psdualshock4_stream_packet(
+    const ServerControllerView *controller_view, const ControllerStreamInfo *stream_info, ControllerStreamPacket *packet);
 
 static void computeSpherePoseForControllerFromSingleTracker(
 	const ServerControllerView *controllerView,
@@ -86,7 +210,14 @@ static void computeLightBarPoseForControllerFromMultipleTrackers(
 	const int projections_found,
 	ControllerOpticalPoseEstimation *tracker_pose_estimations,
 	ControllerOpticalPoseEstimation *multicam_pose_estimation);
-
+static void updateCachedWorldRayForPoseEstimate(
+	const ServerTrackerViewPtr tracker,
+	ControllerOpticalPoseEstimation &tracker_pose_estimation);
+static void mergeRemoteShardObservationsForController(
+	const TrackerShardExchange *shard_exchange,
+	const int controller_id,
+	const std::chrono::time_point<std::chrono::high_resolution_clock> &now,
+	ControllerOpticalPoseEstimation *multicam_pose_estimation);
 //-- public implementation -----
 ServerControllerView::ServerControllerView(const int device_id)
     : ServerDeviceView(device_id)
@@ -95,20 +226,51 @@ ServerControllerView::ServerControllerView(const int device_id)
 	, m_roi_disable_count(0)
     , m_LED_override_active(false)
     , m_device(nullptr)
+    , m_tracking_shape_bounding_radius_cm(0.f)
+    , m_last_button_event_bitmask(0)
+    , m_pending_pressed_buttons(0)
+    , m_pending_released_buttons(0)
+    , m_has_pending_button_event(false)
+    , m_hid_poll_thread(nullptr)
     , m_tracker_pose_estimations(nullptr)
     , m_multicam_pose_estimation(nullptr)
     , m_pose_filter(nullptr)
     , m_pose_filter_space(nullptr)
+    , m_pose_filter_history(nullptr)
+    , m_pose_filter_history_seconds(0.f)
     , m_lastPollSeqNumProcessed(-1)
     , m_last_filter_update_timestamp()
     , m_last_filter_update_timestamp_valid(false)
+    , m_last_processed_state_timestamp()
+    , m_last_processed_state_timestamp_valid(false)
+    , m_tracking_quality(0.f)
+    , m_avg_projection_fit_error(0.f)
+    , m_avg_multicam_disagreement_cm(0.f)
+    , m_avg_filter_innovation_cm(0.f)
+    , m_filter_update_complete_timestamp()
+    , m_filter_update_complete_timestamp_valid(false)
+    , m_shared_memory_accesor(nullptr)
+    , m_shared_memory_stream_count(0)
 {
     m_tracking_color = std::make_tuple(0x00, 0x00, 0x00);
     m_LED_override_color = std::make_tuple(0x00, 0x00, 0x00);
+
+    memset(&m_tracking_shape, 0, sizeof(CommonDeviceTrackingShape));
+    m_tracking_shape.shape_type = eCommonTrackingShapeType::INVALID_SHAPE;
+
+    ServerUtility::format_string(m_shared_memory_name, sizeof(m_shared_memory_name), "controller_view_%d", device_id);
+
+    m_pose_filter_history = new PoseFilterHistory();
 }
 
 ServerControllerView::~ServerControllerView()
 {
+    if (m_hid_poll_thread != nullptr)
+    {
+        delete m_hid_poll_thread;
+    }
+
+    delete m_pose_filter_history;
 }
 
 bool ServerControllerView::allocate_device_interface(
@@ -118,7 +280,19 @@ bool ServerControllerView::allocate_device_interface(
     {
     case CommonDeviceState::PSMove:
         {
-            m_device = new PSMoveController();
+            const ControllerDeviceEnumerator *controller_enumerator =
+                static_cast<const ControllerDeviceEnumerator *>(enumerator);
+
+            // A virtual controller replays a recorded input report log but runs
+            // through the same PSMove state pipeline as live hardware
+            if (controller_enumerator->get_is_virtual_controller())
+            {
+                m_device = new VirtualController();
+            }
+            else
+            {
+                m_device = new PSMoveController();
+            }
             m_tracker_pose_estimations = new ControllerOpticalPoseEstimation[TrackerManager::k_max_devices];
 			m_pose_filter= nullptr; // no pose filter until the device is opened
 
@@ -238,6 +412,15 @@ bool ServerControllerView::open(const class DeviceEnumerator *enumerator)
             break;
         }
 
+        // Cache the tracking shape and its bounding radius. The shape
+        // geometry is static while the device is open and the projection
+        // code asks for it per tracker per frame.
+        device->getTrackingShape(m_tracking_shape);
+        m_tracking_shape_bounding_radius_cm=
+            (m_tracking_shape.shape_type != eCommonTrackingShapeType::INVALID_SHAPE)
+            ? ServerTrackerView::computeTrackingShapeBoundingRadius(&m_tracking_shape)
+            : 0.f;
+
         // Reset the poll sequence number high water mark
         m_lastPollSeqNumProcessed= -1;
     }
@@ -268,17 +451,108 @@ bool ServerControllerView::open(const class DeviceEnumerator *enumerator)
 		}
     }
 
-    // Clear the filter update timestamp
+    // If a recent clean shutdown left a warm restart snapshot for this
+    // device, resume from its last optical pose estimates so the trackers
+    // search the prior ROI instead of re-acquiring from a full-frame scan
+    if (bSuccess)
+    {
+        restoreWarmRestartState();
+    }
+
+    // Clear the filter update timestamp and the recorded pose history
     m_last_filter_update_timestamp = std::chrono::time_point<std::chrono::high_resolution_clock>();
     m_last_filter_update_timestamp_valid= false;
+    m_last_processed_state_timestamp = std::chrono::time_point<std::chrono::high_resolution_clock>();
+    m_last_processed_state_timestamp_valid= false;
+    m_filter_update_complete_timestamp = std::chrono::time_point<std::chrono::high_resolution_clock>();
+    m_filter_update_complete_timestamp_valid= false;
+    m_poll_to_filter_histogram.clear();
+    m_filter_to_publish_histogram.clear();
+    m_poll_to_publish_histogram.clear();
+    m_pose_filter_history->clear();
+    m_pose_filter_history_seconds= 0.f;
+
+    // Spin up a dedicated HID polling thread for pollable controllers so that
+    // one slow bluetooth radio can't stall the polling of every other device
+    if (bSuccess && m_device->getIsReadyToPoll())
+    {
+        assert(m_hid_poll_thread == nullptr);
+        m_hid_poll_thread= new ControllerHidPollThread(m_device, getDeviceID());
+        m_hid_poll_thread->startup();
+    }
 
     return bSuccess;
 }
 
+bool ServerControllerView::poll()
+{
+    // Without a polling thread, poll the device on the service thread as usual
+    if (m_hid_poll_thread == nullptr || !m_hid_poll_thread->getIsRunning())
+    {
+        return ServerDeviceView::poll();
+    }
+
+    bool bSuccessfullyUpdated= true;
+
+    if (m_hid_poll_thread->getHasPollFailure())
+    {
+        SERVER_LOG_INFO("ServerControllerView::poll") <<
+            "Device id " << getDeviceID() << " closing due to failed read";
+        close();
+
+        bSuccessfullyUpdated= false;
+    }
+    else if (m_hid_poll_thread->getQueuedStateCount() > 0)
+    {
+        m_lastNewDataTimestamp= ServiceClock::now();
+
+        // If the polling thread queued new sensor data, then we have new state to publish
+        markStateAsUnpublished();
+    }
+    else if (m_hid_poll_thread->getPollNoDataCount() > m_device->getMaxPollFailureCount())
+    {
+        SERVER_LOG_INFO("ServerControllerView::poll") <<
+            "Device id " << getDeviceID() <<
+            " closing due to no data (" << m_device->getMaxPollFailureCount() <<
+            " failed poll attempts)";
+        close();
+
+        bSuccessfullyUpdated= false;
+    }
+
+    return bSuccessfullyUpdated;
+}
+
 void ServerControllerView::close()
 {
+    if (m_shared_memory_accesor != nullptr)
+    {
+        delete m_shared_memory_accesor;
+        m_shared_memory_accesor = nullptr;
+    }
+
+    // Stop the HID polling thread before touching the device handle
+    if (m_hid_poll_thread != nullptr)
+    {
+        m_hid_poll_thread->shutdown();
+        delete m_hid_poll_thread;
+        m_hid_poll_thread= nullptr;
+    }
+
     set_tracking_enabled_internal(false);
 
+    // Persist the converged filter state on clean shutdown so the filter
+    // can warm-start the next time this controller is opened
+    if (m_pose_filter != nullptr && m_device != nullptr && getIsOpen())
+    {
+        std::vector<double> converged_state;
+
+        if (m_pose_filter->getConvergedState(converged_state))
+        {
+            m_device->setFilterWarmStartState(converged_state);
+        }
+    }
+
 	eCommonTrackingColorID tracking_color_id= eCommonTrackingColorID::INVALID_COLOR;
     if (m_device != nullptr && m_device->getTrackingColorID(tracking_color_id))
     {
@@ -291,6 +565,123 @@ void ServerControllerView::close()
     ServerDeviceView::close();
 }
 
+void ServerControllerView::captureWarmRestartState() const
+{
+    if (!getIsOpen() || m_tracker_pose_estimations == nullptr)
+    {
+        return;
+    }
+
+    WarmRestartSnapshot::DeviceEntry entry;
+    entry.device_kind = WarmRestartSnapshot::DeviceKind_Controller;
+    entry.device_path = getUSBDevicePath();
+
+    for (int tracker_index = 0; tracker_index < TrackerManager::k_max_devices; ++tracker_index)
+    {
+        const ControllerOpticalPoseEstimation &estimate = m_tracker_pose_estimations[tracker_index];
+        WarmRestartSnapshot::TrackerEntry tracker_entry;
+
+        tracker_entry.bCurrentlyTracking = estimate.bCurrentlyTracking;
+        tracker_entry.bOrientationValid = estimate.bOrientationValid;
+        tracker_entry.position_cm = estimate.position_cm;
+        tracker_entry.orientation = estimate.orientation;
+        tracker_entry.projection = estimate.projection;
+
+        entry.tracker_entries.push_back(tracker_entry);
+    }
+
+    WarmRestartSnapshot::addDeviceEntry(entry);
+}
+
+void ServerControllerView::restoreWarmRestartState()
+{
+    WarmRestartSnapshot::DeviceEntry entry;
+
+    if (m_tracker_pose_estimations == nullptr ||
+        !WarmRestartSnapshot::fetchDeviceEntry(
+            WarmRestartSnapshot::DeviceKind_Controller, getUSBDevicePath(), entry))
+    {
+        return;
+    }
+
+    const std::chrono::time_point<std::chrono::high_resolution_clock> now =
+        ServiceClock::now();
+    const int tracker_count =
+        std::min(static_cast<int>(entry.tracker_entries.size()), TrackerManager::k_max_devices);
+    int restored_count = 0;
+
+    for (int tracker_index = 0; tracker_index < tracker_count; ++tracker_index)
+    {
+        const WarmRestartSnapshot::TrackerEntry &tracker_entry = entry.tracker_entries[tracker_index];
+
+        // Only trackers that actually saw the device are worth restoring.
+        // If the device has moved since, the normal tracking loss handling
+        // throws the restored estimate out within a frame or two.
+        if (tracker_entry.bCurrentlyTracking)
+        {
+            ControllerOpticalPoseEstimation &estimate = m_tracker_pose_estimations[tracker_index];
+
+            estimate.position_cm = tracker_entry.position_cm;
+            estimate.orientation = tracker_entry.orientation;
+            estimate.projection = tracker_entry.projection;
+            estimate.bCurrentlyTracking = true;
+            estimate.bOrientationValid = tracker_entry.bOrientationValid;
+            estimate.bWorldRayValid = false;
+            estimate.last_update_timestamp = now;
+            estimate.last_visible_timestamp = now;
+            estimate.bValidTimestamps = true;
+
+            ++restored_count;
+        }
+    }
+
+    if (restored_count > 0)
+    {
+        SERVER_LOG_INFO("ServerControllerView::open") <<
+            "Controller " << getDeviceID() << " warm-restored tracking state from " <<
+            restored_count << " tracker(s)";
+    }
+}
+
+void ServerControllerView::startSharedMemoryStream()
+{
+    ++m_shared_memory_stream_count;
+
+    // Allocate the shared memory block when the first client subscribes
+    if (m_shared_memory_stream_count == 1 &&
+        m_shared_memory_accesor == nullptr)
+    {
+        m_shared_memory_accesor = new SharedControllerStateWriteAccessor();
+
+        if (!m_shared_memory_accesor->initialize(m_shared_memory_name))
+        {
+            delete m_shared_memory_accesor;
+            m_shared_memory_accesor = nullptr;
+
+            SERVER_LOG_ERROR("ServerControllerView::startSharedMemoryStream")
+                << "Failed to allocated shared memory: " << m_shared_memory_name;
+        }
+    }
+}
+
+void ServerControllerView::stopSharedMemoryStream()
+{
+    assert(m_shared_memory_stream_count > 0);
+    --m_shared_memory_stream_count;
+
+    // Free the shared memory block once the last client unsubscribes
+    if (m_shared_memory_stream_count == 0 && m_shared_memory_accesor != nullptr)
+    {
+        delete m_shared_memory_accesor;
+        m_shared_memory_accesor = nullptr;
+    }
+}
+
+std::string ServerControllerView::getSharedMemoryStreamName() const
+{
+    return std::string(m_shared_memory_name);
+}
+
 bool ServerControllerView::recenterOrientation(const CommonDeviceQuaternion& q_pose_relative_to_identity_pose)
 {
 	bool bSuccess = false;
@@ -342,6 +733,10 @@ void ServerControllerView::resetPoseFilter()
 {
 	assert(m_device != nullptr);
 
+	// Recorded history is only meaningful for the filter that produced it
+	m_pose_filter_history->clear();
+	m_pose_filter_history_seconds= 0.f;
+
 	if (m_pose_filter != nullptr)
 	{
 		delete m_pose_filter;
@@ -361,19 +756,41 @@ void ServerControllerView::resetPoseFilter()
 		init_filters_for_psmove(
 			static_cast<PSMoveController *>(m_device),
 			&m_pose_filter_space, &m_pose_filter);
+
+		// Warm-start from the covariance/bias state persisted on the last clean
+		// shutdown so the filter doesn't spend seconds reconverging
+		if (m_pose_filter != nullptr)
+		{
+			const PSMoveControllerConfig *config = static_cast<PSMoveController *>(m_device)->getConfig();
+
+			if (!config->filter_warm_start_state.empty())
+			{
+				m_pose_filter->setConvergedState(config->filter_warm_start_state);
+			}
+		}
 	} break;
 	case CommonDeviceState::PSDualShock4:
 		{
 			init_filters_for_psdualshock4(
 				static_cast<PSDualShock4Controller *>(m_device),
 				&m_pose_filter_space, &m_pose_filter);
+
+			if (m_pose_filter != nullptr)
+			{
+				const PSDualShock4ControllerConfig *config = static_cast<PSDualShock4Controller *>(m_device)->getConfig();
+
+				if (!config->filter_warm_start_state.empty())
+				{
+					m_pose_filter->setConvergedState(config->filter_warm_start_state);
+				}
+			}
 		} break;
 	}
 }
 
 void ServerControllerView::updateOpticalPoseEstimation(TrackerManager* tracker_manager)
 {
-    const std::chrono::time_point<std::chrono::high_resolution_clock> now= std::chrono::high_resolution_clock::now();
+    const std::chrono::time_point<std::chrono::high_resolution_clock> now= ServiceClock::now();
 
     // TODO: Probably need to first update IMU state to get velocity.
     // If velocity is too high, don't bother getting a new position.
@@ -388,73 +805,124 @@ void ServerControllerView::updateOpticalPoseEstimation(TrackerManager* tracker_m
 		m_device->getTrackingShape(trackingShape);
 		assert(trackingShape.shape_type != eCommonTrackingShapeType::INVALID_SHAPE);
 
-        // Find the projection of the controller from the perspective of each tracker.
-		// In the case of sphere projections, go ahead and compute the tracker relative position as well.
+        const float timeoutMilli=
+            static_cast<float>(DeviceManager::getInstance()->m_tracker_manager->getConfigSnapshot()->config.optical_tracking_timeout);
+
+        // Per-tracker projection work that can run on the worker pool
+        ControllerOpticalPoseEstimation pendingPoseEstimates[TrackerManager::k_max_devices];
+        bool bVideoFrameFresh[TrackerManager::k_max_devices];
+        bool bProjectionDispatched[TrackerManager::k_max_devices];
+        bool bPendingProjectionValid[TrackerManager::k_max_devices];
+
+        TrackerPoseEstimationWorkerPool &worker_pool=
+            DeviceManager::getInstance()->m_tracker_manager->getPoseEstimationWorkerPool();
+
+        // Kick off the blob extraction and projection of the controller from the
+		// perspective of each tracker that has a new video frame this tick.
+		// In the case of sphere projections, the tracker relative position gets computed as well.
+		// Each job only touches its own tracker's state and its own slot of the
+		// pending results, so the jobs can run concurrently.
         for (int tracker_id = 0; tracker_id < tracker_manager->getMaxDevices(); ++tracker_id)
         {
             ServerTrackerViewPtr tracker = tracker_manager->getTrackerViewPtr(tracker_id);
-            ControllerOpticalPoseEstimation &trackerPoseEstimateRef = m_tracker_pose_estimations[tracker_id];
-
-            const bool bWasTracking= trackerPoseEstimateRef.bCurrentlyTracking;
 
-            // Assume we're going to lose tracking this frame
-            bool bCurrentlyTracking = false;
+            bVideoFrameFresh[tracker_id]= false;
+            bProjectionDispatched[tracker_id]= false;
+            bPendingProjectionValid[tracker_id]= false;
 
             if (tracker->getIsOpen())
             {
                 // See how long it's been since we got a new video frame
-                const std::chrono::time_point<std::chrono::high_resolution_clock> now= 
-                    std::chrono::high_resolution_clock::now();
-                const std::chrono::duration<float, std::milli> timeSinceNewDataMillis= 
+                const std::chrono::duration<float, std::milli> timeSinceNewDataMillis=
                     now - tracker->getLastNewDataTimestamp();
-                const float timeoutMilli= 
-                    static_cast<float>(DeviceManager::getInstance()->m_tracker_manager->getConfig().optical_tracking_timeout);
 
                 // Can't compute tracking on video data that's too old
                 if (timeSinceNewDataMillis.count() < timeoutMilli)
                 {
-                    // Initially the newTrackerPoseEstimate is a copy of the existing pose
-                    bool bIsVisibleThisUpdate= false;
-
-                    // If a new video frame is available this tick, 
-                    // attempt to update the tracking location
-                    if (tracker->getHasUnpublishedState())
+                    bVideoFrameFresh[tracker_id]= true;
+
+                    // If a new video frame is available this tick and this
+                    // tracker is assigned to the current interleave slot,
+                    // attempt to update the tracking location.
+                    // Unscheduled trackers hold their last pose estimate and
+                    // fall out of tracking via the visibility timeout.
+                    if (tracker->getHasUnpublishedState() &&
+                        tracker_manager->getIsTrackerScheduledThisTick(tracker_id))
                     {
-						// Create a copy of the pose estimate state so that in event of a 
+						// Work on a copy of the pose estimate state so that in event of a
 						// failure part way through computing the projection we don't
 						// set partially valid state
-                        ControllerOpticalPoseEstimation newTrackerPoseEstimate= trackerPoseEstimateRef;
-
-                        if (tracker->computeProjectionForController(
-                                this, 
-								&trackingShape,
-                                &newTrackerPoseEstimate))
-                        {
-                            bIsVisibleThisUpdate= true;
-
-							// Actually apply the pose estimate state
-                            trackerPoseEstimateRef= newTrackerPoseEstimate;
-                            trackerPoseEstimateRef.last_visible_timestamp = now;
-                        }
+                        pendingPoseEstimates[tracker_id]= m_tracker_pose_estimations[tracker_id];
+                        bProjectionDispatched[tracker_id]= true;
+
+                        ServerTrackerView *tracker_ptr= tracker.get();
+                        ControllerOpticalPoseEstimation *pose_estimate_ptr= &pendingPoseEstimates[tracker_id];
+                        bool *result_ptr= &bPendingProjectionValid[tracker_id];
+
+                        worker_pool.addJob(
+                            [this, tracker_ptr, &trackingShape, pose_estimate_ptr, result_ptr]
+                            {
+                                *result_ptr= tracker_ptr->computeProjectionForController(
+                                    this,
+                                    &trackingShape,
+                                    pose_estimate_ptr);
+                            });
                     }
+                }
+            }
+        }
+
+        // Join the projection batch before touching any of the results
+        worker_pool.waitForAllJobs();
 
-                    // If the projection isn't too old (or updated this tick), 
-                    // say we have a valid tracked location
-                    if (bWasTracking || bIsVisibleThisUpdate)
+        // Merge the projection results back into the per-tracker pose
+        // estimates on the service thread
+        for (int tracker_id = 0; tracker_id < tracker_manager->getMaxDevices(); ++tracker_id)
+        {
+            ControllerOpticalPoseEstimation &trackerPoseEstimateRef = m_tracker_pose_estimations[tracker_id];
+
+            const bool bWasTracking= trackerPoseEstimateRef.bCurrentlyTracking;
+            const bool bIsVisibleThisUpdate=
+                bProjectionDispatched[tracker_id] && bPendingProjectionValid[tracker_id];
+
+            // Assume we're going to lose tracking this frame
+            bool bCurrentlyTracking = false;
+
+            if (bVideoFrameFresh[tracker_id])
+            {
+                if (bIsVisibleThisUpdate)
+                {
+                    ServerTrackerViewPtr tracker = tracker_manager->getTrackerViewPtr(tracker_id);
+
+					// Actually apply the pose estimate state
+                    trackerPoseEstimateRef= pendingPoseEstimates[tracker_id];
+
+                    // Stamp the observation with the time the camera actually
+                    // captured the frame rather than when we processed it
+                    trackerPoseEstimateRef.last_visible_timestamp = tracker->getLastNewDataTimestamp();
+
+                    // Refresh the cached world space ray through the new observation.
+                    // Trackers without a new observation this tick keep their
+                    // previous ray for the multicam triangulation.
+                    updateCachedWorldRayForPoseEstimate(tracker, trackerPoseEstimateRef);
+                }
+
+                // If the projection isn't too old (or updated this tick),
+                // say we have a valid tracked location
+                if (bWasTracking || bIsVisibleThisUpdate)
+                {
+                    const std::chrono::duration<float, std::milli> timeSinceLastVisibleMillis=
+                        now - trackerPoseEstimateRef.last_visible_timestamp;
+
+                    if (timeSinceLastVisibleMillis.count() < timeoutMilli)
                     {
-                        const std::chrono::duration<float, std::milli> timeSinceLastVisibleMillis= 
-                            now - trackerPoseEstimateRef.last_visible_timestamp;
-
-                        if (timeSinceLastVisibleMillis.count() < timeoutMilli)
-                        {
-                            // If this tracker has a valid projection for the controller
-                            // add it to the tracker id list
-                            valid_projection_tracker_ids[projections_found] = tracker_id;
-                            ++projections_found;
-
-                            // Flag this pose estimate as invalid
-                            bCurrentlyTracking = true;
-                        }
+                        // If this tracker has a valid projection for the controller
+                        // add it to the tracker id list
+                        valid_projection_tracker_ids[projections_found] = tracker_id;
+                        ++projections_found;
+
+                        // Flag this pose estimate as invalid
+                        bCurrentlyTracking = true;
                     }
                 }
             }
@@ -496,7 +964,7 @@ void ServerControllerView::updateOpticalPoseEstimation(TrackerManager* tracker_m
 				assert(false && "unreachable");
 			}
         }
-        else if (projections_found == 1 && !DeviceManager::getInstance()->m_tracker_manager->getConfig().ignore_pose_from_one_tracker)
+        else if (projections_found == 1 && !DeviceManager::getInstance()->m_tracker_manager->getConfigSnapshot()->config.ignore_pose_from_one_tracker)
         {
 			const int tracker_id = valid_projection_tracker_ids[0];
 			const ServerTrackerViewPtr tracker = tracker_manager->getTrackerViewPtr(tracker_id);
@@ -529,38 +997,179 @@ void ServerControllerView::updateOpticalPoseEstimation(TrackerManager* tracker_m
             m_multicam_pose_estimation->bCurrentlyTracking= false;
         }
 
-        // Update the position estimation timestamps
+        // Update the position estimation timestamps.
+        // The multicam estimate is only as old as the newest frame that went
+        // into it, so use the newest per-tracker capture timestamp.
         if (m_multicam_pose_estimation->bCurrentlyTracking)
         {
-            m_multicam_pose_estimation->last_visible_timestamp = now;
+            std::chrono::time_point<std::chrono::high_resolution_clock> newest_capture_timestamp=
+                m_tracker_pose_estimations[valid_projection_tracker_ids[0]].last_visible_timestamp;
+
+            for (int list_index = 1; list_index < projections_found; ++list_index)
+            {
+                const int tracker_id= valid_projection_tracker_ids[list_index];
+
+                if (m_tracker_pose_estimations[tracker_id].last_visible_timestamp > newest_capture_timestamp)
+                {
+                    newest_capture_timestamp= m_tracker_pose_estimations[tracker_id].last_visible_timestamp;
+                }
+            }
+
+            m_multicam_pose_estimation->last_visible_timestamp = newest_capture_timestamp;
         }
         m_multicam_pose_estimation->last_update_timestamp = now;
         m_multicam_pose_estimation->bValidTimestamps = true;
+
+        // Multi-instance sharding: a secondary shard publishes its multicam
+        // estimate to the exchange for the primary to consume; the primary
+        // folds fresh observations from the other shards into its estimate
+        // before it feeds the pose filter
+        TrackerShardExchange *shard_exchange= tracker_manager->getShardExchange();
+        if (shard_exchange != nullptr)
+        {
+            if (shard_exchange->getShardIndex() != 0)
+            {
+                shard_exchange->publishControllerObservation(getDeviceID(), m_multicam_pose_estimation);
+            }
+            else
+            {
+                mergeRemoteShardObservationsForController(
+                    shard_exchange, getDeviceID(), now, m_multicam_pose_estimation);
+            }
+        }
+
+        // Fold this tick's results into the rolling tracking quality metrics
+        updateTrackingQuality(valid_projection_tracker_ids, projections_found);
     }
 }
 
+void ServerControllerView::updateTrackingQuality(
+    const int *valid_projection_tracker_ids,
+    const int projections_found)
+{
+    float quality_sample = 0.f;
+
+    if (m_multicam_pose_estimation->bCurrentlyTracking)
+    {
+        const CommonDevicePosition &multicam_position_cm = m_multicam_pose_estimation->position_cm;
+
+        // Mean goodness-of-fit of the contributing 2D projections
+        float fit_error_sum = 0.f;
+        int fit_error_count = 0;
+
+        // Worst distance from the blended multicam position to any
+        // contributing tracker's observation ray. With a single tracker
+        // there is nothing to disagree with, so the sample stays 0.
+        float multicam_disagreement_cm = 0.f;
+
+        for (int list_index = 0; list_index < projections_found; ++list_index)
+        {
+            const int tracker_id = valid_projection_tracker_ids[list_index];
+            const ControllerOpticalPoseEstimation &estimate = m_tracker_pose_estimations[tracker_id];
+
+            if (estimate.projection_fit_error > 0.f)
+            {
+                fit_error_sum += estimate.projection_fit_error;
+                ++fit_error_count;
+            }
+
+            if (projections_found > 1 && estimate.bWorldRayValid)
+            {
+                // Perpendicular distance from the multicam position to the
+                // tracker's cached world ray
+                const float ox = multicam_position_cm.x - estimate.world_ray_origin_cm.x;
+                const float oy = multicam_position_cm.y - estimate.world_ray_origin_cm.y;
+                const float oz = multicam_position_cm.z - estimate.world_ray_origin_cm.z;
+                const float t =
+                    ox*estimate.world_ray_direction.i +
+                    oy*estimate.world_ray_direction.j +
+                    oz*estimate.world_ray_direction.k;
+                const float dx = ox - t*estimate.world_ray_direction.i;
+                const float dy = oy - t*estimate.world_ray_direction.j;
+                const float dz = oz - t*estimate.world_ray_direction.k;
+                const float ray_distance_cm = sqrtf(dx*dx + dy*dy + dz*dz);
+
+                multicam_disagreement_cm = std::max(multicam_disagreement_cm, ray_distance_cm);
+            }
+        }
+
+        const float fit_error =
+            (fit_error_count > 0) ? fit_error_sum / static_cast<float>(fit_error_count) : 0.f;
+
+        // How far the optical observation landed from the pose filter's
+        // current belief. Large persistent innovation means the filter and
+        // the cameras disagree (bad calibration, mis-identified blob).
+        float filter_innovation_cm = 0.f;
+        if (getPoseFilter() != nullptr && getPoseFilter()->getIsStateValid())
+        {
+            const CommonDevicePose filtered_pose = getFilteredPose();
+            const float dx = multicam_position_cm.x - filtered_pose.PositionCm.x;
+            const float dy = multicam_position_cm.y - filtered_pose.PositionCm.y;
+            const float dz = multicam_position_cm.z - filtered_pose.PositionCm.z;
+
+            filter_innovation_cm = sqrtf(dx*dx + dy*dy + dz*dz);
+        }
+
+        // Smooth the raw metrics while tracking; they hold their last value
+        // while tracking is lost so a scrape still sees why it degraded
+        m_avg_projection_fit_error += k_tracking_quality_ema_alpha*(fit_error - m_avg_projection_fit_error);
+        m_avg_multicam_disagreement_cm += k_tracking_quality_ema_alpha*(multicam_disagreement_cm - m_avg_multicam_disagreement_cm);
+        m_avg_filter_innovation_cm += k_tracking_quality_ema_alpha*(filter_innovation_cm - m_avg_filter_innovation_cm);
+
+        // Composite score: each metric at its scale value halves the score
+        quality_sample = 1.f;
+        quality_sample *= k_quality_fit_error_scale / (k_quality_fit_error_scale + m_avg_projection_fit_error);
+        quality_sample *= k_quality_disagreement_scale_cm / (k_quality_disagreement_scale_cm + m_avg_multicam_disagreement_cm);
+        quality_sample *= k_quality_innovation_scale_cm / (k_quality_innovation_scale_cm + m_avg_filter_innovation_cm);
+    }
+
+    // The quality score itself keeps folding while tracking is lost,
+    // decaying toward zero
+    m_tracking_quality += k_tracking_quality_ema_alpha*(quality_sample - m_tracking_quality);
+}
+
 void ServerControllerView::updateStateAndPredict()
 {
+    SERVER_TRACE_SCOPE("ServerControllerView::updateStateAndPredict");
+
     if (!getHasUnpublishedState())
     {
         return;
     }
 
-    // Look backward in time to find the first controller update state with a poll sequence number 
-    // newer than the last sequence number we've processed.
+    const bool bUseThreadedStateQueue= (m_hid_poll_thread != nullptr && m_hid_poll_thread->getIsRunning());
+
+    // Count the new controller states waiting to be processed this tick
+    int new_state_count= 0;
     int firstLookBackIndex = -1;
-    int testLookBack = 0;
-    const CommonControllerState *state= getState(testLookBack);
-    while (state != nullptr && state->PollSequenceNumber > m_lastPollSeqNumProcessed)
+    if (bUseThreadedStateQueue)
     {
-        firstLookBackIndex= testLookBack;
-        testLookBack++;
-        state= getState(testLookBack);
+        new_state_count= m_hid_poll_thread->getQueuedStateCount();
+
+        if (new_state_count <= 0)
+        {
+            return;
+        }
+    }
+    else
+    {
+        // Look backward in time to find the first controller update state with a poll sequence number
+        // newer than the last sequence number we've processed.
+        int testLookBack = 0;
+        const CommonControllerState *state= getState(testLookBack);
+        while (state != nullptr && state->PollSequenceNumber > m_lastPollSeqNumProcessed)
+        {
+            firstLookBackIndex= testLookBack;
+            testLookBack++;
+            state= getState(testLookBack);
+        }
+        assert(firstLookBackIndex >= 0);
+
+        new_state_count= firstLookBackIndex + 1;
     }
-    assert(firstLookBackIndex >= 0);
 
     // Compute the time in seconds since the last update
-    const std::chrono::time_point<std::chrono::high_resolution_clock> now = std::chrono::high_resolution_clock::now();
+    const std::chrono::time_point<std::chrono::high_resolution_clock> now = ServiceClock::now();
     float time_delta_seconds;
     if (m_last_filter_update_timestamp_valid)
     {
@@ -578,54 +1187,164 @@ void ServerControllerView::updateStateAndPredict()
     m_last_filter_update_timestamp_valid = true;
 
     // Evenly apply the list of controller state updates over the time since last filter update
-    float per_state_time_delta_seconds = time_delta_seconds / static_cast<float>(firstLookBackIndex + 1);
+    float per_state_time_delta_seconds = time_delta_seconds / static_cast<float>(new_state_count);
+
+    // IMU samples from the polled states accumulate in this queue and get
+    // integrated as one batched filter update (a single covariance propagation
+    // over the summed time delta) alongside the optical measurement, rather
+    // than paying for a full filter tick per sample
+    PoseSensorPacketQueue imu_packet_queue;
 
     // Process the polled controller states forward in time
     // computing the new orientation along the way.
-    for (int lookBackIndex= firstLookBackIndex; lookBackIndex >= 0; --lookBackIndex)
+    if (bUseThreadedStateQueue)
     {
-        const CommonControllerState *controllerState= getState(lookBackIndex);
-
-        switch (controllerState->DeviceType)
+        for (int state_index= 0; state_index < new_state_count; ++state_index)
         {
-        case CommonControllerState::PSMove:
-            {
-                const PSMoveController *psmoveController= this->castCheckedConst<PSMoveController>();
-                const PSMoveControllerState *psmoveState= static_cast<const PSMoveControllerState *>(controllerState);
-
-                // Only update the position filter when tracking is enabled
-                update_filters_for_psmove(
-                    psmoveController, psmoveState, 
-                    per_state_time_delta_seconds,
-                    m_multicam_pose_estimation,
-					m_pose_filter_space,
-                    m_pose_filter);
-            } break;
-        case CommonControllerState::PSNavi:
+            if (!m_hid_poll_thread->popQueuedState())
             {
-                // No orientation or position to update
-                assert(m_pose_filter == nullptr);
-            } break;
-        case CommonControllerState::PSDualShock4:
-            {
-                const PSDualShock4Controller *psdualshock4Controller = this->castCheckedConst<PSDualShock4Controller>();
-                const PSDualShock4ControllerState *psdualshock4State = 
-                    static_cast<const PSDualShock4ControllerState *>(controllerState);
-
-                // Only update the position filter when tracking is enabled
-                update_filters_for_psdualshock4(
-                    psdualshock4Controller, psdualshock4State,
-                    per_state_time_delta_seconds,
-                    m_multicam_pose_estimation,
-					m_pose_filter_space,
-                    m_pose_filter);
-            } break;
-        default:
-            assert(0 && "Unhandled controller type");
+                break;
+            }
+
+            const CommonControllerState *controllerState= m_hid_poll_thread->getLatestPoppedState();
+
+            processPolledState(
+                controllerState,
+                per_state_time_delta_seconds,
+                imu_packet_queue,
+                state_index == new_state_count - 1);
+
+            // Consider this controller state sequence num processed
+            m_lastPollSeqNumProcessed= controllerState->PollSequenceNumber;
+        }
+    }
+    else
+    {
+        for (int lookBackIndex= firstLookBackIndex; lookBackIndex >= 0; --lookBackIndex)
+        {
+            const CommonControllerState *controllerState= getState(lookBackIndex);
+
+            processPolledState(
+                controllerState,
+                per_state_time_delta_seconds,
+                imu_packet_queue,
+                lookBackIndex == 0);
+
+            // Consider this controller state sequence num processed
+            m_lastPollSeqNumProcessed= controllerState->PollSequenceNumber;
+        }
+    }
+
+    // Publish the updated filter state into the cross-thread snapshot buffer
+    // so off-thread readers never have to touch the filter itself
+    if (m_pose_filter != nullptr)
+    {
+        CommonDevicePoseSnapshot snapshot;
+
+        snapshot.pose= getFilteredPose();
+        snapshot.physics= getFilteredPhysics();
+
+        m_pose_snapshot_buffer.write(snapshot);
+
+        // Record the new state in the pose history ring buffer so that
+        // past-time pose queries can interpolate between real states
+        m_pose_filter_history_seconds+= time_delta_seconds;
+        m_pose_filter_history->addSample(
+            m_pose_filter_history_seconds,
+            m_pose_filter->getOrientation(),
+            m_pose_filter->getPositionCm());
+    }
+
+    // Latency instrumentation: time from the newest report's hid_read drain
+    // to the completion of this filter update
+    if (m_last_processed_state_timestamp_valid)
+    {
+        const std::chrono::time_point<std::chrono::high_resolution_clock> filter_complete_time=
+            ServiceClock::now();
+        const std::chrono::duration<double, std::micro> poll_to_filter=
+            filter_complete_time - m_last_processed_state_timestamp;
+
+        m_poll_to_filter_histogram.addSampleMicroseconds(poll_to_filter.count());
+
+        m_filter_update_complete_timestamp= filter_complete_time;
+        m_filter_update_complete_timestamp_valid= true;
+    }
+}
+
+void ServerControllerView::processPolledState(
+    const CommonControllerState *controllerState,
+    const float per_state_time_delta_seconds,
+    PoseSensorPacketQueue &imu_packet_queue,
+    const bool bIsFinalStateThisTick)
+{
+    // Prefer the real time delta between poll timestamps over the even split
+    // of the service tick, so that batched IMU samples integrate over the
+    // intervals they were actually recorded at
+    float state_time_delta_seconds= per_state_time_delta_seconds;
+    if (controllerState->bPollTimestampValid)
+    {
+        if (m_last_processed_state_timestamp_valid)
+        {
+            const std::chrono::duration<float, std::milli> state_time_delta =
+                controllerState->PollTimestamp - m_last_processed_state_timestamp;
+
+            state_time_delta_seconds= clampf(state_time_delta.count() / 1000.f, 0.f, k_max_time_delta_seconds);
         }
 
-        // Consider this controller state sequence num processed
-        m_lastPollSeqNumProcessed= controllerState->PollSequenceNumber;
+        m_last_processed_state_timestamp= controllerState->PollTimestamp;
+        m_last_processed_state_timestamp_valid= true;
+    }
+
+    // Record button transitions for the reliable button event notification
+    // that goes out at the end of this tick's publish
+    if (controllerState->AllButtons != m_last_button_event_bitmask)
+    {
+        m_pending_pressed_buttons|= controllerState->AllButtons & ~m_last_button_event_bitmask;
+        m_pending_released_buttons|= m_last_button_event_bitmask & ~controllerState->AllButtons;
+        m_last_button_event_bitmask= controllerState->AllButtons;
+        m_has_pending_button_event= true;
+    }
+
+    switch (controllerState->DeviceType)
+    {
+    case CommonControllerState::PSMove:
+        {
+            const PSMoveController *psmoveController= this->castCheckedConst<PSMoveController>();
+            const PSMoveControllerState *psmoveState= static_cast<const PSMoveControllerState *>(controllerState);
+
+            // Only update the position filter when tracking is enabled
+            update_filters_for_psmove(
+                psmoveController, psmoveState,
+                state_time_delta_seconds,
+                m_multicam_pose_estimation,
+				m_pose_filter_space,
+                m_pose_filter,
+				imu_packet_queue,
+				bIsFinalStateThisTick);
+        } break;
+    case CommonControllerState::PSNavi:
+        {
+            // No orientation or position to update
+            assert(m_pose_filter == nullptr);
+        } break;
+    case CommonControllerState::PSDualShock4:
+        {
+            const PSDualShock4Controller *psdualshock4Controller = this->castCheckedConst<PSDualShock4Controller>();
+            const PSDualShock4ControllerState *psdualshock4State =
+                static_cast<const PSDualShock4ControllerState *>(controllerState);
+
+            // Only update the position filter when tracking is enabled
+            update_filters_for_psdualshock4(
+                psdualshock4Controller, psdualshock4State,
+                state_time_delta_seconds,
+                m_multicam_pose_estimation,
+				m_pose_filter_space,
+                m_pose_filter,
+				imu_packet_queue,
+				bIsFinalStateThisTick);
+        } break;
+    default:
+        assert(0 && "Unhandled controller type");
     }
 }
 
@@ -644,8 +1363,18 @@ ServerControllerView::getFilteredPose(float time) const
 
     if (m_pose_filter != nullptr)
     {
-        const Eigen::Quaternionf orientation= m_pose_filter->getOrientation(time);
-        const Eigen::Vector3f position_cm= m_pose_filter->getPositionCm(time);
+        Eigen::Quaternionf orientation;
+        Eigen::Vector3f position_cm;
+
+        // Past-time queries resample the recorded state history;
+        // present and future-time queries extrapolate from the filter state
+        if (time >= 0.f ||
+            !m_pose_filter_history->getInterpolatedPoseAtTime(
+                m_pose_filter_history_seconds + time, orientation, position_cm))
+        {
+            orientation= m_pose_filter->getOrientation(time);
+            position_cm= m_pose_filter->getPositionCm(time);
+        }
 
         pose.Orientation.w= orientation.w();
         pose.Orientation.x= orientation.x();
@@ -660,7 +1389,13 @@ ServerControllerView::getFilteredPose(float time) const
     return pose;
 }
 
-CommonDevicePhysics 
+bool
+ServerControllerView::getPublishedPoseSnapshot(CommonDevicePoseSnapshot &out_snapshot) const
+{
+    return m_pose_snapshot_buffer.read(out_snapshot);
+}
+
+CommonDevicePhysics
 ServerControllerView::getFilteredPhysics() const
 {
     CommonDevicePhysics physics;
@@ -745,6 +1480,15 @@ ServerControllerView::getControllerDeviceType() const
 const struct CommonControllerState * ServerControllerView::getState(
     int lookBack) const
 {
+    // While a polling thread owns the device, the service thread must not read
+    // the device's internal state history. Hand out the most recently consumed
+    // queue state instead; callers outside the filter update only ever ask for
+    // the latest state.
+    if (m_hid_poll_thread != nullptr && m_hid_poll_thread->getIsRunning())
+    {
+        return (lookBack == 0) ? m_hid_poll_thread->getLatestPoppedState() : nullptr;
+    }
+
     const struct CommonDeviceState *device_state = m_device->getState(lookBack);
     assert(device_state == nullptr ||
         ((int)device_state->DeviceType >= (int)CommonDeviceState::Controller &&
@@ -889,6 +1633,14 @@ void ServerControllerView::update_LED_color_internal()
         r = g = b = 0;
     }
 
+    // When a polling thread owns the device, just store the desired color.
+    // The thread applies it so a stalled hid_write can't block the service loop.
+    if (m_hid_poll_thread != nullptr && m_hid_poll_thread->getIsRunning())
+    {
+        m_hid_poll_thread->setDesiredLEDColor(r, g, b);
+        return;
+    }
+
     switch (getControllerDeviceType())
     {
     case CommonDeviceState::PSMove:
@@ -911,6 +1663,13 @@ void ServerControllerView::update_LED_color_internal()
 // Get the tracking shape for the controller
 bool ServerControllerView::getTrackingShape(CommonDeviceTrackingShape &trackingShape) const
 {
+    // Served from the open-time cache when available
+    if (m_tracking_shape.shape_type != eCommonTrackingShapeType::INVALID_SHAPE)
+    {
+        trackingShape= m_tracking_shape;
+        return true;
+    }
+
     m_device->getTrackingShape(trackingShape);
 
     return trackingShape.shape_type != eCommonTrackingShapeType::INVALID_SHAPE;
@@ -937,6 +1696,21 @@ bool ServerControllerView::setControllerRumble(
 
     if (getIsOpen())
     {
+        // When a polling thread owns the device, just store the desired rumble.
+        // The thread applies it so a stalled hid_write can't block the service loop.
+        if (m_hid_poll_thread != nullptr && m_hid_poll_thread->getIsRunning())
+        {
+            if (getControllerDeviceType() != CommonDeviceState::PSNavi)
+            {
+                unsigned char rumble_byte= static_cast<unsigned char>(clampf01(rumble_amount)*255.f);
+
+                m_hid_poll_thread->setDesiredRumble(channel, rumble_byte);
+                result= true;
+            }
+
+            return result;
+        }
+
         switch(getControllerDeviceType())
         {
         case CommonDeviceState::PSMove:
@@ -969,103 +1743,370 @@ bool ServerControllerView::setControllerRumble(
                     controller->setRightRumbleIntensity(rumble_byte);
                 }
 
-                result = true;
-            } break;
+                result = true;
+            } break;
+
+        default:
+            assert(false && "Unhanded controller type!");
+        }
+    }
+
+    return result;
+}
+
+std::uint32_t ServerControllerView::computePublishedStateFingerprint() const
+{
+    // Only the PSNavi is worth change-detecting: it has no IMU and no
+    // tracking bulb, so successful polls with an untouched controller carry
+    // exactly the same data frame. PSMove and DualShock4 state carries raw
+    // sensor readings that differ essentially every poll.
+    if (m_device != nullptr && m_device->getDeviceType() == CommonDeviceState::PSNavi)
+    {
+        const PSNaviControllerState *state=
+            static_cast<const PSNaviControllerState *>(m_device->getState());
+
+        if (state != nullptr)
+        {
+            // The individual button states (not just the AllButtons bitmask)
+            // have to contribute so the PRESSED->DOWN and RELEASED->UP edge
+            // transitions still get published
+            std::uint32_t fingerprint= static_cast<std::uint32_t>(state->Battery);
+            fingerprint= fingerprint*31 + static_cast<std::uint32_t>(state->L1);
+            fingerprint= fingerprint*31 + static_cast<std::uint32_t>(state->L2);
+            fingerprint= fingerprint*31 + static_cast<std::uint32_t>(state->L3);
+            fingerprint= fingerprint*31 + static_cast<std::uint32_t>(state->Circle);
+            fingerprint= fingerprint*31 + static_cast<std::uint32_t>(state->Cross);
+            fingerprint= fingerprint*31 + static_cast<std::uint32_t>(state->PS);
+            fingerprint= fingerprint*31 + static_cast<std::uint32_t>(state->DPad_Up);
+            fingerprint= fingerprint*31 + static_cast<std::uint32_t>(state->DPad_Right);
+            fingerprint= fingerprint*31 + static_cast<std::uint32_t>(state->DPad_Down);
+            fingerprint= fingerprint*31 + static_cast<std::uint32_t>(state->DPad_Left);
+            fingerprint= fingerprint*31 + static_cast<std::uint32_t>(state->Trigger);
+            fingerprint= fingerprint*31 + static_cast<std::uint32_t>(state->Stick_XAxis);
+            fingerprint= fingerprint*31 + static_cast<std::uint32_t>(state->Stick_YAxis);
+
+            return fingerprint;
+        }
+    }
+
+    return ServerDeviceView::computePublishedStateFingerprint();
+}
+
+void ServerControllerView::publish_device_data_frame()
+{
+    // Push any button transitions polled this tick as an immediate reliable
+    // notification, independent of the data frame cadence and per-stream
+    // throttling, so clients don't have to diff the bitmasks every frame
+    if (m_has_pending_button_event)
+    {
+        ServerRequestHandler::get_instance()->publish_controller_button_event(
+            this,
+            m_pending_pressed_buttons,
+            m_pending_released_buttons,
+            m_last_button_event_bitmask);
+
+        m_pending_pressed_buttons= 0;
+        m_pending_released_buttons= 0;
+        m_has_pending_button_event= false;
+    }
+
+    // Latency instrumentation: time from the filter update (and from the
+    // original hid_read drain) to this publish
+    if (m_filter_update_complete_timestamp_valid)
+    {
+        const std::chrono::time_point<std::chrono::high_resolution_clock> publish_time=
+            ServiceClock::now();
+        const std::chrono::duration<double, std::micro> filter_to_publish=
+            publish_time - m_filter_update_complete_timestamp;
+
+        m_filter_to_publish_histogram.addSampleMicroseconds(filter_to_publish.count());
+
+        if (m_last_processed_state_timestamp_valid)
+        {
+            const std::chrono::duration<double, std::micro> poll_to_publish=
+                publish_time - m_last_processed_state_timestamp;
+
+            m_poll_to_publish_histogram.addSampleMicroseconds(poll_to_publish.count());
+        }
+
+        // Only sample once per filter update so republished frames
+        // don't pollute the tail
+        m_filter_update_complete_timestamp_valid= false;
+    }
+
+    // Mirror the update into the shared memory ring for same-host clients
+    if (m_shared_memory_accesor != nullptr)
+    {
+        ControllerStreamInfo all_stream_info;
+        ControllerStreamPacket packet;
+
+        // Shared memory readers get every data block
+        all_stream_info.Clear();
+        all_stream_info.include_position_data = true;
+        all_stream_info.include_physics_data = true;
+        all_stream_info.include_raw_sensor_data = true;
+        all_stream_info.include_calibrated_sensor_data = true;
+        all_stream_info.include_raw_tracker_data = true;
+
+        generate_controller_stream_packet(this, &all_stream_info, &packet);
+
+        m_shared_memory_accesor->writeStreamPacket(packet);
+    }
+
+    // Tell the server request handler we want to send out controller updates.
+    // This will call generate_controller_stream_packet for each listening connection.
+    ServerRequestHandler::get_instance()->publish_controller_stream_packet(
+        this, &ServerControllerView::generate_controller_stream_packet);
+}
+
+void ServerControllerView::generate_controller_stream_packet(
+    const ServerControllerView *controller_view,
+    const ControllerStreamInfo *stream_info,
+    ControllerStreamPacket *packet)
+{
+    memset(packet, 0, sizeof(ControllerStreamPacket));
+
+    packet->magic= CONTROLLER_STREAM_PACKET_MAGIC;
+    packet->version= PSM_CONTROLLER_STREAM_PACKET_VERSION;
+    packet->controller_id= controller_view->getDeviceID();
+    packet->sequence_num= controller_view->m_sequence_number;
+    packet->tracking_quality= controller_view->getTrackingQuality();
+    packet->avg_projection_fit_error= controller_view->getAvgProjectionFitError();
+    packet->avg_multicam_disagreement_cm= controller_view->getAvgMulticamDisagreementCm();
+    packet->avg_filter_innovation_cm= controller_view->getAvgFilterInnovationCm();
+    packet->service_timestamp_us= static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    packet->publish_tick_id=
+        static_cast<uint32_t>(DeviceManager::getInstance()->getPublishTickId());
+
+    if (controller_view->getDevice()->getIsOpen())
+    {
+        packet->flags|= CONTROLLER_STREAM_PACKET_FLAG_CONNECTED;
+    }
+
+    switch (controller_view->getControllerDeviceType())
+    {
+    case CommonControllerState::PSMove:
+        {
+            generate_psmove_stream_packet(controller_view, stream_info, packet);
+        } break;
+    case CommonControllerState::PSNavi:
+        {
+            generate_psnavi_stream_packet(controller_view, stream_info, packet);
+        } break;
+    case CommonControllerState::PSDualShock4:
+        {
+            generate_psdualshock4_stream_packet(controller_view, stream_info, packet);
+        } break;
+    default:
+        assert(0 && "Unhandled controller type");
+    }
+}
+
+static void generate_stream_packet_physics_data(
+    const ServerControllerView *controller_view,
+    ControllerStreamPacket_PhysicsData *physics_data)
+{
+    const CommonDevicePhysics controller_physics = controller_view->getFilteredPhysics();
+
+    physics_data->velocity_cm_per_sec.i= controller_physics.VelocityCmPerSec.i;
+    physics_data->velocity_cm_per_sec.j= controller_physics.VelocityCmPerSec.j;
+    physics_data->velocity_cm_per_sec.k= controller_physics.VelocityCmPerSec.k;
+
+    physics_data->acceleration_cm_per_sec_sqr.i= controller_physics.AccelerationCmPerSecSqr.i;
+    physics_data->acceleration_cm_per_sec_sqr.j= controller_physics.AccelerationCmPerSecSqr.j;
+    physics_data->acceleration_cm_per_sec_sqr.k= controller_physics.AccelerationCmPerSecSqr.k;
+
+    physics_data->angular_velocity_rad_per_sec.i= controller_physics.AngularVelocityRadPerSec.i;
+    physics_data->angular_velocity_rad_per_sec.j= controller_physics.AngularVelocityRadPerSec.j;
+    physics_data->angular_velocity_rad_per_sec.k= controller_physics.AngularVelocityRadPerSec.k;
+
+    physics_data->angular_acceleration_rad_per_sec_sqr.i= controller_physics.AngularAccelerationRadPerSecSqr.i;
+    physics_data->angular_acceleration_rad_per_sec_sqr.j= controller_physics.AngularAccelerationRadPerSecSqr.j;
+    physics_data->angular_acceleration_rad_per_sec_sqr.k= controller_physics.AngularAccelerationRadPerSecSqr.k;
+}
+
+static void generate_stream_packet_raw_tracker_data(
+    const ServerControllerView *controller_view,
+    ControllerStreamPacket_RawTrackerData *raw_tracker_data)
+{
+    int valid_tracker_count= 0;
+
+    for (int trackerId = 0; trackerId < TrackerManager::k_max_devices; ++trackerId)
+    {
+        const ControllerOpticalPoseEstimation *poseEstimate=
+            controller_view->getTrackerPoseEstimate(trackerId);
+
+        if (poseEstimate != nullptr && poseEstimate->bCurrentlyTracking)
+        {
+            const CommonDevicePosition &trackerRelativePosition = poseEstimate->position_cm;
+            const CommonDeviceTrackingProjection &trackerRelativeProjection = poseEstimate->projection;
+            const ServerTrackerViewPtr tracker_view = DeviceManager::getInstance()->getTrackerViewPtr(trackerId);
+
+            // Add the tracker relative 3d position
+            {
+                ControllerStreamPacket_Position &position_cm=
+                    raw_tracker_data->relative_positions_cm[valid_tracker_count];
+
+                position_cm.x= trackerRelativePosition.x;
+                position_cm.y= trackerRelativePosition.y;
+                position_cm.z= trackerRelativePosition.z;
+            }
+
+            // Add the tracker relative projection shape and screen location
+            switch (trackerRelativeProjection.shape_type)
+            {
+            case eCommonTrackingProjectionType::ProjectionType_Ellipse:
+                {
+                    ControllerStreamPacket_TrackingProjection &projection=
+                        raw_tracker_data->projections[valid_tracker_count];
+
+                    projection.shape_type= ControllerStreamPacketProjectionType_Ellipse;
+                    projection.shape.ellipse.center.x= trackerRelativeProjection.shape.ellipse.center.x;
+                    projection.shape.ellipse.center.y= trackerRelativeProjection.shape.ellipse.center.y;
+                    projection.shape.ellipse.half_x_extent= trackerRelativeProjection.shape.ellipse.half_x_extent;
+                    projection.shape.ellipse.half_y_extent= trackerRelativeProjection.shape.ellipse.half_y_extent;
+                    projection.shape.ellipse.angle= trackerRelativeProjection.shape.ellipse.angle;
+
+                    // Project the 3d camera position back onto the tracker screen
+                    {
+                        const CommonDeviceScreenLocation trackerScreenLocation =
+                            tracker_view->projectTrackerRelativePosition(&trackerRelativePosition);
+                        ControllerStreamPacket_Pixel &pixel=
+                            raw_tracker_data->screen_locations[valid_tracker_count];
+
+                        pixel.x= trackerScreenLocation.x;
+                        pixel.y= trackerScreenLocation.y;
+                    }
+
+                    // Sphere projections carry no orientation
+                    raw_tracker_data->relative_orientations[valid_tracker_count].w= 1.f;
+                } break;
+            case eCommonTrackingProjectionType::ProjectionType_LightBar:
+                {
+                    ControllerStreamPacket_TrackingProjection &projection=
+                        raw_tracker_data->projections[valid_tracker_count];
+                    CommonDeviceScreenLocation center_pixel;
+                    center_pixel.clear();
+
+                    projection.shape_type= ControllerStreamPacketProjectionType_LightBar;
+
+                    for (int vert_index = 0; vert_index < 3; ++vert_index)
+                    {
+                        projection.shape.lightbar.triangle[vert_index].x= trackerRelativeProjection.shape.lightbar.triangle[vert_index].x;
+                        projection.shape.lightbar.triangle[vert_index].y= trackerRelativeProjection.shape.lightbar.triangle[vert_index].y;
+                    }
+
+                    for (int vert_index = 0; vert_index < 4; ++vert_index)
+                    {
+                        const CommonDeviceScreenLocation &screenLocation= trackerRelativeProjection.shape.lightbar.quad[vert_index];
+
+                        projection.shape.lightbar.quad[vert_index].x= screenLocation.x;
+                        projection.shape.lightbar.quad[vert_index].y= screenLocation.y;
+
+                        center_pixel.x += screenLocation.x;
+                        center_pixel.y += screenLocation.y;
+                    }
+
+                    // Use the center of the lightbar quad as the screen location
+                    {
+                        ControllerStreamPacket_Pixel &pixel=
+                            raw_tracker_data->screen_locations[valid_tracker_count];
+
+                        pixel.x= center_pixel.x / 4.f;
+                        pixel.y= center_pixel.y / 4.f;
+                    }
+
+                    // Add the tracker relative orientation
+                    {
+                        const CommonDeviceQuaternion &trackerRelativeOrientation = poseEstimate->orientation;
+                        ControllerStreamPacket_Quaternion &orientation=
+                            raw_tracker_data->relative_orientations[valid_tracker_count];
+
+                        orientation.w= trackerRelativeOrientation.w;
+                        orientation.x= trackerRelativeOrientation.x;
+                        orientation.y= trackerRelativeOrientation.y;
+                        orientation.z= trackerRelativeOrientation.z;
+                    }
+                } break;
+            default:
+                {
+                    raw_tracker_data->projections[valid_tracker_count].shape_type=
+                        ControllerStreamPacketProjectionType_Invalid;
+                    raw_tracker_data->relative_orientations[valid_tracker_count].w= 1.f;
+                } break;
+            }
 
-        default:
-            assert(false && "Unhanded controller type!");
+            raw_tracker_data->tracker_ids[valid_tracker_count]= trackerId;
+            ++valid_tracker_count;
         }
     }
 
-    return result;
-}
-
-void ServerControllerView::publish_device_data_frame()
-{
-    // Tell the server request handler we want to send out controller updates.
-    // This will call generate_controller_data_frame_for_stream for each listening connection.
-    ServerRequestHandler::get_instance()->publish_controller_data_frame(
-        this, &ServerControllerView::generate_controller_data_frame_for_stream);
-}
-
-void ServerControllerView::generate_controller_data_frame_for_stream(
-    const ServerControllerView *controller_view,
-    const ControllerStreamInfo *stream_info,
-    PSMoveProtocol::DeviceOutputDataFrame *data_frame)
-{
-    PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket *controller_data_frame= 
-        data_frame->mutable_controller_data_packet();
+	{
+		const ControllerOpticalPoseEstimation *poseEstimate = controller_view->getMulticamPoseEstimate();
 
-    controller_data_frame->set_controller_id(controller_view->getDeviceID());
-    controller_data_frame->set_sequence_num(controller_view->m_sequence_number);
-    controller_data_frame->set_isconnected(controller_view->getDevice()->getIsOpen());
+		if (poseEstimate->bCurrentlyTracking)
+		{
+			raw_tracker_data->multicam_position_cm.x= poseEstimate->position_cm.x;
+			raw_tracker_data->multicam_position_cm.y= poseEstimate->position_cm.y;
+			raw_tracker_data->multicam_position_cm.z= poseEstimate->position_cm.z;
+			raw_tracker_data->bValidMulticamPosition= 1;
 
-    switch (controller_view->getControllerDeviceType())
-    {
-    case CommonControllerState::PSMove:
-        {            
-            generate_psmove_data_frame_for_stream(controller_view, stream_info, data_frame);
-        } break;
-    case CommonControllerState::PSNavi:
-        {
-            generate_psnavi_data_frame_for_stream(controller_view, stream_info, data_frame);
-        } break;
-    case CommonControllerState::PSDualShock4:
-        {
-            generate_psdualshock4_data_frame_for_stream(controller_view, stream_info, data_frame);
-        } break;
-    default:
-        assert(0 && "Unhandled controller type");
-    }
+			if (poseEstimate->bOrientationValid)
+			{
+				raw_tracker_data->multicam_orientation.w= poseEstimate->orientation.w;
+				raw_tracker_data->multicam_orientation.x= poseEstimate->orientation.x;
+				raw_tracker_data->multicam_orientation.y= poseEstimate->orientation.y;
+				raw_tracker_data->multicam_orientation.z= poseEstimate->orientation.z;
+				raw_tracker_data->bValidMulticamOrientation= 1;
+			}
+		}
+	}
 
-    data_frame->set_device_category(PSMoveProtocol::DeviceOutputDataFrame::CONTROLLER);
+    raw_tracker_data->valid_tracker_count= valid_tracker_count;
 }
 
-static void generate_psmove_data_frame_for_stream(
+static void generate_psmove_stream_packet(
     const ServerControllerView *controller_view,
     const ControllerStreamInfo *stream_info,
-    PSMoveProtocol::DeviceOutputDataFrame *data_frame)
+    ControllerStreamPacket *packet)
 {
     const PSMoveController *psmove_controller= controller_view->castCheckedConst<PSMoveController>();
     const IPoseFilter *pose_filter= controller_view->getPoseFilter();
     const PSMoveControllerConfig *psmove_config= psmove_controller->getConfig();
     const CommonControllerState *controller_state= controller_view->getState();
-    const CommonDevicePose controller_pose = controller_view->getFilteredPose(psmove_config->prediction_time);
+    const CommonDevicePose controller_pose =
+        controller_view->getFilteredPose(
+            psmove_config->prediction_time + stream_info->smoothed_client_latency_seconds);
+
+    ControllerStreamPacket_PSMoveState *psmove_packet= &packet->state.psmove;
 
-    auto *controller_data_frame= data_frame->mutable_controller_data_packet();
-    auto *psmove_data_frame = controller_data_frame->mutable_psmove_state();
-   
     if (controller_state != nullptr)
-    {        
+    {
         assert(controller_state->DeviceType == CommonDeviceState::PSMove);
         const PSMoveControllerState * psmove_state= static_cast<const PSMoveControllerState *>(controller_state);
 
-        psmove_data_frame->set_validhardwarecalibration(psmove_config->is_valid);
-        psmove_data_frame->set_iscurrentlytracking(controller_view->getIsCurrentlyTracking());
-        psmove_data_frame->set_istrackingenabled(controller_view->getIsTrackingEnabled());
+        psmove_packet->bValidHardwareCalibration= psmove_config->is_valid;
+        psmove_packet->bIsCurrentlyTracking= controller_view->getIsCurrentlyTracking();
+        psmove_packet->bIsTrackingEnabled= controller_view->getIsTrackingEnabled();
 		//TODO: Collapse these two flags down into isPoseValid
-        psmove_data_frame->set_isorientationvalid(pose_filter->getIsStateValid());
-        psmove_data_frame->set_ispositionvalid(pose_filter->getIsStateValid());
+        psmove_packet->bIsOrientationValid= pose_filter->getIsStateValid();
+        psmove_packet->bIsPositionValid= pose_filter->getIsStateValid();
 
-        psmove_data_frame->mutable_orientation()->set_w(controller_pose.Orientation.w);
-        psmove_data_frame->mutable_orientation()->set_x(controller_pose.Orientation.x);
-        psmove_data_frame->mutable_orientation()->set_y(controller_pose.Orientation.y);
-        psmove_data_frame->mutable_orientation()->set_z(controller_pose.Orientation.z);
+        psmove_packet->orientation.w= controller_pose.Orientation.w;
+        psmove_packet->orientation.x= controller_pose.Orientation.x;
+        psmove_packet->orientation.y= controller_pose.Orientation.y;
+        psmove_packet->orientation.z= controller_pose.Orientation.z;
 
         if (stream_info->include_position_data)
         {
-            psmove_data_frame->mutable_position_cm()->set_x(controller_pose.PositionCm.x);
-            psmove_data_frame->mutable_position_cm()->set_y(controller_pose.PositionCm.y);
-            psmove_data_frame->mutable_position_cm()->set_z(controller_pose.PositionCm.z);
-        }
-        else
-        {
-            psmove_data_frame->mutable_position_cm()->set_x(0);
-            psmove_data_frame->mutable_position_cm()->set_y(0);
-            psmove_data_frame->mutable_position_cm()->set_z(0);
+            psmove_packet->position_cm.x= controller_pose.PositionCm.x;
+            psmove_packet->position_cm.y= controller_pose.PositionCm.y;
+            psmove_packet->position_cm.z= controller_pose.PositionCm.z;
         }
 
-        psmove_data_frame->set_trigger_value(psmove_state->TriggerValue);
+        psmove_packet->trigger_value= psmove_state->TriggerValue;
 
         unsigned int button_bitmask= 0;
         SET_BUTTON_BIT(button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket::TRIANGLE, psmove_state->Triangle);
@@ -1077,158 +2118,80 @@ static void generate_psmove_data_frame_for_stream(
         SET_BUTTON_BIT(button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket::PS, psmove_state->PS);
         SET_BUTTON_BIT(button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket::MOVE, psmove_state->Move);
         SET_BUTTON_BIT(button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket::TRIGGER, psmove_state->Trigger);
-        controller_data_frame->set_button_down_bitmask(button_bitmask);
+        packet->button_down_bitmask= button_bitmask;
 
         // If requested, get the raw sensor data for the controller
         if (stream_info->include_raw_sensor_data)
         {
-            auto *raw_sensor_data= psmove_data_frame->mutable_raw_sensor_data();
+            // One frame: [mx, my, mz]
+            psmove_packet->raw_magnetometer.i= psmove_state->RawMag[0];
+            psmove_packet->raw_magnetometer.j= psmove_state->RawMag[1];
+            psmove_packet->raw_magnetometer.k= psmove_state->RawMag[2];
 
-            // One frame: [mx, my, mz] 
-            raw_sensor_data->mutable_magnetometer()->set_i(psmove_state->RawMag[0]);
-            raw_sensor_data->mutable_magnetometer()->set_j(psmove_state->RawMag[1]);
-            raw_sensor_data->mutable_magnetometer()->set_k(psmove_state->RawMag[2]);
-
-            // Two frames: [[ax0, ay0, az0], [ax1, ay1, az1]] 
+            // Two frames: [[ax0, ay0, az0], [ax1, ay1, az1]]
             // Take the most recent frame: [ax1, ay1, az1]
-            raw_sensor_data->mutable_accelerometer()->set_i(psmove_state->RawAccel[1][0]);
-            raw_sensor_data->mutable_accelerometer()->set_j(psmove_state->RawAccel[1][1]);
-            raw_sensor_data->mutable_accelerometer()->set_k(psmove_state->RawAccel[1][2]);
+            psmove_packet->raw_accelerometer.i= psmove_state->RawAccel[1][0];
+            psmove_packet->raw_accelerometer.j= psmove_state->RawAccel[1][1];
+            psmove_packet->raw_accelerometer.k= psmove_state->RawAccel[1][2];
 
-            // Two frames: [[wx0, wy0, wz0], [wx1, wy1, wz1]] 
+            // Two frames: [[wx0, wy0, wz0], [wx1, wy1, wz1]]
             // Take the most recent frame: [wx1, wy1, wz1]
-            raw_sensor_data->mutable_gyroscope()->set_i(psmove_state->RawGyro[1][0]);
-            raw_sensor_data->mutable_gyroscope()->set_j(psmove_state->RawGyro[1][1]);
-            raw_sensor_data->mutable_gyroscope()->set_k(psmove_state->RawGyro[1][2]);
+            psmove_packet->raw_gyroscope.i= psmove_state->RawGyro[1][0];
+            psmove_packet->raw_gyroscope.j= psmove_state->RawGyro[1][1];
+            psmove_packet->raw_gyroscope.k= psmove_state->RawGyro[1][2];
+
+            packet->flags|= CONTROLLER_STREAM_PACKET_FLAG_HAS_RAW_SENSOR_DATA;
         }
 
         // If requested, get the calibrated sensor data for the controller
         if (stream_info->include_calibrated_sensor_data)
         {
-            auto *calibrated_sensor_data = psmove_data_frame->mutable_calibrated_sensor_data();
+            // One frame: [mx, my, mz]
+            psmove_packet->calibrated_magnetometer.i= psmove_state->CalibratedMag[0];
+            psmove_packet->calibrated_magnetometer.j= psmove_state->CalibratedMag[1];
+            psmove_packet->calibrated_magnetometer.k= psmove_state->CalibratedMag[2];
 
-            // One frame: [mx, my, mz] 
-            calibrated_sensor_data->mutable_magnetometer()->set_i(psmove_state->CalibratedMag[0]);
-            calibrated_sensor_data->mutable_magnetometer()->set_j(psmove_state->CalibratedMag[1]);
-            calibrated_sensor_data->mutable_magnetometer()->set_k(psmove_state->CalibratedMag[2]);
-
-            // Two frames: [[ax0, ay0, az0], [ax1, ay1, az1]] 
+            // Two frames: [[ax0, ay0, az0], [ax1, ay1, az1]]
             // Take the most recent frame: [ax1, ay1, az1]
-            calibrated_sensor_data->mutable_accelerometer()->set_i(psmove_state->CalibratedAccel[1][0]);
-            calibrated_sensor_data->mutable_accelerometer()->set_j(psmove_state->CalibratedAccel[1][1]);
-            calibrated_sensor_data->mutable_accelerometer()->set_k(psmove_state->CalibratedAccel[1][2]);
+            psmove_packet->calibrated_accelerometer.i= psmove_state->CalibratedAccel[1][0];
+            psmove_packet->calibrated_accelerometer.j= psmove_state->CalibratedAccel[1][1];
+            psmove_packet->calibrated_accelerometer.k= psmove_state->CalibratedAccel[1][2];
 
-            // Two frames: [[wx0, wy0, wz0], [wx1, wy1, wz1]] 
+            // Two frames: [[wx0, wy0, wz0], [wx1, wy1, wz1]]
             // Take the most recent frame: [wx1, wy1, wz1]
-            calibrated_sensor_data->mutable_gyroscope()->set_i(psmove_state->CalibratedGyro[1][0]);
-            calibrated_sensor_data->mutable_gyroscope()->set_j(psmove_state->CalibratedGyro[1][1]);
-            calibrated_sensor_data->mutable_gyroscope()->set_k(psmove_state->CalibratedGyro[1][2]);
+            psmove_packet->calibrated_gyroscope.i= psmove_state->CalibratedGyro[1][0];
+            psmove_packet->calibrated_gyroscope.j= psmove_state->CalibratedGyro[1][1];
+            psmove_packet->calibrated_gyroscope.k= psmove_state->CalibratedGyro[1][2];
+
+            packet->flags|= CONTROLLER_STREAM_PACKET_FLAG_HAS_CALIBRATED_SENSOR_DATA;
         }
 
         // If requested, get the raw tracker data for the controller
         if (stream_info->include_raw_tracker_data)
         {
-            auto *raw_tracker_data = psmove_data_frame->mutable_raw_tracker_data();
-            int valid_tracker_count= 0;
-
-            for (int trackerId = 0; trackerId < TrackerManager::k_max_devices; ++trackerId)
-            {
-                const ControllerOpticalPoseEstimation *positionEstimate= 
-                    controller_view->getTrackerPoseEstimate(trackerId);
-
-                if (positionEstimate != nullptr && positionEstimate->bCurrentlyTracking)
-                {
-                    const CommonDevicePosition &trackerRelativePosition = positionEstimate->position_cm;
-                    const ServerTrackerViewPtr tracker_view = DeviceManager::getInstance()->getTrackerViewPtr(trackerId);
-
-                    // Project the 3d camera position back onto the tracker screen
-                    {
-                        const CommonDeviceScreenLocation trackerScreenLocation =
-                            tracker_view->projectTrackerRelativePosition(&trackerRelativePosition);
-                        PSMoveProtocol::Pixel *pixel = raw_tracker_data->add_screen_locations();
-
-                        pixel->set_x(trackerScreenLocation.x);
-                        pixel->set_y(trackerScreenLocation.y);
-                    }
-
-                    // Add the tracker relative 3d position
-                    {
-                        PSMoveProtocol::Position *position_cm= raw_tracker_data->add_relative_positions_cm();
-                        
-                        position_cm->set_x(trackerRelativePosition.x);
-                        position_cm->set_y(trackerRelativePosition.y);
-                        position_cm->set_z(trackerRelativePosition.z);
-                    }
-
-                    // Add the tracker relative projection shapes
-                    {
-                        const CommonDeviceTrackingProjection &trackerRelativeProjection = 
-                            positionEstimate->projection;
-
-                        assert(trackerRelativeProjection.shape_type == eCommonTrackingProjectionType::ProjectionType_Ellipse);
-                        PSMoveProtocol::Ellipse *ellipse= raw_tracker_data->add_projected_spheres();
-                                
-                        ellipse->mutable_center()->set_x(trackerRelativeProjection.shape.ellipse.center.x);
-                        ellipse->mutable_center()->set_y(trackerRelativeProjection.shape.ellipse.center.y);
-                        ellipse->set_half_x_extent(trackerRelativeProjection.shape.ellipse.half_x_extent);
-                        ellipse->set_half_y_extent(trackerRelativeProjection.shape.ellipse.half_y_extent);
-                        ellipse->set_angle(trackerRelativeProjection.shape.ellipse.angle);
-                    }
-
-                    raw_tracker_data->add_tracker_ids(trackerId);
-                    ++valid_tracker_count;
-                }
-            }
-
-			{
-				const ControllerOpticalPoseEstimation *poseEstimate = controller_view->getMulticamPoseEstimate();
-
-				if (poseEstimate->bCurrentlyTracking)
-				{
-					PSMoveProtocol::Position *position_cm = raw_tracker_data->mutable_multicam_position_cm();
-					position_cm->set_x(poseEstimate->position_cm.x);
-					position_cm->set_y(poseEstimate->position_cm.y);
-					position_cm->set_z(poseEstimate->position_cm.z);
-				}
-			}
+            generate_stream_packet_raw_tracker_data(controller_view, &psmove_packet->raw_tracker_data);
 
-            raw_tracker_data->set_valid_tracker_count(valid_tracker_count);
+            packet->flags|= CONTROLLER_STREAM_PACKET_FLAG_HAS_RAW_TRACKER_DATA;
         }
 
         // if requested, get the physics data for the controller
         if (stream_info->include_physics_data)
         {
-            const CommonDevicePhysics controller_physics = controller_view->getFilteredPhysics();
-            auto *physics_data = psmove_data_frame->mutable_physics_data();
-
-            physics_data->mutable_velocity_cm_per_sec()->set_i(controller_physics.VelocityCmPerSec.i);
-            physics_data->mutable_velocity_cm_per_sec()->set_j(controller_physics.VelocityCmPerSec.j);
-            physics_data->mutable_velocity_cm_per_sec()->set_k(controller_physics.VelocityCmPerSec.k);
-
-            physics_data->mutable_acceleration_cm_per_sec_sqr()->set_i(controller_physics.AccelerationCmPerSecSqr.i);
-            physics_data->mutable_acceleration_cm_per_sec_sqr()->set_j(controller_physics.AccelerationCmPerSecSqr.j);
-            physics_data->mutable_acceleration_cm_per_sec_sqr()->set_k(controller_physics.AccelerationCmPerSecSqr.k);
+            generate_stream_packet_physics_data(controller_view, &psmove_packet->physics_data);
 
-            physics_data->mutable_angular_velocity_rad_per_sec()->set_i(controller_physics.AngularVelocityRadPerSec.i);
-            physics_data->mutable_angular_velocity_rad_per_sec()->set_j(controller_physics.AngularVelocityRadPerSec.j);
-            physics_data->mutable_angular_velocity_rad_per_sec()->set_k(controller_physics.AngularVelocityRadPerSec.k);
-
-            physics_data->mutable_angular_acceleration_rad_per_sec_sqr()->set_i(controller_physics.AngularAccelerationRadPerSecSqr.i);
-            physics_data->mutable_angular_acceleration_rad_per_sec_sqr()->set_j(controller_physics.AngularAccelerationRadPerSecSqr.j);
-            physics_data->mutable_angular_acceleration_rad_per_sec_sqr()->set_k(controller_physics.AngularAccelerationRadPerSecSqr.k);
+            packet->flags|= CONTROLLER_STREAM_PACKET_FLAG_HAS_PHYSICS_DATA;
         }
-    }   
+    }
 
-    controller_data_frame->set_controller_type(PSMoveProtocol::PSMOVE);
+    packet->controller_type= ControllerStreamPacketControllerType_PSMove;
 }
 
-static void generate_psnavi_data_frame_for_stream(
+static void generate_psnavi_stream_packet(
     const ServerControllerView *controller_view,
     const ControllerStreamInfo *stream_info,
-    PSMoveProtocol::DeviceOutputDataFrame *data_frame)
+    ControllerStreamPacket *packet)
 {
-    PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket *controller_data_frame = data_frame->mutable_controller_data_packet();
-    PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_PSNaviState *psnavi_data_frame = controller_data_frame->mutable_psnavi_state();
+    ControllerStreamPacket_PSNaviState *psnavi_packet= &packet->state.psnavi;
 
     const CommonControllerState *controller_state= controller_view->getState();
 
@@ -1237,9 +2200,9 @@ static void generate_psnavi_data_frame_for_stream(
         assert(controller_state->DeviceType == CommonDeviceState::PSNavi);
         const PSNaviControllerState *psnavi_state= static_cast<const PSNaviControllerState *>(controller_state);
 
-        psnavi_data_frame->set_trigger_value(psnavi_state->Trigger);
-        psnavi_data_frame->set_stick_xaxis(psnavi_state->Stick_XAxis);
-        psnavi_data_frame->set_stick_yaxis(psnavi_state->Stick_YAxis);
+        psnavi_packet->trigger_value= psnavi_state->Trigger;
+        psnavi_packet->stick_xaxis= psnavi_state->Stick_XAxis;
+        psnavi_packet->stick_yaxis= psnavi_state->Stick_YAxis;
 
         unsigned int button_bitmask= 0;
         SET_BUTTON_BIT(button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket::L1, psnavi_state->L1);
@@ -1252,64 +2215,59 @@ static void generate_psnavi_data_frame_for_stream(
         SET_BUTTON_BIT(button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket::RIGHT, psnavi_state->DPad_Right);
         SET_BUTTON_BIT(button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket::DOWN, psnavi_state->DPad_Down);
         SET_BUTTON_BIT(button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket::LEFT, psnavi_state->DPad_Left);
-        controller_data_frame->set_button_down_bitmask(button_bitmask);
+        packet->button_down_bitmask= button_bitmask;
     }
 
-    controller_data_frame->set_controller_type(PSMoveProtocol::PSNAVI);
+    packet->controller_type= ControllerStreamPacketControllerType_PSNavi;
 }
 
-static void generate_psdualshock4_data_frame_for_stream(
+static void generate_psdualshock4_stream_packet(
     const ServerControllerView *controller_view,
     const ControllerStreamInfo *stream_info,
-    PSMoveProtocol::DeviceOutputDataFrame *data_frame)
+    ControllerStreamPacket *packet)
 {
     const PSDualShock4Controller *ds4_controller = controller_view->castCheckedConst<PSDualShock4Controller>();
     const IPoseFilter *pose_filter= controller_view->getPoseFilter();
     const PSDualShock4ControllerConfig *psmove_config = ds4_controller->getConfig();
     const CommonControllerState *controller_state = controller_view->getState();
-    const CommonDevicePose controller_pose = controller_view->getFilteredPose(psmove_config->prediction_time);
+    const CommonDevicePose controller_pose =
+        controller_view->getFilteredPose(
+            psmove_config->prediction_time + stream_info->smoothed_client_latency_seconds);
 
-    auto *controller_data_frame = data_frame->mutable_controller_data_packet();
-    auto *psds4_data_frame = controller_data_frame->mutable_psdualshock4_state();
+    ControllerStreamPacket_PSDualShock4State *psds4_packet= &packet->state.psdualshock4;
 
     if (controller_state != nullptr)
     {
         assert(controller_state->DeviceType == CommonDeviceState::PSDualShock4);
         const PSDualShock4ControllerState * psds4_state = static_cast<const PSDualShock4ControllerState *>(controller_state);
 
-        psds4_data_frame->set_validhardwarecalibration(psmove_config->is_valid);
-        psds4_data_frame->set_iscurrentlytracking(controller_view->getIsCurrentlyTracking());
-        psds4_data_frame->set_istrackingenabled(controller_view->getIsTrackingEnabled());
+        psds4_packet->bValidHardwareCalibration= psmove_config->is_valid;
+        psds4_packet->bIsCurrentlyTracking= controller_view->getIsCurrentlyTracking();
+        psds4_packet->bIsTrackingEnabled= controller_view->getIsTrackingEnabled();
 		//TODO: Collapse these two flags down into isPoseValid
-        psds4_data_frame->set_isorientationvalid(pose_filter->getIsStateValid());
-        psds4_data_frame->set_ispositionvalid(pose_filter->getIsStateValid());
+        psds4_packet->bIsOrientationValid= pose_filter->getIsStateValid();
+        psds4_packet->bIsPositionValid= pose_filter->getIsStateValid();
 
-        psds4_data_frame->mutable_orientation()->set_w(controller_pose.Orientation.w);
-        psds4_data_frame->mutable_orientation()->set_x(controller_pose.Orientation.x);
-        psds4_data_frame->mutable_orientation()->set_y(controller_pose.Orientation.y);
-        psds4_data_frame->mutable_orientation()->set_z(controller_pose.Orientation.z);
+        psds4_packet->orientation.w= controller_pose.Orientation.w;
+        psds4_packet->orientation.x= controller_pose.Orientation.x;
+        psds4_packet->orientation.y= controller_pose.Orientation.y;
+        psds4_packet->orientation.z= controller_pose.Orientation.z;
 
         if (stream_info->include_position_data)
         {
-            psds4_data_frame->mutable_position_cm()->set_x(controller_pose.PositionCm.x);
-            psds4_data_frame->mutable_position_cm()->set_y(controller_pose.PositionCm.y);
-            psds4_data_frame->mutable_position_cm()->set_z(controller_pose.PositionCm.z);
-        }
-        else
-        {
-            psds4_data_frame->mutable_position_cm()->set_x(0);
-            psds4_data_frame->mutable_position_cm()->set_y(0);
-            psds4_data_frame->mutable_position_cm()->set_z(0);
+            psds4_packet->position_cm.x= controller_pose.PositionCm.x;
+            psds4_packet->position_cm.y= controller_pose.PositionCm.y;
+            psds4_packet->position_cm.z= controller_pose.PositionCm.z;
         }
 
-        psds4_data_frame->set_left_thumbstick_x(psds4_state->LeftAnalogX);
-        psds4_data_frame->set_left_thumbstick_y(psds4_state->LeftAnalogY);
+        psds4_packet->left_thumbstick_x= psds4_state->LeftAnalogX;
+        psds4_packet->left_thumbstick_y= psds4_state->LeftAnalogY;
 
-        psds4_data_frame->set_right_thumbstick_x(psds4_state->RightAnalogX);
-        psds4_data_frame->set_right_thumbstick_y(psds4_state->RightAnalogY);
+        psds4_packet->right_thumbstick_x= psds4_state->RightAnalogX;
+        psds4_packet->right_thumbstick_y= psds4_state->RightAnalogY;
 
-        psds4_data_frame->set_left_trigger_value(psds4_state->LeftTrigger);
-        psds4_data_frame->set_right_trigger_value(psds4_state->RightTrigger);
+        psds4_packet->left_trigger_value= psds4_state->LeftTrigger;
+        psds4_packet->right_trigger_value= psds4_state->RightTrigger;
 
         unsigned int button_bitmask = 0;
         SET_BUTTON_BIT(button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket::UP, psds4_state->DPad_Up);
@@ -1334,164 +2292,54 @@ static void generate_psdualshock4_data_frame_for_stream(
 
         SET_BUTTON_BIT(button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket::PS, psds4_state->PS);
         SET_BUTTON_BIT(button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket::TRACKPAD, psds4_state->TrackPadButton);
-        controller_data_frame->set_button_down_bitmask(button_bitmask);
+        packet->button_down_bitmask= button_bitmask;
 
         // If requested, get the raw sensor data for the controller
         if (stream_info->include_raw_sensor_data)
         {
-            auto *raw_sensor_data = psds4_data_frame->mutable_raw_sensor_data();
+            psds4_packet->raw_accelerometer.i= psds4_state->RawAccelerometer[0];
+            psds4_packet->raw_accelerometer.j= psds4_state->RawAccelerometer[1];
+            psds4_packet->raw_accelerometer.k= psds4_state->RawAccelerometer[2];
 
-            raw_sensor_data->mutable_accelerometer()->set_i(psds4_state->RawAccelerometer[0]);
-            raw_sensor_data->mutable_accelerometer()->set_j(psds4_state->RawAccelerometer[1]);
-            raw_sensor_data->mutable_accelerometer()->set_k(psds4_state->RawAccelerometer[2]);
+            psds4_packet->raw_gyroscope.i= psds4_state->RawGyro[0];
+            psds4_packet->raw_gyroscope.j= psds4_state->RawGyro[1];
+            psds4_packet->raw_gyroscope.k= psds4_state->RawGyro[2];
 
-            raw_sensor_data->mutable_gyroscope()->set_i(psds4_state->RawGyro[0]);
-            raw_sensor_data->mutable_gyroscope()->set_j(psds4_state->RawGyro[1]);
-            raw_sensor_data->mutable_gyroscope()->set_k(psds4_state->RawGyro[2]);
+            packet->flags|= CONTROLLER_STREAM_PACKET_FLAG_HAS_RAW_SENSOR_DATA;
         }
 
         // If requested, get the calibrated sensor data for the controller
         if (stream_info->include_calibrated_sensor_data)
         {
-            auto *calibrated_sensor_data = psds4_data_frame->mutable_calibrated_sensor_data();
+            psds4_packet->calibrated_accelerometer.i= psds4_state->CalibratedAccelerometer.i;
+            psds4_packet->calibrated_accelerometer.j= psds4_state->CalibratedAccelerometer.j;
+            psds4_packet->calibrated_accelerometer.k= psds4_state->CalibratedAccelerometer.k;
 
-            calibrated_sensor_data->mutable_accelerometer()->set_i(psds4_state->CalibratedAccelerometer.i);
-            calibrated_sensor_data->mutable_accelerometer()->set_j(psds4_state->CalibratedAccelerometer.j);
-            calibrated_sensor_data->mutable_accelerometer()->set_k(psds4_state->CalibratedAccelerometer.k);
+            psds4_packet->calibrated_gyroscope.i= psds4_state->CalibratedGyro.i;
+            psds4_packet->calibrated_gyroscope.j= psds4_state->CalibratedGyro.j;
+            psds4_packet->calibrated_gyroscope.k= psds4_state->CalibratedGyro.k;
 
-            calibrated_sensor_data->mutable_gyroscope()->set_i(psds4_state->CalibratedGyro.i);
-            calibrated_sensor_data->mutable_gyroscope()->set_j(psds4_state->CalibratedGyro.j);
-            calibrated_sensor_data->mutable_gyroscope()->set_k(psds4_state->CalibratedGyro.k);
+            packet->flags|= CONTROLLER_STREAM_PACKET_FLAG_HAS_CALIBRATED_SENSOR_DATA;
         }
 
         // If requested, get the raw tracker data for the controller
         if (stream_info->include_raw_tracker_data)
         {
-            auto *raw_tracker_data = psds4_data_frame->mutable_raw_tracker_data();
-            int valid_tracker_count = 0;
-
-            for (int trackerId = 0; trackerId < TrackerManager::k_max_devices; ++trackerId)
-            {
-                const ControllerOpticalPoseEstimation *poseEstimate =
-                    controller_view->getTrackerPoseEstimate(trackerId);
-
-                if (poseEstimate != nullptr && poseEstimate->bCurrentlyTracking)
-                {
-                    const CommonDevicePosition &trackerRelativePosition = poseEstimate->position_cm;
-                    const CommonDeviceQuaternion &trackerRelativeOrientation = poseEstimate->orientation;
-                    const ServerTrackerViewPtr tracker_view = DeviceManager::getInstance()->getTrackerViewPtr(trackerId);
-
-                    // Add the tracker relative 3d pose
-                    {
-                        PSMoveProtocol::Position *position = raw_tracker_data->add_relative_positions_cm();
-                        PSMoveProtocol::Orientation *orientation = raw_tracker_data->add_relative_orientations();
-
-                        position->set_x(trackerRelativePosition.x);
-                        position->set_y(trackerRelativePosition.y);
-                        position->set_z(trackerRelativePosition.z);
-
-                        orientation->set_w(trackerRelativeOrientation.w);
-                        orientation->set_x(trackerRelativeOrientation.x);
-                        orientation->set_y(trackerRelativeOrientation.y);
-                        orientation->set_z(trackerRelativeOrientation.z);
-                    }
-
-                    // Add the tracker relative projection shapes
-					{
-						const CommonDeviceTrackingProjection &trackerRelativeProjection =
-							poseEstimate->projection;
-
-						assert(trackerRelativeProjection.shape_type == eCommonTrackingProjectionType::ProjectionType_LightBar);
-						PSMoveProtocol::Polygon *polygon = raw_tracker_data->add_projected_blobs();
-
-						for (int vert_index = 0; vert_index < 3; ++vert_index)
-						{
-							PSMoveProtocol::Pixel *pixel = polygon->add_vertices();
-
-							pixel->set_x(trackerRelativeProjection.shape.lightbar.triangle[vert_index].x);
-							pixel->set_y(trackerRelativeProjection.shape.lightbar.triangle[vert_index].y);
-						}
-
-						CommonDeviceScreenLocation center_pixel;
-						center_pixel.clear();
-
-						for (int vert_index = 0; vert_index < 4; ++vert_index)
-						{
-							const CommonDeviceScreenLocation &screenLocation= trackerRelativeProjection.shape.lightbar.quad[vert_index];
-							PSMoveProtocol::Pixel *pixel = polygon->add_vertices();
+            generate_stream_packet_raw_tracker_data(controller_view, &psds4_packet->raw_tracker_data);
 
-							pixel->set_x(screenLocation.x);
-							pixel->set_y(screenLocation.y);
-
-							center_pixel.x += screenLocation.x;
-							center_pixel.y += screenLocation.y;
-						}
-
-						center_pixel.x /= 4.f;
-						center_pixel.y /= 4.f;
-
-						{
-							PSMoveProtocol::Pixel *pixel = raw_tracker_data->add_screen_locations();
-
-							pixel->set_x(center_pixel.x);
-							pixel->set_y(center_pixel.y);
-						}
-                    }
-
-                    raw_tracker_data->add_tracker_ids(trackerId);
-                    ++valid_tracker_count;
-                }
-            }
-
-			{
-				const ControllerOpticalPoseEstimation *poseEstimate = controller_view->getMulticamPoseEstimate();
-
-				if (poseEstimate->bCurrentlyTracking)
-				{
-					PSMoveProtocol::Position *position = raw_tracker_data->mutable_multicam_position_cm();
-					position->set_x(poseEstimate->position_cm.x);
-					position->set_y(poseEstimate->position_cm.y);
-					position->set_z(poseEstimate->position_cm.z);
-
-					if (poseEstimate->bOrientationValid)
-					{
-						PSMoveProtocol::Orientation *orientation = raw_tracker_data->mutable_multicam_orientation();
-						orientation->set_w(poseEstimate->orientation.w);
-						orientation->set_x(poseEstimate->orientation.x);
-						orientation->set_y(poseEstimate->orientation.y);
-						orientation->set_z(poseEstimate->orientation.z);
-					}
-				}
-			}
-
-            raw_tracker_data->set_valid_tracker_count(valid_tracker_count);
+            packet->flags|= CONTROLLER_STREAM_PACKET_FLAG_HAS_RAW_TRACKER_DATA;
         }
 
         // if requested, get the physics data for the controller
         if (stream_info->include_physics_data)
         {
-            const CommonDevicePhysics controller_physics = controller_view->getFilteredPhysics();
-            auto *physics_data = psds4_data_frame->mutable_physics_data();
-
-            physics_data->mutable_velocity_cm_per_sec()->set_i(controller_physics.VelocityCmPerSec.i);
-            physics_data->mutable_velocity_cm_per_sec()->set_j(controller_physics.VelocityCmPerSec.j);
-            physics_data->mutable_velocity_cm_per_sec()->set_k(controller_physics.VelocityCmPerSec.k);
+            generate_stream_packet_physics_data(controller_view, &psds4_packet->physics_data);
 
-            physics_data->mutable_acceleration_cm_per_sec_sqr()->set_i(controller_physics.AccelerationCmPerSecSqr.i);
-            physics_data->mutable_acceleration_cm_per_sec_sqr()->set_j(controller_physics.AccelerationCmPerSecSqr.j);
-            physics_data->mutable_acceleration_cm_per_sec_sqr()->set_k(controller_physics.AccelerationCmPerSecSqr.k);
-
-            physics_data->mutable_angular_velocity_rad_per_sec()->set_i(controller_physics.AngularVelocityRadPerSec.i);
-            physics_data->mutable_angular_velocity_rad_per_sec()->set_j(controller_physics.AngularVelocityRadPerSec.j);
-            physics_data->mutable_angular_velocity_rad_per_sec()->set_k(controller_physics.AngularVelocityRadPerSec.k);
-
-            physics_data->mutable_angular_acceleration_rad_per_sec_sqr()->set_i(controller_physics.AngularAccelerationRadPerSecSqr.i);
-            physics_data->mutable_angular_acceleration_rad_per_sec_sqr()->set_j(controller_physics.AngularAccelerationRadPerSecSqr.j);
-            physics_data->mutable_angular_acceleration_rad_per_sec_sqr()->set_k(controller_physics.AngularAccelerationRadPerSecSqr.k);
+            packet->flags|= CONTROLLER_STREAM_PACKET_FLAG_HAS_PHYSICS_DATA;
         }
     }
 
-    controller_data_frame->set_controller_type(PSMoveProtocol::PSDUALSHOCK4);
+    packet->controller_type= ControllerStreamPacketControllerType_PSDualShock4;
 }
 
 static IPoseFilter *
@@ -1551,6 +2399,10 @@ pose_filter_factory(
 		{
 			position_filter_enum= PositionFilterTypeKalman;
 		}
+		else if (position_filter_type == "OneEuro")
+		{
+			position_filter_enum= PositionFilterTypeOneEuro;
+		}
 		else
 		{
 			SERVER_LOG_INFO("pose_filter_factory()") << 
@@ -1596,6 +2448,10 @@ pose_filter_factory(
 		{
 			orientation_filter_enum = OrientationFilterTypeKalman;
 		}
+		else if (orientation_filter_type == "OneEuroOptical")
+		{
+			orientation_filter_enum= OrientationFilterTypeOneEuroOptical;
+		}
 		else
 		{
 			SERVER_LOG_INFO("pose_filter_factory()") << 
@@ -1615,7 +2471,7 @@ pose_filter_factory(
 			}
 		}
 
-		CompoundPoseFilter *compound_pose_filter = new CompoundPoseFilter();
+		CompoundPoseFilter *compound_pose_filter = allocate_compound_pose_filter(orientation_filter_enum, position_filter_enum);
 		compound_pose_filter->init(deviceType, orientation_filter_enum, position_filter_enum, constants);
 		filter= compound_pose_filter;
 	}
@@ -1660,6 +2516,7 @@ init_filters_for_psmove(
 	constants.orientation_constants.orientation_variance_curve.A = psmove_config->orientation_variance;
 	constants.orientation_constants.orientation_variance_curve.B = 0.f;
 	constants.orientation_constants.orientation_variance_curve.MaxValue = psmove_config->orientation_variance;
+	constants.orientation_constants.orientation_variance_curve.buildLUT();
 	constants.orientation_constants.magnetometer_variance= 
 		Eigen::Vector3f(psmove_config->magnetometer_variance, psmove_config->magnetometer_variance, psmove_config->magnetometer_variance);
 	constants.orientation_constants.magnetometer_drift = Eigen::Vector3f::Zero();
@@ -1674,6 +2531,7 @@ init_filters_for_psmove(
 	constants.position_constants.position_variance_curve.A = psmove_config->position_variance_exp_fit_a;
 	constants.position_constants.position_variance_curve.B = psmove_config->position_variance_exp_fit_b;
 	constants.position_constants.position_variance_curve.MaxValue = 1.f;
+	constants.position_constants.position_variance_curve.buildLUT();
 
 	*out_pose_filter_space= pose_filter_space;
 	*out_pose_filter= pose_filter_factory(
@@ -1683,42 +2541,24 @@ init_filters_for_psmove(
 		constants);
 }
 
-static void                
+static void
 update_filters_for_psmove(
-    const PSMoveController *psmoveController, 
+    const PSMoveController *psmoveController,
     const PSMoveControllerState *psmoveState,
     const float delta_time,
     const ControllerOpticalPoseEstimation *poseEstimation,
 	const PoseFilterSpace *poseFilterSpace,
-    IPoseFilter *poseFilter)
+    IPoseFilter *poseFilter,
+	PoseSensorPacketQueue &imuPacketQueue,
+	const bool bIsFinalStateThisTick)
 {
     const PSMoveControllerConfig *config = psmoveController->getConfig();
-    Eigen::Quaternionf orientationFrames[2] = {Eigen::Quaternionf::Identity(), Eigen::Quaternionf::Identity()};
 
     // Update the orientation filter
     if (poseFilter != nullptr)
     {
         PoseSensorPacket sensorPacket;
 
-		// PSMove cant do optical orientation
-        sensorPacket.optical_orientation = Eigen::Quaternionf::Identity();
-
-		// PSMove does have an optical position
-		if (poseEstimation->bCurrentlyTracking)
-		{
-			sensorPacket.optical_position_cm =
-				Eigen::Vector3f(
-					poseEstimation->position_cm.x,
-					poseEstimation->position_cm.y,
-					poseEstimation->position_cm.z);
-			sensorPacket.tracking_projection_area_px_sqr = poseEstimation->projection.screen_area;
-		}
-		else
-		{
-			sensorPacket.optical_position_cm = Eigen::Vector3f::Zero();
-			sensorPacket.tracking_projection_area_px_sqr= 0.f;
-		}
-
 		// One magnetometer update for every two accel/gryo readings
         sensorPacket.imu_magnetometer_unit =
             Eigen::Vector3f(
@@ -1729,27 +2569,53 @@ update_filters_for_psmove(
         // Each state update contains two readings (one earlier and one later) of accelerometer and gyro data
         for (int frame = 0; frame < 2; ++frame)
         {
-			PoseFilterPacket filterPacket;
-			
             sensorPacket.imu_accelerometer_g_units =
                 Eigen::Vector3f(
-                    psmoveState->CalibratedAccel[frame][0], 
-                    psmoveState->CalibratedAccel[frame][1], 
+                    psmoveState->CalibratedAccel[frame][0],
+                    psmoveState->CalibratedAccel[frame][1],
                     psmoveState->CalibratedAccel[frame][2]);
             sensorPacket.imu_gyroscope_rad_per_sec =
                 Eigen::Vector3f(
-                    psmoveState->CalibratedGyro[frame][0], 
-                    psmoveState->CalibratedGyro[frame][1], 
+                    psmoveState->CalibratedGyro[frame][0],
+                    psmoveState->CalibratedGyro[frame][1],
                     psmoveState->CalibratedGyro[frame][2]);
 
-			// Create a filter input packet from the sensor data 
-			// and the filter's previous orientation and position
-			poseFilterSpace->createFilterPacket(
-				sensorPacket, 
-				poseFilter,
-				filterPacket);
+			// Queue the IMU sample - the whole batch gets integrated in one
+			// filter update when the final state of the tick comes through
+			imuPacketQueue.enqueueImuSample(sensorPacket, delta_time / 2.f);
+        }
+
+        if (bIsFinalStateThisTick)
+        {
+			PoseSensorPacket blendedPacket;
+			const float batched_delta_time = imuPacketQueue.dequeueBlendedSample(blendedPacket);
+
+			// PSMove cant do optical orientation
+			blendedPacket.optical_orientation = Eigen::Quaternionf::Identity();
+
+			// PSMove does have an optical position
+			if (poseEstimation->bCurrentlyTracking)
+			{
+				blendedPacket.optical_position_cm =
+					Eigen::Vector3f(
+						poseEstimation->position_cm.x,
+						poseEstimation->position_cm.y,
+						poseEstimation->position_cm.z);
+				blendedPacket.tracking_projection_area_px_sqr = poseEstimation->projection.screen_area;
+			}
+			else
+			{
+				blendedPacket.optical_position_cm = Eigen::Vector3f::Zero();
+				blendedPacket.tracking_projection_area_px_sqr= 0.f;
+			}
+
+			// Create a filter input packet from the sensor data
+			// and the filter's previous orientation and position,
+			// written into the filter space's preallocated workspace
+			const PoseFilterPacket &filterPacket=
+				poseFilterSpace->createFilterPacket(blendedPacket, poseFilter);
 
-            poseFilter->update(delta_time / 2.f, filterPacket);
+            poseFilter->update(batched_delta_time, filterPacket);
         }
     }
 }
@@ -1791,6 +2657,7 @@ init_filters_for_psdualshock4(
 	constants.orientation_constants.orientation_variance_curve.A = ds4_config->orientation_variance_exp_fit_a;
 	constants.orientation_constants.orientation_variance_curve.B = ds4_config->orientation_variance_exp_fit_b;
 	constants.orientation_constants.orientation_variance_curve.MaxValue = 1.f;
+	constants.orientation_constants.orientation_variance_curve.buildLUT();
 
 	constants.position_constants.gravity_calibration_direction= pose_filter_space->getGravityCalibrationDirection();
 	constants.position_constants.accelerometer_drift = Eigen::Vector3f::Zero();
@@ -1802,6 +2669,7 @@ init_filters_for_psdualshock4(
 	constants.position_constants.position_variance_curve.A = ds4_config->position_variance_exp_fit_a;
 	constants.position_constants.position_variance_curve.B = ds4_config->position_variance_exp_fit_b;
 	constants.position_constants.position_variance_curve.MaxValue = 1.f;
+	constants.position_constants.position_variance_curve.buildLUT();
 
 	*out_pose_filter_space= pose_filter_space;
 	*out_pose_filter= pose_filter_factory(
@@ -1818,7 +2686,9 @@ update_filters_for_psdualshock4(
     const float delta_time,
     const ControllerOpticalPoseEstimation *poseEstimation,
 	const PoseFilterSpace *poseFilterSpace,
-    IPoseFilter *poseFilter)
+    IPoseFilter *poseFilter,
+	PoseSensorPacketQueue &imuPacketQueue,
+	const bool bIsFinalStateThisTick)
 {
     const PSDualShock4ControllerConfig *config = psmoveController->getConfig();
 
@@ -1826,39 +2696,6 @@ update_filters_for_psdualshock4(
     {
         PoseSensorPacket sensorPacket;
 
-        if (poseEstimation->bOrientationValid)
-        {
-            sensorPacket.optical_orientation = 
-                Eigen::Quaternionf(
-                    poseEstimation->orientation.w, 
-                    poseEstimation->orientation.x,
-                    poseEstimation->orientation.y,
-                    poseEstimation->orientation.z);
-        }
-        else
-        {
-            sensorPacket.optical_orientation = Eigen::Quaternionf::Identity();
-        }
-
-        if (poseEstimation->bCurrentlyTracking)
-        {
-			const float screen_area =
-				(poseEstimation->projection.screen_area > config->min_screen_projection_area)
-				? poseEstimation->projection.screen_area : 0.f;
-
-            sensorPacket.optical_position_cm =
-                Eigen::Vector3f(
-                    poseEstimation->position_cm.x,
-                    poseEstimation->position_cm.y,
-                    poseEstimation->position_cm.z);
-            sensorPacket.tracking_projection_area_px_sqr= screen_area;
-        }
-        else
-        {
-            sensorPacket.optical_position_cm = Eigen::Vector3f::Zero();
-            sensorPacket.tracking_projection_area_px_sqr = 0.f;
-        }
-
         sensorPacket.imu_accelerometer_g_units =
             Eigen::Vector3f(
                 psdualShock4State->CalibratedAccelerometer.i,
@@ -1871,17 +2708,55 @@ update_filters_for_psdualshock4(
                 psdualShock4State->CalibratedGyro.k);
 		sensorPacket.imu_magnetometer_unit = Eigen::Vector3f::Zero();
 
+		// Queue the IMU sample - the whole batch gets integrated in one
+		// filter update when the final state of the tick comes through
+		imuPacketQueue.enqueueImuSample(sensorPacket, delta_time);
+
+        if (bIsFinalStateThisTick)
         {
-            PoseFilterPacket filterPacket;
+			PoseSensorPacket blendedPacket;
+			const float batched_delta_time = imuPacketQueue.dequeueBlendedSample(blendedPacket);
+
+			if (poseEstimation->bOrientationValid)
+			{
+				blendedPacket.optical_orientation =
+					Eigen::Quaternionf(
+						poseEstimation->orientation.w,
+						poseEstimation->orientation.x,
+						poseEstimation->orientation.y,
+						poseEstimation->orientation.z);
+			}
+			else
+			{
+				blendedPacket.optical_orientation = Eigen::Quaternionf::Identity();
+			}
+
+			if (poseEstimation->bCurrentlyTracking)
+			{
+				const float screen_area =
+					(poseEstimation->projection.screen_area > config->min_screen_projection_area)
+					? poseEstimation->projection.screen_area : 0.f;
+
+				blendedPacket.optical_position_cm =
+					Eigen::Vector3f(
+						poseEstimation->position_cm.x,
+						poseEstimation->position_cm.y,
+						poseEstimation->position_cm.z);
+				blendedPacket.tracking_projection_area_px_sqr= screen_area;
+			}
+			else
+			{
+				blendedPacket.optical_position_cm = Eigen::Vector3f::Zero();
+				blendedPacket.tracking_projection_area_px_sqr = 0.f;
+			}
 
-			// Create a filter input packet from the sensor data 
-			// and the filter's previous orientation and position
-			poseFilterSpace->createFilterPacket(
-				sensorPacket, 
-				poseFilter,
-				filterPacket);
+			// Create a filter input packet from the sensor data
+			// and the filter's previous orientation and position,
+			// written into the filter space's preallocated workspace
+			const PoseFilterPacket &filterPacket=
+				poseFilterSpace->createFilterPacket(blendedPacket, poseFilter);
 
-            poseFilter->update(delta_time, filterPacket);
+            poseFilter->update(batched_delta_time, filterPacket);
         }
     }
 }
@@ -1911,18 +2786,33 @@ static void computeLightBarPoseForControllerFromSingleTracker(
 	ControllerOpticalPoseEstimation *tracker_pose_estimation,
 	ControllerOpticalPoseEstimation *multicam_pose_estimation)
 {
-	CommonDeviceTrackingShape tracking_shape;
-	controllerView->getTrackingShape(tracking_shape);
+	// The lightbar corner geometry is static while the device is open,
+	// so use the view's open-time cache rather than re-querying the device
+	const CommonDeviceTrackingShape *tracking_shape = controllerView->getCachedTrackingShape();
+
+	// Use the previous pose as a guess to the current pose.
+	// If there is no previous optical pose yet (first frame, reacquisition),
+	// seed the guess from the filter pose mapped into tracker space so the
+	// iterative solve still starts near the answer.
+	bool bPoseGuessValid = tracker_pose_estimation->bOrientationValid;
+	CommonDevicePose poseGuess = { tracker_pose_estimation->position_cm, tracker_pose_estimation->orientation };
+
+	if (!bPoseGuessValid &&
+		controllerView->getPoseFilter() != nullptr &&
+		controllerView->getPoseFilter()->getIsStateValid())
+	{
+		const CommonDevicePose filterPose = controllerView->getFilteredPose();
 
-	// Use the previous pose as a guess to the current pose
-	const bool bPreviousPoseValid = tracker_pose_estimation->bOrientationValid;
-	const CommonDevicePose poseGuess = { tracker_pose_estimation->position_cm, tracker_pose_estimation->orientation };
+		poseGuess.PositionCm = tracker->computeTrackerPosition(&filterPose.PositionCm);
+		poseGuess.Orientation = tracker->computeTrackerOrientation(&filterPose.Orientation);
+		bPoseGuessValid = true;
+	}
 
 	// Compute a tracker relative position from the projection
 	if (tracker->computePoseForProjection(
 			&tracker_pose_estimation->projection,
-			&tracking_shape,
-			bPreviousPoseValid ? &poseGuess : nullptr,
+			tracking_shape,
+			bPoseGuessValid ? &poseGuess : nullptr,
 			tracker_pose_estimation))
 	{
 		// If available, put the tracker relative orientation into world space
@@ -1958,40 +2848,55 @@ static void computeSpherePoseForControllerFromMultipleTrackers(
 	ControllerOpticalPoseEstimation *tracker_pose_estimations,
 	ControllerOpticalPoseEstimation *multicam_pose_estimation)
 {
-	const TrackerManagerConfig &cfg = tracker_manager->getConfig();
+	// One snapshot fetch covers the whole multi-camera estimate - the values
+	// read below stay mutually consistent even if the config is republished
+	const std::shared_ptr<const TrackerManager::ConfigSnapshot> configSnapshot =
+		tracker_manager->getConfigSnapshot();
+	const TrackerManagerConfig &cfg = configSnapshot->config;
 	float screen_area_sum = 0;
 
-	// Project the tracker relative 3d tracking position back on to the tracker camera plane
-	// and sum up the total controller projection area across all trackers
-	CommonDeviceScreenLocation position2d_list[TrackerManager::k_max_devices];
+	// Make sure every projection has an up to date cached world space ray
+	// and sum up the total controller projection area across all trackers.
+	// Rays were already refreshed for trackers with a new observation this
+	// tick, so with staggered captures this is a no-op for most trackers.
 	for (int list_index = 0; list_index < projections_found; ++list_index)
 	{
 		const int tracker_id = valid_projection_tracker_ids[list_index];
-		const ServerTrackerViewPtr tracker = tracker_manager->getTrackerViewPtr(tracker_id);
-		const ControllerOpticalPoseEstimation &poseEstimate = tracker_pose_estimations[tracker_id];
+		ControllerOpticalPoseEstimation &poseEstimate = tracker_pose_estimations[tracker_id];
+
+		if (!poseEstimate.bWorldRayValid)
+		{
+			updateCachedWorldRayForPoseEstimate(
+				tracker_manager->getTrackerViewPtr(tracker_id), poseEstimate);
+		}
 
-		position2d_list[list_index] = tracker->projectTrackerRelativePosition(&poseEstimate.position_cm);
 		screen_area_sum += poseEstimate.projection.screen_area;
 	}
 
-	// Compute triangulations amongst all pairs of projections
-	int pair_count = 0;
+	// Decide which trackers participate in the triangulation.
+	// With opposed camera exclusion enabled a tracker only participates if it
+	// pairs with at least one non-opposed tracker (the same pair test the old
+	// pairwise triangulation used to skip mirror-image projections).
+	bool tracker_participates[TrackerManager::k_max_devices];
 	int biggest_prjection_id = -1;
-	CommonDevicePosition average_world_position = { 0.f, 0.f, 0.f };
-	for (int list_index = 0; list_index < projections_found; ++list_index)
+	if (cfg.exclude_opposed_cameras)
 	{
-		const int tracker_id = valid_projection_tracker_ids[list_index];
-		const CommonDeviceScreenLocation &screen_location = position2d_list[list_index];
-		const ServerTrackerViewPtr tracker = tracker_manager->getTrackerViewPtr(tracker_id);
+		for (int list_index = 0; list_index < projections_found; ++list_index)
+		{
+			tracker_participates[list_index] = false;
+		}
 
-		for (int other_list_index = list_index + 1; other_list_index < projections_found; ++other_list_index)
+		for (int list_index = 0; list_index < projections_found; ++list_index)
 		{
-			const int other_tracker_id = valid_projection_tracker_ids[other_list_index];
-			const CommonDeviceScreenLocation &other_screen_location = position2d_list[other_list_index];
-			const ServerTrackerViewPtr other_tracker = tracker_manager->getTrackerViewPtr(other_tracker_id);
-			// if trackers are on poposite sides
-			if (cfg.exclude_opposed_cameras)
+			const int tracker_id = valid_projection_tracker_ids[list_index];
+			const ServerTrackerViewPtr tracker = tracker_manager->getTrackerViewPtr(tracker_id);
+
+			for (int other_list_index = list_index + 1; other_list_index < projections_found; ++other_list_index)
 			{
+				const int other_tracker_id = valid_projection_tracker_ids[other_list_index];
+				const ServerTrackerViewPtr other_tracker = tracker_manager->getTrackerViewPtr(other_tracker_id);
+
+				// if trackers are on poposite sides
 				if ((tracker->getTrackerPose().PositionCm.x > 0) == (other_tracker->getTrackerPose().PositionCm.x < 0) &&
 					(tracker->getTrackerPose().PositionCm.z > 0) == (other_tracker->getTrackerPose().PositionCm.z < 0))
 				{
@@ -1999,26 +2904,55 @@ static void computeSpherePoseForControllerFromMultipleTrackers(
 					float other_screen_area = tracker_pose_estimations[other_tracker_id].projection.screen_area;
 
 					biggest_prjection_id = screen_area > other_screen_area ? tracker_id : other_tracker_id;
-
-					continue;
+				}
+				else
+				{
+					tracker_participates[list_index] = true;
+					tracker_participates[other_list_index] = true;
 				}
 			}
+		}
+	}
+	else
+	{
+		for (int list_index = 0; list_index < projections_found; ++list_index)
+		{
+			tracker_participates[list_index] = true;
+		}
+	}
 
-			// Using the screen locations on two different trackers we can triangulate a world position
-			CommonDevicePosition world_position =
-				ServerTrackerView::triangulateWorldPosition(
-					tracker.get(), &screen_location,
-					other_tracker.get(), &other_screen_location);
-
-			average_world_position.x += world_position.x;
-			average_world_position.y += world_position.y;
-			average_world_position.z += world_position.z;
-
-			++pair_count;
+	// Gather the participating world rays into contiguous arrays and compute
+	// the least squares intersection of all of them in one 3x3 linear solve,
+	// rather than averaging pairwise closest points.
+	Eigen::Vector3f ray_origins[TrackerManager::k_max_devices];
+	Eigen::Vector3f ray_directions[TrackerManager::k_max_devices];
+	int ray_count = 0;
+	for (int list_index = 0; list_index < projections_found; ++list_index)
+	{
+		if (tracker_participates[list_index])
+		{
+			const int tracker_id = valid_projection_tracker_ids[list_index];
+			const ControllerOpticalPoseEstimation &poseEstimate = tracker_pose_estimations[tracker_id];
+
+			ray_origins[ray_count] = Eigen::Vector3f(
+				poseEstimate.world_ray_origin_cm.x,
+				poseEstimate.world_ray_origin_cm.y,
+				poseEstimate.world_ray_origin_cm.z);
+			ray_directions[ray_count] = Eigen::Vector3f(
+				poseEstimate.world_ray_direction.i,
+				poseEstimate.world_ray_direction.j,
+				poseEstimate.world_ray_direction.k);
+			++ray_count;
 		}
 	}
 
-	if (pair_count == 0 && biggest_prjection_id >= 0 && !DeviceManager::getInstance()->m_tracker_manager->getConfig().ignore_pose_from_one_tracker)
+	Eigen::Vector3f triangulated_point;
+	const bool bTriangulated =
+		ray_count >= 2 &&
+		eigen_alignment_compute_point_closest_to_rays(
+			ray_origins, ray_directions, ray_count, &triangulated_point);
+
+	if (!bTriangulated && biggest_prjection_id >= 0 && !DeviceManager::getInstance()->m_tracker_manager->getConfigSnapshot()->config.ignore_pose_from_one_tracker)
 	{
 		// Position not triangulated from opposed camera, estimate from one tracker only.
 
@@ -2026,19 +2960,14 @@ static void computeSpherePoseForControllerFromMultipleTrackers(
 			controllerView,
 			tracker_manager->getTrackerViewPtr(biggest_prjection_id),
 			&tracker_pose_estimations[biggest_prjection_id],
-			multicam_pose_estimation);		
+			multicam_pose_estimation);
 	}
-	else if(pair_count > 0)
+	else if (bTriangulated)
 	{
-		// Compute the average position
-		const float N = static_cast<float>(pair_count);
-
-		average_world_position.x /= N;
-		average_world_position.y /= N;
-		average_world_position.z /= N;
-
-		// Store the averaged tracking position
-		multicam_pose_estimation->position_cm = average_world_position;
+		// Store the triangulated tracking position
+		multicam_pose_estimation->position_cm.x = triangulated_point.x();
+		multicam_pose_estimation->position_cm.y = triangulated_point.y();
+		multicam_pose_estimation->position_cm.z = triangulated_point.z();
 
 		multicam_pose_estimation->bCurrentlyTracking = true;
 	}
@@ -2152,3 +3081,148 @@ static void computeLightBarPoseForControllerFromMultipleTrackers(
 	multicam_pose_estimation->projection.screen_area =
 		screen_area_sum / static_cast<float>(projections_found);
 }
+
+static void updateCachedWorldRayForPoseEstimate(
+	const ServerTrackerViewPtr tracker,
+	ControllerOpticalPoseEstimation &tracker_pose_estimation)
+{
+	// The ray from the tracker through the observed projection center is fully
+	// determined by the tracker relative 3d position estimate, so there is no
+	// need to reproject back on to the camera plane and raycast again
+	const CommonDevicePosition world_position =
+		tracker->computeWorldPosition(&tracker_pose_estimation.position_cm);
+	const CommonDevicePosition tracker_position = tracker->getTrackerPose().PositionCm;
+
+	const float dx = world_position.x - tracker_position.x;
+	const float dy = world_position.y - tracker_position.y;
+	const float dz = world_position.z - tracker_position.z;
+	const float length = sqrtf(dx*dx + dy*dy + dz*dz);
+
+	if (length > k_real_epsilon)
+	{
+		tracker_pose_estimation.world_ray_origin_cm = tracker_position;
+		tracker_pose_estimation.world_ray_direction.set(dx / length, dy / length, dz / length);
+		tracker_pose_estimation.bWorldRayValid = true;
+	}
+	else
+	{
+		// Degenerate observation on top of the tracker
+		tracker_pose_estimation.bWorldRayValid = false;
+	}
+}
+
+static void mergeRemoteShardObservationsForController(
+	const TrackerShardExchange *shard_exchange,
+	const int controller_id,
+	const std::chrono::time_point<std::chrono::high_resolution_clock> &now,
+	ControllerOpticalPoseEstimation *multicam_pose_estimation)
+{
+	const float timeoutMilli =
+		static_cast<float>(DeviceManager::getInstance()->m_tracker_manager->getConfigSnapshot()->config.optical_tracking_timeout);
+	const unsigned long long now_us =
+		static_cast<unsigned long long>(
+			std::chrono::duration_cast<std::chrono::microseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()).count());
+
+	const bool bLocallyTracking = multicam_pose_estimation->bCurrentlyTracking;
+
+	// Blend the local estimate with every fresh remote one, weighted by
+	// projection screen area - the same visibility weight the multicam
+	// triangulation uses to judge tracking quality
+	Eigen::Vector3f blended_position = Eigen::Vector3f::Zero();
+	float weight_sum = 0.f;
+	float screen_area_sum = 0.f;
+	int estimate_count = 0;
+
+	if (bLocallyTracking)
+	{
+		const float local_weight = fmaxf(multicam_pose_estimation->projection.screen_area, 1.f);
+
+		blended_position += local_weight * Eigen::Vector3f(
+			multicam_pose_estimation->position_cm.x,
+			multicam_pose_estimation->position_cm.y,
+			multicam_pose_estimation->position_cm.z);
+		weight_sum += local_weight;
+		screen_area_sum += multicam_pose_estimation->projection.screen_area;
+		++estimate_count;
+	}
+
+	CommonDeviceQuaternion best_remote_orientation;
+	best_remote_orientation.clear();
+	float best_remote_orientation_weight = 0.f;
+	unsigned long long newest_remote_capture_us = 0;
+
+	// Shard 0 is us - only the secondary shards publish observations
+	for (int shard_index = 1; shard_index < shard_exchange->getShardCount(); ++shard_index)
+	{
+		TrackerShardObservation observation;
+
+		if (!shard_exchange->readControllerObservation(shard_index, controller_id, observation) ||
+			!observation.bCurrentlyTracking ||
+			observation.capture_timestamp_us == 0 ||
+			observation.capture_timestamp_us > now_us)
+		{
+			continue;
+		}
+
+		// Ignore remote observations older than the optical tracking timeout
+		const float age_milli = static_cast<float>(now_us - observation.capture_timestamp_us) / 1000.f;
+		if (age_milli >= timeoutMilli)
+		{
+			continue;
+		}
+
+		const float remote_weight = fmaxf(observation.screen_area, 1.f);
+
+		blended_position += remote_weight * Eigen::Vector3f(
+			observation.position_cm.x,
+			observation.position_cm.y,
+			observation.position_cm.z);
+		weight_sum += remote_weight;
+		screen_area_sum += observation.screen_area;
+		++estimate_count;
+
+		if (observation.bOrientationValid && remote_weight > best_remote_orientation_weight)
+		{
+			best_remote_orientation = observation.orientation;
+			best_remote_orientation_weight = remote_weight;
+		}
+
+		if (observation.capture_timestamp_us > newest_remote_capture_us)
+		{
+			newest_remote_capture_us = observation.capture_timestamp_us;
+		}
+	}
+
+	// Nothing fresh came in from the other shards this tick
+	if (newest_remote_capture_us == 0)
+	{
+		return;
+	}
+
+	const Eigen::Vector3f merged_position = blended_position / weight_sum;
+
+	multicam_pose_estimation->position_cm.set(
+		merged_position.x(), merged_position.y(), merged_position.z());
+	multicam_pose_estimation->projection.screen_area =
+		screen_area_sum / static_cast<float>(estimate_count);
+	multicam_pose_estimation->bCurrentlyTracking = true;
+
+	// Keep the local orientation when there is one; otherwise adopt the
+	// best remote one (lightbars only - sphere projections never carry one)
+	if (!multicam_pose_estimation->bOrientationValid && best_remote_orientation_weight > 0.f)
+	{
+		multicam_pose_estimation->orientation = best_remote_orientation;
+		multicam_pose_estimation->bOrientationValid = true;
+	}
+
+	// Age the newest remote capture back into the visibility timestamp so
+	// the estimate is only as old as the newest frame that went into it
+	const std::chrono::time_point<std::chrono::high_resolution_clock> remote_visible_timestamp =
+		now - std::chrono::microseconds(now_us - newest_remote_capture_us);
+
+	if (!bLocallyTracking || remote_visible_timestamp > multicam_pose_estimation->last_visible_timestamp)
+	{
+		multicam_pose_estimation->last_visible_timestamp = remote_visible_timestamp;
+	}
+}
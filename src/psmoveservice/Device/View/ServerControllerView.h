@@ -3,6 +3,7 @@
 
 //-- includes -----
 #include "DeviceInterface.h"
+#include "LatencyHistogram.h"
 #include "ServerDeviceView.h"
 #include "PSMoveProtocolInterface.h"
 #include "TrackerManager.h"
@@ -23,6 +24,28 @@ struct ControllerOpticalPoseEstimation
     CommonDeviceQuaternion orientation;
     bool bOrientationValid;
 
+    // Goodness-of-fit of the 2D projection this estimate came from.
+    // Shape dependent units: mean algebraic ellipse residual per contour
+    // point for spheres, mean corner reprojection error in pixels for
+    // lightbars. Lower is better, 0 = unknown.
+    float projection_fit_error;
+
+    // World space ray from the tracker through the observed projection center,
+    // cached when the observation updates so that the multicam triangulation
+    // only recomputes rays for trackers that got a new video frame this tick
+    CommonDevicePosition world_ray_origin_cm;
+    CommonDeviceVector world_ray_direction;
+    bool bWorldRayValid;
+
+    // When set, the next projection pass on this tracker runs a native
+    // full-frame search instead of a ROI. Scoped to this controller-tracker
+    // pair so one tracker re-searching doesn't force the others to full
+    // frame; one-shot, cleared when the search runs.
+    bool bDisableROI;
+    // Consecutive frames the coarse re-acquisition pass saw nothing on this
+    // tracker; saturating it sets bDisableROI
+    int coarse_reacquisition_failure_count;
+
     inline void clear()
     {
         last_update_timestamp = std::chrono::time_point<std::chrono::high_resolution_clock>();
@@ -35,6 +58,15 @@ struct ControllerOpticalPoseEstimation
         orientation.clear();
         bOrientationValid= false;
 
+        projection_fit_error= 0.f;
+
+        world_ray_origin_cm.clear();
+        world_ray_direction.clear();
+        bWorldRayValid= false;
+
+        bDisableROI= false;
+        coarse_reacquisition_failure_count= 0;
+
         memset(&projection, 0, sizeof(CommonDeviceTrackingProjection));
         projection.shape_type= eCommonTrackingProjectionType::INVALID_PROJECTION;
     }
@@ -48,6 +80,7 @@ public:
 
     bool open(const class DeviceEnumerator *enumerator) override;
     void close() override;
+    bool poll() override;
 
 	// Tell the pose filter that the controller is aligned with global forward 
 	// with the given pose relative to it's identity pose.
@@ -61,6 +94,10 @@ public:
     void updateOpticalPoseEstimation(TrackerManager* tracker_manager);
     void updateStateAndPredict();
 
+    // Record the last optical pose estimates into the warm restart snapshot
+    // (called during service shutdown)
+    void captureWarmRestartState() const;
+
     // Registers the address of the bluetooth adapter on the host PC with the controller
     bool setHostBluetoothAddress(const std::string &address);
     
@@ -74,6 +111,11 @@ public:
     // Get the current physics from the filter position and orientation
     CommonDevicePhysics getFilteredPhysics() const;
 
+    // Copy out the last pose/physics snapshot published by the filter update.
+    // Safe to call from threads other than the device update thread.
+    // Returns false if the filter hasn't published a snapshot yet.
+    bool getPublishedPoseSnapshot(CommonDevicePoseSnapshot &out_snapshot) const;
+
     // Returns true if the device is connected via Bluetooth, false if by USB
     bool getIsBluetooth() const;
 
@@ -127,6 +169,14 @@ public:
     // Get the tracking shape for the controller
     bool getTrackingShape(CommonDeviceTrackingShape &outTrackingShape) const;
 
+    // The tracking shape cached at open time. The shape geometry is static
+    // while the device is open, so per-frame consumers read this instead of
+    // re-querying the device.
+    inline const CommonDeviceTrackingShape *getCachedTrackingShape() const { return &m_tracking_shape; }
+
+    // Bounding radius (cm) of the cached tracking shape, precomputed at open time
+    inline float getTrackingShapeBoundingRadiusCm() const { return m_tracking_shape_bounding_radius_cm; }
+
 	// Get if the region-of-interest optimization is disabled for this controller
 	inline bool getIsROIDisabled() const { return m_roi_disable_count > 0; }
 	
@@ -150,23 +200,57 @@ public:
     }
 
     // return true if one or more cameras saw this controller last update
-    inline bool getIsCurrentlyTracking() const { 
+    inline bool getIsCurrentlyTracking() const {
         return getIsTrackingEnabled() ? m_multicam_pose_estimation->bCurrentlyTracking : false;
     }
 
+    // Rolling tracking quality telemetry, EMA smoothed over the optical
+    // updates (see updateTrackingQuality). The composite quality runs 0..1:
+    // 0 = not tracking, 1 = clean lock. The raw metrics hold their last
+    // smoothed value while tracking is lost.
+    inline float getTrackingQuality() const { return m_tracking_quality; }
+    inline float getAvgProjectionFitError() const { return m_avg_projection_fit_error; }
+    inline float getAvgMulticamDisagreementCm() const { return m_avg_multicam_disagreement_cm; }
+    inline float getAvgFilterInnovationCm() const { return m_avg_filter_innovation_cm; }
+
     // Set the rumble value between 0.f-1.f on a channel
     bool setControllerRumble(float rumble_amount, CommonControllerState::RumbleChannel channel);
 
+    // Latency histograms for the hid_read -> filter -> publish pipeline,
+    // readable at any time by the request handler
+    inline const LatencyHistogram &getPollToFilterLatencyHistogram() const
+    { return m_poll_to_filter_histogram; }
+    inline const LatencyHistogram &getFilterToPublishLatencyHistogram() const
+    { return m_filter_to_publish_histogram; }
+    inline const LatencyHistogram &getPollToPublishLatencyHistogram() const
+    { return m_poll_to_publish_histogram; }
+
+    // Start/stop the shared memory stream packet ring used by same-host clients
+    void startSharedMemoryStream();
+    void stopSharedMemoryStream();
+    std::string getSharedMemoryStreamName() const;
+
 protected:
+    void processPolledState(
+        const CommonControllerState *controllerState,
+        const float per_state_time_delta_seconds,
+        class PoseSensorPacketQueue &imu_packet_queue,
+        const bool bIsFinalStateThisTick);
     void set_tracking_enabled_internal(bool bEnabled);
     void update_LED_color_internal();
+    // Fold this tick's optical tracking results into the rolling tracking
+    // quality metrics (called at the end of updateOpticalPoseEstimation)
+    void updateTrackingQuality(const int *valid_projection_tracker_ids, const int projections_found);
+    // Re-apply optical pose estimates captured by a recent clean shutdown
+    void restoreWarmRestartState();
     bool allocate_device_interface(const class DeviceEnumerator *enumerator) override;
     void free_device_interface() override;
     void publish_device_data_frame() override;
-    static void generate_controller_data_frame_for_stream(
+    std::uint32_t computePublishedStateFingerprint() const override;
+    static void generate_controller_stream_packet(
         const ServerControllerView *controller_view,
         const struct ControllerStreamInfo *stream_info,
-        PSMoveProtocol::DeviceOutputDataFrame *data_frame);
+        struct ControllerStreamPacket *packet);
 
 private:
     // Tracking color state
@@ -183,15 +267,59 @@ private:
 
     // Device state
     IControllerInterface *m_device;
-    
+
+    // Tracking shape cache, filled at open time
+    CommonDeviceTrackingShape m_tracking_shape;
+    float m_tracking_shape_bounding_radius_cm;
+
+    // Button transition accumulator. processPolledState (which may run on a
+    // pose estimation worker) records rising/falling edges here; the service
+    // thread drains them into a CONTROLLER_BUTTON_EVENT notification at
+    // publish time. The filter jobs are joined before publish runs, so the
+    // writer and the reader never overlap.
+    unsigned int m_last_button_event_bitmask;
+    unsigned int m_pending_pressed_buttons;
+    unsigned int m_pending_released_buttons;
+    bool m_has_pending_button_event;
+
+    // Dedicated HID polling thread, only allocated while a pollable
+    // (i.e. bluetooth connected) controller is open
+    class ControllerHidPollThread *m_hid_poll_thread;
+
     // Filter state
     ControllerOpticalPoseEstimation *m_tracker_pose_estimations; // array of size TrackerManager::k_max_devices
     ControllerOpticalPoseEstimation *m_multicam_pose_estimation;
     class IPoseFilter *m_pose_filter;
     class PoseFilterSpace *m_pose_filter_space;
+    DevicePoseSnapshotBuffer m_pose_snapshot_buffer;
+    class PoseFilterHistory *m_pose_filter_history;
+    float m_pose_filter_history_seconds;
     int m_lastPollSeqNumProcessed;
     std::chrono::time_point<std::chrono::high_resolution_clock> m_last_filter_update_timestamp;
     bool m_last_filter_update_timestamp_valid;
+
+    // Poll timestamp of the last controller state fed into the filter,
+    // used to derive real per-sample time deltas for the state batch
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_last_processed_state_timestamp;
+    bool m_last_processed_state_timestamp_valid;
+
+    // Rolling tracking quality metrics (see updateTrackingQuality)
+    float m_tracking_quality;
+    float m_avg_projection_fit_error;
+    float m_avg_multicam_disagreement_cm;
+    float m_avg_filter_innovation_cm;
+
+    // Latency instrumentation
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_filter_update_complete_timestamp;
+    bool m_filter_update_complete_timestamp_valid;
+    LatencyHistogram m_poll_to_filter_histogram;
+    LatencyHistogram m_filter_to_publish_histogram;
+    LatencyHistogram m_poll_to_publish_histogram;
+
+    // Shared memory stream state
+    char m_shared_memory_name[256];
+    class SharedControllerStateWriteAccessor *m_shared_memory_accesor;
+    int m_shared_memory_stream_count;
 };
 
 #endif // SERVER_CONTROLLER_VIEW_H
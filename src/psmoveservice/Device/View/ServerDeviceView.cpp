@@ -1,17 +1,80 @@
 //-- includes -----
 #include "ServerDeviceView.h"
+#include "DeviceEnumerator.h"
 #include "ServerLog.h"
 
 #include <chrono>
 
+//-- constants -----
+// Unchanged devices still get republished this often so listening clients
+// can tell an idle device from a dead stream
+static const std::chrono::milliseconds k_publish_heartbeat_interval(500);
+
 //-- private methods -----
 
 //-- public implementation -----
+//-- DevicePoseSnapshotBuffer -----
+DevicePoseSnapshotBuffer::DevicePoseSnapshotBuffer()
+    : m_write_count(0)
+{
+    m_buffers[0].clear();
+    m_buffers[1].clear();
+}
+
+void
+DevicePoseSnapshotBuffer::write(const CommonDevicePoseSnapshot &snapshot)
+{
+    const std::uint32_t start_count = m_write_count.load(std::memory_order_relaxed);
+
+    // Flag the write as in flight (count goes odd)
+    m_write_count.store(start_count + 1, std::memory_order_release);
+
+    m_buffers[(start_count >> 1) & 1] = snapshot;
+
+    // Mark the write complete (count goes even)
+    m_write_count.store(start_count + 2, std::memory_order_release);
+}
+
+bool
+DevicePoseSnapshotBuffer::read(CommonDevicePoseSnapshot &out_snapshot) const
+{
+    for (;;)
+    {
+        const std::uint32_t count_before = m_write_count.load(std::memory_order_acquire);
+
+        if (count_before < 2)
+        {
+            // No snapshot has been fully published yet
+            return false;
+        }
+
+        // Index of the most recently completed write. With an odd count the
+        // in-flight write is going to the other buffer, so the last completed
+        // snapshot is still safe to copy.
+        const std::uint32_t last_complete_write = count_before >> 1;
+
+        out_snapshot = m_buffers[(last_complete_write - 1) & 1];
+
+        // The buffer we copied only gets rewritten two writes later, so the
+        // copy is consistent unless the writer lapped us mid-copy
+        const std::uint32_t count_after = m_write_count.load(std::memory_order_acquire);
+
+        if (count_after <= 2*last_complete_write + 2)
+        {
+            return true;
+        }
+    }
+}
+
+//-- ServerDeviceView -----
 ServerDeviceView::ServerDeviceView(
     const int device_id)
     : m_bHasUnpublishedState(false)
     , m_pollNoDataCount(0)
     , m_sequence_number(0)
+    , m_newDataPollCount(0)
+    , m_lastPublishedStateFingerprint(0)
+    , m_bLastPublishedFingerprintValid(false)
     , m_deviceID(device_id)
 {
 }
@@ -36,6 +99,11 @@ ServerDeviceView::open(const DeviceEnumerator *enumerator)
     {
         // Consider a successful opening as an update
         m_pollNoDataCount= 0;
+
+        // Cache the path we opened at for the fast-reject in
+        // DeviceTypeManager::find_open_device_device_id
+        const char *enumerator_path= enumerator->get_path();
+        m_devicePath= (enumerator_path != nullptr) ? enumerator_path : "";
     }
 
     return bSuccess;
@@ -83,6 +151,7 @@ bool ServerDeviceView::poll()
             {
                 m_pollNoDataCount= 0;
                 m_lastNewDataTimestamp= std::chrono::high_resolution_clock::now();
+                m_newDataPollCount.fetch_add(1, std::memory_order_relaxed);
 
                 // If we got new sensor data, then we have new state to publish
                 markStateAsUnpublished();
@@ -110,10 +179,31 @@ void ServerDeviceView::publish()
 {
     if (m_bHasUnpublishedState)
     {
-        publish_device_data_frame();
+        // Skip the serialization and network send entirely when the state
+        // the data frame would carry is identical to what was last sent
+        // (e.g. an idle PSNavi: every HID poll succeeds but nothing the
+        // clients see has changed), apart from a periodic heartbeat
+        const std::uint32_t fingerprint= computePublishedStateFingerprint();
+        const std::chrono::time_point<std::chrono::high_resolution_clock> now=
+            std::chrono::high_resolution_clock::now();
+
+        const bool bStateChanged=
+            !m_bLastPublishedFingerprintValid ||
+            fingerprint != m_lastPublishedStateFingerprint;
+        const bool bHeartbeatDue=
+            (now - m_lastPublishTimestamp) >= k_publish_heartbeat_interval;
+
+        if (bStateChanged || bHeartbeatDue)
+        {
+            publish_device_data_frame();
+
+            m_lastPublishedStateFingerprint= fingerprint;
+            m_bLastPublishedFingerprintValid= true;
+            m_lastPublishTimestamp= now;
+            m_sequence_number++;
+        }
 
         m_bHasUnpublishedState= false;
-        m_sequence_number++;
     }
 }
 
@@ -125,6 +215,8 @@ ServerDeviceView::close()
         getDevice()->close();
         free_device_interface();
     }
+
+    m_devicePath.clear();
 }
 
 bool
@@ -3,10 +3,49 @@
 
 //-- includes -----
 #include "DeviceInterface.h"
+#include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <string>
 #include <assert.h>
 
 // -- declarations -----
+/// A consistent pose + physics sample published by a device view
+struct CommonDevicePoseSnapshot
+{
+    CommonDevicePose pose;
+    CommonDevicePhysics physics;
+
+    void clear()
+    {
+        pose.clear();
+        physics.clear();
+    }
+};
+
+/// Seqlock-style double buffer used to hand consistent pose/physics snapshots
+/// from the device update thread to readers on other threads (e.g. a network
+/// thread) without ever taking a lock on the filter hot path.
+class DevicePoseSnapshotBuffer
+{
+public:
+    DevicePoseSnapshotBuffer();
+
+    /// Publish a new snapshot. Only ever called from the device update thread.
+    void write(const CommonDevicePoseSnapshot &snapshot);
+
+    /// Copy out the most recently completed snapshot. Safe to call from any
+    /// thread. Returns false if no snapshot has been published yet.
+    bool read(CommonDevicePoseSnapshot &out_snapshot) const;
+
+private:
+    CommonDevicePoseSnapshot m_buffers[2];
+
+    // Write k lands in buffer (k-1)&1. The count is odd while a write is in
+    // flight, so readers always know which buffer holds a complete snapshot.
+    std::atomic<std::uint32_t> m_write_count;
+};
+
 class ServerDeviceView
 {
 public:
@@ -20,10 +59,17 @@ public:
     virtual void publish();
     
     bool matchesDeviceEnumerator(const class DeviceEnumerator *enumerator) const;
-    
+
     // getters
     inline int getDeviceID() const
     { return m_deviceID; }
+
+    // Enumerator path the device was opened at (empty while closed).
+    // Cached so that the per-candidate matching in the reconnect rescans
+    // can fast-reject on a plain string compare instead of paying for a
+    // virtual matchesDeviceEnumerator call per open device.
+    inline const std::string &getDevicePath() const
+    { return m_devicePath; }
     
     virtual IDeviceInterface* getDevice() const=0;
     
@@ -55,7 +101,11 @@ public:
     { return m_bHasUnpublishedState; }
     inline std::chrono::time_point<std::chrono::high_resolution_clock> getLastNewDataTimestamp() const
     { return m_lastNewDataTimestamp; }
-    
+    // Polls that returned new sensor data since the service started.
+    // Relaxed atomic so the statistics scrape can read it from any thread.
+    inline std::uint64_t getNewDataPollCount() const
+    { return m_newDataPollCount.load(std::memory_order_relaxed); }
+
     // setters
     inline void markStateAsUnpublished()
     { m_bHasUnpublishedState= true; }
@@ -65,13 +115,26 @@ protected:
     virtual void free_device_interface() = 0;
     virtual void publish_device_data_frame() = 0;
 
+    // Fingerprint of the state the next data frame would carry. publish()
+    // skips serialization while the fingerprint is unchanged, apart from a
+    // periodic heartbeat. The default fingerprints the poll count, i.e.
+    // every successful poll counts as a change; subclasses override this
+    // for devices whose polls mostly return identical state.
+    virtual std::uint32_t computePublishedStateFingerprint() const
+    { return static_cast<std::uint32_t>(getNewDataPollCount()); }
+
     bool m_bHasUnpublishedState;
     int m_pollNoDataCount;
     int m_sequence_number;
     std::chrono::time_point<std::chrono::high_resolution_clock> m_lastNewDataTimestamp;
+    std::atomic<std::uint64_t> m_newDataPollCount;
+    std::uint32_t m_lastPublishedStateFingerprint;
+    bool m_bLastPublishedFingerprintValid;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_lastPublishTimestamp;
     
 private:
     int m_deviceID;
+    std::string m_devicePath;
 };
 
 #endif // SERVER_DEVICE_VIEW_H
@@ -8,8 +8,13 @@
 #include "PSMoveProtocol.pb.h"
 #include "ServerLog.h"
 #include "ServerRequestHandler.h"
+#include "ServerTracer.h"
 #include "ServerTrackerView.h"
+#include "ServiceClock.h"
 #include "TrackerManager.h"
+#include "WarmRestartSnapshot.h"
+
+#include <algorithm>
 
 //-- constants -----
 static const float k_min_time_delta_seconds = 1 / 120.f;
@@ -24,6 +29,7 @@ static IPoseFilter *pose_filter_factory(
 	const PoseFilterConstants &constants);
 static void update_filters_for_morpheus_hmd(
 	const MorpheusHMD *morpheusHMD, const MorpheusHMDState *morpheusHMDState,
+	const MorpheusHMDState *prevMorpheusHMDState,
 	const float delta_time,
 	const HMDOpticalPoseEstimation *poseEstimation, const PoseFilterSpace *poseFilterSpace, IPoseFilter *poseFilter);
 static void generate_morpheus_hmd_data_frame_for_stream(
@@ -44,6 +50,7 @@ ServerHMDView::ServerHMDView(const int device_id)
 	, m_tracking_enabled(false)
 	, m_roi_disable_count(0)
 	, m_device(nullptr)
+	, m_tracking_shape_bounding_radius_cm(0.f)
 	, m_tracker_pose_estimation(nullptr)
 	, m_multicam_pose_estimation(nullptr)
 	, m_pose_filter(nullptr)
@@ -52,6 +59,8 @@ ServerHMDView::ServerHMDView(const int device_id)
 	, m_last_filter_update_timestamp()
 	, m_last_filter_update_timestamp_valid(false)
 {
+	memset(&m_tracking_shape, 0, sizeof(CommonDeviceTrackingShape));
+	m_tracking_shape.shape_type = eCommonTrackingShapeType::INVALID_SHAPE;
 }
 
 ServerHMDView::~ServerHMDView()
@@ -138,13 +147,107 @@ bool ServerHMDView::open(const class DeviceEnumerator *enumerator)
 			break;
 		}
 
+		// Cache the tracking shape and its bounding radius. The shape
+		// geometry is static while the device is open and the projection
+		// code asks for it per tracker per frame.
+		device->getTrackingShape(m_tracking_shape);
+		m_tracking_shape_bounding_radius_cm =
+			(m_tracking_shape.shape_type != eCommonTrackingShapeType::INVALID_SHAPE)
+			? ServerTrackerView::computeTrackingShapeBoundingRadius(&m_tracking_shape)
+			: 0.f;
+
         // Reset the poll sequence number high water mark
         m_lastPollSeqNumProcessed = -1;
     }
 
+	// If a recent clean shutdown left a warm restart snapshot for this
+	// device, resume from its last optical pose estimates so the trackers
+	// search the prior ROI instead of re-acquiring from a full-frame scan
+	if (bSuccess)
+	{
+		restoreWarmRestartState();
+	}
+
     return bSuccess;
 }
 
+void ServerHMDView::captureWarmRestartState() const
+{
+	if (!getIsOpen() || m_tracker_pose_estimation == nullptr)
+	{
+		return;
+	}
+
+	WarmRestartSnapshot::DeviceEntry entry;
+	entry.device_kind = WarmRestartSnapshot::DeviceKind_HMD;
+	entry.device_path = getUSBDevicePath();
+
+	for (int tracker_index = 0; tracker_index < TrackerManager::k_max_devices; ++tracker_index)
+	{
+		const HMDOpticalPoseEstimation &estimate = m_tracker_pose_estimation[tracker_index];
+		WarmRestartSnapshot::TrackerEntry tracker_entry;
+
+		tracker_entry.bCurrentlyTracking = estimate.bCurrentlyTracking;
+		tracker_entry.bOrientationValid = estimate.bOrientationValid;
+		tracker_entry.position_cm = estimate.position;
+		tracker_entry.orientation = estimate.orientation;
+		tracker_entry.projection = estimate.projection;
+
+		entry.tracker_entries.push_back(tracker_entry);
+	}
+
+	WarmRestartSnapshot::addDeviceEntry(entry);
+}
+
+void ServerHMDView::restoreWarmRestartState()
+{
+	WarmRestartSnapshot::DeviceEntry entry;
+
+	if (m_tracker_pose_estimation == nullptr ||
+		!WarmRestartSnapshot::fetchDeviceEntry(
+			WarmRestartSnapshot::DeviceKind_HMD, getUSBDevicePath(), entry))
+	{
+		return;
+	}
+
+	const std::chrono::time_point<std::chrono::high_resolution_clock> now =
+		std::chrono::high_resolution_clock::now();
+	const int tracker_count =
+		std::min(static_cast<int>(entry.tracker_entries.size()), TrackerManager::k_max_devices);
+	int restored_count = 0;
+
+	for (int tracker_index = 0; tracker_index < tracker_count; ++tracker_index)
+	{
+		const WarmRestartSnapshot::TrackerEntry &tracker_entry = entry.tracker_entries[tracker_index];
+
+		// Only trackers that actually saw the device are worth restoring.
+		// If the device has moved since, the normal tracking loss handling
+		// throws the restored estimate out within a frame or two.
+		if (tracker_entry.bCurrentlyTracking)
+		{
+			HMDOpticalPoseEstimation &estimate = m_tracker_pose_estimation[tracker_index];
+
+			estimate.position = tracker_entry.position_cm;
+			estimate.orientation = tracker_entry.orientation;
+			estimate.projection = tracker_entry.projection;
+			estimate.bCurrentlyTracking = true;
+			estimate.bOrientationValid = tracker_entry.bOrientationValid;
+			estimate.last_update_timestamp = now;
+			estimate.last_visible_timestamp = now;
+			estimate.bValidTimestamps = true;
+
+			++restored_count;
+		}
+	}
+
+	if (restored_count > 0)
+	{
+		SERVER_LOG_INFO("ServerHMDView::open") <<
+			"HMD " << getDeviceID() << " warm-restored tracking state from " <<
+			restored_count << " tracker(s)";
+	}
+}
+
 void ServerHMDView::resetPoseFilter()
 {
 	assert(m_device != nullptr);
@@ -176,7 +279,7 @@ void ServerHMDView::resetPoseFilter()
 
 void ServerHMDView::updateOpticalPoseEstimation(TrackerManager* tracker_manager)
 {
-	const std::chrono::time_point<std::chrono::high_resolution_clock> now = std::chrono::high_resolution_clock::now();
+	const std::chrono::time_point<std::chrono::high_resolution_clock> now = ServiceClock::now();
 
 	// TODO: Probably need to first update IMU state to get velocity.
 	// If velocity is too high, don't bother getting a new position.
@@ -209,11 +312,11 @@ void ServerHMDView::updateOpticalPoseEstimation(TrackerManager* tracker_manager)
 			{
 				// See how long it's been since we got a new video frame
 				const std::chrono::time_point<std::chrono::high_resolution_clock> now =
-					std::chrono::high_resolution_clock::now();
+					ServiceClock::now();
 				const std::chrono::duration<float, std::milli> timeSinceNewDataMillis =
 					now - tracker->getLastNewDataTimestamp();
 				const float timeoutMilli =
-					static_cast<float>(DeviceManager::getInstance()->m_tracker_manager->getConfig().optical_tracking_timeout);
+					static_cast<float>(DeviceManager::getInstance()->m_tracker_manager->getConfigSnapshot()->config.optical_tracking_timeout);
 
 				// Can't compute tracking on video data that's too old
 				if (timeSinceNewDataMillis.count() < timeoutMilli)
@@ -221,9 +324,11 @@ void ServerHMDView::updateOpticalPoseEstimation(TrackerManager* tracker_manager)
 					// Initially the newTrackerPoseEstimate is a copy of the existing pose
 					bool bIsVisibleThisUpdate = false;
 
-					// If a new video frame is available this tick, 
+					// If a new video frame is available this tick and this
+					// tracker is assigned to the current interleave slot,
 					// attempt to update the tracking location
-					if (tracker->getHasUnpublishedState())
+					if (tracker->getHasUnpublishedState() &&
+						tracker_manager->getIsTrackerScheduledThisTick(tracker_id))
 					{
 						HMDOpticalPoseEstimation newTrackerPoseEstimate = trackerPoseEstimateRef;
 						CommonDevicePose poseGuess = { trackerPoseEstimateRef.position, trackerPoseEstimateRef.orientation };
@@ -236,7 +341,10 @@ void ServerHMDView::updateOpticalPoseEstimation(TrackerManager* tracker_manager)
 							bIsVisibleThisUpdate = true;
 
 							trackerPoseEstimateRef = newTrackerPoseEstimate;
-							trackerPoseEstimateRef.last_visible_timestamp = now;
+
+							// Stamp the observation with the time the camera actually
+							// captured the frame rather than when we processed it
+							trackerPoseEstimateRef.last_visible_timestamp = tracker->getLastNewDataTimestamp();
 						}
 					}
 
@@ -397,10 +505,25 @@ void ServerHMDView::updateOpticalPoseEstimation(TrackerManager* tracker_manager)
 			m_multicam_pose_estimation->bOrientationValid = false;
 		}
 
-		// Update the position estimation timestamps
+		// Update the position estimation timestamps.
+		// The multicam estimate is only as old as the newest frame that went
+		// into it, so use the newest per-tracker capture timestamp.
 		if (positions_found > 0)
 		{
-			m_multicam_pose_estimation->last_visible_timestamp = now;
+			std::chrono::time_point<std::chrono::high_resolution_clock> newest_capture_timestamp =
+				m_tracker_pose_estimation[valid_position_tracker_ids[0]].last_visible_timestamp;
+
+			for (int list_index = 1; list_index < positions_found; ++list_index)
+			{
+				const int tracker_id = valid_position_tracker_ids[list_index];
+
+				if (m_tracker_pose_estimation[tracker_id].last_visible_timestamp > newest_capture_timestamp)
+				{
+					newest_capture_timestamp = m_tracker_pose_estimation[tracker_id].last_visible_timestamp;
+				}
+			}
+
+			m_multicam_pose_estimation->last_visible_timestamp = newest_capture_timestamp;
 		}
 		m_multicam_pose_estimation->last_update_timestamp = now;
 		m_multicam_pose_estimation->bValidTimestamps = true;
@@ -409,6 +532,8 @@ void ServerHMDView::updateOpticalPoseEstimation(TrackerManager* tracker_manager)
 
 void ServerHMDView::updateStateAndPredict()
 {
+	SERVER_TRACE_SCOPE("ServerHMDView::updateStateAndPredict");
+
 	if (!getHasUnpublishedState())
 	{
 		return;
@@ -428,7 +553,7 @@ void ServerHMDView::updateStateAndPredict()
 	assert(firstLookBackIndex >= 0);
 
 	// Compute the time in seconds since the last update
-	const std::chrono::time_point<std::chrono::high_resolution_clock> now = std::chrono::high_resolution_clock::now();
+	const std::chrono::time_point<std::chrono::high_resolution_clock> now = ServiceClock::now();
 	float time_delta_seconds;
 	if (m_last_filter_update_timestamp_valid)
 	{
@@ -460,10 +585,11 @@ void ServerHMDView::updateStateAndPredict()
 		{
 			const MorpheusHMD *morpheusHMD = this->castCheckedConst<MorpheusHMD>();
 			const MorpheusHMDState *morpheusHMDState = static_cast<const MorpheusHMDState *>(hmdState);
+			const MorpheusHMDState *prevMorpheusHMDState = static_cast<const MorpheusHMDState *>(getState(lookBackIndex + 1));
 
 			// Only update the position filter when tracking is enabled
 			update_filters_for_morpheus_hmd(
-				morpheusHMD, morpheusHMDState,
+				morpheusHMD, morpheusHMDState, prevMorpheusHMDState,
 				per_state_time_delta_seconds,
 				m_multicam_pose_estimation,
 				m_pose_filter_space,
@@ -623,6 +749,13 @@ void ServerHMDView::set_tracking_enabled_internal(bool bEnabled)
 // Get the tracking shape for the controller
 bool ServerHMDView::getTrackingShape(CommonDeviceTrackingShape &trackingShape) const
 {
+	// Served from the open-time cache when available
+	if (m_tracking_shape.shape_type != eCommonTrackingShapeType::INVALID_SHAPE)
+	{
+		trackingShape = m_tracking_shape;
+		return true;
+	}
+
 	m_device->getTrackingShape(trackingShape);
 
 	return trackingShape.shape_type != eCommonTrackingShapeType::INVALID_SHAPE;
@@ -710,6 +843,7 @@ init_filters_for_morpheus_hmd(
 	constants.orientation_constants.orientation_variance_curve.A = hmd_config->orientation_variance;
 	constants.orientation_constants.orientation_variance_curve.B = 0.f;
 	constants.orientation_constants.orientation_variance_curve.MaxValue = 1.f;
+	constants.orientation_constants.orientation_variance_curve.buildLUT();
 	constants.orientation_constants.magnetometer_variance = Eigen::Vector3f::Zero();
 	constants.orientation_constants.magnetometer_drift = Eigen::Vector3f::Zero();
 
@@ -722,6 +856,7 @@ init_filters_for_morpheus_hmd(
 	constants.position_constants.position_variance_curve.A = hmd_config->position_variance_exp_fit_a;
 	constants.position_constants.position_variance_curve.B = hmd_config->position_variance_exp_fit_b;
 	constants.position_constants.position_variance_curve.MaxValue = 1.f;
+	constants.position_constants.position_variance_curve.buildLUT();
 
 	*out_pose_filter_space = pose_filter_space;
 	*out_pose_filter = pose_filter_factory(
@@ -829,6 +964,7 @@ static void
 update_filters_for_morpheus_hmd(
     const MorpheusHMD *morpheusHMD,
     const MorpheusHMDState *morpheusHMDState,
+	const MorpheusHMDState *prevMorpheusHMDState,
 	const float delta_time,
 	const HMDOpticalPoseEstimation *poseEstimation,
 	const PoseFilterSpace *poseFilterSpace,
@@ -872,7 +1008,29 @@ update_filters_for_morpheus_hmd(
 			sensorPacket.tracking_projection_area_px_sqr = 0.f;
 		}
 
-		// Each state update contains two readings (one earlier and one later) of accelerometer and gyro data
+		// Each state update contains two readings (one earlier and one later) of accelerometer and gyro data.
+		// Apportion the update interval between them using the IMU's own 16-bit sample counter
+		// so each reading is integrated over the time the IMU actually measured, rather than
+		// assuming the two samples split the interval evenly.
+		float frame_time_deltas[2] = {delta_time / 2.f, delta_time / 2.f};
+		if (prevMorpheusHMDState != nullptr)
+		{
+			const int tick_delta_0 =
+				(morpheusHMDState->SensorFrames[0].SequenceNumber
+				 - prevMorpheusHMDState->SensorFrames[1].SequenceNumber) & 0xFFFF;
+			const int tick_delta_1 =
+				(morpheusHMDState->SensorFrames[1].SequenceNumber
+				 - morpheusHMDState->SensorFrames[0].SequenceNumber) & 0xFFFF;
+			const int total_ticks = tick_delta_0 + tick_delta_1;
+
+			// Ignore implausible spans (sensor hiccup or counter reset) and keep the even split
+			if (tick_delta_0 > 0 && tick_delta_1 > 0 && total_ticks <= 4096)
+			{
+				frame_time_deltas[0] = delta_time * (static_cast<float>(tick_delta_0) / static_cast<float>(total_ticks));
+				frame_time_deltas[1] = delta_time * (static_cast<float>(tick_delta_1) / static_cast<float>(total_ticks));
+			}
+		}
+
 		for (int frame = 0; frame < 2; ++frame)
 		{
 			const MorpheusHMDSensorFrame &sensorFrame= morpheusHMDState->SensorFrames[frame];
@@ -890,17 +1048,18 @@ update_filters_for_morpheus_hmd(
 			sensorPacket.imu_magnetometer_unit = Eigen::Vector3f::Zero();
 
 			{
-				PoseFilterPacket filterPacket;
+				// Create a filter input packet from the sensor data
+				// and the filter's previous orientation and position,
+				// written into the filter space's preallocated workspace
+				const PoseFilterPacket &filterPacket=
+					poseFilterSpace->createFilterPacket(sensorPacket, poseFilter);
 
-				// Create a filter input packet from the sensor data 
-				// and the filter's previous orientation and position
-				poseFilterSpace->createFilterPacket(
-					sensorPacket,
-					poseFilter,
-					filterPacket);
-
-				poseFilter->update(delta_time / 2.f, filterPacket);
+				poseFilter->update(frame_time_deltas[frame], filterPacket);
 			}
+
+			// There is only one optical measurement per state update - zero the projection
+			// area after the first sub-step so the filter doesn't fold it in twice
+			sensorPacket.tracking_projection_area_px_sqr = 0.f;
 		}
 	}
 }
@@ -22,6 +22,14 @@ struct HMDOpticalPoseEstimation
 	CommonDeviceQuaternion orientation;
 	bool bOrientationValid;
 
+	// When set, the next projection pass on this tracker runs a native
+	// full-frame search instead of a ROI. Scoped to this hmd-tracker pair;
+	// one-shot, cleared when the search runs.
+	bool bDisableROI;
+	// Consecutive frames the coarse re-acquisition pass saw nothing on this
+	// tracker; saturating it sets bDisableROI
+	int coarse_reacquisition_failure_count;
+
 	inline void clear()
 	{
 		last_update_timestamp = std::chrono::time_point<std::chrono::high_resolution_clock>();
@@ -34,6 +42,9 @@ struct HMDOpticalPoseEstimation
 		orientation.clear();
 		bOrientationValid = false;
 
+		bDisableROI = false;
+		coarse_reacquisition_failure_count = 0;
+
 		memset(&projection, 0, sizeof(CommonDeviceTrackingProjection));
 		projection.shape_type = eCommonTrackingProjectionType::INVALID_PROJECTION;
 	}
@@ -54,6 +65,10 @@ public:
 	void updateOpticalPoseEstimation(TrackerManager* tracker_manager);
     void updateStateAndPredict();
 
+	// Record the last optical pose estimates into the warm restart snapshot
+	// (called during service shutdown)
+	void captureWarmRestartState() const;
+
     IDeviceInterface* getDevice() const override { return m_device; }
 	inline class IPoseFilter * getPoseFilterMutable() { return m_pose_filter; }
 	inline const class IPoseFilter * getPoseFilter() const { return m_pose_filter; }
@@ -91,6 +106,14 @@ public:
 	// Get the tracking shape for the controller
 	bool getTrackingShape(CommonDeviceTrackingShape &outTrackingShape) const;
 
+	// The tracking shape cached at open time. The LED geometry is static while
+	// the device is open, so per-frame consumers read this instead of
+	// re-querying the device.
+	inline const CommonDeviceTrackingShape *getCachedTrackingShape() const { return &m_tracking_shape; }
+
+	// Bounding radius (cm) of the cached tracking shape, precomputed at open time
+	inline float getTrackingShapeBoundingRadiusCm() const { return m_tracking_shape_bounding_radius_cm; }
+
 	// Get the currently assigned tracking color ID for the controller
 	eCommonTrackingColorID getTrackingColorID() const;
 
@@ -123,6 +146,8 @@ public:
 
 protected:
 	void set_tracking_enabled_internal(bool bEnabled);
+	// Re-apply optical pose estimates captured by a recent clean shutdown
+	void restoreWarmRestartState();
     bool allocate_device_interface(const class DeviceEnumerator *enumerator) override;
     void free_device_interface() override;
     void publish_device_data_frame() override;
@@ -142,6 +167,10 @@ private:
 	// Device State
     IHMDInterface *m_device;
 
+	// Tracking shape cache, filled at open time
+	CommonDeviceTrackingShape m_tracking_shape;
+	float m_tracking_shape_bounding_radius_cm;
+
 	// Filter state
 	HMDOpticalPoseEstimation *m_tracker_pose_estimation; // array of size TrackerManager::k_max_devices
 	HMDOpticalPoseEstimation *m_multicam_pose_estimation;
@@ -8,10 +8,19 @@
 #include "MathEigen.h"
 #include "MathGLM.h"
 #include "MathAlignment.h"
+#include "HSVRangeThreshold.h"
+#include "TrackerUndistortionLUT.h"
+#include "TrackerVideoEncoder.h"
+#include "TrackerVisionKernels.h"
+#include "PSMoveConfig.h"
 #include "PS3EyeTracker.h"
+#include "VirtualTracker.h"
 #include "PSMoveProtocol.pb.h"
+#include "ServerTracer.h"
 #include "ServerUtility.h"
+#include "ServiceClock.h"
 #include "ServerLog.h"
+#include "SessionCapture.h"
 #include "ServerRequestHandler.h"
 #include "SharedTrackerState.h"
 #include "TrackerManager.h"
@@ -19,19 +28,93 @@
 
 #include <boost/interprocess/shared_memory_object.hpp>
 #include <boost/interprocess/mapped_region.hpp>
-#include <boost/interprocess/sync/scoped_lock.hpp>
 #include <memory>
 
 #include "opencv2/opencv.hpp"
 #include "opencv2/calib3d/calib3d.hpp"
 
 #include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 #define USE_OPEN_CV_ELLIPSE_FIT
 
 //-- constants ----
 static const int k_min_roi_size= 32;
 
+// A shared video consumer that hasn't heartbeat its slot in this long is
+// presumed dead and its slot is reclaimed
+static const unsigned long long k_consumer_slot_stale_timeout_us= 5*1000*1000;
+
+// How far ahead of the last projection the filtered physics state gets
+// integrated when predicting the ROI center (~two 60Hz camera frames)
+static const float k_roi_prediction_lookahead_seconds= 0.033f;
+
+// Above this many active tracking colors, the per-channel LUT classifier
+// (constant cost per pixel) beats re-running the vector compare cascade
+// once per color in the labeling kernel
+static const int k_max_vectorized_label_color_count= 2;
+
+// When tracking is lost, candidate blobs get localized on a frame downscaled
+// by this factor before refining at native resolution
+static const int k_reacquisition_downscale= 4;
+
+// After this many consecutive frames where the coarse re-acquisition pass saw
+// nothing, escalate to one native full-frame search on that tracker alone -
+// the blob may just be too small to survive the downscale
+static const int k_max_coarse_reacquisition_failures= 30;
+
+// Minimum distance in front of a tracker for a cross-tracker re-acquisition
+// seed to be considered inside that tracker's view
+static const float k_min_handoff_seed_distance_cm= 10.f;
+
+// Pixels of slack added around captured static background exclusion areas so
+// that sensor noise at the blob edges stays inside the excluded region
+static const int k_exclusion_area_padding= 4;
+
+// Frames between blob HSV samples taken by the color auto-tuner
+// (sampling every frame buys nothing once the nudge rate is small)
+static const int k_color_auto_tuning_sample_period= 30;
+
+// Minimum number of blob interior samples needed before the auto-tuner
+// trusts the measured HSV averages
+static const int k_min_blob_hsv_sample_count= 16;
+
+// Two-stage color classifier: the per-blob chroma rejection stage only
+// engages for hue presets at least this wide. Tight presets don't produce
+// the flicker-widened false positives the second stage exists to catch
+static const float k_chroma_stage_min_hue_range= 10.f;
+
+// Fraction of the configured hue/saturation range a candidate blob's mean
+// chroma must sit within to survive the chroma rejection stage
+static const float k_chroma_core_fraction= 0.5f;
+
+// Exposure and gain candidates stepped through by the auto-exposure sweep
+static const double k_auto_exposure_sweep_exposures[]= {32., 64., 96., 128., 160., 192., 224.};
+static const int k_auto_exposure_sweep_exposure_count=
+    sizeof(k_auto_exposure_sweep_exposures) / sizeof(k_auto_exposure_sweep_exposures[0]);
+static const double k_auto_exposure_sweep_gains[]= {0., 16., 32., 48., 64.};
+static const int k_auto_exposure_sweep_gain_count=
+    sizeof(k_auto_exposure_sweep_gains) / sizeof(k_auto_exposure_sweep_gains[0]);
+
+// Frames to let the camera settle after a setting change before measuring
+// (changing a PS3Eye property can restart the frame grabber)
+static const int k_auto_exposure_settle_frames= 3;
+
+// Frames scored per candidate setting
+static const int k_auto_exposure_measure_frames= 2;
+
+// HSV value channel level above which a pixel counts as saturated for the
+// auto-exposure score (hue is meaningless on blown-out highlights)
+static const int k_auto_exposure_saturation_threshold= 250;
+
 //-- typedefs ----
 typedef std::vector<cv::Point> t_opencv_int_contour;
 typedef std::vector<t_opencv_int_contour> t_opencv_int_contour_list;
@@ -43,6 +126,27 @@ typedef std::vector<t_opencv_float_contour> t_opencv_float_contour_list;
 template<typename t_opencv_contour_type>
 cv::Point2f computeSafeCenterOfMassForContour(const t_opencv_contour_type &contour);
 
+template<typename t_opencv_contour_type>
+void decimateContourToPointBudget(t_opencv_contour_type &contour, const int max_point_count);
+
+//-- utility methods -----
+// Signed shortest angular distance between two hues on the OpenCV 0..180 circle
+static float wrapped_hue_difference(const float from_hue, const float to_hue)
+{
+    float diff= to_hue - from_hue;
+
+    while (diff > 90.f)
+    {
+        diff-= 180.f;
+    }
+    while (diff < -90.f)
+    {
+        diff+= 180.f;
+    }
+
+    return diff;
+}
+
 //-- private methods -----
 class SharedVideoFrameReadWriteAccessor
 {
@@ -50,6 +154,11 @@ public:
     SharedVideoFrameReadWriteAccessor()
         : m_shared_memory_object(nullptr)
         , m_region(nullptr)
+        , m_last_written_frame_index(0)
+        , m_full_width(0)
+        , m_full_height(0)
+        , m_full_stride(0)
+        , m_bHalfResolutionEnabled(false)
     {}
 
     ~SharedVideoFrameReadWriteAccessor()
@@ -68,6 +177,12 @@ public:
             // Remember the name of the shared memory
             m_shared_memory_name = shared_memory_name;
 
+            // Remember the native frame geometry - the block stays sized for
+            // full resolution even when publishing downscaled preview frames
+            m_full_width = width;
+            m_full_height = height;
+            m_full_stride = stride;
+
             // Make sure the shared memory block has been removed first
             boost::interprocess::shared_memory_object::remove(shared_memory_name);
 
@@ -89,18 +204,20 @@ public:
             // Map all of the shared memory for read/write access
             m_region = new boost::interprocess::mapped_region(*m_shared_memory_object, boost::interprocess::read_write);
 
+            // Apply any large-page / NUMA placement hints from the config
+            // before the first touch below faults the pages in
+            applyRegionPlacementHints();
+
             // Initialize the shared memory (call constructor using placement new)
-            // This make sure the mutex has the constructor called on it.
             SharedVideoFrameHeader *frameState = new (getFrameHeader()) SharedVideoFrameHeader();
             
             frameState->width = width;
             frameState->height = height;
             frameState->stride = stride;
-            frameState->frame_index = 0;
             std::memset(
-                frameState->getBufferMutable(),
+                frameState->getBufferMutable(0),
                 0,
-                SharedVideoFrameHeader::computeVideoBufferSize(stride, height));
+                SharedVideoFrameHeader::computeVideoBufferSize(stride, height)*SharedVideoFrameHeader::k_buffer_count);
 
             bSuccess = true;
         }
@@ -119,7 +236,6 @@ public:
         if (m_region != nullptr)
         {
             // Call the destructor manually on the frame header since it was constructed via placement new
-            // This will make sure the mutex has the destructor called on it.
             getFrameHeader()->~SharedVideoFrameHeader();
             
             delete m_region;
@@ -138,19 +254,74 @@ public:
         }
     }
 
+    void setHalfResolutionEnabled(bool bEnabled)
+    {
+        m_bHalfResolutionEnabled = bEnabled;
+    }
+
     void writeVideoFrame(const unsigned char *buffer)
     {
         SharedVideoFrameHeader *sharedFrameState = getFrameHeader();
-        boost::interprocess::scoped_lock<boost::interprocess::interprocess_mutex> lock(sharedFrameState->mutex);
 
-        size_t buffer_size = 
+        // Publish the geometry of the frames we're about to write.
+        // Readers re-derive their buffer layout from the header every poll,
+        // so a quality switch at worst costs them one discarded frame.
+        if (m_bHalfResolutionEnabled)
+        {
+            sharedFrameState->width = m_full_width / 2;
+            sharedFrameState->height = m_full_height / 2;
+            sharedFrameState->stride = (m_full_stride / m_full_width) * (m_full_width / 2);
+        }
+        else
+        {
+            sharedFrameState->width = m_full_width;
+            sharedFrameState->height = m_full_height;
+            sharedFrameState->stride = m_full_stride;
+        }
+
+        size_t buffer_size =
             SharedVideoFrameHeader::computeVideoBufferSize(sharedFrameState->stride, sharedFrameState->height);
         size_t total_shared_mem_size =
             SharedVideoFrameHeader::computeTotalSize(sharedFrameState->stride, sharedFrameState->height);
         assert(m_region->get_size() >= total_shared_mem_size);
 
-        ++sharedFrameState->frame_index;
-        std::memcpy(sharedFrameState->getBufferMutable(), buffer, buffer_size);
+        // Rotate to the next buffer so we never scribble over the one a
+        // reader is most likely copying from (the last published one)
+        const int write_buffer_index=
+            (sharedFrameState->last_written_buffer_index + 1) % SharedVideoFrameHeader::k_buffer_count;
+
+        ++sharedFrameState->write_sequence[write_buffer_index]; // odd: write in progress
+        sharedFrameState->frame_index[write_buffer_index]= ++m_last_written_frame_index;
+        sharedFrameState->capture_timestamp_us[write_buffer_index]=
+            static_cast<unsigned long long>(
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count());
+        if (m_bHalfResolutionEnabled)
+        {
+            downscaleVideoFrame(
+                buffer, sharedFrameState->getBufferMutable(write_buffer_index),
+                sharedFrameState->width, sharedFrameState->height, sharedFrameState->stride);
+        }
+        else
+        {
+            std::memcpy(sharedFrameState->getBufferMutable(write_buffer_index), buffer, buffer_size);
+        }
+        ++sharedFrameState->write_sequence[write_buffer_index]; // even: stable
+
+        sharedFrameState->last_written_buffer_index= write_buffer_index;
+        ++sharedFrameState->write_generation;
+
+        // Free any consumer slots whose owner stopped heartbeating
+        // (a crashed configtool would otherwise pin its slot until the
+        // stream restarts)
+        sharedFrameState->reclaimStaleConsumerSlots(
+            sharedFrameState->capture_timestamp_us[write_buffer_index],
+            k_consumer_slot_stale_timeout_us);
+    }
+
+    inline int getWrittenFrameCount() const
+    {
+        return m_last_written_frame_index;
     }
 
 protected:
@@ -159,10 +330,102 @@ protected:
         return reinterpret_cast<SharedVideoFrameHeader *>(m_region->get_address());
     }
 
+    // Apply the optional page placement hints from the tracker manager config
+    // to the freshly mapped region. Only effective on Linux: transparent huge
+    // pages via madvise(MADV_HUGEPAGE) and NUMA node binding via the mbind
+    // syscall (invoked directly so the build doesn't grow a libnuma
+    // dependency). Both are best-effort - on failure the kernel's default
+    // placement stands and the frame stream still works.
+    void applyRegionPlacementHints()
+    {
+        const TrackerManagerConfig &cfg = DeviceManager::getInstance()->m_tracker_manager->getConfig();
+
+#ifdef __linux__
+        void *address = m_region->get_address();
+        const size_t size = m_region->get_size();
+
+        if (cfg.shared_memory_use_large_pages)
+        {
+            if (madvise(address, size, MADV_HUGEPAGE) != 0)
+            {
+                SERVER_LOG_WARNING("SharedMemory::initialize()")
+                    << "MADV_HUGEPAGE failed on " << m_shared_memory_name;
+            }
+        }
+
+        if (cfg.shared_memory_numa_node >= 0 &&
+            cfg.shared_memory_numa_node < static_cast<int>(sizeof(unsigned long)*8))
+        {
+            // Values from linux/mempolicy.h (not exported by the libc headers)
+            const int k_mpol_bind = 2;
+            const unsigned int k_mpol_mf_move = 2;
+            const unsigned long nodemask = 1UL << cfg.shared_memory_numa_node;
+
+            if (syscall(
+                    SYS_mbind, address, size, k_mpol_bind,
+                    &nodemask, sizeof(nodemask)*8 + 1, k_mpol_mf_move) != 0)
+            {
+                SERVER_LOG_WARNING("SharedMemory::initialize()")
+                    << "mbind of " << m_shared_memory_name
+                    << " to NUMA node " << cfg.shared_memory_numa_node << " failed";
+            }
+        }
+#else
+        if (cfg.shared_memory_use_large_pages || cfg.shared_memory_numa_node >= 0)
+        {
+            SERVER_LOG_WARNING("SharedMemory::initialize()")
+                << "Shared memory placement hints are only supported on Linux";
+        }
+#endif
+    }
+
+    // 2x2 box filter from the full resolution source into the shared buffer.
+    // Works per byte-channel so it handles any fixed bytes-per-pixel layout.
+    void downscaleVideoFrame(
+        const unsigned char *source, unsigned char *dest,
+        int dest_width, int dest_height, int dest_stride)
+    {
+        const int bytes_per_pixel = m_full_stride / m_full_width;
+
+        for (int dest_y = 0; dest_y < dest_height; ++dest_y)
+        {
+            const unsigned char *source_row0 = source + (dest_y*2)*m_full_stride;
+            const unsigned char *source_row1 = source_row0 + m_full_stride;
+            unsigned char *dest_row = dest + dest_y*dest_stride;
+
+            for (int dest_x = 0; dest_x < dest_width; ++dest_x)
+            {
+                const int source_offset = (dest_x*2)*bytes_per_pixel;
+
+                for (int channel = 0; channel < bytes_per_pixel; ++channel)
+                {
+                    const unsigned int sum =
+                        (unsigned int)source_row0[source_offset + channel] +
+                        (unsigned int)source_row0[source_offset + bytes_per_pixel + channel] +
+                        (unsigned int)source_row1[source_offset + channel] +
+                        (unsigned int)source_row1[source_offset + bytes_per_pixel + channel];
+
+                    dest_row[dest_x*bytes_per_pixel + channel] = (unsigned char)(sum / 4);
+                }
+            }
+        }
+    }
+
 private:
     const char *m_shared_memory_name;
     boost::interprocess::shared_memory_object *m_shared_memory_object;
     boost::interprocess::mapped_region *m_region;
+
+    // Native frame geometry captured at initialization
+    int m_full_width;
+    int m_full_height;
+    int m_full_stride;
+
+    // True while every subscriber asked for the half resolution preview
+    bool m_bHalfResolutionEnabled;
+
+    // Monotonic counter stamped into each written buffer, writer side only
+    int m_last_written_frame_index;
 };
 
 struct OpenCVPlane2D
@@ -332,16 +595,88 @@ private:
 OpenCVBGRToHSVMapper *OpenCVBGRToHSVMapper::m_instance = nullptr;
 int OpenCVBGRToHSVMapper::m_refCount= 0;
 
+/// Fused debayer + HSV conversion over an ROI of a raw Bayer frame.
+/// Thin cv::Mat adapter over the raw-buffer kernel in TrackerVisionKernels.
+/// The ROI must be even-aligned so the Bayer phase is preserved.
+static void fusedBayerGBToHSV(const cv::Mat &bayerROI, cv::Mat &hsvROI)
+{
+    assert(bayerROI.type() == CV_8UC1);
+    assert(hsvROI.type() == CV_8UC3);
+    assert(bayerROI.rows == hsvROI.rows && bayerROI.cols == hsvROI.cols);
+
+    fusedBayerGBToHSV(
+        bayerROI.ptr<unsigned char>(0), bayerROI.step,
+        hsvROI.ptr<unsigned char>(0), hsvROI.step,
+        bayerROI.cols, bayerROI.rows);
+}
+
+/// Convert a calibrated HSV color range into the byte-valued threshold used
+/// by the single-pass masking kernels. A hue range that crosses either end of
+/// the hue circle gets folded into the kernel's wrap convention (hue_min > hue_max).
+static void hsvColorRangeToThreshold(const CommonHSVColorRange &hsvColorRange, HSVRangeThreshold &threshold)
+{
+    const float hue_min = hsvColorRange.hue_range.center - hsvColorRange.hue_range.range;
+    const float hue_max = hsvColorRange.hue_range.center + hsvColorRange.hue_range.range;
+
+    threshold.saturation_min = static_cast<unsigned char>(clampf(hsvColorRange.saturation_range.center - hsvColorRange.saturation_range.range, 0, 255));
+    threshold.saturation_max = static_cast<unsigned char>(clampf(hsvColorRange.saturation_range.center + hsvColorRange.saturation_range.range, 0, 255));
+    threshold.value_min = static_cast<unsigned char>(clampf(hsvColorRange.value_range.center - hsvColorRange.value_range.range, 0, 255));
+    threshold.value_max = static_cast<unsigned char>(clampf(hsvColorRange.value_range.center + hsvColorRange.value_range.range, 0, 255));
+
+    if (hsvColorRange.hue_range.range >= 90)
+    {
+        // The range spans the whole hue circle (the calibration UI clamps the
+        // slider to [0,90], and 90 is reachable). Folding it would collapse to
+        // hue_min == hue_max, which the kernels read as a single-hue test, so
+        // emit the full [0,180] interval explicitly instead.
+        threshold.hue_min = 0;
+        threshold.hue_max = 180;
+    }
+    else if (hue_min < 0)
+    {
+        // Wrap: [180 + hue_min, 180] U [0, hue_max]
+        threshold.hue_min = static_cast<unsigned char>(clampf(180 + hue_min, 0, 180));
+        threshold.hue_max = static_cast<unsigned char>(clampf(hue_max, 0, 180));
+    }
+    else if (hue_max > 180)
+    {
+        // Wrap: [hue_min, 180] U [0, hue_max - 180]
+        threshold.hue_min = static_cast<unsigned char>(clampf(hue_min, 0, 180));
+        threshold.hue_max = static_cast<unsigned char>(clampf(hue_max - 180, 0, 180));
+    }
+    else
+    {
+        threshold.hue_min = static_cast<unsigned char>(hue_min);
+        threshold.hue_max = static_cast<unsigned char>(hue_max);
+    }
+}
+
+// Defined at the bottom of this file; needed when building the per-tracker
+// undistortion map (see TrackerUndistortionLUT in PSMoveTracker)
+static void computeOpenCVCameraIntrinsicMatrix(const ITrackerInterface *tracker_device,
+                                               cv::Matx33f &intrinsicOut,
+                                               cv::Matx<float, 5, 1> &distortionOut);
+
 class OpenCVBufferState
 {
 public:
     OpenCVBufferState(ITrackerInterface *device)
-        : bgrBuffer(nullptr)
+        : bWriteShmemFrame(false)
+        , bBayerSource(device->getIsVideoFrameBayer())
+        , bgrBuffer(nullptr)
         , bgrShmemBuffer(nullptr)
         , hsvBuffer(nullptr)
         , gsLowerBuffer(nullptr)
         , gsUpperBuffer(nullptr)
         , maskedBuffer(nullptr)
+        , labelBuffer(nullptr)
+        , maskSmallBuffer(nullptr)
+        , bCoarseRGBBoundsValid(false)
+        , active_color_count(0)
+        , bLabelMaskValid(false)
+        , bHsvValid(false)
+        , exclusion_rect_count(0)
+        , undistort_lut(nullptr)
     {
         device->getVideoFrameDimensions(&frameWidth, &frameHeight, nullptr);
 
@@ -351,9 +686,31 @@ public:
         gsLowerBuffer = new cv::Mat(frameHeight, frameWidth, CV_8UC1);
         gsUpperBuffer = new cv::Mat(frameHeight, frameWidth, CV_8UC1);
         maskedBuffer = new cv::Mat(frameHeight, frameWidth, CV_8UC3);
-        
+        labelBuffer = new cv::Mat(frameHeight, frameWidth, CV_8UC1);
+
+        // Downscaled scratch mask for the coarse re-acquisition pass
+        const int smallWidth = frameWidth / k_reacquisition_downscale;
+        const int smallHeight = frameHeight / k_reacquisition_downscale;
+        maskSmallBuffer = new cv::Mat(smallHeight, smallWidth, CV_8UC1);
+
+        // Load (or build and persist) the undistortion map for this calibration
+        {
+            cv::Matx33f camera_matrix;
+            cv::Matx<float, 5, 1> distortions;
+            computeOpenCVCameraIntrinsicMatrix(device, camera_matrix, distortions);
+
+            undistort_lut =
+                new TrackerUndistortionLUT(
+                    camera_matrix, distortions,
+                    frameWidth, frameHeight,
+                    PSMoveConfig::getConfigDirPath());
+        }
+
+
         const TrackerManagerConfig &cfg= DeviceManager::getInstance()->m_tracker_manager->getConfig();
-        if (cfg.use_bgr_to_hsv_lookup_table)
+        // The BGR->HSV lookup table is only useful when the device delivers
+        // BGR frames; Bayer sources convert straight to HSV
+        if (!bBayerSource && cfg.use_bgr_to_hsv_lookup_table)
         {
             bgr2hsv = OpenCVBGRToHSVMapper::allocate();
         }
@@ -368,6 +725,21 @@ public:
 
     virtual ~OpenCVBufferState()
     {
+        if (undistort_lut != nullptr)
+        {
+            delete undistort_lut;
+        }
+
+        if (maskSmallBuffer != nullptr)
+        {
+            delete maskSmallBuffer;
+        }
+
+        if (labelBuffer != nullptr)
+        {
+            delete labelBuffer;
+        }
+
         if (maskedBuffer != nullptr)
         {
             delete maskedBuffer;
@@ -406,16 +778,71 @@ public:
 
     void writeVideoFrame(const unsigned char *video_buffer)
     {
-        const cv::Mat videoBufferMat(frameHeight, frameWidth, CV_8UC3, const_cast<unsigned char *>(video_buffer));
+        // Any cached color labeling or HSV conversion refers to the previous frame
+        bLabelMaskValid = false;
+        bHsvValid = false;
+
+        // Wrap the device's frame buffer directly rather than copying it.
+        // The buffer stays valid until the device gets polled again, which is
+        // after all projection work for this frame has completed.
+        if (bBayerSource)
+        {
+            bayerFrame = cv::Mat(frameHeight, frameWidth, CV_8UC1, const_cast<unsigned char *>(video_buffer));
+
+            // The BGR image is only produced lazily for the shared memory
+            // video feed. The tracking pipeline debayers straight to HSV.
+            if (bWriteShmemFrame)
+            {
+                cv::cvtColor(bayerFrame, *bgrShmemBuffer, cv::COLOR_BayerGB2BGR);
+            }
+        }
+        else
+        {
+            *bgrBuffer = cv::Mat(frameHeight, frameWidth, CV_8UC3, const_cast<unsigned char *>(video_buffer));
 
-		videoBufferMat.copyTo(*bgrBuffer);
-        videoBufferMat.copyTo(*bgrShmemBuffer);
+            // The shared memory buffer still needs a private copy since debug
+            // overlays get drawn on top of it before it gets published to clients.
+            // Skip the copy entirely while no client is subscribed to the video feed.
+            if (bWriteShmemFrame)
+            {
+                bgrBuffer->copyTo(*bgrShmemBuffer);
+            }
+        }
     }
-    
+
+    /// BGR view of the current frame for the session recorder. For bayer
+    /// sources this debayers on demand when no video client already paid
+    /// for the conversion this frame - only call for frames that will
+    /// actually be recorded.
+    const cv::Mat *getBgrFrameForCapture()
+    {
+        if (bBayerSource)
+        {
+            if (!bWriteShmemFrame)
+            {
+                cv::cvtColor(bayerFrame, *bgrShmemBuffer, cv::COLOR_BayerGB2BGR);
+            }
+
+            return bgrShmemBuffer;
+        }
+
+        return bgrBuffer;
+    }
+
     void updateHsvBuffer()
     {
         // Convert the video buffer to the HSV color space
-        if (bgr2hsv != nullptr)
+        if (bBayerSource)
+        {
+            // No frame polled yet
+            if (bayerROI.empty())
+            {
+                return;
+            }
+
+            fusedBayerGBToHSV(bayerROI, hsvROI);
+        }
+        else if (bgr2hsv != nullptr)
         {
             bgr2hsv->cvtColor(bgrROI, hsvROI);
         }
@@ -447,150 +874,680 @@ public:
         {
             ROI.y = std::max(frameHeight - ROI.height, 0);
         }
-        
+
+        // Keep the ROI even-aligned so the Bayer phase is preserved for the
+        // fused debayer + HSV conversion
+        if (bBayerSource)
+        {
+            ROI.x &= ~1;
+            ROI.y &= ~1;
+            ROI.width = std::max(ROI.width & ~1, 2);
+            ROI.height = std::max(ROI.height & ~1, 2);
+        }
+
         //Create the ROI matrices.
         //It's not a full copy, so this isn't too slow.
         //adjustROI is probably slightly faster but I ran into trouble with it.
-        bgrROI = cv::Mat(*bgrBuffer, ROI);
+        if (bBayerSource)
+        {
+            bayerROI = !bayerFrame.empty() ? cv::Mat(bayerFrame, ROI) : cv::Mat();
+        }
+        else
+        {
+            bgrROI = cv::Mat(*bgrBuffer, ROI);
+        }
         hsvROI = cv::Mat(*hsvBuffer, ROI);
         gsLowerROI = cv::Mat(*gsLowerBuffer, ROI);
         gsUpperROI = cv::Mat(*gsUpperBuffer, ROI);
-        
-        updateHsvBuffer();
-        
+        labelROI = cv::Mat(*labelBuffer, ROI);
+        currentROI = ROI;
+
+        // hsvBuffer is a persistent full-frame buffer, so when a superset
+        // region was already converted this frame (the shared segmentation
+        // pre-pass over the union of the tracked devices' ROIs) the pixels
+        // under this ROI are still valid and the conversion can be skipped.
+        if (!bHsvValid || (hsvValidRect & ROI) != ROI)
+        {
+            updateHsvBuffer();
+            hsvValidRect = ROI;
+            bHsvValid = !bBayerSource || !bayerROI.empty();
+        }
+
         //Draw ROI.
-        cv::rectangle(*bgrShmemBuffer, ROI, cv::Scalar(255, 0, 0));
+        if (bWriteShmemFrame)
+        {
+            cv::rectangle(*bgrShmemBuffer, ROI, cv::Scalar(255, 0, 0));
+        }
     }
 
-    // Return points in raw image space:
-    // i.e. [0, 0] at lower left  to [frameWidth-1, frameHeight-1] at lower right
-    bool computeBiggestNContours(
+    /// Classify the current ROI against every active tracking color in a
+    /// single traversal and cache the label image. Later mask extractions
+    /// over a region the cache covers become a byte-compare against the
+    /// label image instead of another walk over the HSV pixels. No-op when
+    /// fewer than two colors are active or the cache already covers the
+    /// current ROI.
+    void prelabelCurrentROI()
+    {
+        if (active_color_count <= 1)
+        {
+            return;
+        }
+
+        if (bLabelMaskValid && (labelMaskRect & currentROI) == currentROI)
+        {
+            return;
+        }
+
+        if (active_color_count > k_max_vectorized_label_color_count)
+        {
+            // Classification cost per pixel is three table loads
+            // and two ANDs no matter how many colors are active
+            computeHSVColorLabelMaskLUT(
+                hsvROI.ptr<unsigned char>(0), hsvROI.step,
+                labelROI.ptr<unsigned char>(0), labelROI.step,
+                hsvROI.cols, hsvROI.rows,
+                active_color_class_lut,
+                active_color_labels);
+        }
+        else
+        {
+            computeHSVColorLabelMask(
+                hsvROI.ptr<unsigned char>(0), hsvROI.step,
+                labelROI.ptr<unsigned char>(0), labelROI.step,
+                hsvROI.cols, hsvROI.rows,
+                active_color_thresholds,
+                active_color_labels,
+                active_color_count);
+        }
+        bLabelMaskValid = true;
+        labelMaskRect = currentROI;
+    }
+
+    /// Localize candidate blobs of the given color on a downscaled copy of
+    /// the frame. Used instead of a native-resolution full-frame scan when
+    /// tracking was lost. On success out_roi is the padded full-resolution
+    /// neighborhood around the biggest candidates; returns false when
+    /// nothing resembling the color is anywhere in the frame, in which case
+    /// the native-resolution scan can be skipped entirely.
+    bool computeCoarseReacquisitionROI(
         const CommonHSVColorRange &hsvColorRange,
-		t_opencv_int_contour_list &out_biggest_N_contours,
-        std::vector<double> &out_contour_areas,
-		const int max_contour_count,
-        const int min_points_in_contour = 6)
+        const int max_candidate_count,
+        cv::Rect2i &out_roi)
     {
-        out_biggest_N_contours.clear();
-        out_contour_areas.clear();
-        
-        // Clamp the HSV image, taking into account wrapping the hue angle
+        HSVRangeThreshold threshold;
+        hsvColorRangeToThreshold(hsvColorRange, threshold);
+
+        // Re-derive the cached RGB box only when the color threshold changed
+        if (!bCoarseRGBBoundsValid ||
+            memcmp(&threshold, &coarse_bounds_source_threshold, sizeof(HSVRangeThreshold)) != 0)
         {
-            const float hue_min = hsvColorRange.hue_range.center - hsvColorRange.hue_range.range;
-            const float hue_max = hsvColorRange.hue_range.center + hsvColorRange.hue_range.range;
-            const float saturation_min = clampf(hsvColorRange.saturation_range.center - hsvColorRange.saturation_range.range, 0, 255);
-            const float saturation_max = clampf(hsvColorRange.saturation_range.center + hsvColorRange.saturation_range.range, 0, 255);
-            const float value_min = clampf(hsvColorRange.value_range.center - hsvColorRange.value_range.range, 0, 255);
-            const float value_max = clampf(hsvColorRange.value_range.center + hsvColorRange.value_range.range, 0, 255);
+            hsvRangeThresholdToRGBBounds(threshold, coarse_rgb_bounds);
+            coarse_bounds_source_threshold = threshold;
+            bCoarseRGBBoundsValid = true;
+        }
 
-            if (hue_min < 0)
-            {
-                cv::inRange(
-                    hsvROI,
-                    cv::Scalar(0, saturation_min, value_min),
-                    cv::Scalar(clampf(hue_max, 0, 180), saturation_max, value_max),
-                    gsLowerROI);
-                cv::inRange(
-                    hsvROI,
-                    cv::Scalar(clampf(180 + hue_min, 0, 180), saturation_min, value_min),
-                    cv::Scalar(180, saturation_max, value_max),
-                    gsUpperROI);
-                cv::bitwise_or(gsLowerROI, gsUpperROI, gsLowerROI);
-            }
-            else if (hue_max > 180)
+        // Classify the coarse level with integer compares straight off the
+        // source pixels against the RGB box - no demosaic buffer and no HSV
+        // conversion at this level. The box is a conservative superset of
+        // the HSV range, so a candidate can only grow, never vanish; the
+        // fine pass over the returned ROI still applies the exact HSV test.
+        if (bBayerSource)
+        {
+            if (bayerFrame.empty())
             {
-                cv::inRange(
-                    hsvROI,
-                    cv::Scalar(0, saturation_min, value_min),
-                    cv::Scalar(clampf(hue_max - 180, 0, 180), saturation_max, value_max),
-                    gsLowerROI);
-                cv::inRange(
-                    hsvROI,
-                    cv::Scalar(clampf(hue_min, 0, 180), saturation_min, value_min),
-                    cv::Scalar(180, saturation_max, value_max),
-                    gsUpperROI);
-                cv::bitwise_or(gsLowerROI, gsUpperROI, gsLowerROI);
+                return false;
             }
-            else
+
+            computeBayerGBRGBRangeMaskDecimated(
+                bayerFrame.ptr<unsigned char>(0), bayerFrame.step,
+                bayerFrame.cols, bayerFrame.rows,
+                maskSmallBuffer->ptr<unsigned char>(0), maskSmallBuffer->step,
+                maskSmallBuffer->cols, maskSmallBuffer->rows,
+                k_reacquisition_downscale,
+                coarse_rgb_bounds);
+        }
+        else
+        {
+            computeBGRRGBRangeMaskDecimated(
+                bgrBuffer->ptr<unsigned char>(0), bgrBuffer->step,
+                bgrBuffer->cols, bgrBuffer->rows,
+                maskSmallBuffer->ptr<unsigned char>(0), maskSmallBuffer->step,
+                maskSmallBuffer->cols, maskSmallBuffer->rows,
+                k_reacquisition_downscale,
+                coarse_rgb_bounds);
+        }
+
+        // The coarse pass must ignore the static background areas too, or
+        // re-acquisition locks onto the very reflections being excluded
+        for (int rect_index = 0; rect_index < exclusion_rect_count; ++rect_index)
+        {
+            const cv::Rect2i &rect = exclusion_rects[rect_index];
+            const cv::Rect2i small_rect =
+                cv::Rect2i(
+                    rect.x / k_reacquisition_downscale,
+                    rect.y / k_reacquisition_downscale,
+                    (rect.width + k_reacquisition_downscale - 1) / k_reacquisition_downscale,
+                    (rect.height + k_reacquisition_downscale - 1) / k_reacquisition_downscale) &
+                cv::Rect2i(0, 0, maskSmallBuffer->cols, maskSmallBuffer->rows);
+
+            if (small_rect.width > 0 && small_rect.height > 0)
             {
-                cv::inRange(
-                    hsvROI,
-                    cv::Scalar(hue_min, saturation_min, value_min),
-                    cv::Scalar(hue_max, saturation_max, value_max),
-                    gsLowerROI);
+                (*maskSmallBuffer)(small_rect).setTo(cv::Scalar(0));
             }
         }
-        
-        //TODO: Why no blurring of the gsLowerBuffer?
 
-        // Find the largest convex blob in the filtered grayscale buffer
-        {
-			struct ContourInfo
-			{
-				int contour_index;
-				double contour_area;
-			};
-			std::vector<ContourInfo> sorted_contour_list;
+        t_opencv_int_contour_list &contours = scratch_contours;
+        contours.clear();
+        cv::findContours(*maskSmallBuffer,
+                         contours,
+                         CV_RETR_EXTERNAL,
+                         CV_CHAIN_APPROX_SIMPLE);
 
-			// Find all counters in the image buffer
-            cv::Size size; cv::Point ofs;
-            gsLowerROI.locateROI(size, ofs);
-			t_opencv_int_contour_list contours;
-            cv::findContours(gsLowerROI,
-                             contours,
-                             CV_RETR_EXTERNAL,
-                             CV_CHAIN_APPROX_SIMPLE,  //CV_CHAIN_APPROX_NONE?
-                             ofs);
+        if (contours.empty())
+        {
+            return false;
+        }
 
-			// Compute the area of each contour
-			int contour_index = 0;
-            for (auto it = contours.begin(); it != contours.end(); ++it) 
+        // Sort the candidates by area, largest first
+        std::vector<ContourInfo> &sorted_contour_list = scratch_contour_infos;
+        sorted_contour_list.clear();
+        {
+            int contour_index = 0;
+            for (auto it = contours.begin(); it != contours.end(); ++it)
             {
-				const double contour_area = cv::contourArea(*it);
-				const ContourInfo contour_info = { contour_index, contour_area };
+                const ContourInfo contour_info = { contour_index, cv::contourArea(*it) };
 
-				sorted_contour_list.push_back(contour_info);
-				++contour_index;
+                sorted_contour_list.push_back(contour_info);
+                ++contour_index;
             }
-			
-			// Sort the list of contours by area, largest to smallest
-			if (sorted_contour_list.size() > 1)
-			{
-				std::sort(
-					sorted_contour_list.begin(), sorted_contour_list.end(), 
-					[](const ContourInfo &a, const ContourInfo &b) {
-						return b.contour_area < a.contour_area;
-				});
-			}
 
-			// Copy up to N valid contours
-			for (auto it = sorted_contour_list.begin(); 
-				it != sorted_contour_list.end() && static_cast<int>(out_biggest_N_contours.size()) < max_contour_count; 
-				++it)
-			{
-				const ContourInfo &contour_info = *it;
-				t_opencv_int_contour &contour = contours[contour_info.contour_index];
+            if (sorted_contour_list.size() > 1)
+            {
+                std::sort(
+                    sorted_contour_list.begin(), sorted_contour_list.end(),
+                    [](const ContourInfo &a, const ContourInfo &b) {
+                        return b.contour_area < a.contour_area;
+                });
+            }
+        }
 
-                if (contour.size() > min_points_in_contour)
-				{
-					// Remove any points in contour on edge of camera/ROI
-                    // TODO: Contours touching image border will be clipped,
-                    // so this might not be necessary.
-					t_opencv_int_contour::iterator it = contour.begin();
-					while (it != contour.end()) 
-					{
-						if (it->x == 0 || it->x == (frameWidth - 1) || it->y == 0 || it->y == (frameHeight - 1))
-						{
-							it = contour.erase(it);
-						}
-						else
-						{
-							++it;
-						}
-					}
+        // Union the bounding boxes of the N biggest candidates,
+        // scaled back up to native resolution and padded
+        cv::Rect2i union_rect;
+        int candidate_count = 0;
+        for (auto it = sorted_contour_list.begin();
+            it != sorted_contour_list.end() && candidate_count < max_candidate_count;
+            ++it, ++candidate_count)
+        {
+            const cv::Rect2i coarse_rect = cv::boundingRect(contours[it->contour_index]);
+            const cv::Rect2i full_res_rect(
+                coarse_rect.x*k_reacquisition_downscale - k_min_roi_size/2,
+                coarse_rect.y*k_reacquisition_downscale - k_min_roi_size/2,
+                coarse_rect.width*k_reacquisition_downscale + k_min_roi_size,
+                coarse_rect.height*k_reacquisition_downscale + k_min_roi_size);
+
+            union_rect = (candidate_count == 0) ? full_res_rect : (union_rect | full_res_rect);
+        }
 
-					// Add cleaned up contour to the output list
-					out_biggest_N_contours.push_back(contour);
+        out_roi = union_rect;
+
+        return true;
+    }
+
+    /// Set the list of tracking colors claimed by tracked devices this tick.
+    /// Invalidates any cached labeling if the set changed.
+    void setActiveColorSet(
+        const eCommonTrackingColorID *color_ids,
+        const HSVRangeThreshold *thresholds,
+        int color_count)
+    {
+        bool bSetChanged = (color_count != active_color_count);
+
+        for (int color_index = 0; !bSetChanged && color_index < color_count; ++color_index)
+        {
+            bSetChanged =
+                color_ids[color_index] != active_color_ids[color_index] ||
+                memcmp(&thresholds[color_index], &active_color_thresholds[color_index], sizeof(HSVRangeThreshold)) != 0;
+        }
+
+        if (bSetChanged)
+        {
+            bLabelMaskValid = false;
+        }
+
+        for (int color_index = 0; color_index < color_count; ++color_index)
+        {
+            active_color_ids[color_index] = color_ids[color_index];
+            active_color_thresholds[color_index] = thresholds[color_index];
+            active_color_labels[color_index] = static_cast<unsigned char>(color_index + 1);
+        }
+        active_color_count = color_count;
+
+        // Refresh the table classifier whenever a preset or the set changes.
+        // Building it is just a few hundred byte writes, so it isn't worth
+        // tracking more granular dirty state.
+        if (bSetChanged && color_count > k_max_vectorized_label_color_count)
+        {
+            buildHSVColorClassLUT(active_color_thresholds, active_color_count, active_color_class_lut);
+        }
+    }
+
+    /// Set the static background areas whose pixels never reach findContours
+    void setExclusionAreas(
+        const CommonScreenRect *areas,
+        int area_count)
+    {
+        const cv::Rect2i frame_rect(0, 0, frameWidth, frameHeight);
+
+        exclusion_rect_count = 0;
+        for (int area_index = 0;
+            area_index < area_count && exclusion_rect_count < ITrackerInterface::MAX_EXCLUSION_AREAS;
+            ++area_index)
+        {
+            const CommonScreenRect &area = areas[area_index];
+            const cv::Rect2i rect =
+                cv::Rect2i(
+                    static_cast<int>(area.x), static_cast<int>(area.y),
+                    static_cast<int>(area.w), static_cast<int>(area.h)) & frame_rect;
+
+            if (rect.width > 0 && rect.height > 0)
+            {
+                exclusion_rects[exclusion_rect_count] = rect;
+                ++exclusion_rect_count;
+            }
+        }
+
+        // Any cached labeling was computed without the new exclusions
+        bLabelMaskValid = false;
+    }
+
+    /// Zero the exclusion areas out of a binary mask bound to the current ROI
+    void maskOutExclusionAreas(cv::Mat &maskROI)
+    {
+        for (int rect_index = 0; rect_index < exclusion_rect_count; ++rect_index)
+        {
+            const cv::Rect2i overlap = exclusion_rects[rect_index] & currentROI;
+
+            if (overlap.width > 0 && overlap.height > 0)
+            {
+                // Translate into ROI-local coordinates
+                const cv::Rect2i local_rect(
+                    overlap.x - currentROI.x, overlap.y - currentROI.y,
+                    overlap.width, overlap.height);
+
+                maskROI(local_rect).setTo(cv::Scalar(0));
+            }
+        }
+    }
+
+    // Zero the given connected component out of the threshold mask so it
+    // never reaches findContours (bounded by the component's stat bbox)
+    void scrubComponentFromMask(const int label)
+    {
+        const int left = scratch_component_stats.at<int>(label, cv::CC_STAT_LEFT);
+        const int top = scratch_component_stats.at<int>(label, cv::CC_STAT_TOP);
+        const int right = left + scratch_component_stats.at<int>(label, cv::CC_STAT_WIDTH);
+        const int bottom = top + scratch_component_stats.at<int>(label, cv::CC_STAT_HEIGHT);
+
+        for (int y = top; y < bottom; ++y)
+        {
+            const int *label_row = scratch_component_labels.ptr<int>(y);
+            unsigned char *mask_row = gsLowerROI.ptr<unsigned char>(y);
+
+            for (int x = left; x < right; ++x)
+            {
+                if (label_row[x] == label)
+                {
+                    mask_row[x] = 0;
+                }
+            }
+        }
+    }
+
+    // Mean chroma of one connected component, walked over its stat bbox.
+    // Hue accumulates as a signed offset from the given reference hue so
+    // blobs straddling the 0/180 wrap average correctly.
+    // Returns false for a degenerate (empty) component.
+    bool computeComponentChromaMean(
+        const int label,
+        const float reference_hue,
+        float &out_mean_hue_offset,
+        float &out_mean_saturation)
+    {
+        const int left = scratch_component_stats.at<int>(label, cv::CC_STAT_LEFT);
+        const int top = scratch_component_stats.at<int>(label, cv::CC_STAT_TOP);
+        const int right = left + scratch_component_stats.at<int>(label, cv::CC_STAT_WIDTH);
+        const int bottom = top + scratch_component_stats.at<int>(label, cv::CC_STAT_HEIGHT);
+
+        float hue_offset_sum = 0.f;
+        float saturation_sum = 0.f;
+        int pixel_count = 0;
+
+        for (int y = top; y < bottom; ++y)
+        {
+            const int *label_row = scratch_component_labels.ptr<int>(y);
+            const unsigned char *hsv_row = hsvROI.ptr<unsigned char>(y);
+
+            for (int x = left; x < right; ++x)
+            {
+                if (label_row[x] != label)
+                {
+                    continue;
+                }
+
+                const unsigned char *hsv_pixel = hsv_row + 3*x;
+
+                hue_offset_sum += wrapped_hue_difference(reference_hue, static_cast<float>(hsv_pixel[0]));
+                saturation_sum += static_cast<float>(hsv_pixel[1]);
+                ++pixel_count;
+            }
+        }
+
+        if (pixel_count <= 0)
+        {
+            return false;
+        }
+
+        out_mean_hue_offset = hue_offset_sum / static_cast<float>(pixel_count);
+        out_mean_saturation = saturation_sum / static_cast<float>(pixel_count);
+
+        return true;
+    }
+
+    // Return points in raw image space:
+    // i.e. [0, 0] at lower left  to [frameWidth-1, frameHeight-1] at lower right
+    bool computeBiggestNContours(
+        const eCommonTrackingColorID tracked_color_id,
+        const CommonHSVColorRange &hsvColorRange,
+		t_opencv_int_contour_list &out_biggest_N_contours,
+        std::vector<double> &out_contour_areas,
+		const int max_contour_count,
+        const float prior_projection_area = -1.f,
+        const int min_points_in_contour = 6)
+    {
+        out_biggest_N_contours.clear();
+        out_contour_areas.clear();
+        
+        // Clamp the HSV image, taking into account wrapping the hue angle.
+        // The single-pass kernels handle the hue wrap internally (hue_min > hue_max),
+        // so no second cv::inRange pass or bitwise_or over the ROI is needed.
+        {
+            // When multiple tracking colors are active, classify the ROI
+            // against all of them in a single traversal and cache the label
+            // image. Later devices whose ROI falls inside the labeled region
+            // this frame get their binary mask with a byte-compare instead
+            // of another walk over the HSV pixels.
+            int active_color_index = -1;
+            if (active_color_count > 1)
+            {
+                for (int color_index = 0; color_index < active_color_count; ++color_index)
+                {
+                    if (active_color_ids[color_index] == tracked_color_id)
+                    {
+                        active_color_index = color_index;
+                        break;
+                    }
+                }
+            }
+
+            if (active_color_index != -1)
+            {
+                prelabelCurrentROI();
+
+                cv::compare(
+                    labelROI,
+                    cv::Scalar(active_color_labels[active_color_index]),
+                    gsLowerROI,
+                    cv::CMP_EQ);
+            }
+            else
+            {
+                HSVRangeThreshold threshold;
+                hsvColorRangeToThreshold(hsvColorRange, threshold);
+
+                computeHSVRangeMask(
+                    hsvROI.ptr<unsigned char>(0), hsvROI.step,
+                    gsLowerROI.ptr<unsigned char>(0), gsLowerROI.step,
+                    hsvROI.cols, hsvROI.rows,
+                    threshold);
+            }
+        }
+
+        // Never let blobs from static background reflections reach findContours
+        if (exclusion_rect_count > 0)
+        {
+            maskOutExclusionAreas(gsLowerROI);
+        }
+
+        // Single-pass connected component prescreen. Under venue lighting
+        // flicker the threshold mask can contain hundreds of pixel-scale
+        // speckles, and findContours materializes (and contourArea measures
+        // and the sort below ranks) a polygon for every one of them. Label
+        // the mask once with per-component area stats and scrub the
+        // components that could never survive the contour filters below, so
+        // only real blob candidates reach the contour stage.
+        {
+            const int component_count = cv::connectedComponentsWithStats(
+                gsLowerROI,
+                scratch_component_labels,
+                scratch_component_stats,
+                scratch_component_centroids,
+                8, CV_32S);
+
+            // Completely empty mask - don't bother running findContours
+            if (component_count <= 1)
+            {
+                return false;
+            }
+
+            std::vector<ComponentScore> &candidate_components = scratch_component_scores;
+            candidate_components.clear();
+
+            for (int label = 1; label < component_count; ++label)
+            {
+                // A component of N pixels yields at most N contour points,
+                // so anything at or below the point count threshold would
+                // get dropped after materialization anyway
+                if (scratch_component_stats.at<int>(label, cv::CC_STAT_AREA) <= min_points_in_contour)
+                {
+                    scrubComponentFromMask(label);
+                }
+                else
+                {
+                    const ComponentScore candidate = { label, 0.f };
+
+                    candidate_components.push_back(candidate);
+                }
+            }
+
+            // Stage two of the color classifier. Venue lighting flicker forces
+            // wide hue presets, and a wide range lets highlight and neighbor
+            // light pixels through at its edges - but those blobs average off
+            // the preset center while a real bulb's pixels cluster around it.
+            // Reject candidates whose mean chroma sits outside the core of the
+            // configured range, keeping the preset tight in effect while
+            // tolerant in configuration. The best-centered candidate always
+            // survives, so a global hue shift from the lighting degrades the
+            // match instead of dropping tracking outright.
+            if (hsvColorRange.hue_range.range >= k_chroma_stage_min_hue_range &&
+                candidate_components.size() > 1)
+            {
+                const float hue_core_range =
+                    hsvColorRange.hue_range.range*k_chroma_core_fraction;
+                const float saturation_core_min =
+                    hsvColorRange.saturation_range.center -
+                    hsvColorRange.saturation_range.range*k_chroma_core_fraction;
+
+                std::vector<unsigned char> &chroma_rejects = scratch_chroma_rejects;
+                chroma_rejects.assign(candidate_components.size(), 0);
+
+                size_t best_candidate_index = 0;
+                float best_hue_deviation = -1.f;
+
+                for (size_t candidate_index = 0;
+                    candidate_index < candidate_components.size();
+                    ++candidate_index)
+                {
+                    float mean_hue_offset, mean_saturation;
+
+                    if (!computeComponentChromaMean(
+                            candidate_components[candidate_index].label,
+                            hsvColorRange.hue_range.center,
+                            mean_hue_offset, mean_saturation))
+                    {
+                        continue;
+                    }
+
+                    const float hue_deviation = fabsf(mean_hue_offset);
+
+                    if (best_hue_deviation < 0.f || hue_deviation < best_hue_deviation)
+                    {
+                        best_hue_deviation = hue_deviation;
+                        best_candidate_index = candidate_index;
+                    }
+
+                    if (hue_deviation > hue_core_range || mean_saturation < saturation_core_min)
+                    {
+                        chroma_rejects[candidate_index] = 1;
+                    }
+                }
+
+                if (best_hue_deviation >= 0.f)
+                {
+                    chroma_rejects[best_candidate_index] = 0;
+                }
+
+                size_t write_index = 0;
+                for (size_t candidate_index = 0;
+                    candidate_index < candidate_components.size();
+                    ++candidate_index)
+                {
+                    if (chroma_rejects[candidate_index])
+                    {
+                        scrubComponentFromMask(candidate_components[candidate_index].label);
+                    }
+                    else
+                    {
+                        candidate_components[write_index] = candidate_components[candidate_index];
+                        ++write_index;
+                    }
+                }
+                candidate_components.resize(write_index);
+            }
+
+            // When tracking and more candidates survive than the caller will
+            // keep, rank them by a cheap prior - distance from the ROI center
+            // (the ROI is already centered on the predicted position) plus
+            // size similarity to last frame's projection - and scrub all but
+            // the best max_contour_count, so the expensive contour
+            // materialization, undistortion and shape fit only ever run on
+            // the most plausible candidates
+            if (prior_projection_area > 0.f &&
+                static_cast<int>(candidate_components.size()) > max_contour_count)
+            {
+                const float roi_center_x = static_cast<float>(gsLowerROI.cols)*0.5f;
+                const float roi_center_y = static_cast<float>(gsLowerROI.rows)*0.5f;
+                const float roi_half_diagonal = sqrtf(roi_center_x*roi_center_x + roi_center_y*roi_center_y);
+
+                for (auto it = candidate_components.begin(); it != candidate_components.end(); ++it)
+                {
+                    const double *centroid = scratch_component_centroids.ptr<double>(it->label);
+                    const float dx = static_cast<float>(centroid[0]) - roi_center_x;
+                    const float dy = static_cast<float>(centroid[1]) - roi_center_y;
+                    const float center_distance = sqrtf(dx*dx + dy*dy) / fmaxf(roi_half_diagonal, 1.f);
+
+                    const float component_area =
+                        static_cast<float>(scratch_component_stats.at<int>(it->label, cv::CC_STAT_AREA));
+                    const float size_dissimilarity =
+                        fabsf(component_area - prior_projection_area) / prior_projection_area;
+
+                    it->score = center_distance + size_dissimilarity;
+                }
+
+                std::sort(
+                    candidate_components.begin(), candidate_components.end(),
+                    [](const ComponentScore &a, const ComponentScore &b) {
+                        return a.score < b.score;
+                });
+
+                for (size_t candidate_index = max_contour_count;
+                    candidate_index < candidate_components.size();
+                    ++candidate_index)
+                {
+                    scrubComponentFromMask(candidate_components[candidate_index].label);
+                }
+            }
+        }
+
+        //TODO: Why no blurring of the gsLowerBuffer?
+
+        // Find the largest convex blob in the filtered grayscale buffer
+        {
+			std::vector<ContourInfo> &sorted_contour_list = scratch_contour_infos;
+			sorted_contour_list.clear();
+
+			// Find all counters in the image buffer
+            cv::Size size; cv::Point ofs;
+            gsLowerROI.locateROI(size, ofs);
+			t_opencv_int_contour_list &contours = scratch_contours;
+			contours.clear();
+            cv::findContours(gsLowerROI,
+                             contours,
+                             CV_RETR_EXTERNAL,
+                             CV_CHAIN_APPROX_SIMPLE,  //CV_CHAIN_APPROX_NONE?
+                             ofs);
+
+			// Compute the area of each contour
+			int contour_index = 0;
+            for (auto it = contours.begin(); it != contours.end(); ++it) 
+            {
+				const double contour_area = cv::contourArea(*it);
+				const ContourInfo contour_info = { contour_index, contour_area };
+
+				sorted_contour_list.push_back(contour_info);
+				++contour_index;
+            }
+			
+			// Sort the list of contours by area, largest to smallest
+			if (sorted_contour_list.size() > 1)
+			{
+				std::sort(
+					sorted_contour_list.begin(), sorted_contour_list.end(), 
+					[](const ContourInfo &a, const ContourInfo &b) {
+						return b.contour_area < a.contour_area;
+				});
+			}
+
+			// Copy up to N valid contours
+			for (auto it = sorted_contour_list.begin(); 
+				it != sorted_contour_list.end() && static_cast<int>(out_biggest_N_contours.size()) < max_contour_count; 
+				++it)
+			{
+				const ContourInfo &contour_info = *it;
+				t_opencv_int_contour &contour = contours[contour_info.contour_index];
+
+                if (contour.size() > min_points_in_contour)
+				{
+					// Remove any points in contour on edge of camera/ROI
+                    // TODO: Contours touching image border will be clipped,
+                    // so this might not be necessary.
+					t_opencv_int_contour::iterator it = contour.begin();
+					while (it != contour.end()) 
+					{
+						if (it->x == 0 || it->x == (frameWidth - 1) || it->y == 0 || it->y == (frameHeight - 1))
+						{
+							it = contour.erase(it);
+						}
+						else
+						{
+							++it;
+						}
+					}
+
+					// Add cleaned up contour to the output list.
+					// Moved rather than copied; the scratch storage gets
+					// re-acquired from the output list next frame.
+					out_biggest_N_contours.push_back(std::move(contour));
                     // Add its area to the output list too.
                     out_contour_areas.push_back(contour_info.contour_area);
 				}
@@ -599,10 +1556,141 @@ public:
 
         return (out_biggest_N_contours.size() > 0);
     }
-    
+
+    // Sample the mean HSV of the pixels inside the given contour. The binary
+    // mask got consumed by findContours, so the blob interior is re-tested
+    // against the contour itself over a sparse grid rather than re-walking
+    // the whole ROI. Hue is accumulated relative to the given reference hue
+    // so that blobs straddling the 0/180 wrap average correctly.
+    // Returns false when too few samples landed inside the blob.
+    bool
+    computeBlobHSVStatistics(
+        const t_opencv_int_contour &contour,
+        const float reference_hue,
+        float &out_hue, float &out_saturation, float &out_value)
+    {
+        // Contour points are in full frame coordinates while hsvBuffer only
+        // holds valid data inside the current ROI
+        const cv::Rect2i bounds= cv::boundingRect(contour) & currentROI;
+        if (bounds.width <= 0 || bounds.height <= 0)
+        {
+            return false;
+        }
+
+        // Walk a sparse grid over the bounding box (at most ~16x16 samples)
+        const int sample_stride_x= std::max(bounds.width / 16, 1);
+        const int sample_stride_y= std::max(bounds.height / 16, 1);
+
+        float hue_offset_sum= 0.f;
+        float saturation_sum= 0.f;
+        float value_sum= 0.f;
+        int sample_count= 0;
+
+        for (int y= bounds.y; y < bounds.y + bounds.height; y+= sample_stride_y)
+        {
+            const unsigned char *hsv_row= hsvBuffer->ptr<unsigned char>(y);
+
+            for (int x= bounds.x; x < bounds.x + bounds.width; x+= sample_stride_x)
+            {
+                if (cv::pointPolygonTest(
+                        contour,
+                        cv::Point2f(static_cast<float>(x), static_cast<float>(y)),
+                        false) < 0.)
+                {
+                    continue;
+                }
+
+                const unsigned char *hsv_pixel= hsv_row + 3*x;
+
+                hue_offset_sum+= wrapped_hue_difference(reference_hue, static_cast<float>(hsv_pixel[0]));
+                saturation_sum+= static_cast<float>(hsv_pixel[1]);
+                value_sum+= static_cast<float>(hsv_pixel[2]);
+                ++sample_count;
+            }
+        }
+
+        if (sample_count < k_min_blob_hsv_sample_count)
+        {
+            return false;
+        }
+
+        out_hue= reference_hue + hue_offset_sum / static_cast<float>(sample_count);
+        if (out_hue < 0.f)
+        {
+            out_hue+= 180.f;
+        }
+        else if (out_hue >= 180.f)
+        {
+            out_hue-= 180.f;
+        }
+        out_saturation= saturation_sum / static_cast<float>(sample_count);
+        out_value= value_sum / static_cast<float>(sample_count);
+
+        return true;
+    }
+
+    // Score the current ROI's segmentation quality for the auto-exposure
+    // sweep. Signal is the biggest blob of each active tracking color;
+    // in-range pixels outside that blob count against it as noise, and the
+    // whole score collapses when a large fraction of the frame is saturated
+    // since blown-out highlights wash out the hue channel.
+    float
+    computeExposureQualityScore()
+    {
+        // Fraction of pixels bright enough for hue to be meaningless
+        cv::inRange(
+            hsvROI,
+            cv::Scalar(0, 0, k_auto_exposure_saturation_threshold),
+            cv::Scalar(180, 255, 255),
+            gsUpperROI);
+        const float saturated_fraction=
+            static_cast<float>(cv::countNonZero(gsUpperROI)) /
+            static_cast<float>(hsvROI.cols*hsvROI.rows);
+
+        float total_score= 0.f;
+
+        for (int color_index= 0; color_index < active_color_count; ++color_index)
+        {
+            computeHSVRangeMask(
+                hsvROI.ptr<unsigned char>(0), hsvROI.step,
+                gsLowerROI.ptr<unsigned char>(0), gsLowerROI.step,
+                gsLowerROI.cols, gsLowerROI.rows,
+                active_color_thresholds[color_index]);
+
+            const int in_range_count= cv::countNonZero(gsLowerROI);
+            if (in_range_count <= 0)
+            {
+                continue;
+            }
+
+            t_opencv_int_contour_list &contours= scratch_contours;
+            contours.clear();
+            cv::findContours(gsLowerROI, contours, CV_RETR_EXTERNAL, CV_CHAIN_APPROX_SIMPLE);
+
+            double biggest_area= 0.;
+            for (auto it= contours.begin(); it != contours.end(); ++it)
+            {
+                biggest_area= std::max(biggest_area, cv::contourArea(*it));
+            }
+
+            // A single compact blob scores close to its area; the same
+            // number of in-range pixels scattered as noise scores near zero
+            total_score+=
+                static_cast<float>(biggest_area)*
+                static_cast<float>(biggest_area / static_cast<double>(in_range_count));
+        }
+
+        return total_score*clampf(1.f - 4.f*saturated_fraction, 0.f, 1.f);
+    }
+
     void
     draw_contour(const t_opencv_int_contour &contour)
     {
+        if (!bWriteShmemFrame)
+        {
+            return;
+        }
+
         // Draws the contour directly onto the shared mem buffer.
         // This is useful for debugging
         std::vector<t_opencv_int_contour> contours = {contour};
@@ -615,6 +1703,11 @@ public:
     void
     draw_pose_projection(const CommonDeviceTrackingProjection &pose_projection)
     {
+        if (!bWriteShmemFrame)
+        {
+            return;
+        }
+
         // Draw the projection of the pose onto the shared mem buffer.
 		switch (pose_projection.shape_type)
 		{
@@ -691,6 +1784,43 @@ public:
     int frameWidth;
     int frameHeight;
 
+    struct ContourInfo
+    {
+        int contour_index;
+        double contour_area;
+    };
+
+    struct ComponentScore
+    {
+        int label;
+        float score; // cheap candidate prior, lower is more plausible
+    };
+
+    // Per-frame contour scratch storage, reused frame to frame so the
+    // projection path stops re-allocating vectors thousands of times a
+    // second. Each buffer is cleared (capacity retained) before reuse.
+    // Per-tracker, so concurrent projection jobs never share scratch.
+    t_opencv_int_contour_list scratch_contours;
+    std::vector<ContourInfo> scratch_contour_infos;
+    t_opencv_int_contour_list scratch_biggest_contours;
+    std::vector<double> scratch_contour_areas;
+    t_opencv_int_contour scratch_convex_contour;
+    t_opencv_float_contour scratch_contour_f;
+    t_opencv_float_contour scratch_undistort_contour;
+    t_opencv_float_contour_list scratch_undistorted_contours;
+    std::vector<Eigen::Vector2f> scratch_eigen_contour;
+    // Connected component label/stat images for the speckle prescreen in
+    // computeBiggestNContours, likewise reallocation-free across frames
+    cv::Mat scratch_component_labels;
+    cv::Mat scratch_component_stats;
+    cv::Mat scratch_component_centroids;
+    std::vector<ComponentScore> scratch_component_scores;
+    std::vector<unsigned char> scratch_chroma_rejects;
+
+    bool bWriteShmemFrame; // true while at least one client is subscribed to the video feed
+    bool bBayerSource; // true when the device delivers raw Bayer frames
+    cv::Mat bayerFrame; // non-owning header over the device's raw Bayer frame
+    cv::Mat bayerROI;
     cv::Mat *bgrBuffer; // source video frame
     cv::Mat *bgrShmemBuffer; //Frame onto which we draw debug lines, and transmit via shared mem.
     cv::Mat bgrROI;
@@ -701,7 +1831,168 @@ public:
     cv::Mat *gsUpperBuffer; // HSV image clamped by HSV range into grayscale mask
     cv::Mat gsUpperROI;
     cv::Mat *maskedBuffer; // bgr image ANDed together with grayscale mask
+    cv::Mat *labelBuffer; // per-pixel active tracking color labels (0 = no color)
+    cv::Mat labelROI;
+    cv::Mat *maskSmallBuffer; // binary mask of the downscaled frame
+
+    // Cached RGB box the coarse re-acquisition pass classifies against,
+    // re-derived only when the HSV threshold it came from changes
+    HSVRangeThreshold coarse_bounds_source_threshold;
+    RGBRangeThreshold coarse_rgb_bounds;
+    bool bCoarseRGBBoundsValid;
+    cv::Rect2i currentROI; // the clamped rectangle the *ROI views are bound to
+
+    // The set of tracking colors claimed by the tracked devices this tick.
+    // When more than one color is active the ROI gets classified against all
+    // of them in a single traversal and the per-color masks get extracted
+    // from the label image instead of re-walking the pixels per device.
+    HSVRangeThreshold active_color_thresholds[eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES];
+    eCommonTrackingColorID active_color_ids[eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES];
+    unsigned char active_color_labels[eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES];
+    int active_color_count;
+    HSVColorClassLUT active_color_class_lut; // prebuilt per-channel tables; rebuilt only when the color set changes
+    bool bLabelMaskValid; // true while labelMaskRect of labelBuffer matches the current frame
+    cv::Rect2i labelMaskRect;
+    bool bHsvValid; // true while hsvValidRect of hsvBuffer matches the current frame
+    cv::Rect2i hsvValidRect;
+
+    // Static background areas (reflective surfaces) zeroed out of every
+    // threshold mask before contour extraction
+    cv::Rect2i exclusion_rects[ITrackerInterface::MAX_EXCLUSION_AREAS];
+    int exclusion_rect_count;
+
 	OpenCVBGRToHSVMapper *bgr2hsv; // Used to convert an rgb image to an hsv image
+	TrackerUndistortionLUT *undistort_lut; // Per-calibration undistortion map (see TrackerUndistortionLUT)
+};
+
+// One-shot exposure/gain optimization sweep run when tracking first starts.
+// Steps the camera through a grid of candidate settings, scoring each over a
+// few frames via the threshold stage, then locks the best pair. Exposure is
+// swept first at the current gain, then gain at the winning exposure.
+class TrackerAutoExposureCalibration
+{
+public:
+    TrackerAutoExposureCalibration(ServerTrackerView *tracker_view)
+        : m_phase(Phase_SweepExposure)
+        , m_step_index(0)
+        , m_settle_countdown(k_auto_exposure_settle_frames)
+        , m_measured_frame_count(0)
+        , m_score_sum(0.f)
+        , m_best_score(-1.f)
+        , m_best_exposure(tracker_view->getExposure())
+        , m_best_gain(tracker_view->getGain())
+        , m_original_exposure(tracker_view->getExposure())
+        , m_original_gain(tracker_view->getGain())
+    {
+        tracker_view->setExposure(k_auto_exposure_sweep_exposures[0], false);
+    }
+
+    // Advance one frame. Returns true when the sweep has finished and the
+    // winning settings have been applied.
+    bool update(ServerTrackerView *tracker_view, OpenCVBufferState *buffer_state)
+    {
+        if (m_settle_countdown > 0)
+        {
+            --m_settle_countdown;
+            return false;
+        }
+
+        buffer_state->applyROI(
+            cv::Rect2i(0, 0, buffer_state->frameWidth, buffer_state->frameHeight));
+        m_score_sum+= buffer_state->computeExposureQualityScore();
+        ++m_measured_frame_count;
+
+        if (m_measured_frame_count < k_auto_exposure_measure_frames)
+        {
+            return false;
+        }
+
+        // The candidate is fully measured
+        const float score= m_score_sum / static_cast<float>(k_auto_exposure_measure_frames);
+        if (score > m_best_score)
+        {
+            m_best_score= score;
+            if (m_phase == Phase_SweepExposure)
+            {
+                m_best_exposure= k_auto_exposure_sweep_exposures[m_step_index];
+            }
+            else
+            {
+                m_best_gain= k_auto_exposure_sweep_gains[m_step_index];
+            }
+        }
+
+        m_score_sum= 0.f;
+        m_measured_frame_count= 0;
+        m_settle_countdown= k_auto_exposure_settle_frames;
+        ++m_step_index;
+
+        if (m_phase == Phase_SweepExposure)
+        {
+            if (m_step_index < k_auto_exposure_sweep_exposure_count)
+            {
+                tracker_view->setExposure(k_auto_exposure_sweep_exposures[m_step_index], false);
+                return false;
+            }
+
+            // Exposure picked - sweep gain at the winning exposure.
+            // Gain re-scores from scratch since the pair is what matters.
+            m_phase= Phase_SweepGain;
+            m_step_index= 0;
+            m_best_score= -1.f;
+            tracker_view->setExposure(m_best_exposure, false);
+            tracker_view->setGain(k_auto_exposure_sweep_gains[0], false);
+            return false;
+        }
+
+        if (m_step_index < k_auto_exposure_sweep_gain_count)
+        {
+            tracker_view->setGain(k_auto_exposure_sweep_gains[m_step_index], false);
+            return false;
+        }
+
+        // Sweep complete - lock the winner, or fall back to the settings we
+        // started with when nothing ever scored (blob never in view)
+        if (m_best_score > 0.f)
+        {
+            tracker_view->setExposure(m_best_exposure, true);
+            tracker_view->setGain(m_best_gain, true);
+            tracker_view->saveSettings();
+
+            SERVER_LOG_INFO("TrackerAutoExposureCalibration") <<
+                "Tracker " << tracker_view->getDeviceID() <<
+                " locked exposure " << m_best_exposure << " gain " << m_best_gain;
+        }
+        else
+        {
+            tracker_view->setExposure(m_original_exposure, false);
+            tracker_view->setGain(m_original_gain, false);
+
+            SERVER_LOG_WARNING("TrackerAutoExposureCalibration") <<
+                "Tracker " << tracker_view->getDeviceID() <<
+                " sweep never saw a tracking blob - keeping the existing settings";
+        }
+
+        return true;
+    }
+
+private:
+    enum ePhase
+    {
+        Phase_SweepExposure,
+        Phase_SweepGain
+    };
+
+    ePhase m_phase;
+    int m_step_index;
+    int m_settle_countdown;
+    int m_measured_frame_count;
+    float m_score_sum;
+    float m_best_score;
+    double m_best_exposure;
+    double m_best_gain;
+    double m_original_exposure;
+    double m_original_gain;
 };
 
 // -- Utility Methods -----
@@ -713,7 +2004,6 @@ cv::Mat cvDistCoeffs = cv::Mat(4, 1, cv::DataType<float>::type, 0.f);
 static void computeOpenCVCameraIntrinsicMatrix(const ITrackerInterface *tracker_device,
                                                cv::Matx33f &intrinsicOut,
                                                cv::Matx<float, 5, 1> &distortionOut);
-static cv::Matx34f computeOpenCVCameraPinholeMatrix(const ITrackerInterface *tracker_device);
 static bool computeTrackerRelativeLightBarProjection(
 	const CommonDeviceTrackingShape *tracking_shape,
 	const t_opencv_float_contour &opencv_contour,
@@ -724,6 +2014,48 @@ static bool computeTrackerRelativeLightBarPose(
 	const CommonDeviceTrackingProjection *projection,
 	const CommonDevicePose *tracker_relative_pose_guess,
 	ControllerOpticalPoseEstimation *out_pose_estimate);
+
+// -- TrackerPoseTransformCache -----
+// Camera transform block shared by every projection computed against this
+// tracker. Tracker poses are static between calibrations, so the world
+// transform, its inverse and the pinhole projection matrix are rebuilt once
+// when the pose or intrinsics actually change instead of being re-derived
+// (inverses included) on every call in the inner vision loop.
+class TrackerPoseTransformCache
+{
+public:
+    TrackerPoseTransformCache()
+        : camera_transform(1.f)
+        , camera_transform_inverse(1.f)
+        , camera_quat(1.f, 0.f, 0.f, 0.f)
+        , camera_quat_inverse(1.f, 0.f, 0.f, 0.f)
+    {
+    }
+
+    void rebuild(const ITrackerInterface *tracker_device)
+    {
+        camera_transform= computeGLMCameraTransformMatrix(tracker_device);
+        camera_transform_inverse= glm::inverse(camera_transform);
+        camera_quat= computeGLMCameraTransformQuaternion(tracker_device);
+        camera_quat_inverse= glm::conjugate(camera_quat);
+        computeOpenCVCameraExtrinsicMatrix(tracker_device, extrinsic_matrix);
+        computeOpenCVCameraIntrinsicMatrix(tracker_device, intrinsic_matrix, distortion_coefficients);
+        pinhole_matrix= intrinsic_matrix * extrinsic_matrix;
+    }
+
+    // Tracker space -> world space
+    glm::mat4 camera_transform;
+    // World space -> tracker space
+    glm::mat4 camera_transform_inverse;
+    glm::quat camera_quat;
+    glm::quat camera_quat_inverse;
+    // World space -> tracker space, as a 3x4 for OpenCV
+    cv::Matx34f extrinsic_matrix;
+    cv::Matx33f intrinsic_matrix;
+    cv::Matx<float, 5, 1> distortion_coefficients;
+    // intrinsic * extrinsic - world space -> screen space, used for triangulation
+    cv::Matx34f pinhole_matrix;
+};
 static bool computeTrackerRelativePointCloudContourPose(
 	const ITrackerInterface *tracker_device,
 	const CommonDeviceTrackingShape *tracking_shape,
@@ -735,7 +2067,12 @@ static cv::Rect2i computeTrackerROIForPoseProjection(
 	const ServerTrackerView *tracker,
 	const IPoseFilter* pose_filter,
 	const CommonDeviceTrackingProjection *prior_tracking_projection,
-	const CommonDeviceTrackingShape *tracking_shape);
+	const float shape_bounding_radius_cm);
+static bool computeTrackerROIFromFilterPosition(
+	const ServerTrackerView *tracker,
+	const IPoseFilter* pose_filter,
+	const float shape_bounding_radius_cm,
+	cv::Rect2i &out_roi);
 static bool computeBestFitTriangleForContour(
     const t_opencv_float_contour &opencv_contour,
     cv::Point2f &out_triangle_top,
@@ -767,7 +2104,13 @@ ServerTrackerView::ServerTrackerView(const int device_id)
     : ServerDeviceView(device_id)
     , m_shared_memory_accesor(nullptr)
     , m_shared_memory_video_stream_count(0)
+    , m_shared_memory_half_res_stream_count(0)
     , m_opencv_buffer_state(nullptr)
+    , m_video_encoder(nullptr)
+    , m_compressed_video_stream_count(0)
+    , m_auto_exposure_calibration(nullptr)
+    , m_auto_exposure_calibrated(false)
+    , m_transform_cache(new TrackerPoseTransformCache())
     , m_device(nullptr)
 {
     ServerUtility::format_string(m_shared_memory_name, sizeof(m_shared_memory_name), "tracker_view_%d", device_id);
@@ -785,6 +2128,21 @@ ServerTrackerView::~ServerTrackerView()
         delete m_opencv_buffer_state;
     }
 
+    if (m_video_encoder != nullptr)
+    {
+        delete m_video_encoder;
+    }
+
+    if (m_auto_exposure_calibration != nullptr)
+    {
+        delete m_auto_exposure_calibration;
+    }
+
+    if (m_transform_cache != nullptr)
+    {
+        delete m_transform_cache;
+    }
+
     if (m_device != nullptr)
     {
         delete m_device;
@@ -815,6 +2173,11 @@ ServerTrackerView::getSharedMemoryStreamName() const
     return std::string(m_shared_memory_name);
 }
 
+int ServerTrackerView::getSharedMemoryFramesWritten() const
+{
+    return (m_shared_memory_accesor != nullptr) ? m_shared_memory_accesor->getWrittenFrameCount() : 0;
+}
+
 bool ServerTrackerView::open(const class DeviceEnumerator *enumerator)
 {
     bool bSuccess = ServerDeviceView::open(enumerator);
@@ -829,7 +2192,86 @@ bool ServerTrackerView::open(const class DeviceEnumerator *enumerator)
         // Query the video frame first so that we know how big to make the buffer
         if (m_device->getVideoFrameDimensions(&width, &height, &stride))
         {
-            assert(m_shared_memory_accesor == nullptr);
+            // The shared memory block itself is allocated on demand when the
+            // first client subscribes to the video stream
+
+            // Allocate the OpenCV scratch buffers used for finding tracking blobs
+            m_opencv_buffer_state = new OpenCVBufferState(m_device);
+
+            // Apply any static background exclusion areas persisted in the config
+            refreshExclusionAreas();
+
+            // Build the camera transform block from the pose and intrinsics
+            // just loaded from the config
+            m_transform_cache->rebuild(m_device);
+
+            // Start the color auto-tuner from the stored presets each time
+            // the tracker is opened
+            for (int color_index = 0; color_index < eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES; ++color_index)
+            {
+                ColorAutoTuningState &tuning_state = m_color_auto_tuning_states[color_index];
+
+                tuning_state.bHasBaseline = false;
+                tuning_state.bDirty = false;
+                tuning_state.sample_countdown = 0;
+            }
+            m_last_color_auto_tuning_save_time = std::chrono::high_resolution_clock::now();
+
+            // Let the exposure/gain optimization sweep run again for the
+            // newly opened camera
+            m_auto_exposure_calibrated = false;
+        }
+        else
+        {
+            SERVER_LOG_ERROR("ServerTrackerView::open()") << "Failed to video frame dimensions";
+        }
+    }
+
+    return bSuccess;
+}
+
+void ServerTrackerView::close()
+{
+    if (m_shared_memory_accesor != nullptr)
+    {
+        delete m_shared_memory_accesor;
+        m_shared_memory_accesor = nullptr;
+    }
+
+    if (m_video_encoder != nullptr)
+    {
+        delete m_video_encoder;
+        m_video_encoder = nullptr;
+    }
+
+    if (m_auto_exposure_calibration != nullptr)
+    {
+        delete m_auto_exposure_calibration;
+        m_auto_exposure_calibration = nullptr;
+    }
+
+    ServerDeviceView::close();
+}
+
+void ServerTrackerView::startSharedMemoryVideoStream(bool bHalfResolution)
+{
+    ++m_shared_memory_video_stream_count;
+    if (bHalfResolution)
+    {
+        ++m_shared_memory_half_res_stream_count;
+    }
+
+    // Allocate the shared memory block when the first client subscribes.
+    // The block is always sized for full resolution frames so the stream
+    // can switch quality without re-allocating out from under readers.
+    if (m_shared_memory_video_stream_count == 1 &&
+        m_shared_memory_accesor == nullptr &&
+        m_device != nullptr)
+    {
+        int width, height, stride;
+
+        if (m_device->getVideoFrameDimensions(&width, &height, &stride))
+        {
             m_shared_memory_accesor = new SharedVideoFrameReadWriteAccessor();
 
             if (!m_shared_memory_accesor->initialize(m_shared_memory_name, width, height, stride))
@@ -837,62 +2279,403 @@ bool ServerTrackerView::open(const class DeviceEnumerator *enumerator)
                 delete m_shared_memory_accesor;
                 m_shared_memory_accesor = nullptr;
 
-                SERVER_LOG_ERROR("ServerTrackerView::open()") << "Failed to allocated shared memory: " << m_shared_memory_name;
+                SERVER_LOG_ERROR("ServerTrackerView::startSharedMemoryVideoStream")
+                    << "Failed to allocated shared memory: " << m_shared_memory_name;
             }
+        }
+    }
 
-            // Allocate the OpenCV scratch buffers used for finding tracking blobs
-            m_opencv_buffer_state = new OpenCVBufferState(m_device);
+    // Downscale only while every listener asked for the preview quality
+    if (m_shared_memory_accesor != nullptr)
+    {
+        m_shared_memory_accesor->setHalfResolutionEnabled(
+            m_shared_memory_half_res_stream_count == m_shared_memory_video_stream_count);
+    }
+}
+
+void ServerTrackerView::stopSharedMemoryVideoStream(bool bHalfResolution)
+{
+    assert(m_shared_memory_video_stream_count > 0);
+    --m_shared_memory_video_stream_count;
+    if (bHalfResolution)
+    {
+        assert(m_shared_memory_half_res_stream_count > 0);
+        --m_shared_memory_half_res_stream_count;
+    }
+
+    // Free the shared memory block once the last client unsubscribes
+    if (m_shared_memory_video_stream_count == 0 && m_shared_memory_accesor != nullptr)
+    {
+        delete m_shared_memory_accesor;
+        m_shared_memory_accesor = nullptr;
+    }
+    else if (m_shared_memory_accesor != nullptr)
+    {
+        m_shared_memory_accesor->setHalfResolutionEnabled(
+            m_shared_memory_half_res_stream_count == m_shared_memory_video_stream_count);
+    }
+}
+
+void ServerTrackerView::startCompressedVideoStream()
+{
+    ++m_compressed_video_stream_count;
+
+    // Spin up the encoder worker when the first client subscribes
+    if (m_compressed_video_stream_count == 1 && m_video_encoder == nullptr)
+    {
+        const TrackerManagerConfig &cfg = DeviceManager::getInstance()->m_tracker_manager->getConfig();
+
+        m_video_encoder =
+            new TrackerVideoEncoder(
+                getDeviceID(),
+                cfg.compressed_video_quality,
+                cfg.compressed_video_max_fps);
+
+        if (!m_video_encoder->startup())
+        {
+            delete m_video_encoder;
+            m_video_encoder = nullptr;
+
+            SERVER_LOG_ERROR("ServerTrackerView::startCompressedVideoStream")
+                << "Failed to start video encoder for tracker id " << getDeviceID();
         }
-        else
+    }
+}
+
+void ServerTrackerView::stopCompressedVideoStream()
+{
+    assert(m_compressed_video_stream_count > 0);
+    --m_compressed_video_stream_count;
+
+    // Tear the encoder worker down once the last client unsubscribes
+    if (m_compressed_video_stream_count == 0 && m_video_encoder != nullptr)
+    {
+        delete m_video_encoder;
+        m_video_encoder = nullptr;
+    }
+}
+
+bool ServerTrackerView::poll()
+{
+    bool bSuccess = ServerDeviceView::poll();
+
+    if (bSuccess && m_device != nullptr)
+    {
+        const unsigned char *buffer = m_device->getVideoFrameBuffer();
+
+        if (buffer != nullptr)
         {
-            SERVER_LOG_ERROR("ServerTrackerView::open()") << "Failed to video frame dimensions";
+            // Cache the raw video frame
+            if (m_opencv_buffer_state != nullptr)
+            {
+                // Only generate the annotated shared memory frame while
+                // at least one client is subscribed to the video stream
+                m_opencv_buffer_state->bWriteShmemFrame = (m_shared_memory_video_stream_count > 0);
+
+                m_opencv_buffer_state->writeVideoFrame(buffer);
+
+                const bool bRecordFrame = SessionCapture::shouldRecordCameraFrame(getDeviceID());
+                const bool bEncodeFrame =
+                    m_video_encoder != nullptr && m_compressed_video_stream_count > 0 &&
+                    m_video_encoder->getWouldAcceptFrame();
+
+                // Both the session recorder and the compressed video stream
+                // want a BGR view of the frame - fetch it once so a bayer
+                // source only pays for one on-demand conversion
+                if (bRecordFrame || bEncodeFrame)
+                {
+                    const cv::Mat *bgr_frame = m_opencv_buffer_state->getBgrFrameForCapture();
+
+                    // Feed the session recorder (applies its own frame divisor)
+                    if (bRecordFrame)
+                    {
+                        SessionCapture::recordCameraFrame(
+                            getDeviceID(), bgr_frame->data,
+                            bgr_frame->cols, bgr_frame->rows, static_cast<int>(bgr_frame->step));
+                    }
+
+                    // Hand the frame to the encoder worker. The encoder
+                    // applies its own rate cap and drops frames it can't keep
+                    // up with; the copy is the only cost on this thread.
+                    if (bEncodeFrame)
+                    {
+                        m_video_encoder->submitFrame(
+                            bgr_frame->data,
+                            bgr_frame->cols, bgr_frame->rows, static_cast<int>(bgr_frame->step));
+                    }
+                }
+
+                // Refresh the active tracking color set for the new frame
+                updateActiveTrackingColorList();
+
+                // Advance the one-shot exposure/gain optimization sweep
+                updateAutoExposureCalibration();
+            }
+
+            // Re-stamp the poll with the time the camera driver actually
+            // delivered the frame so downstream filter timing isn't skewed
+            // by service thread scheduling
+            m_lastNewDataTimestamp = m_device->getVideoFrameCaptureTimestamp();
         }
     }
 
     return bSuccess;
 }
 
-void ServerTrackerView::close()
-{
-    if (m_shared_memory_accesor != nullptr)
+void ServerTrackerView::updateActiveTrackingColorList()
+{
+    DeviceManager *device_manager = DeviceManager::getInstance();
+
+    eCommonTrackingColorID color_ids[eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES];
+    HSVRangeThreshold thresholds[eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES];
+    int color_count = 0;
+
+    // The color IDs claimed through ControllerManager::claimTrackingColorID
+    // are unique across devices, so each active color maps to exactly one
+    // tracked device and its preset on this tracker
+    for (int controller_id = 0; controller_id < device_manager->getControllerViewMaxCount(); ++controller_id)
+    {
+        ServerControllerViewPtr controller_view = device_manager->getControllerViewPtr(controller_id);
+
+        if (controller_view && controller_view->getIsOpen() && controller_view->getIsTrackingEnabled())
+        {
+            const eCommonTrackingColorID color_id = controller_view->getTrackingColorID();
+
+            if (color_id != eCommonTrackingColorID::INVALID_COLOR &&
+                color_count < eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES)
+            {
+                CommonHSVColorRange hsvColorRange;
+                getControllerTrackingColorPreset(controller_view.get(), color_id, &hsvColorRange);
+
+                color_ids[color_count] = color_id;
+                hsvColorRangeToThreshold(hsvColorRange, thresholds[color_count]);
+                ++color_count;
+            }
+        }
+    }
+
+    for (int hmd_id = 0; hmd_id < device_manager->getHMDViewMaxCount(); ++hmd_id)
+    {
+        ServerHMDViewPtr hmd_view = device_manager->getHMDViewPtr(hmd_id);
+
+        if (hmd_view && hmd_view->getIsOpen() && hmd_view->getIsTrackingEnabled())
+        {
+            const eCommonTrackingColorID color_id = hmd_view->getTrackingColorID();
+
+            if (color_id != eCommonTrackingColorID::INVALID_COLOR &&
+                color_count < eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES)
+            {
+                CommonHSVColorRange hsvColorRange;
+                getHMDTrackingColorPreset(hmd_view.get(), color_id, &hsvColorRange);
+
+                color_ids[color_count] = color_id;
+                hsvColorRangeToThreshold(hsvColorRange, thresholds[color_count]);
+                ++color_count;
+            }
+        }
+    }
+
+    m_opencv_buffer_state->setActiveColorSet(color_ids, thresholds, color_count);
+}
+
+void ServerTrackerView::updateAutoExposureCalibration()
+{
+    // One snapshot fetch covers the whole calibration step - a concurrent
+    // config republish can't change values out from under it mid-frame
+    const std::shared_ptr<const TrackerManager::ConfigSnapshot> configSnapshot =
+        DeviceManager::getInstance()->m_tracker_manager->getConfigSnapshot();
+    const TrackerManagerConfig &trackerMgrConfig = configSnapshot->config;
+
+    if (!trackerMgrConfig.enable_auto_exposure_calibration || m_opencv_buffer_state == nullptr)
+    {
+        return;
+    }
+
+    // Kick the sweep off on the first frame where a tracked device has
+    // claimed a tracking color on this tracker
+    if (m_auto_exposure_calibration == nullptr)
+    {
+        if (m_auto_exposure_calibrated || m_opencv_buffer_state->active_color_count == 0)
+        {
+            return;
+        }
+
+        SERVER_LOG_INFO("ServerTrackerView::updateAutoExposureCalibration") <<
+            "Tracker " << getDeviceID() << " starting exposure/gain optimization sweep";
+        m_auto_exposure_calibration = new TrackerAutoExposureCalibration(this);
+        return;
+    }
+
+    if (m_auto_exposure_calibration->update(this, m_opencv_buffer_state))
+    {
+        delete m_auto_exposure_calibration;
+        m_auto_exposure_calibration = nullptr;
+        m_auto_exposure_calibrated = true;
+    }
+}
+
+void ServerTrackerView::prepareSharedSegmentationPass()
+{
+    if (m_opencv_buffer_state == nullptr || !getHasUnpublishedState())
+    {
+        return;
+    }
+
+    // The shared pass only pays off when the per-device masks can later be
+    // extracted from one cached label image, which needs multiple active colors
+    if (m_opencv_buffer_state->active_color_count <= 1)
+    {
+        return;
+    }
+
+    DeviceManager *device_manager = DeviceManager::getInstance();
+    const std::shared_ptr<const TrackerManager::ConfigSnapshot> configSnapshot =
+        device_manager->m_tracker_manager->getConfigSnapshot();
+    const TrackerManagerConfig &trackerMgrConfig = configSnapshot->config;
+
+    // Union the predicted search windows of every device currently tracked
+    // on this tracker. Devices that lost tracking go through the coarse
+    // re-acquisition path with a ROI of their own and can't share the pass.
+    cv::Rect2i union_roi;
+    int total_roi_area = 0;
+    int roi_count = 0;
+
+    for (int controller_id = 0; controller_id < device_manager->getControllerViewMaxCount(); ++controller_id)
+    {
+        ServerControllerViewPtr controller_view = device_manager->getControllerViewPtr(controller_id);
+
+        if (controller_view && controller_view->getIsOpen() && controller_view->getIsTrackingEnabled() &&
+            controller_view->getTrackingColorID() != eCommonTrackingColorID::INVALID_COLOR)
+        {
+            const ControllerOpticalPoseEstimation *priorPoseEst =
+                controller_view->getTrackerPoseEstimate(this->getDeviceID());
+
+            if (priorPoseEst != nullptr && priorPoseEst->bCurrentlyTracking)
+            {
+                const bool bRoiDisabled = controller_view->getIsROIDisabled() || trackerMgrConfig.disable_roi;
+                const cv::Rect2i ROI = computeTrackerROIForPoseProjection(
+                    bRoiDisabled,
+                    this,
+                    controller_view->getPoseFilter(),
+                    &priorPoseEst->projection,
+                    controller_view->getTrackingShapeBoundingRadiusCm());
+
+                union_roi = (roi_count == 0) ? ROI : (union_roi | ROI);
+                total_roi_area += ROI.area();
+                ++roi_count;
+            }
+        }
+    }
+
+    for (int hmd_id = 0; hmd_id < device_manager->getHMDViewMaxCount(); ++hmd_id)
+    {
+        ServerHMDViewPtr hmd_view = device_manager->getHMDViewPtr(hmd_id);
+
+        if (hmd_view && hmd_view->getIsOpen() && hmd_view->getIsTrackingEnabled() &&
+            hmd_view->getTrackingColorID() != eCommonTrackingColorID::INVALID_COLOR)
+        {
+            const HMDOpticalPoseEstimation *priorPoseEst =
+                hmd_view->getTrackerPoseEstimate(this->getDeviceID());
+
+            if (priorPoseEst != nullptr && priorPoseEst->bCurrentlyTracking)
+            {
+                const bool bRoiDisabled = hmd_view->getIsROIDisabled() || trackerMgrConfig.disable_roi;
+                const cv::Rect2i ROI = computeTrackerROIForPoseProjection(
+                    bRoiDisabled,
+                    this,
+                    hmd_view->getPoseFilter(),
+                    &priorPoseEst->projection,
+                    hmd_view->getTrackingShapeBoundingRadiusCm());
+
+                union_roi = (roi_count == 0) ? ROI : (union_roi | ROI);
+                total_roi_area += ROI.area();
+                ++roi_count;
+            }
+        }
+    }
+
+    // One labeling pass over the union only wins when the devices' search
+    // windows overlap; for windows far apart the union's bounding box is
+    // mostly dead space that would get classified for nothing
+    if (roi_count < 2 || union_roi.area() > total_roi_area)
     {
-        delete m_shared_memory_accesor;
-        m_shared_memory_accesor = nullptr;
+        return;
     }
 
-    ServerDeviceView::close();
+    m_opencv_buffer_state->applyROI(union_roi);
+    m_opencv_buffer_state->prelabelCurrentROI();
 }
 
-void ServerTrackerView::startSharedMemoryVideoStream()
+bool ServerTrackerView::captureExclusionAreas()
 {
-    ++m_shared_memory_video_stream_count;
-}
+    if (m_opencv_buffer_state == nullptr)
+    {
+        return false;
+    }
 
-void ServerTrackerView::stopSharedMemoryVideoStream()
-{
-    assert(m_shared_memory_video_stream_count > 0);
-    --m_shared_memory_video_stream_count;
-}
+    // Start from what's already persisted so repeated captures accumulate.
+    // Blobs inside existing exclusion areas are already masked out of the
+    // thresholds below, so they can't get recorded twice.
+    CommonScreenRect areas[ITrackerInterface::MAX_EXCLUSION_AREAS];
+    int area_count = m_device->getExclusionAreas(areas, ITrackerInterface::MAX_EXCLUSION_AREAS);
 
-bool ServerTrackerView::poll()
-{
-    bool bSuccess = ServerDeviceView::poll();
+    // Reflections can be anywhere in the frame, so scan all of it
+    m_opencv_buffer_state->applyROI(
+        cv::Rect2i(0, 0, m_opencv_buffer_state->frameWidth, m_opencv_buffer_state->frameHeight));
 
-    if (bSuccess && m_device != nullptr)
+    // Record every blob that passes any of the tracker's shared color presets
+    t_opencv_int_contour_list &biggest_contours = m_opencv_buffer_state->scratch_biggest_contours;
+    std::vector<double> &contour_areas = m_opencv_buffer_state->scratch_contour_areas;
+    for (int preset_index = 0; preset_index < eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES; ++preset_index)
     {
-        const unsigned char *buffer = m_device->getVideoFrameBuffer();
+        const eCommonTrackingColorID color_id = static_cast<eCommonTrackingColorID>(preset_index);
 
-        if (buffer != nullptr)
+        CommonHSVColorRange hsvColorRange;
+        m_device->getTrackingColorPreset(std::string(), color_id, &hsvColorRange);
+
+        if (m_opencv_buffer_state->computeBiggestNContours(
+                color_id, hsvColorRange,
+                biggest_contours, contour_areas,
+                ITrackerInterface::MAX_EXCLUSION_AREAS))
         {
-            // Cache the raw video frame
-            if (m_opencv_buffer_state != nullptr)
+            for (auto it = biggest_contours.begin();
+                it != biggest_contours.end() && area_count < ITrackerInterface::MAX_EXCLUSION_AREAS;
+                ++it)
             {
-                m_opencv_buffer_state->writeVideoFrame(buffer);
+                const cv::Rect2i bounds = cv::boundingRect(*it);
+
+                areas[area_count].set(
+                    static_cast<float>(bounds.x - k_exclusion_area_padding),
+                    static_cast<float>(bounds.y - k_exclusion_area_padding),
+                    static_cast<float>(bounds.width + 2*k_exclusion_area_padding),
+                    static_cast<float>(bounds.height + 2*k_exclusion_area_padding));
+                ++area_count;
             }
         }
     }
 
-    return bSuccess;
+    // Persist through the tracker config and apply immediately
+    m_device->setExclusionAreas(areas, area_count);
+    refreshExclusionAreas();
+
+    return true;
+}
+
+void ServerTrackerView::clearExclusionAreas()
+{
+    m_device->setExclusionAreas(nullptr, 0);
+    refreshExclusionAreas();
+}
+
+void ServerTrackerView::refreshExclusionAreas()
+{
+    if (m_opencv_buffer_state != nullptr)
+    {
+        CommonScreenRect areas[ITrackerInterface::MAX_EXCLUSION_AREAS];
+        const int area_count = m_device->getExclusionAreas(areas, ITrackerInterface::MAX_EXCLUSION_AREAS);
+
+        m_opencv_buffer_state->setExclusionAreas(areas, area_count);
+    }
 }
 
 bool ServerTrackerView::allocate_device_interface(const class DeviceEnumerator *enumerator)
@@ -903,6 +2686,10 @@ bool ServerTrackerView::allocate_device_interface(const class DeviceEnumerator *
     {
         m_device = new PS3EyeTracker();
     } break;
+    case CommonDeviceState::VirtualTracker:
+    {
+        m_device = new VirtualTracker();
+    } break;
     default:
         break;
     }
@@ -930,6 +2717,22 @@ void ServerTrackerView::publish_device_data_frame()
         m_shared_memory_accesor->writeVideoFrame(m_opencv_buffer_state->bgrShmemBuffer->data);
     }
     
+    // Forward any JPEG frame the encoder worker finished since the last
+    // publish to the connections following the compressed video stream.
+    // Collecting here keeps the connection table on the service thread.
+    if (m_video_encoder != nullptr && m_compressed_video_stream_count > 0)
+    {
+        std::vector<unsigned char> jpeg_buffer;
+        int width, height, sequence_num;
+
+        if (m_video_encoder->fetchEncodedFrame(jpeg_buffer, width, height, sequence_num))
+        {
+            ServerRequestHandler::get_instance()->publish_tracker_video_frame(
+                this, jpeg_buffer.data(), static_cast<int>(jpeg_buffer.size()),
+                width, height, sequence_num);
+        }
+    }
+
     // Tell the server request handler we want to send out tracker updates.
     // This will call generate_tracker_data_frame_for_stream for each listening connection.
     ServerRequestHandler::get_instance()->publish_tracker_data_frame(
@@ -948,12 +2751,27 @@ void ServerTrackerView::generate_tracker_data_frame_for_stream(
     tracker_data_frame->set_sequence_num(tracker_view->m_sequence_number);
     tracker_data_frame->set_isconnected(tracker_view->getIsOpen());
 
+    // Capture health telemetry so stream consumers (and fleet monitors fed
+    // from them) can alarm on capture degradation before tracking suffers
+    if (tracker_view->getIsOpen())
+    {
+        const ITrackerInterface *tracker_device= tracker_view->m_device;
+        const std::chrono::duration<float, std::milli> last_frame_age=
+            ServiceClock::now() - tracker_device->getVideoFrameCaptureTimestamp();
+
+        tracker_data_frame->set_capture_rate_hz(tracker_device->getMeasuredCaptureRateFps());
+        tracker_data_frame->set_last_frame_age_ms(last_frame_age.count());
+        tracker_data_frame->set_dropped_frame_count(tracker_device->getDroppedFrameCount());
+    }
+
     switch (tracker_view->getTrackerDeviceType())
     {
     case CommonDeviceState::PS3EYE:
         {
             //TODO: PS3EYE tracker location
         } break;
+    case CommonDeviceState::VirtualTracker:
+        break;
     default:
         assert(0 && "Unhandled Tracker type");
     }
@@ -964,6 +2782,12 @@ void ServerTrackerView::generate_tracker_data_frame_for_stream(
 void ServerTrackerView::loadSettings()
 {
     m_device->loadSettings();
+
+    // The reloaded config may carry different exclusion areas
+    refreshExclusionAreas();
+
+    // ...and a different tracker pose or lens calibration
+    m_transform_cache->rebuild(m_device);
 }
 
 void ServerTrackerView::saveSettings()
@@ -1015,6 +2839,8 @@ void ServerTrackerView::setCameraIntrinsics(
         principalX, principalY,
         distortionK1, distortionK2, distortionK3,
         distortionP1, distortionP2);
+
+    m_transform_cache->rebuild(m_device);
 }
 
 CommonDevicePose ServerTrackerView::getTrackerPose() const
@@ -1026,6 +2852,8 @@ void ServerTrackerView::setTrackerPose(
     const struct CommonDevicePose *pose)
 {
     m_device->setTrackerPose(pose);
+
+    m_transform_cache->rebuild(m_device);
 }
 
 void ServerTrackerView::getPixelDimensions(float &outWidth, float &outHeight) const
@@ -1055,7 +2883,15 @@ void ServerTrackerView::gatherTrackerOptions(PSMoveProtocol::Response_ResultTrac
 
 bool ServerTrackerView::setOptionIndex(const std::string &option_name, int option_index)
 {
-    return m_device->setOptionIndex(option_name, option_index);
+    const bool bSuccess= m_device->setOptionIndex(option_name, option_index);
+
+    if (bSuccess)
+    {
+        // Option changes (FOV setting, capture mode) can rescale the intrinsics
+        m_transform_cache->rebuild(m_device);
+    }
+
+    return bSuccess;
 }
 
 bool ServerTrackerView::getOptionIndex(const std::string &option_name, int &out_option_index) const
@@ -1088,6 +2924,18 @@ void ServerTrackerView::setControllerTrackingColorPreset(
 {
 	std::string controller_id= (controller != nullptr) ? controller->getConfigIdentifier() : "";
 
+	// A preset set from the outside is a fresh calibration - re-anchor the
+	// color auto-tuner on it
+	if (color != eCommonTrackingColorID::INVALID_COLOR)
+	{
+		ColorAutoTuningState &tuning_state= m_color_auto_tuning_states[color];
+
+		tuning_state.baseline_preset= *preset;
+		tuning_state.tuned_preset= *preset;
+		tuning_state.bHasBaseline= true;
+		tuning_state.bDirty= false;
+	}
+
     return m_device->setTrackingColorPreset(controller_id, color, preset);
 }
 
@@ -1127,14 +2975,15 @@ ServerTrackerView::computeProjectionForController(
 	const CommonDeviceTrackingShape *tracking_shape,
     ControllerOpticalPoseEstimation *out_pose_estimate)
 {
+    SERVER_TRACE_SCOPE("ServerTrackerView::computeProjectionForController");
+
     bool bSuccess = true;
 
     // Get the HSV filter used to find the tracking blob
+    const eCommonTrackingColorID tracked_color_id = tracked_controller->getTrackingColorID();
     CommonHSVColorRange hsvColorRange;
     if (bSuccess)
     {
-        eCommonTrackingColorID tracked_color_id = tracked_controller->getTrackingColorID();
-
         if (tracked_color_id != eCommonTrackingColorID::INVALID_COLOR)
         {
             getControllerTrackingColorPreset(tracked_controller, tracked_color_id, &hsvColorRange);
@@ -1145,29 +2994,106 @@ ServerTrackerView::computeProjectionForController(
         }
     }
 
-	// Compute a region of interest in the tracker buffer around where we expect to find the tracking shape
-	const TrackerManagerConfig &trackerMgrConfig= DeviceManager::getInstance()->m_tracker_manager->getConfig();
-	const bool bRoiDisabled = tracked_controller->getIsROIDisabled() || trackerMgrConfig.disable_roi;
+	// Compute a region of interest in the tracker buffer around where we expect to find the tracking shape.
+	// The pose estimate's bDisableROI flag only scopes the full-frame search
+	// to this controller-tracker pair - the other trackers keep their ROIs.
+	// This runs on the pose estimation worker threads, so read the config
+	// through the published snapshot - one fetch covers the whole projection
+	const std::shared_ptr<const TrackerManager::ConfigSnapshot> configSnapshot=
+		DeviceManager::getInstance()->m_tracker_manager->getConfigSnapshot();
+	const TrackerManagerConfig &trackerMgrConfig= configSnapshot->config;
+
+	// When the auto-tuner is enabled, segment with the in-memory tuned copy
+	// of the preset instead - it follows the venue lighting while the stored
+	// preset stays the anchor the drift clamp is measured against
+	if (bSuccess && trackerMgrConfig.enable_color_auto_tuning)
+	{
+		ColorAutoTuningState &tuning_state= m_color_auto_tuning_states[tracked_color_id];
+
+		if (!tuning_state.bHasBaseline)
+		{
+			tuning_state.baseline_preset= hsvColorRange;
+			tuning_state.tuned_preset= hsvColorRange;
+			tuning_state.bHasBaseline= true;
+		}
+
+		hsvColorRange= tuning_state.tuned_preset;
+	}
+
+	const bool bRoiDisabled =
+		tracked_controller->getIsROIDisabled() || trackerMgrConfig.disable_roi ||
+		out_pose_estimate->bDisableROI;
+
+	// The per-pair full-frame search request is one-shot
+	out_pose_estimate->bDisableROI= false;
 
-	const ControllerOpticalPoseEstimation *priorPoseEst= 
+	const ControllerOpticalPoseEstimation *priorPoseEst=
 		tracked_controller->getTrackerPoseEstimate(this->getDeviceID());
 	const bool bIsTracking = priorPoseEst->bCurrentlyTracking;
 
 	cv::Rect2i ROI= computeTrackerROIForPoseProjection(
 		bRoiDisabled,
-		this,		
+		this,
 		bIsTracking ? tracked_controller->getPoseFilter() : nullptr,
 		bIsTracking ? &priorPoseEst->projection : nullptr,
-		tracking_shape);
+		tracked_controller->getTrackingShapeBoundingRadiusCm());
+
+	// When tracking was lost the fallback ROI is the whole frame. If another
+	// tracker still sees the controller, project the filtered multicam
+	// position into this tracker's image to seed a small re-acquisition
+	// window (the common walk-between-cameras handoff). Otherwise localize
+	// candidate blobs on a downscaled copy first and refine only the best
+	// candidate's neighborhood at native resolution. If the coarse pass sees
+	// nothing, skip the native-resolution scan for this frame entirely.
+	if (bSuccess && !bIsTracking && !bRoiDisabled)
+	{
+		cv::Rect2i handoffROI;
+		cv::Rect2i coarseROI;
+
+		if (tracked_controller->getIsCurrentlyTracking() &&
+			computeTrackerROIFromFilterPosition(
+				this, tracked_controller->getPoseFilter(), tracked_controller->getTrackingShapeBoundingRadiusCm(), handoffROI))
+		{
+			ROI= handoffROI;
+			out_pose_estimate->coarse_reacquisition_failure_count= 0;
+		}
+		else if (m_opencv_buffer_state->computeCoarseReacquisitionROI(hsvColorRange, 1, coarseROI))
+		{
+			ROI= coarseROI;
+			out_pose_estimate->coarse_reacquisition_failure_count= 0;
+		}
+		else
+		{
+			// Enough consecutive misses escalate to one native full-frame
+			// search on this tracker alone - the blob may be visible here
+			// but too small to survive the downscale
+			++out_pose_estimate->coarse_reacquisition_failure_count;
+			if (out_pose_estimate->coarse_reacquisition_failure_count >= k_max_coarse_reacquisition_failures)
+			{
+				out_pose_estimate->bDisableROI= true;
+				out_pose_estimate->coarse_reacquisition_failure_count= 0;
+			}
+
+			bSuccess= false;
+		}
+	}
 
-    m_opencv_buffer_state->applyROI(ROI);
+    if (bSuccess)
+    {
+        m_opencv_buffer_state->applyROI(ROI);
+    }
 
     // Find the contour associated with the controller
-	t_opencv_int_contour_list biggest_contours;
-    std::vector<double> contour_areas;
+	t_opencv_int_contour_list &biggest_contours = m_opencv_buffer_state->scratch_biggest_contours;
+    std::vector<double> &contour_areas = m_opencv_buffer_state->scratch_contour_areas;
     if (bSuccess)
     {
-        bSuccess = m_opencv_buffer_state->computeBiggestNContours(hsvColorRange, biggest_contours, contour_areas, 1);
+        // While tracking, hand the prescreen last frame's projection area so
+        // multi-candidate frames get ranked by the cheap prior instead of
+        // materializing a contour per candidate
+        bSuccess = m_opencv_buffer_state->computeBiggestNContours(
+            tracked_color_id, hsvColorRange, biggest_contours, contour_areas, 1,
+            bIsTracking ? priorPoseEst->projection.screen_area : -1.f);
     }
     
     // Process the contour for its 2D and 3D pose.
@@ -1175,10 +3101,9 @@ ServerTrackerView::computeProjectionForController(
     {
         // Get camera parameters.
         // Needed for undistortion.
-        cv::Matx33f camera_matrix;
-        cv::Matx<float, 5, 1> distortions;
-        computeOpenCVCameraIntrinsicMatrix(m_device, camera_matrix, distortions);
-                
+        const cv::Matx33f &camera_matrix = m_transform_cache->intrinsic_matrix;
+        const cv::Matx<float, 5, 1> &distortions = m_transform_cache->distortion_coefficients;
+
         // Compute the tracker relative 3d position of the controller from the contour
         switch (tracking_shape->shape_type)
         {
@@ -1186,30 +3111,38 @@ ServerTrackerView::computeProjectionForController(
         case eCommonTrackingShapeType::Sphere:
             {
 				// Compute the convex hull of the contour
-				t_opencv_int_contour convex_contour;
+				t_opencv_int_contour &convex_contour = m_opencv_buffer_state->scratch_convex_contour;
 				cv::convexHull(biggest_contours[0], convex_contour);
 				m_opencv_buffer_state->draw_contour(convex_contour);
 
+				// Cap the number of hull points fed into undistortion and the
+				// ellipse fit (close-up blobs can hull to hundreds of points).
+				// The effective budget drops to coarse when the frame budget
+				// governor is shedding optical work.
+				decimateContourToPointBudget(
+					convex_contour,
+					DeviceManager::getInstance()->m_tracker_manager->getEffectiveMaxContourFitPoints());
+
 				// Convert integer to float
-				t_opencv_float_contour convex_contour_f;
+				t_opencv_float_contour &convex_contour_f = m_opencv_buffer_state->scratch_contour_f;
 				cv::Mat(convex_contour).convertTo(convex_contour_f, cv::Mat(convex_contour_f).type());
 
-                // Undistort points
-				t_opencv_float_contour undistort_contour;  //destination for undistorted contour
-                cv::undistortPoints(convex_contour_f, undistort_contour,
-                                    camera_matrix,
-                                    distortions);//,
-                                    //cv::noArray(),
-                                    //camera_matrix);
-                // Note: if we omit the last two arguments, then
-                // undistort_contour points are in 'normalized' space.
+                // Undistort points via the precomputed map (LUT interpolation
+                // instead of running the iterative solver per contour point)
+				t_opencv_float_contour &undistort_contour = m_opencv_buffer_state->scratch_undistort_contour;  //destination for undistorted contour
+                m_opencv_buffer_state->undistort_lut->undistortContourNormalized(
+                    convex_contour_f, undistort_contour);
+                // Note: the normalized variant matches cv::undistortPoints
+                // without the last two arguments - the undistort_contour
+                // points are in 'normalized' space.
                 // i.e., they are relative to their F_PX,F_PY
                 
                 // Compute the sphere center AND the projected ellipse
                 Eigen::Vector3f sphere_center;
                 EigenFitEllipse ellipse_projection;
 
-                std::vector<Eigen::Vector2f> eigen_contour;
+                std::vector<Eigen::Vector2f> &eigen_contour = m_opencv_buffer_state->scratch_eigen_contour;
+                eigen_contour.clear();
                 std::for_each(undistort_contour.begin(),
                               undistort_contour.end(),
                               [&eigen_contour](cv::Point2f& p) {
@@ -1225,6 +3158,13 @@ ServerTrackerView::computeProjectionForController(
                 //Save the optically-estimate 3D pose.
                 out_pose_estimate->position_cm.set(sphere_center.x(), sphere_center.y(), sphere_center.z());
                 out_pose_estimate->bCurrentlyTracking = true;
+                // Goodness-of-fit of the ellipse: mean algebraic residual per
+                // contour point in normalized space (folded into the rolling
+                // tracking quality metrics on the controller view)
+                out_pose_estimate->projection_fit_error =
+                    (eigen_contour.size() > 0)
+                    ? ellipse_projection.error / static_cast<float>(eigen_contour.size())
+                    : 0.f;
                 // Not possible to get an orientation off of a sphere
                 out_pose_estimate->orientation.clear();
                 out_pose_estimate->bOrientationValid = false;
@@ -1259,16 +3199,14 @@ ServerTrackerView::computeProjectionForController(
 				m_opencv_buffer_state->draw_contour(biggest_contours[0]);
 
 				// Convert integer contour to float
-				t_opencv_float_contour biggest_contour_f;
+				t_opencv_float_contour &biggest_contour_f = m_opencv_buffer_state->scratch_contour_f;
 				cv::Mat(biggest_contours[0]).convertTo(biggest_contour_f, cv::Mat(biggest_contour_f).type());
 
                 // Compute an undistorted version of the contour
-				t_opencv_float_contour undistort_contour;
-                cv::undistortPoints(biggest_contour_f, undistort_contour,
-                                    camera_matrix,
-									distortions,
-                                    cv::noArray(),
-                                    camera_matrix);
+                // (LUT interpolation, reprojected back into pixel space)
+				t_opencv_float_contour &undistort_contour = m_opencv_buffer_state->scratch_undistort_contour;
+                m_opencv_buffer_state->undistort_lut->undistortContourPixel(
+                    biggest_contour_f, undistort_contour);
 
 				// Compute the lightbar tracking projection from the undistored contour
                 bSuccess=
@@ -1299,6 +3237,92 @@ ServerTrackerView::computeProjectionForController(
 		}
 	}
 
+	// Between frames the auto-tuner periodically samples the HSV statistics
+	// of the blob we just segmented and nudges the tuned preset toward them,
+	// clamping the accumulated drift against the calibrated preset
+	if (bSuccess && trackerMgrConfig.enable_color_auto_tuning)
+	{
+		ColorAutoTuningState &tuning_state= m_color_auto_tuning_states[tracked_color_id];
+
+		if (--tuning_state.sample_countdown <= 0)
+		{
+			tuning_state.sample_countdown= k_color_auto_tuning_sample_period;
+
+			CommonHSVColorRange &tuned= tuning_state.tuned_preset;
+			const CommonHSVColorRange &baseline= tuning_state.baseline_preset;
+			float measured_hue, measured_saturation, measured_value;
+
+			if (m_opencv_buffer_state->computeBlobHSVStatistics(
+					biggest_contours[0], tuned.hue_range.center,
+					measured_hue, measured_saturation, measured_value))
+			{
+				const float rate= trackerMgrConfig.color_auto_tuning_rate;
+				const float max_drift= trackerMgrConfig.color_auto_tuning_max_drift;
+
+				// Blend each channel center toward the measured blob mean
+				float hue_center=
+					tuned.hue_range.center + wrapped_hue_difference(tuned.hue_range.center, measured_hue)*rate;
+				float saturation_center=
+					tuned.saturation_range.center + (measured_saturation - tuned.saturation_range.center)*rate;
+				float value_center=
+					tuned.value_range.center + (measured_value - tuned.value_range.center)*rate;
+
+				// Never let the tuned center drift further than max_drift
+				// from the calibrated preset (circular distance for hue)
+				hue_center=
+					baseline.hue_range.center +
+					clampf(wrapped_hue_difference(baseline.hue_range.center, hue_center), -max_drift, max_drift);
+				if (hue_center < 0.f)
+				{
+					hue_center+= 180.f;
+				}
+				else if (hue_center >= 180.f)
+				{
+					hue_center-= 180.f;
+				}
+				saturation_center=
+					clampf(saturation_center,
+						fmaxf(baseline.saturation_range.center - max_drift, 0.f),
+						fminf(baseline.saturation_range.center + max_drift, 255.f));
+				value_center=
+					clampf(value_center,
+						fmaxf(baseline.value_range.center - max_drift, 0.f),
+						fminf(baseline.value_range.center + max_drift, 255.f));
+
+				if (hue_center != tuned.hue_range.center ||
+					saturation_center != tuned.saturation_range.center ||
+					value_center != tuned.value_range.center)
+				{
+					tuned.hue_range.center= hue_center;
+					tuned.saturation_range.center= saturation_center;
+					tuned.value_range.center= value_center;
+					tuning_state.bDirty= true;
+				}
+			}
+		}
+
+		// Persist the tuned preset through the tracker profile at most once
+		// per save interval - the preset setter writes the config to disk
+		if (tuning_state.bDirty)
+		{
+			const std::chrono::time_point<std::chrono::high_resolution_clock> now=
+				std::chrono::high_resolution_clock::now();
+			const float seconds_since_save=
+				std::chrono::duration_cast<std::chrono::duration<float>>(now - m_last_color_auto_tuning_save_time).count();
+
+			if (seconds_since_save >= trackerMgrConfig.color_auto_tuning_save_interval)
+			{
+				// Go through the device directly rather than
+				// setControllerTrackingColorPreset() so the baseline anchor
+				// is not re-seated on our own save
+				m_device->setTrackingColorPreset(
+					tracked_controller->getConfigIdentifier(), tracked_color_id, &tuning_state.tuned_preset);
+				tuning_state.bDirty= false;
+				m_last_color_auto_tuning_save_time= now;
+			}
+		}
+	}
+
     return bSuccess;
 }
 
@@ -1342,19 +3366,20 @@ bool ServerTrackerView::computePoseForHMD(
 {
 	bool bSuccess = true;
 
-	// Get the tracking shape used by the controller
-	CommonDeviceTrackingShape tracking_shape;
+	// Get the tracking shape used by the HMD.
+	// Served from the view's open-time cache - the LED geometry is static,
+	// so there's no reason to re-query the device every frame per tracker.
+	const CommonDeviceTrackingShape *tracking_shape = tracked_hmd->getCachedTrackingShape();
 	if (bSuccess)
 	{
-		bSuccess = tracked_hmd->getTrackingShape(tracking_shape);
+		bSuccess = tracking_shape->shape_type != eCommonTrackingShapeType::INVALID_SHAPE;
 	}
 
 	// Get the HSV filter used to find the tracking blob
+	const eCommonTrackingColorID tracked_color_id = tracked_hmd->getTrackingColorID();
 	CommonHSVColorRange hsvColorRange;
 	if (bSuccess)
 	{
-		eCommonTrackingColorID tracked_color_id = tracked_hmd->getTrackingColorID();
-
 		if (tracked_color_id != eCommonTrackingColorID::INVALID_COLOR)
 		{
 			getHMDTrackingColorPreset(tracked_hmd, tracked_color_id, &hsvColorRange);
@@ -1365,64 +3390,114 @@ bool ServerTrackerView::computePoseForHMD(
 		}
 	}
     
-	// Compute a region of interest in the tracker buffer around where we expect to find the tracking shape
-	const bool bRoiDisabled = tracked_hmd->getIsROIDisabled() || DeviceManager::getInstance()->m_tracker_manager->getConfig().disable_roi;
-	const bool bIsTracking = tracked_hmd->getIsCurrentlyTracking();
+	// Compute a region of interest in the tracker buffer around where we expect to find the tracking shape.
+	// The pose estimate's bDisableROI flag only scopes the full-frame search
+	// to this hmd-tracker pair - the other trackers keep their ROIs.
+	const bool bRoiDisabled =
+		tracked_hmd->getIsROIDisabled() ||
+		DeviceManager::getInstance()->m_tracker_manager->getConfigSnapshot()->config.disable_roi ||
+		out_pose_estimate->bDisableROI;
+
+	// The per-pair full-frame search request is one-shot
+	out_pose_estimate->bDisableROI = false;
+
+	// Track per tracker: a stale projection on a tracker that lost the HMD
+	// shouldn't anchor its ROI while other trackers still see it
+	const HMDOpticalPoseEstimation *priorPoseEst =
+		tracked_hmd->getTrackerPoseEstimate(this->getDeviceID());
+	const bool bIsTracking = priorPoseEst != nullptr && priorPoseEst->bCurrentlyTracking;
+
 	cv::Rect2i ROI = computeTrackerROIForPoseProjection(
 		bRoiDisabled,
-		this, 
+		this,
 		bIsTracking ? tracked_hmd->getPoseFilter() : nullptr,
-		bIsTracking ? &tracked_hmd->getTrackerPoseEstimate(this->getDeviceID())->projection : nullptr,
-		&tracking_shape);
-	m_opencv_buffer_state->applyROI(ROI);
+		bIsTracking ? &priorPoseEst->projection : nullptr,
+		tracked_hmd->getTrackingShapeBoundingRadiusCm());
+
+	// When this tracker lost the HMD, seed a small re-acquisition window
+	// from the filtered multicam position if another tracker still sees it;
+	// otherwise localize candidate blobs on a downscaled copy first rather
+	// than scanning the whole frame at native resolution
+	if (bSuccess && !bIsTracking && !bRoiDisabled)
+	{
+		cv::Rect2i handoffROI;
+		cv::Rect2i coarseROI;
+
+		if (tracked_hmd->getIsCurrentlyTracking() &&
+			computeTrackerROIFromFilterPosition(
+				this, tracked_hmd->getPoseFilter(), tracked_hmd->getTrackingShapeBoundingRadiusCm(), handoffROI))
+		{
+			ROI = handoffROI;
+			out_pose_estimate->coarse_reacquisition_failure_count = 0;
+		}
+		else if (m_opencv_buffer_state->computeCoarseReacquisitionROI(
+				hsvColorRange, CommonDeviceTrackingProjection::MAX_POINT_CLOUD_POINT_COUNT, coarseROI))
+		{
+			ROI = coarseROI;
+			out_pose_estimate->coarse_reacquisition_failure_count = 0;
+		}
+		else
+		{
+			// Enough consecutive misses escalate to one native full-frame
+			// search on this tracker alone
+			++out_pose_estimate->coarse_reacquisition_failure_count;
+			if (out_pose_estimate->coarse_reacquisition_failure_count >= k_max_coarse_reacquisition_failures)
+			{
+				out_pose_estimate->bDisableROI = true;
+				out_pose_estimate->coarse_reacquisition_failure_count = 0;
+			}
+
+			bSuccess = false;
+		}
+	}
+
+	if (bSuccess)
+	{
+		m_opencv_buffer_state->applyROI(ROI);
+	}
 
 	// Find the N best contours associated with the HMD
-	t_opencv_int_contour_list biggest_contours;
-    std::vector<double> contour_areas;
+	t_opencv_int_contour_list &biggest_contours = m_opencv_buffer_state->scratch_biggest_contours;
+    std::vector<double> &contour_areas = m_opencv_buffer_state->scratch_contour_areas;
 	if (bSuccess)
 	{
 		bSuccess = 
 			m_opencv_buffer_state->computeBiggestNContours(
-				hsvColorRange, biggest_contours, contour_areas, CommonDeviceTrackingProjection::MAX_POINT_CLOUD_POINT_COUNT);
+				tracked_color_id, hsvColorRange, biggest_contours, contour_areas, CommonDeviceTrackingProjection::MAX_POINT_CLOUD_POINT_COUNT);
 	}
 
 	// Compute the tracker relative 3d position of the controller from the contour
 	if (bSuccess)
 	{
-        cv::Matx33f camera_matrix;
-        cv::Matx<float, 5, 1> distortions;
-        computeOpenCVCameraIntrinsicMatrix(m_device, camera_matrix, distortions);
-
 		// Undistort the source contours
-		t_opencv_float_contour_list undistorted_contours;
+		t_opencv_float_contour_list &undistorted_contours = m_opencv_buffer_state->scratch_undistorted_contours;
+		undistorted_contours.clear();
 		for (auto it = biggest_contours.begin(); it != biggest_contours.end(); ++it)
 		{
 			// Draw the source contour
 			m_opencv_buffer_state->draw_contour(*it);
 
 			// Convert integer contour to float
-			t_opencv_float_contour biggest_contour_f;
+			t_opencv_float_contour &biggest_contour_f = m_opencv_buffer_state->scratch_contour_f;
 			cv::Mat(*it).convertTo(biggest_contour_f, cv::Mat(biggest_contour_f).type());
 
 			// Compute an undistorted version of the contour
-			t_opencv_float_contour undistort_contour;
-			cv::undistortPoints(biggest_contour_f, undistort_contour,
-				camera_matrix,
-				distortions,
-				cv::noArray(),
-				camera_matrix);
+			// (LUT interpolation, reprojected back into pixel space)
+			t_opencv_float_contour &undistort_contour = m_opencv_buffer_state->scratch_undistort_contour;
+			m_opencv_buffer_state->undistort_lut->undistortContourPixel(
+				biggest_contour_f, undistort_contour);
 
 			undistorted_contours.push_back(biggest_contour_f);
 		}
 
-		switch (tracking_shape.shape_type)
+		switch (tracking_shape->shape_type)
 		{
 		case eCommonTrackingShapeType::PointCloud:
 			{
 				bSuccess =
 					computeTrackerRelativePointCloudContourPose(
 						m_device,
-						&tracking_shape,
+						tracking_shape,
 						undistorted_contours,
 						tracker_pose_guess,
 						out_pose_estimate);
@@ -1444,8 +3519,7 @@ ServerTrackerView::computeWorldPosition(
     const CommonDevicePosition *tracker_relative_position) const
 {
     const glm::vec4 rel_pos(tracker_relative_position->x, tracker_relative_position->y, tracker_relative_position->z, 1.f);
-    const glm::mat4 cameraTransform= computeGLMCameraTransformMatrix(m_device);
-    const glm::vec4 world_pos = cameraTransform * rel_pos;
+    const glm::vec4 world_pos = m_transform_cache->camera_transform * rel_pos;
     
     CommonDevicePosition result;
     result.set(world_pos.x, world_pos.y, world_pos.z);
@@ -1457,18 +3531,19 @@ CommonDeviceQuaternion
 ServerTrackerView::computeWorldOrientation(
     const CommonDeviceQuaternion *tracker_relative_orientation) const
 {
-	// Compute a rotations that rotates from +X to global "forward"
-	const TrackerManagerConfig &cfg = DeviceManager::getInstance()->m_tracker_manager->getConfig();
-	const float global_forward_yaw_radians = cfg.global_forward_degrees*k_degrees_to_radians;
+	// Compute a rotations that rotates from +X to global "forward".
+	// Worker-thread reachable, so the config goes through the snapshot.
+	const std::shared_ptr<const TrackerManager::ConfigSnapshot> configSnapshot =
+		DeviceManager::getInstance()->m_tracker_manager->getConfigSnapshot();
+	const float global_forward_yaw_radians = configSnapshot->config.global_forward_degrees*k_degrees_to_radians;
 	const glm::quat global_forward_quat= glm::quat(glm::vec3(0.f, global_forward_yaw_radians, 0.f));
 	
 	const glm::quat rel_orientation(
         tracker_relative_orientation->w,
         tracker_relative_orientation->x,
         tracker_relative_orientation->y,
-        tracker_relative_orientation->z);    
-    const glm::quat camera_quat= computeGLMCameraTransformQuaternion(m_device);
-    const glm::quat world_quat = global_forward_quat * camera_quat * rel_orientation;
+        tracker_relative_orientation->z);
+    const glm::quat world_quat = global_forward_quat * m_transform_cache->camera_quat * rel_orientation;
     
     CommonDeviceQuaternion result;
     result.w= world_quat.w;
@@ -1484,8 +3559,7 @@ ServerTrackerView::computeTrackerPosition(
 	const CommonDevicePosition *world_relative_position) const
 {
     const glm::vec4 world_pos(world_relative_position->x, world_relative_position->y, world_relative_position->z, 1.f);
-    const glm::mat4 invCameraTransform= glm::inverse(computeGLMCameraTransformMatrix(m_device));
-    const glm::vec4 rel_pos = invCameraTransform * world_pos;
+    const glm::vec4 rel_pos = m_transform_cache->camera_transform_inverse * world_pos;
     
     CommonDevicePosition result;
     result.set(rel_pos.x, rel_pos.y, rel_pos.z);
@@ -1501,10 +3575,9 @@ ServerTrackerView::computeTrackerOrientation(
         world_relative_orientation->w,
         world_relative_orientation->x,
         world_relative_orientation->y,
-        world_relative_orientation->z);    
-    const glm::quat camera_inv_quat= glm::conjugate(computeGLMCameraTransformQuaternion(m_device));
+        world_relative_orientation->z);
     // combined_rotation = second_rotation * first_rotation;
-    const glm::quat rel_quat = camera_inv_quat * world_orientation;
+    const glm::quat rel_quat = m_transform_cache->camera_quat_inverse * world_orientation;
     
     CommonDeviceQuaternion result;
     result.w= rel_quat.w;
@@ -1613,9 +3686,10 @@ ServerTrackerView::triangulateWorldPose(
 					const Eigen::Vector3f right= mid_right_vertex - mid_left_vertex;
 
 					// Get the global definition of tracking space "forward" and "right"
-					const TrackerManagerConfig &cfg= DeviceManager::getInstance()->m_tracker_manager->getConfig();
-					const CommonDeviceVector &global_forward = cfg.get_global_forward_axis();
-					const CommonDeviceVector &global_right = cfg.get_global_right_axis();
+					const std::shared_ptr<const TrackerManager::ConfigSnapshot> configSnapshot=
+						DeviceManager::getInstance()->m_tracker_manager->getConfigSnapshot();
+					const CommonDeviceVector &global_forward = configSnapshot->config.get_global_forward_axis();
+					const CommonDeviceVector &global_right = configSnapshot->config.get_global_right_axis();
 					const Eigen::Vector3f eigen_global_forward(global_forward.i, global_forward.j, global_forward.k);
 					const Eigen::Vector3f eigen_global_right(global_right.i, global_right.j, global_right.k);
 
@@ -1656,6 +3730,52 @@ ServerTrackerView::triangulateWorldPose(
     return pose;
 }
 
+float
+ServerTrackerView::computeTrackingShapeBoundingRadius(
+	const CommonDeviceTrackingShape *tracking_shape)
+{
+	float shape_radius_cm = 1.f;
+
+	switch (tracking_shape->shape_type)
+	{
+	case eCommonTrackingShapeType::Sphere:
+		{
+			shape_radius_cm = fmaxf(tracking_shape->shape.sphere.radius_cm, 1.f);
+		} break;
+
+	case eCommonTrackingShapeType::LightBar:
+		{
+			const auto &shape_tl = tracking_shape->shape.light_bar.quad[CommonDeviceTrackingShape::QuadVertexUpperLeft];
+			const auto &shape_br = tracking_shape->shape.light_bar.quad[CommonDeviceTrackingShape::QuadVertexLowerRight];
+			const CommonDeviceVector half_vec = { (shape_tl.x - shape_br.x)*0.5f, (shape_tl.y - shape_br.y)*0.5f, (shape_tl.z - shape_br.z)*0.5f };
+
+			shape_radius_cm = fmaxf(sqrtf(half_vec.i*half_vec.i + half_vec.j*half_vec.j + half_vec.k*half_vec.k), 1.f);
+		} break;
+
+	case eCommonTrackingShapeType::PointCloud:
+		{
+			CommonDevicePosition shape_tl = tracking_shape->shape.point_cloud.point[0];
+			CommonDevicePosition shape_br = tracking_shape->shape.point_cloud.point[0];
+			for (int point_index = 1; point_index < tracking_shape->shape.point_cloud.point_count; ++point_index)
+			{
+				const CommonDevicePosition &point = tracking_shape->shape.point_cloud.point[point_index];
+				shape_tl.set(fmaxf(shape_tl.x, point.x), fmaxf(shape_tl.y, point.y), fmaxf(shape_tl.z, point.z));
+				shape_br.set(fminf(shape_br.x, point.x), fminf(shape_br.y, point.y), fminf(shape_br.z, point.z));
+			}
+			const CommonDeviceVector half_vec = { (shape_tl.x - shape_br.x)*0.5f, (shape_tl.y - shape_br.y)*0.5f, (shape_tl.z - shape_br.z)*0.5f };
+
+			shape_radius_cm = fmaxf(sqrtf(half_vec.i*half_vec.i + half_vec.j*half_vec.j + half_vec.k*half_vec.k), 1.f);
+		} break;
+
+	default:
+		{
+			assert(false && "unreachable");
+		} break;
+	}
+
+	return shape_radius_cm;
+}
+
 CommonDevicePosition
 ServerTrackerView::triangulateWorldPosition(
     const ServerTrackerView *tracker, 
@@ -1672,11 +3792,11 @@ ServerTrackerView::triangulateWorldPosition(
     cv::Mat projPoints1 = cv::Mat(cv::Point2f(screen_location->x, screen_location->y));
     cv::Mat projPoints2 = cv::Mat(cv::Point2f(other_screen_location->x, other_screen_location->y));
 
-    // Compute the pinhole camera matrix for each tracker that allows you to raycast
+    // Grab each tracker's cached pinhole camera matrix that allows you to raycast
     // from the tracker center in world space through the screen location, into the world
     // See: http://docs.opencv.org/2.4/modules/calib3d/doc/camera_calibration_and_3d_reconstruction.html
-    cv::Mat projMat1 = cv::Mat(computeOpenCVCameraPinholeMatrix(tracker->m_device));
-    cv::Mat projMat2 = cv::Mat(computeOpenCVCameraPinholeMatrix(other_tracker->m_device));
+    cv::Mat projMat1 = cv::Mat(tracker->m_transform_cache->pinhole_matrix);
+    cv::Mat projMat2 = cv::Mat(other_tracker->m_transform_cache->pinhole_matrix);
 
     // Triangulate the world position from the two cameras
     cv::Mat point3D(1, 1, CV_32FC4);
@@ -1718,11 +3838,11 @@ ServerTrackerView::triangulateWorldPositions(
 		projPoints2.push_back(cv::Point2f(p2.x, p2.y));
 	}
 
-    // Compute the pinhole camera matrix for each tracker that allows you to raycast
+    // Grab each tracker's cached pinhole camera matrix that allows you to raycast
     // from the tracker center in world space through the screen location, into the world
     // See: http://docs.opencv.org/2.4/modules/calib3d/doc/camera_calibration_and_3d_reconstruction.html
-    cv::Mat projMat1 = cv::Mat(computeOpenCVCameraPinholeMatrix(tracker->m_device));
-    cv::Mat projMat2 = cv::Mat(computeOpenCVCameraPinholeMatrix(other_tracker->m_device));
+    cv::Mat projMat1 = cv::Mat(tracker->m_transform_cache->pinhole_matrix);
+    cv::Mat projMat2 = cv::Mat(other_tracker->m_transform_cache->pinhole_matrix);
 
     // Triangulate the world positions from the two cameras
     cv::Mat points3D(1, screen_location_count, CV_32FC4);
@@ -1744,10 +3864,9 @@ ServerTrackerView::triangulateWorldPositions(
 std::vector<CommonDeviceScreenLocation>
 ServerTrackerView::projectTrackerRelativePositions(const std::vector<CommonDevicePosition> &objectPositions) const
 {
-    cv::Matx33f camera_matrix;
-    cv::Matx<float, 5, 1> distortions;
-    computeOpenCVCameraIntrinsicMatrix(m_device, camera_matrix, distortions);
-    
+    const cv::Matx33f &camera_matrix = m_transform_cache->intrinsic_matrix;
+    const cv::Matx<float, 5, 1> &distortions = m_transform_cache->distortion_coefficients;
+
     // Use the identity transform for tracker relative positions
     cv::Mat rvec(3, 1, cv::DataType<double>::type, double(0));
     cv::Mat tvec(3, 1, cv::DataType<double>::type, double(0));
@@ -1844,18 +3963,6 @@ static void computeOpenCVCameraIntrinsicMatrix(const ITrackerInterface *tracker_
     intrinsicOut(2, 0) = 0.f;   intrinsicOut(2, 1) = 0.f;   intrinsicOut(2, 2) = 1.f;
 }
 
-static cv::Matx34f computeOpenCVCameraPinholeMatrix(const ITrackerInterface *tracker_device)
-{
-    cv::Matx34f extrinsic_matrix;
-    computeOpenCVCameraExtrinsicMatrix(tracker_device, extrinsic_matrix);
-    cv::Matx33f intrinsic_matrix;
-    cv::Matx<float, 5, 1> distortion;
-    computeOpenCVCameraIntrinsicMatrix(tracker_device, intrinsic_matrix, distortion);
-    cv::Matx34f pinhole_matrix = intrinsic_matrix * extrinsic_matrix;
-
-    return pinhole_matrix;
-}
-
 static bool computeTrackerRelativeLightBarProjection(
     const CommonDeviceTrackingShape *tracking_shape,
     const t_opencv_float_contour &opencv_contour,
@@ -1947,8 +4054,13 @@ static bool computeTrackerRelativeLightBarPose(
 	assert(tracking_shape->shape_type == eCommonTrackingShapeType::LightBar);
     assert(projection->shape_type == eCommonTrackingProjectionType::ProjectionType_LightBar);
 
+	// Number of model-space corners in the lightbar shape (3 triangle + 4 quad)
+	const int k_lightbar_corner_count=
+		CommonDeviceTrackingShape::TriVertexCount + CommonDeviceTrackingShape::QuadVertexCount;
+
     bool bValidTrackerPose= true;
     std::vector<cv::Point2f> cvImagePoints;
+	cvImagePoints.reserve(k_lightbar_corner_count);
 
 	for (int vertex_index = 0; vertex_index < 3; ++vertex_index)
 	{
@@ -1972,6 +4084,7 @@ static bool computeTrackerRelativeLightBarPose(
         // triangle - right, left, bottom
         // quad - top right, top left, bottom left, bottom right
         std::vector<cv::Point3f> cvObjectPoints;
+        cvObjectPoints.reserve(k_lightbar_corner_count);
 
         for (int corner_index= 0; corner_index < 3; ++corner_index)
         {        
@@ -2019,15 +4132,48 @@ static bool computeTrackerRelativeLightBarPose(
             }
         }
 
+        bool bSolvedPose= false;
+
+        // When the guess pose already reprojects onto the observed corners
+        // within a fraction of the corner detection noise, keep it and skip
+        // the iterative solve entirely. A stationary DS4 hits this nearly
+        // every frame, and the solve dominates the lightbar tracking cost.
+        if (bUseExtrinsicGuess)
+        {
+            static const float k_max_early_out_reprojection_error_px= 0.5f;
+
+            std::vector<cv::Point2f> cvReprojectedPoints;
+            cv::projectPoints(cvObjectPoints, rvec, tvec, cvCameraMatrix, cvDistCoeffs, cvReprojectedPoints);
+
+            float max_reprojection_error_sqrd= 0.f;
+            for (int corner_index= 0; corner_index < k_lightbar_corner_count; ++corner_index)
+            {
+                const float dx= cvReprojectedPoints[corner_index].x - cvImagePoints[corner_index].x;
+                const float dy= cvReprojectedPoints[corner_index].y - cvImagePoints[corner_index].y;
+
+                max_reprojection_error_sqrd= fmaxf(max_reprojection_error_sqrd, dx*dx + dy*dy);
+            }
+
+            // rvec/tvec already hold the guess, which is also the solution
+            bSolvedPose=
+                max_reprojection_error_sqrd <=
+                k_max_early_out_reprojection_error_px*k_max_early_out_reprojection_error_px;
+        }
+
         // Solve the Perspective-N-Point problem:
         // Given a set of 3D points and their corresponding 2D pixel projections,
         // solve for the object position and orientation that would allow
         // us to re-project the 3D points back onto the 2D pixel locations
-        if (cv::solvePnP(
-                cvObjectPoints, cvImagePoints, 
-                cvCameraMatrix, cvDistCoeffs, 
-                rvec, tvec, 
-                bUseExtrinsicGuess, cv::SOLVEPNP_ITERATIVE))
+        if (!bSolvedPose)
+        {
+            bSolvedPose= cv::solvePnP(
+                cvObjectPoints, cvImagePoints,
+                cvCameraMatrix, cvDistCoeffs,
+                rvec, tvec,
+                bUseExtrinsicGuess, cv::SOLVEPNP_ITERATIVE);
+        }
+
+        if (bSolvedPose)
         {
             float axis_x, axis_y, axis_z, axis_theta;
             float yaw, pitch, roll;
@@ -2065,6 +4211,26 @@ static bool computeTrackerRelativeLightBarPose(
                 position.z = static_cast<float>(tvec.at<double>(2));
             }
 
+            // Record the goodness-of-fit of the solve as the mean corner
+            // reprojection error in pixels (folded into the rolling tracking
+            // quality metrics by ServerControllerView::updateTrackingQuality)
+            {
+                std::vector<cv::Point2f> cvReprojectedPoints;
+                cv::projectPoints(cvObjectPoints, rvec, tvec, cvCameraMatrix, cvDistCoeffs, cvReprojectedPoints);
+
+                float reprojection_error_sum= 0.f;
+                for (int corner_index= 0; corner_index < k_lightbar_corner_count; ++corner_index)
+                {
+                    const float dx= cvReprojectedPoints[corner_index].x - cvImagePoints[corner_index].x;
+                    const float dy= cvReprojectedPoints[corner_index].y - cvImagePoints[corner_index].y;
+
+                    reprojection_error_sum+= sqrtf(dx*dx + dy*dy);
+                }
+
+                out_pose_estimate->projection_fit_error=
+                    reprojection_error_sum / static_cast<float>(k_lightbar_corner_count);
+            }
+
             bValidTrackerPose= true;
         }
     }
@@ -2129,7 +4295,7 @@ static cv::Rect2i computeTrackerROIForPoseProjection(
 	const ServerTrackerView *tracker,
 	const IPoseFilter* pose_filter,
 	const CommonDeviceTrackingProjection *prior_tracking_projection,
-	const CommonDeviceTrackingShape *tracking_shape)
+	const float shape_bounding_radius_cm)
 {
 	// Get expected ROI
 	// Default to full screen.
@@ -2142,74 +4308,37 @@ static cv::Rect2i computeTrackerROIForPoseProjection(
 	//projected onto the image.
 	if (!roi_disabled && pose_filter != nullptr && prior_tracking_projection != nullptr)
 	{
-		// Get the (predicted) position in world space.
-		Eigen::Vector3f position_cm = pose_filter->getPositionCm(0.f); 
+		// Predict the position in world space ahead along the filtered
+		// velocity/acceleration so the search window tracks fast hand motion
+		// instead of trailing it and forcing a full-frame re-search.
+		const float dt= k_roi_prediction_lookahead_seconds;
+		const Eigen::Vector3f current_position_cm = pose_filter->getPositionCm(0.f);
+		const Eigen::Vector3f velocity_cm_per_sec = pose_filter->getVelocityCmPerSec();
+		const Eigen::Vector3f acceleration_cm_per_sec_sqr = pose_filter->getAccelerationCmPerSecSqr();
+		const Eigen::Vector3f predicted_position_cm =
+			current_position_cm
+			+ velocity_cm_per_sec*dt
+			+ acceleration_cm_per_sec_sqr*(0.5f*dt*dt);
+
 		CommonDevicePosition world_position_cm;
-		world_position_cm.set(position_cm.x(), position_cm.y(), position_cm.z());
+		world_position_cm.set(predicted_position_cm.x(), predicted_position_cm.y(), predicted_position_cm.z());
+		CommonDevicePosition current_world_position_cm;
+		current_world_position_cm.set(current_position_cm.x(), current_position_cm.y(), current_position_cm.z());
 
 		// Get the (predicted) position in tracker-local space.
 		CommonDevicePosition tracker_position_cm = tracker->computeTrackerPosition(&world_position_cm);
+		CommonDevicePosition current_tracker_position_cm = tracker->computeTrackerPosition(&current_world_position_cm);
 
 		// Project the state computed position +/- object extents onto the image.
+		// The extent is the shape's bounding radius, precomputed at device open
+		// time since the shape geometry never changes while the device is open.
 		CommonDevicePosition tl, br;
-		switch (tracking_shape->shape_type)
-		{
-		case eCommonTrackingShapeType::Sphere:
-			{
-				// Simply: center - radius, center + radius.
-				tl.set(tracker_position_cm.x - tracking_shape->shape.sphere.radius_cm,
-					tracker_position_cm.y + tracking_shape->shape.sphere.radius_cm,
-					tracker_position_cm.z);
-				br.set(tracker_position_cm.x + tracking_shape->shape.sphere.radius_cm,
-					tracker_position_cm.y - tracking_shape->shape.sphere.radius_cm,
-					tracker_position_cm.z);
-			} break;
-
-		case eCommonTrackingShapeType::LightBar:
-			{
-				// Compute the bounding radius of the lightbar tracking shape
-				const auto &shape_tl = tracking_shape->shape.light_bar.quad[CommonDeviceTrackingShape::QuadVertexUpperLeft];
-				const auto &shape_br = tracking_shape->shape.light_bar.quad[CommonDeviceTrackingShape::QuadVertexLowerRight];
-				const CommonDeviceVector half_vec = { (shape_tl.x - shape_br.x)*0.5f, (shape_tl.y - shape_br.y)*0.5f, (shape_tl.z - shape_br.z)*0.5f };
-				const auto shape_radius = fmaxf(sqrtf(half_vec.i*half_vec.i + half_vec.j*half_vec.j + half_vec.k*half_vec.k), 1.f);
-
-				// Simply: center - shape_radius, center + shape_radius.
-				tl.set(tracker_position_cm.x - shape_radius,
-					tracker_position_cm.y + shape_radius,
-					tracker_position_cm.z);
-				br.set(tracker_position_cm.x + shape_radius,
-					tracker_position_cm.y - shape_radius,
-					tracker_position_cm.z);
-			} break;
-
-		case eCommonTrackingShapeType::PointCloud:
-			{
-				// Compute the bounding radius of the point cloud
-				CommonDevicePosition shape_tl = tracking_shape->shape.point_cloud.point[0];
-				CommonDevicePosition shape_br = tracking_shape->shape.point_cloud.point[0];
-				for (int point_index = 1; point_index < tracking_shape->shape.point_cloud.point_count; ++point_index)
-				{
-					const CommonDevicePosition &point = tracking_shape->shape.point_cloud.point[point_index];
-					shape_tl.set(fmaxf(shape_tl.x, point.x), fmaxf(shape_tl.y, point.y), fmaxf(shape_tl.z, point.z));
-					shape_br.set(fminf(shape_br.x, point.x), fminf(shape_br.y, point.y), fminf(shape_br.z, point.z));
-				}
-				const CommonDeviceVector half_vec = { (shape_tl.x - shape_br.x)*0.5f, (shape_tl.y - shape_br.y)*0.5f, (shape_tl.z - shape_br.z)*0.5f };
-				const auto shape_radius = fmaxf(sqrtf(half_vec.i*half_vec.i + half_vec.j*half_vec.j + half_vec.k*half_vec.k), 1.f);
-
-				// Simply: center - shape_radius, center + shape_radius.
-				tl.set(tracker_position_cm.x - shape_radius,
-					tracker_position_cm.y + shape_radius,
-					tracker_position_cm.z);
-				br.set(tracker_position_cm.x + shape_radius,
-					tracker_position_cm.y - shape_radius,
-					tracker_position_cm.z);
-			} break;
-
-		default:
-			{
-				assert(false && "unreachable");
-			} break;
-		}
+		tl.set(tracker_position_cm.x - shape_bounding_radius_cm,
+			tracker_position_cm.y + shape_bounding_radius_cm,
+			tracker_position_cm.z);
+		br.set(tracker_position_cm.x + shape_bounding_radius_cm,
+			tracker_position_cm.y - shape_bounding_radius_cm,
+			tracker_position_cm.z);
 
 		// Extract the pixel projection center from the previous frame's projection.
 		CommonDeviceScreenLocation projection_pixel_center;
@@ -2253,10 +4382,12 @@ static cv::Rect2i computeTrackerROIForPoseProjection(
 			} break;
 		}
 
-		// The center of the ROI is the pixel projection center from last frame
-		// The size of the ROI computed by projecting the bounding box 
+		// The center of the ROI is the pixel projection center from last frame,
+		// advanced by the screen-space displacement of the predicted motion.
+		// The size of the ROI is computed by projecting the bounding box and
+		// padding by the same displacement so the blob stays inside the window.
 		{
-			std::vector<CommonDevicePosition> trps{ tl, br };
+			std::vector<CommonDevicePosition> trps{ tl, br, current_tracker_position_cm, tracker_position_cm };
 			std::vector<CommonDeviceScreenLocation> screen_locs = tracker->projectTrackerRelativePositions(trps);
 
 			const int proj_min_x = static_cast<int>(std::min(screen_locs[0].x, screen_locs[1].x));
@@ -2267,10 +4398,16 @@ static cv::Rect2i computeTrackerROIForPoseProjection(
 			const int proj_width = proj_max_x - proj_min_x;
 			const int proj_height = proj_max_y - proj_min_y;
 
-			const cv::Point2i roi_center(static_cast<int>(projection_pixel_center.x), static_cast<int>(projection_pixel_center.y));
+			// Screen-space displacement of the predicted motion over the lookahead window
+			const int motion_pixels_x = static_cast<int>(screen_locs[3].x - screen_locs[2].x);
+			const int motion_pixels_y = static_cast<int>(screen_locs[3].y - screen_locs[2].y);
+
+			const cv::Point2i roi_center(
+				static_cast<int>(projection_pixel_center.x) + motion_pixels_x,
+				static_cast<int>(projection_pixel_center.y) + motion_pixels_y);
 
-			const int safe_proj_width = std::max(proj_width, k_min_roi_size);
-			const int safe_proj_height = std::max(proj_height, k_min_roi_size);
+			const int safe_proj_width = std::max(proj_width, k_min_roi_size) + std::abs(motion_pixels_x);
+			const int safe_proj_height = std::max(proj_height, k_min_roi_size) + std::abs(motion_pixels_y);
 
 			const cv::Point2i roi_top_left = roi_center + cv::Point2i(-safe_proj_width, -safe_proj_height);
 			const cv::Size roi_size(2*safe_proj_width, 2*safe_proj_height);
@@ -2282,6 +4419,78 @@ static cv::Rect2i computeTrackerROIForPoseProjection(
 	return ROI;
 }
 
+/// Seed a re-acquisition ROI on a tracker that lost the device from the
+/// filtered multicam position (still fed by the trackers that see it).
+/// Unlike computeTrackerROIForPoseProjection this needs no prior projection
+/// on this tracker - the window is centered on the projected filter position.
+/// Returns false when the position lies behind the tracker or projects
+/// outside its frame.
+static bool computeTrackerROIFromFilterPosition(
+	const ServerTrackerView *tracker,
+	const IPoseFilter* pose_filter,
+	const float shape_bounding_radius_cm,
+	cv::Rect2i &out_roi)
+{
+	if (pose_filter == nullptr)
+	{
+		return false;
+	}
+
+	const Eigen::Vector3f position_cm = pose_filter->getPositionCm(0.f);
+
+	CommonDevicePosition world_position_cm;
+	world_position_cm.set(position_cm.x(), position_cm.y(), position_cm.z());
+
+	const CommonDevicePosition tracker_position_cm = tracker->computeTrackerPosition(&world_position_cm);
+
+	// Behind (or essentially at) the camera - the device can't be in view
+	if (tracker_position_cm.z < k_min_handoff_seed_distance_cm)
+	{
+		return false;
+	}
+
+	// Project the position +/- the precomputed shape extents onto the image
+	CommonDevicePosition tl, br;
+	tl.set(tracker_position_cm.x - shape_bounding_radius_cm,
+		tracker_position_cm.y + shape_bounding_radius_cm,
+		tracker_position_cm.z);
+	br.set(tracker_position_cm.x + shape_bounding_radius_cm,
+		tracker_position_cm.y - shape_bounding_radius_cm,
+		tracker_position_cm.z);
+
+	std::vector<CommonDevicePosition> trps{ tl, br, tracker_position_cm };
+	std::vector<CommonDeviceScreenLocation> screen_locs = tracker->projectTrackerRelativePositions(trps);
+
+	// The position was triangulated from other vantage points - reject seeds
+	// that land outside this tracker's frame
+	float screenWidth, screenHeight;
+	tracker->getPixelDimensions(screenWidth, screenHeight);
+
+	const CommonDeviceScreenLocation &projection_center = screen_locs[2];
+	if (projection_center.x < 0.f || projection_center.x >= screenWidth ||
+		projection_center.y < 0.f || projection_center.y >= screenHeight)
+	{
+		return false;
+	}
+
+	// Pad generously: the handoff seed carries the other trackers'
+	// triangulation error on top of this tracker's calibration error
+	const int proj_width = static_cast<int>(fabsf(screen_locs[1].x - screen_locs[0].x));
+	const int proj_height = static_cast<int>(fabsf(screen_locs[1].y - screen_locs[0].y));
+	const int safe_half_width = 2*std::max(proj_width, k_min_roi_size);
+	const int safe_half_height = 2*std::max(proj_height, k_min_roi_size);
+
+	const cv::Point2i roi_center(
+		static_cast<int>(projection_center.x),
+		static_cast<int>(projection_center.y));
+	const cv::Point2i roi_top_left = roi_center + cv::Point2i(-safe_half_width, -safe_half_height);
+	const cv::Size roi_size(2*safe_half_width, 2*safe_half_height);
+
+	out_roi = cv::Rect2i(roi_top_left, roi_size);
+
+	return true;
+}
+
 static bool computeBestFitTriangleForContour(
     const t_opencv_float_contour &opencv_contour,
     cv::Point2f &out_triangle_top,
@@ -2467,6 +4676,33 @@ cv::Point2f computeSafeCenterOfMassForContour(const t_opencv_contour_type &conto
 	return massCenter;
 }
 
+// Stride-decimate a contour down to the given point budget, in place.
+// Hull and contour points arrive perimeter-ordered, so uniform striding keeps
+// the surviving points well-spread around the shape. Ellipse fit quality
+// saturates around 30 well-spread points, so the default budget loses no
+// measurable accuracy while cutting the undistort+fit cost proportionally.
+template<typename t_opencv_contour_type>
+void decimateContourToPointBudget(t_opencv_contour_type &contour, const int max_point_count)
+{
+	const int point_count = static_cast<int>(contour.size());
+
+	if (max_point_count <= 0 || point_count <= max_point_count)
+	{
+		return;
+	}
+
+	const float stride = static_cast<float>(point_count) / static_cast<float>(max_point_count);
+
+	for (int out_index = 0; out_index < max_point_count; ++out_index)
+	{
+		const int in_index = static_cast<int>(static_cast<float>(out_index) * stride);
+
+		contour[out_index] = contour[in_index];
+	}
+
+	contour.resize(max_point_count);
+}
+
 // http://www.euclideanspace.com/maths/geometry/rotations/conversions/quaternionToAngle/index.htm
 static void commonDeviceOrientationToOpenCVRodrigues(
     const CommonDeviceQuaternion &orientation,
@@ -25,8 +25,17 @@ public:
 
     // Starts or stops streaming of the video feed to the shared memory buffer.
     // Keep a ref count of how many clients are following the stream.
-    void startSharedMemoryVideoStream();
-    void stopSharedMemoryVideoStream();
+    // Half resolution frames are only published while every listener asked
+    // for them; one full resolution subscriber upgrades the stream for all.
+    void startSharedMemoryVideoStream(bool bHalfResolution);
+    void stopSharedMemoryVideoStream(bool bHalfResolution);
+
+    // Starts or stops the MJPEG-compressed video stream pushed over TCP to
+    // remote clients. Keeps a ref count of how many clients are following the
+    // stream; the encoder worker thread only exists while the count is
+    // non-zero.
+    void startCompressedVideoStream();
+    void stopCompressedVideoStream();
 
     // Fetch the next video frame and copy to shared memory
     bool poll() override;
@@ -44,6 +53,8 @@ public:
 
     // Returns the name of the shared memory block video frames are written to
     std::string getSharedMemoryStreamName() const;
+    // Frames written to the shared memory video stream since it was opened
+    int getSharedMemoryFramesWritten() const;
     
     void loadSettings();
     void saveSettings();
@@ -98,6 +109,11 @@ public:
         const ServerTrackerView *tracker, const CommonDeviceTrackingProjection *tracker_relative_projection,
         const ServerTrackerView *other_tracker, const CommonDeviceTrackingProjection *other_tracker_relative_projection);
 
+    /// Bounding radius (cm) of a tracking shape, clamped to at least 1cm.
+    /// The shape geometry is static while a device is open, so device views
+    /// compute this once at open time rather than per projection pass.
+    static float computeTrackingShapeBoundingRadius(const struct CommonDeviceTrackingShape *tracking_shape);
+
     void getCameraIntrinsics(
         float &outFocalLengthX, float &outFocalLengthY,
         float &outPrincipalX, float &outPrincipalY,
@@ -129,8 +145,29 @@ public:
 	void setHMDTrackingColorPreset(const class ServerHMDView *controller, eCommonTrackingColorID color, const CommonHSVColorRange *preset);
 	void getHMDTrackingColorPreset(const class ServerHMDView *controller, eCommonTrackingColorID color, CommonHSVColorRange *out_preset) const;
 
+    // Record every blob on the current frame that passes the tracker's color
+    // thresholds as a static background exclusion area and persist the result.
+    // Capture with no tracked devices in view so only reflections are visible.
+    bool captureExclusionAreas();
+    // Forget the persisted exclusion areas
+    void clearExclusionAreas();
+
+    // Convert and label the union of the tracked devices' predicted search
+    // windows once per frame, so the per-device projection passes for both
+    // controllers and HMDs become cache hits against the shared label image
+    void prepareSharedSegmentationPass();
+
 protected:
     bool allocate_device_interface(const class DeviceEnumerator *enumerator) override;
+    // Gather the tracking colors claimed by the tracked devices so the
+    // segmentation stage can classify all of them in one pass over the ROI
+    void updateActiveTrackingColorList();
+    // Push the device's persisted exclusion areas into the segmentation state
+    void refreshExclusionAreas();
+    // Advance the one-shot exposure/gain optimization sweep run when
+    // tracking first starts (no-op unless enabled in the tracker manager
+    // config)
+    void updateAutoExposureCalibration();
     void free_device_interface() override;
     void publish_device_data_frame() override;
     static void generate_tracker_data_frame_for_stream(
@@ -138,10 +175,35 @@ protected:
         DeviceOutputDataFramePtr &data_frame);
 
 private:
+    // Per tracking color state for the lighting-drift color auto-tuner.
+    // Tracking colors are claimed exclusively by one device at a time,
+    // so keying the state by color is unambiguous.
+    struct ColorAutoTuningState
+    {
+        bool bHasBaseline; // baseline captured from the stored preset yet
+        bool bDirty; // the tuned preset differs from the persisted one
+        int sample_countdown; // frames until the next blob HSV sample
+        CommonHSVColorRange baseline_preset; // calibrated preset the drift clamp is anchored to
+        CommonHSVColorRange tuned_preset; // preset actually used for segmentation
+    };
+
     char m_shared_memory_name[256];
     class SharedVideoFrameReadWriteAccessor *m_shared_memory_accesor;
     int m_shared_memory_video_stream_count;
+    int m_shared_memory_half_res_stream_count;
     class OpenCVBufferState *m_opencv_buffer_state;
+    class TrackerVideoEncoder *m_video_encoder;
+    int m_compressed_video_stream_count;
+    // In-flight exposure/gain optimization sweep (allocated only while the
+    // sweep is running)
+    class TrackerAutoExposureCalibration *m_auto_exposure_calibration;
+    bool m_auto_exposure_calibrated; // the sweep already ran since open
+    ColorAutoTuningState m_color_auto_tuning_states[eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES];
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_last_color_auto_tuning_save_time;
+    // Camera transform matrices (world transform, inverse, pinhole projection)
+    // rebuilt when the tracker pose or intrinsics change and shared by all
+    // controller/HMD projection math
+    class TrackerPoseTransformCache *m_transform_cache;
     ITrackerInterface *m_device;
 };
 
@@ -0,0 +1,215 @@
+//-- includes -----
+#include "TrackerVideoEncoder.h"
+#include "ServerLog.h"
+#include "ServerUtility.h"
+#include "ThreadCpuMonitor.h"
+
+#include "opencv2/opencv.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+//-- public implementation -----
+TrackerVideoEncoder::TrackerVideoEncoder(
+    int tracker_id,
+    int jpeg_quality,
+    int max_fps)
+    : m_tracker_id(tracker_id)
+    , m_jpeg_quality(jpeg_quality)
+    , m_min_submit_interval(1000000 / std::max(max_fps, 1))
+    , m_bLastAcceptedSubmitTimeValid(false)
+    , m_pending_width(0)
+    , m_pending_height(0)
+    , m_bHasPendingFrame(false)
+    , m_encoded_width(0)
+    , m_encoded_height(0)
+    , m_encoded_sequence_num(0)
+    , m_bHasEncodedFrame(false)
+    , m_next_sequence_num(0)
+    , m_shutdown_requested(false)
+    , m_encoder_thread_started(false)
+{
+}
+
+TrackerVideoEncoder::~TrackerVideoEncoder()
+{
+    shutdown();
+}
+
+bool TrackerVideoEncoder::startup()
+{
+    if (!m_encoder_thread_started)
+    {
+        m_bLastAcceptedSubmitTimeValid= false;
+        m_bHasPendingFrame= false;
+        m_bHasEncodedFrame= false;
+        m_next_sequence_num= 0;
+
+        m_shutdown_requested= false;
+        m_encoder_thread = std::thread(&TrackerVideoEncoder::encoderThreadFunc, this);
+        m_encoder_thread_started= true;
+
+        SERVER_LOG_INFO("TrackerVideoEncoder::startup") <<
+            "Started video encoder thread for tracker id " << m_tracker_id <<
+            " (quality " << m_jpeg_quality << ")";
+    }
+
+    return m_encoder_thread_started;
+}
+
+void TrackerVideoEncoder::shutdown()
+{
+    if (m_encoder_thread_started)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_pending_mutex);
+            m_shutdown_requested= true;
+        }
+        m_pending_condition.notify_one();
+        m_encoder_thread.join();
+        m_encoder_thread_started= false;
+
+        SERVER_LOG_INFO("TrackerVideoEncoder::shutdown") <<
+            "Stopped video encoder thread for tracker id " << m_tracker_id;
+    }
+}
+
+bool TrackerVideoEncoder::getWouldAcceptFrame() const
+{
+    if (!m_bLastAcceptedSubmitTimeValid)
+    {
+        return true;
+    }
+
+    const std::chrono::time_point<std::chrono::high_resolution_clock> now=
+        std::chrono::high_resolution_clock::now();
+
+    return (now - m_last_accepted_submit_time) >= m_min_submit_interval;
+}
+
+void TrackerVideoEncoder::submitFrame(
+    const unsigned char *bgr_buffer,
+    int width,
+    int height,
+    int stride)
+{
+    const std::chrono::time_point<std::chrono::high_resolution_clock> now=
+        std::chrono::high_resolution_clock::now();
+
+    // Drop frames arriving faster than the configured rate cap before
+    // paying for the frame copy
+    if (m_bLastAcceptedSubmitTimeValid &&
+        (now - m_last_accepted_submit_time) < m_min_submit_interval)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_pending_mutex);
+
+        // Pack the frame rows tightly so the encoder thread doesn't need
+        // to know the camera buffer's stride
+        m_pending_bgr_buffer.resize(static_cast<size_t>(width)*static_cast<size_t>(height)*3);
+        for (int row = 0; row < height; ++row)
+        {
+            memcpy(
+                m_pending_bgr_buffer.data() + static_cast<size_t>(row)*static_cast<size_t>(width)*3,
+                bgr_buffer + static_cast<size_t>(row)*static_cast<size_t>(stride),
+                static_cast<size_t>(width)*3);
+        }
+
+        m_pending_width= width;
+        m_pending_height= height;
+        m_bHasPendingFrame= true;
+    }
+    m_pending_condition.notify_one();
+
+    m_last_accepted_submit_time= now;
+    m_bLastAcceptedSubmitTimeValid= true;
+}
+
+bool TrackerVideoEncoder::fetchEncodedFrame(
+    std::vector<unsigned char> &out_jpeg_buffer,
+    int &out_width,
+    int &out_height,
+    int &out_sequence_num)
+{
+    std::lock_guard<std::mutex> lock(m_encoded_mutex);
+
+    if (!m_bHasEncodedFrame)
+    {
+        return false;
+    }
+
+    out_jpeg_buffer= m_encoded_jpeg_buffer;
+    out_width= m_encoded_width;
+    out_height= m_encoded_height;
+    out_sequence_num= m_encoded_sequence_num;
+    m_bHasEncodedFrame= false;
+
+    return true;
+}
+
+//-- protected methods -----
+void TrackerVideoEncoder::encoderThreadFunc()
+{
+    char thread_name[32];
+    ServerUtility::format_string(thread_name, sizeof(thread_name), "video_enc_%d", m_tracker_id);
+    ThreadCpuMonitor::registerCurrentThread(thread_name);
+
+    std::vector<unsigned char> bgr_buffer;
+    std::vector<unsigned char> jpeg_buffer;
+    std::vector<int> encode_params;
+    encode_params.push_back(cv::IMWRITE_JPEG_QUALITY);
+    encode_params.push_back(m_jpeg_quality);
+
+    while (true)
+    {
+        int width= 0;
+        int height= 0;
+
+        // Wait for the service thread to hand over a frame (or shutdown)
+        {
+            std::unique_lock<std::mutex> lock(m_pending_mutex);
+            m_pending_condition.wait(
+                lock,
+                [this]{ return m_bHasPendingFrame || m_shutdown_requested; });
+
+            if (m_shutdown_requested)
+            {
+                break;
+            }
+
+            // Swap the frame out of the pending slot so the service thread
+            // can submit the next frame while this one encodes
+            bgr_buffer.swap(m_pending_bgr_buffer);
+            width= m_pending_width;
+            height= m_pending_height;
+            m_bHasPendingFrame= false;
+        }
+
+        // Encode outside of any lock - this is the expensive part
+        cv::Mat bgr_frame(height, width, CV_8UC3, bgr_buffer.data());
+        if (!cv::imencode(".jpg", bgr_frame, jpeg_buffer, encode_params))
+        {
+            SERVER_MT_LOG_ERROR("TrackerVideoEncoder::encoderThreadFunc") <<
+                "Failed to encode frame for tracker id " << m_tracker_id;
+            continue;
+        }
+
+        // Publish the finished frame for the service thread to collect
+        {
+            std::lock_guard<std::mutex> lock(m_encoded_mutex);
+
+            m_encoded_jpeg_buffer.swap(jpeg_buffer);
+            m_encoded_width= width;
+            m_encoded_height= height;
+            m_encoded_sequence_num= m_next_sequence_num;
+            m_bHasEncodedFrame= true;
+        }
+
+        ++m_next_sequence_num;
+    }
+
+    ThreadCpuMonitor::unregisterCurrentThread();
+}
@@ -0,0 +1,96 @@
+#ifndef TRACKER_VIDEO_ENCODER_H
+#define TRACKER_VIDEO_ENCODER_H
+
+//-- includes -----
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//-- definitions -----
+/// Owns a worker thread that JPEG-encodes tracker video frames for the
+/// compressed TCP video stream served to remote clients. The service thread
+/// submits the newest BGR frame after each camera poll and later collects the
+/// finished JPEG; the encode itself never runs on the vision thread.
+///
+/// Submission is latest-wins: if the encoder is still busy when the next frame
+/// arrives, the pending frame is overwritten and the older one is simply never
+/// encoded. Combined with the configured frame rate cap this bounds the
+/// encoder CPU cost no matter how fast the camera delivers frames.
+class TrackerVideoEncoder
+{
+public:
+    TrackerVideoEncoder(int tracker_id, int jpeg_quality, int max_fps);
+    ~TrackerVideoEncoder();
+
+    /// Spin up the encoder thread. Returns false if the thread failed to start.
+    bool startup();
+
+    /// Stop and join the encoder thread. Safe to call when not running.
+    void shutdown();
+
+    inline bool getIsRunning() const
+    {
+        return m_encoder_thread_started;
+    }
+
+    // -- Frame submission (service thread side only) --
+    /// True if a frame submitted right now would pass the rate cap.
+    /// Lets the caller skip preparing a frame the encoder would drop anyway.
+    bool getWouldAcceptFrame() const;
+
+    /// Copy the given BGR frame into the pending slot and wake the encoder.
+    /// Frames arriving faster than the configured rate cap are dropped here,
+    /// before the copy, so an idle stream costs almost nothing.
+    void submitFrame(const unsigned char *bgr_buffer, int width, int height, int stride);
+
+    // -- Encoded frame collection (service thread side only) --
+    /// Copy the most recently finished JPEG frame into the given buffer.
+    /// Returns false if no new frame finished since the last fetch.
+    bool fetchEncodedFrame(
+        std::vector<unsigned char> &out_jpeg_buffer,
+        int &out_width, int &out_height, int &out_sequence_num);
+
+protected:
+    void encoderThreadFunc();
+
+private:
+    int m_tracker_id;
+    int m_jpeg_quality;
+
+    // Minimum interval between accepted submissions, derived from the
+    // configured frame rate cap
+    std::chrono::microseconds m_min_submit_interval;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_last_accepted_submit_time;
+    bool m_bLastAcceptedSubmitTimeValid;
+
+    // Pending frame slot, written by the service thread and consumed by the
+    // encoder thread under m_pending_mutex. Latest submission wins.
+    std::mutex m_pending_mutex;
+    std::condition_variable m_pending_condition;
+    std::vector<unsigned char> m_pending_bgr_buffer;
+    int m_pending_width;
+    int m_pending_height;
+    bool m_bHasPendingFrame;
+
+    // Finished frame slot, written by the encoder thread and drained by the
+    // service thread under m_encoded_mutex. A slow collector only ever loses
+    // older frames, it never blocks the encoder.
+    std::mutex m_encoded_mutex;
+    std::vector<unsigned char> m_encoded_jpeg_buffer;
+    int m_encoded_width;
+    int m_encoded_height;
+    int m_encoded_sequence_num;
+    bool m_bHasEncodedFrame;
+
+    // Monotonic count of frames encoded, stamps the outgoing notifications
+    int m_next_sequence_num;
+
+    std::thread m_encoder_thread;
+    std::atomic_bool m_shutdown_requested;
+    bool m_encoder_thread_started;
+};
+
+#endif // TRACKER_VIDEO_ENCODER_H
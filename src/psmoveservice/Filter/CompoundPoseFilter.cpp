@@ -6,6 +6,55 @@
 #include "KalmanOrientationFilter.h"
 
 // -- public interface --
+CompoundPoseFilter *allocate_compound_pose_filter(
+	const OrientationFilterType orientationFilterType,
+	const PositionFilterType positionFilterType)
+{
+	CompoundPoseFilter *filter = nullptr;
+
+	// The combinations used as controller defaults get template-composed
+	// instantiations whose update path inlines the concrete filters
+	if (orientationFilterType == OrientationFilterTypeComplementaryMARG &&
+		positionFilterType == PositionFilterTypeLowPassExponential)
+	{
+		filter = new CompoundPoseFilterT<OrientationFilterComplementaryMARG, PositionFilterLowPassExponential>;
+	}
+	else if (orientationFilterType == OrientationFilterTypeComplementaryOpticalARG &&
+		positionFilterType == PositionFilterTypeComplimentaryOpticalIMU)
+	{
+		filter = new CompoundPoseFilterT<OrientationFilterComplementaryOpticalARG, PositionFilterComplimentaryOpticalIMU>;
+	}
+	else if (orientationFilterType == OrientationFilterTypeMadgwickMARG &&
+		positionFilterType == PositionFilterTypeLowPassOptical)
+	{
+		filter = new CompoundPoseFilterT<OrientationFilterMadgwickMARG, PositionFilterLowPassOptical>;
+	}
+	else if (orientationFilterType == OrientationFilterTypeMadgwickARG &&
+		positionFilterType == PositionFilterTypeLowPassOptical)
+	{
+		filter = new CompoundPoseFilterT<OrientationFilterMadgwickARG, PositionFilterLowPassOptical>;
+	}
+	else if (orientationFilterType == OrientationFilterTypeComplementaryMARG &&
+		positionFilterType == PositionFilterTypeOneEuro)
+	{
+		// The one-euro combinations exist for CPU-starved stations,
+		// so they are worth inlining too
+		filter = new CompoundPoseFilterT<OrientationFilterComplementaryMARG, PositionFilterOneEuro>;
+	}
+	else if (orientationFilterType == OrientationFilterTypeOneEuroOptical &&
+		positionFilterType == PositionFilterTypeOneEuro)
+	{
+		filter = new CompoundPoseFilterT<OrientationFilterOneEuroOptical, PositionFilterOneEuro>;
+	}
+	else
+	{
+		// Rare combination - fall back to virtual dispatch
+		filter = new CompoundPoseFilter;
+	}
+
+	return filter;
+}
+
 bool CompoundPoseFilter::init(
 	const CommonDeviceState::eDeviceType deviceType,
 	const OrientationFilterType orientationFilterType,
@@ -82,6 +131,9 @@ void CompoundPoseFilter::allocate_filters(
     case OrientationFilterTypeComplementaryMARG:
 		m_orientation_filter = new OrientationFilterComplementaryMARG;
 		break;
+    case OrientationFilterTypeOneEuroOptical:
+		m_orientation_filter = new OrientationFilterOneEuroOptical;
+		break;
 	case OrientationFilterTypeKalman:
 		{
 			switch (deviceType)
@@ -121,6 +173,9 @@ void CompoundPoseFilter::allocate_filters(
 	case PositionFilterTypeLowPassExponential:
 		m_position_filter = new PositionFilterLowPassExponential;
 		break;
+	case PositionFilterTypeOneEuro:
+		m_position_filter = new PositionFilterOneEuro;
+		break;
 	case PositionFilterTypeKalman:
 		m_position_filter = new KalmanPositionFilter;
 		break;
@@ -171,6 +226,83 @@ void CompoundPoseFilter::recenterOrientation(const Eigen::Quaternionf& q_pose)
 	}
 }
 
+bool CompoundPoseFilter::getConvergedState(std::vector<double> &out_values) const
+{
+	std::vector<double> orientation_values;
+	std::vector<double> position_values;
+
+	if (m_orientation_filter != nullptr)
+	{
+		m_orientation_filter->getConvergedState(orientation_values);
+	}
+
+	if (m_position_filter != nullptr)
+	{
+		m_position_filter->getConvergedState(position_values);
+	}
+
+	if (orientation_values.empty() && position_values.empty())
+	{
+		return false;
+	}
+
+	// Pack both child states into one list prefixed with the orientation
+	// value count so that setConvergedState can split them back apart
+	out_values.clear();
+	out_values.reserve(1 + orientation_values.size() + position_values.size());
+	out_values.push_back(static_cast<double>(orientation_values.size()));
+	out_values.insert(out_values.end(), orientation_values.begin(), orientation_values.end());
+	out_values.insert(out_values.end(), position_values.begin(), position_values.end());
+
+	return true;
+}
+
+bool CompoundPoseFilter::setConvergedState(const std::vector<double> &values)
+{
+	if (values.empty())
+	{
+		return false;
+	}
+
+	const size_t orientation_value_count = static_cast<size_t>(values[0]);
+
+	if (1 + orientation_value_count > values.size())
+	{
+		return false;
+	}
+
+	const std::vector<double> orientation_values(
+		values.begin() + 1, values.begin() + 1 + orientation_value_count);
+	const std::vector<double> position_values(
+		values.begin() + 1 + orientation_value_count, values.end());
+
+	bool bAppliedAny = false;
+
+	if (m_orientation_filter != nullptr && !orientation_values.empty())
+	{
+		bAppliedAny |= m_orientation_filter->setConvergedState(orientation_values);
+	}
+
+	if (m_position_filter != nullptr && !position_values.empty())
+	{
+		bAppliedAny |= m_position_filter->setConvergedState(position_values);
+	}
+
+	return bAppliedAny;
+}
+
+bool CompoundPoseFilter::getMagnetometerDecimationState(
+	int &out_update_interval_ticks, int &out_skipped_update_count) const
+{
+	if (m_orientation_filter != nullptr)
+	{
+		return m_orientation_filter->getMagnetometerDecimationState(
+			out_update_interval_ticks, out_skipped_update_count);
+	}
+
+	return false;
+}
+
 Eigen::Quaternionf CompoundPoseFilter::getOrientation(float time) const
 {
 	return (m_orientation_filter != nullptr) ? m_orientation_filter->getOrientation(time) : Eigen::Quaternionf::Identity();
@@ -13,6 +13,7 @@ enum OrientationFilterType {
     OrientationFilterTypeMadgwickMARG,
     OrientationFilterTypeComplementaryOpticalARG,
     OrientationFilterTypeComplementaryMARG,
+    OrientationFilterTypeOneEuroOptical,
 	OrientationFilterTypeKalman,
 };
 
@@ -23,6 +24,7 @@ enum PositionFilterType {
     PositionFilterTypeLowPassIMU,
     PositionFilterTypeComplimentaryOpticalIMU,
 	PositionFilterTypeLowPassExponential,
+    PositionFilterTypeOneEuro,
 	PositionFilterTypeKalman,
 };
 
@@ -55,6 +57,10 @@ public:
     void update(const float delta_time, const PoseFilterPacket &packet) override;
     void resetState() override;
 	void recenterOrientation(const Eigen::Quaternionf& q_pose) override;
+	bool getConvergedState(std::vector<double> &out_values) const override;
+	bool setConvergedState(const std::vector<double> &values) override;
+	bool getMagnetometerDecimationState(
+		int &out_update_interval_ticks, int &out_skipped_update_count) const override;
 
     // -- IPoseFilter ---
     Eigen::Quaternionf getOrientation(float time = 0.f) const override;
@@ -65,7 +71,7 @@ public:
     Eigen::Vector3f getAccelerationCmPerSecSqr() const override;
 
 protected:
-	void allocate_filters(
+	virtual void allocate_filters(
 		const CommonDeviceState::eDeviceType deviceType,
 		const OrientationFilterType orientationFilterType,
 		const PositionFilterType positionFilterType,
@@ -76,4 +82,53 @@ protected:
     IOrientationFilter *m_orientation_filter;
 };
 
+/// Template-composed variant of CompoundPoseFilter for filter combinations known
+/// at compile time. The per sample update path calls the concrete filter types
+/// directly so the compiler can inline them instead of dispatching through the
+/// IOrientationFilter/IPositionFilter vtables on every sample.
+template <class t_orientation_filter, class t_position_filter>
+class CompoundPoseFilterT : public CompoundPoseFilter
+{
+public:
+    void update(const float delta_time, const PoseFilterPacket &orientation_filter_packet) override
+    {
+        if (m_orientation_filter != nullptr && m_position_filter != nullptr)
+        {
+            // allocate_filters() guarantees the concrete filter types, so the
+            // qualified calls below can safely skip the vtable
+            t_orientation_filter *orientation_filter= static_cast<t_orientation_filter *>(m_orientation_filter);
+            t_position_filter *position_filter= static_cast<t_position_filter *>(m_position_filter);
+
+            // Update the orientation filter first
+            orientation_filter->t_orientation_filter::update(delta_time, orientation_filter_packet);
+
+            // Update the position filter using the latest orientation
+            PoseFilterPacket position_filter_packet= orientation_filter_packet;
+            position_filter_packet.current_orientation= orientation_filter->t_orientation_filter::getOrientation();
+
+            position_filter->t_position_filter::update(delta_time, position_filter_packet);
+        }
+    }
+
+protected:
+    void allocate_filters(
+        const CommonDeviceState::eDeviceType deviceType,
+        const OrientationFilterType orientationFilterType,
+        const PositionFilterType positionFilterType,
+        const PoseFilterConstants &constant) override
+    {
+        dispose_filters();
+
+        m_orientation_filter = new t_orientation_filter;
+        m_position_filter = new t_position_filter;
+    }
+};
+
+/// Allocate a pose filter for the given filter combination.
+/// Common combinations get a devirtualized CompoundPoseFilterT instantiation;
+/// everything else falls back to the virtual dispatch CompoundPoseFilter.
+CompoundPoseFilter *allocate_compound_pose_filter(
+    const OrientationFilterType orientationFilterType,
+    const PositionFilterType positionFilterType);
+
 #endif // COMPOUND_POSE_FILTER_H
\ No newline at end of file
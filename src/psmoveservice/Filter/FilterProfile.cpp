@@ -0,0 +1,110 @@
+//-- includes -----
+#include "FilterProfile.h"
+
+#include <chrono>
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#define FILTER_PROFILE_HAS_RDTSC
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+#include <x86intrin.h>
+#define FILTER_PROFILE_HAS_RDTSC
+#endif
+
+//-- private data ---
+namespace FilterProfile
+{
+    struct StageCounters
+    {
+        unsigned long long total_cycles;
+        unsigned long long sample_count;
+    };
+
+    static bool g_is_enabled = false;
+    static StageCounters g_counters[k_filter_count][k_stage_count];
+};
+
+//-- public interface ---
+void FilterProfile::setIsEnabled(const bool bEnabled)
+{
+    g_is_enabled = bEnabled;
+}
+
+bool FilterProfile::getIsEnabled()
+{
+    return g_is_enabled;
+}
+
+void FilterProfile::reset()
+{
+    for (int filter_index = 0; filter_index < k_filter_count; ++filter_index)
+    {
+        for (int stage_index = 0; stage_index < k_stage_count; ++stage_index)
+        {
+            g_counters[filter_index][stage_index].total_cycles = 0;
+            g_counters[filter_index][stage_index].sample_count = 0;
+        }
+    }
+}
+
+unsigned long long FilterProfile::readCycleCounter()
+{
+#if defined(FILTER_PROFILE_HAS_RDTSC)
+    return __rdtsc();
+#else
+    // No TSC on this architecture - fall back to a monotonic nanosecond clock.
+    // "Cycles" in the report are then nanoseconds, which still chart consistently
+    // across runs on the same machine.
+    return static_cast<unsigned long long>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+void FilterProfile::addSample(const eFilter filter, const eStage stage, const unsigned long long cycles)
+{
+    StageCounters &counters = g_counters[filter][stage];
+
+    counters.total_cycles += cycles;
+    counters.sample_count++;
+}
+
+unsigned long long FilterProfile::getTotalCycles(const eFilter filter, const eStage stage)
+{
+    return g_counters[filter][stage].total_cycles;
+}
+
+unsigned long long FilterProfile::getSampleCount(const eFilter filter, const eStage stage)
+{
+    return g_counters[filter][stage].sample_count;
+}
+
+const char *FilterProfile::getFilterName(const eFilter filter)
+{
+    switch (filter)
+    {
+    case Filter_KalmanOrientation:
+        return "KalmanOrientationFilter";
+    case Filter_KalmanPosition:
+        return "KalmanPositionFilter";
+    case Filter_KalmanPose:
+        return "KalmanPoseFilter";
+    default:
+        return "Unknown";
+    }
+}
+
+const char *FilterProfile::getStageName(const eStage stage)
+{
+    switch (stage)
+    {
+    case Stage_SigmaPointGeneration:
+        return "sigma_point_generation";
+    case Stage_Predict:
+        return "predict";
+    case Stage_MeasurementUpdate:
+        return "measurement_update";
+    default:
+        return "unknown";
+    }
+}
@@ -0,0 +1,75 @@
+#ifndef FILTER_PROFILE_H
+#define FILTER_PROFILE_H
+
+//-- includes -----
+// <none>
+
+//-- definitions -----
+/// Per-stage cycle counters for the Kalman filters.
+/// Disabled by default; the benchmark mode of test_kalman_filter enables it,
+/// runs the filters over a recorded stream and dumps the accumulated counters
+/// so filter performance can be charted across releases.
+namespace FilterProfile
+{
+    enum eFilter
+    {
+        Filter_KalmanOrientation,
+        Filter_KalmanPosition,
+        Filter_KalmanPose,
+
+        k_filter_count
+    };
+
+    enum eStage
+    {
+        Stage_SigmaPointGeneration,
+        Stage_Predict,
+        Stage_MeasurementUpdate,
+
+        k_stage_count
+    };
+
+    void setIsEnabled(const bool bEnabled);
+    bool getIsEnabled();
+
+    /// Zero all accumulated counters
+    void reset();
+
+    /// Read the CPU cycle counter (TSC on x86, a nanosecond clock elsewhere)
+    unsigned long long readCycleCounter();
+
+    void addSample(const eFilter filter, const eStage stage, const unsigned long long cycles);
+
+    unsigned long long getTotalCycles(const eFilter filter, const eStage stage);
+    unsigned long long getSampleCount(const eFilter filter, const eStage stage);
+
+    const char *getFilterName(const eFilter filter);
+    const char *getStageName(const eStage stage);
+
+    /// Times the enclosed scope and adds it as one sample when profiling is enabled
+    class ScopeTimer
+    {
+    public:
+        ScopeTimer(const eFilter filter, const eStage stage)
+            : m_filter(filter)
+            , m_stage(stage)
+            , m_start_cycles(getIsEnabled() ? readCycleCounter() : 0)
+        {
+        }
+
+        ~ScopeTimer()
+        {
+            if (getIsEnabled())
+            {
+                addSample(m_filter, m_stage, readCycleCounter() - m_start_cycles);
+            }
+        }
+
+    private:
+        const eFilter m_filter;
+        const eStage m_stage;
+        const unsigned long long m_start_cycles;
+    };
+};
+
+#endif // FILTER_PROFILE_H
@@ -1,5 +1,6 @@
 //-- includes --
 #include "KalmanOrientationFilter.h"
+#include "FilterProfile.h"
 #include "MathAlignment.h"
 
 #include <kalman/MeasurementModel.hpp>
@@ -60,6 +61,11 @@ enum DS4MeasurementEnum {
 // Arbitrary tuning scale applied to the process noise
 #define Q_SCALE 1.0
 
+// Number of filter ticks between full UKF measurement updates.
+// On the ticks in between, a cheap gyro integration advances the orientation mean
+// and all covariance work is deferred. 1 = run the full update every tick.
+#define FULL_UPDATE_DIVISOR 4
+
 // From: http://nbviewer.jupyter.org/github/rlabbe/Kalman-and-Bayesian-Filters-in-Python/blob/master/10-Unscented-Kalman-Filter.ipynb#Reasonable-Choices-for-the-Parameters
 // beta=2 is a good choice for Gaussian problems, 
 // kappa=3-n where n is the size of x is a good choice for kappa, 
@@ -71,7 +77,7 @@ enum DS4MeasurementEnum {
 
 //-- private methods ---
 template <class StateType>
-void Q_discrete_2rd_order_white_noise(const double dT, const double var, const int state_index, Kalman::Covariance<StateType> &Q);
+void Q_discrete_2rd_order_white_noise(const FilterScalar dT, const FilterScalar var, const int state_index, Kalman::Covariance<StateType> &Q);
 
 //-- private definitions --
 template<typename T>
@@ -90,41 +96,41 @@ public:
 	}
 
     // Accessors
-	Eigen::Quaterniond get_error_quaterniond() const {
-		return Eigen::Quaterniond((*this)[ERROR_QUATERNION_W], (*this)[ERROR_QUATERNION_X], (*this)[ERROR_QUATERNION_Y], (*this)[ERROR_QUATERNION_Z]);
+	FilterQuaternion get_error_quaternion() const {
+		return FilterQuaternion((*this)[ERROR_QUATERNION_W], (*this)[ERROR_QUATERNION_X], (*this)[ERROR_QUATERNION_Y], (*this)[ERROR_QUATERNION_Z]);
 	}
-	Eigen::Quaterniond get_error_quaterniond_dot() const {
-		return Eigen::Quaterniond((*this)[ERROR_Q_DOT_W], (*this)[ERROR_Q_DOT_X], (*this)[ERROR_Q_DOT_Y], (*this)[ERROR_Q_DOT_Z]);
+	FilterQuaternion get_error_quaternion_dot() const {
+		return FilterQuaternion((*this)[ERROR_Q_DOT_W], (*this)[ERROR_Q_DOT_X], (*this)[ERROR_Q_DOT_Y], (*this)[ERROR_Q_DOT_Z]);
 	}
-    Eigen::Vector3d get_angular_velocity_rad_per_sec() const {
-		Eigen::Quaterniond q = get_error_quaterniond();
-		Eigen::Quaterniond q_dot= get_error_quaterniond_dot();
-		return eigen_quaterniond_derivative_to_angular_velocity(q, q_dot);
+    FilterVector3 get_angular_velocity_rad_per_sec() const {
+		FilterQuaternion q = get_error_quaternion();
+		FilterQuaternion q_dot= get_error_quaternion_dot();
+		return eigen_quaternion_derivative_to_angular_velocity(q, q_dot);
     }
 
     // Mutators
-	void set_error_quaterniond(const Eigen::Quaterniond &q) {
+	void set_error_quaternion(const FilterQuaternion &q) {
 		(*this)[ERROR_QUATERNION_W] = q.w();
 		(*this)[ERROR_QUATERNION_X] = q.x();
 		(*this)[ERROR_QUATERNION_Y] = q.y();
 		(*this)[ERROR_QUATERNION_Z] = q.z();
 	}
-	void set_error_quaterniond_dot(const Eigen::Quaterniond &q_dot) {
+	void set_error_quaternion_dot(const FilterQuaternion &q_dot) {
 		(*this)[ERROR_Q_DOT_W] = q_dot.w();
 		(*this)[ERROR_Q_DOT_X] = q_dot.x();
 		(*this)[ERROR_Q_DOT_Y] = q_dot.y();
 		(*this)[ERROR_Q_DOT_Z] = q_dot.z();
 	}
-    void set_angular_velocity_rad_per_sec(const Eigen::Vector3d &v) {
-		Eigen::Quaterniond q = get_error_quaterniond();
-		Eigen::Quaterniond q_dot = eigen_angular_velocity_to_quaterniond_derivative(q, v);
+    void set_angular_velocity_rad_per_sec(const FilterVector3 &v) {
+		FilterQuaternion q = get_error_quaternion();
+		FilterQuaternion q_dot = eigen_angular_velocity_to_quaternion_derivative(q, v);
         (*this)[ERROR_Q_DOT_W] = q_dot.w();
 		(*this)[ERROR_Q_DOT_X] = q_dot.x(); 
 		(*this)[ERROR_Q_DOT_Y] = q_dot.y();
 		(*this)[ERROR_Q_DOT_Z] = q_dot.z();
     }
 };
-typedef OrientationStateVector<double> OrientationStateVectord;
+typedef OrientationStateVector<FilterScalar> OrientationStateVectorX;
 
 /**
 * @brief System model for a controller
@@ -132,10 +138,10 @@ typedef OrientationStateVector<double> OrientationStateVectord;
 * This is the system model defining how a controller advances from one
 * time-step to the next, i.e. how the system state evolves over time.
 */
-class OrientationSystemModel : public Kalman::SystemModel<OrientationStateVectord, Kalman::Vector<double, 0>, Kalman::SquareRootBase>
+class OrientationSystemModel : public Kalman::SystemModel<OrientationStateVectorX, Kalman::Vector<FilterScalar, 0>, Kalman::SquareRootBase>
 {
 public:
-	inline void set_time_step(const double dt) { m_time_step = dt; }
+	inline void set_time_step(const FilterScalar dt) { m_time_step = dt; }
 
 	void init(const OrientationFilterConstants &constants)
 	{
@@ -149,18 +155,18 @@ public:
 		if (m_last_tracking_projection_area < 0.f || 
 			!is_nearly_equal(tracking_projection_area, m_last_tracking_projection_area, 10.f))
 		{
-			const double mean_orientation_dT = constants.mean_update_time_delta;
+			const FilterScalar mean_orientation_dT = constants.mean_update_time_delta;
 
 			// Start off using the maximum variance values
 			static float q_scale = Q_SCALE;
-			float orientation_variance = q_scale * constants.orientation_variance_curve.evaluate(tracking_projection_area);
+			float orientation_variance = q_scale * constants.orientation_variance_curve.evaluateLUT(tracking_projection_area);
 
 			// Initialize the process covariance matrix Q
-			Kalman::Covariance<OrientationStateVectord> Q = Kalman::Covariance<OrientationStateVectord>::Zero();
-			Q_discrete_2rd_order_white_noise<OrientationStateVectord>(mean_orientation_dT, orientation_variance, ERROR_QUATERNION_W, Q);
-			Q_discrete_2rd_order_white_noise<OrientationStateVectord>(mean_orientation_dT, orientation_variance, ERROR_QUATERNION_X, Q);
-			Q_discrete_2rd_order_white_noise<OrientationStateVectord>(mean_orientation_dT, orientation_variance, ERROR_QUATERNION_Y, Q);
-			Q_discrete_2rd_order_white_noise<OrientationStateVectord>(mean_orientation_dT, orientation_variance, ERROR_QUATERNION_Z, Q);
+			Kalman::Covariance<OrientationStateVectorX> Q = Kalman::Covariance<OrientationStateVectorX>::Zero();
+			Q_discrete_2rd_order_white_noise<OrientationStateVectorX>(mean_orientation_dT, orientation_variance, ERROR_QUATERNION_W, Q);
+			Q_discrete_2rd_order_white_noise<OrientationStateVectorX>(mean_orientation_dT, orientation_variance, ERROR_QUATERNION_X, Q);
+			Q_discrete_2rd_order_white_noise<OrientationStateVectorX>(mean_orientation_dT, orientation_variance, ERROR_QUATERNION_Y, Q);
+			Q_discrete_2rd_order_white_noise<OrientationStateVectorX>(mean_orientation_dT, orientation_variance, ERROR_QUATERNION_Z, Q);
 			setCovariance(Q);
 
 			// Keep track last tracking projection area we built the covariance matrix for
@@ -180,37 +186,37 @@ public:
 	* @param [in] u The control vector input
 	* @returns The (predicted) system state in the next time-step
 	*/
-	OrientationStateVectord f(const OrientationStateVectord& old_state, const Kalman::Vector<double, 0>& control) const
+	OrientationStateVectorX f(const OrientationStateVectorX& old_state, const Kalman::Vector<FilterScalar, 0>& control) const
 	{
 		// Predicted state vector after transition
-		OrientationStateVectord new_state;
+		OrientationStateVectorX new_state;
 
 		// Extract parameters from the old state
-		const Eigen::Quaterniond error_q_old = old_state.get_error_quaterniond();
-		const Eigen::Quaterniond error_q_dot = old_state.get_error_quaterniond_dot();
+		const FilterQuaternion error_q_old = old_state.get_error_quaternion();
+		const FilterQuaternion error_q_dot = old_state.get_error_quaternion_dot();
 
 		// Compute the quaternion derivative of the current state
 		// q_new= q + q_dot*dT
-		const Eigen::Quaterniond error_q_step = Eigen::Quaterniond(error_q_dot.coeffs() * m_time_step);
-		const Eigen::Quaterniond error_q_new = Eigen::Quaterniond(error_q_old.coeffs() + error_q_step.coeffs());
+		const FilterQuaternion error_q_step = FilterQuaternion(error_q_dot.coeffs() * m_time_step);
+		const FilterQuaternion error_q_new = FilterQuaternion(error_q_old.coeffs() + error_q_step.coeffs());
 
 		// Save results to the new state
-		new_state.set_error_quaterniond(error_q_new.normalized());
-		new_state.set_error_quaterniond_dot(error_q_dot);
+		new_state.set_error_quaternion(error_q_new.normalized());
+		new_state.set_error_quaternion_dot(error_q_dot);
 
 		return new_state;
 	}
 
 protected:
-	double m_time_step;
+	FilterScalar m_time_step;
 	float m_last_tracking_projection_area;
 };
 
-class OrientationSRUKF : public Kalman::SquareRootUnscentedKalmanFilter<OrientationStateVectord>
+class OrientationSRUKF : public Kalman::SquareRootUnscentedKalmanFilter<OrientationStateVectorX>
 {
 public:
-	OrientationSRUKF(double alpha = 1.0, double beta = 2.0, double kappa = 0.0)
-		: Kalman::SquareRootUnscentedKalmanFilter<OrientationStateVectord>(alpha, beta, kappa)
+	OrientationSRUKF(FilterScalar alpha = 1.0, FilterScalar beta = 2.0, FilterScalar kappa = 0.0)
+		: Kalman::SquareRootUnscentedKalmanFilter<OrientationStateVectorX>(alpha, beta, kappa)
 	{
 	}
 
@@ -218,6 +224,13 @@ public:
 	{
 		return x;
 	}
+
+	// Expose the protected sigma point transform so that the benchmark harness
+	// can time it in isolation (predict() recomputes them internally)
+	bool computeSigmaPointsProfiled()
+	{
+		return computeSigmaPoints();
+	}
 };
 
 template<typename T>
@@ -227,28 +240,28 @@ public:
 	KALMAN_VECTOR(PSMove_OrientationMeasurementVector, T, PSMOVE_MEASUREMENT_PARAMETER_COUNT)
 
 	// Accessors
-	Eigen::Vector3d get_accelerometer() const {
-		return Eigen::Vector3d((*this)[PSMOVE_ACCELEROMETER_X], (*this)[PSMOVE_ACCELEROMETER_Y], (*this)[PSMOVE_ACCELEROMETER_Z]);
+	FilterVector3 get_accelerometer() const {
+		return FilterVector3((*this)[PSMOVE_ACCELEROMETER_X], (*this)[PSMOVE_ACCELEROMETER_Y], (*this)[PSMOVE_ACCELEROMETER_Z]);
 	}
-	Eigen::Vector3d get_gyroscope() const {
-		return Eigen::Vector3d((*this)[PSMOVE_GYROSCOPE_PITCH], (*this)[PSMOVE_GYROSCOPE_YAW], (*this)[PSMOVE_GYROSCOPE_ROLL]);
+	FilterVector3 get_gyroscope() const {
+		return FilterVector3((*this)[PSMOVE_GYROSCOPE_PITCH], (*this)[PSMOVE_GYROSCOPE_YAW], (*this)[PSMOVE_GYROSCOPE_ROLL]);
 	}
-	Eigen::Vector3d get_magnetometer() const {
-		return Eigen::Vector3d((*this)[PSMOVE_MAGNETOMETER_X], (*this)[PSMOVE_MAGNETOMETER_Y], (*this)[PSMOVE_MAGNETOMETER_Z]);
+	FilterVector3 get_magnetometer() const {
+		return FilterVector3((*this)[PSMOVE_MAGNETOMETER_X], (*this)[PSMOVE_MAGNETOMETER_Y], (*this)[PSMOVE_MAGNETOMETER_Z]);
 	}
 
 	// Mutators
-	void set_accelerometer(const Eigen::Vector3d &a) {
+	void set_accelerometer(const FilterVector3 &a) {
 		(*this)[PSMOVE_ACCELEROMETER_X] = a.x(); (*this)[PSMOVE_ACCELEROMETER_Y] = a.y(); (*this)[PSMOVE_ACCELEROMETER_Z] = a.z();
 	}
-	void set_gyroscope(const Eigen::Vector3d &g) {
+	void set_gyroscope(const FilterVector3 &g) {
 		(*this)[PSMOVE_GYROSCOPE_PITCH] = g.x(); (*this)[PSMOVE_GYROSCOPE_YAW] = g.y(); (*this)[PSMOVE_GYROSCOPE_ROLL] = g.z();
 	}
-	void set_magnetometer(const Eigen::Vector3d &m) {
+	void set_magnetometer(const FilterVector3 &m) {
 		(*this)[PSMOVE_MAGNETOMETER_X] = m.x(); (*this)[PSMOVE_MAGNETOMETER_Y] = m.y(); (*this)[PSMOVE_MAGNETOMETER_Z] = m.z();
 	}
 };
-typedef PSMove_OrientationMeasurementVector<double> PSMove_OrientationMeasurementVectord;
+typedef PSMove_OrientationMeasurementVector<FilterScalar> PSMove_OrientationMeasurementVectorX;
 
 template<typename T>
 class DS4_OrientationMeasurementVector : public Kalman::Vector<T, DS4_MEASUREMENT_PARAMETER_COUNT>
@@ -257,28 +270,28 @@ public:
 	KALMAN_VECTOR(DS4_OrientationMeasurementVector, T, DS4_MEASUREMENT_PARAMETER_COUNT)
 
 	// Accessors
-	Eigen::Vector3d get_accelerometer() const {
-		return Eigen::Vector3d((*this)[DS4_ACCELEROMETER_X], (*this)[DS4_ACCELEROMETER_Y], (*this)[DS4_ACCELEROMETER_Z]);
+	FilterVector3 get_accelerometer() const {
+		return FilterVector3((*this)[DS4_ACCELEROMETER_X], (*this)[DS4_ACCELEROMETER_Y], (*this)[DS4_ACCELEROMETER_Z]);
 	}
-	Eigen::Vector3d get_gyroscope() const {
-		return Eigen::Vector3d((*this)[DS4_GYROSCOPE_PITCH], (*this)[DS4_GYROSCOPE_YAW], (*this)[DS4_GYROSCOPE_ROLL]);
+	FilterVector3 get_gyroscope() const {
+		return FilterVector3((*this)[DS4_GYROSCOPE_PITCH], (*this)[DS4_GYROSCOPE_YAW], (*this)[DS4_GYROSCOPE_ROLL]);
 	}
-	Eigen::Vector3d get_optical_euler_heading_angle() const {
+	FilterVector3 get_optical_euler_heading_angle() const {
 		return (*this)[DS4_OPTICAL_EULER_ANGLE_HEADING];
 	}
 
 	// Mutators
-	void set_accelerometer(const Eigen::Vector3d &a) {
+	void set_accelerometer(const FilterVector3 &a) {
 		(*this)[DS4_ACCELEROMETER_X] = a.x(); (*this)[DS4_ACCELEROMETER_Y] = a.y(); (*this)[DS4_ACCELEROMETER_Z] = a.z();
 	}
-	void set_gyroscope(const Eigen::Vector3d &g) {
+	void set_gyroscope(const FilterVector3 &g) {
 		(*this)[DS4_GYROSCOPE_PITCH] = g.x(); (*this)[DS4_GYROSCOPE_YAW] = g.y(); (*this)[DS4_GYROSCOPE_ROLL] = g.z();
 	}
-	void set_optical_euler_heading_angle(const double heading_radians) {
+	void set_optical_euler_heading_angle(const FilterScalar heading_radians) {
 		(*this)[DS4_OPTICAL_EULER_ANGLE_HEADING] = heading_radians;
 	}
 };
-typedef DS4_OrientationMeasurementVector<double> DS4_OrientationMeasurementVectord;
+typedef DS4_OrientationMeasurementVector<FilterScalar> DS4_OrientationMeasurementVectorX;
 
 /**
 * @brief Orientation Measurement model for measuring PSMove controller
@@ -287,14 +300,14 @@ typedef DS4_OrientationMeasurementVector<double> DS4_OrientationMeasurementVecto
 * The measurement is given by the optical trackers.
 */
 class PSMove_OrientationMeasurementModel : 
-	public Kalman::MeasurementModel<OrientationStateVectord, PSMove_OrientationMeasurementVectord, Kalman::SquareRootBase>
+	public Kalman::MeasurementModel<OrientationStateVectorX, PSMove_OrientationMeasurementVectorX, Kalman::SquareRootBase>
 {
 public:
 	void init(const OrientationFilterConstants &constants)
 	{
 		// Update the measurement covariance R
-		Kalman::Covariance<PSMove_OrientationMeasurementVectord> R =
-			Kalman::Covariance<PSMove_OrientationMeasurementVectord>::Zero();
+		Kalman::Covariance<PSMove_OrientationMeasurementVectorX> R =
+			Kalman::Covariance<PSMove_OrientationMeasurementVectorX>::Zero();
 
 		// Only diagonals used so no need to compute Cholesky
 		static float r_accelerometer_scale = R_SCALE;
@@ -311,18 +324,18 @@ public:
 		R(PSMOVE_MAGNETOMETER_Z, PSMOVE_MAGNETOMETER_Z) = r_magnetometer_scale*constants.magnetometer_variance.z();
 		setCovariance(R);
 
-		identity_gravity_direction = constants.gravity_calibration_direction.cast<double>();
-		identity_magnetometer_direction = constants.magnetometer_calibration_direction.cast<double>();
-		m_last_world_orientation = Eigen::Quaterniond::Identity();
-		m_last_world_linear_acceleration_m_per_sec_sqr = Eigen::Vector3d::Zero();
+		identity_gravity_direction = constants.gravity_calibration_direction.cast<FilterScalar>();
+		identity_magnetometer_direction = constants.magnetometer_calibration_direction.cast<FilterScalar>();
+		m_last_world_orientation = FilterQuaternion::Identity();
+		m_last_world_linear_acceleration_m_per_sec_sqr = FilterVector3::Zero();
 	}
 
-	void update_world_orientation(const Eigen::Quaterniond &orientation)
+	void update_world_orientation(const FilterQuaternion &orientation)
 	{
 		m_last_world_orientation = orientation;
 	}
 
-	void update_world_linear_acceleration_m_per_sec_sqr(const Eigen::Vector3d &linear_acceleration)
+	void update_world_linear_acceleration_m_per_sec_sqr(const FilterVector3 &linear_acceleration)
 	{
 		m_last_world_linear_acceleration_m_per_sec_sqr = linear_acceleration;
 	}
@@ -337,29 +350,29 @@ public:
 	* @param [in] x The system state in current time-step
 	* @returns The (predicted) sensor measurement for the system state
 	*/
-	PSMove_OrientationMeasurementVectord h(const OrientationStateVectord& x) const
+	PSMove_OrientationMeasurementVectorX h(const OrientationStateVectorX& x) const
 	{
-		PSMove_OrientationMeasurementVectord predicted_measurement;
+		PSMove_OrientationMeasurementVectorX predicted_measurement;
 
 		// Use the orientation from the state for prediction
-		const Eigen::Quaterniond error_orientation = x.get_error_quaterniond();
-		const Eigen::Quaterniond world_to_local_orientation = eigen_quaternion_concatenate(m_last_world_orientation, error_orientation).normalized();
+		const FilterQuaternion error_orientation = x.get_error_quaternion();
+		const FilterQuaternion world_to_local_orientation = eigen_quaternion_concatenate(m_last_world_orientation, error_orientation).normalized();
 
 		// Use the current linear acceleration from last frame's state (###HipsterSloth $TODO Skews controller too much)
 		// and the current orientation from the state to predict
 		// what the accelerometer reading will be (in the space of the controller)
-		const Eigen::Vector3d &gravity_accel_g_units = identity_gravity_direction;
-		const Eigen::Vector3d linear_accel_g_units = Eigen::Vector3d::Zero(); //m_last_world_linear_acceleration * k_ms2_to_g_units;
-		const Eigen::Vector3d accel_world = linear_accel_g_units + gravity_accel_g_units;
-		const Eigen::Vector3d accel_local = eigen_vector3d_clockwise_rotate(world_to_local_orientation, accel_world);
+		const FilterVector3 &gravity_accel_g_units = identity_gravity_direction;
+		const FilterVector3 linear_accel_g_units = FilterVector3::Zero(); //m_last_world_linear_acceleration * k_ms2_to_g_units;
+		const FilterVector3 accel_world = linear_accel_g_units + gravity_accel_g_units;
+		const FilterVector3 accel_local = eigen_vector3_clockwise_rotate(world_to_local_orientation, accel_world);
 
 		// Use the angular velocity from the state to predict what the gyro reading will be
-		const Eigen::Vector3d gyro_local = x.get_angular_velocity_rad_per_sec();
+		const FilterVector3 gyro_local = x.get_angular_velocity_rad_per_sec();
 
 		// Use the orientation from the state to predict
 		// what the magnetometer reading should be (in the space of the controller)
-		const Eigen::Vector3d &mag_world = identity_magnetometer_direction;
-		const Eigen::Vector3d mag_local = eigen_vector3d_clockwise_rotate(world_to_local_orientation, mag_world);
+		const FilterVector3 &mag_world = identity_magnetometer_direction;
+		const FilterVector3 mag_local = eigen_vector3_clockwise_rotate(world_to_local_orientation, mag_world);
 
 		// Save the predictions into the measurement vector
 		predicted_measurement.set_accelerometer(accel_local);
@@ -370,10 +383,10 @@ public:
 	}
 
 public:
-	Eigen::Vector3d identity_gravity_direction;
-	Eigen::Vector3d identity_magnetometer_direction;
-	Eigen::Quaterniond m_last_world_orientation;
-	Eigen::Vector3d m_last_world_linear_acceleration_m_per_sec_sqr;
+	FilterVector3 identity_gravity_direction;
+	FilterVector3 identity_magnetometer_direction;
+	FilterQuaternion m_last_world_orientation;
+	FilterVector3 m_last_world_linear_acceleration_m_per_sec_sqr;
 };
 
 /**
@@ -383,7 +396,7 @@ public:
 * The measurement is given by the optical trackers.
 */
 class DS4_OrientationMeasurementModel
-	: public Kalman::MeasurementModel<OrientationStateVectord, DS4_OrientationMeasurementVectord, Kalman::SquareRootBase>
+	: public Kalman::MeasurementModel<OrientationStateVectorX, DS4_OrientationMeasurementVectorX, Kalman::SquareRootBase>
 {
 public:
 	void init(const OrientationFilterConstants &constants)
@@ -391,9 +404,9 @@ public:
 		m_last_tracking_projection_area = -1.f;
 		update_measurement_statistics(constants, 0.f);
 
-		identity_gravity_direction = constants.gravity_calibration_direction.cast<double>();
-		m_last_world_orientation = Eigen::Quaterniond::Identity();
-		m_last_world_linear_acceleration = Eigen::Vector3d::Zero();
+		identity_gravity_direction = constants.gravity_calibration_direction.cast<FilterScalar>();
+		m_last_world_orientation = FilterQuaternion::Identity();
+		m_last_world_linear_acceleration = FilterVector3::Zero();
 	}
 
 	void update_measurement_statistics(
@@ -405,9 +418,9 @@ public:
 			!is_nearly_equal(tracking_projection_area, m_last_tracking_projection_area, 10.f))
 		{
 			// Update the measurement covariance R
-			Kalman::Covariance<DS4_OrientationMeasurementVectord> R =
-				Kalman::Covariance<DS4_OrientationMeasurementVectord>::Zero();
-			const float orientation_variance = constants.orientation_variance_curve.evaluate(tracking_projection_area);
+			Kalman::Covariance<DS4_OrientationMeasurementVectorX> R =
+				Kalman::Covariance<DS4_OrientationMeasurementVectorX>::Zero();
+			const float orientation_variance = constants.orientation_variance_curve.evaluateLUT(tracking_projection_area);
 
 			static float r_scale = R_SCALE;
 			R(DS4_ACCELEROMETER_X, DS4_ACCELEROMETER_X) = r_scale*constants.accelerometer_variance.x();
@@ -424,12 +437,12 @@ public:
 		}
 	}
 
-	void update_world_orientation(const Eigen::Quaterniond &orientation)
+	void update_world_orientation(const FilterQuaternion &orientation)
 	{
 		m_last_world_orientation = orientation;
 	}
 
-	void update_world_linear_acceleration(const Eigen::Vector3d &linear_acceleration)
+	void update_world_linear_acceleration(const FilterVector3 &linear_acceleration)
 	{
 		m_last_world_linear_acceleration = linear_acceleration;
 	}
@@ -444,26 +457,26 @@ public:
 	* @param [in] x The system state in current time-step
 	* @returns The (predicted) sensor measurement for the system state
 	*/
-	DS4_OrientationMeasurementVectord h(const OrientationStateVectord& x) const
+	DS4_OrientationMeasurementVectorX h(const OrientationStateVectorX& x) const
 	{
-		DS4_OrientationMeasurementVectord predicted_measurement;
+		DS4_OrientationMeasurementVectorX predicted_measurement;
 
 		// Use the orientation from the state for prediction
-		const Eigen::Quaterniond error_orientation = x.get_error_quaterniond();
-		const Eigen::Quaterniond world_to_local_orientation = eigen_quaternion_concatenate(m_last_world_orientation, error_orientation).normalized();
-		const Eigen::EulerAnglesd euler_angles = eigen_quaterniond_to_euler_angles(world_to_local_orientation);
-		const double heading_angle = euler_angles.get_heading_radians();
+		const FilterQuaternion error_orientation = x.get_error_quaternion();
+		const FilterQuaternion world_to_local_orientation = eigen_quaternion_concatenate(m_last_world_orientation, error_orientation).normalized();
+		const FilterEulerAngles euler_angles = eigen_quaternion_to_euler_angles(world_to_local_orientation);
+		const FilterScalar heading_angle = euler_angles.get_heading_radians();
 
 		// Use the current linear acceleration from last frame's state (###HipsterSloth $TODO Skews controller too much)
 		// and the current orientation from the state to predict
 		// what the accelerometer reading will be (in the space of the controller)
-		const Eigen::Vector3d &gravity_accel_g_units = identity_gravity_direction;
-		const Eigen::Vector3d linear_accel_g_units = m_last_world_linear_acceleration * k_ms2_to_g_units;
-		const Eigen::Vector3d accel_world = linear_accel_g_units + gravity_accel_g_units;
-		const Eigen::Vector3d accel_local = eigen_vector3d_clockwise_rotate(world_to_local_orientation, accel_world);
+		const FilterVector3 &gravity_accel_g_units = identity_gravity_direction;
+		const FilterVector3 linear_accel_g_units = m_last_world_linear_acceleration * k_ms2_to_g_units;
+		const FilterVector3 accel_world = linear_accel_g_units + gravity_accel_g_units;
+		const FilterVector3 accel_local = eigen_vector3_clockwise_rotate(world_to_local_orientation, accel_world);
 
 		// Use the angular velocity from the state to predict what the gyro reading will be
-		const Eigen::Vector3d gyro_local = x.get_angular_velocity_rad_per_sec();
+		const FilterVector3 gyro_local = x.get_angular_velocity_rad_per_sec();
 
 		// Save the predictions into the measurement vector
 		predicted_measurement.set_accelerometer(accel_local);
@@ -475,9 +488,9 @@ public:
 
 public:
 	float m_last_tracking_projection_area;
-	Eigen::Vector3d identity_gravity_direction;
-	Eigen::Quaterniond m_last_world_orientation;
-	Eigen::Vector3d m_last_world_linear_acceleration;
+	FilterVector3 identity_gravity_direction;
+	FilterQuaternion m_last_world_orientation;
+	FilterVector3 m_last_world_linear_acceleration;
 };
 
 class KalmanOrientationFilterImpl
@@ -497,14 +510,19 @@ public:
 
 	/// The final output of this filter.
 	/// This isn't part of the UKF state vector because it's non-linear.
-	/// Instead we store "error euler angles" in the UKF state vector and then apply it 
+	/// Instead we store "error euler angles" in the UKF state vector and then apply it
 	/// to this quaternion after a time step and then zero out the error.
-	Eigen::Quaterniond world_orientation;
+	FilterQuaternion world_orientation;
+
+	/// Incremented every update. The full UKF measurement update only runs
+	/// on ticks divisible by FULL_UPDATE_DIVISOR; the rest take the gyro-only fast path.
+	int tick_index;
 
 	KalmanOrientationFilterImpl()
 		: bIsValid(false)
 		, bSeenOrientationMeasurement(false)
 		, world_orientation(Eigen::Quaternionf::Identity())
+		, tick_index(0)
 		, system_model()
 		, ukf(k_ukf_alpha, k_ukf_beta, k_ukf_kappa)
     {
@@ -515,10 +533,11 @@ public:
 		bIsValid = false;
 		bSeenOrientationMeasurement = false;
 
-		world_orientation = Eigen::Quaterniond::Identity();
+		world_orientation = FilterQuaternion::Identity();
+		tick_index = 0;
 
         system_model.init(constants);
-        ukf.init(OrientationStateVectord::Identity());
+        ukf.init(OrientationStateVectorX::Identity());
     }
 
 	virtual void init(
@@ -528,32 +547,46 @@ public:
 		bIsValid = true;
 		bSeenOrientationMeasurement = true;
 
-		world_orientation = orientation.cast<double>();
+		world_orientation = orientation.cast<FilterScalar>();
+		tick_index = 0;
 
 		system_model.init(constants);
-		ukf.init(OrientationStateVectord::Identity());
+		ukf.init(OrientationStateVectorX::Identity());
 		apply_error_to_world_quaternion();
 	}
 
 	// -- World Quaternion Accessors --
-	inline Eigen::Quaterniond compute_net_world_quaternion() const
+	inline FilterQuaternion compute_net_world_quaternion() const
 	{
-		const Eigen::Quaterniond error_quaternion= ukf.getState().get_error_quaterniond();
-		const Eigen::Quaterniond output_quaternion = eigen_quaternion_concatenate(world_orientation, error_quaternion).normalized();
+		const FilterQuaternion error_quaternion= ukf.getState().get_error_quaternion();
+		const FilterQuaternion output_quaternion = eigen_quaternion_concatenate(world_orientation, error_quaternion).normalized();
 		return output_quaternion;
 	}
 
 	// -- World Quaternion Mutators --
-	inline void set_world_quaternion(const Eigen::Quaterniond &orientation)
+	inline void set_world_quaternion(const FilterQuaternion &orientation)
 	{
 		world_orientation = orientation;
-		ukf.getStateMutable().set_error_quaterniond(Eigen::Quaterniond::Identity());
+		ukf.getStateMutable().set_error_quaternion(FilterQuaternion::Identity());
 	}
 
 	void apply_error_to_world_quaternion()
 	{
 		set_world_quaternion(compute_net_world_quaternion());
 	}
+
+	/// Cheap per-tick alternative to the full UKF update:
+	/// advance the mean world quaternion by integrating the gyro reading.
+	/// Covariance stays as the last full update left it.
+	void apply_gyro_only_update(const FilterScalar delta_time, const FilterVector3 &gyro_rad_per_sec)
+	{
+		const FilterQuaternion q_dot =
+			eigen_angular_velocity_to_quaternion_derivative(world_orientation, gyro_rad_per_sec);
+		const FilterQuaternion new_world_orientation =
+			FilterQuaternion(world_orientation.coeffs() + q_dot.coeffs()*delta_time).normalized();
+
+		set_world_quaternion(new_world_orientation);
+	}
 };
 
 class DS4KalmanOrientationFilterImpl : public KalmanOrientationFilterImpl
@@ -665,7 +698,57 @@ void KalmanOrientationFilter::resetState()
 
 void KalmanOrientationFilter::recenterOrientation(const Eigen::Quaternionf& q_pose)
 {
-	m_filter->world_orientation = q_pose.cast<double>();
+	m_filter->world_orientation = q_pose.cast<FilterScalar>();
+}
+
+bool KalmanOrientationFilter::getConvergedState(std::vector<double> &out_values) const
+{
+	if (m_filter == nullptr || !m_filter->bIsValid)
+	{
+		return false;
+	}
+
+	// Flatten the converged state covariance row-major so that it can be
+	// persisted in the controller config and used to warm-start the filter
+	// on the next service startup
+	const Kalman::Covariance<OrientationStateVectorX> P = m_filter->ukf.getCovariance();
+	const int state_dimension = static_cast<int>(P.rows());
+
+	out_values.clear();
+	out_values.reserve(state_dimension*state_dimension);
+	for (int row = 0; row < state_dimension; ++row)
+	{
+		for (int col = 0; col < state_dimension; ++col)
+		{
+			out_values.push_back(P(row, col));
+		}
+	}
+
+	return true;
+}
+
+bool KalmanOrientationFilter::setConvergedState(const std::vector<double> &values)
+{
+	const int state_dimension = static_cast<int>(OrientationStateVectorX::RowsAtCompileTime);
+
+	if (m_filter == nullptr ||
+		values.size() != static_cast<size_t>(state_dimension*state_dimension))
+	{
+		return false;
+	}
+
+	Kalman::Covariance<OrientationStateVectorX> P;
+	for (int row = 0; row < state_dimension; ++row)
+	{
+		for (int col = 0; col < state_dimension; ++col)
+		{
+			P(row, col) = static_cast<FilterScalar>(values[row*state_dimension + col]);
+		}
+	}
+
+	// setCovariance() re-derives the covariance square root and fails if the
+	// persisted matrix isn't positive definite (e.g. a hand-edited config)
+	return m_filter->ukf.setCovariance(P);
 }
 
 Eigen::Quaternionf KalmanOrientationFilter::getOrientation(float time) const
@@ -679,12 +762,13 @@ Eigen::Quaternionf KalmanOrientationFilter::getOrientation(float time) const
 
 		if (fabsf(time) > k_real_epsilon)
 		{
-			const Eigen::Quaternionf &quaternion_derivative =
-				eigen_angular_velocity_to_quaternion_derivative(result, getAngularVelocityRadPerSec());
+			// Integrate the gyro-derived angular velocity over the prediction
+			// horizon with the quaternion exponential map - the same step the
+			// UKF process model uses, and exact for constant angular velocity
+			const Eigen::Quaternionf q_delta =
+				eigen_angle_axis_to_quaternion(getAngularVelocityRadPerSec() * time);
 
-			predicted_orientation = Eigen::Quaternionf(
-				state_orientation.coeffs()
-				+ quaternion_derivative.coeffs()*time).normalized();
+			predicted_orientation = (state_orientation * q_delta).normalized();
 		}
 
 		result = predicted_orientation;
@@ -695,7 +779,7 @@ Eigen::Quaternionf KalmanOrientationFilter::getOrientation(float time) const
 
 Eigen::Vector3f KalmanOrientationFilter::getAngularVelocityRadPerSec() const
 {
-	Eigen::Vector3d ang_vel = m_filter->ukf.getState().get_angular_velocity_rad_per_sec();
+	FilterVector3 ang_vel = m_filter->ukf.getState().get_angular_velocity_rad_per_sec();
 
 	return ang_vel.cast<float>();
 }
@@ -736,24 +820,50 @@ void KalmanOrientationFilterDS4::update(const float delta_time, const PoseFilter
 	{
 		DS4KalmanOrientationFilterImpl *filter = static_cast<DS4KalmanOrientationFilterImpl *>(m_filter);
 
+		// Between full measurement updates just integrate the gyro into the orientation mean.
+		// Orientation accuracy is insensitive to the divisor while the CPU cost drops substantially.
+		static int full_update_divisor = FULL_UPDATE_DIVISOR;
+		filter->tick_index++;
+		if (filter->bSeenOrientationMeasurement &&
+			(filter->tick_index % full_update_divisor) != 0)
+		{
+			filter->apply_gyro_only_update(
+				static_cast<FilterScalar>(delta_time),
+				packet.imu_gyroscope_rad_per_sec.cast<FilterScalar>());
+			return;
+		}
+
 		// Adjust the amount we trust the process model based on the tracking projection area
 		filter->system_model.update_process_noise(m_constants, packet.tracking_projection_area_px_sqr);
 
+		// When profiling, time the sigma point transform on its own.
+		// predict() recomputes them internally so this doesn't alter the filter state.
+		if (FilterProfile::getIsEnabled())
+		{
+			FilterProfile::ScopeTimer timer(FilterProfile::Filter_KalmanOrientation, FilterProfile::Stage_SigmaPointGeneration);
+
+			filter->ukf.computeSigmaPointsProfiled();
+		}
+
 		// Predict state for current time-step using the filters
 		filter->system_model.set_time_step(delta_time);
-		filter->ukf.predict(filter->system_model);
+		{
+			FilterProfile::ScopeTimer timer(FilterProfile::Filter_KalmanOrientation, FilterProfile::Stage_Predict);
+
+			filter->ukf.predict(filter->system_model);
+		}
 
 		// Get the measurement model for the DS4 from the derived filter impl
 		DS4_OrientationMeasurementModel &measurement_model = filter->measurement_model;
 
 		// Update the linear acceleration on the measurement model with last frames acceleration state
 		measurement_model.update_world_linear_acceleration(
-			packet.get_current_acceleration_in_meters_per_second_squared().cast<double>());
+			packet.get_current_acceleration_in_meters_per_second_squared().cast<FilterScalar>());
 
 		// If this is the first time we have seen an orientation measurement, snap the orientation state
 		if (!m_filter->bSeenOrientationMeasurement && packet.tracking_projection_area_px_sqr > 0.f)
 		{
-			const Eigen::Quaterniond world_quaternion = packet.optical_orientation.cast<double>();
+			const FilterQuaternion world_quaternion = packet.optical_orientation.cast<FilterScalar>();
 
 			measurement_model.update_world_orientation(world_quaternion);
 
@@ -763,7 +873,7 @@ void KalmanOrientationFilterDS4::update(const float delta_time, const PoseFilter
 
 		// Project the current state onto a predicted measurement as a default
 		// in case no observation is available
-		DS4_OrientationMeasurementVectord local_measurement = measurement_model.h(filter->ukf.getState());
+		DS4_OrientationMeasurementVectorX local_measurement = measurement_model.h(filter->ukf.getState());
 
 		// Adjust the amount we trust the optical measurements based on the tracking projection area
 		measurement_model.update_measurement_statistics(
@@ -773,23 +883,27 @@ void KalmanOrientationFilterDS4::update(const float delta_time, const PoseFilter
 		// If available, use the optical orientation measurement
 		if (packet.tracking_projection_area_px_sqr > 0.f)
 		{
-			const Eigen::EulerAnglesd world_optical_euler_angles =
-				eigen_quaterniond_to_euler_angles(packet.optical_orientation.cast<double>());
-			const double world_optical_heading = world_optical_euler_angles.get_heading_radians();
+			const FilterEulerAngles world_optical_euler_angles =
+				eigen_quaternion_to_euler_angles(packet.optical_orientation.cast<FilterScalar>());
+			const FilterScalar world_optical_heading = world_optical_euler_angles.get_heading_radians();
 
 			local_measurement.set_optical_euler_heading_angle(world_optical_heading);
 		}
 
 		// Accelerometer and gyroscope measurements are always available
 		{
-			const Eigen::Vector3d world_accelerometer = packet.imu_accelerometer_g_units.cast<double>();
+			const FilterVector3 world_accelerometer = packet.imu_accelerometer_g_units.cast<FilterScalar>();
 
 			local_measurement.set_accelerometer(world_accelerometer);
-			local_measurement.set_gyroscope(packet.imu_gyroscope_rad_per_sec.cast<double>());
+			local_measurement.set_gyroscope(packet.imu_gyroscope_rad_per_sec.cast<FilterScalar>());
 		}
 
 		// Update UKF
-		filter->ukf.update(measurement_model, local_measurement);
+		{
+			FilterProfile::ScopeTimer timer(FilterProfile::Filter_KalmanOrientation, FilterProfile::Stage_MeasurementUpdate);
+
+			filter->ukf.update(measurement_model, local_measurement);
+		}
 
 		// Apply the orientation error in the UKF state to the output quaternion.
 		// Zero out the error in the UKF state vector.
@@ -801,7 +915,7 @@ void KalmanOrientationFilterDS4::update(const float delta_time, const PoseFilter
 	}
 	else
 	{
-		m_filter->ukf.init(OrientationStateVectord::Identity());
+		m_filter->ukf.init(OrientationStateVectorX::Identity());
 		m_filter->bIsValid = true;
 	}
 }
@@ -837,16 +951,42 @@ void KalmanOrientationFilterPSMove::update(const float delta_time, const PoseFil
     {
 		PSMoveKalmanPoseFilterImpl *filter = static_cast<PSMoveKalmanPoseFilterImpl *>(m_filter);
 
+		// Between full measurement updates just integrate the gyro into the orientation mean.
+		// Orientation accuracy is insensitive to the divisor while the CPU cost drops substantially.
+		static int full_update_divisor = FULL_UPDATE_DIVISOR;
+		filter->tick_index++;
+		if (filter->bSeenOrientationMeasurement &&
+			(filter->tick_index % full_update_divisor) != 0)
+		{
+			filter->apply_gyro_only_update(
+				static_cast<FilterScalar>(delta_time),
+				packet.imu_gyroscope_rad_per_sec.cast<FilterScalar>());
+			return;
+		}
+
+		// When profiling, time the sigma point transform on its own.
+		// predict() recomputes them internally so this doesn't alter the filter state.
+		if (FilterProfile::getIsEnabled())
+		{
+			FilterProfile::ScopeTimer timer(FilterProfile::Filter_KalmanOrientation, FilterProfile::Stage_SigmaPointGeneration);
+
+			filter->ukf.computeSigmaPointsProfiled();
+		}
+
         // Predict state for current time-step using the filters
 		filter->system_model.set_time_step(delta_time);
-		filter->ukf.predict(filter->system_model);
+		{
+			FilterProfile::ScopeTimer timer(FilterProfile::Filter_KalmanOrientation, FilterProfile::Stage_Predict);
+
+			filter->ukf.predict(filter->system_model);
+		}
 
         // Get the measurement model for the PSMove from the derived filter impl
 		PSMove_OrientationMeasurementModel &measurement_model = filter->measurement_model;
 
 		// Update the linear acceleration on the measurement model with last frames acceleration state
 		measurement_model.update_world_linear_acceleration_m_per_sec_sqr(
-			packet.get_current_acceleration_in_meters_per_second_squared().cast<double>());
+			packet.get_current_acceleration_in_meters_per_second_squared().cast<FilterScalar>());
 
 		// If this is the first time we have seen an orientation measurement, 
 		// snap the orientation state to a best fit alignment of the sensor measurements.
@@ -868,21 +1008,25 @@ void KalmanOrientationFilterPSMove::update(const float delta_time, const PoseFil
 			eigen_alignment_quaternion_between_vector_frames(
 				mg_from, mg_to, 0.1f, Eigen::Quaternionf::Identity(), initial_orientation);
 
-			measurement_model.update_world_orientation(initial_orientation.cast<double>());
+			measurement_model.update_world_orientation(initial_orientation.cast<FilterScalar>());
 
-			filter->set_world_quaternion(initial_orientation.cast<double>());
+			filter->set_world_quaternion(initial_orientation.cast<FilterScalar>());
 			filter->bSeenOrientationMeasurement = true;
 		}
 
 		// Accelerometer, gyroscope, magnetometer measurements are always available
-		PSMove_OrientationMeasurementVectord measurement = PSMove_OrientationMeasurementVectord::Zero();
-		measurement.set_accelerometer(packet.imu_accelerometer_g_units.cast<double>());
-		measurement.set_gyroscope(packet.imu_gyroscope_rad_per_sec.cast<double>());
-		measurement.set_magnetometer(packet.imu_magnetometer_unit.cast<double>());
+		PSMove_OrientationMeasurementVectorX measurement = PSMove_OrientationMeasurementVectorX::Zero();
+		measurement.set_accelerometer(packet.imu_accelerometer_g_units.cast<FilterScalar>());
+		measurement.set_gyroscope(packet.imu_gyroscope_rad_per_sec.cast<FilterScalar>());
+		measurement.set_magnetometer(packet.imu_magnetometer_unit.cast<FilterScalar>());
 		m_filter->bSeenOrientationMeasurement = true;
 
         // Update UKF
-        filter->ukf.update(measurement_model, measurement);
+		{
+			FilterProfile::ScopeTimer timer(FilterProfile::Filter_KalmanOrientation, FilterProfile::Stage_MeasurementUpdate);
+
+			filter->ukf.update(measurement_model, measurement);
+		}
 
 		// Apply the orientation error in the UKF state to the output quaternion.
 		// Zero out the error in the UKF state vector.
@@ -894,7 +1038,7 @@ void KalmanOrientationFilterPSMove::update(const float delta_time, const PoseFil
     }
     else
     {
-		m_filter->ukf.init(OrientationStateVectord::Identity());
+		m_filter->ukf.init(OrientationStateVectorX::Identity());
         m_filter->bIsValid= true;
     }
 }
@@ -911,18 +1055,18 @@ void KalmanOrientationFilterPSMove::update(const float delta_time, const PoseFil
 // In other words, G = [[.5dt ^ 2][dt]] ^ T for the constant angular velocity model.
 template <class StateType>
 void Q_discrete_2rd_order_white_noise(
-	const double dT, 
-	const double var, 
+	const FilterScalar dT, 
+	const FilterScalar var, 
 	const int state_index, 
 	Kalman::Covariance<StateType> &Q)
 {
-    const double dT_2 = dT*dT;
-	const double dT_3 = dT_2*dT;
-	const double dT_4 = dT_2*dT_2;
+    const FilterScalar dT_2 = dT*dT;
+	const FilterScalar dT_3 = dT_2*dT;
+	const FilterScalar dT_4 = dT_2*dT_2;
 
-    const double q4 = var * dT_4;
-    const double q3 = var * dT_3;
-    const double q2 = var * dT_2;
+    const FilterScalar q4 = var * dT_4;
+    const FilterScalar q3 = var * dT_3;
+    const FilterScalar q2 = var * dT_2;
 
     // Q = [.5dt^2, dt]*[.5dt^2, dt]^T * variance
     const int &i= state_index;
@@ -17,6 +17,8 @@ public:
 	bool getIsStateValid() const override;
 	void resetState() override;
 	void recenterOrientation(const Eigen::Quaternionf& q_pose) override;
+	bool getConvergedState(std::vector<double> &out_values) const override;
+	bool setConvergedState(const std::vector<double> &values) override;
 
 	// -- IOrientationFilter ---
 	Eigen::Quaternionf getOrientation(float time = 0.f) const override;
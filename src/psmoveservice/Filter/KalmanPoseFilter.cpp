@@ -103,24 +103,32 @@ enum DS4MeasurementEnum {
 #define k_ukf_beta 2.0
 #define k_ukf_kappa 3 - STATE_PARAMETER_COUNT
 
+// Innovation gate for the optical position measurement (chi-square 99.9%
+// bound for 3 DOF, matching the gate in KalmanPositionFilter.cpp). The pose
+// SRUKF's covariance correct step is still the commented-out work in
+// progress above, so until it lands the scalar pre-check against the
+// measurement variance is the whole gate here.
+#define k_optical_gate_chi_sqr 16.266
+#define k_optical_gate_max_consecutive_rejects 5
+
 //-- private methods ---
 void process_3rd_order_noise(
-	const double dT, const double var, const int state_index, 
-	Eigen::Matrix<double, NOISE_PARAMETER_COUNT, NOISE_PARAMETER_COUNT> &Q);
+	const FilterScalar dT, const FilterScalar var, const int state_index, 
+	Eigen::Matrix<FilterScalar, NOISE_PARAMETER_COUNT, NOISE_PARAMETER_COUNT> &Q);
 
 void process_2nd_order_noise(
-	const double dT, const double var, const int state_index, 
-	Eigen::Matrix<double, NOISE_PARAMETER_COUNT, NOISE_PARAMETER_COUNT> &Q);
+	const FilterScalar dT, const FilterScalar var, const int state_index, 
+	Eigen::Matrix<FilterScalar, NOISE_PARAMETER_COUNT, NOISE_PARAMETER_COUNT> &Q);
 
 //-- private definitions --
-class PoseNoiseVector : public Eigen::Matrix<double, NOISE_PARAMETER_COUNT, 1>
+class PoseNoiseVector : public Eigen::Matrix<FilterScalar, NOISE_PARAMETER_COUNT, 1>
 {
 public:
-	PoseNoiseVector(void) : Eigen::Matrix<double, NOISE_PARAMETER_COUNT, 1>()
+	PoseNoiseVector(void) : Eigen::Matrix<FilterScalar, NOISE_PARAMETER_COUNT, 1>()
 	{ }
 
 	template<typename OtherDerived>
-	PoseNoiseVector(const Eigen::MatrixBase<OtherDerived>& other) : Eigen::Matrix<double, NOISE_PARAMETER_COUNT, 1>(other)
+	PoseNoiseVector(const Eigen::MatrixBase<OtherDerived>& other) : Eigen::Matrix<FilterScalar, NOISE_PARAMETER_COUNT, 1>(other)
 	{ }
 
 	template<typename OtherDerived>
@@ -131,64 +139,64 @@ public:
 	}
 
 	// Accessors
-	Eigen::Vector3d get_position_noise() const {
-		return Eigen::Vector3d((*this)[NOISE_POSITION_X], (*this)[NOISE_POSITION_Y], (*this)[NOISE_POSITION_Z]);
+	FilterVector3 get_position_noise() const {
+		return FilterVector3((*this)[NOISE_POSITION_X], (*this)[NOISE_POSITION_Y], (*this)[NOISE_POSITION_Z]);
 	}
-	Eigen::Vector3d get_linear_velocity_noise() const {
-		return Eigen::Vector3d((*this)[NOISE_LINEAR_VELOCITY_X], (*this)[NOISE_LINEAR_VELOCITY_Y], (*this)[NOISE_LINEAR_VELOCITY_Z]);
+	FilterVector3 get_linear_velocity_noise() const {
+		return FilterVector3((*this)[NOISE_LINEAR_VELOCITY_X], (*this)[NOISE_LINEAR_VELOCITY_Y], (*this)[NOISE_LINEAR_VELOCITY_Z]);
 	}
-	Eigen::Vector3d get_linear_acceleration_noise() const {
-		return Eigen::Vector3d((*this)[NOISE_LINEAR_ACCELERATION_X], (*this)[NOISE_LINEAR_ACCELERATION_Y], (*this)[NOISE_LINEAR_ACCELERATION_Z]);
+	FilterVector3 get_linear_acceleration_noise() const {
+		return FilterVector3((*this)[NOISE_LINEAR_ACCELERATION_X], (*this)[NOISE_LINEAR_ACCELERATION_Y], (*this)[NOISE_LINEAR_ACCELERATION_Z]);
 	}
 	template <int RowsAtCompileTime>
-	static Eigen::AngleAxisd extract_angle_axis_noise(const Eigen::Matrix<double, RowsAtCompileTime, 1> &M) {
-		Eigen::Vector3d axis = Eigen::Vector3d(M[NOISE_ANGLE_AXIS_X], M[NOISE_ANGLE_AXIS_Y], M[NOISE_ANGLE_AXIS_Z]);
-		const double angle = eigen_vector3d_normalize_with_default(axis, Eigen::Vector3d::Zero());
-		return Eigen::AngleAxisd(angle, axis);
+	static FilterAngleAxis extract_angle_axis_noise(const Eigen::Matrix<FilterScalar, RowsAtCompileTime, 1> &M) {
+		FilterVector3 axis = FilterVector3(M[NOISE_ANGLE_AXIS_X], M[NOISE_ANGLE_AXIS_Y], M[NOISE_ANGLE_AXIS_Z]);
+		const FilterScalar angle = eigen_vector3_normalize_with_default(axis, FilterVector3::Zero());
+		return FilterAngleAxis(angle, axis);
 	}
-	Eigen::AngleAxisd get_angle_axis_noise() const {
+	FilterAngleAxis get_angle_axis_noise() const {
 		return extract_angle_axis_noise<NOISE_PARAMETER_COUNT>(*this);
 	}
 	template <int RowsAtCompileTime>
-	static Eigen::Quaterniond extract_quaternion_noise(const Eigen::Matrix<double, RowsAtCompileTime, 1> &M) {
-		return Eigen::Quaterniond(extract_angle_axis_noise<RowsAtCompileTime>(M));
+	static FilterQuaternion extract_quaternion_noise(const Eigen::Matrix<FilterScalar, RowsAtCompileTime, 1> &M) {
+		return FilterQuaternion(extract_angle_axis_noise<RowsAtCompileTime>(M));
 	}
-	Eigen::Quaterniond get_quaternion_noise() const {
+	FilterQuaternion get_quaternion_noise() const {
 		return extract_quaternion_noise<NOISE_PARAMETER_COUNT>(*this);
 	}
-	Eigen::Vector3d get_angular_velocity_noise() const {
-		return Eigen::Vector3d((*this)[NOISE_ANGULAR_VELOCITY_X], (*this)[NOISE_ANGULAR_VELOCITY_Y], (*this)[NOISE_ANGULAR_VELOCITY_Z]);
+	FilterVector3 get_angular_velocity_noise() const {
+		return FilterVector3((*this)[NOISE_ANGULAR_VELOCITY_X], (*this)[NOISE_ANGULAR_VELOCITY_Y], (*this)[NOISE_ANGULAR_VELOCITY_Z]);
 	}
 
 	// Mutators
-	void set_position_noise(const Eigen::Vector3d &p) {
+	void set_position_noise(const FilterVector3 &p) {
 		(*this)[NOISE_POSITION_X] = p.x(); (*this)[NOISE_POSITION_Y] = p.y(); (*this)[NOISE_POSITION_Z] = p.z();
 	}
-	void set_linear_velocity_noise(const Eigen::Vector3d &v) {
+	void set_linear_velocity_noise(const FilterVector3 &v) {
 		(*this)[NOISE_LINEAR_VELOCITY_X] = v.x(); (*this)[NOISE_LINEAR_VELOCITY_Y] = v.y(); (*this)[NOISE_LINEAR_VELOCITY_Z] = v.z();
 	}
-	void set_linear_acceleration_noise(const Eigen::Vector3d &a) {
+	void set_linear_acceleration_noise(const FilterVector3 &a) {
 		(*this)[NOISE_LINEAR_ACCELERATION_X] = a.x(); (*this)[NOISE_LINEAR_ACCELERATION_Y] = a.y(); (*this)[NOISE_LINEAR_ACCELERATION_Z] = a.z();
 	}
 	template <int RowsAtCompileTime>
-	static void apply_angle_axis_noise(const Eigen::AngleAxisd &a, Eigen::Matrix<double, RowsAtCompileTime, 1> &M) {
-		const double angle = a.angle();
+	static void apply_angle_axis_noise(const FilterAngleAxis &a, Eigen::Matrix<FilterScalar, RowsAtCompileTime, 1> &M) {
+		const FilterScalar angle = a.angle();
 		M[NOISE_ANGLE_AXIS_X] = a.axis().x() * angle;
 		M[NOISE_ANGLE_AXIS_Y] = a.axis().y() * angle;
 		M[NOISE_ANGLE_AXIS_Z] = a.axis().z() * angle;
 	}
-	void set_angle_axis_noise(const Eigen::AngleAxisd &a) {
+	void set_angle_axis_noise(const FilterAngleAxis &a) {
 		apply_angle_axis_noise<NOISE_PARAMETER_COUNT>(a, *this);
 	}
 	template <int RowsAtCompileTime>
-	static void apply_quaternion_noise(const Eigen::Quaterniond &q, Eigen::Matrix<double, RowsAtCompileTime, 1> &M) {
-		const Eigen::AngleAxisd angle_axis(q);
+	static void apply_quaternion_noise(const FilterQuaternion &q, Eigen::Matrix<FilterScalar, RowsAtCompileTime, 1> &M) {
+		const FilterAngleAxis angle_axis(q);
 		apply_angle_axis_noise<RowsAtCompileTime>(angle_axis, M);
 	}
-	void set_quaternion_noise(const Eigen::Quaterniond &q) {
+	void set_quaternion_noise(const FilterQuaternion &q) {
 		apply_quaternion_noise<NOISE_PARAMETER_COUNT>(q, *this);
 	}
-	void set_angular_velocity_noise(const Eigen::Vector3d &v) {
+	void set_angular_velocity_noise(const FilterVector3 &v) {
 		(*this)[NOISE_ANGULAR_VELOCITY_X] = v.x(); (*this)[NOISE_ANGULAR_VELOCITY_Y] = v.y(); (*this)[NOISE_ANGULAR_VELOCITY_Z] = v.z();
 	}
 
@@ -202,14 +210,14 @@ public:
 	}
 };
 
-class PoseStateVector : public Eigen::Matrix<double, STATE_PARAMETER_COUNT, 1>
+class PoseStateVector : public Eigen::Matrix<FilterScalar, STATE_PARAMETER_COUNT, 1>
 {
 public:
-	PoseStateVector(void) : Eigen::Matrix<double, STATE_PARAMETER_COUNT, 1>()
+	PoseStateVector(void) : Eigen::Matrix<FilterScalar, STATE_PARAMETER_COUNT, 1>()
 	{ }
 
 	template<typename OtherDerived>
-	PoseStateVector(const Eigen::MatrixBase<OtherDerived>& other) : Eigen::Matrix<double, STATE_PARAMETER_COUNT, 1>(other)
+	PoseStateVector(const Eigen::MatrixBase<OtherDerived>& other) : Eigen::Matrix<FilterScalar, STATE_PARAMETER_COUNT, 1>(other)
 	{ }
 
 	template<typename OtherDerived>
@@ -220,44 +228,44 @@ public:
 	}
 
     // Accessors
-    Eigen::Vector3d get_position_meters() const { 
-        return Eigen::Vector3d((*this)[POSITION_X], (*this)[POSITION_Y], (*this)[POSITION_Z]); 
+    FilterVector3 get_position_meters() const { 
+        return FilterVector3((*this)[POSITION_X], (*this)[POSITION_Y], (*this)[POSITION_Z]); 
     }
-    Eigen::Vector3d get_linear_velocity_m_per_sec() const {
-        return Eigen::Vector3d((*this)[LINEAR_VELOCITY_X], (*this)[LINEAR_VELOCITY_Y], (*this)[LINEAR_VELOCITY_Z]);
+    FilterVector3 get_linear_velocity_m_per_sec() const {
+        return FilterVector3((*this)[LINEAR_VELOCITY_X], (*this)[LINEAR_VELOCITY_Y], (*this)[LINEAR_VELOCITY_Z]);
     }
-    Eigen::Vector3d get_linear_acceleration_m_per_sec_sqr() const {
-        return Eigen::Vector3d((*this)[LINEAR_ACCELERATION_X], (*this)[LINEAR_ACCELERATION_Y], (*this)[LINEAR_ACCELERATION_Z]);
+    FilterVector3 get_linear_acceleration_m_per_sec_sqr() const {
+        return FilterVector3((*this)[LINEAR_ACCELERATION_X], (*this)[LINEAR_ACCELERATION_Y], (*this)[LINEAR_ACCELERATION_Z]);
     }
 	template <int RowsAtCompileTime>
-	static Eigen::Quaterniond extract_quaternion(const Eigen::Matrix<double, RowsAtCompileTime, 1> &M) {
-		return Eigen::Quaterniond(M[ORIENTATION_W], M[ORIENTATION_X], M[ORIENTATION_Y], M[ORIENTATION_Z]);
+	static FilterQuaternion extract_quaternion(const Eigen::Matrix<FilterScalar, RowsAtCompileTime, 1> &M) {
+		return FilterQuaternion(M[ORIENTATION_W], M[ORIENTATION_X], M[ORIENTATION_Y], M[ORIENTATION_Z]);
 	}
-    Eigen::Quaterniond get_quaternion() const {
+    FilterQuaternion get_quaternion() const {
         return extract_quaternion<STATE_PARAMETER_COUNT>(*this);
     }
-    Eigen::Vector3d get_angular_velocity_rad_per_sec() const {
-        return Eigen::Vector3d((*this)[ANGULAR_VELOCITY_X], (*this)[ANGULAR_VELOCITY_Y], (*this)[ANGULAR_VELOCITY_Z]);
+    FilterVector3 get_angular_velocity_rad_per_sec() const {
+        return FilterVector3((*this)[ANGULAR_VELOCITY_X], (*this)[ANGULAR_VELOCITY_Y], (*this)[ANGULAR_VELOCITY_Z]);
     }
 
     // Mutators
-    void set_position_meters(const Eigen::Vector3d &p) {
+    void set_position_meters(const FilterVector3 &p) {
         (*this)[POSITION_X] = p.x(); (*this)[POSITION_Y] = p.y(); (*this)[POSITION_Z] = p.z();
     }
-    void set_linear_velocity_m_per_sec(const Eigen::Vector3d &v) {
+    void set_linear_velocity_m_per_sec(const FilterVector3 &v) {
         (*this)[LINEAR_VELOCITY_X] = v.x(); (*this)[LINEAR_VELOCITY_Y] = v.y(); (*this)[LINEAR_VELOCITY_Z] = v.z();
     }
-    void set_linear_acceleration_m_per_sec_sqr(const Eigen::Vector3d &a) {
+    void set_linear_acceleration_m_per_sec_sqr(const FilterVector3 &a) {
         (*this)[LINEAR_ACCELERATION_X] = a.x(); (*this)[LINEAR_ACCELERATION_Y] = a.y(); (*this)[LINEAR_ACCELERATION_Z] = a.z();
     }
 	template <int RowsAtCompileTime>
-	static void apply_quaternion(const Eigen::Quaterniond &q, Eigen::Matrix<double, RowsAtCompileTime, 1> &M) {
+	static void apply_quaternion(const FilterQuaternion &q, Eigen::Matrix<FilterScalar, RowsAtCompileTime, 1> &M) {
 		M[ORIENTATION_W] = q.w(); M[ORIENTATION_X] = q.x(); M[ORIENTATION_Y] = q.y(); M[ORIENTATION_Z] = q.z();
 	}
-    void set_quaternion(const Eigen::Quaterniond &q) {
+    void set_quaternion(const FilterQuaternion &q) {
 		apply_quaternion<STATE_PARAMETER_COUNT>(q, *this);
     }
-    void set_angular_velocity_rad_per_sec(const Eigen::Vector3d &v) {
+    void set_angular_velocity_rad_per_sec(const FilterVector3 &v) {
         (*this)[ANGULAR_VELOCITY_X] = v.x(); (*this)[ANGULAR_VELOCITY_Y] = v.y(); (*this)[ANGULAR_VELOCITY_Z] = v.z();
     }
 
@@ -272,13 +280,13 @@ public:
 		result.tail<3>() = this->tail<3>() + other.head<3>();
 
 		// Extract the orientation quaternion from A (which is stored as an angle axis vector)
-		const Eigen::Quaterniond orientation = this->get_quaternion();
+		const FilterQuaternion orientation = this->get_quaternion();
 
 		// Extract the delta quaternion from B (which is also stored as an angle axis vector)
-		const Eigen::Quaterniond delta = other.get_quaternion();
+		const FilterQuaternion delta = other.get_quaternion();
 
 		// Apply the delta to the orientation
-		const Eigen::Quaterniond new_rotation = (orientation*delta).normalized();
+		const FilterQuaternion new_rotation = (orientation*delta).normalized();
 
 		// Save the net rotation rotation back in result
 		result.set_quaternion(new_rotation);
@@ -294,13 +302,13 @@ public:
 		result.head<9>() = this->head<9>() + other.head<9>();
 
 		// Extract the orientation quaternion from A (which is stored as an angle axis vector)
-		const Eigen::Quaterniond orientation = this->get_quaternion();
+		const FilterQuaternion orientation = this->get_quaternion();
 
 		// Extract the delta noise quaternion from B (which is also stored as an angle axis vector)
-		const Eigen::Quaterniond delta = other.get_quaternion_noise();
+		const FilterQuaternion delta = other.get_quaternion_noise();
 
 		// Apply the noise delta to the orientation
-		const Eigen::Quaterniond new_rotation = (orientation*delta).normalized();
+		const FilterQuaternion new_rotation = (orientation*delta).normalized();
 
 		// Save the net rotation rotation back in result
 		result.set_quaternion(new_rotation);
@@ -321,11 +329,11 @@ public:
 		result.tail<3>() = this->tail<3>() - other.head<3>();
 
 		// Extract the orientation quaternion from both states (which is stored as an angle axis vector)
-		const Eigen::Quaterniond q1= this->get_quaternion();
-		const Eigen::Quaterniond q2= other.get_quaternion();
+		const FilterQuaternion q1= this->get_quaternion();
+		const FilterQuaternion q2= other.get_quaternion();
 
 		// Compute the "quaternion difference" i.e. rotation from q1 to q2
-		const Eigen::Quaterniond q_diff= (q1*q2.conjugate()).normalized();
+		const FilterQuaternion q_diff= (q1*q2.conjugate()).normalized();
 
 		result.set_quaternion(q_diff);
 
@@ -340,11 +348,11 @@ public:
 		result.head<9>() = this->head<9>() - other.head<9>();
 
 		// Extract the orientation quaternion from both states (which is stored as an angle axis vector)
-		const Eigen::Quaterniond q1 = this->get_quaternion();
-		const Eigen::Quaterniond q2 = other.get_quaternion_noise();
+		const FilterQuaternion q1 = this->get_quaternion();
+		const FilterQuaternion q2 = other.get_quaternion_noise();
 
 		// Compute the "quaternion difference" i.e. rotation from q1 to q2
-		const Eigen::Quaterniond q_diff = (q1*q2.conjugate()).normalized();
+		const FilterQuaternion q_diff = (q1*q2.conjugate()).normalized();
 
 		result.set_quaternion(q_diff);
 
@@ -357,25 +365,25 @@ public:
 
 	template <int PointCount>
 	static void special_state_mean(
-		const Eigen::Matrix<double, STATE_PARAMETER_COUNT, PointCount>& state_matrix,
-		const Eigen::Matrix<double, PointCount, 1> weight_vector,
+		const Eigen::Matrix<FilterScalar, STATE_PARAMETER_COUNT, PointCount>& state_matrix,
+		const Eigen::Matrix<FilterScalar, PointCount, 1> weight_vector,
 		PoseStateVector &result)
 	{
-		Eigen::Quaterniond quat_0_inv = extract_quaternion<RowsAtCompileTime>(state_matrix.col(0)).conjugate();
+		FilterQuaternion quat_0_inv = extract_quaternion<RowsAtCompileTime>(state_matrix.col(0)).conjugate();
 
 		// Extract the orientations from the states
-		Eigen::Quaterniond orientations[PointCount];
-		double weights[PointCount];
+		FilterQuaternion orientations[PointCount];
+		FilterScalar weights[PointCount];
 		for (int col_index = 0; col_index < PointCount; ++col_index)
 		{
-			Eigen::Quaterniond orientation = extract_quaternion<RowsAtCompileTime>(state_matrix.col(col_index));
+			FilterQuaternion orientation = extract_quaternion<RowsAtCompileTime>(state_matrix.col(col_index));
 
 			orientations[col_index]= orientation;
 			weights[col_index]= weight_vector[col_index];
 		}
 
 		// Compute the average of the quaternions
-		Eigen::Quaterniond average_quat;
+		FilterQuaternion average_quat;
 		eigen_quaternion_compute_weighted_average(orientations, weights, PointCount, &average_quat);
 
 		// Stomp the incorrect orientation average
@@ -391,7 +399,7 @@ PoseNoiseVector convert_state_to_noise_vector(const PoseStateVector &state_vecto
 	result.head<9>() = state_vector.head<9>();
 
 	// Convert the quaternion in the state vector to an angle-axis vector
-	result.set_angle_axis_noise(Eigen::AngleAxisd(state_vector.get_quaternion()));
+	result.set_angle_axis_noise(FilterAngleAxis(state_vector.get_quaternion()));
 
 	// Copy over the angular velocity vector
 	result.set_angular_velocity_noise(state_vector.get_angular_velocity_rad_per_sec());
@@ -407,7 +415,7 @@ PoseStateVector convert_noise_to_state_vector(const PoseNoiseVector &noise_vecto
 	result.head<9>() = noise_vector.head<9>();
 
 	// Copy the angle-axis vector
-	result.set_quaternion(Eigen::Quaterniond(noise_vector.get_angle_axis_noise()));
+	result.set_quaternion(FilterQuaternion(noise_vector.get_angle_axis_noise()));
 
 	// Copy over the angular velocity vector
 	result.set_angular_velocity_rad_per_sec(noise_vector.get_angular_velocity_noise());
@@ -415,14 +423,14 @@ PoseStateVector convert_noise_to_state_vector(const PoseNoiseVector &noise_vecto
 	return result;
 }
 
-class PSMove_MeasurementVector : public Eigen::Matrix<double, PSMOVE_MEASUREMENT_PARAMETER_COUNT, 1>
+class PSMove_MeasurementVector : public Eigen::Matrix<FilterScalar, PSMOVE_MEASUREMENT_PARAMETER_COUNT, 1>
 {
 public:
-	PSMove_MeasurementVector(void) : Eigen::Matrix<double, PSMOVE_MEASUREMENT_PARAMETER_COUNT, 1>()
+	PSMove_MeasurementVector(void) : Eigen::Matrix<FilterScalar, PSMOVE_MEASUREMENT_PARAMETER_COUNT, 1>()
 	{ }
 
 	template<typename OtherDerived>
-	PSMove_MeasurementVector(const Eigen::MatrixBase<OtherDerived>& other) : Eigen::Matrix<double, PSMOVE_MEASUREMENT_PARAMETER_COUNT, 1>(other)
+	PSMove_MeasurementVector(const Eigen::MatrixBase<OtherDerived>& other) : Eigen::Matrix<FilterScalar, PSMOVE_MEASUREMENT_PARAMETER_COUNT, 1>(other)
 	{ }
 
 	template<typename OtherDerived>
@@ -433,30 +441,30 @@ public:
 	}
 
     // Accessors
-    Eigen::Vector3d get_accelerometer() const {
-        return Eigen::Vector3d((*this)[PSMOVE_ACCELEROMETER_X], (*this)[PSMOVE_ACCELEROMETER_Y], (*this)[PSMOVE_ACCELEROMETER_Z]);
+    FilterVector3 get_accelerometer() const {
+        return FilterVector3((*this)[PSMOVE_ACCELEROMETER_X], (*this)[PSMOVE_ACCELEROMETER_Y], (*this)[PSMOVE_ACCELEROMETER_Z]);
     }
-    Eigen::Vector3d get_gyroscope() const {
-        return Eigen::Vector3d((*this)[PSMOVE_GYROSCOPE_X], (*this)[PSMOVE_GYROSCOPE_Y], (*this)[PSMOVE_GYROSCOPE_Z]);
+    FilterVector3 get_gyroscope() const {
+        return FilterVector3((*this)[PSMOVE_GYROSCOPE_X], (*this)[PSMOVE_GYROSCOPE_Y], (*this)[PSMOVE_GYROSCOPE_Z]);
     }
-    Eigen::Vector3d get_magnetometer() const {
-        return Eigen::Vector3d((*this)[PSMOVE_MAGNETOMETER_X], (*this)[PSMOVE_MAGNETOMETER_Y], (*this)[PSMOVE_MAGNETOMETER_Z]);
+    FilterVector3 get_magnetometer() const {
+        return FilterVector3((*this)[PSMOVE_MAGNETOMETER_X], (*this)[PSMOVE_MAGNETOMETER_Y], (*this)[PSMOVE_MAGNETOMETER_Z]);
     }
-    Eigen::Vector3d get_optical_position() const {
-        return Eigen::Vector3d((*this)[PSMOVE_OPTICAL_POSITION_X], (*this)[PSMOVE_OPTICAL_POSITION_Y], (*this)[PSMOVE_OPTICAL_POSITION_Z]);
+    FilterVector3 get_optical_position() const {
+        return FilterVector3((*this)[PSMOVE_OPTICAL_POSITION_X], (*this)[PSMOVE_OPTICAL_POSITION_Y], (*this)[PSMOVE_OPTICAL_POSITION_Z]);
     }
 
     // Mutators
-    void set_accelerometer(const Eigen::Vector3d &a) {
+    void set_accelerometer(const FilterVector3 &a) {
         (*this)[PSMOVE_ACCELEROMETER_X] = a.x(); (*this)[PSMOVE_ACCELEROMETER_Y] = a.y(); (*this)[PSMOVE_ACCELEROMETER_Z] = a.z();
     }
-    void set_gyroscope(const Eigen::Vector3d &g) {
+    void set_gyroscope(const FilterVector3 &g) {
         (*this)[PSMOVE_GYROSCOPE_X] = g.x(); (*this)[PSMOVE_GYROSCOPE_Y] = g.y(); (*this)[PSMOVE_GYROSCOPE_Z] = g.z();
     }
-    void set_optical_position(const Eigen::Vector3d &p) {
+    void set_optical_position(const FilterVector3 &p) {
         (*this)[PSMOVE_OPTICAL_POSITION_X] = p.x(); (*this)[PSMOVE_OPTICAL_POSITION_Y] = p.y(); (*this)[PSMOVE_OPTICAL_POSITION_Z] = p.z();
     }
-    void set_magnetometer(const Eigen::Vector3d &m) {
+    void set_magnetometer(const FilterVector3 &m) {
         (*this)[PSMOVE_MAGNETOMETER_X] = m.x(); (*this)[PSMOVE_MAGNETOMETER_Y] = m.y(); (*this)[PSMOVE_MAGNETOMETER_Z] = m.z();
     }
 
@@ -469,8 +477,8 @@ public:
 
 	template <int SIGMA_POINT_COUNT>
 	static PSMove_MeasurementVector computeWeightedMeasurementAverage(
-		const Eigen::Matrix<double, PSMOVE_MEASUREMENT_PARAMETER_COUNT, SIGMA_POINT_COUNT>& measurement_matrix,
-		const Eigen::Matrix<double, SIGMA_POINT_COUNT, 1> &weight_vector)
+		const Eigen::Matrix<FilterScalar, PSMOVE_MEASUREMENT_PARAMETER_COUNT, SIGMA_POINT_COUNT>& measurement_matrix,
+		const Eigen::Matrix<FilterScalar, SIGMA_POINT_COUNT, 1> &weight_vector)
 	{
 		// Use efficient matrix x vector computation to compute a weighted average of the sigma point samples
 		// (No orientation stored in measurement means this can be simple)
@@ -480,14 +488,14 @@ public:
 	}
 };
 
-class DS4_MeasurementVector : public Eigen::Matrix<double, DS4_MEASUREMENT_PARAMETER_COUNT, 1>
+class DS4_MeasurementVector : public Eigen::Matrix<FilterScalar, DS4_MEASUREMENT_PARAMETER_COUNT, 1>
 {
 public:
-	DS4_MeasurementVector(void) : Eigen::Matrix<double, DS4_MEASUREMENT_PARAMETER_COUNT, 1>()
+	DS4_MeasurementVector(void) : Eigen::Matrix<FilterScalar, DS4_MEASUREMENT_PARAMETER_COUNT, 1>()
 	{ }
 
 	template<typename OtherDerived>
-	DS4_MeasurementVector(const Eigen::MatrixBase<OtherDerived>& other) : Eigen::Matrix<double, DS4_MEASUREMENT_PARAMETER_COUNT, 1>(other)
+	DS4_MeasurementVector(const Eigen::MatrixBase<OtherDerived>& other) : Eigen::Matrix<FilterScalar, DS4_MEASUREMENT_PARAMETER_COUNT, 1>(other)
 	{ }
 
 	template<typename OtherDerived>
@@ -498,42 +506,42 @@ public:
 	}
 
     // Accessors
-    Eigen::Vector3d get_accelerometer() const {
-        return Eigen::Vector3d((*this)[DS4_ACCELEROMETER_X], (*this)[DS4_ACCELEROMETER_Y], (*this)[DS4_ACCELEROMETER_Z]);
+    FilterVector3 get_accelerometer() const {
+        return FilterVector3((*this)[DS4_ACCELEROMETER_X], (*this)[DS4_ACCELEROMETER_Y], (*this)[DS4_ACCELEROMETER_Z]);
     }
-    Eigen::Vector3d get_gyroscope() const {
-        return Eigen::Vector3d((*this)[DS4_GYROSCOPE_X], (*this)[DS4_GYROSCOPE_Y], (*this)[DS4_GYROSCOPE_Z]);
+    FilterVector3 get_gyroscope() const {
+        return FilterVector3((*this)[DS4_GYROSCOPE_X], (*this)[DS4_GYROSCOPE_Y], (*this)[DS4_GYROSCOPE_Z]);
     }
-    Eigen::Vector3d get_optical_position() const {
-        return Eigen::Vector3d((*this)[DS4_OPTICAL_POSITION_X], (*this)[DS4_OPTICAL_POSITION_Y], (*this)[DS4_OPTICAL_POSITION_Z]);
+    FilterVector3 get_optical_position() const {
+        return FilterVector3((*this)[DS4_OPTICAL_POSITION_X], (*this)[DS4_OPTICAL_POSITION_Y], (*this)[DS4_OPTICAL_POSITION_Z]);
     }
-    Eigen::AngleAxisd get_optical_angle_axis() const {
-        Eigen::Vector3d axis= Eigen::Vector3d((*this)[DS4_OPTICAL_ANGLE_AXIS_X], (*this)[DS4_OPTICAL_ANGLE_AXIS_Y], (*this)[DS4_OPTICAL_ANGLE_AXIS_Z]);
-        const double angle= eigen_vector3d_normalize_with_default(axis, Eigen::Vector3d::Zero());
-        return Eigen::AngleAxisd(angle, axis);
+    FilterAngleAxis get_optical_angle_axis() const {
+        FilterVector3 axis= FilterVector3((*this)[DS4_OPTICAL_ANGLE_AXIS_X], (*this)[DS4_OPTICAL_ANGLE_AXIS_Y], (*this)[DS4_OPTICAL_ANGLE_AXIS_Z]);
+        const FilterScalar angle= eigen_vector3_normalize_with_default(axis, FilterVector3::Zero());
+        return FilterAngleAxis(angle, axis);
     }
-    Eigen::Quaterniond get_optical_quaternion() const {
-        return Eigen::Quaterniond(get_optical_angle_axis());
+    FilterQuaternion get_optical_quaternion() const {
+        return FilterQuaternion(get_optical_angle_axis());
     }
 
     // Mutators
-    void set_accelerometer(const Eigen::Vector3d &a) {
+    void set_accelerometer(const FilterVector3 &a) {
         (*this)[DS4_ACCELEROMETER_X] = a.x(); (*this)[DS4_ACCELEROMETER_Y] = a.y(); (*this)[DS4_ACCELEROMETER_Z] = a.z();
     }
-    void set_gyroscope(const Eigen::Vector3d &g) {
+    void set_gyroscope(const FilterVector3 &g) {
         (*this)[DS4_GYROSCOPE_X] = g.x(); (*this)[DS4_GYROSCOPE_Y] = g.y(); (*this)[DS4_GYROSCOPE_Z] = g.z();
     }
-    void set_optical_position(const Eigen::Vector3d &p) {
+    void set_optical_position(const FilterVector3 &p) {
         (*this)[DS4_OPTICAL_POSITION_X] = p.x(); (*this)[DS4_OPTICAL_POSITION_Y] = p.y(); (*this)[DS4_OPTICAL_POSITION_Z] = p.z();
     }
-    void set_angle_axis(const Eigen::AngleAxisd &a) {        
-        const double angle= a.angle();
+    void set_angle_axis(const FilterAngleAxis &a) {        
+        const FilterScalar angle= a.angle();
         (*this)[DS4_OPTICAL_ANGLE_AXIS_X] = a.axis().x() * angle; 
         (*this)[DS4_OPTICAL_ANGLE_AXIS_Y] = a.axis().y() * angle;
         (*this)[DS4_OPTICAL_ANGLE_AXIS_Z] = a.axis().z() * angle;
     }
-    void set_optical_quaternion(const Eigen::Quaterniond &q) {
-        const Eigen::AngleAxisd angle_axis(q);
+    void set_optical_quaternion(const FilterQuaternion &q) {
+        const FilterAngleAxis angle_axis(q);
         set_angle_axis(angle_axis);
     }
 
@@ -543,9 +551,9 @@ public:
 
 		measurement_diff.head<9>() = this->head<9>() - other.head<9>();
 		
-		const Eigen::Quaterniond q1= this->get_optical_quaternion();
-		const Eigen::Quaterniond q2= other.get_optical_quaternion();
-		const Eigen::Quaterniond q_diff= q2*q1.conjugate();
+		const FilterQuaternion q1= this->get_optical_quaternion();
+		const FilterQuaternion q2= other.get_optical_quaternion();
+		const FilterQuaternion q_diff= q2*q1.conjugate();
 
 		// Stomp the incorrect orientation difference computed by the vector subtraction
 		measurement_diff.set_optical_quaternion(q_diff);
@@ -563,27 +571,27 @@ public:
 
 	template <int SIGMA_POINT_COUNT>
 	static DS4_MeasurementVector computeWeightedMeasurementAverage(
-		const Eigen::Matrix<double, DS4_MEASUREMENT_PARAMETER_COUNT, SIGMA_POINT_COUNT>& measurement_matrix,
-		Eigen::Matrix<double, SIGMA_POINT_COUNT, 1> weight_vector)
+		const Eigen::Matrix<FilterScalar, DS4_MEASUREMENT_PARAMETER_COUNT, SIGMA_POINT_COUNT>& measurement_matrix,
+		Eigen::Matrix<FilterScalar, SIGMA_POINT_COUNT, 1> weight_vector)
 	{
 		// Use efficient matrix x vector computation to compute a weighted average of the measurements
 		// (the orientation portion will be wrong)
 		DS4_MeasurementVector result= measurement_matrix * weight_vector;
 
 		// Extract the orientations from the measurements
-		Eigen::Quaterniond orientations[SIGMA_POINT_COUNT];
-		double weights[SIGMA_POINT_COUNT];
+		FilterQuaternion orientations[SIGMA_POINT_COUNT];
+		FilterScalar weights[SIGMA_POINT_COUNT];
 		for (int col_index = 0; col_index < SIGMA_POINT_COUNT; ++col_index)
 		{
 			const DS4_MeasurementVector measurement = measurement_matrix.col(col_index);
-			Eigen::Quaterniond orientation = measurement.get_optical_quaternion();
+			FilterQuaternion orientation = measurement.get_optical_quaternion();
 
 			orientations[col_index]= orientation;
 			weights[col_index]= weight_vector[col_index];
 		}
 
 		// Compute the average of the quaternions
-		Eigen::Quaterniond average_quat;
+		FilterQuaternion average_quat;
 		eigen_quaternion_compute_weighted_average(orientations, weights, SIGMA_POINT_COUNT, &average_quat);
 
 		// Stomp the incorrect orientation average
@@ -606,8 +614,8 @@ public:
     {
 		update_measurement_statistics(constants, 0.f);
         
-		identity_gravity_direction= constants.orientation_constants.gravity_calibration_direction.cast<double>();
-		identity_magnetometer_direction= constants.orientation_constants.magnetometer_calibration_direction.cast<double>();
+		identity_gravity_direction= constants.orientation_constants.gravity_calibration_direction.cast<FilterScalar>();
+		identity_magnetometer_direction= constants.orientation_constants.magnetometer_calibration_direction.cast<FilterScalar>();
     }
 
 	void update_measurement_statistics(
@@ -615,7 +623,7 @@ public:
 		const float tracking_projection_area_px_sqr)
 	{
         // Start off using the maximum standard deviation values
-		const double position_variance_cm_sqr = static_cast<double>(constants.position_constants.position_variance_curve.evaluate(tracking_projection_area_px_sqr));
+		const FilterScalar position_variance_cm_sqr = static_cast<FilterScalar>(constants.position_constants.position_variance_curve.evaluateLUT(tracking_projection_area_px_sqr));
 		// variance_meters = variance_cm * (0.01)^2 because ...
 		// var(k*x) = sum(k*x_i - k*mu)^2/(N-1) = k^2*sum(x_i - mu)^2/(N-1)
 		// where k = k_centimeters_to_meters = 0.01
@@ -637,7 +645,7 @@ public:
 
 
         // Update the measurement covariance R
-        R_cov = Eigen::Matrix<double, PSMOVE_MEASUREMENT_PARAMETER_COUNT, PSMOVE_MEASUREMENT_PARAMETER_COUNT>::Zero();
+        R_cov = Eigen::Matrix<FilterScalar, PSMOVE_MEASUREMENT_PARAMETER_COUNT, PSMOVE_MEASUREMENT_PARAMETER_COUNT>::Zero();
 
 		// Only diagonals used so no need to compute Cholesky
 		R_cov(PSMOVE_ACCELEROMETER_X, PSMOVE_ACCELEROMETER_X) = sqrt(R_SCALE*constants.position_constants.accelerometer_variance.x());
@@ -670,39 +678,39 @@ public:
 
 		// Extract the observation bias
 		const PSMove_MeasurementVector &observation_bias = R_mu;
-		const Eigen::Vector3d accel_bias = observation_bias.get_accelerometer();
-		const Eigen::Vector3d mag_bias = observation_bias.get_magnetometer();
-		const Eigen::Vector3d gyro_bias = observation_bias.get_gyroscope();
-		const Eigen::Vector3d position_bias = observation_bias.get_optical_position();
+		const FilterVector3 accel_bias = observation_bias.get_accelerometer();
+		const FilterVector3 mag_bias = observation_bias.get_magnetometer();
+		const FilterVector3 gyro_bias = observation_bias.get_gyroscope();
+		const FilterVector3 position_bias = observation_bias.get_optical_position();
 
 		// Extract the observation noise
-		const Eigen::Vector3d accel_noise = observation_noise.get_accelerometer();
-		const Eigen::Vector3d mag_noise = observation_noise.get_magnetometer();
-		const Eigen::Vector3d gyro_noise = observation_noise.get_gyroscope();
-		const Eigen::Vector3d position_noise = observation_noise.get_optical_position();
+		const FilterVector3 accel_noise = observation_noise.get_accelerometer();
+		const FilterVector3 mag_noise = observation_noise.get_magnetometer();
+		const FilterVector3 gyro_noise = observation_noise.get_gyroscope();
+		const FilterVector3 position_noise = observation_noise.get_optical_position();
 
         // Use the position and orientation from the state for predictions
-        const Eigen::Vector3d position= state.get_position_meters();
-        const Eigen::Quaterniond orientation= state.get_quaternion();
+        const FilterVector3 position= state.get_position_meters();
+        const FilterQuaternion orientation= state.get_quaternion();
 
         // Use the current linear acceleration from the state to predict
         // what the accelerometer reading will be (in world space)
-        const Eigen::Vector3d gravity_accel_g_units= identity_gravity_direction;
-        const Eigen::Vector3d linear_accel_g_units= state.get_linear_acceleration_m_per_sec_sqr() * k_ms2_to_g_units;
-        const Eigen::Vector3d accel_world= linear_accel_g_units + gravity_accel_g_units;
+        const FilterVector3 gravity_accel_g_units= identity_gravity_direction;
+        const FilterVector3 linear_accel_g_units= state.get_linear_acceleration_m_per_sec_sqr() * k_ms2_to_g_units;
+        const FilterVector3 accel_world= linear_accel_g_units + gravity_accel_g_units;
 
         // Put the accelerometer prediction into the local space of the controller
-		const Eigen::Quaterniond accel_world_quat(0.f, accel_world.x(), accel_world.y(), accel_world.z());
-		const Eigen::Vector3d accel_local = orientation*(accel_world_quat*orientation.conjugate()).vec();
+		const FilterQuaternion accel_world_quat(0.f, accel_world.x(), accel_world.y(), accel_world.z());
+		const FilterVector3 accel_local = orientation*(accel_world_quat*orientation.conjugate()).vec();
 
         // Use the angular velocity from the state to predict what the gyro reading will be
-        const Eigen::Vector3d gyro_local= state.get_angular_velocity_rad_per_sec(); 
+        const FilterVector3 gyro_local= state.get_angular_velocity_rad_per_sec(); 
 
         // Use the orientation from the state to predict
         // what the magnetometer reading should be
-        const Eigen::Vector3d &mag_world= identity_magnetometer_direction;
-		const Eigen::Quaterniond mag_world_quat(0.f, mag_world.x(), mag_world.y(), mag_world.z());
-        const Eigen::Vector3d mag_local= orientation*(mag_world_quat*orientation.conjugate()).vec();
+        const FilterVector3 &mag_world= identity_magnetometer_direction;
+		const FilterQuaternion mag_world_quat(0.f, mag_world.x(), mag_world.y(), mag_world.z());
+        const FilterVector3 mag_local= orientation*(mag_world_quat*orientation.conjugate()).vec();
 
         // Save the predictions into the measurement vector
         predicted_measurement.set_accelerometer(accel_local + accel_bias + accel_noise);
@@ -714,14 +722,14 @@ public:
     }
 
 public:
-    Eigen::Vector3d identity_gravity_direction;
-    Eigen::Vector3d identity_magnetometer_direction;
+    FilterVector3 identity_gravity_direction;
+    FilterVector3 identity_magnetometer_direction;
 
 	//! Measurement noise mean
-	Eigen::Matrix<double, PSMOVE_MEASUREMENT_PARAMETER_COUNT, 1> R_mu;
+	Eigen::Matrix<FilterScalar, PSMOVE_MEASUREMENT_PARAMETER_COUNT, 1> R_mu;
 
 	//! Measurement noise covariance
-	Eigen::Matrix<double, PSMOVE_MEASUREMENT_PARAMETER_COUNT, PSMOVE_MEASUREMENT_PARAMETER_COUNT> R_cov;
+	Eigen::Matrix<FilterScalar, PSMOVE_MEASUREMENT_PARAMETER_COUNT, PSMOVE_MEASUREMENT_PARAMETER_COUNT> R_cov;
 };
 
 /**
@@ -737,25 +745,25 @@ public:
     {
 		update_measurement_statistics(constants, 0.f);
 
-		identity_gravity_direction= constants.orientation_constants.gravity_calibration_direction.cast<double>();
+		identity_gravity_direction= constants.orientation_constants.gravity_calibration_direction.cast<FilterScalar>();
     }
 
 	void update_measurement_statistics(
 		const PoseFilterConstants &constants,
 		const float tracking_projection_area_px_sqr)
 	{
-		const double position_variance_cm_sqr = static_cast<double>(constants.position_constants.position_variance_curve.evaluate(tracking_projection_area_px_sqr));
+		const FilterScalar position_variance_cm_sqr = static_cast<FilterScalar>(constants.position_constants.position_variance_curve.evaluateLUT(tracking_projection_area_px_sqr));
 		// variance_meters = variance_cm * (0.01)^2 because ...
 		// var(k*x) = sum(k*x_i - k*mu)^2/(N-1) = k^2*sum(x_i - mu)^2/(N-1)
 		// where k = k_centimeters_to_meters = 0.01
 		const float position_variance_m_sqr = k_centimeters_to_meters*k_centimeters_to_meters*position_variance_cm_sqr;
 		const float orientation_variance =
-			constants.orientation_constants.orientation_variance_curve.evaluate(tracking_projection_area_px_sqr);
+			constants.orientation_constants.orientation_variance_curve.evaluateLUT(tracking_projection_area_px_sqr);
 
 		const float position_drift = 0.f;
 
-		const double angle_axis_std_dev= sqrt(R_SCALE*orientation_variance);
-		const double angle_axis_drift = 0.f;
+		const FilterScalar angle_axis_std_dev= sqrt(R_SCALE*orientation_variance);
+		const FilterScalar angle_axis_drift = 0.f;
 
 		// Update the biases
 		R_mu(DS4_ACCELEROMETER_X) = constants.position_constants.accelerometer_drift.x();
@@ -772,7 +780,7 @@ public:
 		R_mu(DS4_OPTICAL_ANGLE_AXIS_Z) = angle_axis_drift;
 
         // Update the measurement covariance R
-        R_cov = Eigen::Matrix<double, DS4_MEASUREMENT_PARAMETER_COUNT, DS4_MEASUREMENT_PARAMETER_COUNT>::Zero();
+        R_cov = Eigen::Matrix<FilterScalar, DS4_MEASUREMENT_PARAMETER_COUNT, DS4_MEASUREMENT_PARAMETER_COUNT>::Zero();
 		R_cov(DS4_ACCELEROMETER_X, DS4_ACCELEROMETER_X) = sqrt(R_SCALE*constants.position_constants.accelerometer_variance.x());
 		R_cov(DS4_ACCELEROMETER_Y, DS4_ACCELEROMETER_Y) = sqrt(R_SCALE*constants.position_constants.accelerometer_variance.y());
 		R_cov(DS4_ACCELEROMETER_Z, DS4_ACCELEROMETER_Z) = sqrt(R_SCALE*constants.position_constants.accelerometer_variance.z());
@@ -803,32 +811,32 @@ public:
 
 		// Extract the observation bias
 		const DS4_MeasurementVector &observation_bias = R_mu;
-		const Eigen::Vector3d accel_bias = observation_bias.get_accelerometer();
-		const Eigen::Vector3d gyro_bias = observation_bias.get_gyroscope();
-		const Eigen::Vector3d position_bias = observation_bias.get_optical_position();
-		const Eigen::Quaterniond orientation_bias = observation_bias.get_optical_quaternion();
+		const FilterVector3 accel_bias = observation_bias.get_accelerometer();
+		const FilterVector3 gyro_bias = observation_bias.get_gyroscope();
+		const FilterVector3 position_bias = observation_bias.get_optical_position();
+		const FilterQuaternion orientation_bias = observation_bias.get_optical_quaternion();
 
 		// Extract the observations noise
-		const Eigen::Vector3d accel_noise= observation_noise.get_accelerometer();
-		const Eigen::Vector3d gyro_noise= observation_noise.get_gyroscope();
-		const Eigen::Vector3d position_noise= observation_noise.get_optical_position();
-		const Eigen::Quaterniond orientation_noise= observation_noise.get_optical_quaternion();
+		const FilterVector3 accel_noise= observation_noise.get_accelerometer();
+		const FilterVector3 gyro_noise= observation_noise.get_gyroscope();
+		const FilterVector3 position_noise= observation_noise.get_optical_position();
+		const FilterQuaternion orientation_noise= observation_noise.get_optical_quaternion();
 
         // Use the position and orientation from the state for predictions
-        const Eigen::Vector3d position= state.get_position_meters();
-        const Eigen::Quaterniond orientation= state.get_quaternion();
+        const FilterVector3 position= state.get_position_meters();
+        const FilterQuaternion orientation= state.get_quaternion();
 
 		// Accelerometer = (linear acceleration + gravity) transformed to controller frame.
-        const Eigen::Vector3d gravity_accel_g_units= -identity_gravity_direction;
-        const Eigen::Vector3d linear_accel_g_units= state.get_linear_acceleration_m_per_sec_sqr() * k_ms2_to_g_units;
-        const Eigen::Vector3d accel_world= linear_accel_g_units + gravity_accel_g_units;
-        const Eigen::Quaterniond accel_world_quat(0.f, accel_world.x(), accel_world.y(), accel_world.z());
+        const FilterVector3 gravity_accel_g_units= -identity_gravity_direction;
+        const FilterVector3 linear_accel_g_units= state.get_linear_acceleration_m_per_sec_sqr() * k_ms2_to_g_units;
+        const FilterVector3 accel_world= linear_accel_g_units + gravity_accel_g_units;
+        const FilterQuaternion accel_world_quat(0.f, accel_world.x(), accel_world.y(), accel_world.z());
 
         // Put the accelerometer prediction into the local space of the controller
-        const Eigen::Vector3d accel_local= orientation*(accel_world_quat*orientation.conjugate()).vec();
+        const FilterVector3 accel_local= orientation*(accel_world_quat*orientation.conjugate()).vec();
 
         // Gyroscope = angular velocity (both rad/sec)
-        const Eigen::Vector3d gyro_local= state.get_angular_velocity_rad_per_sec(); 
+        const FilterVector3 gyro_local= state.get_angular_velocity_rad_per_sec(); 
 
         // Save the predictions into the measurement vector
         predicted_measurement.set_accelerometer(accel_local + accel_bias + accel_noise);
@@ -841,13 +849,13 @@ public:
     }
 
 public:
-    Eigen::Vector3d identity_gravity_direction;
+    FilterVector3 identity_gravity_direction;
 
 	//! Measurement noise mean
-	Eigen::Matrix<double, DS4_MEASUREMENT_PARAMETER_COUNT, 1> R_mu;
+	Eigen::Matrix<FilterScalar, DS4_MEASUREMENT_PARAMETER_COUNT, 1> R_mu;
 
 	//! Measurement noise covariance
-	Eigen::Matrix<double, DS4_MEASUREMENT_PARAMETER_COUNT, DS4_MEASUREMENT_PARAMETER_COUNT> R_cov;
+	Eigen::Matrix<FilterScalar, DS4_MEASUREMENT_PARAMETER_COUNT, DS4_MEASUREMENT_PARAMETER_COUNT> R_cov;
 };
 
 template <int S_DIM, int Q_DIM, int R_DIM>
@@ -857,22 +865,22 @@ public:
 	static const int L_DIM = 1 + 2*S_DIM + 2*Q_DIM + 2*R_DIM;
 
 	/// Scaling factor for the sigma points
-	double zeta;
+	FilterScalar zeta;
 
 	/// Sigma weights (m)
-	Eigen::Matrix<double, L_DIM, 1> wm;
+	Eigen::Matrix<FilterScalar, L_DIM, 1> wm;
 
 	/// Sigma weights (c)
-	Eigen::Matrix<double, L_DIM, 1> wc;
+	Eigen::Matrix<FilterScalar, L_DIM, 1> wc;
 
-	double w_qr;
-	double w_cholup;
+	FilterScalar w_qr;
+	FilterScalar w_cholup;
 
 	SigmaPointWeights()
 	{
 		zeta = 0.0;
-		wm = Eigen::Matrix<double, L_DIM, 1>::Zero();
-		wc = Eigen::Matrix<double, L_DIM, 1>::Zero();
+		wm = Eigen::Matrix<FilterScalar, L_DIM, 1>::Zero();
+		wc = Eigen::Matrix<FilterScalar, L_DIM, 1>::Zero();
 		w_qr = 0.0;
 		w_cholup = 0.0;
 	}
@@ -882,16 +890,16 @@ public:
 	* @param [in] beta Parameter for prior knowledge about the distribution (\f$ \beta = 2 \f$ is optimal for Gaussian)
 	* @param [in] kappa Secondary scaling parameter (usually 0)
 	*/
-	void init(double alpha, double beta, double kappa)
+	void init(FilterScalar alpha, FilterScalar beta, FilterScalar kappa)
 	{	
 		// Compute the augmented state size
 		// TODO: this isn't the state size
-		const double L = static_cast<double>(S_DIM + Q_DIM + R_DIM);
+		const FilterScalar L = static_cast<FilterScalar>(S_DIM + Q_DIM + R_DIM);
 
 		// For standard UKF, here are the weights...
 
 		// compound scaling parameter
-		double lambda = alpha * alpha * (L + kappa) - L;
+		FilterScalar lambda = alpha * alpha * (L + kappa) - L;
 
 		// Scaling factor for sigma points.
 		zeta = sqrt(L + lambda);
@@ -903,8 +911,8 @@ public:
 		assert(fabs(L + kappa) > 1e-6);
 
 		// Fill in the mean-weights
-		double wm_0 = lambda / (L + lambda);
-		double wm_rest = 0.5 / (L + lambda);
+		FilterScalar wm_0 = lambda / (L + lambda);
+		FilterScalar wm_rest = 0.5 / (L + lambda);
 			
 		// Make sure wm_rest > 0 to avoid square-root of negative number
 		assert(wm_rest > 0.0);
@@ -917,8 +925,8 @@ public:
 		}
 
 		// Fill in the covariance-weights
-		double wc_0 = wm_0 + (1.0 - alpha*alpha + beta);
-		double wc_rest = wm_rest;
+		FilterScalar wc_0 = wm_0 + (1.0 - alpha*alpha + beta);
+		FilterScalar wc_rest = wm_rest;
 
 		// wc = weights for calculating covariance(proc., obs., proc - obs)
 		wc[0] = wc_0;
@@ -960,33 +968,60 @@ public:
 	State x;
 
 	//! Lower-triangular Cholesky factor of state covariance
-	Eigen::Matrix<double, S_DIM, S_DIM> S;
+	Eigen::Matrix<FilterScalar, S_DIM, S_DIM> S;
 
 	//! Process noise mean
 	PoseNoiseVector Q_mu;
 
 	//! The "square root" of the process noise covariance a.k.a. the lower part of the Choleskly
-	Eigen::Matrix<double, Q_DIM, Q_DIM> Q_cov;
+	Eigen::Matrix<FilterScalar, Q_DIM, Q_DIM> Q_cov;
 
 	MeasurementModelType measurement_model;
 
 	SigmaPointWeights<S_DIM, Q_DIM, R_DIM> W;
 
 	// Sigma points at time t = k - 1
-	Eigen::Matrix<double, X_DIM, SIGMA_POINT_COUNT> X_t;
+	Eigen::Matrix<FilterScalar, X_DIM, SIGMA_POINT_COUNT> X_t;
 
 	// Augmented Sigma points propagated through process function to time k
-	Eigen::Matrix<double, X_DIM, L_DIM> X_k;
+	Eigen::Matrix<FilterScalar, X_DIM, L_DIM> X_k;
 
 	// State estimate = weighted sum of sigma points
 	PoseStateVector x_k;
 
 	// Propagated sigma point residuals = (sp - x_k)
-	Eigen::Matrix<double, S_DIM, L_DIM> X_k_r;
+	Eigen::Matrix<FilterScalar, S_DIM, L_DIM> X_k_r;
 
 	// Upper - triangular of propagated sp covariance
-	Eigen::Matrix<double, S_DIM, S_DIM > Sx_k;
-                    
+	Eigen::Matrix<FilterScalar, S_DIM, S_DIM > Sx_k;
+
+	// Remaining per-tick workspaces. All fixed-size and owned by the filter so
+	// that predict/update never allocate and never push ~10KB of Eigen
+	// temporaries onto the stack each tick.
+
+	// Sigma points propagated through the observation function
+	Eigen::Matrix<FilterScalar, O_DIM, L_DIM> Y_k;
+
+	// Observation sigma point residuals = (sp - y_k)
+	Eigen::Matrix<FilterScalar, O_DIM, L_DIM> Y_k_r;
+
+	// Upper - triangular of observation sqrt covariance
+	Eigen::Matrix<FilterScalar, O_DIM, O_DIM> Sy_k;
+
+	// State - observation cross covariance
+	Eigen::Matrix<FilterScalar, S_DIM, O_DIM> Pxy;
+
+	// Kalman gain
+	Eigen::Matrix<FilterScalar, S_DIM, O_DIM> KG;
+
+	// Weighted residual transposes handed to the QR decompositions
+	Eigen::Matrix<FilterScalar, L_DIM - 1, S_DIM> state_qr_input;
+	Eigen::Matrix<FilterScalar, L_DIM - 1, O_DIM> observation_qr_input;
+
+	// QR workspaces, sized at compile time and refilled via compute()
+	Eigen::HouseholderQR<Eigen::Matrix<FilterScalar, L_DIM - 1, S_DIM>> state_qr;
+	Eigen::HouseholderQR<Eigen::Matrix<FilterScalar, L_DIM - 1, O_DIM>> observation_qr;
+
 public:
 	PoseSRUFK()
 	{
@@ -1002,26 +1037,26 @@ public:
 		const Eigen::Vector3f &position, 
 		const Eigen::Quaternionf &orientation)
 	{
-		const double mean_position_dT = constants.position_constants.mean_update_time_delta;
-		//const double mean_orientation_dT = constants.position_constants.mean_update_time_delta;
+		const FilterScalar mean_position_dT = constants.position_constants.mean_update_time_delta;
+		//const FilterScalar mean_orientation_dT = constants.position_constants.mean_update_time_delta;
 
 		// Start off using the maximum variance values
 		//const Eigen::Vector3f position_variance =
 			//(constants.position_constants.min_position_variance +
 			//	constants.position_constants.max_position_variance) * 0.5f * Q_SCALE;
-		//const double angle_axis_variance =
+		//const FilterScalar angle_axis_variance =
 			//(constants.orientation_constants.min_orientation_variance +
 			//	constants.orientation_constants.max_orientation_variance) * 0.5f* Q_SCALE;
 
 		// TODO: Initial guess at state covariance square root from filter constants?
-		S = Eigen::Matrix<double, S_DIM, S_DIM>::Identity() * 0.01;
+		S = Eigen::Matrix<FilterScalar, S_DIM, S_DIM>::Identity() * 0.01;
 
 		// Process noise should be mean-zero, I think.
-		Q_mu = Eigen::Matrix<double, Q_DIM, 1>::Zero();
+		Q_mu = Eigen::Matrix<FilterScalar, Q_DIM, 1>::Zero();
 
 		// Initialize the process covariance matrix Q
-		Eigen::Matrix<double, Q_DIM, Q_DIM> Q_cov_init=
-			Eigen::Matrix<double, Q_DIM, Q_DIM>::Zero();
+		Eigen::Matrix<FilterScalar, Q_DIM, Q_DIM> Q_cov_init=
+			Eigen::Matrix<FilterScalar, Q_DIM, Q_DIM>::Zero();
 		process_3rd_order_noise(mean_position_dT, Q_SCALE, POSITION_X, Q_cov_init);
 		process_3rd_order_noise(mean_position_dT, Q_SCALE, POSITION_Y, Q_cov_init);
 		process_3rd_order_noise(mean_position_dT, Q_SCALE, POSITION_Z, Q_cov_init);
@@ -1029,7 +1064,7 @@ public:
 		//process_2nd_order_noise(mean_orientation_dT, Q_SCALE, ANGLE_AXIS_Y, Q_cov_init);
 		//process_2nd_order_noise(mean_orientation_dT, Q_SCALE, ANGLE_AXIS_Z, Q_cov_init);
 		//HACK: Overwrite orientation/angvel process noise.
-//		Q_cov_init.block<6, 6>(9, 9) = Eigen::Matrix<double, 6, 6>::Identity()*0.1;
+//		Q_cov_init.block<6, 6>(9, 9) = Eigen::Matrix<FilterScalar, 6, 6>::Identity()*0.1;
 
 		// Compute the std-deviation Q matrix a.k.a. the sqrt of Q_cov_init a.k.a the Cholesky
 		Q_cov= Q_cov_init.llt().matrixL();
@@ -1039,8 +1074,8 @@ public:
 
 		// Set the initial state
 		x.setZero();
-		x.set_position_meters(position.cast<double>());
-		x.set_quaternion(orientation.cast<double>());
+		x.set_position_meters(position.cast<FilterScalar>());
+		x.set_quaternion(orientation.cast<FilterScalar>());
 
 		//%% 1. Initialize the sigma point weights
 		W.init(k_ukf_alpha, k_ukf_beta, k_ukf_kappa);
@@ -1067,51 +1102,51 @@ public:
 		PoseStateVector new_state;
 
 		// Extract parameters from the old state
-		const Eigen::Vector3d old_position = old_state.get_position_meters();
-		const Eigen::Vector3d old_linear_velocity = old_state.get_linear_velocity_m_per_sec();
-		const Eigen::Vector3d old_linear_acceleration = old_state.get_linear_acceleration_m_per_sec_sqr();
-		const Eigen::Quaterniond old_orientation = old_state.get_quaternion();
-		const Eigen::Vector3d old_angular_velocity = old_state.get_angular_velocity_rad_per_sec();
+		const FilterVector3 old_position = old_state.get_position_meters();
+		const FilterVector3 old_linear_velocity = old_state.get_linear_velocity_m_per_sec();
+		const FilterVector3 old_linear_acceleration = old_state.get_linear_acceleration_m_per_sec_sqr();
+		const FilterQuaternion old_orientation = old_state.get_quaternion();
+		const FilterVector3 old_angular_velocity = old_state.get_angular_velocity_rad_per_sec();
 
 		// Extract parameters from process noise mean
-		const Eigen::Vector3d position_bias = Q_mu.get_position_noise();
-		const Eigen::Vector3d linear_velocity_bias = Q_mu.get_linear_velocity_noise();
-		const Eigen::Vector3d linear_acceleration_bias = Q_mu.get_linear_acceleration_noise();
-		const Eigen::Quaterniond orientation_bias = Q_mu.get_quaternion_noise();
-		const Eigen::Vector3d angular_velocity_bias = Q_mu.get_angular_velocity_noise();
+		const FilterVector3 position_bias = Q_mu.get_position_noise();
+		const FilterVector3 linear_velocity_bias = Q_mu.get_linear_velocity_noise();
+		const FilterVector3 linear_acceleration_bias = Q_mu.get_linear_acceleration_noise();
+		const FilterQuaternion orientation_bias = Q_mu.get_quaternion_noise();
+		const FilterVector3 angular_velocity_bias = Q_mu.get_angular_velocity_noise();
 
 		// Extract parameters from process noise variance
-		const Eigen::Vector3d position_noise = zQ_cov.get_position_noise();
-		const Eigen::Vector3d linear_velocity_noise = zQ_cov.get_linear_velocity_noise();
-		const Eigen::Vector3d linear_acceleration_noise = zQ_cov.get_linear_acceleration_noise();
-		const Eigen::Quaterniond orientation_noise = zQ_cov.get_quaternion_noise();
-		const Eigen::Vector3d angular_velocity_noise = zQ_cov.get_angular_velocity_noise();
+		const FilterVector3 position_noise = zQ_cov.get_position_noise();
+		const FilterVector3 linear_velocity_noise = zQ_cov.get_linear_velocity_noise();
+		const FilterVector3 linear_acceleration_noise = zQ_cov.get_linear_acceleration_noise();
+		const FilterQuaternion orientation_noise = zQ_cov.get_quaternion_noise();
+		const FilterVector3 angular_velocity_noise = zQ_cov.get_angular_velocity_noise();
 
 		// Compute the position state update
-		const Eigen::Vector3d new_position =
+		const FilterVector3 new_position =
 			old_position
 			+ old_linear_velocity*deltaTime
 			+ old_linear_acceleration*deltaTime*deltaTime*0.5f
 			+ position_bias
 			+ position_noise;
-		const Eigen::Vector3d new_linear_velocity = 
+		const FilterVector3 new_linear_velocity = 
 			old_linear_velocity 
 			+ old_linear_acceleration*deltaTime
 			+ linear_velocity_bias
 			+ linear_velocity_noise;
-		const Eigen::Vector3d new_linear_acceleration = 
+		const FilterVector3 new_linear_acceleration = 
 			old_linear_acceleration
 			+ linear_acceleration_bias
 			+ linear_acceleration_noise;
-		const Eigen::Vector3d new_angular_velocity =
+		const FilterVector3 new_angular_velocity =
 			old_angular_velocity
 			+ angular_velocity_bias
 			+ angular_velocity_noise;
 
 		// Compute the orientation update
 		// From Kraft or Enayati:
-		const Eigen::Quaterniond q_delta = eigen_angle_axis_to_quaterniond(old_angular_velocity * deltaTime);
-		const Eigen::Quaterniond new_orientation = 
+		const FilterQuaternion q_delta = eigen_angle_axis_to_quaternion(old_angular_velocity * deltaTime);
+		const FilterQuaternion new_orientation = 
 			(old_orientation 
 			* q_delta
 			* orientation_bias
@@ -1231,15 +1266,14 @@ public:
 		// w_qr is scalar
 		// QR update of state Cholesky factor.
 		// w_qr and w_cholup cannot be negative
-//		Eigen::Matrix<double, L_DIM - 1, S_DIM > qr_input = (W.w_qr*X_k_r.rightCols<L_DIM - 1>()).transpose();
+//		state_qr_input = (W.w_qr*X_k_r.rightCols<L_DIM - 1>()).transpose();
 
-		// TODO: Use ColPivHouseholderQR
-//		Eigen::HouseholderQR<decltype(qr_input)> qr(qr_input);
+//		state_qr.compute(state_qr_input);
 
 		// Set R matrix as upper triangular square root
 		// NOTE: R matrix is stored in upper triangular half
 		// See: http://math.stackexchange.com/questions/1396308/qr-decomposition-results-in-eigen-library-differs-from-matlab
-//		Sx_k = qr.matrixQR().topLeftCorner<S_DIM, S_DIM>().triangularView<Eigen::Upper>();
+//		Sx_k = state_qr.matrixQR().topLeftCorner<S_DIM, S_DIM>().triangularView<Eigen::Upper>();
 
 		// Perform additional rank 1 update
 		float wc0_sign = static_cast<float>(sgn(W.wc(0)));
@@ -1257,7 +1291,6 @@ public:
 		// 1. Propagate sigma points through observation function.
 		const int nsp = SIGMA_POINT_COUNT;
 		const int R_inds = (nsp - 2 * R_DIM);
-		Eigen::Matrix<double, O_DIM, L_DIM> Y_k;
 
 		// Pass the first 5 blocks of the sigma points through the observation function
 		// with zero measurement covariance applied
@@ -1292,8 +1325,6 @@ public:
 
 		// 3. Calculate y - residuals.
 		// Used in observation covariance and state - observation cross - covariance for Kalman gain.
-
-		Eigen::Matrix<double, O_DIM, L_DIM>  Y_k_r;
 		for (int col_offset = 0; col_offset < L_DIM; ++col_offset)
 		{
 			Y_k_r.col(col_offset)= Measurement(Y_k.col(col_offset)) - y_k;
@@ -1303,15 +1334,14 @@ public:
 		// w_qr is scalar
 		// QR update of state Cholesky factor.
 		// w_qr and w_cholup cannot be negative
-		Eigen::Matrix<double, L_DIM - 1, O_DIM> qr_input = (W.w_qr*Y_k_r.rightCols<L_DIM - 1>()).transpose();
+		observation_qr_input = (W.w_qr*Y_k_r.rightCols<L_DIM - 1>()).transpose();
 
-		// TODO: Use ColPivHouseholderQR
-		Eigen::HouseholderQR<decltype(qr_input)> qr(qr_input);
+		observation_qr.compute(observation_qr_input);
 
 		// Set R matrix as upper triangular square root
 		// NOTE: R matrix is stored in upper triangular half
 		// See: http://math.stackexchange.com/questions/1396308/qr-decomposition-results-in-eigen-library-differs-from-matlab
-		Eigen::Matrix<double, O_DIM, O_DIM > Sy_k = qr.matrixQR().topLeftCorner<O_DIM, O_DIM>().triangularView<Eigen::Upper>();
+		Sy_k = observation_qr.matrixQR().topLeftCorner<O_DIM, O_DIM>().triangularView<Eigen::Upper>();
 
 		// Perform additional rank 1 update
 		float wc0_sign = (W.wc(0) > 0.f) ? 1.f : -1.f;
@@ -1319,19 +1349,18 @@ public:
 
 		// 5. Calculate Kalman Gain
 		//First calculate state - observation cross(sqrt) covariance
-		const Eigen::Matrix<double, 1, L_DIM> wc = W.wc.transpose();
-		const Eigen::Matrix<double, S_DIM, L_DIM> wc_repl = wc.replicate<S_DIM, 1>();
-		const Eigen::Matrix<double, S_DIM, O_DIM> Pxy=
-			X_k_r.cwiseProduct(wc_repl).eval() * Y_k_r.transpose();
+		Pxy.noalias() = (X_k_r * W.wc.asDiagonal()) * Y_k_r.transpose();
 
 		// In the Matlab code: KG = (Pxy / Sy_k')/Sy_k
-		// where "/" is the "mrdivide" operator, 
-		// x = B/A solves the system of linear equations A*x = B for x. 
-		// I arrived at the following through trial and error
-		Eigen::Matrix<double, O_DIM, S_DIM> numerator = Sy_k.transpose().colPivHouseholderQr().solve(Pxy.transpose());
-		Eigen::Matrix<double, S_DIM, O_DIM> KG = Sy_k.colPivHouseholderQr().solve(numerator).transpose();
+		// where "/" is the "mrdivide" operator,
+		// x = B/A solves the system of linear equations A*x = B for x.
+		// Sy_k is triangular so both solves are plain back-substitutions
+		// (no per-tick QR decomposition needed)
+		const Eigen::Matrix<FilterScalar, O_DIM, S_DIM> numerator =
+			Sy_k.transpose().triangularView<Eigen::Lower>().solve(Pxy.transpose());
+		KG = Sy_k.triangularView<Eigen::Upper>().solve(numerator).transpose();
 
-		//Eigen::Matrix<double, X_DIM, O_DIM> KG = Pxy * Sy_k.inverse();
+		//Eigen::Matrix<FilterScalar, X_DIM, O_DIM> KG = Pxy * Sy_k.inverse();
 
 		// 6. Calculate innovation
 		Measurement innov = observation - y_k;
@@ -1343,7 +1372,7 @@ public:
 
 		// 8. Covariance update / correct
 		// This is equivalent to : Px = Px_ - KG*Py*KG';
-		Eigen::Matrix<double, S_DIM, O_DIM> cov_update_vectors = KG * Sy_k;
+		Eigen::Matrix<FilterScalar, S_DIM, O_DIM> cov_update_vectors = KG * Sy_k;
 		for (int j = 0; j < O_DIM; ++j)
 		{
 			// Still UPPER
@@ -1367,6 +1396,10 @@ public:
 	/// True if we have seen a valid orientation measurement (>0 orientation quality)
 	bool bSeenOrientationMeasurement;
 
+	/// Optical measurements rejected by the innovation gate since the last
+	/// accepted one (see k_optical_gate_max_consecutive_rejects)
+	int consecutive_optical_rejects;
+
     /// Quaternion measured when controller points towards camera 
     Eigen::Quaternionf reset_orientation;
 
@@ -1386,6 +1419,7 @@ public:
 		bIsValid = false;
 		bSeenPositionMeasurement = true;
 		bSeenOrientationMeasurement = true;
+		consecutive_optical_rejects = 0;
 
 		reset_orientation = Eigen::Quaternionf::Identity();
 		origin_position = Eigen::Vector3f::Zero();
@@ -1400,12 +1434,13 @@ public:
         bIsValid = true;
 		bSeenPositionMeasurement= false;
 		bSeenOrientationMeasurement= false;
+		consecutive_optical_rejects= 0;
 
         reset_orientation = Eigen::Quaternionf::Identity();
         origin_position = Eigen::Vector3f::Zero();
 		state = PoseStateVector::Zero();
-		state.set_position_meters(position.cast<double>());
-		state.set_quaternion(orientation.cast<double>());
+		state.set_position_meters(position.cast<FilterScalar>());
+		state.set_quaternion(orientation.cast<FilterScalar>());
     }
 };
 
@@ -1522,12 +1557,13 @@ Eigen::Quaternionf KalmanPoseFilter::getOrientation(float time) const
 
         if (fabsf(time) > k_real_epsilon)
         {
-            const Eigen::Quaternionf &quaternion_derivative =
-                eigen_angular_velocity_to_quaternion_derivative(result, getAngularVelocityRadPerSec());
+            // Integrate the gyro-derived angular velocity over the prediction
+            // horizon with the quaternion exponential map - the same step the
+            // process model uses, and exact for constant angular velocity
+            const Eigen::Quaternionf q_delta =
+                eigen_angle_axis_to_quaternion(getAngularVelocityRadPerSec() * time);
 
-            predicted_orientation = Eigen::Quaternionf(
-                state_orientation.coeffs()
-                + quaternion_derivative.coeffs()*time).normalized();
+            predicted_orientation = (state_orientation * q_delta).normalized();
         }
 
         result = m_filter->reset_orientation * predicted_orientation;
@@ -1538,7 +1574,7 @@ Eigen::Quaternionf KalmanPoseFilter::getOrientation(float time) const
 
 Eigen::Vector3f KalmanPoseFilter::getAngularVelocityRadPerSec() const
 {
-	Eigen::Vector3d ang_vel= m_filter->state.get_angular_velocity_rad_per_sec();
+	FilterVector3 ang_vel= m_filter->state.get_angular_velocity_rad_per_sec();
 	
     return ang_vel.cast<float>();
 }
@@ -1556,10 +1592,16 @@ Eigen::Vector3f KalmanPoseFilter::getPositionCm(float time) const
     {
         Eigen::Vector3f state_position_meters= m_filter->state.get_position_meters().cast<float>();
 		Eigen::Vector3f state_vel_m_per_sec = m_filter->state.get_linear_velocity_m_per_sec().cast<float>();
+		Eigen::Vector3f state_accel_m_per_sec_sqr = m_filter->state.get_linear_acceleration_m_per_sec_sqr().cast<float>();
+
+		// Constant-acceleration extrapolation of the filter state so that
+		// clients can request poses at photon time without rolling their own
         Eigen::Vector3f predicted_position_meters =
             is_nearly_zero(time)
             ? state_position_meters
-            : state_position_meters + state_vel_m_per_sec * time;
+            : state_position_meters
+              + state_vel_m_per_sec * time
+              + state_accel_m_per_sec_sqr * (0.5f * time * time);
 
         result = (predicted_position_meters - m_filter->origin_position) * k_meters_to_centimeters;
     }
@@ -1569,14 +1611,14 @@ Eigen::Vector3f KalmanPoseFilter::getPositionCm(float time) const
 
 Eigen::Vector3f KalmanPoseFilter::getVelocityCmPerSec() const
 {
-	Eigen::Vector3d vel= m_filter->state.get_linear_velocity_m_per_sec() * k_meters_to_centimeters;
+	FilterVector3 vel= m_filter->state.get_linear_velocity_m_per_sec() * k_meters_to_centimeters;
 
     return vel.cast<float>();
 }
 
 Eigen::Vector3f KalmanPoseFilter::getAccelerationCmPerSecSqr() const
 {
-    Eigen::Vector3d accel= m_filter->state.get_linear_acceleration_m_per_sec_sqr() * k_meters_to_centimeters;
+    FilterVector3 accel= m_filter->state.get_linear_acceleration_m_per_sec_sqr() * k_meters_to_centimeters;
 
 	return accel.cast<float>();
 }
@@ -1625,8 +1667,8 @@ void KalmanPoseFilterDS4::update(const float delta_time, const PoseFilterPacket
         DS4_MeasurementVector measurement = measurement_model.observation_function(srukf.x, DS4_MeasurementVector::Zero());
 
         // Accelerometer and gyroscope measurements are always available
-        measurement.set_accelerometer(packet.imu_accelerometer_g_units.cast<double>());
-        measurement.set_gyroscope(packet.imu_gyroscope_rad_per_sec.cast<double>());
+        measurement.set_accelerometer(packet.imu_accelerometer_g_units.cast<FilterScalar>());
+        measurement.set_gyroscope(packet.imu_gyroscope_rad_per_sec.cast<FilterScalar>());
 
 		// Adjust the amount we trust the optical measurements based on the quality parameters
 		measurement_model.update_measurement_statistics(
@@ -1636,26 +1678,58 @@ void KalmanPoseFilterDS4::update(const float delta_time, const PoseFilterPacket
         if (packet.tracking_projection_area_px_sqr > 0.f)
         {
 			Eigen::Vector3f optical_position_meters = packet.get_optical_position_in_meters();
-
-            // Use the optical orientation measurement
-            measurement.set_optical_quaternion(packet.optical_orientation.cast<double>());
-
-			// If this is the first time we have seen the orientation, snap the orientation state
-			if (!m_filter->bSeenOrientationMeasurement)
+			const FilterVector3 optical_position= optical_position_meters.cast<FilterScalar>();
+			bool bAcceptMeasurement= true;
+
+			// Gate the optical measurement on its position innovation before a
+			// reflection ghost can poison the state. A ghost blob corrupts the
+			// derived orientation along with the position, so a rejection
+			// drops the whole optical block for this tick.
+			if (m_filter->bSeenPositionMeasurement)
 			{
-				srukf.x.set_quaternion(packet.optical_orientation.cast<double>());
-				m_filter->bSeenOrientationMeasurement= true;
+				const FilterVector3 innovation=
+					optical_position - measurement.get_optical_position();
+				const FilterScalar measurement_variance_m_sqr=
+					k_centimeters_to_meters*k_centimeters_to_meters*
+					static_cast<FilterScalar>(
+						m_constants.position_constants.position_variance_curve.evaluateLUT(
+							packet.tracking_projection_area_px_sqr));
+
+				bAcceptMeasurement=
+					innovation.squaredNorm() <= k_optical_gate_chi_sqr*measurement_variance_m_sqr ||
+					m_filter->consecutive_optical_rejects >= k_optical_gate_max_consecutive_rejects;
 			}
 
-            // Use the optical position
-            // State internally stores position in meters
-            measurement.set_optical_position(optical_position_meters.cast<double>());
-
-			// If this is the first time we have seen the position, snap the position state
-			if (!m_filter->bSeenPositionMeasurement)
+			if (bAcceptMeasurement)
 			{
-				srukf.x.set_position_meters(optical_position_meters.cast<double>());
-				m_filter->bSeenPositionMeasurement= true;
+				m_filter->consecutive_optical_rejects= 0;
+
+				// Use the optical orientation measurement
+				measurement.set_optical_quaternion(packet.optical_orientation.cast<FilterScalar>());
+
+				// If this is the first time we have seen the orientation, snap the orientation state
+				if (!m_filter->bSeenOrientationMeasurement)
+				{
+					srukf.x.set_quaternion(packet.optical_orientation.cast<FilterScalar>());
+					m_filter->bSeenOrientationMeasurement= true;
+				}
+
+				// Use the optical position
+				// State internally stores position in meters
+				measurement.set_optical_position(optical_position);
+
+				// If this is the first time we have seen the position, snap the position state
+				if (!m_filter->bSeenPositionMeasurement)
+				{
+					srukf.x.set_position_meters(optical_position);
+					m_filter->bSeenPositionMeasurement= true;
+				}
+			}
+			else
+			{
+				// Leave the optical slots at their predicted values so the
+				// update sees zero optical innovation (IMU-only this tick)
+				++m_filter->consecutive_optical_rejects;
 			}
         }
 
@@ -1670,16 +1744,16 @@ void KalmanPoseFilterDS4::update(const float delta_time, const PoseFilterPacket
 		{
 			Eigen::Vector3f optical_position_meters= packet.get_optical_position_in_meters();
 
-			srukf.x.set_position_meters(optical_position_meters.cast<double>());
+			srukf.x.set_position_meters(optical_position_meters.cast<FilterScalar>());
 			m_filter->bSeenPositionMeasurement= true;
 
-			srukf.x.set_quaternion(packet.optical_orientation.cast<double>());
+			srukf.x.set_quaternion(packet.optical_orientation.cast<FilterScalar>());
 			m_filter->bSeenOrientationMeasurement = true;
 		}
 		else
 		{
-			srukf.x.set_position_meters(Eigen::Vector3d::Zero());
-			srukf.x.set_quaternion(Eigen::Quaterniond::Identity());
+			srukf.x.set_position_meters(FilterVector3::Zero());
+			srukf.x.set_quaternion(FilterQuaternion::Identity());
 		}
 
         m_filter->bIsValid= true;
@@ -1732,28 +1806,58 @@ void KalmanPoseFilterPSMove::update(const float delta_time, const PoseFilterPack
         PSMove_MeasurementVector measurement = measurement_model.observation_function(srukf.x, PSMove_MeasurementVector::Zero());
 
         // Accelerometer, magnetometer and gyroscope measurements are always available
-        measurement.set_accelerometer(packet.imu_accelerometer_g_units.cast<double>());
-        measurement.set_gyroscope(packet.imu_gyroscope_rad_per_sec.cast<double>());
-        measurement.set_magnetometer(packet.imu_magnetometer_unit.cast<double>());
+        measurement.set_accelerometer(packet.imu_accelerometer_g_units.cast<FilterScalar>());
+        measurement.set_gyroscope(packet.imu_gyroscope_rad_per_sec.cast<FilterScalar>());
+        measurement.set_magnetometer(packet.imu_magnetometer_unit.cast<FilterScalar>());
 
         // If available, use the optical position
         if (packet.tracking_projection_area_px_sqr > 0.f)
         {
 			Eigen::Vector3f optical_position= packet.get_optical_position_in_meters();
+			const FilterVector3 optical_position_meters= optical_position.cast<FilterScalar>();
+			bool bAcceptMeasurement= true;
 
 			//TODO: Update measurement statistics once we get the filter working
 			//// Adjust the amount we trust the optical measurements based on the quality parameters
 			//measurement_model.update_measurement_statistics(m_constants, packet.tracking_projection_area);
 
-			// Assign the latest optical measurement from the packet
-            measurement.set_optical_position(optical_position.cast<double>());
+			// Gate the optical measurement on its position innovation before a
+			// reflection ghost can poison the state
+			if (m_filter->bSeenPositionMeasurement)
+			{
+				const FilterVector3 innovation=
+					optical_position_meters - measurement.get_optical_position();
+				const FilterScalar measurement_variance_m_sqr=
+					k_centimeters_to_meters*k_centimeters_to_meters*
+					static_cast<FilterScalar>(
+						m_constants.position_constants.position_variance_curve.evaluateLUT(
+							packet.tracking_projection_area_px_sqr));
+
+				bAcceptMeasurement=
+					innovation.squaredNorm() <= k_optical_gate_chi_sqr*measurement_variance_m_sqr ||
+					m_filter->consecutive_optical_rejects >= k_optical_gate_max_consecutive_rejects;
+			}
 
-			// If this is the first time we have seen the position, snap the position state
-			//if (!m_filter->bSeenPositionMeasurement)
-			//{
-			//	srukf.x.set_position(optical_position.cast<double>());
-			//	m_filter->bSeenPositionMeasurement= true;
-			//}
+			if (bAcceptMeasurement)
+			{
+				m_filter->consecutive_optical_rejects= 0;
+
+				// Assign the latest optical measurement from the packet
+				measurement.set_optical_position(optical_position_meters);
+
+				// If this is the first time we have seen the position, snap the position state
+				//if (!m_filter->bSeenPositionMeasurement)
+				//{
+				//	srukf.x.set_position(optical_position.cast<FilterScalar>());
+				//	m_filter->bSeenPositionMeasurement= true;
+				//}
+			}
+			else
+			{
+				// Leave the optical slot at the predicted measurement so the
+				// update sees zero optical innovation (IMU-only this tick)
+				++m_filter->consecutive_optical_rejects;
+			}
         }
 
         // Update UKF
@@ -1762,7 +1866,7 @@ void KalmanPoseFilterPSMove::update(const float delta_time, const PoseFilterPack
     else
     {
         srukf.x.setZero();
-        srukf.x.set_quaternion(Eigen::Quaterniond::Identity());
+        srukf.x.set_quaternion(FilterQuaternion::Identity());
 
 		// We always "see" the orientation measurements for the PSMove (MARG state)
 		m_filter->bSeenOrientationMeasurement= true;
@@ -1771,12 +1875,12 @@ void KalmanPoseFilterPSMove::update(const float delta_time, const PoseFilterPack
 		{
 			Eigen::Vector3f optical_position_meters= packet.get_optical_position_in_meters();
 
-			srukf.x.set_position_meters(optical_position_meters.cast<double>());
+			srukf.x.set_position_meters(optical_position_meters.cast<FilterScalar>());
 			m_filter->bSeenPositionMeasurement= true;
 		}
 		else
 		{
-			srukf.x.set_position_meters(Eigen::Vector3d::Zero());
+			srukf.x.set_position_meters(FilterVector3::Zero());
 		}
 
         m_filter->bIsValid= true;
@@ -1788,23 +1892,23 @@ void KalmanPoseFilterPSMove::update(const float delta_time, const PoseFilterPack
 
 //-- Private functions --
 void process_3rd_order_noise(
-    const double dT,
-    const double var,
+    const FilterScalar dT,
+    const FilterScalar var,
     const int state_index,
-	Eigen::Matrix<double, NOISE_PARAMETER_COUNT, NOISE_PARAMETER_COUNT> &Q)
+	Eigen::Matrix<FilterScalar, NOISE_PARAMETER_COUNT, NOISE_PARAMETER_COUNT> &Q)
 {
-    const double dT_2 = dT*dT;
-	const double dT_3 = dT_2*dT;
-	const double dT_4 = dT_2*dT_2;
-	const double dT_5 = dT_3*dT_2;
-	const double dT_6 = dT_3*dT_3;
-	const double dT_7 = dT_4*dT_3;
-
-    const double q7 = var * dT_7;
-    const double q6 = var * dT_6;
-    const double q5 = var * dT_5;
-    const double q4 = var * dT_4;
-    const double q3 = var * dT_3;
+    const FilterScalar dT_2 = dT*dT;
+	const FilterScalar dT_3 = dT_2*dT;
+	const FilterScalar dT_4 = dT_2*dT_2;
+	const FilterScalar dT_5 = dT_3*dT_2;
+	const FilterScalar dT_6 = dT_3*dT_3;
+	const FilterScalar dT_7 = dT_4*dT_3;
+
+    const FilterScalar q7 = var * dT_7;
+    const FilterScalar q6 = var * dT_6;
+    const FilterScalar q5 = var * dT_5;
+    const FilterScalar q4 = var * dT_4;
+    const FilterScalar q3 = var * dT_3;
 
     const int &i= state_index;
     Q(i+0,i+0) = q7/252.0; Q(i+0,i+1) = q6/72.0; Q(i+0,i+2) = q5/30.0;
@@ -1813,19 +1917,19 @@ void process_3rd_order_noise(
 }
 
 void process_2nd_order_noise(
-	const double dT, 
-	const double var, 
+	const FilterScalar dT, 
+	const FilterScalar var, 
 	const int state_index, 
-	Eigen::Matrix<double, NOISE_PARAMETER_COUNT, NOISE_PARAMETER_COUNT> &Q)
+	Eigen::Matrix<FilterScalar, NOISE_PARAMETER_COUNT, NOISE_PARAMETER_COUNT> &Q)
 {
-    const double dT_2 = dT*dT;
-	const double dT_3 = dT_2*dT;
-	const double dT_4 = dT_2*dT_2;
-	const double dT_5 = dT_3*dT_2;
-
-    const double q5 = var * dT_5;
-    const double q4 = var * dT_4;
-    const double q3 = var * dT_3;
+    const FilterScalar dT_2 = dT*dT;
+	const FilterScalar dT_3 = dT_2*dT;
+	const FilterScalar dT_4 = dT_2*dT_2;
+	const FilterScalar dT_5 = dT_3*dT_2;
+
+    const FilterScalar q5 = var * dT_5;
+    const FilterScalar q4 = var * dT_4;
+    const FilterScalar q3 = var * dT_3;
 
     // Q = [.5dt^2, dt]*[.5dt^2, dt]^T * variance
     const int &i= state_index;
@@ -1,5 +1,6 @@
 //-- includes --
 #include "KalmanPositionFilter.h"
+#include "FilterProfile.h"
 #include "MathAlignment.h"
 
 #include <kalman/MeasurementModel.hpp>
@@ -16,6 +17,13 @@
 #define UPDATE_VELOCITY_WITH_ACCELERATION 0
 #define ACCELEROMETER_FIXUP_HACKS 0
 
+// The position process model is linear, so the sigma point propagation in
+// predict() can run as one matrix product over the whole sigma point matrix
+// instead of one process function call per column. With several controllers
+// filtering per tick this takes the dominant UKF stage from N*column count
+// small evaluations down to N small GEMMs.
+#define BATCH_SIGMA_POINT_PROPAGATION 1
+
 //-- constants --
 enum PositionFilterStateEnum
 {
@@ -61,9 +69,21 @@ enum PositionFilterMeasurementEnum {
 // Arbitrary tuning scale applied to the process noise
 #define Q_SCALE 1.0
 
+// Mahalanobis-distance gate for the optical position measurement. A
+// reflection ghost occasionally yields a wildly wrong optical position; if
+// it enters the measurement update it drags the state away and the filter
+// spends the following frames re-converging with inflated covariance (and
+// inflated downstream ROIs). Innovations whose squared Mahalanobis distance
+// exceeds the chi-square 99.9% bound for 3 DOF are rejected instead.
+#define k_optical_gate_chi_sqr 16.266
+// A genuinely teleported controller looks exactly like a string of
+// outliers, so after this many consecutive rejections the measurement is
+// accepted unconditionally and the filter re-converges on the new position
+#define k_optical_gate_max_consecutive_rejects 5
+
 //-- private methods ---
 template <class StateType>
-void Q_discrete_3rd_order_white_noise(const double dT, const double var, const int state_index, Kalman::Covariance<StateType> &Q);
+void Q_discrete_3rd_order_white_noise(const FilterScalar dT, const FilterScalar var, const int state_index, Kalman::Covariance<StateType> &Q);
 
 //-- private definitions --
 template<typename T>
@@ -73,28 +93,28 @@ public:
     KALMAN_VECTOR(PositionStateVector, T, STATE_PARAMETER_COUNT)
 
     // Accessors
-    Eigen::Vector3d get_position_meters() const { 
-        return Eigen::Vector3d((*this)[POSITION_X], (*this)[POSITION_Y], (*this)[POSITION_Z]); 
+    FilterVector3 get_position_meters() const { 
+        return FilterVector3((*this)[POSITION_X], (*this)[POSITION_Y], (*this)[POSITION_Z]); 
     }
-    Eigen::Vector3d get_linear_velocity_m_per_sec() const {
-        return Eigen::Vector3d((*this)[LINEAR_VELOCITY_X], (*this)[LINEAR_VELOCITY_Y], (*this)[LINEAR_VELOCITY_Z]);
+    FilterVector3 get_linear_velocity_m_per_sec() const {
+        return FilterVector3((*this)[LINEAR_VELOCITY_X], (*this)[LINEAR_VELOCITY_Y], (*this)[LINEAR_VELOCITY_Z]);
     }
-    Eigen::Vector3d get_linear_acceleration_m_per_sec_sqr() const {
-        return Eigen::Vector3d((*this)[LINEAR_ACCELERATION_X], (*this)[LINEAR_ACCELERATION_Y], (*this)[LINEAR_ACCELERATION_Z]);
+    FilterVector3 get_linear_acceleration_m_per_sec_sqr() const {
+        return FilterVector3((*this)[LINEAR_ACCELERATION_X], (*this)[LINEAR_ACCELERATION_Y], (*this)[LINEAR_ACCELERATION_Z]);
     }
 
     // Mutators
-    void set_position_meters(const Eigen::Vector3d &p) {
+    void set_position_meters(const FilterVector3 &p) {
         (*this)[POSITION_X] = p.x(); (*this)[POSITION_Y] = p.y(); (*this)[POSITION_Z] = p.z();
     }
-    void set_linear_velocity_m_per_sec(const Eigen::Vector3d &v) {
+    void set_linear_velocity_m_per_sec(const FilterVector3 &v) {
         (*this)[LINEAR_VELOCITY_X] = v.x(); (*this)[LINEAR_VELOCITY_Y] = v.y(); (*this)[LINEAR_VELOCITY_Z] = v.z();
     }
-    void set_linear_acceleration_m_per_sec_sqr(const Eigen::Vector3d &a) {
+    void set_linear_acceleration_m_per_sec_sqr(const FilterVector3 &a) {
         (*this)[LINEAR_ACCELERATION_X] = a.x(); (*this)[LINEAR_ACCELERATION_Y] = a.y(); (*this)[LINEAR_ACCELERATION_Z] = a.z();
     }
 };
-typedef PositionStateVector<double> PositionStateVectord;
+typedef PositionStateVector<FilterScalar> PositionStateVectorX;
 
 template<typename T>
 class PositionMeasurementVector : public Kalman::Vector<T, MEASUREMENT_PARAMETER_COUNT>
@@ -103,22 +123,22 @@ public:
     KALMAN_VECTOR(PositionMeasurementVector, T, MEASUREMENT_PARAMETER_COUNT)
 
     // Accessors
-    Eigen::Vector3d get_accelerometer_g_units() const {
-        return Eigen::Vector3d((*this)[ACCELEROMETER_X], (*this)[ACCELEROMETER_Y], (*this)[ACCELEROMETER_Z]);
+    FilterVector3 get_accelerometer_g_units() const {
+        return FilterVector3((*this)[ACCELEROMETER_X], (*this)[ACCELEROMETER_Y], (*this)[ACCELEROMETER_Z]);
     }
-    Eigen::Vector3d get_optical_position_meters() const {
-        return Eigen::Vector3d((*this)[OPTICAL_POSITION_X], (*this)[OPTICAL_POSITION_Y], (*this)[OPTICAL_POSITION_Z]);
+    FilterVector3 get_optical_position_meters() const {
+        return FilterVector3((*this)[OPTICAL_POSITION_X], (*this)[OPTICAL_POSITION_Y], (*this)[OPTICAL_POSITION_Z]);
     }
 
     // Mutators
-    void set_accelerometer_g_units(const Eigen::Vector3d &a) {
+    void set_accelerometer_g_units(const FilterVector3 &a) {
         (*this)[ACCELEROMETER_X] = a.x(); (*this)[ACCELEROMETER_Y] = a.y(); (*this)[ACCELEROMETER_Z] = a.z();
     }
-    void set_optical_position_meters(const Eigen::Vector3d &p) {
+    void set_optical_position_meters(const FilterVector3 &p) {
         (*this)[OPTICAL_POSITION_X] = p.x(); (*this)[OPTICAL_POSITION_Y] = p.y(); (*this)[OPTICAL_POSITION_Z] = p.z();
     }
 };
-typedef PositionMeasurementVector<double> PositionMeasurementVectord;
+typedef PositionMeasurementVector<FilterScalar> PositionMeasurementVectorX;
 
 /**
 * @brief System model for a controller
@@ -126,10 +146,10 @@ typedef PositionMeasurementVector<double> PositionMeasurementVectord;
 * This is the system model defining how a controller advances from one
 * time-step to the next, i.e. how the system state evolves over time.
 */
-class PositionSystemModel : public Kalman::SystemModel<PositionStateVectord, Kalman::Vector<double, 0>, Kalman::SquareRootBase>
+class PositionSystemModel : public Kalman::SystemModel<PositionStateVectorX, Kalman::Vector<FilterScalar, 0>, Kalman::SquareRootBase>
 {
 public:
-    inline void set_time_step(const double dt) { m_time_step = dt; }
+    inline void set_time_step(const FilterScalar dt) { m_time_step = dt; }
 
     void init(const PositionFilterConstants &constants)
     {
@@ -143,22 +163,22 @@ public:
 		if (m_last_tracking_projection_area_px_sqr < 0.f ||
 			!is_nearly_equal(tracking_projection_area_px_sqr, m_last_tracking_projection_area_px_sqr, 10.f))
 		{
-			const double mean_position_dT = constants.mean_update_time_delta;
-			const double mean_orientation_dT = constants.mean_update_time_delta;
+			const FilterScalar mean_position_dT = constants.mean_update_time_delta;
+			const FilterScalar mean_orientation_dT = constants.mean_update_time_delta;
 
 			// Start off using the maximum variance values
-			static double q_scale = Q_SCALE;
-			const double position_variance_cm_sqr = static_cast<double>(constants.position_variance_curve.evaluate(tracking_projection_area_px_sqr));
+			static FilterScalar q_scale = Q_SCALE;
+			const FilterScalar position_variance_cm_sqr = static_cast<FilterScalar>(constants.position_variance_curve.evaluateLUT(tracking_projection_area_px_sqr));
 			// variance_meters = variance_cm * (0.01)^2 because ...
 			// var(k*x) = sum(k*x_i - k*mu)^2/(N-1) = k^2*sum(x_i - mu)^2/(N-1)
 			// where k = k_centimeters_to_meters = 0.01
-			const double position_variance_m_sqr = k_centimeters_to_meters*k_centimeters_to_meters*position_variance_cm_sqr;
+			const FilterScalar position_variance_m_sqr = k_centimeters_to_meters*k_centimeters_to_meters*position_variance_cm_sqr;
 
 			// Initialize the process covariance matrix Q
-			Kalman::Covariance<PositionStateVectord> Q = Kalman::Covariance<PositionStateVectord>::Zero();
-			Q_discrete_3rd_order_white_noise<PositionStateVectord>(mean_position_dT, q_scale*position_variance_m_sqr, POSITION_X, Q);
-			Q_discrete_3rd_order_white_noise<PositionStateVectord>(mean_position_dT, q_scale*position_variance_m_sqr, POSITION_Y, Q);
-			Q_discrete_3rd_order_white_noise<PositionStateVectord>(mean_position_dT, q_scale*position_variance_m_sqr, POSITION_Z, Q);
+			Kalman::Covariance<PositionStateVectorX> Q = Kalman::Covariance<PositionStateVectorX>::Zero();
+			Q_discrete_3rd_order_white_noise<PositionStateVectorX>(mean_position_dT, q_scale*position_variance_m_sqr, POSITION_X, Q);
+			Q_discrete_3rd_order_white_noise<PositionStateVectorX>(mean_position_dT, q_scale*position_variance_m_sqr, POSITION_Y, Q);
+			Q_discrete_3rd_order_white_noise<PositionStateVectorX>(mean_position_dT, q_scale*position_variance_m_sqr, POSITION_Z, Q);
 			setCovariance(Q);
 
 			// Keep track last tracking projection area we built the covariance matrix for
@@ -178,33 +198,33 @@ public:
     * @param [in] u The control vector input
     * @returns The (predicted) system state in the next time-step
     */
-    PositionStateVectord f(const PositionStateVectord& old_state, const Kalman::Vector<double, 0>& control) const
+    PositionStateVectorX f(const PositionStateVectorX& old_state, const Kalman::Vector<FilterScalar, 0>& control) const
     {
         //! Predicted state vector after transition
-        PositionStateVectord new_state;
+        PositionStateVectorX new_state;
 
         // Extract parameters from the old state
-        const Eigen::Vector3d old_position_meters = old_state.get_position_meters();
-        const Eigen::Vector3d old_linear_velocity_m_per_sec = old_state.get_linear_velocity_m_per_sec();
-        const Eigen::Vector3d old_linear_acceleration_m_per_sec_sqr = old_state.get_linear_acceleration_m_per_sec_sqr();
+        const FilterVector3 old_position_meters = old_state.get_position_meters();
+        const FilterVector3 old_linear_velocity_m_per_sec = old_state.get_linear_velocity_m_per_sec();
+        const FilterVector3 old_linear_acceleration_m_per_sec_sqr = old_state.get_linear_acceleration_m_per_sec_sqr();
 
         // Compute the position state update
 #if UPDATE_VELOCITY_WITH_ACCELERATION
-        const Eigen::Vector3d new_position_meters= 
+        const FilterVector3 new_position_meters= 
             old_position_meters 
             + old_linear_velocity_m_per_sec*m_time_step 
             + old_linear_acceleration_m_per_sec_sqr*m_time_step*m_time_step*0.5f;
-        const Eigen::Vector3d new_linear_velocity_m_per_sec= old_linear_velocity_m_per_sec + old_linear_acceleration_m_per_sec_sqr*m_time_step;
+        const FilterVector3 new_linear_velocity_m_per_sec= old_linear_velocity_m_per_sec + old_linear_acceleration_m_per_sec_sqr*m_time_step;
 #else
-		const Eigen::Vector3d new_position_meters =
+		const FilterVector3 new_position_meters =
 			old_position_meters
 			+ old_linear_velocity_m_per_sec*m_time_step;
-		const Eigen::Vector3d new_linear_velocity_m_per_sec = 
+		const FilterVector3 new_linear_velocity_m_per_sec = 
 			(m_time_step > k_real64_normal_epsilon) 
 			? (new_position_meters - old_position_meters) / m_time_step
 			: old_linear_velocity_m_per_sec;
 #endif
-		const Eigen::Vector3d &new_linear_acceleration_m_per_sec_sqr = old_linear_acceleration_m_per_sec_sqr;
+		const FilterVector3 &new_linear_acceleration_m_per_sec_sqr = old_linear_acceleration_m_per_sec_sqr;
 
         // Save results to the new state
         new_state.set_position_meters(new_position_meters);
@@ -214,16 +234,49 @@ public:
         return new_state;
     }
 
+	/**
+	* @brief State transition matrix equivalent of f()
+	*
+	* The process model above is linear, so propagating a state through it is
+	* the same as multiplying by this matrix. Used by the batched sigma point
+	* propagation to advance every sigma point with a single matrix product.
+	*/
+	Kalman::SquareMatrix<FilterScalar, STATE_PARAMETER_COUNT> getStateTransitionMatrix() const
+	{
+		Kalman::SquareMatrix<FilterScalar, STATE_PARAMETER_COUNT> F =
+			Kalman::SquareMatrix<FilterScalar, STATE_PARAMETER_COUNT>::Identity();
+
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			const int position_index = POSITION_X + 3*axis;
+			const int velocity_index = LINEAR_VELOCITY_X + 3*axis;
+#if UPDATE_VELOCITY_WITH_ACCELERATION
+			const int acceleration_index = LINEAR_ACCELERATION_X + 3*axis;
+
+			F(position_index, velocity_index) = m_time_step;
+			F(position_index, acceleration_index) = m_time_step*m_time_step*0.5;
+			F(velocity_index, acceleration_index) = m_time_step;
+#else
+			// f() recomputes velocity as (new_position - old_position)/dt
+			// which cancels back to the old velocity, so only the position
+			// row picks up a time step term
+			F(position_index, velocity_index) = m_time_step;
+#endif
+		}
+
+		return F;
+	}
+
 protected:
 	float m_last_tracking_projection_area_px_sqr;
-    double m_time_step;
+    FilterScalar m_time_step;
 };
 
-class PositionSRUKF : public Kalman::SquareRootUnscentedKalmanFilter<PositionStateVectord>
+class PositionSRUKF : public Kalman::SquareRootUnscentedKalmanFilter<PositionStateVectorX>
 {
 public:
-	PositionSRUKF(double alpha = 1.0, double beta = 2.0, double kappa = 0.0)
-		: Kalman::SquareRootUnscentedKalmanFilter<PositionStateVectord>(alpha, beta, kappa)
+	PositionSRUKF(FilterScalar alpha = 1.0, FilterScalar beta = 2.0, FilterScalar kappa = 0.0)
+		: Kalman::SquareRootUnscentedKalmanFilter<PositionStateVectorX>(alpha, beta, kappa)
 	{
 	}
 
@@ -231,6 +284,43 @@ public:
 	{
 		return x;
 	}
+
+	// Expose the protected sigma point transform so that the benchmark harness
+	// can time it in isolation (predict() recomputes them internally)
+	bool computeSigmaPointsProfiled()
+	{
+		return computeSigmaPoints();
+	}
+
+#if BATCH_SIGMA_POINT_PROPAGATION
+	/**
+	* @brief Same as the base predict() but batches the sigma point propagation
+	*
+	* The base implementation calls the process function once per sigma point
+	* column. Since the position process model is linear the whole sigma point
+	* matrix can be advanced with one matrix product against the state
+	* transition matrix instead.
+	*/
+	const State& predictLinear(
+		const PositionSystemModel& system_model,
+		const Kalman::SquareMatrix<FilterScalar, STATE_PARAMETER_COUNT> &state_transition)
+	{
+		// Compute sigma points from the current state and sqrt covariance
+		computeSigmaPoints();
+
+		// Propagate every sigma point through the process model in one product
+		sigmaStatePoints = state_transition * sigmaStatePoints;
+
+		// Predicted state is the weighted mean of the propagated sigma points
+		x = computePredictionFromSigmaPoints<State>(sigmaStatePoints);
+
+		// Update the covariance square root from the propagated sigma points
+		computeCovarianceSquareRootFromSigmaPoints(
+			x, sigmaStatePoints, system_model.getCovarianceSquareRoot(), S);
+
+		return getState();
+	}
+#endif
 };
 
 /**
@@ -239,7 +329,7 @@ public:
 * This is the measurement model for measuring the position and magnetometer of the PSMove controller.
 * The measurement is given by the optical trackers.
 */
-class PositionMeasurementModel : public Kalman::MeasurementModel<PositionStateVectord, PositionMeasurementVectord, Kalman::SquareRootBase>
+class PositionMeasurementModel : public Kalman::MeasurementModel<PositionStateVectorX, PositionMeasurementVectorX, Kalman::SquareRootBase>
 {
 public:
     void init(const PositionFilterConstants &constants)
@@ -247,10 +337,10 @@ public:
 		m_last_tracking_projection_area_px_sqr = -1.f;
 		update_measurement_covariance(constants, 0.f);
         
-		m_identity_gravity_direction= constants.gravity_calibration_direction.cast<double>();
+		m_identity_gravity_direction= constants.gravity_calibration_direction.cast<FilterScalar>();
     }
 
-	inline void set_current_orientation(const Eigen::Quaterniond &orientation)
+	inline void set_current_orientation(const FilterQuaternion &orientation)
 	{
 		m_current_orientation= orientation;
 	}
@@ -264,17 +354,17 @@ public:
 			!is_nearly_equal(tracking_projection_area_px_sqr, m_last_tracking_projection_area_px_sqr, 10.f))
 		{
 			const Eigen::Vector3f &accelerometer_variance = constants.accelerometer_variance;
-			const double position_variance_cm_sqr = static_cast<double>(constants.position_variance_curve.evaluate(tracking_projection_area_px_sqr));
+			const FilterScalar position_variance_cm_sqr = static_cast<FilterScalar>(constants.position_variance_curve.evaluateLUT(tracking_projection_area_px_sqr));
 			// variance_meters = variance_cm * (0.01)^2 because ...
 			// var(k*x) = sum(k*x_i - k*mu)^2/(N-1) = k^2*sum(x_i - mu)^2/(N-1)
 			// where k = k_centimeters_to_meters = 0.01
-			const double position_variance_m_sqr = k_centimeters_to_meters*k_centimeters_to_meters*position_variance_cm_sqr;
+			const FilterScalar position_variance_m_sqr = k_centimeters_to_meters*k_centimeters_to_meters*position_variance_cm_sqr;
 
 			// Update the measurement covariance R
-			static double r_accelometer_scale = R_ACCELEROMETER_SCALE;
-			static double r_position_scale = R_POSITION_SCALE;
-			Kalman::Covariance<PositionMeasurementVectord> R =
-				Kalman::Covariance<PositionMeasurementVectord>::Zero();
+			static FilterScalar r_accelometer_scale = R_ACCELEROMETER_SCALE;
+			static FilterScalar r_position_scale = R_POSITION_SCALE;
+			Kalman::Covariance<PositionMeasurementVectorX> R =
+				Kalman::Covariance<PositionMeasurementVectorX>::Zero();
 			R(ACCELEROMETER_X, ACCELEROMETER_X) = r_accelometer_scale*constants.accelerometer_variance.x();
 			R(ACCELEROMETER_Y, ACCELEROMETER_Y) = r_accelometer_scale*constants.accelerometer_variance.y();
 			R(ACCELEROMETER_Z, ACCELEROMETER_Z) = r_accelometer_scale*constants.accelerometer_variance.z();
@@ -298,21 +388,21 @@ public:
     * @param [in] x The system state in current time-step
     * @returns The (predicted) sensor measurement for the system state
     */
-    PositionMeasurementVectord h(const PositionStateVectord& x) const
+    PositionMeasurementVectorX h(const PositionStateVectorX& x) const
     {
-        PositionMeasurementVectord predicted_measurement;
+        PositionMeasurementVectorX predicted_measurement;
 
         // Use the position and orientation from the state for predictions
-        const Eigen::Vector3d position_meters= x.get_position_meters();
+        const FilterVector3 position_meters= x.get_position_meters();
 
         // Use the current linear acceleration from the state to predict
         // what the accelerometer reading will be (in world space)
-        const Eigen::Vector3d gravity_accel_g_units= m_identity_gravity_direction;
-        const Eigen::Vector3d linear_accel_g_units= x.get_linear_acceleration_m_per_sec_sqr() * k_ms2_to_g_units;
-        const Eigen::Vector3d accel_world_g_units= linear_accel_g_units + gravity_accel_g_units;
+        const FilterVector3 gravity_accel_g_units= m_identity_gravity_direction;
+        const FilterVector3 linear_accel_g_units= x.get_linear_acceleration_m_per_sec_sqr() * k_ms2_to_g_units;
+        const FilterVector3 accel_world_g_units= linear_accel_g_units + gravity_accel_g_units;
 
         // Put the accelerometer prediction into the local space of the controller
-        const Eigen::Vector3d accel_local_g_units= eigen_vector3d_clockwise_rotate(m_current_orientation, accel_world_g_units);
+        const FilterVector3 accel_local_g_units= eigen_vector3_clockwise_rotate(m_current_orientation, accel_world_g_units);
 
         // Save the predictions into the measurement vector
         predicted_measurement.set_accelerometer_g_units(accel_local_g_units);
@@ -322,8 +412,8 @@ public:
     }
 
 protected:
-    Eigen::Vector3d m_identity_gravity_direction;
-	Eigen::Quaterniond m_current_orientation;
+    FilterVector3 m_identity_gravity_direction;
+	FilterQuaternion m_current_orientation;
 	float m_last_tracking_projection_area_px_sqr;
 };
 
@@ -336,6 +426,10 @@ public:
     /// True if we have seen a valid position measurement (>0 position quality)
     bool bSeenPositionMeasurement;
 
+    /// Optical measurements rejected by the innovation gate since the last
+    /// accepted one (see k_optical_gate_max_consecutive_rejects)
+    int consecutive_optical_rejects;
+
     /// Position that's considered the origin position 
     Eigen::Vector3f origin_position_meters; // meters
 
@@ -357,23 +451,25 @@ public:
     {
         bIsValid = false;
 		bSeenPositionMeasurement= false;
+		consecutive_optical_rejects= 0;
 
         origin_position_meters = Eigen::Vector3f::Zero();
 
 		measurement_model.init(constants);
         system_model.init(constants);
-        ukf.init(PositionStateVectord::Zero());
+        ukf.init(PositionStateVectorX::Zero());
     }
 
 	virtual void init(const PositionFilterConstants &constants, const Eigen::Vector3f &initial_position_meters)
 	{
 		bIsValid = true;
 		bSeenPositionMeasurement = true;
+		consecutive_optical_rejects= 0;
 
 		origin_position_meters = Eigen::Vector3f::Zero();
 
-		PositionStateVectord state_vector = PositionStateVectord::Zero();
-		state_vector.set_position_meters(initial_position_meters.cast<double>());
+		PositionStateVectorX state_vector = PositionStateVectorX::Zero();
+		state_vector.set_position_meters(initial_position_meters.cast<FilterScalar>());
 
 		measurement_model.init(constants);
 		system_model.init(constants);
@@ -443,40 +539,59 @@ void KalmanPositionFilter::update(const float delta_time, const PoseFilterPacket
 		// Adjust the amount we trust the optical state based on the tracking projection area
 		m_filter->system_model.update_process_noise(m_constants, packet.tracking_projection_area_px_sqr);
 
+		// When profiling, time the sigma point transform on its own.
+		// predict() recomputes them internally so this doesn't alter the filter state.
+		if (FilterProfile::getIsEnabled())
+		{
+			FilterProfile::ScopeTimer timer(FilterProfile::Filter_KalmanPosition, FilterProfile::Stage_SigmaPointGeneration);
+
+			m_filter->ukf.computeSigmaPointsProfiled();
+		}
+
         // Predict state for current time-step using the filters
         m_filter->system_model.set_time_step(delta_time);
-        m_filter->ukf.predict(m_filter->system_model);
+		{
+			FilterProfile::ScopeTimer timer(FilterProfile::Filter_KalmanPosition, FilterProfile::Stage_Predict);
+
+#if BATCH_SIGMA_POINT_PROPAGATION
+			m_filter->ukf.predictLinear(
+				m_filter->system_model,
+				m_filter->system_model.getStateTransitionMatrix());
+#else
+			m_filter->ukf.predict(m_filter->system_model);
+#endif
+		}
 
         // Get the measurement model for the DS4 from the derived filter impl
         PositionMeasurementModel &measurement_model = m_filter->measurement_model;
 
 		// Update the measurement model with the latest controller orientation.
 		// This comes from the orientation filter, which ran before this filter.
-		Eigen::Quaterniond current_orientation= packet.current_orientation.cast<double>();
+		FilterQuaternion current_orientation= packet.current_orientation.cast<FilterScalar>();
 		measurement_model.set_current_orientation(current_orientation);
 
         // Project the current state onto a predicted measurement as a default
         // in case no observation is available
-        PositionMeasurementVectord measurement = measurement_model.h(m_filter->ukf.getState());
+        PositionMeasurementVectorX measurement = measurement_model.h(m_filter->ukf.getState());
 
-		Eigen::Vector3d accelerometer = packet.imu_accelerometer_g_units.cast<double>();
+		FilterVector3 accelerometer = packet.imu_accelerometer_g_units.cast<FilterScalar>();
 
 #if ACCELEROMETER_FIXUP_HACKS
 		// Hacks to deal with accelerometer measurement issues
 		{			
-			const double acc_magnitude = accelerometer.norm();
-			const double bias_tolerance = 0.1f;
-			const double alignment_tolerance = 0.984807753; // cos(10 degrees)
+			const FilterScalar acc_magnitude = accelerometer.norm();
+			const FilterScalar bias_tolerance = 0.1f;
+			const FilterScalar alignment_tolerance = 0.984807753; // cos(10 degrees)
 
-			const Eigen::Vector3d acc_local_g =
-				eigen_vector3d_clockwise_rotate(current_orientation, m_constants.gravity_calibration_direction.cast<double>());
+			const FilterVector3 acc_local_g =
+				eigen_vector3_clockwise_rotate(current_orientation, m_constants.gravity_calibration_direction.cast<FilterScalar>());
 
 			//###HipsterSloth $TODO If there is any error in our orientation we don't correctly subtract
 			// out the effect of gravity. This manifests as a phantom lateral linear acceleration 
 			// that drives the velocity in the direction of the bias.
 			// As a work around, we snap the accelerometer direction to the predicted gravity direction
 			// if it's within an angular tolerance of the predicted gravity direction
-			Eigen::Vector3d acc_normalized = accelerometer / acc_magnitude;
+			FilterVector3 acc_normalized = accelerometer / acc_magnitude;
 			if (acc_normalized.dot(acc_local_g) >= alignment_tolerance)
 			{
 				accelerometer = acc_local_g * acc_magnitude;
@@ -505,30 +620,94 @@ void KalmanPositionFilter::update(const float delta_time, const PoseFilterPacket
         if (packet.tracking_projection_area_px_sqr > 0.f)
         {
 			Eigen::Vector3f optical_position_meters= packet.get_optical_position_in_meters();
+			const FilterVector3 optical_position= optical_position_meters.cast<FilterScalar>();
+			bool bAcceptMeasurement= true;
 
-            // State internally stores position in meters
-            measurement.set_optical_position_meters(optical_position_meters.cast<double>());
+			if (m_filter->bSeenPositionMeasurement)
+			{
+				// Gate the optical measurement on its innovation before it can
+				// poison the state. The measurement vector still holds the
+				// predicted optical position from h() at this point, so the
+				// innovation falls straight out of it.
+				const FilterVector3 innovation=
+					optical_position - measurement.get_optical_position_meters();
+				const FilterScalar innovation_sqr= innovation.squaredNorm();
+				const FilterScalar measurement_variance_m_sqr=
+					k_centimeters_to_meters*k_centimeters_to_meters*
+					static_cast<FilterScalar>(
+						m_constants.position_variance_curve.evaluateLUT(packet.tracking_projection_area_px_sqr));
+
+				// Cheap scalar pre-check: the innovation variance is at least
+				// the measurement variance, so anything inside the gate radius
+				// of the measurement noise alone is accepted without touching
+				// the state covariance at all
+				if (innovation_sqr > k_optical_gate_chi_sqr*measurement_variance_m_sqr)
+				{
+					// Borderline innovation - approximate the Mahalanobis
+					// distance per axis against the predicted innovation
+					// variance (state position variance plus measurement
+					// variance), skipping the dense cross terms
+					const Kalman::Covariance<PositionStateVectorX> P= m_filter->ukf.getCovariance();
+					FilterScalar mahalanobis_d_sqr= 0.0;
+
+					for (int axis= 0; axis < 3; ++axis)
+					{
+						const int state_index= POSITION_X + 3*axis;
+						const FilterScalar innovation_variance=
+							P(state_index, state_index) + measurement_variance_m_sqr;
+
+						mahalanobis_d_sqr+= innovation(axis)*innovation(axis) / innovation_variance;
+					}
+
+					bAcceptMeasurement= mahalanobis_d_sqr <= k_optical_gate_chi_sqr;
+				}
+
+				// A teleported controller is indistinguishable from a string
+				// of outliers - stop rejecting and re-converge on the new spot
+				if (!bAcceptMeasurement &&
+					m_filter->consecutive_optical_rejects >= k_optical_gate_max_consecutive_rejects)
+				{
+					bAcceptMeasurement= true;
+				}
+			}
 
-			// If this is the first time we have seen the position, snap the position state
-			if (!m_filter->bSeenPositionMeasurement)
+			if (bAcceptMeasurement)
 			{
-				m_filter->ukf.getStateMutable().set_position_meters(optical_position_meters.cast<double>());
-				m_filter->bSeenPositionMeasurement= true;
+				// State internally stores position in meters
+				measurement.set_optical_position_meters(optical_position);
+				m_filter->consecutive_optical_rejects= 0;
+
+				// If this is the first time we have seen the position, snap the position state
+				if (!m_filter->bSeenPositionMeasurement)
+				{
+					m_filter->ukf.getStateMutable().set_position_meters(optical_position);
+					m_filter->bSeenPositionMeasurement= true;
+				}
+			}
+			else
+			{
+				// Leave the optical slot at the predicted measurement so the
+				// update sees zero optical innovation (IMU-only this tick)
+				++m_filter->consecutive_optical_rejects;
 			}
         }
 
         // Update UKF
-        m_filter->ukf.update(measurement_model, measurement);
+		{
+			FilterProfile::ScopeTimer timer(FilterProfile::Filter_KalmanPosition, FilterProfile::Stage_MeasurementUpdate);
+
+			m_filter->ukf.update(measurement_model, measurement);
+		}
     }
     else
     {
-		PositionStateVectord state_vector = PositionStateVectord::Zero();
+		PositionStateVectorX state_vector = PositionStateVectorX::Zero();
 
 		if (packet.tracking_projection_area_px_sqr > 0.f)
 		{
 			Eigen::Vector3f optical_position_meters= packet.get_optical_position_in_meters();
 
-			state_vector.set_position_meters(optical_position_meters.cast<double>());
+			state_vector.set_position_meters(optical_position_meters.cast<FilterScalar>());
 			m_filter->bSeenPositionMeasurement= true;
 		}
 
@@ -551,6 +730,56 @@ void KalmanPositionFilter::recenterOrientation(const Eigen::Quaternionf& q_pose)
 {
 }
 
+bool KalmanPositionFilter::getConvergedState(std::vector<double> &out_values) const
+{
+	if (m_filter == nullptr || !m_filter->bIsValid)
+	{
+		return false;
+	}
+
+	// Flatten the converged state covariance row-major so that it can be
+	// persisted in the controller config and used to warm-start the filter
+	// on the next service startup
+	const Kalman::Covariance<PositionStateVectorX> P = m_filter->ukf.getCovariance();
+	const int state_dimension = static_cast<int>(P.rows());
+
+	out_values.clear();
+	out_values.reserve(state_dimension*state_dimension);
+	for (int row = 0; row < state_dimension; ++row)
+	{
+		for (int col = 0; col < state_dimension; ++col)
+		{
+			out_values.push_back(P(row, col));
+		}
+	}
+
+	return true;
+}
+
+bool KalmanPositionFilter::setConvergedState(const std::vector<double> &values)
+{
+	const int state_dimension = static_cast<int>(PositionStateVectorX::RowsAtCompileTime);
+
+	if (m_filter == nullptr ||
+		values.size() != static_cast<size_t>(state_dimension*state_dimension))
+	{
+		return false;
+	}
+
+	Kalman::Covariance<PositionStateVectorX> P;
+	for (int row = 0; row < state_dimension; ++row)
+	{
+		for (int col = 0; col < state_dimension; ++col)
+		{
+			P(row, col) = static_cast<FilterScalar>(values[row*state_dimension + col]);
+		}
+	}
+
+	// setCovariance() re-derives the covariance square root and fails if the
+	// persisted matrix isn't positive definite (e.g. a hand-edited config)
+	return m_filter->ukf.setCovariance(P);
+}
+
 Eigen::Vector3f KalmanPositionFilter::getPositionCm(float time) const
 {
     Eigen::Vector3f result = Eigen::Vector3f::Zero();
@@ -559,10 +788,16 @@ Eigen::Vector3f KalmanPositionFilter::getPositionCm(float time) const
     {
         Eigen::Vector3f state_position_meters= m_filter->ukf.getState().get_position_meters().cast<float>();
 		Eigen::Vector3f state_velocity_m_per_sec = m_filter->ukf.getState().get_linear_velocity_m_per_sec().cast<float>();
+		Eigen::Vector3f state_accel_m_per_sec_sqr = m_filter->ukf.getState().get_linear_acceleration_m_per_sec_sqr().cast<float>();
+
+		// Constant-acceleration extrapolation of the filter state so that
+		// clients can request poses at photon time without rolling their own
         Eigen::Vector3f predicted_position =
             is_nearly_zero(time)
             ? state_position_meters
-            : state_position_meters + state_velocity_m_per_sec * time;
+            : state_position_meters
+              + state_velocity_m_per_sec * time
+              + state_accel_m_per_sec_sqr * (0.5f * time * time);
 
         result = (predicted_position - m_filter->origin_position_meters) * k_meters_to_centimeters;
     }
@@ -572,14 +807,14 @@ Eigen::Vector3f KalmanPositionFilter::getPositionCm(float time) const
 
 Eigen::Vector3f KalmanPositionFilter::getVelocityCmPerSec() const
 {
-	Eigen::Vector3d vel= m_filter->ukf.getState().get_linear_velocity_m_per_sec() * k_meters_to_centimeters;
+	FilterVector3 vel= m_filter->ukf.getState().get_linear_velocity_m_per_sec() * k_meters_to_centimeters;
 
     return vel.cast<float>();
 }
 
 Eigen::Vector3f KalmanPositionFilter::getAccelerationCmPerSecSqr() const
 {
-    Eigen::Vector3d accel= m_filter->ukf.getState().get_linear_acceleration_m_per_sec_sqr() * k_meters_to_centimeters;
+    FilterVector3 accel= m_filter->ukf.getState().get_linear_acceleration_m_per_sec_sqr() * k_meters_to_centimeters;
 
 	return accel.cast<float>();
 }
@@ -596,19 +831,19 @@ Eigen::Vector3f KalmanPositionFilter::getAccelerationCmPerSecSqr() const
 // In other words, G = [[.5dt^2][dt][1]] ^ T for the constant linear acceleration model.
 template <class StateType>
 void Q_discrete_3rd_order_white_noise(
-    const double dT,
-    const double var,
+    const FilterScalar dT,
+    const FilterScalar var,
     const int state_index,
     Kalman::Covariance<StateType> &Q)
 {
-    const double dT_2 = dT*dT;
-	const double dT_3 = dT_2*dT;
-	const double dT_4 = dT_2*dT_2;
-
-    const double q4 = var * dT_4;
-    const double q3 = var * dT_3;
-	const double q2 = var * dT_2;
-	const double q1 = var * dT;
+    const FilterScalar dT_2 = dT*dT;
+	const FilterScalar dT_3 = dT_2*dT;
+	const FilterScalar dT_4 = dT_2*dT_2;
+
+    const FilterScalar q4 = var * dT_4;
+    const FilterScalar q3 = var * dT_3;
+	const FilterScalar q2 = var * dT_2;
+	const FilterScalar q1 = var * dT;
 
     const int &i= state_index;
     Q(i+0,i+0) = 0.25*q4; Q(i+0,i+1) = 0.5*q3; Q(i+0,i+2) = 0.5*q2;
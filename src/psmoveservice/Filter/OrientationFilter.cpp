@@ -2,6 +2,7 @@
 #include "OrientationFilter.h"
 #include "MathAlignment.h"
 #include "ServerLog.h"
+#include <assert.h>
 #include <deque>
 
 //-- constants -----
@@ -11,6 +12,25 @@
 // Complementary MARG Filter constants
 #define k_base_earth_frame_align_weight 0.02f
 
+// Longest interval (in update ticks) the magnetometer alignment may be decimated to
+#define k_mg_decimation_max_interval 8
+
+// Bound on the heading error the gyro may accumulate between magnetometer alignments
+#define k_mg_max_drift_per_update_radians (0.25f * k_degrees_to_radians)
+
+// Smoothing fraction for the observed gyro drift rate estimate
+#define k_mg_drift_rate_smoothing 0.1f
+
+// One-euro optical orientation filter tuning (see PositionFilter.cpp for the
+// position equivalent): the smoothing cutoff floor, how much the cutoff opens
+// up per rad/s of motion above the optical noise floor, the cutoff used to
+// smooth the angular speed the adaptation is driven by, and the bound on the
+// output lag in standard deviations of the calibrated optical noise
+#define k_one_euro_min_cutoff 1.0f // Hz
+#define k_one_euro_beta 2.0f // Hz per rad/s
+#define k_one_euro_derivative_cutoff 1.0f // Hz
+#define k_one_euro_max_deviation_sigma 3.f
+
 // Max length of the orientation history we keep
 #define k_orientation_history_max 16
 
@@ -76,6 +96,99 @@ struct OrientationFilterState
     }
 };
 
+/// Structure-of-arrays workspace for the Madgwick gradient step (Eqn 15, 21 & 34).
+/// Each lane holds one (reference direction, measured direction) error term and all
+/// lanes are evaluated together as 4-wide float arithmetic, so the gravity and
+/// magnetometer terms of a MARG update cost one pass instead of two matrix builds.
+struct MadgwickGradientBatch
+{
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    static const int k_max_lanes= 4;
+
+    // Orientation per lane (earth frame to sensor frame)
+    Eigen::Array4f qw, qx, qy, qz;
+
+    // Reference field direction in the identity pose per lane
+    Eigen::Array4f dx, dy, dz;
+
+    // Measured field direction in the sensor frame per lane
+    Eigen::Array4f sx, sy, sz;
+
+    int lane_count;
+
+    MadgwickGradientBatch()
+    {
+        clear();
+    }
+
+    void clear()
+    {
+        qw= qx= qy= qz= Eigen::Array4f::Zero();
+        dx= dy= dz= Eigen::Array4f::Zero();
+        sx= sy= sz= Eigen::Array4f::Zero();
+        lane_count= 0;
+    }
+
+    void addErrorTerm(
+        const Eigen::Quaternionf &q, const Eigen::Vector3f &d, const Eigen::Vector3f &s)
+    {
+        assert(lane_count < k_max_lanes);
+        qw[lane_count]= q.w(); qx[lane_count]= q.x(); qy[lane_count]= q.y(); qz[lane_count]= q.z();
+        dx[lane_count]= d.x(); dy[lane_count]= d.y(); dz[lane_count]= d.z();
+        sx[lane_count]= s.x(); sy[lane_count]= s.y(); sz[lane_count]= s.z();
+        ++lane_count;
+    }
+
+    Eigen::Quaternionf computeGradient() const
+    {
+        // Eqn 15) f(SEq, d, s) = (SEq^-1*d*SEq) - s
+        // Rotate every lane's reference direction into the sensor frame at once
+        // using v' = d - 2*qw*(qv x d) + 2*(qv x (qv x d))
+        const Eigen::Array4f cx= qy*dz - qz*dy;
+        const Eigen::Array4f cy= qz*dx - qx*dz;
+        const Eigen::Array4f cz= qx*dy - qy*dx;
+
+        const Eigen::Array4f ccx= qy*cz - qz*cy;
+        const Eigen::Array4f ccy= qz*cx - qx*cz;
+        const Eigen::Array4f ccz= qx*cy - qy*cx;
+
+        const Eigen::Array4f f_x= dx - 2.f*(qw*cx - ccx) - sx;
+        const Eigen::Array4f f_y= dy - 2.f*(qw*cy - ccy) - sy;
+        const Eigen::Array4f f_z= dz - 2.f*(qw*cz - ccz) - sz;
+
+        // Eqn 21 & 34) gradient= J^T(SEq, d)*f(SEq, d, s), with the Jacobian
+        // product expanded per lane. Idle lanes have d= s= 0 and contribute
+        // a zero gradient, so no masking is needed.
+        const Eigen::Array4f two_dxqw= 2.f*dx*qw;
+        const Eigen::Array4f two_dxqx= 2.f*dx*qx;
+        const Eigen::Array4f two_dxqy= 2.f*dx*qy;
+        const Eigen::Array4f two_dxqz= 2.f*dx*qz;
+
+        const Eigen::Array4f two_dyqw= 2.f*dy*qw;
+        const Eigen::Array4f two_dyqx= 2.f*dy*qx;
+        const Eigen::Array4f two_dyqy= 2.f*dy*qy;
+        const Eigen::Array4f two_dyqz= 2.f*dy*qz;
+
+        const Eigen::Array4f two_dzqw= 2.f*dz*qw;
+        const Eigen::Array4f two_dzqx= 2.f*dz*qx;
+        const Eigen::Array4f two_dzqy= 2.f*dz*qy;
+        const Eigen::Array4f two_dzqz= 2.f*dz*qz;
+
+        const Eigen::Array4f grad_w=
+            (two_dyqz - two_dzqy)*f_x + (two_dzqx - two_dxqz)*f_y + (two_dxqy - two_dyqx)*f_z;
+        const Eigen::Array4f grad_x=
+            (two_dyqy + two_dzqz)*f_x + (two_dxqy - 2.f*two_dyqx + two_dzqw)*f_y + (two_dxqz - two_dyqw - 2.f*two_dzqx)*f_z;
+        const Eigen::Array4f grad_y=
+            (-2.f*two_dxqy + two_dyqx - two_dzqw)*f_x + (two_dxqx + two_dzqz)*f_y + (two_dxqw + two_dyqz - 2.f*two_dzqy)*f_z;
+        const Eigen::Array4f grad_z=
+            (-2.f*two_dxqz + two_dyqw + two_dzqx)*f_x + (-two_dxqw - 2.f*two_dyqz + two_dzqy)*f_y + (two_dxqx + two_dyqy)*f_z;
+
+        // Sum the per lane gradients into the net quaternion gradient
+        return Eigen::Quaternionf(grad_w.sum(), grad_x.sum(), grad_y.sum(), grad_z.sum());
+    }
+};
+
 // -- public interface -----
 //-- Orientation Filter --
 OrientationFilter::OrientationFilter() :
@@ -136,12 +249,14 @@ Eigen::Quaternionf OrientationFilter::getOrientation(float time) const
 
         if (fabsf(time) > k_real_epsilon)
         {
-            const Eigen::Quaternionf &quaternion_derivative=
-                eigen_angular_velocity_to_quaternion_derivative(m_state->orientation, m_state->angular_velocity);
-
-            predicted_orientation= Eigen::Quaternionf(
-                m_state->orientation.coeffs()
-                + quaternion_derivative.coeffs()*time).normalized();
+            // Integrate the angular velocity over the prediction horizon with
+            // the quaternion exponential map (the same step the filters use to
+            // propagate state) - exact for constant angular velocity, where a
+            // single Euler step on the quaternion derivative drifts with time
+            const Eigen::Quaternionf q_delta=
+                eigen_angle_axis_to_quaternion(m_state->angular_velocity * time);
+
+            predicted_orientation= (m_state->orientation * q_delta).normalized();
         }
 
         result = m_state->reset_orientation * predicted_orientation;
@@ -204,21 +319,11 @@ void OrientationFilterMadgwickARG::update(const float delta_time, const PoseFilt
         // Get the direction of the gravitational fields in the identity pose		
         Eigen::Vector3f k_identity_g_direction = m_constants.gravity_calibration_direction;
 
-        // Eqn 15) Applied to the gravity vector
-        // Fill in the 3x1 objective function matrix f(SEq, Sa) =|f_g|
-        Eigen::Matrix<float, 3, 1> f_g;
-        eigen_alignment_compute_objective_vector(SEq, k_identity_g_direction, current_g, f_g, NULL);
-
-        // Eqn 21) Applied to the gravity vector
-        // Fill in the 4x3 objective function Jacobian matrix: J_gb(SEq)= [J_g]
-        Eigen::Matrix<float, 4, 3> J_g;
-        eigen_alignment_compute_objective_jacobian(SEq, k_identity_g_direction, J_g);
-
-        // Eqn 34) gradient_F= J_g(SEq)*f(SEq, Sa)
-        // Compute the gradient of the objective function
-        Eigen::Matrix<float, 4, 1> gradient_f = J_g * f_g;
-        Eigen::Quaternionf SEqHatDot =
-            Eigen::Quaternionf(gradient_f(0, 0), gradient_f(1, 0), gradient_f(2, 0), gradient_f(3, 0));
+        // Eqn 15, 21 & 34) Applied to the gravity vector
+        // Compute the objective function error and its gradient in one vectorized pass
+        MadgwickGradientBatch gradient_batch;
+        gradient_batch.addErrorTerm(SEq, k_identity_g_direction, current_g);
+        Eigen::Quaternionf SEqHatDot = gradient_batch.computeGradient();
 
         // normalize the gradient
         eigen_quaternion_normalize_with_default(SEqHatDot, *k_eigen_quaternion_zero);
@@ -261,6 +366,37 @@ void OrientationFilterMadgwickMARG::resetState()
     m_omega_bias_x= m_omega_bias_y= m_omega_bias_z= 0.f;
 }
 
+bool OrientationFilterMadgwickMARG::getConvergedState(std::vector<double> &out_values) const
+{
+    if (!getIsStateValid())
+    {
+        return false;
+    }
+
+    // The gyro bias estimate converges slowly, so persisting it across
+    // service restarts saves the reconvergence time on the next startup
+    out_values.clear();
+    out_values.push_back(static_cast<double>(m_omega_bias_x));
+    out_values.push_back(static_cast<double>(m_omega_bias_y));
+    out_values.push_back(static_cast<double>(m_omega_bias_z));
+
+    return true;
+}
+
+bool OrientationFilterMadgwickMARG::setConvergedState(const std::vector<double> &values)
+{
+    if (values.size() != 3)
+    {
+        return false;
+    }
+
+    m_omega_bias_x= static_cast<float>(values[0]);
+    m_omega_bias_y= static_cast<float>(values[1]);
+    m_omega_bias_z= static_cast<float>(values[2]);
+
+    return true;
+}
+
 void OrientationFilterMadgwickMARG::update(const float delta_time, const PoseFilterPacket &packet)
 {
     const Eigen::Vector3f &current_omega= packet.imu_gyroscope_rad_per_sec;
@@ -291,35 +427,13 @@ void OrientationFilterMadgwickMARG::update(const float delta_time, const PoseFil
     // Get the direction of the gravitational fields in the identity pose
     Eigen::Vector3f k_identity_g_direction = m_constants.gravity_calibration_direction;
 
-    // Eqn 15) Applied to the gravity and magnetometer vectors
-    // Fill in the 6x1 objective function matrix f(SEq, Sa, Eb, Sm) =|f_g|
-    //                                                               |f_b|
-    Eigen::Matrix<float, 3, 1> f_g;
-    eigen_alignment_compute_objective_vector(SEq, k_identity_g_direction, current_g, f_g, NULL);
-
-    Eigen::Matrix<float, 3, 1> f_m;
-    eigen_alignment_compute_objective_vector(SEq, k_identity_m_direction, current_m, f_m, NULL);
-
-    Eigen::Matrix<float, 6, 1> f_gb;
-    f_gb.block<3, 1>(0, 0) = f_g;
-    f_gb.block<3, 1>(3, 0) = f_m;
-
-    // Eqn 21) Applied to the gravity and magnetometer vectors
-    // Fill in the 4x6 objective function Jacobian matrix: J_gb(SEq, Eb)= [J_g|J_b]
-    Eigen::Matrix<float, 4, 3> J_g;
-    eigen_alignment_compute_objective_jacobian(SEq, k_identity_g_direction, J_g);
-
-    Eigen::Matrix<float, 4, 3> J_m;
-    eigen_alignment_compute_objective_jacobian(SEq, k_identity_m_direction, J_m);
-
-    Eigen::Matrix<float, 4, 6> J_gb;
-    J_gb.block<4, 3>(0, 0) = J_g; J_gb.block<4, 3>(0, 3) = J_m;
-
-    // Eqn 34) gradient_F= J_gb(SEq, Eb)*f(SEq, Sa, Eb, Sm)
-    // Compute the gradient of the objective function
-    Eigen::Matrix<float, 4, 1> gradient_f = J_gb*f_gb;
-    Eigen::Quaternionf SEqHatDot =
-        Eigen::Quaternionf(gradient_f(0, 0), gradient_f(1, 0), gradient_f(2, 0), gradient_f(3, 0));
+    // Eqn 15, 21 & 34) Applied to the gravity and magnetometer vectors
+    // Compute both objective function error terms and the summed gradient
+    // in one vectorized pass (one SIMD lane per error term)
+    MadgwickGradientBatch gradient_batch;
+    gradient_batch.addErrorTerm(SEq, k_identity_g_direction, current_g);
+    gradient_batch.addErrorTerm(SEq, k_identity_m_direction, current_m);
+    Eigen::Quaternionf SEqHatDot = gradient_batch.computeGradient();
 
     // normalize the gradient to estimate direction of the gyroscope error
     eigen_quaternion_normalize_with_default(SEqHatDot, *k_eigen_quaternion_zero);
@@ -396,21 +510,11 @@ void OrientationFilterComplementaryOpticalARG::update(const float delta_time, co
         // Get the direction of the gravitational fields in the identity pose		
         Eigen::Vector3f k_identity_g_direction = m_constants.gravity_calibration_direction;
 
-        // Eqn 15) Applied to the gravity vector
-        // Fill in the 3x1 objective function matrix f(SEq, Sa) =|f_g|
-        Eigen::Matrix<float, 3, 1> f_g;
-        eigen_alignment_compute_objective_vector(SEq, k_identity_g_direction, current_g, f_g, NULL);
-
-        // Eqn 21) Applied to the gravity vector
-        // Fill in the 4x3 objective function Jacobian matrix: J_gb(SEq)= [J_g]
-        Eigen::Matrix<float, 4, 3> J_g;
-        eigen_alignment_compute_objective_jacobian(SEq, k_identity_g_direction, J_g);
-
-        // Eqn 34) gradient_F= J_g(SEq)*f(SEq, Sa)
-        // Compute the gradient of the objective function
-        Eigen::Matrix<float, 4, 1> gradient_f = J_g * f_g;
-        Eigen::Quaternionf SEqHatDot =
-            Eigen::Quaternionf(gradient_f(0, 0), gradient_f(1, 0), gradient_f(2, 0), gradient_f(3, 0));
+        // Eqn 15, 21 & 34) Applied to the gravity vector
+        // Compute the objective function error and its gradient in one vectorized pass
+        MadgwickGradientBatch gradient_batch;
+        gradient_batch.addErrorTerm(SEq, k_identity_g_direction, current_g);
+        Eigen::Quaternionf SEqHatDot = gradient_batch.computeGradient();
 
         // normalize the gradient
         eigen_quaternion_normalize_with_default(SEqHatDot, *k_eigen_quaternion_zero);
@@ -439,7 +543,7 @@ void OrientationFilterComplementaryOpticalARG::update(const float delta_time, co
         // The final rotation is a blend between the integrated orientation and absolute optical orientation
 		const float fraction_of_max_orientation_variance =
 			safe_divide_with_default(
-				m_constants.orientation_variance_curve.evaluate(packet.tracking_projection_area_px_sqr),
+				m_constants.orientation_variance_curve.evaluateLUT(packet.tracking_projection_area_px_sqr),
 				m_constants.orientation_variance_curve.MaxValue,
 				1.f);
 		const float optical_orientation_quality = clampf01(1.f - fraction_of_max_orientation_variance);
@@ -484,6 +588,10 @@ void OrientationFilterComplementaryMARG::resetState()
 {
     OrientationFilter::resetState();
     mg_weight= 1.f;
+    mg_update_interval_ticks= 1;
+    ticks_since_mg_update= 0;
+    mg_skipped_update_count= 0;
+    observed_drift_rad_per_sec= 0.f;
 }
 
 void OrientationFilterComplementaryMARG::update(const float delta_time, const PoseFilterPacket &packet)
@@ -519,6 +627,28 @@ void OrientationFilterComplementaryMARG::update(const float delta_time, const Po
     // Make sure the resulting quaternion is normalized
     ar_orientation.normalize();
 
+    // Magnetometer Decimation
+    //------------------------
+    // Heading drift accumulates slowly, so once the filter has converged the
+    // Mag-Grav alignment doesn't need to run every tick. While the auto-tuned
+    // interval hasn't elapsed, carry the orientation forward from the gyro
+    // integration alone and skip the alignment solve entirely.
+    // While mg_weight is still decaying from a state reset we fuse every tick
+    // so that convergence isn't slowed down.
+    ++ticks_since_mg_update;
+
+    const bool bConverging= mg_weight > 2.f*k_base_earth_frame_align_weight;
+
+    if (!bConverging && ticks_since_mg_update < mg_update_interval_ticks)
+    {
+        const Eigen::Vector3f new_angular_velocity= Eigen::Vector3f::Zero();
+        const Eigen::Vector3f new_angular_acceleration= Eigen::Vector3f::Zero();
+
+        m_state->apply_state(ar_orientation, new_angular_velocity, new_angular_acceleration);
+        ++mg_skipped_update_count;
+        return;
+    }
+
     // Magnetic/Gravity (MG) Update
     //-----------------------------
     const Eigen::Vector3f* mg_from[2] = { &k_identity_g_direction, &k_identity_m_direction };
@@ -536,16 +666,148 @@ void OrientationFilterComplementaryMARG::update(const float delta_time, const Po
     // Save the new quaternion and first derivative back into the orientation state
     // Derive the second derivative
     {
+        // Scale the blend authority to cover every tick integrated since the last
+        // alignment so the correction rate is independent of the decimation interval:
+        // 1-(1-w)^n is the weight n consecutive per-tick blends would have applied
+        const float effective_mg_weight=
+            1.f - powf(1.f - mg_weight, static_cast<float>(ticks_since_mg_update));
+
         // The final rotation is a blend between the integrated orientation and absolute rotation from the earth-frame
-        const Eigen::Quaternionf new_orientation = 
-            eigen_quaternion_normalized_lerp(ar_orientation, mg_orientation, mg_weight);            
+        const Eigen::Quaternionf new_orientation =
+            eigen_quaternion_normalized_lerp(ar_orientation, mg_orientation, effective_mg_weight);
         const Eigen::Vector3f new_angular_velocity= Eigen::Vector3f::Zero(); // current_omega;
         const Eigen::Vector3f new_angular_acceleration = Eigen::Vector3f::Zero(); // (current_omega - m_state->angular_velocity) / delta_time;
 
         m_state->apply_state(new_orientation, new_angular_velocity, new_angular_acceleration);
     }
 
+    // Re-tune the decimation interval against the drift the gyro actually accumulated.
+    // The angle of the correction the alignment wanted to apply is the heading error
+    // the AR integration picked up since the last magnetometer update.
+    if (!bConverging && delta_time > k_real_epsilon)
+    {
+        const float interval_seconds= delta_time*static_cast<float>(ticks_since_mg_update);
+        const float correction_radians= fabsf(ar_orientation.angularDistance(mg_orientation));
+
+        observed_drift_rad_per_sec=
+            lerp_clampf(observed_drift_rad_per_sec, correction_radians / interval_seconds, k_mg_drift_rate_smoothing);
+
+        // Pick the longest interval whose expected accumulated drift stays within
+        // bound: tight while the gyro is drifting, relaxed once it's stable
+        if (observed_drift_rad_per_sec > k_real_epsilon)
+        {
+            const float unclamped_interval=
+                k_mg_max_drift_per_update_radians / (observed_drift_rad_per_sec * delta_time);
+
+            mg_update_interval_ticks=
+                static_cast<int>(clampf(unclamped_interval, 1.f, static_cast<float>(k_mg_decimation_max_interval)));
+        }
+        else
+        {
+            mg_update_interval_ticks= k_mg_decimation_max_interval;
+        }
+    }
+
+    ticks_since_mg_update= 0;
+
     // Update the blend weight
     // -- Exponential blend the MG weight from 1 down to k_base_earth_frame_align_weight
     mg_weight = lerp_clampf(mg_weight, k_base_earth_frame_align_weight, 0.9f);
+}
+
+bool OrientationFilterComplementaryMARG::getMagnetometerDecimationState(
+    int &out_update_interval_ticks, int &out_skipped_update_count) const
+{
+    out_update_interval_ticks= mg_update_interval_ticks;
+    out_skipped_update_count= mg_skipped_update_count;
+
+    return true;
+}
+
+// -- OrientationFilterOneEuroOptical --
+// https://en.wikipedia.org/wiki/Low-pass_filter
+static float lowpass_filter_alpha(const float delta_time, const float cutoff_frequency)
+{
+    const float RC= 1.f/(k_real_two_pi*cutoff_frequency);
+
+    return clampf01(delta_time / (RC + delta_time));
+}
+
+void OrientationFilterOneEuroOptical::resetState()
+{
+    OrientationFilter::resetState();
+    bDerivative_valid= false;
+    smoothed_optical_speed_rad_per_sec= 0.f;
+}
+
+void OrientationFilterOneEuroOptical::update(const float delta_time, const PoseFilterPacket &packet)
+{
+    if (packet.tracking_projection_area_px_sqr <= k_real_epsilon ||
+        !eigen_quaternion_is_valid(packet.optical_orientation))
+    {
+        // Not optically tracked - integrate the gyro to carry the orientation forward
+        // q_new= q + 0.5*q*omega*dT
+        const Eigen::Vector3f &current_omega= packet.imu_gyroscope_rad_per_sec;
+        const Eigen::Quaternionf q_current= m_state->orientation;
+
+        Eigen::Quaternionf q_omega = Eigen::Quaternionf(0.f, current_omega.x(), current_omega.y(), current_omega.z());
+        Eigen::Quaternionf q_derivative = Eigen::Quaternionf(q_current.coeffs()*0.5f) * q_omega;
+        Eigen::Quaternionf ar_orientation =
+            Eigen::Quaternionf(q_current.coeffs() + q_derivative.coeffs()*delta_time);
+
+        ar_orientation.normalize();
+
+        m_state->apply_state(ar_orientation, Eigen::Vector3f::Zero(), Eigen::Vector3f::Zero());
+        bDerivative_valid= false;
+        return;
+    }
+
+    const Eigen::Quaternionf &optical_orientation= packet.optical_orientation;
+    Eigen::Quaternionf new_orientation= optical_orientation;
+
+    if (m_state->bIsValid && delta_time > k_real_epsilon)
+    {
+        // Standard deviation of the optical orientation noise at the current
+        // projection area, from the optical noise calibration
+        const float orientation_sigma_radians=
+            sqrtf(m_constants.orientation_variance_curve.evaluateLUT(packet.tracking_projection_area_px_sqr));
+
+        // Low pass the angular speed so the cutoff adaptation doesn't chase
+        // per-sample jitter
+        const float raw_speed_rad_per_sec=
+            fabsf(m_state->orientation.angularDistance(optical_orientation)) / delta_time;
+        const float derivative_alpha= lowpass_filter_alpha(delta_time, k_one_euro_derivative_cutoff);
+
+        smoothed_optical_speed_rad_per_sec=
+            bDerivative_valid
+            ? smoothed_optical_speed_rad_per_sec +
+                (raw_speed_rad_per_sec - smoothed_optical_speed_rad_per_sec)*derivative_alpha
+            : raw_speed_rad_per_sec;
+        bDerivative_valid= true;
+
+        // Ignore the part of the apparent speed the noise model explains
+        const float noise_speed_rad_per_sec= orientation_sigma_radians / delta_time;
+        const float speed_above_noise=
+            fmaxf(smoothed_optical_speed_rad_per_sec - noise_speed_rad_per_sec, 0.f);
+
+        // The cutoff opens up with speed: heavy smoothing at rest,
+        // responsive in motion
+        const float cutoff_hz= k_one_euro_min_cutoff + k_one_euro_beta*speed_above_noise;
+        const float position_alpha= lowpass_filter_alpha(delta_time, cutoff_hz);
+
+        new_orientation= m_state->orientation.slerp(position_alpha, optical_orientation);
+
+        // Validate the output against the raw sample: never lag the
+        // measurement by more than the calibrated noise envelope allows
+        const float deviation_radians= fabsf(new_orientation.angularDistance(optical_orientation));
+        const float max_deviation_radians= k_one_euro_max_deviation_sigma*orientation_sigma_radians;
+
+        if (deviation_radians > max_deviation_radians && deviation_radians > k_real_epsilon)
+        {
+            new_orientation=
+                optical_orientation.slerp(max_deviation_radians / deviation_radians, new_orientation);
+        }
+    }
+
+    m_state->apply_state(new_orientation, Eigen::Vector3f::Zero(), Eigen::Vector3f::Zero());
 }
\ No newline at end of file
@@ -56,6 +56,8 @@ public:
 
     void resetState() override;
     void update(const float delta_time, const PoseFilterPacket &packet) override;
+    bool getConvergedState(std::vector<double> &out_values) const override;
+    bool setConvergedState(const std::vector<double> &values) override;
 
 protected:
     float m_omega_bias_x;
@@ -79,13 +81,50 @@ public:
     OrientationFilterComplementaryMARG()
         : OrientationFilter()
         , mg_weight(1.f)
+        , mg_update_interval_ticks(1)
+        , ticks_since_mg_update(0)
+        , mg_skipped_update_count(0)
+        , observed_drift_rad_per_sec(0.f)
     {}
 
     void resetState() override;
     void update(const float delta_time, const PoseFilterPacket &packet) override;
+    bool getMagnetometerDecimationState(
+        int &out_update_interval_ticks, int &out_skipped_update_count) const override;
 
 protected:
     float mg_weight;
+
+    // Magnetometer decimation state. The Mag-Grav alignment only runs every
+    // mg_update_interval_ticks ticks, auto-tuned against the heading drift the
+    // gyro integration is observed to accumulate between alignments.
+    int mg_update_interval_ticks;
+    int ticks_since_mg_update;
+    int mg_skipped_update_count;
+    float observed_drift_rad_per_sec;
+};
+
+/// One-euro adaptive low pass filter over the optical orientation.
+/// The smoothing cutoff opens up with angular speed, with the noise floor
+/// taken from the optical noise calibration at the current projection area.
+/// Falls back to gyro integration while the controller isn't tracked
+/// optically. The cheap counterpart to PositionFilterOneEuro for stations
+/// that can't afford the Kalman filter.
+class OrientationFilterOneEuroOptical : public OrientationFilter
+{
+public:
+    OrientationFilterOneEuroOptical()
+        : OrientationFilter()
+        , bDerivative_valid(false)
+        , smoothed_optical_speed_rad_per_sec(0.f)
+    {}
+
+    void resetState() override;
+    void update(const float delta_time, const PoseFilterPacket &packet) override;
+
+protected:
+    bool bDerivative_valid;
+    float smoothed_optical_speed_rad_per_sec;
 };
 
 #endif // ORIENTATION_FILTER_H
\ No newline at end of file
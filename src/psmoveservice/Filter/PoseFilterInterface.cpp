@@ -1,6 +1,9 @@
 // -- includes --
 #include "PoseFilterInterface.h"
 
+#include <algorithm>
+#include <assert.h>
+
 // -- constants --
 // Calibration Pose transform
 const Eigen::Matrix3f g_eigen_identity_pose_upright = Eigen::Matrix3f::Identity();
@@ -17,6 +20,162 @@ const Eigen::Matrix3f g_eigen_sensor_transform_opengl((Eigen::Matrix3f() << 1,0,
 const Eigen::Matrix3f *k_eigen_sensor_transform_opengl= &g_eigen_sensor_transform_opengl;
 
 // -- public interface -----
+//-- Pose Sensor Packet Queue -----
+PoseSensorPacketQueue::PoseSensorPacketQueue()
+{
+    clear();
+}
+
+void PoseSensorPacketQueue::clear()
+{
+    m_accelerometer_sum= Eigen::Vector3f::Zero();
+    m_magnetometer_sum= Eigen::Vector3f::Zero();
+    m_gyroscope_sum= Eigen::Vector3f::Zero();
+    m_time_delta_sum= 0.f;
+    m_sample_count= 0;
+}
+
+void PoseSensorPacketQueue::enqueueImuSample(
+    const PoseSensorPacket &sensorPacket,
+    const float delta_time)
+{
+    m_accelerometer_sum+= sensorPacket.imu_accelerometer_g_units;
+    m_magnetometer_sum+= sensorPacket.imu_magnetometer_unit;
+    m_gyroscope_sum+= sensorPacket.imu_gyroscope_rad_per_sec;
+    m_time_delta_sum+= delta_time;
+    m_sample_count++;
+}
+
+float PoseSensorPacketQueue::dequeueBlendedSample(PoseSensorPacket &out_packet)
+{
+    const float time_delta= m_time_delta_sum;
+
+    if (m_sample_count > 0)
+    {
+        const float N= static_cast<float>(m_sample_count);
+
+        // Integrating the averaged readings over the summed time delta is
+        // first-order equivalent to integrating each sample over its own slice
+        out_packet.imu_accelerometer_g_units= m_accelerometer_sum / N;
+        out_packet.imu_magnetometer_unit= m_magnetometer_sum / N;
+        out_packet.imu_gyroscope_rad_per_sec= m_gyroscope_sum / N;
+    }
+    else
+    {
+        out_packet.imu_accelerometer_g_units= Eigen::Vector3f::Zero();
+        out_packet.imu_magnetometer_unit= Eigen::Vector3f::Zero();
+        out_packet.imu_gyroscope_rad_per_sec= Eigen::Vector3f::Zero();
+    }
+
+    clear();
+
+    return time_delta;
+}
+
+//-- Pose Filter History -----
+PoseFilterHistory::PoseFilterHistory()
+{
+    clear();
+}
+
+void PoseFilterHistory::clear()
+{
+    m_head_index= 0;
+    m_entry_count= 0;
+}
+
+void PoseFilterHistory::addSample(
+    const float timestamp,
+    const Eigen::Quaternionf &orientation,
+    const Eigen::Vector3f &position_cm)
+{
+    PoseHistoryEntry &entry= m_entries[m_head_index];
+
+    entry.timestamp= timestamp;
+    entry.orientation_w= orientation.w();
+    entry.orientation_x= orientation.x();
+    entry.orientation_y= orientation.y();
+    entry.orientation_z= orientation.z();
+    entry.position_x_cm= position_cm.x();
+    entry.position_y_cm= position_cm.y();
+    entry.position_z_cm= position_cm.z();
+
+    m_head_index= (m_head_index + 1) % k_max_entries;
+    m_entry_count= std::min(m_entry_count + 1, k_max_entries);
+}
+
+float PoseFilterHistory::getNewestTimestamp() const
+{
+    return (m_entry_count > 0) ? getEntry(m_entry_count - 1).timestamp : 0.f;
+}
+
+bool PoseFilterHistory::getInterpolatedPoseAtTime(
+    const float timestamp,
+    Eigen::Quaternionf &out_orientation,
+    Eigen::Vector3f &out_position_cm) const
+{
+    if (m_entry_count == 0)
+    {
+        return false;
+    }
+
+    const PoseHistoryEntry &newest= getEntry(m_entry_count - 1);
+
+    if (timestamp > newest.timestamp)
+    {
+        // Future of the recorded history - let the filter extrapolate instead
+        return false;
+    }
+
+    // Walk backward in time looking for the pair of samples that brackets
+    // the query time. Queries older than the whole history clamp to the
+    // oldest sample we still have.
+    int older_index= 0;
+    int newer_index= m_entry_count - 1;
+    for (int test_index= m_entry_count - 2; test_index >= 0; --test_index)
+    {
+        if (getEntry(test_index).timestamp <= timestamp)
+        {
+            older_index= test_index;
+            newer_index= test_index + 1;
+            break;
+        }
+
+        newer_index= test_index;
+    }
+
+    const PoseHistoryEntry &older= getEntry(older_index);
+    const PoseHistoryEntry &newer= getEntry(newer_index);
+
+    const float u=
+        clampf01(safe_divide_with_default(timestamp - older.timestamp, newer.timestamp - older.timestamp, 1.f));
+
+    const Eigen::Quaternionf older_orientation(
+        older.orientation_w, older.orientation_x, older.orientation_y, older.orientation_z);
+    const Eigen::Quaternionf newer_orientation(
+        newer.orientation_w, newer.orientation_x, newer.orientation_y, newer.orientation_z);
+    const Eigen::Vector3f older_position(older.position_x_cm, older.position_y_cm, older.position_z_cm);
+    const Eigen::Vector3f newer_position(newer.position_x_cm, newer.position_y_cm, newer.position_z_cm);
+
+    out_orientation= older_orientation.slerp(u, newer_orientation);
+    out_position_cm= older_position + (newer_position - older_position)*u;
+
+    return true;
+}
+
+const PoseFilterHistory::PoseHistoryEntry &PoseFilterHistory::getEntry(
+    const int oldest_relative_index) const
+{
+    assert(oldest_relative_index >= 0 && oldest_relative_index < m_entry_count);
+
+    // m_head_index is the next write position, so the oldest sample lives
+    // m_entry_count slots behind it
+    const int ring_index=
+        (m_head_index + k_max_entries - m_entry_count + oldest_relative_index) % k_max_entries;
+
+    return m_entries[ring_index];
+}
+
 //-- Orientation Filter Space -----
 PoseFilterSpace::PoseFilterSpace()
     : m_IdentityGravity(Eigen::Vector3f(0.f, 1.f, 0.f))
@@ -24,40 +183,36 @@ PoseFilterSpace::PoseFilterSpace()
     , m_CalibrationTransform(Eigen::Matrix3f::Identity())
     , m_SensorTransform(Eigen::Matrix3f::Identity())
 {
+    rebuildCachedTransforms();
 }
 
-Eigen::Vector3f PoseFilterSpace::getGravityCalibrationDirection() const
+void PoseFilterSpace::rebuildCachedTransforms()
 {
-	// First apply the calibration data transform.
-	// This allows us to pretend the "identity pose" was some other orientation the vertical during calibration
-    const Eigen::Vector3f calibrationSpaceVector= m_CalibrationTransform * m_IdentityGravity;
-
-	// Next apply the sensor data transform.
-	// This allows us to pretend the sensors are in some other coordinate system (like OpenGL where +Y is up)
-    const Eigen::Vector3f filterSpaceVector= m_SensorTransform * calibrationSpaceVector;
+	// Compose the calibration data transform (pretend the "identity pose" was
+	// some other orientation than vertical during calibration) with the sensor
+	// data transform (pretend the sensors are in some other coordinate system,
+	// like OpenGL where +Y is up) once, so per-query evaluation is one multiply
+	m_SensorCalibrationTransform.noalias()= m_SensorTransform * m_CalibrationTransform;
+
+	m_GravityCalibrationDirection.noalias()= m_SensorCalibrationTransform * m_IdentityGravity;
+	m_MagnetometerCalibrationDirection.noalias()= m_SensorCalibrationTransform * m_IdentityMagnetometer;
+}
 
-    return filterSpaceVector;
+Eigen::Vector3f PoseFilterSpace::getGravityCalibrationDirection() const
+{
+    return m_GravityCalibrationDirection;
 }
 
 Eigen::Vector3f PoseFilterSpace::getMagnetometerCalibrationDirection() const
 {
-	// First apply the calibration data transform.
-	// This allows us to pretend the "identity pose" was some other orientation the vertical during calibration
-    const Eigen::Vector3f calibrationSpaceVector= m_CalibrationTransform * m_IdentityMagnetometer;
-
-	// Next apply the sensor data transform.
-	// This allows us to pretend the sensors are in some other coordinate system (like OpenGL where +Y is up)
-    const Eigen::Vector3f filterSpaceVector= m_SensorTransform * calibrationSpaceVector;
-
-    return filterSpaceVector;
+    return m_MagnetometerCalibrationDirection;
 }
 
-void PoseFilterSpace::createFilterPacket(
+const PoseFilterPacket &PoseFilterSpace::createFilterPacket(
     const PoseSensorPacket &sensorPacket,
-	const IPoseFilter *poseFilter,
-    PoseFilterPacket &outFilterPacket) const
+	const IPoseFilter *poseFilter)
 {
-	poseFilter->getOrientation(), poseFilter->getPositionCm(),
+	PoseFilterPacket &outFilterPacket= m_FilterPacketWorkspace;
 
 	outFilterPacket.current_orientation= poseFilter->getOrientation();
 	outFilterPacket.current_position_cm= poseFilter->getPositionCm();
@@ -70,10 +225,12 @@ void PoseFilterSpace::createFilterPacket(
     outFilterPacket.optical_position_cm = sensorPacket.optical_position_cm;
     outFilterPacket.tracking_projection_area_px_sqr= sensorPacket.tracking_projection_area_px_sqr;
 
-    outFilterPacket.imu_gyroscope_rad_per_sec= m_SensorTransform * sensorPacket.imu_gyroscope_rad_per_sec;
-    outFilterPacket.imu_accelerometer_g_units= m_SensorTransform * sensorPacket.imu_accelerometer_g_units;
-    outFilterPacket.imu_magnetometer_unit= m_SensorTransform * sensorPacket.imu_magnetometer_unit;
-        
+    outFilterPacket.imu_gyroscope_rad_per_sec.noalias()= m_SensorTransform * sensorPacket.imu_gyroscope_rad_per_sec;
+    outFilterPacket.imu_accelerometer_g_units.noalias()= m_SensorTransform * sensorPacket.imu_accelerometer_g_units;
+    outFilterPacket.imu_magnetometer_unit.noalias()= m_SensorTransform * sensorPacket.imu_magnetometer_unit;
+
 	outFilterPacket.world_accelerometer=
 		eigen_vector3f_clockwise_rotate(outFilterPacket.current_orientation, outFilterPacket.imu_accelerometer_g_units);
+
+	return outFilterPacket;
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 //-- includes -----
 #include "MathEigen.h"
+#include <vector>
 
 //-- constants -----
 // Calibration Pose transform
@@ -13,14 +14,28 @@ extern const Eigen::Matrix3f *k_eigen_identity_pose_laying_flat;
 extern const Eigen::Matrix3f *k_eigen_sensor_transform_identity;
 extern const Eigen::Matrix3f *k_eigen_sensor_transform_opengl;
 
-// 1 g-unit is equal 980.66499997877 gal (cm/s�)
-#define k_g_units_to_gal  980.665000f // gal (cm/s�)
-#define k_g_units_to_ms2  9.80665000f // m/s�
+// 1 g-unit is equal 980.66499997877 gal (cm/s�)
+#define k_g_units_to_gal  980.665000f // gal (cm/s�)
+#define k_g_units_to_ms2  9.80665000f // m/s�
 #define k_ms2_to_g_units  1.f/9.80665000f // g-units
 
 #define k_meters_to_centimeters  100.f
 #define k_centimeters_to_meters  0.01f
 
+// Scalar type used by the Kalman filter internals.
+// Device state and the protocol are all single precision, so building with
+// PSMOVE_USE_SINGLE_PRECISION_FILTERS skips the float<->double conversions
+// and halves the matrix memory traffic at a small accuracy cost.
+#ifdef PSMOVE_USE_SINGLE_PRECISION_FILTERS
+typedef float FilterScalar;
+#else
+typedef double FilterScalar;
+#endif
+typedef Eigen::Matrix<FilterScalar, 3, 1> FilterVector3;
+typedef Eigen::Quaternion<FilterScalar> FilterQuaternion;
+typedef Eigen::AngleAxis<FilterScalar> FilterAngleAxis;
+typedef Eigen::EulerAngles<FilterScalar> FilterEulerAngles;
+
 //-- declarations -----
 struct ExponentialCurve
 {
@@ -28,10 +43,64 @@ struct ExponentialCurve
 	float B;
 	float MaxValue;
 
+	/// Piecewise-linear samples of the curve, built once by buildLUT() so the
+	/// per-update measurement variance lookup in the filters avoids the exp()
+	enum { k_lut_sample_count= 64 };
+	float LutSamples[k_lut_sample_count];
+	float LutDomainMax;
+	float LutInvStep= 0.f;
+
 	inline float evaluate(float x) const
 	{
 		return fminf(A*exp(B*x), MaxValue);
 	}
+
+	/// Sample the curve out to where the exponential has decayed to 1% of A
+	/// (or met the MaxValue clamp when B is positive). Lookups past the end
+	/// of the domain clamp to the last sample, which by construction is
+	/// within 1% of A of the true curve value.
+	void buildLUT()
+	{
+		if (fabsf(A) > k_real_epsilon && fabsf(B) > k_real_epsilon)
+		{
+			LutDomainMax= (B < 0.f) ? logf(0.01f) / B : logf(fmaxf(MaxValue / fabsf(A), 1.f)) / B;
+			LutDomainMax= fmaxf(LutDomainMax, k_real_epsilon);
+		}
+		else
+		{
+			// Degenerate fit - the curve is constant so any domain works
+			LutDomainMax= 1.f;
+		}
+
+		const float step= LutDomainMax / static_cast<float>(k_lut_sample_count - 1);
+		for (int sample_index= 0; sample_index < k_lut_sample_count; ++sample_index)
+		{
+			LutSamples[sample_index]= evaluate(step*static_cast<float>(sample_index));
+		}
+		LutInvStep= 1.f / step;
+	}
+
+	/// Linear interpolation into the table built by buildLUT().
+	/// Falls back to the exact evaluation when no table was built.
+	inline float evaluateLUT(float x) const
+	{
+		if (LutInvStep <= 0.f)
+		{
+			return evaluate(x);
+		}
+
+		const float t= fminf(fmaxf(x, 0.f), LutDomainMax)*LutInvStep;
+		const int sample_index= static_cast<int>(t);
+
+		if (sample_index >= k_lut_sample_count - 1)
+		{
+			return LutSamples[k_lut_sample_count - 1];
+		}
+
+		const float frac= t - static_cast<float>(sample_index);
+
+		return LutSamples[sample_index] + (LutSamples[sample_index + 1] - LutSamples[sample_index])*frac;
+	}
 };
 
 /// A snapshot of IMU data emitted from a controller
@@ -89,6 +158,92 @@ struct PoseFilterPacket : PoseSensorPacket
 	}
 };
 
+/// Accumulates a burst of IMU-only sensor samples so that they can be folded
+/// into one batched filter update (a single covariance propagation over the
+/// summed time delta) when the next optical measurement lands, instead of
+/// paying for a full filter tick per IMU sample.
+class PoseSensorPacketQueue
+{
+public:
+    PoseSensorPacketQueue();
+
+    /// Drop any accumulated samples
+    void clear();
+
+    /// Fold the IMU portion of a sensor packet into the pending batch
+    void enqueueImuSample(const PoseSensorPacket &sensorPacket, const float delta_time);
+
+    inline bool getHasPendingSamples() const
+    { return m_sample_count > 0; }
+
+    /// Write the averaged IMU readings over the batch into out_packet
+    /// (the optical fields are left for the caller to fill in)
+    /// then reset the queue. Returns the summed time delta of the batch.
+    float dequeueBlendedSample(PoseSensorPacket &out_packet);
+
+private:
+    Eigen::Vector3f m_accelerometer_sum; // g-units
+    Eigen::Vector3f m_magnetometer_sum; // unit vectors
+    Eigen::Vector3f m_gyroscope_sum; // rad/s
+    float m_time_delta_sum; // seconds
+    int m_sample_count;
+};
+
+/// A fixed ring buffer of recently filtered poses tagged with accumulated filter time.
+/// Past-time pose queries interpolate between the real states recorded here instead
+/// of extrapolating backwards from the newest state, which lets clients resample
+/// poses to their own clock without extra filtering work server-side.
+class PoseFilterHistory
+{
+public:
+    static const int k_max_entries= 16;
+
+    PoseFilterHistory();
+
+    /// Drop all recorded samples
+    void clear();
+
+    /// Record a filtered state at the given accumulated filter time (seconds).
+    /// Timestamps are expected to be non-decreasing between calls.
+    void addSample(
+        const float timestamp,
+        const Eigen::Quaternionf &orientation,
+        const Eigen::Vector3f &position_cm);
+
+    inline bool getIsEmpty() const
+    { return m_entry_count == 0; }
+
+    /// Accumulated filter time of the most recent sample (0 when empty)
+    float getNewestTimestamp() const;
+
+    /// Interpolate the pose at the given accumulated filter time.
+    /// Queries older than the whole history clamp to the oldest sample.
+    /// Returns false when the history is empty or the query time is newer
+    /// than the most recent sample (prediction is the filter's job).
+    bool getInterpolatedPoseAtTime(
+        const float timestamp,
+        Eigen::Quaternionf &out_orientation,
+        Eigen::Vector3f &out_position_cm) const;
+
+private:
+    struct PoseHistoryEntry
+    {
+        float timestamp; // seconds of accumulated filter time
+
+        // Stored as raw components so that the ring buffer has
+        // no alignment requirements on its owner
+        float orientation_w, orientation_x, orientation_y, orientation_z;
+        float position_x_cm, position_y_cm, position_z_cm;
+    };
+
+    /// Fetch an entry by age, where index 0 is the oldest recorded sample
+    const PoseHistoryEntry &getEntry(const int oldest_relative_index) const;
+
+    PoseHistoryEntry m_entries[k_max_entries];
+    int m_head_index; // next write position
+    int m_entry_count;
+};
+
 /// Used to transform sensor data from a controller into an arbitrary space
 class PoseFilterSpace
 {
@@ -98,29 +253,45 @@ public:
     PoseFilterSpace();
 
     inline void setIdentityGravity(const Eigen::Vector3f &identityGravity)
-    { m_IdentityGravity= identityGravity; }
+    { m_IdentityGravity= identityGravity; rebuildCachedTransforms(); }
     inline void setIdentityMagnetometer(const Eigen::Vector3f &identityMagnetometer)
-    { m_IdentityMagnetometer= identityMagnetometer; }
+    { m_IdentityMagnetometer= identityMagnetometer; rebuildCachedTransforms(); }
 
     inline void setCalibrationTransform(const Eigen::Matrix3f &calibrationTransform)
-    { m_CalibrationTransform= calibrationTransform; }
+    { m_CalibrationTransform= calibrationTransform; rebuildCachedTransforms(); }
     inline void setSensorTransform(const Eigen::Matrix3f &sensorTransform)
-    { m_SensorTransform= sensorTransform; }
+    { m_SensorTransform= sensorTransform; rebuildCachedTransforms(); }
 
     Eigen::Vector3f getGravityCalibrationDirection() const;
     Eigen::Vector3f getMagnetometerCalibrationDirection() const;
 
-    void createFilterPacket(
+    /// Translate a sensor packet into filter space, writing into the
+    /// preallocated per-filter workspace packet.
+    /// The returned reference stays valid until the next call.
+    const PoseFilterPacket &createFilterPacket(
         const PoseSensorPacket &sensorPacket,
-		const class IPoseFilter *poseFilter,
-        PoseFilterPacket &outFilterPacket) const;
+		const class IPoseFilter *poseFilter);
 
 private:
+    /// Re-derive the composed calibration transform and the cached
+    /// calibration directions after one of the source transforms changes
+    void rebuildCachedTransforms();
+
     Eigen::Vector3f m_IdentityGravity;
     Eigen::Vector3f m_IdentityMagnetometer;
 
     Eigen::Matrix3f m_CalibrationTransform;
     Eigen::Matrix3f m_SensorTransform;
+
+    /// m_SensorTransform*m_CalibrationTransform composed once at setup time
+    /// instead of being applied as two separate multiplies per query
+    Eigen::Matrix3f m_SensorCalibrationTransform;
+    Eigen::Vector3f m_GravityCalibrationDirection;
+    Eigen::Vector3f m_MagnetometerCalibrationDirection;
+
+    /// Workspace the per-sample measurement translation writes into,
+    /// allocated once per filter instead of per sensor sample
+    PoseFilterPacket m_FilterPacketWorkspace;
 };
 
 /// Filter parameters that remain constant during the lifetime of the the filter
@@ -197,6 +368,24 @@ public:
 
     /// The current state becomes the identity pose
     virtual void recenterOrientation(const Eigen::Quaternionf& q_pose) = 0;
+
+    /// Serialize the filter's converged uncertainty and bias state into a flat
+    /// list of values so it can be persisted across service restarts.
+    /// Returns false when the filter has nothing worth persisting (the default).
+    virtual bool getConvergedState(std::vector<double> &out_values) const
+    { return false; }
+
+    /// Restore uncertainty and bias state previously captured by getConvergedState.
+    /// Returns false when the values don't apply to this filter.
+    virtual bool setConvergedState(const std::vector<double> &values)
+    { return false; }
+
+    /// Get the magnetometer fusion decimation state for filters that schedule
+    /// their magnetometer update at a decimated rate.
+    /// Returns false for filters that fuse every tick (the default).
+    virtual bool getMagnetometerDecimationState(
+        int &out_update_interval_ticks, int &out_skipped_update_count) const
+    { return false; }
 };
 
 /// Common interface to all orientation filters
@@ -25,6 +25,17 @@
 // IMU extrapolation of an unseen controller
 #define k_max_unseen_position_timeout 10000.f // ms
 
+// One-euro filter tuning: the smoothing cutoff floor, how much the cutoff
+// opens up per m/s of motion above the optical noise floor, and the cutoff
+// used to smooth the position derivative the adaptation is driven by
+#define k_one_euro_min_cutoff 1.0f // Hz
+#define k_one_euro_beta 0.5f // Hz per m/s
+#define k_one_euro_derivative_cutoff 1.0f // Hz
+
+// Bound on how far the one-euro output may lag the raw optical sample,
+// in standard deviations of the calibrated optical noise
+#define k_one_euro_max_deviation_sigma 3.f
+
 // -- private definitions -----
 struct PositionFilterState
 {
@@ -196,10 +207,14 @@ Eigen::Vector3f PositionFilter::getPositionCm(float time) const
 
     if (m_state->bIsValid)
     {
-        Eigen::Vector3f predicted_position = 
+        // Constant-acceleration extrapolation of the filter state so that
+        // clients can request poses at photon time without rolling their own
+        Eigen::Vector3f predicted_position =
             is_nearly_zero(time)
             ? m_state->position_meters
-            : m_state->position_meters + m_state->velocity_m_per_sec * time;
+            : m_state->position_meters
+              + m_state->velocity_m_per_sec * time
+              + m_state->acceleration_m_per_sec_sqr * (0.5f * time * time);
 
         result= predicted_position - m_state->origin_position;
         result= result * k_meters_to_centimeters;
@@ -376,7 +391,7 @@ void PositionFilterComplimentaryOpticalIMU::update(const float delta_time, const
                 // Blend the optical and IMU derived positions based on optical tracking quality
 				const float max_variance_fraction=
 					safe_divide_with_default(
-						m_constants.position_variance_curve.evaluate(packet.tracking_projection_area_px_sqr),
+						m_constants.position_variance_curve.evaluateLUT(packet.tracking_projection_area_px_sqr),
 						m_constants.position_variance_curve.MaxValue,
 						1.f);
 				const float optical_weight = clampf01(1.f - max_variance_fraction);
@@ -458,6 +473,87 @@ void PositionFilterLowPassExponential::update(const float delta_time, const Pose
 	}
 }
 
+// -- PositionFilterOneEuro --
+void PositionFilterOneEuro::resetState()
+{
+	PositionFilter::resetState();
+	bDerivative_valid= false;
+	smoothed_velocity_m_per_sec= Eigen::Vector3f::Zero();
+}
+
+void PositionFilterOneEuro::update(
+	const float delta_time,
+	const PoseFilterPacket &packet)
+{
+	if (packet.tracking_projection_area_px_sqr > 0.f && eigen_vector3f_is_valid(packet.optical_position_cm))
+	{
+		const Eigen::Vector3f optical_position_meters= packet.get_optical_position_in_meters();
+		Eigen::Vector3f new_position_meters= optical_position_meters;
+
+		if (m_state->bIsValid && delta_time > k_real_epsilon)
+		{
+			// Standard deviation of the optical position noise at the current
+			// projection area, from the optical noise calibration
+			const float position_sigma_meters=
+				sqrtf(m_constants.position_variance_curve.evaluateLUT(packet.tracking_projection_area_px_sqr))
+				* k_centimeters_to_meters;
+
+			// Low pass the position derivative so the cutoff adaptation
+			// doesn't chase per-sample jitter
+			const Eigen::Vector3f raw_velocity_m_per_sec=
+				(optical_position_meters - m_state->position_meters) / delta_time;
+
+			smoothed_velocity_m_per_sec=
+				bDerivative_valid
+				? lowpass_filter_vector3f(
+					delta_time, k_one_euro_derivative_cutoff,
+					smoothed_velocity_m_per_sec, raw_velocity_m_per_sec)
+				: raw_velocity_m_per_sec;
+			bDerivative_valid= true;
+
+			// Ignore the part of the apparent speed the noise model explains -
+			// jitter on a stationary controller shouldn't open the cutoff up
+			const float noise_speed_m_per_sec= position_sigma_meters / delta_time;
+			const float speed_above_noise=
+				fmaxf(smoothed_velocity_m_per_sec.norm() - noise_speed_m_per_sec, 0.f);
+
+			// The cutoff opens up with speed: heavy smoothing at rest,
+			// responsive in motion
+			const float cutoff_hz= k_one_euro_min_cutoff + k_one_euro_beta*speed_above_noise;
+
+			new_position_meters=
+				lowpass_filter_vector3f(
+					delta_time, cutoff_hz,
+					m_state->position_meters, optical_position_meters);
+
+			// Validate the output against the raw sample: never lag the
+			// measurement by more than the calibrated noise envelope allows
+			const Eigen::Vector3f deviation= new_position_meters - optical_position_meters;
+			const float deviation_meters= deviation.norm();
+			const float max_deviation_meters= k_one_euro_max_deviation_sigma*position_sigma_meters;
+
+			if (deviation_meters > max_deviation_meters && deviation_meters > k_real_epsilon)
+			{
+				new_position_meters=
+					optical_position_meters + deviation*(max_deviation_meters / deviation_meters);
+			}
+		}
+
+		m_state->apply_state(
+			new_position_meters,
+			bDerivative_valid ? smoothed_velocity_m_per_sec : Eigen::Vector3f::Zero(),
+			Eigen::Vector3f::Zero(),
+			packet.world_accelerometer,
+			Eigen::Vector3f::Zero());
+	}
+	else
+	{
+		m_state->reset();
+		bDerivative_valid= false;
+		smoothed_velocity_m_per_sec= Eigen::Vector3f::Zero();
+	}
+}
+
 //-- helper functions ---
 static Eigen::Vector3f threshold_vector3f(const Eigen::Vector3f &vector, const float min_length)
 {
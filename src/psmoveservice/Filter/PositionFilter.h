@@ -71,4 +71,27 @@ private:
     bool bLast_visible_position_timestamp_valid;
 };
 
+/// One-euro adaptive low pass filter over the optical position.
+/// The smoothing cutoff opens up with speed so slow motion gets heavy jitter
+/// suppression while fast motion stays responsive, with the noise floor taken
+/// from the optical noise calibration at the current projection area.
+/// A cheap alternative to the Kalman filter for stations that can't afford it
+/// but find LowPassOptical too laggy.
+class PositionFilterOneEuro : public PositionFilter
+{
+public:
+	PositionFilterOneEuro()
+		: PositionFilter()
+		, bDerivative_valid(false)
+		, smoothed_velocity_m_per_sec(Eigen::Vector3f::Zero())
+	{}
+
+	void resetState() override;
+	void update(const float delta_time, const PoseFilterPacket &packet) override;
+
+private:
+	bool bDerivative_valid;
+	Eigen::Vector3f smoothed_velocity_m_per_sec;
+};
+
 #endif // POSITION_FILTER_H
\ No newline at end of file
@@ -8,6 +8,10 @@
 #include "ServerUtility.h"
 #include "hidapi.h"
 #include "libusb.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
 #include <vector>
 #include <cstdlib>
 #ifdef _WIN32
@@ -32,7 +36,6 @@
 #define MORPHEUS_COMMAND_MAGIC 0xAA
 #define MORPHEUS_COMMAND_MAX_PAYLOAD_LEN 60
 
-#define MORPHEUS_HMD_STATE_BUFFER_MAX 4
 #define METERS_TO_CENTIMETERS 100
 
 enum eMorpheusRequestType
@@ -184,6 +187,103 @@ static bool morpheus_enable_tracking(MorpheusUSBContext *morpheus_context);
 static bool morpheus_set_headset_power(MorpheusUSBContext *morpheus_context, bool bIsOn);
 static bool morpheus_set_led_brightness(MorpheusUSBContext *morpheus_context, unsigned short led_bitmask, unsigned char intensity);
 static bool morpheus_turn_off_processor_unit(MorpheusUSBContext *morpheus_context);
+
+// -- Morpheus Command Thread ----
+/// Owns a worker thread that applies queued LED brightness changes over the
+/// Morpheus command interface. The bulk transfer in morpheus_send_command can
+/// stall for several milliseconds, so the service thread just stores the
+/// newest desired brightness (one-slot coalescing state, same scheme as
+/// ControllerHidPollThread's output state) and never blocks on the write.
+class MorpheusCommandThread
+{
+public:
+	MorpheusCommandThread(MorpheusUSBContext *context)
+		: m_context(context)
+		, m_desired_led_brightness(k_output_not_set)
+		, m_last_applied_led_brightness(k_output_not_set)
+		, m_shutdown_requested(false)
+		, m_thread_started(false)
+	{
+	}
+
+	~MorpheusCommandThread()
+	{
+		shutdown();
+	}
+
+	void startup()
+	{
+		if (!m_thread_started)
+		{
+			m_desired_led_brightness= k_output_not_set;
+			m_last_applied_led_brightness= k_output_not_set;
+			m_shutdown_requested= false;
+			m_command_thread= std::thread(&MorpheusCommandThread::commandThreadFunc, this);
+			m_thread_started= true;
+		}
+	}
+
+	void shutdown()
+	{
+		if (m_thread_started)
+		{
+			m_shutdown_requested= true;
+			m_command_thread.join();
+			m_thread_started= false;
+		}
+	}
+
+	inline bool getIsRunning() const
+	{
+		return m_thread_started;
+	}
+
+	/// Store the LED brightness to apply on the command thread.
+	/// Newest value wins; the caller never waits on the bulk transfer.
+	void setDesiredLedBrightness(unsigned char intensity)
+	{
+		m_desired_led_brightness.store(static_cast<std::uint32_t>(intensity), std::memory_order_release);
+	}
+
+protected:
+	void commandThreadFunc()
+	{
+		while (!m_shutdown_requested.load(std::memory_order_acquire))
+		{
+			const std::uint32_t desired= m_desired_led_brightness.load(std::memory_order_acquire);
+
+			if (desired != k_output_not_set && desired != m_last_applied_led_brightness)
+			{
+				if (!morpheus_set_led_brightness(m_context, _MorpheusLED_ALL, static_cast<unsigned char>(desired)))
+				{
+					SERVER_MT_LOG_ERROR("MorpheusCommandThread") << "Failed to apply LED brightness " << desired;
+				}
+
+				// Either way consider the request handled - retrying a dead
+				// command interface every lap would just spam the bus
+				m_last_applied_led_brightness= desired;
+			}
+
+			// Brightness only changes on tracking start/stop, so a coarse
+			// sleep keeps this thread effectively idle in between
+			std::this_thread::sleep_for(std::chrono::milliseconds(5));
+		}
+	}
+
+private:
+	static const std::uint32_t k_output_not_set= 0xFFFFFFFF;
+
+	MorpheusUSBContext *m_context;
+
+	// One-slot coalescing output state. The service thread stores the newest
+	// desired value; the command thread applies it when it changes.
+	std::atomic<std::uint32_t> m_desired_led_brightness;
+	std::uint32_t m_last_applied_led_brightness;	// command thread only
+
+	std::thread m_command_thread;
+	std::atomic_bool m_shutdown_requested;
+	bool m_thread_started;
+};
 static bool morpheus_set_vr_mode(MorpheusUSBContext *morpheus_context, bool bIsOn);
 static bool morpheus_set_cinematic_configuration(
 	MorpheusUSBContext *morpheus_context,
@@ -362,12 +462,14 @@ void MorpheusHMDState::parse_data_input(
 MorpheusHMD::MorpheusHMD()
     : cfg()
     , USBContext(nullptr)
+    , CommandThread(nullptr)
     , NextPollSequenceNumber(0)
     , InData(nullptr)
     , HMDStates()
 	, bIsTracking(false)
 {
     USBContext = new MorpheusUSBContext;
+    CommandThread = new MorpheusCommandThread(USBContext);
     InData = new MorpheusSensorData;
 
     HMDStates.clear();
@@ -381,6 +483,7 @@ MorpheusHMD::~MorpheusHMD()
     }
 
     delete InData;
+    delete CommandThread;
     delete USBContext;
 }
 
@@ -452,6 +555,10 @@ bool MorpheusHMD::open(
 						morpheus_set_led_brightness(USBContext, _MorpheusLED_ALL, 0);
 					}
 				}
+
+				// Later LED writes go through the command thread so that
+				// tracking start/stop never stalls the service thread
+				CommandThread->startup();
 			}
 
 			// Always save the config back out in case some defaults changed
@@ -485,6 +592,7 @@ void MorpheusHMD::close()
 		if (USBContext->usb_device_handle != nullptr)
 		{
 			SERVER_LOG_INFO("MorpheusHMD::close") << "Closing MorpheusHMD command interface";
+			CommandThread->shutdown();
 			morpheus_set_headset_power(USBContext, false);
 			morpheus_close_usb_device(USBContext);
 		}
@@ -596,13 +704,8 @@ MorpheusHMD::poll()
 			// Processes the IMU data
 			newState.parse_data_input(&cfg, InData);
 
-			// Make room for new entry if at the max queue size
-			if (HMDStates.size() >= MORPHEUS_HMD_STATE_BUFFER_MAX)
-			{
-				HMDStates.erase(HMDStates.begin(), HMDStates.begin() + HMDStates.size() - MORPHEUS_HMD_STATE_BUFFER_MAX);
-			}
-
-			HMDStates.push_back(newState);
+			// The ring recycles its oldest slot once full - no allocation
+			HMDStates.push(newState);
 		}
 	}
 
@@ -644,11 +747,7 @@ const CommonDeviceState *
 MorpheusHMD::getState(
     int lookBack) const
 {
-    const int queueSize = static_cast<int>(HMDStates.size());
-    const CommonDeviceState * result =
-        (lookBack < queueSize) ? &HMDStates.at(queueSize - lookBack - 1) : nullptr;
-
-    return result;
+    return HMDStates.getLookBackState(lookBack);
 }
 
 long MorpheusHMD::getMaxPollFailureCount() const
@@ -660,14 +759,16 @@ void MorpheusHMD::setTrackingEnabled(bool bEnable)
 {
 	if (USBContext->usb_device_handle != nullptr)
 	{
+		// Queued for the command thread - the bulk transfer behind the LED
+		// write would otherwise block the service thread mid-update
 		if (!bIsTracking && bEnable)
 		{
-			morpheus_set_led_brightness(USBContext, _MorpheusLED_ALL, 50);
+			CommandThread->setDesiredLedBrightness(50);
 			bIsTracking = true;
 		}
 		else if (bIsTracking && !bEnable)
 		{
-			morpheus_set_led_brightness(USBContext, _MorpheusLED_ALL, 0);
+			CommandThread->setDesiredLedBrightness(0);
 			bIsTracking = false;
 		}
 	}
@@ -4,12 +4,14 @@
 #include "PSMoveConfig.h"
 #include "DeviceEnumerator.h"
 #include "DeviceInterface.h"
+#include "DeviceStateRingBuffer.h"
 #include "MathUtility.h"
 #include <string>
 #include <vector>
-#include <deque>
 #include <array>
 
+#define MORPHEUS_HMD_STATE_BUFFER_MAX 4
+
 // The angle the accelerometer reading will be pitched by
 // if the Morpheus is held such that the face plate is perpendicular to the ground
 // i.e. where what we consider the "identity" pose
@@ -44,10 +46,10 @@ public:
 		// https://www.bosch-sensortec.com/bst/products/all_products/bmi055
 		//
 		// The Accelerometer can operate in one of 4 modes: 
-		//   �2g, �4g, �8g, �16g
+		//   �2g, �4g, �8g, �16g
 		// The Gyroscope can operate in one of 5 modes: 
-		//   �125�/s, �250�/s, �500�/s, �1000�/s, �2000�/s
-		//   (or �2.18 rad/s, �4.36 rad/s, �8.72 rad/s, �17.45 rad/s, �34.9 rad/s)
+		//   �125�/s, �250�/s, �500�/s, �1000�/s, �2000�/s
+		//   (or �2.18 rad/s, �4.36 rad/s, �8.72 rad/s, �17.45 rad/s, �34.9 rad/s)
 		//
 		// I haven't seen any indication that suggests the Morpheus changes modes.
 		// However we need to calibrate the sensor bias at startup
@@ -55,7 +57,7 @@ public:
 		// NOTE: If you are unfamiliar like I was with "LSB/Unit"
 		// see http://stackoverflow.com/questions/19161872/meaning-of-lsb-unit-and-unit-lsb
 
-		// Accelerometer configured at �2g, 1024 LSB/g
+		// Accelerometer configured at �2g, 1024 LSB/g
 		accelerometer_gain.i = 1.f / (1024.f);
 		accelerometer_gain.j = 1.f / (1024.f);
 		accelerometer_gain.k = 1.f / (1024.f);
@@ -65,7 +67,7 @@ public:
 		raw_accelerometer_bias.j = 0.f;
 		raw_accelerometer_bias.k = 0.f;
 
-		// Gyroscope configured at �1000�/s, 32.8 LSB/(�/s)
+		// Gyroscope configured at �1000�/s, 32.8 LSB/(�/s)
 		// but we want the calibrated gyro value in radians/s so add in a deg->rad conversion as well
 		gyro_gain.i = 1.f / (32.8f / k_degrees_to_radians);
 		gyro_gain.j = 1.f / (32.8f / k_degrees_to_radians);
@@ -255,11 +257,12 @@ private:
     // Constant while the HMD is open
     MorpheusHMDConfig cfg;
     class MorpheusUSBContext *USBContext;                    // Buffer that holds static MorpheusAPI HMD description
+    class MorpheusCommandThread *CommandThread;              // Applies queued LED writes off the service thread
 
     // Read HMD State
     int NextPollSequenceNumber;
     struct MorpheusSensorData *InData;                        // Buffer to hold most recent MorpheusAPI tracking state
-    std::deque<MorpheusHMDState> HMDStates;
+    DeviceStateRingBuffer<MorpheusHMDState, MORPHEUS_HMD_STATE_BUFFER_MAX> HMDStates;
 
 	bool bIsTracking;
 };
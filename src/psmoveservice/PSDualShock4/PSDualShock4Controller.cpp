@@ -6,9 +6,11 @@
 #include "MathUtility.h"
 #include "ServerLog.h"
 #include "ServerUtility.h"
+#include "SessionCapture.h"
 #include "BluetoothQueries.h"
 #include <algorithm>
 #include <vector>
+#include <cstddef>
 #include <cstdlib>
 #ifdef _WIN32
 #define _USE_MATH_DEFINES
@@ -31,7 +33,6 @@
 #define PSDS4_BTADDR_GET_SIZE 16
 #define PSDS4_BTADDR_SET_SIZE 23
 #define PSDS4_BTADDR_SIZE 6
-#define PSDS4_STATE_BUFFER_MAX 16
 
 #define PSDS4_TRACKING_TRIANGLE_WIDTH  .9386f // The width of a triangle enclosed in the DS4 tracking bar in cm
 #define PSDS4_TRACKING_TRIANGLE_HEIGHT  .6548f // The height of a triangle enclosed in the DS4 tracking bar in cm
@@ -223,6 +224,22 @@ struct PSDualShock4DataInput
     unsigned char crc32[4];             // byte 75-78, CRC-32 of the first 75 bytes
 };
 
+// poll() reads hid reports directly over this struct, which is only safe if
+// the compiler packs it exactly like the wire format. The 16-bit timestamp is
+// the one member with alignment > 1 and it has to land on its natural (even)
+// offset for the layout to stay padding-free, so verify the key offsets at
+// compile time rather than finding out at runtime.
+static_assert(sizeof(PS4DualShock4TouchPacket) == 9, "PS4DualShock4TouchPacket layout mismatch");
+static_assert(offsetof(PSDualShock4DataInput, left_trigger) == 10, "PSDualShock4DataInput layout mismatch");
+static_assert(offsetof(PSDualShock4DataInput, timestamp) == 12, "PSDualShock4DataInput layout mismatch");
+static_assert(offsetof(PSDualShock4DataInput, battery) == 14, "PSDualShock4DataInput layout mismatch");
+static_assert(offsetof(PSDualShock4DataInput, gyro_x) == 15, "PSDualShock4DataInput layout mismatch");
+static_assert(offsetof(PSDualShock4DataInput, accel_x) == 21, "PSDualShock4DataInput layout mismatch");
+static_assert(offsetof(PSDualShock4DataInput, trackPadPktCount) == 35, "PSDualShock4DataInput layout mismatch");
+static_assert(offsetof(PSDualShock4DataInput, trackPadPackets) == 36, "PSDualShock4DataInput layout mismatch");
+static_assert(offsetof(PSDualShock4DataInput, crc32) == 74, "PSDualShock4DataInput layout mismatch");
+static_assert(sizeof(PSDualShock4DataInput) == 78, "PSDualShock4DataInput layout mismatch");
+
 // 78 bytes
 struct PSDualShock4DataOutput 
 {
@@ -247,6 +264,12 @@ struct PSDualShock4DataOutput
     unsigned char crc32[4];                 // byte 74-77, CRC-32 of the first 75 bytes
 };
 
+static_assert(offsetof(PSDualShock4DataOutput, rumble_right) == 6, "PSDualShock4DataOutput layout mismatch");
+static_assert(offsetof(PSDualShock4DataOutput, led_r) == 8, "PSDualShock4DataOutput layout mismatch");
+static_assert(offsetof(PSDualShock4DataOutput, volume_left) == 21, "PSDualShock4DataOutput layout mismatch");
+static_assert(offsetof(PSDualShock4DataOutput, crc32) == 74, "PSDualShock4DataOutput layout mismatch");
+static_assert(sizeof(PSDualShock4DataOutput) == 78, "PSDualShock4DataOutput layout mismatch");
+
 // -- private prototypes -----
 inline enum CommonControllerState::ButtonState getButtonState(unsigned int buttons, unsigned int lastButtons, int buttonMask);
 inline bool hid_error_mbs(hid_device *dev, char *out_mb_error, size_t mb_buffer_size);
@@ -299,6 +322,14 @@ PSDualShock4ControllerConfig::config2ptree()
     pt.put("prediction_time", prediction_time);
     pt.put("max_poll_failure_count", max_poll_failure_count);
 
+	pt.put("FilterWarmStart.ValueCount", static_cast<int>(filter_warm_start_state.size()));
+	for (size_t value_index = 0; value_index < filter_warm_start_state.size(); ++value_index)
+	{
+		const std::string key = "FilterWarmStart.Value_" + std::to_string(value_index);
+
+		pt.put(key, filter_warm_start_state[value_index]);
+	}
+
 	writeTrackingColor(pt, tracking_color_id);
 
     return pt;
@@ -345,6 +376,16 @@ PSDualShock4ControllerConfig::ptree2config(const boost::property_tree::ptree &pt
 		// Get shared filter parameters
 		min_screen_projection_area = pt.get<float>("PoseFilter.MinScreenProjectionArea", min_screen_projection_area);
 
+		// Get the persisted filter warm-start state
+		filter_warm_start_state.clear();
+		const int warm_start_value_count = pt.get<int>("FilterWarmStart.ValueCount", 0);
+		for (int value_index = 0; value_index < warm_start_value_count; ++value_index)
+		{
+			const std::string key = "FilterWarmStart.Value_" + std::to_string(value_index);
+
+			filter_warm_start_state.push_back(pt.get<double>(key, 0.0));
+		}
+
         // Get the calibration direction for "down"
         identity_gravity_direction.i= pt.get<float>("Calibration.Identity.Gravity.X", identity_gravity_direction.i);
         identity_gravity_direction.j= pt.get<float>("Calibration.Identity.Gravity.Y", identity_gravity_direction.j);
@@ -388,7 +429,7 @@ PSDualShock4Controller::PSDualShock4Controller()
         PSDualShock4ControllerState empty_state;
 
         empty_state.clear();
-        ControllerStates.push_back(empty_state);
+        ControllerStates.push(empty_state);
     }
 }
 
@@ -619,7 +660,7 @@ PSDualShock4Controller::setHostBluetoothAddress(const std::string &new_host_bt_a
     return success;
 }
 
-bool 
+bool
 PSDualShock4Controller::setTrackingColorID(const eCommonTrackingColorID tracking_color_id)
 {
 	bool bSuccess = false;
@@ -634,6 +675,21 @@ PSDualShock4Controller::setTrackingColorID(const eCommonTrackingColorID tracking
 	return bSuccess;
 }
 
+bool
+PSDualShock4Controller::setFilterWarmStartState(const std::vector<double> &values)
+{
+	bool bSuccess = false;
+
+	if (getIsOpen())
+	{
+		cfg.filter_warm_start_state = values;
+		cfg.save();
+		bSuccess = true;
+	}
+
+	return bSuccess;
+}
+
 // Getters
 bool
 PSDualShock4Controller::matchesDeviceEnumerator(const DeviceEnumerator *enumerator) const
@@ -795,6 +851,14 @@ PSDualShock4Controller::poll()
                 result = IControllerInterface::_PollResultSuccessNewData;
             }
 
+            // Feed the whole-session recorder (one atomic load when off)
+            if (SessionCapture::getIsRecording())
+            {
+                SessionCapture::recordControllerReport(
+                    HIDDetails.Bt_addr, CommonDeviceState::PSDualShock4,
+                    reinterpret_cast<const unsigned char *>(InData), sizeof(PSDualShock4DataInput));
+            }
+
             // https://github.com/nitsch/moveonpc/wiki/Input-report
             PSDualShock4ControllerState newState;
 
@@ -802,6 +866,11 @@ PSDualShock4Controller::poll()
             newState.PollSequenceNumber = NextPollSequenceNumber;
             ++NextPollSequenceNumber;
 
+            // Record when the report was drained so the filter can batch the
+            // drained states with real per-sample time deltas
+            newState.PollTimestamp = std::chrono::high_resolution_clock::now();
+            newState.bPollTimestampValid = true;
+
             // Smush the button state into one unsigned 32-bit variable
             newState.AllButtons = 
                 (((unsigned int)InData->buttons3.raw & 0x3) << 16) | // Get the 1st two bits of buttons: [0|0|0|0|0|0|PS|TPad]
@@ -851,7 +920,7 @@ PSDualShock4Controller::poll()
 
             // Update the button state enum
             {
-                unsigned int lastButtons = ControllerStates.empty() ? 0 : ControllerStates.back().AllButtons;
+                unsigned int lastButtons = ControllerStates.empty() ? 0 : ControllerStates.back()->AllButtons;
 
                 newState.DPad_Up = getButtonState(newState.AllButtons, lastButtons, Btn_DPAD_UP);
                 newState.DPad_Down = getButtonState(newState.AllButtons, lastButtons, Btn_DPAD_DOWN);
@@ -960,14 +1029,8 @@ PSDualShock4Controller::poll()
                 break;
             }            
 
-            // Make room for new entry if at the max queue size
-            if (ControllerStates.size() >= PSDS4_STATE_BUFFER_MAX)
-            {
-                ControllerStates.erase(ControllerStates.begin(),
-                    ControllerStates.begin() + ControllerStates.size() - PSDS4_STATE_BUFFER_MAX);
-            }
-
-            ControllerStates.push_back(newState);
+            // The ring recycles its oldest slot once full - no allocation
+            ControllerStates.push(newState);
         }
 
         // Update recurrent writes on a regular interval
@@ -991,11 +1054,7 @@ const CommonDeviceState *
 PSDualShock4Controller::getState(
 int lookBack) const
 {
-    const int queueSize = static_cast<int>(ControllerStates.size());
-    const CommonDeviceState * result =
-        (lookBack < queueSize) ? &ControllerStates.at(queueSize - lookBack - 1) : nullptr;
-
-    return result;
+    return ControllerStates.getLookBackState(lookBack);
 }
 
 const std::tuple<unsigned char, unsigned char, unsigned char>
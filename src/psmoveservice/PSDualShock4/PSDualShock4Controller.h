@@ -4,13 +4,15 @@
 #include "PSMoveConfig.h"
 #include "DeviceEnumerator.h"
 #include "DeviceInterface.h"
+#include "DeviceStateRingBuffer.h"
 #include "MathUtility.h"
 #include "hidapi.h"
 #include <string>
 #include <vector>
-#include <deque>
 #include <chrono>
 
+#define PSDS4_STATE_BUFFER_MAX 16
+
 // The angle the accelerometer reading is pitched forward when the DS4 is on a flat surface
 // The value comes from the accelerometer calibration utility
 #define FLAT_SURFACE_ACCELEROMETER_PITCH_DEGREES 12.661f
@@ -63,21 +65,21 @@ public:
         // https://www.bosch-sensortec.com/bst/products/all_products/bmi055
         //
         // The Accelerometer can operate in one of 4 modes: 
-        //   �2g, �4g, �8g, �16g
+        //   �2g, �4g, �8g, �16g
 		// The raw sensor bits can be converted to units of 'g' by dividing with the following "Sensitivity" values
 		//   1024, 512, 256, 128 [units=LSB/g]
 
         // The Gyroscope can operate in one of 5 modes: 
-        //   �125�/s, �250�/s, �500�/s, �1000�/s, �2000�/s
-        //   (or �2.18 rad/s, �4.36 rad/s, �8.72 rad/s, �17.45 rad/s, �34.9 rad/s)
-		// The raw sensor bits can be converted to units of '�/s' by dividing with following "Sensitivity" values
-		//   262.4, 131.2, 65.6, 32.8, 16.4 [units=LSB/�/s]
+        //   �125�/s, �250�/s, �500�/s, �1000�/s, �2000�/s
+        //   (or �2.18 rad/s, �4.36 rad/s, �8.72 rad/s, �17.45 rad/s, �34.9 rad/s)
+		// The raw sensor bits can be converted to units of '�/s' by dividing with following "Sensitivity" values
+		//   262.4, 131.2, 65.6, 32.8, 16.4 [units=LSB/�/s]
 		// or converted to units of 'rad/s' with these "Sensitivity" values
 		//   15034.4, 7517.2, 3758.6, 1879.3, 939.7 [units=LSB/rad/s]
         
         // Accelerometer gain computed from accelerometer calibration in the config tool is really close to 1/8192.
         // Since the accelerometer is 12-bit we have to >> 4 bits (divide by 16) to get the true raw sensor bits
-		// That means the "Sensitivity" is 512 and thus the accelerometer mode is �4g
+		// That means the "Sensitivity" is 512 and thus the accelerometer mode is �4g
 		accelerometer_gain.i = 1.f / 512.f;
 		accelerometer_gain.j = 1.f / 512.f;
 		accelerometer_gain.k = 1.f / 512.f;
@@ -89,7 +91,7 @@ public:
         accelerometer_bias.k = 0.f;
 
 		// Gyro gain mode can vary from controller to controller
-		// Initially assume that this controller is using the '�2000�/s' mode 
+		// Initially assume that this controller is using the '�2000�/s' mode 
 		// and use the appropriate LSB/rad/s "Sensitivity"
         gyro_gain= 1.f / (16.4f / k_degrees_to_radians);
 
@@ -163,6 +165,10 @@ public:
 	}
 
 	eCommonTrackingColorID tracking_color_id;
+
+	// Converged filter covariance/bias state captured on the last clean shutdown,
+	// used to warm-start the pose filter instead of reconverging from scratch
+	std::vector<double> filter_warm_start_state;
 };
 
 struct PSDualShock4ControllerState : public CommonControllerState
@@ -281,6 +287,7 @@ public:
     // -- IControllerInterface
     virtual bool setHostBluetoothAddress(const std::string &address) override;
 	virtual bool setTrackingColorID(const eCommonTrackingColorID tracking_color_id) override;
+	virtual bool setFilterWarmStartState(const std::vector<double> &values) override;
     virtual bool getIsBluetooth() const override;
     virtual std::string getUSBDevicePath() const override;
     virtual std::string getAssignedHostBluetoothAddress() const override;
@@ -329,7 +336,7 @@ private:
 
     // Read Controller State
     int NextPollSequenceNumber;
-    std::deque<PSDualShock4ControllerState> ControllerStates;
+    DeviceStateRingBuffer<PSDualShock4ControllerState, PSDS4_STATE_BUFFER_MAX> ControllerStates;
     PSDualShock4DataInput* InData;                        // Buffer to read hidapi reports into
     PSDualShock4DataOutput* OutData;                      // Buffer to write hidapi reports out from
 };
@@ -0,0 +1,171 @@
+//-- includes -----
+#include "ConfigWriter.h"
+#include "PSMoveConfig.h"
+#include "ThreadCpuMonitor.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+//-- constants -----
+// How long a queued save sits before it hits the disk. Saves of the same
+// config inside this window collapse into one write of the latest state.
+static const int k_config_save_debounce_milliseconds = 100;
+
+// How often the writer thread wakes to check for due saves
+static const int k_writer_poll_interval_milliseconds = 25;
+
+//-- statics -----
+struct PendingConfigSave
+{
+    boost::property_tree::ptree pt;
+    std::chrono::steady_clock::time_point write_deadline;
+};
+
+static std::mutex g_writer_mutex;
+static std::condition_variable g_writer_wake_signal;
+static std::condition_variable g_writer_idle_signal;
+static std::map<std::string, PendingConfigSave> g_pending_saves;
+static int g_saves_in_progress = 0; // currently being written, outside the lock
+static std::thread g_writer_thread;
+static bool g_writer_thread_started = false;
+static bool g_flush_requested = false;
+static bool g_shutdown_requested = false;
+
+//-- private implementation -----
+static void writer_thread_proc()
+{
+    ThreadCpuMonitor::registerCurrentThread("config_writer");
+
+    for (;;)
+    {
+        std::vector<std::pair<std::string, boost::property_tree::ptree>> due_saves;
+
+        {
+            std::unique_lock<std::mutex> lock(g_writer_mutex);
+
+            g_writer_wake_signal.wait_for(
+                lock, std::chrono::milliseconds(k_writer_poll_interval_milliseconds));
+
+            // On flush or shutdown everything pending is due immediately
+            const bool bWriteEverything = g_shutdown_requested || g_flush_requested;
+            g_flush_requested = false;
+
+            const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+            std::map<std::string, PendingConfigSave>::iterator iter = g_pending_saves.begin();
+            while (iter != g_pending_saves.end())
+            {
+                if (bWriteEverything || now >= iter->second.write_deadline)
+                {
+                    due_saves.push_back(std::make_pair(iter->first, std::move(iter->second.pt)));
+                    iter = g_pending_saves.erase(iter);
+                }
+                else
+                {
+                    ++iter;
+                }
+            }
+
+            g_saves_in_progress += static_cast<int>(due_saves.size());
+        }
+
+        // The actual disk I/O happens outside the lock so enqueueSave never blocks
+        for (const std::pair<std::string, boost::property_tree::ptree> &due_save : due_saves)
+        {
+            PSMoveConfig::writeConfigToDiskAtomic(due_save.first, due_save.second);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(g_writer_mutex);
+
+            g_saves_in_progress -= static_cast<int>(due_saves.size());
+
+            if (g_pending_saves.size() == 0 && g_saves_in_progress == 0)
+            {
+                g_writer_idle_signal.notify_all();
+
+                if (g_shutdown_requested)
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    ThreadCpuMonitor::unregisterCurrentThread();
+}
+
+//-- public implementation -----
+void ConfigWriter::enqueueSave(
+    const std::string &configPath,
+    const boost::property_tree::ptree &pt)
+{
+    std::unique_lock<std::mutex> lock(g_writer_mutex);
+
+    if (g_shutdown_requested)
+    {
+        // The writer is gone (late save during teardown) - write synchronously
+        lock.unlock();
+        PSMoveConfig::writeConfigToDiskAtomic(configPath, pt);
+        return;
+    }
+
+    if (!g_writer_thread_started)
+    {
+        g_writer_thread = std::thread(writer_thread_proc);
+        g_writer_thread_started = true;
+    }
+
+    // Latest state wins - an older pending save for the same path is replaced
+    PendingConfigSave &pending = g_pending_saves[configPath];
+    pending.pt = pt;
+    pending.write_deadline =
+        std::chrono::steady_clock::now() +
+        std::chrono::milliseconds(k_config_save_debounce_milliseconds);
+}
+
+void ConfigWriter::flush()
+{
+    std::unique_lock<std::mutex> lock(g_writer_mutex);
+
+    if (!g_writer_thread_started)
+    {
+        return;
+    }
+
+    g_flush_requested = true;
+    g_writer_wake_signal.notify_one();
+
+    g_writer_idle_signal.wait(
+        lock,
+        []
+        {
+            return g_pending_saves.size() == 0 && g_saves_in_progress == 0;
+        });
+}
+
+void ConfigWriter::shutdown()
+{
+    {
+        std::lock_guard<std::mutex> lock(g_writer_mutex);
+
+        if (!g_writer_thread_started)
+        {
+            // Leave the flag set so stragglers fall back to synchronous writes
+            g_shutdown_requested = true;
+            return;
+        }
+
+        g_shutdown_requested = true;
+        g_writer_wake_signal.notify_one();
+    }
+
+    g_writer_thread.join();
+
+    std::lock_guard<std::mutex> lock(g_writer_mutex);
+    g_writer_thread_started = false;
+}
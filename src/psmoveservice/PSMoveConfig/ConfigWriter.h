@@ -0,0 +1,36 @@
+#ifndef CONFIG_WRITER_H
+#define CONFIG_WRITER_H
+
+//-- includes -----
+#include <string>
+#include <boost/property_tree/ptree.hpp>
+
+//-- definitions -----
+/**
+Background writer for PSMoveConfig saves.
+
+Calibration flows save configs from the service thread; serializing the JSON
+and hitting the disk inline would stall the update loop. Saves are instead
+queued here and written by a dedicated thread after a short debounce window,
+so repeated saves of the same config (e.g. while dragging a color calibration
+slider) collapse into one write of the latest state. Files are written to a
+temp path and atomically renamed over the target so a crash mid-write never
+leaves a truncated config.
+
+The writer thread starts lazily on the first queued save. Call shutdown()
+during service teardown to flush everything still pending.
+*/
+namespace ConfigWriter
+{
+    /// Queue the given property tree to be written to configPath.
+    /// A newer save for the same path replaces an older pending one.
+    void enqueueSave(const std::string &configPath, const boost::property_tree::ptree &pt);
+
+    /// Block until every pending save has been written to disk
+    void flush();
+
+    /// Flush all pending saves and stop the writer thread
+    void shutdown();
+};
+
+#endif // CONFIG_WRITER_H
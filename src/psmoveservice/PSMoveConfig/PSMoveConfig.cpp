@@ -1,12 +1,24 @@
 #include "PSMoveConfig.h"
+#include "ConfigWriter.h"
 #include "DeviceInterface.h"
 #include "ServerUtility.h"
 #include <boost/filesystem.hpp>
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/json_parser.hpp>
 
+#include <cstdint>
+#include <fstream>
 #include <iostream>
 
+// Binary sidecar cache written next to each JSON config ("<name>.json.cache").
+// The cache stores a hash of the JSON bytes it was built from; on load it is
+// only trusted when that hash still matches, so the JSON stays the
+// human-editable source of truth and hand edits always win.
+static const uint32_t k_config_cache_magic = 0x434D5350; // 'PSMC'
+static const uint32_t k_config_cache_version = 1;
+// Sanity cap on any single string in the cache - configs are small
+static const uint32_t k_config_cache_max_string_length = 1 << 20;
+
 // Format: {hue center, hue range}, {sat center, sat range}, {val center, val range}
 // All hue angles are 60 degrees apart to maximize hue separation for 6 max tracked colors.
 // Hue angle reference: http://i.imgur.com/PKjgfFXm.jpg 
@@ -27,7 +39,7 @@ PSMoveConfig::PSMoveConfig(const std::string &fnamebase)
 }
 
 const std::string
-PSMoveConfig::getConfigPath()
+PSMoveConfig::getConfigDirPath()
 {
     const char *homedir;
 #ifdef _WIN32
@@ -43,19 +55,217 @@ PSMoveConfig::getConfigPath()
         homedir = "/etc/psmoveservice";
     }
 #endif
-    
+
     boost::filesystem::path configpath(homedir);
     configpath /= "PSMoveService";
     boost::filesystem::create_directory(configpath);
+    return configpath.string();
+}
+
+const std::string
+PSMoveConfig::getConfigPath()
+{
+    boost::filesystem::path configpath(getConfigDirPath());
     configpath /= ConfigFileBase + ".json";
     std::cout << "Config file name: " << configpath << std::endl;
     return configpath.string();
 }
 
+static std::string
+config_cache_path_from_config_path(const std::string &configPath)
+{
+    return configPath + ".cache";
+}
+
+static uint64_t
+config_cache_hash_file(const std::string &filePath)
+{
+    // FNV-1a 64 over the raw file bytes
+    uint64_t hash = 0xcbf29ce484222325ull;
+    std::ifstream in(filePath, std::ifstream::in | std::ifstream::binary);
+
+    char buffer[4096];
+    while (in.read(buffer, sizeof(buffer)), in.gcount() > 0)
+    {
+        const std::streamsize byte_count = in.gcount();
+        for (std::streamsize byte_index = 0; byte_index < byte_count; ++byte_index)
+        {
+            hash ^= static_cast<unsigned char>(buffer[byte_index]);
+            hash *= 0x100000001b3ull;
+        }
+    }
+
+    return hash;
+}
+
+static void
+config_cache_write_uint32(std::ofstream &out, uint32_t value)
+{
+    out.write(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+static void
+config_cache_write_uint64(std::ofstream &out, uint64_t value)
+{
+    out.write(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+static void
+config_cache_write_string(std::ofstream &out, const std::string &value)
+{
+    config_cache_write_uint32(out, static_cast<uint32_t>(value.length()));
+    out.write(value.data(), value.length());
+}
+
+static void
+config_cache_write_ptree(std::ofstream &out, const boost::property_tree::ptree &pt)
+{
+    // ptree values are already strings, so the tree serializes as
+    // length-prefixed strings plus child counts - no schema needed
+    config_cache_write_string(out, pt.data());
+    config_cache_write_uint32(out, static_cast<uint32_t>(pt.size()));
+
+    for (const boost::property_tree::ptree::value_type &child : pt)
+    {
+        config_cache_write_string(out, child.first);
+        config_cache_write_ptree(out, child.second);
+    }
+}
+
+static bool
+config_cache_read_uint32(std::ifstream &in, uint32_t &out_value)
+{
+    in.read(reinterpret_cast<char *>(&out_value), sizeof(out_value));
+    return in.good();
+}
+
+static bool
+config_cache_read_uint64(std::ifstream &in, uint64_t &out_value)
+{
+    in.read(reinterpret_cast<char *>(&out_value), sizeof(out_value));
+    return in.good();
+}
+
+static bool
+config_cache_read_string(std::ifstream &in, std::string &out_value)
+{
+    uint32_t length;
+    if (!config_cache_read_uint32(in, length) || length > k_config_cache_max_string_length)
+    {
+        return false;
+    }
+
+    out_value.resize(length);
+    if (length > 0)
+    {
+        in.read(&out_value[0], length);
+    }
+
+    return in.good() || length == 0;
+}
+
+static bool
+config_cache_read_ptree(std::ifstream &in, boost::property_tree::ptree &pt)
+{
+    std::string value;
+    uint32_t child_count;
+
+    if (!config_cache_read_string(in, value) || !config_cache_read_uint32(in, child_count))
+    {
+        return false;
+    }
+    pt.data() = value;
+
+    for (uint32_t child_index = 0; child_index < child_count; ++child_index)
+    {
+        std::string key;
+        if (!config_cache_read_string(in, key))
+        {
+            return false;
+        }
+
+        boost::property_tree::ptree &child = pt.push_back(
+            std::make_pair(key, boost::property_tree::ptree()))->second;
+        if (!config_cache_read_ptree(in, child))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void
+config_cache_save(const std::string &configPath, const boost::property_tree::ptree &pt)
+{
+    std::ofstream out(
+        config_cache_path_from_config_path(configPath),
+        std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+
+    if (out.is_open())
+    {
+        config_cache_write_uint32(out, k_config_cache_magic);
+        config_cache_write_uint32(out, k_config_cache_version);
+        config_cache_write_uint64(out, config_cache_hash_file(configPath));
+        config_cache_write_ptree(out, pt);
+    }
+}
+
+static bool
+config_cache_load(const std::string &configPath, boost::property_tree::ptree &pt)
+{
+    bool bLoadedOk = false;
+    const std::string cachePath = config_cache_path_from_config_path(configPath);
+
+    if (boost::filesystem::exists(cachePath))
+    {
+        std::ifstream in(cachePath, std::ifstream::in | std::ifstream::binary);
+        uint32_t magic, version;
+        uint64_t json_hash;
+
+        if (in.is_open() &&
+            config_cache_read_uint32(in, magic) && magic == k_config_cache_magic &&
+            config_cache_read_uint32(in, version) && version == k_config_cache_version &&
+            config_cache_read_uint64(in, json_hash) && json_hash == config_cache_hash_file(configPath))
+        {
+            // The cache was built from exactly these JSON bytes - trust it.
+            // A truncated/corrupt tree still falls back to the JSON parser.
+            bLoadedOk = config_cache_read_ptree(in, pt);
+        }
+
+        if (!bLoadedOk)
+        {
+            // Stale (hand-edited JSON), old version or corrupt - re-parse the JSON
+            pt.clear();
+        }
+    }
+
+    return bLoadedOk;
+}
+
 void
 PSMoveConfig::save()
 {
-    boost::property_tree::write_json(getConfigPath(), config2ptree());
+    // Serialize the config state on this thread, then let the writer thread
+    // debounce and do the disk I/O so calibration saves never stall a frame
+    ConfigWriter::enqueueSave(getConfigPath(), config2ptree());
+}
+
+void
+PSMoveConfig::writeConfigToDiskAtomic(
+    const std::string &configPath,
+    const boost::property_tree::ptree &pt)
+{
+    // Write to a temp file and rename over the target so a crash mid-write
+    // never leaves a truncated config behind (rename replaces atomically on
+    // POSIX and maps to MOVEFILE_REPLACE_EXISTING on Windows)
+    const std::string tempPath = configPath + ".tmp";
+
+    boost::property_tree::write_json(tempPath, pt);
+    boost::filesystem::rename(tempPath, configPath);
+
+    // Refresh the binary sidecar so the next load skips the JSON parser
+    config_cache_save(configPath, pt);
 }
 
 bool
@@ -67,7 +277,12 @@ PSMoveConfig::load()
 
     if ( boost::filesystem::exists( configPath ) )
     {
-        boost::property_tree::read_json(configPath, pt);
+        // Prefer the binary sidecar when it matches the JSON on disk;
+        // otherwise fall back to the (slow) ptree JSON parser
+        if (!config_cache_load(configPath, pt))
+        {
+            boost::property_tree::read_json(configPath, pt);
+        }
         ptree2config(pt);
         bLoadedOk = true;
     }
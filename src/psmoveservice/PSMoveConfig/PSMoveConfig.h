@@ -19,7 +19,14 @@ public:
 
     virtual const boost::property_tree::ptree config2ptree() = 0;  // Implement by each device class' own Config
     virtual void ptree2config(const boost::property_tree::ptree &pt) = 0;  // Implement by each device class' own Config
-    
+
+    /// Crash-safe config write (temp file + atomic rename + cache refresh).
+    /// Called by the ConfigWriter thread; save() is the normal entry point.
+    static void writeConfigToDiskAtomic(
+        const std::string &configPath,
+        const boost::property_tree::ptree &pt);
+
+
     static void writeColorPreset(
         boost::property_tree::ptree &pt,
         const char *profile_name,
@@ -42,6 +49,10 @@ public:
 	static void writeTrackingColor(boost::property_tree::ptree &pt, int tracking_color_id);
 	static int readTrackingColor(const boost::property_tree::ptree &pt);
 
+    /// Directory all configs (and derived data caches) live in.
+    /// Created on demand.
+    static const std::string getConfigDirPath();
+
 private:
     const std::string getConfigPath();
 };
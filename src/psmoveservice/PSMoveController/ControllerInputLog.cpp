@@ -0,0 +1,172 @@
+//-- includes -----
+#include "ControllerInputLog.h"
+#include "ServerLog.h"
+
+#include <string.h>
+
+//-- constants -----
+// "PSIR" - PlayStation Input Recording
+static const unsigned int k_input_log_magic = 0x52495350;
+static const unsigned int k_input_log_version = 1;
+
+static const size_t k_input_log_serial_size = 32;
+
+//-- private definitions -----
+struct ControllerInputLogFileHeader
+{
+    unsigned int magic;
+    unsigned int version;
+    unsigned int device_type;
+    unsigned int report_size;
+    char serial[k_input_log_serial_size];
+};
+
+//-- public methods -----
+// -- ControllerInputLogWriter --
+ControllerInputLogWriter::ControllerInputLogWriter(
+    const std::string &path,
+    const CommonDeviceState::eDeviceType device_type,
+    const size_t report_size,
+    const std::string &serial)
+    : m_stream(path, std::ios::binary | std::ios::trunc)
+    , m_report_size(report_size)
+    , m_bWroteFirstReport(false)
+{
+    if (m_stream.is_open())
+    {
+        ControllerInputLogFileHeader header;
+
+        memset(&header, 0, sizeof(header));
+        header.magic = k_input_log_magic;
+        header.version = k_input_log_version;
+        header.device_type = static_cast<unsigned int>(device_type);
+        header.report_size = static_cast<unsigned int>(report_size);
+        strncpy(header.serial, serial.c_str(), k_input_log_serial_size - 1);
+
+        m_stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+        SERVER_LOG_INFO("ControllerInputLogWriter") << "Recording input reports to: " << path;
+    }
+    else
+    {
+        SERVER_LOG_ERROR("ControllerInputLogWriter") << "Failed to open input report log for writing: " << path;
+    }
+}
+
+ControllerInputLogWriter::~ControllerInputLogWriter()
+{
+    if (m_stream.is_open())
+    {
+        m_stream.close();
+    }
+}
+
+bool ControllerInputLogWriter::getIsOpen() const
+{
+    return m_stream.is_open();
+}
+
+void ControllerInputLogWriter::writeReport(const unsigned char *report_bytes)
+{
+    if (m_stream.is_open())
+    {
+        const std::chrono::time_point<std::chrono::high_resolution_clock> now =
+            std::chrono::high_resolution_clock::now();
+
+        if (!m_bWroteFirstReport)
+        {
+            m_first_report_time = now;
+            m_bWroteFirstReport = true;
+        }
+
+        const unsigned long long timestamp_us =
+            static_cast<unsigned long long>(
+                std::chrono::duration_cast<std::chrono::microseconds>(now - m_first_report_time).count());
+
+        m_stream.write(reinterpret_cast<const char *>(&timestamp_us), sizeof(timestamp_us));
+        m_stream.write(reinterpret_cast<const char *>(report_bytes), m_report_size);
+    }
+}
+
+void ControllerInputLogWriter::writeReportWithTimestamp(
+    const unsigned char *report_bytes,
+    const unsigned long long timestamp_us)
+{
+    if (m_stream.is_open())
+    {
+        m_stream.write(reinterpret_cast<const char *>(&timestamp_us), sizeof(timestamp_us));
+        m_stream.write(reinterpret_cast<const char *>(report_bytes), m_report_size);
+    }
+}
+
+// -- ControllerInputLogReader --
+ControllerInputLogReader::ControllerInputLogReader()
+    : m_device_type(CommonDeviceState::SUPPORTED_CONTROLLER_TYPE_COUNT) // invalid
+    , m_report_size(0)
+{
+}
+
+bool ControllerInputLogReader::load(const std::string &path)
+{
+    bool bSuccess = false;
+
+    std::ifstream stream(path, std::ios::binary);
+
+    if (stream.is_open())
+    {
+        ControllerInputLogFileHeader header;
+
+        stream.read(reinterpret_cast<char *>(&header), sizeof(header));
+
+        if (stream.good() &&
+            header.magic == k_input_log_magic &&
+            header.version == k_input_log_version &&
+            header.report_size > 0)
+        {
+            header.serial[k_input_log_serial_size - 1] = '\0';
+
+            m_device_type = static_cast<CommonDeviceState::eDeviceType>(header.device_type);
+            m_report_size = header.report_size;
+            m_serial = header.serial;
+            m_records.clear();
+
+            while (true)
+            {
+                ControllerInputLogRecord record;
+
+                stream.read(reinterpret_cast<char *>(&record.timestamp_us), sizeof(record.timestamp_us));
+                if (!stream.good())
+                {
+                    break;
+                }
+
+                record.report.resize(m_report_size);
+                stream.read(reinterpret_cast<char *>(record.report.data()), m_report_size);
+                if (!stream.good())
+                {
+                    // Truncated trailing record (recording was cut off mid-write)
+                    break;
+                }
+
+                m_records.push_back(record);
+            }
+
+            bSuccess = m_records.size() > 0;
+
+            if (!bSuccess)
+            {
+                SERVER_LOG_ERROR("ControllerInputLogReader") << "Input report log has no complete records: " << path;
+            }
+        }
+        else
+        {
+            SERVER_LOG_ERROR("ControllerInputLogReader") << "Not a valid input report log: " << path;
+        }
+    }
+    else
+    {
+        SERVER_LOG_ERROR("ControllerInputLogReader") << "Failed to open input report log for reading: " << path;
+    }
+
+    return bSuccess;
+}
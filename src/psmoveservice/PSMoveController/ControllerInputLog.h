@@ -0,0 +1,72 @@
+#ifndef CONTROLLER_INPUT_LOG_H
+#define CONTROLLER_INPUT_LOG_H
+
+//-- includes -----
+#include "DeviceInterface.h"
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <vector>
+
+//-- definitions -----
+/// One raw input report captured from a controller, stamped with the
+/// microseconds elapsed since the first report in the log
+struct ControllerInputLogRecord
+{
+    unsigned long long timestamp_us;
+    std::vector<unsigned char> report;
+};
+
+/// Appends raw timestamped HID input reports to a compact binary log.
+/// Created by a controller's open() when its config asks for recording;
+/// the resulting file can be replayed through a VirtualController so filter
+/// and pipeline changes can be benchmarked against identical input streams.
+class ControllerInputLogWriter
+{
+public:
+    ControllerInputLogWriter(
+        const std::string &path,
+        const CommonDeviceState::eDeviceType device_type,
+        const size_t report_size,
+        const std::string &serial);
+    ~ControllerInputLogWriter();
+
+    bool getIsOpen() const;
+
+    /// Append one raw report (report_size bytes) stamped with the time
+    /// elapsed since the first report written
+    void writeReport(const unsigned char *report_bytes);
+
+    /// Append one raw report with a caller-supplied timestamp, for
+    /// converting reports recorded elsewhere (see SessionCapture)
+    void writeReportWithTimestamp(const unsigned char *report_bytes, const unsigned long long timestamp_us);
+
+private:
+    std::ofstream m_stream;
+    size_t m_report_size;
+    bool m_bWroteFirstReport;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_first_report_time;
+};
+
+/// Loads a controller input report log written by ControllerInputLogWriter
+/// into memory for replay
+class ControllerInputLogReader
+{
+public:
+    ControllerInputLogReader();
+
+    bool load(const std::string &path);
+
+    inline CommonDeviceState::eDeviceType getDeviceType() const { return m_device_type; }
+    inline size_t getReportSize() const { return m_report_size; }
+    inline const std::string &getSerial() const { return m_serial; }
+    inline const std::vector<ControllerInputLogRecord> &getRecords() const { return m_records; }
+
+private:
+    CommonDeviceState::eDeviceType m_device_type;
+    size_t m_report_size;
+    std::string m_serial;
+    std::vector<ControllerInputLogRecord> m_records;
+};
+
+#endif // CONTROLLER_INPUT_LOG_H
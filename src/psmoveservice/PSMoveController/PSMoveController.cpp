@@ -35,8 +35,10 @@ POSSIBILITY OF SUCH DAMAGE.
 
 //-- includes -----
 #include "PSMoveController.h"
+#include "ControllerInputLog.h"
 #include "ControllerDeviceEnumerator.h"
 #include "ServerLog.h"
+#include "SessionCapture.h"
 #include "ServerUtility.h"
 #include "BluetoothQueries.h"
 #include "MathAlignment.h"
@@ -62,7 +64,6 @@ POSSIBILITY OF SUCH DAMAGE.
 #define PSMOVE_FW_GET_SIZE 13
 #define PSMOVE_CALIBRATION_SIZE 49 /* Buffer size for calibration data */
 #define PSMOVE_CALIBRATION_BLOB_SIZE (PSMOVE_CALIBRATION_SIZE*3 - 2*2) /* Three blocks, minus header (2 bytes) for blocks 2,3 */
-#define PSMOVE_STATE_BUFFER_MAX 16
 
 #define PSMOVE_TRACKING_BULB_RADIUS  2.25f // The radius of the psmove tracking bulb in cm
 
@@ -206,6 +207,7 @@ PSMoveControllerConfig::config2ptree()
 
     pt.put("prediction_time", prediction_time);
     pt.put("max_poll_failure_count", max_poll_failure_count);
+    pt.put("record_input_stream", record_input_stream);
     
     pt.put("Calibration.Accel.X.k", cal_ag_xyz_kb[0][0][0]);
     pt.put("Calibration.Accel.X.b", cal_ag_xyz_kb[0][0][1]);
@@ -227,6 +229,8 @@ PSMoveControllerConfig::config2ptree()
     pt.put("Calibration.Gyro.Variance", gyro_variance);
     pt.put("Calibration.Gyro.Drift", gyro_drift);
 
+    pt.put("Calibration.ForceReload", force_reload_calibration);
+
     pt.put("Calibration.Magnetometer.Center.X", magnetometer_center.i);
     pt.put("Calibration.Magnetometer.Center.Y", magnetometer_center.j);
     pt.put("Calibration.Magnetometer.Center.Z", magnetometer_center.k);
@@ -264,6 +268,14 @@ PSMoveControllerConfig::config2ptree()
 	pt.put("PositionFilter.FilterType", position_filter_type);
     pt.put("PositionFilter.MaxVelocity", max_velocity);
 
+	pt.put("FilterWarmStart.ValueCount", static_cast<int>(filter_warm_start_state.size()));
+	for (size_t value_index = 0; value_index < filter_warm_start_state.size(); ++value_index)
+	{
+		const std::string key = "FilterWarmStart.Value_" + std::to_string(value_index);
+
+		pt.put(key, filter_warm_start_state[value_index]);
+	}
+
 	writeTrackingColor(pt, tracking_color_id);
 
     return pt;
@@ -284,6 +296,7 @@ PSMoveControllerConfig::ptree2config(const boost::property_tree::ptree &pt)
 
         prediction_time = pt.get<float>("prediction_time", 0.f);
         max_poll_failure_count = pt.get<long>("max_poll_failure_count", 100);
+        record_input_stream = pt.get<bool>("record_input_stream", false);
 
         cal_ag_xyz_kb[0][0][0] = pt.get<float>("Calibration.Accel.X.k", 1.0f);
         cal_ag_xyz_kb[0][0][1] = pt.get<float>("Calibration.Accel.X.b", 0.0f);
@@ -305,6 +318,8 @@ PSMoveControllerConfig::ptree2config(const boost::property_tree::ptree &pt)
         gyro_variance= pt.get<float>("Calibration.Gyro.Variance", gyro_variance);
         gyro_drift= pt.get<float>("Calibration.Gyro.Drift", gyro_drift);
 
+        force_reload_calibration = pt.get<bool>("Calibration.ForceReload", false);
+
         magnetometer_center.i = pt.get<float>("Calibration.Magnetometer.Center.X", 0.f);
         magnetometer_center.j = pt.get<float>("Calibration.Magnetometer.Center.Y", 0.f);
         magnetometer_center.k = pt.get<float>("Calibration.Magnetometer.Center.Z", 0.f);
@@ -344,6 +359,15 @@ PSMoveControllerConfig::ptree2config(const boost::property_tree::ptree &pt)
 		position_filter_type= pt.get<std::string>("PositionFilter.FilterType", position_filter_type);
         max_velocity= pt.get<float>("PositionFilter.MaxVelocity", max_velocity);
 
+		filter_warm_start_state.clear();
+		const int warm_start_value_count = pt.get<int>("FilterWarmStart.ValueCount", 0);
+		for (int value_index = 0; value_index < warm_start_value_count; ++value_index)
+		{
+			const std::string key = "FilterWarmStart.Value_" + std::to_string(value_index);
+
+			filter_warm_start_state.push_back(pt.get<double>(key, 0.0));
+		}
+
 		tracking_color_id= static_cast<eCommonTrackingColorID>(readTrackingColor(pt));
     }
     else
@@ -355,7 +379,7 @@ PSMoveControllerConfig::ptree2config(const boost::property_tree::ptree &pt)
 }
 
 void
-PSMoveControllerConfig::getMegnetometerEllipsoid(struct EigenFitEllipsoid *out_ellipsoid)
+PSMoveControllerConfig::getMegnetometerEllipsoid(struct EigenFitEllipsoid *out_ellipsoid) const
 {
     out_ellipsoid->center =
         Eigen::Vector3f(magnetometer_center.i, magnetometer_center.j, magnetometer_center.k);
@@ -386,12 +410,14 @@ PSMoveController::PSMoveController()
     InData = new PSMoveDataInput;
     InData->type = PSMove_Req_GetInput;
 
+    InputLogWriter = nullptr;
+
     // Make sure there is an initial empty state in the tracker queue
     {     
         PSMoveControllerState empty_state;
 
         empty_state.clear();
-        ControllerStates.push_back(empty_state);
+        ControllerStates.push(empty_state);
     }
 }
 
@@ -502,15 +528,29 @@ bool PSMoveController::open(
                 cfg = PSMoveControllerConfig(btaddr);
                 cfg.load();
 
-                if (!IsBluetooth || !cfg.is_valid)
+                if (!cfg.is_valid || cfg.force_reload_calibration)
                 {
                     if (!cfg.is_valid)
                     {
                         SERVER_LOG_ERROR("PSMoveController::open") << "PSMoveController(" << cur_dev_path << ") has invalid calibration. Reloading.";
                     }
+                    else
+                    {
+                        SERVER_LOG_INFO("PSMoveController::open") << "Calibration reload forced by config.";
+                    }
 
                     // Load calibration from controller internal memory.
                     loadCalibration();
+
+                    // The refresh was honored - clear the flag so the saved
+                    // config doesn't force a reload on every open
+                    cfg.force_reload_calibration= false;
+                }
+                else
+                {
+                    // Skip the slow (and occasionally flaky) flash read and
+                    // use the parsed calibration cached in the config
+                    SERVER_LOG_INFO("PSMoveController::open") << "Using cached calibration from config.";
                 }
 
 				// Always save the config back out in case some defaults changed
@@ -565,6 +605,20 @@ bool PSMoveController::open(
 				cfg.save();
 			}
 
+			// Start recording raw input reports if the config asks for it
+			if (success && IsBluetooth && cfg.record_input_stream)
+			{
+				std::string btaddr = HIDDetails.Bt_addr;
+				std::replace(btaddr.begin(), btaddr.end(), ':', '_');
+
+				InputLogWriter =
+					new ControllerInputLogWriter(
+						PSMoveConfig::getConfigDirPath() + "/InputRecording_" + btaddr + ".psmoverec",
+						CommonDeviceState::PSMove,
+						sizeof(PSMoveDataInput),
+						HIDDetails.Bt_addr);
+			}
+
             // Reset the polling sequence counter
             NextPollSequenceNumber= 0;
         }
@@ -584,6 +638,12 @@ void PSMoveController::close()
     {
         SERVER_LOG_INFO("PSMoveController::close") << "Closing PSMoveController(" << HIDDetails.Device_path << ")";
 
+        if (InputLogWriter != nullptr)
+        {
+            delete InputLogWriter;
+            InputLogWriter= nullptr;
+        }
+
         if (HIDDetails.Handle != nullptr)
         {
             hid_close(HIDDetails.Handle);
@@ -676,6 +736,21 @@ PSMoveController::setTrackingColorID(const eCommonTrackingColorID tracking_color
 	return bSuccess;
 }
 
+bool
+PSMoveController::setFilterWarmStartState(const std::vector<double> &values)
+{
+	bool bSuccess = false;
+
+	if (getIsOpen())
+	{
+		cfg.filter_warm_start_state = values;
+		cfg.save();
+		bSuccess = true;
+	}
+
+	return bSuccess;
+}
+
 // Getters
 bool 
 PSMoveController::matchesDeviceEnumerator(const DeviceEnumerator *enumerator) const
@@ -1060,127 +1135,43 @@ PSMoveController::poll()
                 result = IControllerInterface::_PollResultSuccessNewData;
             }
         
-            // https://github.com/nitsch/moveonpc/wiki/Input-report
-            PSMoveControllerState newState;
-        
-            // Increment the sequence for every new polling packet
-            newState.PollSequenceNumber= NextPollSequenceNumber;
-            ++NextPollSequenceNumber;
-
-            // Buttons
-            newState.AllButtons = (InData->buttons2) | (InData->buttons1 << 8) |
-                ((InData->buttons3 & 0x01) << 16) | ((InData->buttons4 & 0xF0) << 13);
-        
-            unsigned int lastButtons = ControllerStates.empty() ? 0 : ControllerStates.back().AllButtons;
-
-            newState.Triangle = getButtonState(newState.AllButtons, lastButtons, Btn_TRIANGLE);
-            newState.Circle = getButtonState(newState.AllButtons, lastButtons, Btn_CIRCLE);
-            newState.Cross = getButtonState(newState.AllButtons, lastButtons, Btn_CROSS);
-            newState.Square = getButtonState(newState.AllButtons, lastButtons, Btn_SQUARE);
-            newState.Select = getButtonState(newState.AllButtons, lastButtons, Btn_SELECT);
-            newState.Start = getButtonState(newState.AllButtons, lastButtons, Btn_START);
-            newState.PS = getButtonState(newState.AllButtons, lastButtons, Btn_PS);
-            newState.Move = getButtonState(newState.AllButtons, lastButtons, Btn_MOVE);
-            newState.Trigger = getButtonState(newState.AllButtons, lastButtons, Btn_T);
-            newState.TriggerValue = (InData->trigger + InData->trigger2) / 2; // TODO: store each frame separately
-
-            // Update raw and calibrated accelerometer and gyroscope state
+            // Append the raw report to the input recording before any parsing
+            // so the log captures exactly what the controller sent
+            if (InputLogWriter != nullptr)
             {
-                // Access raw Accel and Gyro state from the DataInput struct as a byte array
-                char* data = (char *)InData;
-
-                // Extract Accelerometer and Gyroscope readings into in a set of two update frames.
-                // Note: The double brackets are an oddity of C++11 static array initialization.
-                std::array<std::array<std::array<int, 3>, 2>, 2> ag_raw_xyz = {{
-                    {{ {{ 0, 0, 0 }}, {{ 0, 0, 0 }} }},
-                    {{ {{ 0, 0, 0 }}, {{ 0, 0, 0 }} }}
-                }};
-                std::array<std::array<std::array<float, 3>, 2>, 2> ag_calibrated_xyz = {{
-                    {{ {{ 0, 0, 0 }}, {{ 0, 0, 0 }} }},
-                    {{ {{ 0, 0, 0 }}, {{ 0, 0, 0 }} }}
-                }};
-                std::array<int, 2> sensorOffsets = {{
-                    offsetof(PSMoveDataInput, aXlow),
-                    offsetof(PSMoveDataInput, gXlow)
-                }};
-                std::array<int, 2> frameOffsets = {{ 0, 6 }};
-
-                for (std::array<int, 2>::size_type s_ix = 0; s_ix != sensorOffsets.size(); s_ix++) //accel, gyro
-                {
-                    for (std::array<int, 2>::size_type f_ix = 0; f_ix != frameOffsets.size(); f_ix++) //older, newer
-                    {
-                        for (int d_ix = 0; d_ix < 3; d_ix++)  //x, y, z
-                        {
-                            // Offset into PSMoveDataInput
-                            const int totalOffset = sensorOffsets[s_ix] + frameOffsets[f_ix] + 2 * d_ix;
-
-                            // Extract the raw signed 16-bit sensor value from the PSMoveDataInput packet
-                            const int raw_val = ((data[totalOffset] & 0xFF) | (((data[totalOffset + 1]) & 0xFF) << 8)) - 0x8000;
-
-                            // Get the calibration parameters for this sensor value
-                            const float k = cfg.cal_ag_xyz_kb[s_ix][d_ix][0]; // calibration scale
-                            const float b = cfg.cal_ag_xyz_kb[s_ix][d_ix][1]; // calibration offset
-
-                            // Save the raw sensor value
-                            ag_raw_xyz[s_ix][f_ix][d_ix] = raw_val;
-
-                            // Compute the calibrated sensor value
-                            ag_calibrated_xyz[s_ix][f_ix][d_ix] = static_cast<float>(raw_val)*k + b;
-                        }
-                    }
-                }
-
-                newState.RawAccel = ag_raw_xyz[0];
-                newState.RawGyro = ag_raw_xyz[1];
-
-                newState.CalibratedAccel = ag_calibrated_xyz[0];
-                newState.CalibratedGyro = ag_calibrated_xyz[1];
+                InputLogWriter->writeReport(reinterpret_cast<const unsigned char *>(InData));
             }
 
-            // Update the raw and calibrated magnetometer
+            // Feed the whole-session recorder as well (one atomic load when off)
+            if (SessionCapture::getIsRecording())
             {
-                Eigen::Vector3f raw_mag, calibrated_mag;
-                EigenFitEllipsoid ellipsoid;
-
-                // Save the Raw Magnetometer sensor value (signed 12-bit values)
-                newState.RawMag[0] = TWELVE_BIT_SIGNED(((InData->templow_mXhigh & 0x0F) << 8) | InData->mXlow);
-                // The magnetometer y-axis is flipped compared to the accelerometer and gyro.
-                // Flip it back around to get it into the same space.
-                newState.RawMag[1] = -TWELVE_BIT_SIGNED((InData->mYhigh << 4) | (InData->mYlow_mZhigh & 0xF0) >> 4);
-                newState.RawMag[2] = TWELVE_BIT_SIGNED(((InData->mYlow_mZhigh & 0x0F) << 8) | InData->mZlow);
-
-                // Project the raw magnetometer sample into the space of the ellipsoid
-                raw_mag = 
-                    Eigen::Vector3f(
-                        static_cast<float>(newState.RawMag[0]), 
-                        static_cast<float>(newState.RawMag[1]),
-                        static_cast<float>(newState.RawMag[2]));
-                cfg.getMegnetometerEllipsoid(&ellipsoid);
-                calibrated_mag= eigen_alignment_project_point_on_ellipsoid_basis(raw_mag, ellipsoid);
-
-                // Normalize the projected measurement (any deviation from unit length is error)
-				eigen_vector3f_normalize_with_default(calibrated_mag, Eigen::Vector3f(0.f, 1.f, 0.f));
-
-                // Save the calibrated magnetometer vector
-                newState.CalibratedMag[0] = calibrated_mag.x();
-                newState.CalibratedMag[1] = calibrated_mag.y();
-                newState.CalibratedMag[2] = calibrated_mag.z();
+                SessionCapture::recordControllerReport(
+                    HIDDetails.Bt_addr, CommonDeviceState::PSMove,
+                    reinterpret_cast<const unsigned char *>(InData), sizeof(PSMoveDataInput));
             }
+
+            // https://github.com/nitsch/moveonpc/wiki/Input-report
+            PSMoveControllerState newState;
         
-            // Other
-            newState.RawSequence = (InData->buttons4 & 0x0F);
-            newState.Battery = static_cast<CommonControllerState::BatteryLevel>(InData->battery);
-            newState.RawTimeStamp = InData->timelow | (InData->timehigh << 8);
-            newState.TempRaw = (InData->temphigh << 4) | ((InData->templow_mXhigh & 0xF0) >> 4);
-
-            // Make room for new entry if at the max queue size
-            if (ControllerStates.size() >= PSMOVE_STATE_BUFFER_MAX)
-            {
-                ControllerStates.erase(ControllerStates.begin(),
-                    ControllerStates.begin() + ControllerStates.size() - PSMOVE_STATE_BUFFER_MAX);
-            }
+            // Increment the sequence for every new polling packet
+            newState.PollSequenceNumber= NextPollSequenceNumber;
+            ++NextPollSequenceNumber;
 
-            ControllerStates.push_back(newState);
+            // Record when the report was drained so the filter can batch the
+            // drained states with real per-sample time deltas
+            newState.PollTimestamp= std::chrono::high_resolution_clock::now();
+            newState.bPollTimestampValid= true;
+
+            // Parse the report into button, sensor and battery state
+            parseInputReport(
+                reinterpret_cast<const unsigned char *>(InData),
+                sizeof(PSMoveDataInput),
+                cfg,
+                ControllerStates.back(),
+                newState);
+
+            // The ring recycles its oldest slot once full - no allocation
+            ControllerStates.push(newState);
         }
 
         // Update recurrent writes on a regular interval
@@ -1200,15 +1191,141 @@ PSMoveController::poll()
     return result;
 }
 
+bool
+PSMoveController::parseInputReport(
+    const unsigned char *report_bytes,
+    const size_t report_size,
+    const PSMoveControllerConfig &config,
+    const PSMoveControllerState *last_state,
+    PSMoveControllerState &out_state)
+{
+    if (report_size != sizeof(PSMoveDataInput))
+    {
+        return false;
+    }
+
+    const PSMoveDataInput *in_data = reinterpret_cast<const PSMoveDataInput *>(report_bytes);
+
+    // Buttons
+    out_state.AllButtons = (in_data->buttons2) | (in_data->buttons1 << 8) |
+        ((in_data->buttons3 & 0x01) << 16) | ((in_data->buttons4 & 0xF0) << 13);
+
+    unsigned int lastButtons = (last_state != nullptr) ? last_state->AllButtons : 0;
+
+    out_state.Triangle = getButtonState(out_state.AllButtons, lastButtons, Btn_TRIANGLE);
+    out_state.Circle = getButtonState(out_state.AllButtons, lastButtons, Btn_CIRCLE);
+    out_state.Cross = getButtonState(out_state.AllButtons, lastButtons, Btn_CROSS);
+    out_state.Square = getButtonState(out_state.AllButtons, lastButtons, Btn_SQUARE);
+    out_state.Select = getButtonState(out_state.AllButtons, lastButtons, Btn_SELECT);
+    out_state.Start = getButtonState(out_state.AllButtons, lastButtons, Btn_START);
+    out_state.PS = getButtonState(out_state.AllButtons, lastButtons, Btn_PS);
+    out_state.Move = getButtonState(out_state.AllButtons, lastButtons, Btn_MOVE);
+    out_state.Trigger = getButtonState(out_state.AllButtons, lastButtons, Btn_T);
+    out_state.TriggerValue = (in_data->trigger + in_data->trigger2) / 2; // TODO: store each frame separately
+
+    // Update raw and calibrated accelerometer and gyroscope state
+    {
+        // Access raw Accel and Gyro state from the DataInput struct as a byte array
+        char* data = (char *)in_data;
+
+        // Extract Accelerometer and Gyroscope readings into in a set of two update frames.
+        // Note: The double brackets are an oddity of C++11 static array initialization.
+        std::array<std::array<std::array<int, 3>, 2>, 2> ag_raw_xyz = {{
+            {{ {{ 0, 0, 0 }}, {{ 0, 0, 0 }} }},
+            {{ {{ 0, 0, 0 }}, {{ 0, 0, 0 }} }}
+        }};
+        std::array<std::array<std::array<float, 3>, 2>, 2> ag_calibrated_xyz = {{
+            {{ {{ 0, 0, 0 }}, {{ 0, 0, 0 }} }},
+            {{ {{ 0, 0, 0 }}, {{ 0, 0, 0 }} }}
+        }};
+        std::array<int, 2> sensorOffsets = {{
+            offsetof(PSMoveDataInput, aXlow),
+            offsetof(PSMoveDataInput, gXlow)
+        }};
+        std::array<int, 2> frameOffsets = {{ 0, 6 }};
+
+        for (std::array<int, 2>::size_type s_ix = 0; s_ix != sensorOffsets.size(); s_ix++) //accel, gyro
+        {
+            for (std::array<int, 2>::size_type f_ix = 0; f_ix != frameOffsets.size(); f_ix++) //older, newer
+            {
+                for (int d_ix = 0; d_ix < 3; d_ix++)  //x, y, z
+                {
+                    // Offset into PSMoveDataInput
+                    const int totalOffset = sensorOffsets[s_ix] + frameOffsets[f_ix] + 2 * d_ix;
+
+                    // Extract the raw signed 16-bit sensor value from the PSMoveDataInput packet
+                    const int raw_val = ((data[totalOffset] & 0xFF) | (((data[totalOffset + 1]) & 0xFF) << 8)) - 0x8000;
+
+                    // Get the calibration parameters for this sensor value
+                    const float k = config.cal_ag_xyz_kb[s_ix][d_ix][0]; // calibration scale
+                    const float b = config.cal_ag_xyz_kb[s_ix][d_ix][1]; // calibration offset
+
+                    // Save the raw sensor value
+                    ag_raw_xyz[s_ix][f_ix][d_ix] = raw_val;
+
+                    // Compute the calibrated sensor value
+                    ag_calibrated_xyz[s_ix][f_ix][d_ix] = static_cast<float>(raw_val)*k + b;
+                }
+            }
+        }
+
+        out_state.RawAccel = ag_raw_xyz[0];
+        out_state.RawGyro = ag_raw_xyz[1];
+
+        out_state.CalibratedAccel = ag_calibrated_xyz[0];
+        out_state.CalibratedGyro = ag_calibrated_xyz[1];
+    }
+
+    // Update the raw and calibrated magnetometer
+    {
+        Eigen::Vector3f raw_mag, calibrated_mag;
+        EigenFitEllipsoid ellipsoid;
+
+        // Save the Raw Magnetometer sensor value (signed 12-bit values)
+        out_state.RawMag[0] = TWELVE_BIT_SIGNED(((in_data->templow_mXhigh & 0x0F) << 8) | in_data->mXlow);
+        // The magnetometer y-axis is flipped compared to the accelerometer and gyro.
+        // Flip it back around to get it into the same space.
+        out_state.RawMag[1] = -TWELVE_BIT_SIGNED((in_data->mYhigh << 4) | (in_data->mYlow_mZhigh & 0xF0) >> 4);
+        out_state.RawMag[2] = TWELVE_BIT_SIGNED(((in_data->mYlow_mZhigh & 0x0F) << 8) | in_data->mZlow);
+
+        // Project the raw magnetometer sample into the space of the ellipsoid
+        raw_mag = 
+            Eigen::Vector3f(
+                static_cast<float>(out_state.RawMag[0]), 
+                static_cast<float>(out_state.RawMag[1]),
+                static_cast<float>(out_state.RawMag[2]));
+        config.getMegnetometerEllipsoid(&ellipsoid);
+        calibrated_mag= eigen_alignment_project_point_on_ellipsoid_basis(raw_mag, ellipsoid);
+
+        // Normalize the projected measurement (any deviation from unit length is error)
+        eigen_vector3f_normalize_with_default(calibrated_mag, Eigen::Vector3f(0.f, 1.f, 0.f));
+
+        // Save the calibrated magnetometer vector
+        out_state.CalibratedMag[0] = calibrated_mag.x();
+        out_state.CalibratedMag[1] = calibrated_mag.y();
+        out_state.CalibratedMag[2] = calibrated_mag.z();
+    }
+
+    // Other
+    out_state.RawSequence = (in_data->buttons4 & 0x0F);
+    out_state.Battery = static_cast<CommonControllerState::BatteryLevel>(in_data->battery);
+    out_state.RawTimeStamp = in_data->timelow | (in_data->timehigh << 8);
+    out_state.TempRaw = (in_data->temphigh << 4) | ((in_data->templow_mXhigh & 0xF0) >> 4);
+
+    return true;
+}
+
+size_t
+PSMoveController::getInputReportSize()
+{
+    return sizeof(PSMoveDataInput);
+}
+
 const CommonDeviceState * 
 PSMoveController::getState(
     int lookBack) const
 {
-    const int queueSize= static_cast<int>(ControllerStates.size());
-    const CommonDeviceState * result=
-        (lookBack < queueSize) ? &ControllerStates.at(queueSize - lookBack - 1) : nullptr;
-
-    return result;
+    return ControllerStates.getLookBackState(lookBack);
 }
 
 const std::tuple<unsigned char, unsigned char, unsigned char>
@@ -1298,7 +1415,8 @@ PSMoveController::writeDataOut()
 {
     bool bSuccess= true;
 
-    if (bWriteStateDirty)
+    // Replay-backed virtual controllers have no HID handle to write to
+    if (bWriteStateDirty && HIDDetails.Handle != nullptr)
     {
         PSMoveDataOutput data_out = PSMoveDataOutput();  // 0-initialized
         data_out.type = PSMove_Req_SetLEDs;
@@ -4,12 +4,15 @@
 #include "PSMoveConfig.h"
 #include "DeviceEnumerator.h"
 #include "DeviceInterface.h"
+#include "DeviceStateRingBuffer.h"
 #include "MathUtility.h"
 #include "hidapi.h"
 #include <string>
 #include <array>
-#include <deque>
 #include <chrono>
+#include <vector>
+
+#define PSMOVE_STATE_BUFFER_MAX 16
 
 struct PSMoveHIDDetails {
     std::string Device_path;
@@ -35,13 +38,15 @@ public:
 		, bt_firmware_version(0)
 		, firmware_revision(0)
         , max_poll_failure_count(100) 
+        , record_input_stream(false)
         , prediction_time(0.f)
 		, position_filter_type("LowPassExponential")
 		, orientation_filter_type("ComplementaryMARG")
-        , cal_ag_xyz_kb({{ 
+        , cal_ag_xyz_kb({{
             {{ {{0, 0}}, {{0, 0}}, {{0, 0}} }},
-            {{ {{0, 0}}, {{0, 0}}, {{0, 0}} }} 
+            {{ {{0, 0}}, {{0, 0}}, {{0, 0}} }}
         }})
+        , force_reload_calibration(false)
         , magnetometer_fit_error(0.f)
 		, magnetometer_variance(0.00059f) // rounded value from config tool measurement
 		, accelerometer_variance(7.2e-06f) // rounded value from config tool measurement
@@ -67,7 +72,7 @@ public:
     virtual const boost::property_tree::ptree config2ptree();
     virtual void ptree2config(const boost::property_tree::ptree &pt);
 
-    void getMegnetometerEllipsoid(struct EigenFitEllipsoid *out_ellipsoid);
+    void getMegnetometerEllipsoid(struct EigenFitEllipsoid *out_ellipsoid) const;
 
     bool is_valid;
     long version;
@@ -85,6 +90,11 @@ public:
 	// The max number of polling failures before we consider the controller disconnected
     long max_poll_failure_count;
 
+	// When true, record the raw timestamped input reports drained by poll()
+	// to a binary log that a VirtualController can replay for deterministic
+	// benchmarking (see ControllerInputLog.h)
+	bool record_input_stream;
+
 	// The amount of prediction to apply to the controller pose after filtering
     float prediction_time;
 
@@ -97,6 +107,10 @@ public:
 	// The accelerometer and gyroscope scale and bias values read from the USB calibration packet
     std::array<std::array<std::array<float, 2>, 3>, 2> cal_ag_xyz_kb;
 
+	// When true, re-read the calibration blob from controller flash on the next
+	// open even if this config already holds a valid parsed calibration
+	bool force_reload_calibration;
+
 	// The direction of the magnetometer when in the identity pose
     CommonDeviceVector magnetometer_identity;
 
@@ -146,6 +160,10 @@ public:
 
 	// The assigned tracking color for this controller
 	eCommonTrackingColorID tracking_color_id;
+
+	// Converged filter covariance/bias state captured on the last clean shutdown,
+	// used to warm-start the pose filter instead of reconverging from scratch
+	std::vector<double> filter_warm_start_state;
 };
 
 // https://code.google.com/p/moveonpc/wiki/InputReport
@@ -243,6 +261,7 @@ public:
     // -- IControllerInterface
     virtual bool setHostBluetoothAddress(const std::string &address) override;
 	virtual bool setTrackingColorID(const eCommonTrackingColorID tracking_color_id) override;
+	virtual bool setFilterWarmStartState(const std::vector<double> &values) override;
     virtual bool getIsBluetooth() const override;
     virtual std::string getUSBDevicePath() const override;
     virtual std::string getAssignedHostBluetoothAddress() const override;
@@ -272,18 +291,34 @@ public:
     bool setRumbleIntensity(unsigned char value);
 	bool enableDFUMode(); // Device Firmware Update mode
 
+protected:
+    // Parse one raw input report into a controller state using the given
+    // calibration. Shared with VirtualController, which replays recorded
+    // input report logs through the same parsing as live hardware.
+    static bool parseInputReport(
+        const unsigned char *report_bytes,
+        const size_t report_size,
+        const PSMoveControllerConfig &config,
+        const PSMoveControllerState *last_state,
+        PSMoveControllerState &out_state);
+    static size_t getInputReportSize();
+
+    // Constant while a controller is open
+    PSMoveControllerConfig cfg;
+    PSMoveHIDDetails HIDDetails;
+    bool IsBluetooth;                               // true if valid serial number on device opening
+	bool SupportsMagnetometer;                      // true if controller emits valid magnetometer data
+
+    // Read Controller State
+    int NextPollSequenceNumber;
+    DeviceStateRingBuffer<PSMoveControllerState, PSMOVE_STATE_BUFFER_MAX> ControllerStates;
+
 private:    
     bool getBTAddress(std::string& host, std::string& controller);
     void loadCalibration();                         // Use USB or file if on BT
 	bool loadFirmwareInfo();
     
     bool writeDataOut();                            // Setters will call this
-    
-    // Constant while a controller is open
-    PSMoveControllerConfig cfg;
-    PSMoveHIDDetails HIDDetails;
-    bool IsBluetooth;                               // true if valid serial number on device opening
-	bool SupportsMagnetometer;                      // true if controller emits valid magnetometer data
 
     // Cached Setter State
     unsigned char LedR, LedG, LedB;
@@ -292,9 +327,7 @@ private:
     bool bWriteStateDirty;
     std::chrono::time_point<std::chrono::high_resolution_clock> lastWriteStateTime;
 
-    // Read Controller State
-    int NextPollSequenceNumber;
-    std::deque<PSMoveControllerState> ControllerStates;
     PSMoveDataInput* InData;                        // Buffer to copy hidapi reports into
+    class ControllerInputLogWriter *InputLogWriter; // non-null while recording input reports
 };
 #endif // PSMOVE_CONTROLLER_H
\ No newline at end of file
@@ -0,0 +1,216 @@
+// -- includes -----
+#include "VirtualController.h"
+#include "ControllerInputLog.h"
+#include "ControllerDeviceEnumerator.h"
+#include "ServerLog.h"
+
+#include <algorithm>
+
+// -- public methods
+VirtualController::VirtualController()
+    : PSMoveController()
+    , LogPath()
+    , InputLog(nullptr)
+    , NextRecordIndex(0)
+    , bReplayExhausted(false)
+{
+}
+
+VirtualController::~VirtualController()
+{
+    if (getIsOpen())
+    {
+        SERVER_LOG_ERROR("~VirtualController") << "Controller deleted without calling close() first!";
+    }
+}
+
+// -- IDeviceInterface
+bool VirtualController::matchesDeviceEnumerator(const DeviceEnumerator *enumerator) const
+{
+    // Down-cast the enumerator so we can use the correct get_path.
+    const ControllerDeviceEnumerator *pEnum = static_cast<const ControllerDeviceEnumerator *>(enumerator);
+
+    bool matches = false;
+
+    if (pEnum->get_is_virtual_controller() &&
+        pEnum->get_device_type() == CommonControllerState::PSMove)
+    {
+        std::string enumerator_path = pEnum->get_path();
+
+        matches = (enumerator_path == LogPath);
+    }
+
+    return matches;
+}
+
+bool VirtualController::open(const DeviceEnumerator *enumerator)
+{
+    const ControllerDeviceEnumerator *controller_enumerator = static_cast<const ControllerDeviceEnumerator *>(enumerator);
+    const char *cur_dev_path = controller_enumerator->get_path();
+
+    bool bSuccess = false;
+
+    if (getIsOpen())
+    {
+        SERVER_LOG_WARNING("VirtualController::open") << "VirtualController(" << cur_dev_path << ") already open. Ignoring request.";
+        bSuccess = true;
+    }
+    else
+    {
+        SERVER_LOG_INFO("VirtualController::open") << "Opening VirtualController(" << cur_dev_path << ")";
+
+        InputLog = new ControllerInputLogReader();
+
+        if (InputLog->load(cur_dev_path) &&
+            InputLog->getDeviceType() == CommonDeviceState::PSMove &&
+            InputLog->getReportSize() == getInputReportSize())
+        {
+            LogPath = cur_dev_path;
+
+            // Load the recorded controller's own config (keyed by the serial
+            // stored in the log header) so the replay parses the reports with
+            // the exact calibration the original session used
+            std::string btaddr = InputLog->getSerial();
+            std::replace(btaddr.begin(), btaddr.end(), ':', '_');
+            cfg = PSMoveControllerConfig(btaddr);
+            cfg.load();
+
+            // Pretend to be a connected bluetooth controller so the state
+            // publishing and tracking paths treat us like live hardware
+            IsBluetooth = true;
+            HIDDetails.Device_path = LogPath;
+            HIDDetails.Bt_addr = InputLog->getSerial();
+            HIDDetails.Host_bt_addr = "00:00:00:00:00:00";
+
+            // Start the replay clock
+            ReplayStartTime = std::chrono::high_resolution_clock::now();
+            NextRecordIndex = 0;
+            bReplayExhausted = false;
+
+            // Reset the polling sequence counter
+            NextPollSequenceNumber = 0;
+
+            SERVER_LOG_INFO("VirtualController::open") <<
+                "Replaying " << InputLog->getRecords().size() << " input reports recorded from controller " << InputLog->getSerial();
+
+            bSuccess = true;
+        }
+        else
+        {
+            SERVER_LOG_ERROR("VirtualController::open") << "Failed to load input report log: " << cur_dev_path;
+
+            close();
+        }
+    }
+
+    return bSuccess;
+}
+
+bool VirtualController::getIsOpen() const
+{
+    return InputLog != nullptr && LogPath.length() > 0;
+}
+
+IDeviceInterface::ePollResult VirtualController::poll()
+{
+    IDeviceInterface::ePollResult result = IDeviceInterface::_PollResultFailure;
+
+    if (getIsOpen())
+    {
+        const std::vector<ControllerInputLogRecord> &records = InputLog->getRecords();
+        const std::chrono::time_point<std::chrono::high_resolution_clock> now =
+            std::chrono::high_resolution_clock::now();
+        const unsigned long long elapsed_us =
+            static_cast<unsigned long long>(
+                std::chrono::duration_cast<std::chrono::microseconds>(now - ReplayStartTime).count());
+        const unsigned long long base_timestamp_us =
+            (records.size() > 0) ? records[0].timestamp_us : 0;
+
+        result = IControllerInterface::_PollResultSuccessNoData;
+
+        // Hand out every record whose original capture time has been reached,
+        // just like draining a backlog of reports from a real HID device
+        while (NextRecordIndex < records.size() &&
+               records[NextRecordIndex].timestamp_us - base_timestamp_us <= elapsed_us)
+        {
+            const ControllerInputLogRecord &record = records[NextRecordIndex];
+            PSMoveControllerState newState;
+
+            // Increment the sequence for every new polling packet
+            newState.PollSequenceNumber = NextPollSequenceNumber;
+            ++NextPollSequenceNumber;
+
+            // Stamp the state with the report's original capture time so the
+            // filters see the recorded per-sample time deltas
+            newState.PollTimestamp =
+                ReplayStartTime + std::chrono::microseconds(record.timestamp_us - base_timestamp_us);
+            newState.bPollTimestampValid = true;
+
+            parseInputReport(
+                record.report.data(),
+                record.report.size(),
+                cfg,
+                ControllerStates.back(),
+                newState);
+
+            // The ring recycles its oldest slot once full - no allocation
+            ControllerStates.push(newState);
+
+            ++NextRecordIndex;
+            result = IControllerInterface::_PollResultSuccessNewData;
+        }
+
+        if (NextRecordIndex >= records.size() && !bReplayExhausted)
+        {
+            SERVER_LOG_INFO("VirtualController::poll") << "Input report replay finished: " << LogPath;
+            bReplayExhausted = true;
+        }
+    }
+
+    return result;
+}
+
+void VirtualController::close()
+{
+    if (getIsOpen())
+    {
+        SERVER_LOG_INFO("VirtualController::close") << "Closing VirtualController(" << LogPath << ")";
+    }
+
+    if (InputLog != nullptr)
+    {
+        delete InputLog;
+        InputLog = nullptr;
+    }
+
+    LogPath.clear();
+}
+
+// -- IControllerInterface
+bool VirtualController::setTrackingColorID(const eCommonTrackingColorID tracking_color_id)
+{
+    bool bSuccess = false;
+
+    if (getIsOpen())
+    {
+        // In memory only - never rewrite the recorded controller's config
+        cfg.tracking_color_id = tracking_color_id;
+        bSuccess = true;
+    }
+
+    return bSuccess;
+}
+
+bool VirtualController::setFilterWarmStartState(const std::vector<double> &values)
+{
+    bool bSuccess = false;
+
+    if (getIsOpen())
+    {
+        // In memory only - never rewrite the recorded controller's config
+        cfg.filter_warm_start_state = values;
+        bSuccess = true;
+    }
+
+    return bSuccess;
+}
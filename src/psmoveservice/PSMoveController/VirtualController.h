@@ -0,0 +1,49 @@
+#ifndef VIRTUAL_CONTROLLER_H
+#define VIRTUAL_CONTROLLER_H
+
+// -- includes -----
+#include "PSMoveController.h"
+
+// -- definitions -----
+/// Replays a recorded controller input report log (see ControllerInputLog.h)
+/// at its original timing, so filter and pipeline changes can be benchmarked
+/// against identical input streams instead of live hardware.
+///
+/// Derives from PSMoveController and reports the PSMove device type: the
+/// replayed reports run through the exact same parsing, calibration and state
+/// pipeline as a live controller, and the PSMoveController down-casts in the
+/// request handler stay valid. The replayed controller's own config (looked
+/// up by the serial stored in the log) supplies the calibration, so the
+/// produced states match the original session bit for bit.
+///
+/// Enumerated when DeviceManagerConfig::virtual_controller_input_log names a
+/// log file recorded by PSMoveControllerConfig::record_input_stream.
+class VirtualController : public PSMoveController {
+public:
+    VirtualController();
+    virtual ~VirtualController();
+
+    // -- IDeviceInterface
+    virtual bool matchesDeviceEnumerator(const DeviceEnumerator *enumerator) const override;
+    virtual bool open(const DeviceEnumerator *enumerator) override;
+    virtual bool getIsOpen() const override;
+    virtual IDeviceInterface::ePollResult poll() override;
+    virtual void close() override;
+
+    // -- IControllerInterface
+    // The replay shares the recorded controller's config file - update these
+    // in memory only so a benchmark run never rewrites the real controller's
+    // calibration on disk
+    virtual bool setTrackingColorID(const eCommonTrackingColorID tracking_color_id) override;
+    virtual bool setFilterWarmStartState(const std::vector<double> &values) override;
+
+private:
+    std::string LogPath;
+    class ControllerInputLogReader *InputLog;
+
+    // Replay cursor: next record to hand out and when the replay started
+    size_t NextRecordIndex;
+    bool bReplayExhausted;
+    std::chrono::time_point<std::chrono::high_resolution_clock> ReplayStartTime;
+};
+#endif // VIRTUAL_CONTROLLER_H
@@ -0,0 +1,426 @@
+//-- includes -----
+#include "HSVRangeThreshold.h"
+
+#include <algorithm>
+#include <assert.h>
+#include <string.h>
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#define HSV_RANGE_THRESHOLD_USE_SSE
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#endif
+
+//-- private methods -----
+#if defined(HSV_RANGE_THRESHOLD_USE_SSE)
+/// 0xFF where lo <= x <= hi (unsigned byte compare via saturated subtract)
+static inline __m128i in_range_epu8(const __m128i &x, const __m128i &lo, const __m128i &hi)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ge_lo = _mm_cmpeq_epi8(_mm_subs_epu8(lo, x), zero);
+    const __m128i le_hi = _mm_cmpeq_epi8(_mm_subs_epu8(x, hi), zero);
+
+    return _mm_and_si128(ge_lo, le_hi);
+}
+#endif
+
+static inline unsigned char scalar_hsv_test(
+    const unsigned char *hsv_pixel,
+    const HSVRangeThreshold &threshold,
+    const bool hue_wraps)
+{
+    const unsigned char h = hsv_pixel[0];
+    const unsigned char s = hsv_pixel[1];
+    const unsigned char v = hsv_pixel[2];
+
+    const bool hue_ok =
+        hue_wraps
+        ? (h >= threshold.hue_min || h <= threshold.hue_max)
+        : (h >= threshold.hue_min && h <= threshold.hue_max);
+
+    return
+        (hue_ok &&
+         s >= threshold.saturation_min && s <= threshold.saturation_max &&
+         v >= threshold.value_min && v <= threshold.value_max)
+        ? 0xFF : 0x00;
+}
+
+//-- public methods -----
+void computeHSVRangeMask(
+    const unsigned char *hsv_pixels, size_t hsv_row_stride,
+    unsigned char *mask_pixels, size_t mask_row_stride,
+    int width, int height,
+    const HSVRangeThreshold &threshold)
+{
+    const bool hue_wraps = threshold.hue_min > threshold.hue_max;
+
+#if defined(HSV_RANGE_THRESHOLD_USE_SSE)
+    // Shuffle masks that deinterleave 16 HSV pixels (48 bytes across 3 loads)
+    // into separate hue/saturation/value lanes
+    const __m128i shuf_h0 = _mm_setr_epi8(0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i shuf_h1 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 2, 5, 8, 11, 14, -1, -1, -1, -1, -1);
+    const __m128i shuf_h2 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 4, 7, 10, 13);
+    const __m128i shuf_s0 = _mm_setr_epi8(1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i shuf_s1 = _mm_setr_epi8(-1, -1, -1, -1, -1, 0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1);
+    const __m128i shuf_s2 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, 5, 8, 11, 14);
+    const __m128i shuf_v0 = _mm_setr_epi8(2, 5, 8, 11, 14, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i shuf_v1 = _mm_setr_epi8(-1, -1, -1, -1, -1, 1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1);
+    const __m128i shuf_v2 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 3, 6, 9, 12, 15);
+
+    const __m128i hue_lo = _mm_set1_epi8(static_cast<char>(threshold.hue_min));
+    const __m128i hue_hi = _mm_set1_epi8(static_cast<char>(threshold.hue_max));
+    const __m128i sat_lo = _mm_set1_epi8(static_cast<char>(threshold.saturation_min));
+    const __m128i sat_hi = _mm_set1_epi8(static_cast<char>(threshold.saturation_max));
+    const __m128i val_lo = _mm_set1_epi8(static_cast<char>(threshold.value_min));
+    const __m128i val_hi = _mm_set1_epi8(static_cast<char>(threshold.value_max));
+    const __m128i zero = _mm_setzero_si128();
+
+    const int simd_width = (width / 16) * 16;
+#endif
+
+    for (int y = 0; y < height; ++y)
+    {
+        const unsigned char *hsv_row = hsv_pixels + static_cast<size_t>(y)*hsv_row_stride;
+        unsigned char *mask_row = mask_pixels + static_cast<size_t>(y)*mask_row_stride;
+        int x = 0;
+
+#if defined(HSV_RANGE_THRESHOLD_USE_SSE)
+        for (; x < simd_width; x += 16)
+        {
+            const unsigned char *hsv_block = hsv_row + 3*x;
+            const __m128i t0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(hsv_block));
+            const __m128i t1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(hsv_block + 16));
+            const __m128i t2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(hsv_block + 32));
+
+            const __m128i h = _mm_or_si128(
+                _mm_or_si128(_mm_shuffle_epi8(t0, shuf_h0), _mm_shuffle_epi8(t1, shuf_h1)),
+                _mm_shuffle_epi8(t2, shuf_h2));
+            const __m128i s = _mm_or_si128(
+                _mm_or_si128(_mm_shuffle_epi8(t0, shuf_s0), _mm_shuffle_epi8(t1, shuf_s1)),
+                _mm_shuffle_epi8(t2, shuf_s2));
+            const __m128i v = _mm_or_si128(
+                _mm_or_si128(_mm_shuffle_epi8(t0, shuf_v0), _mm_shuffle_epi8(t1, shuf_v1)),
+                _mm_shuffle_epi8(t2, shuf_v2));
+
+            __m128i hue_mask;
+            if (hue_wraps)
+            {
+                // hue >= hue_min OR hue <= hue_max
+                const __m128i ge_lo = _mm_cmpeq_epi8(_mm_subs_epu8(hue_lo, h), zero);
+                const __m128i le_hi = _mm_cmpeq_epi8(_mm_subs_epu8(h, hue_hi), zero);
+
+                hue_mask = _mm_or_si128(ge_lo, le_hi);
+            }
+            else
+            {
+                hue_mask = in_range_epu8(h, hue_lo, hue_hi);
+            }
+
+            const __m128i result = _mm_and_si128(
+                hue_mask,
+                _mm_and_si128(
+                    in_range_epu8(s, sat_lo, sat_hi),
+                    in_range_epu8(v, val_lo, val_hi)));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(mask_row + x), result);
+        }
+#endif
+
+        // Scalar tail (and full row on non-x86 targets)
+        for (; x < width; ++x)
+        {
+            mask_row[x] = scalar_hsv_test(hsv_row + 3*x, threshold, hue_wraps);
+        }
+    }
+}
+
+void computeHSVColorLabelMask(
+    const unsigned char *hsv_pixels, size_t hsv_row_stride,
+    unsigned char *label_pixels, size_t label_row_stride,
+    int width, int height,
+    const HSVRangeThreshold *thresholds,
+    const unsigned char *labels,
+    int threshold_count)
+{
+#if defined(HSV_RANGE_THRESHOLD_USE_SSE)
+    const __m128i shuf_h0 = _mm_setr_epi8(0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i shuf_h1 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 2, 5, 8, 11, 14, -1, -1, -1, -1, -1);
+    const __m128i shuf_h2 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 4, 7, 10, 13);
+    const __m128i shuf_s0 = _mm_setr_epi8(1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i shuf_s1 = _mm_setr_epi8(-1, -1, -1, -1, -1, 0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1);
+    const __m128i shuf_s2 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, 5, 8, 11, 14);
+    const __m128i shuf_v0 = _mm_setr_epi8(2, 5, 8, 11, 14, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i shuf_v1 = _mm_setr_epi8(-1, -1, -1, -1, -1, 1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1);
+    const __m128i shuf_v2 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 3, 6, 9, 12, 15);
+    const __m128i zero = _mm_setzero_si128();
+
+    const int simd_width = (width / 16) * 16;
+#endif
+
+    for (int y = 0; y < height; ++y)
+    {
+        const unsigned char *hsv_row = hsv_pixels + static_cast<size_t>(y)*hsv_row_stride;
+        unsigned char *label_row = label_pixels + static_cast<size_t>(y)*label_row_stride;
+        int x = 0;
+
+#if defined(HSV_RANGE_THRESHOLD_USE_SSE)
+        for (; x < simd_width; x += 16)
+        {
+            const unsigned char *hsv_block = hsv_row + 3*x;
+            const __m128i t0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(hsv_block));
+            const __m128i t1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(hsv_block + 16));
+            const __m128i t2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(hsv_block + 32));
+
+            const __m128i h = _mm_or_si128(
+                _mm_or_si128(_mm_shuffle_epi8(t0, shuf_h0), _mm_shuffle_epi8(t1, shuf_h1)),
+                _mm_shuffle_epi8(t2, shuf_h2));
+            const __m128i s = _mm_or_si128(
+                _mm_or_si128(_mm_shuffle_epi8(t0, shuf_s0), _mm_shuffle_epi8(t1, shuf_s1)),
+                _mm_shuffle_epi8(t2, shuf_s2));
+            const __m128i v = _mm_or_si128(
+                _mm_or_si128(_mm_shuffle_epi8(t0, shuf_v0), _mm_shuffle_epi8(t1, shuf_v1)),
+                _mm_shuffle_epi8(t2, shuf_v2));
+
+            // Test every threshold against the deinterleaved block,
+            // keeping the first match per pixel
+            __m128i result = zero;
+            __m128i assigned = zero;
+
+            for (int threshold_index = 0; threshold_index < threshold_count; ++threshold_index)
+            {
+                const HSVRangeThreshold &threshold = thresholds[threshold_index];
+                const __m128i hue_lo = _mm_set1_epi8(static_cast<char>(threshold.hue_min));
+                const __m128i hue_hi = _mm_set1_epi8(static_cast<char>(threshold.hue_max));
+
+                __m128i hue_mask;
+                if (threshold.hue_min > threshold.hue_max)
+                {
+                    // hue >= hue_min OR hue <= hue_max
+                    const __m128i ge_lo = _mm_cmpeq_epi8(_mm_subs_epu8(hue_lo, h), zero);
+                    const __m128i le_hi = _mm_cmpeq_epi8(_mm_subs_epu8(h, hue_hi), zero);
+
+                    hue_mask = _mm_or_si128(ge_lo, le_hi);
+                }
+                else
+                {
+                    hue_mask = in_range_epu8(h, hue_lo, hue_hi);
+                }
+
+                const __m128i match = _mm_and_si128(
+                    hue_mask,
+                    _mm_and_si128(
+                        in_range_epu8(s,
+                            _mm_set1_epi8(static_cast<char>(threshold.saturation_min)),
+                            _mm_set1_epi8(static_cast<char>(threshold.saturation_max))),
+                        in_range_epu8(v,
+                            _mm_set1_epi8(static_cast<char>(threshold.value_min)),
+                            _mm_set1_epi8(static_cast<char>(threshold.value_max)))));
+
+                const __m128i new_match = _mm_andnot_si128(assigned, match);
+
+                result = _mm_or_si128(
+                    result,
+                    _mm_and_si128(new_match, _mm_set1_epi8(static_cast<char>(labels[threshold_index]))));
+                assigned = _mm_or_si128(assigned, match);
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(label_row + x), result);
+        }
+#endif
+
+        // Scalar tail (and full row on non-x86 targets)
+        for (; x < width; ++x)
+        {
+            unsigned char label = 0;
+
+            for (int threshold_index = 0; threshold_index < threshold_count; ++threshold_index)
+            {
+                const HSVRangeThreshold &threshold = thresholds[threshold_index];
+
+                if (scalar_hsv_test(hsv_row + 3*x, threshold, threshold.hue_min > threshold.hue_max) != 0)
+                {
+                    label = labels[threshold_index];
+                    break;
+                }
+            }
+
+            label_row[x] = label;
+        }
+    }
+}
+
+void buildHSVColorClassLUT(
+    const HSVRangeThreshold *thresholds,
+    int threshold_count,
+    HSVColorClassLUT &lut)
+{
+    assert(threshold_count <= HSVColorClassLUT::MAX_COLOR_CLASSES);
+
+    memset(lut.hue_table, 0, sizeof(lut.hue_table));
+    memset(lut.saturation_table, 0, sizeof(lut.saturation_table));
+    memset(lut.value_table, 0, sizeof(lut.value_table));
+
+    for (int threshold_index = 0; threshold_index < threshold_count; ++threshold_index)
+    {
+        const HSVRangeThreshold &threshold = thresholds[threshold_index];
+        const unsigned char threshold_bit = static_cast<unsigned char>(1 << threshold_index);
+
+        if (threshold.hue_min > threshold.hue_max)
+        {
+            // Wrapped hue range: [hue_min, 255] U [0, hue_max]
+            for (int hue = threshold.hue_min; hue <= 255; ++hue)
+            {
+                lut.hue_table[hue] |= threshold_bit;
+            }
+            for (int hue = 0; hue <= threshold.hue_max; ++hue)
+            {
+                lut.hue_table[hue] |= threshold_bit;
+            }
+        }
+        else
+        {
+            for (int hue = threshold.hue_min; hue <= threshold.hue_max; ++hue)
+            {
+                lut.hue_table[hue] |= threshold_bit;
+            }
+        }
+
+        for (int saturation = threshold.saturation_min; saturation <= threshold.saturation_max; ++saturation)
+        {
+            lut.saturation_table[saturation] |= threshold_bit;
+        }
+
+        for (int value = threshold.value_min; value <= threshold.value_max; ++value)
+        {
+            lut.value_table[value] |= threshold_bit;
+        }
+    }
+}
+
+/// Index of the lowest set bit; callers guarantee bits != 0
+static inline int lowest_set_bit_index(unsigned char bits)
+{
+    int bit_index = 0;
+
+    while ((bits & 1) == 0)
+    {
+        bits >>= 1;
+        ++bit_index;
+    }
+
+    return bit_index;
+}
+
+void computeHSVColorLabelMaskLUT(
+    const unsigned char *hsv_pixels, size_t hsv_row_stride,
+    unsigned char *label_pixels, size_t label_row_stride,
+    int width, int height,
+    const HSVColorClassLUT &lut,
+    const unsigned char *labels)
+{
+    for (int y = 0; y < height; ++y)
+    {
+        const unsigned char *hsv_row = hsv_pixels + static_cast<size_t>(y)*hsv_row_stride;
+        unsigned char *label_row = label_pixels + static_cast<size_t>(y)*label_row_stride;
+
+        for (int x = 0; x < width; ++x)
+        {
+            const unsigned char *hsv_pixel = hsv_row + 3*x;
+            const unsigned char match_bits =
+                lut.hue_table[hsv_pixel[0]] &
+                lut.saturation_table[hsv_pixel[1]] &
+                lut.value_table[hsv_pixel[2]];
+
+            label_row[x] = (match_bits != 0) ? labels[lowest_set_bit_index(match_bits)] : 0;
+        }
+    }
+}
+
+/// HSV -> RGB using OpenCV's 8-bit conventions (H in [0,180)).
+/// Inverse of the rgb8ToHSV8 conversion in TrackerVisionKernels.cpp.
+static inline void hsv8ToRGB8(const int h, const int s, const int v, int &out_r, int &out_g, int &out_b)
+{
+    if (s == 0)
+    {
+        out_r = out_g = out_b = v;
+        return;
+    }
+
+    const int sector = (h / 30) % 6;
+    const int f = h % 30;
+
+    const int p = (v*(255 - s)) / 255;
+    const int q = (v*(255*30 - s*f)) / (255*30);
+    const int t = (v*(255*30 - s*(30 - f))) / (255*30);
+
+    switch (sector)
+    {
+    case 0: out_r = v; out_g = t; out_b = p; break;
+    case 1: out_r = q; out_g = v; out_b = p; break;
+    case 2: out_r = p; out_g = v; out_b = t; break;
+    case 3: out_r = p; out_g = q; out_b = v; break;
+    case 4: out_r = t; out_g = p; out_b = v; break;
+    default: out_r = v; out_g = p; out_b = q; break;
+    }
+}
+
+static inline void growRGBBoundsForHue(
+    const int h,
+    const HSVRangeThreshold &threshold,
+    int &r_min, int &r_max, int &g_min, int &g_max, int &b_min, int &b_max)
+{
+    // For a fixed hue every RGB channel is bilinear in (s, v), so the
+    // extremes over the saturation/value box land on its corners
+    const int s_corners[2] = {threshold.saturation_min, threshold.saturation_max};
+    const int v_corners[2] = {threshold.value_min, threshold.value_max};
+
+    for (int s_index = 0; s_index < 2; ++s_index)
+    {
+        for (int v_index = 0; v_index < 2; ++v_index)
+        {
+            int r, g, b;
+            hsv8ToRGB8(h, s_corners[s_index], v_corners[v_index], r, g, b);
+
+            r_min = std::min(r_min, r); r_max = std::max(r_max, r);
+            g_min = std::min(g_min, g); g_max = std::max(g_max, g);
+            b_min = std::min(b_min, b); b_max = std::max(b_max, b);
+        }
+    }
+}
+
+void hsvRangeThresholdToRGBBounds(
+    const HSVRangeThreshold &threshold,
+    RGBRangeThreshold &out_bounds)
+{
+    int r_min = 255, r_max = 0;
+    int g_min = 255, g_max = 0;
+    int b_min = 255, b_max = 0;
+
+    // Sweep every hue step in the range (wrap aware, same convention as the
+    // mask kernels: hue_min > hue_max means the range crosses the hue seam)
+    if (threshold.hue_min > threshold.hue_max)
+    {
+        for (int h = threshold.hue_min; h <= 180; ++h)
+        {
+            growRGBBoundsForHue(h, threshold, r_min, r_max, g_min, g_max, b_min, b_max);
+        }
+        for (int h = 0; h <= threshold.hue_max; ++h)
+        {
+            growRGBBoundsForHue(h, threshold, r_min, r_max, g_min, g_max, b_min, b_max);
+        }
+    }
+    else
+    {
+        for (int h = threshold.hue_min; h <= threshold.hue_max; ++h)
+        {
+            growRGBBoundsForHue(h, threshold, r_min, r_max, g_min, g_max, b_min, b_max);
+        }
+    }
+
+    out_bounds.r_min = static_cast<unsigned char>(r_min);
+    out_bounds.r_max = static_cast<unsigned char>(r_max);
+    out_bounds.g_min = static_cast<unsigned char>(g_min);
+    out_bounds.g_max = static_cast<unsigned char>(g_max);
+    out_bounds.b_min = static_cast<unsigned char>(b_min);
+    out_bounds.b_max = static_cast<unsigned char>(b_max);
+}
@@ -0,0 +1,98 @@
+#ifndef HSV_RANGE_THRESHOLD_H
+#define HSV_RANGE_THRESHOLD_H
+
+//-- includes -----
+#include <cstddef>
+
+//-- definitions -----
+/// Byte-valued HSV test applied to every pixel of the tracking ROI.
+/// Hue is in OpenCV's [0,180] range. When hue_min > hue_max the test wraps
+/// around the hue circle: a pixel passes if hue >= hue_min OR hue <= hue_max.
+struct HSVRangeThreshold
+{
+    unsigned char hue_min;
+    unsigned char hue_max;
+    unsigned char saturation_min;
+    unsigned char saturation_max;
+    unsigned char value_min;
+    unsigned char value_max;
+};
+
+/// Byte-valued per-channel RGB bounding box. Used by the coarse
+/// re-acquisition level to classify pixels with integer compares straight
+/// off the source buffer, skipping the HSV conversion entirely at that
+/// level (see hsvRangeThresholdToRGBBounds).
+struct RGBRangeThreshold
+{
+    unsigned char r_min;
+    unsigned char r_max;
+    unsigned char g_min;
+    unsigned char g_max;
+    unsigned char b_min;
+    unsigned char b_max;
+};
+
+/// Compute the tightest per-channel RGB box enclosing every color in the
+/// HSV range. The box is a conservative superset - the image of an HSV box
+/// under HSV->RGB isn't axis aligned - so a coarse mask built from it can
+/// pick up extra pixels but never lose one the HSV test would have kept.
+/// Cheap enough to rebuild whenever a color calibration changes, far too
+/// expensive per pixel: derive once, compare per pixel.
+void hsvRangeThresholdToRGBBounds(
+    const HSVRangeThreshold &threshold,
+    RGBRangeThreshold &out_bounds);
+
+/// Write a 0/255 binary mask of the pixels inside the HSV range.
+/// Does the combined hue-wrap + saturation + value test in a single pass
+/// over the interleaved 3-channel HSV buffer (SSE vectorized on x86/x64),
+/// replacing the multi-pass cv::inRange + bitwise_or cascade.
+void computeHSVRangeMask(
+    const unsigned char *hsv_pixels, size_t hsv_row_stride,
+    unsigned char *mask_pixels, size_t mask_row_stride,
+    int width, int height,
+    const HSVRangeThreshold &threshold);
+
+/// Classify every pixel against a set of HSV ranges in a single traversal.
+/// Each pixel of the label image gets labels[i] of the first threshold it
+/// falls inside, or 0 if it matches none. Used to segment all active tracking
+/// colors at once instead of re-walking the ROI once per tracked device.
+void computeHSVColorLabelMask(
+    const unsigned char *hsv_pixels, size_t hsv_row_stride,
+    unsigned char *label_pixels, size_t label_row_stride,
+    int width, int height,
+    const HSVRangeThreshold *thresholds,
+    const unsigned char *labels,
+    int threshold_count);
+
+/// Per-channel bitmask lookup tables classifying a byte HSV triple against up
+/// to 8 HSV ranges at once. Bit i of an entry is set when that channel value
+/// lies inside threshold i's range (hue wrap folded in at build time), so the
+/// AND of the three table loads yields the exact set of matching thresholds.
+/// The whole classifier is 768 bytes and stays resident in L1, making
+/// per-pixel classification cost independent of how many colors are active.
+struct HSVColorClassLUT
+{
+    enum { MAX_COLOR_CLASSES = 8 };
+
+    unsigned char hue_table[256];
+    unsigned char saturation_table[256];
+    unsigned char value_table[256];
+};
+
+/// Build the per-channel classification tables for a set of HSV ranges.
+/// Only needs re-running when a color preset changes, not per frame.
+void buildHSVColorClassLUT(
+    const HSVRangeThreshold *thresholds,
+    int threshold_count,
+    HSVColorClassLUT &lut);
+
+/// Classify every pixel with the prebuilt tables. Same label-image output
+/// convention as computeHSVColorLabelMask (first matching threshold wins).
+void computeHSVColorLabelMaskLUT(
+    const unsigned char *hsv_pixels, size_t hsv_row_stride,
+    unsigned char *label_pixels, size_t label_row_stride,
+    int width, int height,
+    const HSVColorClassLUT &lut,
+    const unsigned char *labels);
+
+#endif // HSV_RANGE_THRESHOLD_H
@@ -3,18 +3,42 @@
 #include "ServerLog.h"
 #include "ServerUtility.h"
 #include "PSEyeVideoCapture.h"
+#include "PSEyeAsyncFrameGrabber.h"
 #include "PSMoveProtocol.pb.h"
 #include "TrackerDeviceEnumerator.h"
 #include "TrackerManager.h"
+#include "DeviceManager.h"
 #include "opencv2/opencv.hpp"
 
-// -- constants -----
-#define PS3EYE_STATE_BUFFER_MAX 16
+#include <algorithm>
 
+// -- constants -----
 static const char *OPTION_FOV_SETTING = "FOV Setting";
 static const char *OPTION_FOV_RED_DOT = "Red Dot";
 static const char *OPTION_FOV_BLUE_DOT = "Blue Dot";
 
+static const char *OPTION_CAPTURE_MODE = "Capture Mode";
+static const char *OPTION_CAPTURE_MODE_VGA_60 = "640x480 60Hz";
+static const char *OPTION_CAPTURE_MODE_VGA_75 = "640x480 75Hz";
+static const char *OPTION_CAPTURE_MODE_QVGA_187 = "320x240 187Hz";
+
+// All lens calibration values in the config are stored at this resolution
+// and scaled to the active capture mode when queried
+static const double k_calibration_frame_width = 640.0;
+
+// Capture watchdog timing.
+// The silence timeout is widened to this after the capture thread starts,
+// since cold starts and mode changes can take most of a second to deliver
+// the first frame
+static const float k_capture_watchdog_startup_grace = 2.f;
+// Longest the watchdog waits for a wedged capture thread to exit before
+// abandoning it (a thread stuck in a libusb call never exits)
+static const float k_capture_thread_join_timeout = 0.5f;
+// Minimum time between restart attempts. A camera that wedges again right
+// after a restart falls through to the regular poll failure close and the
+// full device reconnect path takes over.
+static const float k_min_seconds_between_capture_restarts = 3.f;
+
 // -- private definitions -----
 class PSEyeCaptureData
 {
@@ -30,13 +54,14 @@ public:
 
 // -- public methods
 // -- PS3EYE Controller Config
-const int PS3EyeTrackerConfig::CONFIG_VERSION = 7;
+const int PS3EyeTrackerConfig::CONFIG_VERSION = 8;
 const int PS3EyeTrackerConfig::LENS_CALIBRATION_VERSION= 1;
 
 PS3EyeTrackerConfig::PS3EyeTrackerConfig(const std::string &fnamebase)
     : PSMoveConfig(fnamebase)
     , is_valid(false)
     , max_poll_failure_count(100)
+    , capture_watchdog_timeout(0.5f)
     , exposure(32)
     , gain(32)
     , focalLengthX(554.2563) // pixels
@@ -53,6 +78,7 @@ PS3EyeTrackerConfig::PS3EyeTrackerConfig(const std::string &fnamebase)
     , distortionP1(0.00091733073350042105)
     , distortionP2(0.00010589254816295579)
     , fovSetting(BlueDot)
+    , captureMode(VGA_60FPS)
 {
     pose.clear();
 
@@ -72,6 +98,7 @@ PS3EyeTrackerConfig::config2ptree()
     pt.put("version", PS3EyeTrackerConfig::CONFIG_VERSION);
 	pt.put("lens_calibration_version", PS3EyeTrackerConfig::LENS_CALIBRATION_VERSION);
     pt.put("max_poll_failure_count", max_poll_failure_count);
+    pt.put("capture_watchdog_timeout", capture_watchdog_timeout);
     pt.put("exposure", exposure);
 	pt.put("gain", gain);
     pt.put("focalLengthX", focalLengthX);
@@ -88,6 +115,7 @@ PS3EyeTrackerConfig::config2ptree()
     pt.put("distortionP1", distortionP1);
     pt.put("distortionP2", distortionP2);
     pt.put("fovSetting", static_cast<int>(fovSetting));
+    pt.put("captureMode", static_cast<int>(captureMode));
 
     pt.put("pose.orientation.w", pose.Orientation.w);
     pt.put("pose.orientation.x", pose.Orientation.x);
@@ -104,6 +132,18 @@ PS3EyeTrackerConfig::config2ptree()
 		writeColorPropertyPresetTable(&controller_preset_table, pt);
 	}
 
+	pt.put("exclusion_area_count", static_cast<int>(ExclusionAreas.size()));
+	for (size_t area_index = 0; area_index < ExclusionAreas.size(); ++area_index)
+	{
+		const CommonScreenRect &area = ExclusionAreas[area_index];
+		const std::string prefix = "exclusion_area_" + std::to_string(area_index);
+
+		pt.put(prefix + ".x", area.x);
+		pt.put(prefix + ".y", area.y);
+		pt.put(prefix + ".w", area.w);
+		pt.put(prefix + ".h", area.h);
+	}
+
     return pt;
 }
 
@@ -115,6 +155,7 @@ PS3EyeTrackerConfig::ptree2config(const boost::property_tree::ptree &pt)
     {
         is_valid = pt.get<bool>("is_valid", false);
         max_poll_failure_count = pt.get<long>("max_poll_failure_count", 100);
+        capture_watchdog_timeout = pt.get<float>("capture_watchdog_timeout", 0.5f);
         exposure = pt.get<double>("exposure", 32);
 		gain = pt.get<double>("gain", 32);
         hfov = pt.get<double>("hfov", 60.0);
@@ -142,10 +183,18 @@ PS3EyeTrackerConfig::ptree2config(const boost::property_tree::ptree &pt)
 				PS3EyeTrackerConfig::LENS_CALIBRATION_VERSION << ", Using defaults.";
 		}
 
-        fovSetting = 
+        fovSetting =
             static_cast<PS3EyeTrackerConfig::eFOVSetting>(
                 pt.get<int>("fovSetting", PS3EyeTrackerConfig::eFOVSetting::BlueDot));
 
+        // Default to the current value so a camera that inherited the
+        // rig-wide default capture mode keeps it until explicitly changed
+        captureMode =
+            static_cast<PS3EyeTrackerConfig::eCaptureMode>(
+                std::min(
+                    std::max(pt.get<int>("captureMode", static_cast<int>(captureMode)), 0),
+                    PS3EyeTrackerConfig::eCaptureMode::MAX_CAPTURE_MODES - 1));
+
         pose.Orientation.w = pt.get<float>("pose.orientation.w", 1.0);
         pose.Orientation.x = pt.get<float>("pose.orientation.x", 0.0);
         pose.Orientation.y = pt.get<float>("pose.orientation.y", 0.0);
@@ -180,6 +229,31 @@ PS3EyeTrackerConfig::ptree2config(const boost::property_tree::ptree &pt)
 				DeviceColorPresets.push_back(table);
 			}
 		}
+
+		// Read the static background exclusion areas
+		ExclusionAreas.clear();
+		{
+			const int area_count =
+				std::min(
+					pt.get<int>("exclusion_area_count", 0),
+					static_cast<int>(ITrackerInterface::MAX_EXCLUSION_AREAS));
+
+			for (int area_index = 0; area_index < area_count; ++area_index)
+			{
+				const std::string prefix = "exclusion_area_" + std::to_string(area_index);
+				CommonScreenRect area;
+
+				area.x = pt.get<float>(prefix + ".x", 0.f);
+				area.y = pt.get<float>(prefix + ".y", 0.f);
+				area.w = pt.get<float>(prefix + ".w", 0.f);
+				area.h = pt.get<float>(prefix + ".h", 0.f);
+
+				if (area.w > 0.f && area.h > 0.f)
+				{
+					ExclusionAreas.push_back(area);
+				}
+			}
+		}
     }
     else
     {
@@ -189,6 +263,31 @@ PS3EyeTrackerConfig::ptree2config(const boost::property_tree::ptree &pt)
     }
 }
 
+void
+PS3EyeTrackerConfig::getCaptureModeProperties(
+    eCaptureMode mode, int &out_width, int &out_height, int &out_fps)
+{
+    switch (mode)
+    {
+    case VGA_75FPS:
+        out_width = 640;
+        out_height = 480;
+        out_fps = 75;
+        break;
+    case QVGA_187FPS:
+        out_width = 320;
+        out_height = 240;
+        out_fps = 187;
+        break;
+    case VGA_60FPS:
+    default:
+        out_width = 640;
+        out_height = 480;
+        out_fps = 60;
+        break;
+    }
+}
+
 const CommonHSVColorRangeTable *
 PS3EyeTrackerConfig::getColorRangeTable(const std::string &table_name) const
 {
@@ -249,9 +348,13 @@ PS3EyeTrackerConfig::getOrAddColorRangeTable(const std::string &table_name)
 PS3EyeTracker::PS3EyeTracker()
     : cfg()
     , USBDevicePath()
+    , CameraIndex(-1)
     , VideoCapture(nullptr)
+    , FrameGrabber(nullptr)
     , CaptureData(nullptr)
     , DriverType(PS3EyeTracker::Libusb)
+    , CachedExposure(0.)
+    , CachedGain(0.)
     , NextPollSequenceNumber(0)
     , TrackerStates()
 {
@@ -321,6 +424,7 @@ bool PS3EyeTracker::open(const DeviceEnumerator *enumerator)
         {
             CaptureData = new PSEyeCaptureData;
             USBDevicePath = enumerator->get_path();
+            CameraIndex = camera_index;
             bSuccess = true;
         }
         else
@@ -339,6 +443,16 @@ bool PS3EyeTracker::open(const DeviceEnumerator *enumerator)
 
         cfg = PS3EyeTrackerConfig(config_name);
 
+		const TrackerManagerConfig &tracker_cfg = DeviceManager::getInstance()->m_tracker_manager->getConfig();
+
+		// New cameras inherit the rig-wide default capture mode.
+		// A per-camera config that was saved before overrides it on load.
+		cfg.captureMode =
+			static_cast<PS3EyeTrackerConfig::eCaptureMode>(
+				std::min(
+					std::max(tracker_cfg.default_capture_mode, 0),
+					PS3EyeTrackerConfig::eCaptureMode::MAX_CAPTURE_MODES - 1));
+
 		// Load the ps3eye config
         cfg.load();
 		// Save the config back out again in case defaults changed
@@ -346,6 +460,37 @@ bool PS3EyeTracker::open(const DeviceEnumerator *enumerator)
 
 		VideoCapture->set(cv::CAP_PROP_EXPOSURE, cfg.exposure);
 		VideoCapture->set(cv::CAP_PROP_GAIN, cfg.gain);
+
+		// Seed the settings cache with a single read-back (the driver may
+		// have clamped the configured values). These are the only USB
+		// control-transfer reads the tracker ever issues - every
+		// getExposure/getGain after this is served from the cache.
+		CachedExposure = VideoCapture->get(cv::CAP_PROP_EXPOSURE);
+		CachedGain = VideoCapture->get(cv::CAP_PROP_GAIN);
+
+		// The capture had to be opened at the default mode because the
+		// per-camera config is keyed off the camera's unique identifier,
+		// which isn't known until the camera is open. Re-open the capture
+		// if the config asks for a different mode.
+		{
+			int mode_width, mode_height, mode_fps;
+			PS3EyeTrackerConfig::getCaptureModeProperties(cfg.captureMode, mode_width, mode_height, mode_fps);
+
+			if (static_cast<int>(VideoCapture->get(cv::CAP_PROP_FRAME_WIDTH)) != mode_width ||
+				static_cast<int>(VideoCapture->get(cv::CAP_PROP_FPS)) != mode_fps)
+			{
+				reopenVideoCaptureForCaptureMode();
+			}
+		}
+
+		// Pull video frames on a dedicated capture thread so that poll()
+		// never blocks the service thread waiting on USB
+		FrameGrabber =
+			new PSEyeAsyncFrameGrabber(
+				VideoCapture,
+				static_cast<unsigned int>(tracker_cfg.capture_thread_affinity_mask),
+				tracker_cfg.capture_thread_priority);
+		FrameGrabber->startup();
     }
 
     return bSuccess;
@@ -367,11 +512,39 @@ IDeviceInterface::ePollResult PS3EyeTracker::poll()
 
     if (getIsOpen())
     {
-        if (!VideoCapture->grab() || 
-            !VideoCapture->retrieve(CaptureData->frame, cv::CAP_OPENNI_BGR_IMAGE))
+        // Swap in the freshest frame the capture thread has published.
+        // Never blocks - if the camera hasn't delivered since the last poll
+        // we simply report no new data this tick.
+        if (FrameGrabber == nullptr ||
+            !FrameGrabber->fetchLatestFrame(CaptureData->frame, LastFrameCaptureTimestamp))
         {
             // Device still in valid state
             result = IControllerInterface::_PollResultSuccessNoData;
+
+            // Capture watchdog: a healthy camera is never silent for more
+            // than a few frame intervals, so a long gap means the capture
+            // thread is wedged (we've seen libusb hang inside the driver).
+            // Tear down and re-open just this camera's capture path rather
+            // than waiting for the poll failure count to close the whole
+            // device and the much slower reconnect rescan to bring it back.
+            if (cfg.capture_watchdog_timeout > 0.f &&
+                FrameGrabber != nullptr &&
+                FrameGrabber->getIsRunning())
+            {
+                const float seconds_since_last_frame = FrameGrabber->getSecondsSinceLastFrame();
+                const float wedge_timeout =
+                    FrameGrabber->getHasEverDeliveredFrame()
+                    ? cfg.capture_watchdog_timeout
+                    : std::max(cfg.capture_watchdog_timeout, k_capture_watchdog_startup_grace);
+                const std::chrono::duration<float> seconds_since_restart =
+                    std::chrono::high_resolution_clock::now() - LastCaptureRestartTime;
+
+                if (seconds_since_last_frame > wedge_timeout &&
+                    seconds_since_restart.count() > k_min_seconds_between_capture_restarts)
+                {
+                    restartWedgedVideoCapture(seconds_since_last_frame);
+                }
+            }
         }
         else
         {
@@ -388,14 +561,8 @@ IDeviceInterface::ePollResult PS3EyeTracker::poll()
             newState.PollSequenceNumber = NextPollSequenceNumber;
             ++NextPollSequenceNumber;
 
-            // Make room for new entry if at the max queue size
-            //###bwalker $TODO Make this a fixed size circular buffer
-            if (TrackerStates.size() >= PS3EYE_STATE_BUFFER_MAX)
-            {
-                TrackerStates.erase(TrackerStates.begin(), TrackerStates.begin() + TrackerStates.size() - PS3EYE_STATE_BUFFER_MAX);
-            }
-
-            TrackerStates.push_back(newState);
+            // The ring recycles its oldest slot once full - no allocation
+            TrackerStates.push(newState);
         }
     }
 
@@ -404,6 +571,13 @@ IDeviceInterface::ePollResult PS3EyeTracker::poll()
 
 void PS3EyeTracker::close()
 {
+    // Stop the capture thread before tearing down the video capture it reads from
+    if (FrameGrabber != nullptr)
+    {
+        delete FrameGrabber;
+        FrameGrabber = nullptr;
+    }
+
     if (CaptureData != nullptr)
     {
         delete CaptureData;
@@ -417,6 +591,94 @@ void PS3EyeTracker::close()
     }
 }
 
+bool PS3EyeTracker::reopenVideoCaptureForCaptureMode()
+{
+    int mode_width, mode_height, mode_fps;
+    PS3EyeTrackerConfig::getCaptureModeProperties(cfg.captureMode, mode_width, mode_height, mode_fps);
+
+    SERVER_LOG_INFO("PS3EyeTracker::reopenVideoCaptureForCaptureMode") <<
+        "Re-opening PS3EyeTracker(" << USBDevicePath << ") at " <<
+        mode_width << "x" << mode_height << "@" << mode_fps << "Hz";
+
+    VideoCapture->setRequestedCaptureMode(mode_width, mode_height, mode_fps);
+
+    bool bSuccess = VideoCapture->open(CameraIndex);
+
+    if (bSuccess)
+    {
+        // Re-opening resets the camera, so push the cached settings again.
+        // The cache rather than the config is authoritative here: a sweep
+        // or a slider may have set values that were never saved.
+        VideoCapture->set(cv::CAP_PROP_EXPOSURE, CachedExposure);
+        VideoCapture->set(cv::CAP_PROP_GAIN, CachedGain);
+    }
+    else
+    {
+        SERVER_LOG_ERROR("PS3EyeTracker::reopenVideoCaptureForCaptureMode") <<
+            "Failed to re-open PS3EyeTracker(" << USBDevicePath << ")";
+    }
+
+    return bSuccess;
+}
+
+bool PS3EyeTracker::restartWedgedVideoCapture(float seconds_since_last_frame)
+{
+    const TrackerManagerConfig &tracker_cfg = DeviceManager::getInstance()->m_tracker_manager->getConfig();
+
+    SERVER_LOG_WARNING("PS3EyeTracker::restartWedgedVideoCapture") <<
+        "PS3EyeTracker(" << USBDevicePath << ") capture silent for " <<
+        seconds_since_last_frame << "s - restarting the capture path";
+
+    LastCaptureRestartTime = std::chrono::high_resolution_clock::now();
+
+    // Ask the capture thread to stop, waiting only briefly - if it is truly
+    // wedged inside the driver it never comes back
+    const bool bThreadExited = FrameGrabber->shutdownWithTimeout(k_capture_thread_join_timeout);
+
+    if (bThreadExited)
+    {
+        delete FrameGrabber;
+        FrameGrabber = nullptr;
+    }
+    else
+    {
+        // The abandoned thread still references the grabber and the video
+        // capture, so both are intentionally leaked. If the stuck driver
+        // call ever returns the thread cleans itself up against the old
+        // objects and exits.
+        SERVER_LOG_ERROR("PS3EyeTracker::restartWedgedVideoCapture") <<
+            "PS3EyeTracker(" << USBDevicePath << ") capture thread stuck in the driver - " <<
+            "abandoning the thread and its video capture";
+
+        FrameGrabber = nullptr;
+        VideoCapture = new PSEyeVideoCapture(CameraIndex);
+    }
+
+    // Re-open the capture at the configured mode, which also resets the
+    // camera hardware and re-applies the exposure/gain settings
+    bool bSuccess = reopenVideoCaptureForCaptureMode();
+
+    if (bSuccess)
+    {
+        FrameGrabber =
+            new PSEyeAsyncFrameGrabber(
+                VideoCapture,
+                static_cast<unsigned int>(tracker_cfg.capture_thread_affinity_mask),
+                tracker_cfg.capture_thread_priority);
+        bSuccess = FrameGrabber->startup();
+    }
+
+    if (!bSuccess)
+    {
+        // Leave the grabber down; the poll failure count will close the
+        // device and the reconnect rescan gets to try a full re-open
+        SERVER_LOG_ERROR("PS3EyeTracker::restartWedgedVideoCapture") <<
+            "PS3EyeTracker(" << USBDevicePath << ") capture restart failed";
+    }
+
+    return bSuccess;
+}
+
 long PS3EyeTracker::getMaxPollFailureCount() const
 {
     return cfg.max_poll_failure_count;
@@ -429,11 +691,7 @@ CommonDeviceState::eDeviceType PS3EyeTracker::getDeviceType() const
 
 const CommonDeviceState *PS3EyeTracker::getState(int lookBack) const
 {
-    const int queueSize = static_cast<int>(TrackerStates.size());
-    const CommonDeviceState * result =
-        (lookBack < queueSize) ? &TrackerStates.at(queueSize - lookBack - 1) : nullptr;
-
-    return result;
+    return TrackerStates.getLookBackState(lookBack);
 }
 
 ITrackerInterface::eDriverType PS3EyeTracker::getDriverType() const
@@ -505,6 +763,26 @@ bool PS3EyeTracker::getVideoFrameDimensions(
     return bSuccess;
 }
 
+bool PS3EyeTracker::getIsVideoFrameBayer() const
+{
+    return VideoCapture != nullptr && VideoCapture->getIsBayerFrame();
+}
+
+std::chrono::time_point<std::chrono::high_resolution_clock> PS3EyeTracker::getVideoFrameCaptureTimestamp() const
+{
+    return LastFrameCaptureTimestamp;
+}
+
+float PS3EyeTracker::getMeasuredCaptureRateFps() const
+{
+    return (FrameGrabber != nullptr) ? FrameGrabber->getMeasuredCaptureRateFps() : 0.f;
+}
+
+uint64_t PS3EyeTracker::getDroppedFrameCount() const
+{
+    return (FrameGrabber != nullptr) ? FrameGrabber->getDroppedFrameCount() : 0;
+}
+
 const unsigned char *PS3EyeTracker::getVideoFrameBuffer() const
 {
     const unsigned char *result = nullptr;
@@ -519,19 +797,19 @@ const unsigned char *PS3EyeTracker::getVideoFrameBuffer() const
 
 void PS3EyeTracker::loadSettings()
 {
-    const double currentExposure= VideoCapture->get(cv::CAP_PROP_EXPOSURE);
-    const double currentGain= VideoCapture->get(cv::CAP_PROP_GAIN);
+    const double currentExposure= CachedExposure;
+    const double currentGain= CachedGain;
 
     cfg.load();
 
     if (currentExposure != cfg.exposure)
     {
-        VideoCapture->set(cv::CAP_PROP_EXPOSURE, cfg.exposure);
+        setExposure(cfg.exposure, false);
     }
 
     if (currentGain != cfg.gain)
     {
-        VideoCapture->set(cv::CAP_PROP_GAIN, cfg.gain);
+        setGain(cfg.gain, false);
     }
 }
 
@@ -542,7 +820,24 @@ void PS3EyeTracker::saveSettings()
 
 void PS3EyeTracker::setExposure(double value, bool bUpdateConfig)
 {
-    VideoCapture->set(cv::CAP_PROP_EXPOSURE, value);
+    // The cache is authoritative: reads see the new value immediately.
+    // The hardware write is handed to the capture thread, which applies it
+    // between frames - the service thread never issues a USB control
+    // transfer while capture transfers are in flight on the same bus, and
+    // since the write happens on the thread that owns the camera handle
+    // there is no need to pause the capture around it.
+    CachedExposure = value;
+
+    const bool bQueued =
+        FrameGrabber != nullptr &&
+        FrameGrabber->getIsRunning() &&
+        FrameGrabber->queuePropertyChange(cv::CAP_PROP_EXPOSURE, value);
+
+    if (!bQueued)
+    {
+        // No capture thread to hand the write to - apply it directly
+        VideoCapture->set(cv::CAP_PROP_EXPOSURE, value);
+    }
 
 	if (bUpdateConfig)
 	{
@@ -552,12 +847,22 @@ void PS3EyeTracker::setExposure(double value, bool bUpdateConfig)
 
 double PS3EyeTracker::getExposure() const
 {
-    return VideoCapture->get(cv::CAP_PROP_EXPOSURE);
+    return CachedExposure;
 }
 
 void PS3EyeTracker::setGain(double value, bool bUpdateConfig)
 {
-	VideoCapture->set(cv::CAP_PROP_GAIN, value);
+    CachedGain = value;
+
+    const bool bQueued =
+        FrameGrabber != nullptr &&
+        FrameGrabber->getIsRunning() &&
+        FrameGrabber->queuePropertyChange(cv::CAP_PROP_GAIN, value);
+
+    if (!bQueued)
+    {
+        VideoCapture->set(cv::CAP_PROP_GAIN, value);
+    }
 
 	if (bUpdateConfig)
 	{
@@ -567,7 +872,7 @@ void PS3EyeTracker::setGain(double value, bool bUpdateConfig)
 
 double PS3EyeTracker::getGain() const
 {
-	return VideoCapture->get(cv::CAP_PROP_GAIN);
+	return CachedGain;
 }
 
 void PS3EyeTracker::getCameraIntrinsics(
@@ -576,10 +881,17 @@ void PS3EyeTracker::getCameraIntrinsics(
     float &outDistortionK1, float &outDistortionK2, float &outDistortionK3,
     float &outDistortionP1, float &outDistortionP2) const
 {
-    outFocalLengthX = static_cast<float>(cfg.focalLengthX);
-    outFocalLengthY = static_cast<float>(cfg.focalLengthY);
-    outPrincipalX = static_cast<float>(cfg.principalX);
-    outPrincipalY = static_cast<float>(cfg.principalY);
+    // The lens calibration is stored at 640x480. Focal lengths and principal
+    // point are in pixels, so they scale linearly with the capture resolution.
+    // The distortion coefficients apply to normalized coordinates and don't.
+    int mode_width, mode_height, mode_fps;
+    PS3EyeTrackerConfig::getCaptureModeProperties(cfg.captureMode, mode_width, mode_height, mode_fps);
+    const double scale = static_cast<double>(mode_width) / k_calibration_frame_width;
+
+    outFocalLengthX = static_cast<float>(cfg.focalLengthX * scale);
+    outFocalLengthY = static_cast<float>(cfg.focalLengthY * scale);
+    outPrincipalX = static_cast<float>(cfg.principalX * scale);
+    outPrincipalY = static_cast<float>(cfg.principalY * scale);
     outDistortionK1 = static_cast<float>(cfg.distortionK1);
     outDistortionK2 = static_cast<float>(cfg.distortionK2);
     outDistortionK3 = static_cast<float>(cfg.distortionK3);
@@ -593,10 +905,16 @@ void PS3EyeTracker::setCameraIntrinsics(
     float distortionK1, float distortionK2, float distortionK3,
     float distortionP1, float distortionP2)
 {
-    cfg.focalLengthX = focalLengthX;
-    cfg.focalLengthY = focalLengthY;
-    cfg.principalX = principalX;
-    cfg.principalY = principalY;
+    // Incoming values are in the active capture mode's pixels;
+    // normalize back to the 640x480 reference before storing
+    int mode_width, mode_height, mode_fps;
+    PS3EyeTrackerConfig::getCaptureModeProperties(cfg.captureMode, mode_width, mode_height, mode_fps);
+    const double inv_scale = k_calibration_frame_width / static_cast<double>(mode_width);
+
+    cfg.focalLengthX = focalLengthX * inv_scale;
+    cfg.focalLengthY = focalLengthY * inv_scale;
+    cfg.principalX = principalX * inv_scale;
+    cfg.principalY = principalY * inv_scale;
     cfg.distortionK1 = distortionK1;
     cfg.distortionK2 = distortionK2;
     cfg.distortionK3 = distortionK3;
@@ -632,11 +950,19 @@ void PS3EyeTracker::gatherTrackerOptions(
     PSMoveProtocol::Response_ResultTrackerSettings* settings) const
 {
     PSMoveProtocol::OptionSet *optionSet = settings->add_option_sets();
-    
+
     optionSet->set_option_name(OPTION_FOV_SETTING);
     optionSet->add_option_strings(OPTION_FOV_RED_DOT);
     optionSet->add_option_strings(OPTION_FOV_BLUE_DOT);
     optionSet->set_option_index(static_cast<int>(cfg.fovSetting));
+
+    PSMoveProtocol::OptionSet *captureModeSet = settings->add_option_sets();
+
+    captureModeSet->set_option_name(OPTION_CAPTURE_MODE);
+    captureModeSet->add_option_strings(OPTION_CAPTURE_MODE_VGA_60);
+    captureModeSet->add_option_strings(OPTION_CAPTURE_MODE_VGA_75);
+    captureModeSet->add_option_strings(OPTION_CAPTURE_MODE_QVGA_187);
+    captureModeSet->set_option_index(static_cast<int>(cfg.captureMode));
 }
 
 bool PS3EyeTracker::setOptionIndex(
@@ -654,6 +980,34 @@ bool PS3EyeTracker::setOptionIndex(
 
         bValidOption = true;
     }
+    else if (option_name == OPTION_CAPTURE_MODE &&
+        option_index >= 0 &&
+        option_index < PS3EyeTrackerConfig::eCaptureMode::MAX_CAPTURE_MODES)
+    {
+        const PS3EyeTrackerConfig::eCaptureMode newMode =
+            static_cast<PS3EyeTrackerConfig::eCaptureMode>(option_index);
+
+        if (newMode != cfg.captureMode)
+        {
+            cfg.captureMode = newMode;
+
+            // Pause the capture thread while the camera restarts in the new mode
+            const bool bWasGrabbing = FrameGrabber != nullptr && FrameGrabber->getIsRunning();
+            if (bWasGrabbing)
+            {
+                FrameGrabber->shutdown();
+            }
+
+            reopenVideoCaptureForCaptureMode();
+
+            if (bWasGrabbing)
+            {
+                FrameGrabber->startup();
+            }
+        }
+
+        bValidOption = true;
+    }
 
     return bValidOption;
 }
@@ -669,6 +1023,11 @@ bool PS3EyeTracker::getOptionIndex(
         out_option_index = static_cast<int>(cfg.fovSetting);
         bValidOption = true;
     }
+    else if (option_name == OPTION_CAPTURE_MODE)
+    {
+        out_option_index = static_cast<int>(cfg.captureMode);
+        bValidOption = true;
+    }
 
     return bValidOption;
 }
@@ -708,11 +1067,35 @@ void PS3EyeTracker::setTrackingColorPreset(
 }
 
 void PS3EyeTracker::getTrackingColorPreset(
-	const std::string &controller_serial, 
-    eCommonTrackingColorID color, 
+	const std::string &controller_serial,
+    eCommonTrackingColorID color,
     CommonHSVColorRange *out_preset) const
 {
 	const CommonHSVColorRangeTable *table= cfg.getColorRangeTable(controller_serial);
 
     *out_preset = table->color_presets[color];
 }
+
+void PS3EyeTracker::setExclusionAreas(
+	const CommonScreenRect *areas,
+	int area_count)
+{
+	const int clamped_count = std::min(area_count, static_cast<int>(ITrackerInterface::MAX_EXCLUSION_AREAS));
+
+	cfg.ExclusionAreas.assign(areas, areas + clamped_count);
+	cfg.save();
+}
+
+int PS3EyeTracker::getExclusionAreas(
+	CommonScreenRect *out_areas,
+	int max_area_count) const
+{
+	const int area_count = std::min(static_cast<int>(cfg.ExclusionAreas.size()), max_area_count);
+
+	for (int area_index = 0; area_index < area_count; ++area_index)
+	{
+		out_areas[area_index] = cfg.ExclusionAreas[area_index];
+	}
+
+	return area_count;
+}
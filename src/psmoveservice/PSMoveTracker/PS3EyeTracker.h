@@ -5,9 +5,11 @@
 #include "PSMoveConfig.h"
 #include "DeviceEnumerator.h"
 #include "DeviceInterface.h"
+#include "DeviceStateRingBuffer.h"
 #include <string>
 #include <vector>
-#include <deque>
+
+#define PS3EYE_STATE_BUFFER_MAX 16
 
 // -- pre-declarations -----
 namespace PSMoveProtocol
@@ -23,10 +25,23 @@ public:
     {
         RedDot, // 56 degree FOV
         BlueDot, // 75 degree FOV
-        
+
         MAX_FOV_SETTINGS
     };
 
+    enum eCaptureMode
+    {
+        VGA_60FPS,   // 640x480 @ 60Hz (the historical default)
+        VGA_75FPS,   // 640x480 @ 75Hz
+        QVGA_187FPS, // 320x240 @ 187Hz - trades resolution for rate
+
+        MAX_CAPTURE_MODES
+    };
+
+    /// The frame dimensions and rate the camera runs at in the given mode
+    static void getCaptureModeProperties(
+        eCaptureMode mode, int &out_width, int &out_height, int &out_fps);
+
     PS3EyeTrackerConfig(const std::string &fnamebase = "PS3EyeTrackerConfig");
     
     virtual const boost::property_tree::ptree config2ptree();
@@ -37,6 +52,11 @@ public:
     
     bool is_valid;
     long max_poll_failure_count;
+    // Seconds of capture thread silence before the capture watchdog tears
+    // down and re-opens just this camera's capture path (0 = disabled).
+    // Recovery is local to the tracker: controllers, other trackers and
+    // client connections are untouched.
+    float capture_watchdog_timeout;
     double exposure;
 	double gain;
     double focalLengthX;
@@ -54,9 +74,13 @@ public:
     double distortionP2;
 
     eFOVSetting fovSetting;
+    // Capture resolution + rate. The lens calibration above is always stored
+    // at 640x480 and scaled to the active mode when queried.
+    eCaptureMode captureMode;
     CommonDevicePose pose;
 	CommonHSVColorRangeTable SharedColorPresets;
 	std::vector<CommonHSVColorRangeTable> DeviceColorPresets;
+	std::vector<CommonScreenRect> ExclusionAreas;
 
     static const int CONFIG_VERSION;
 	static const int LENS_CALIBRATION_VERSION;
@@ -102,6 +126,10 @@ public:
     std::string getUSBDevicePath() const override;
     bool getVideoFrameDimensions(int *out_width, int *out_height, int *out_stride) const override;
     const unsigned char *getVideoFrameBuffer() const override;
+    bool getIsVideoFrameBayer() const override;
+    std::chrono::time_point<std::chrono::high_resolution_clock> getVideoFrameCaptureTimestamp() const override;
+    float getMeasuredCaptureRateFps() const override;
+    uint64_t getDroppedFrameCount() const override;
     void loadSettings() override;
     void saveSettings() override;
     void setExposure(double value, bool bUpdateConfig) override;
@@ -128,20 +156,42 @@ public:
     void gatherTrackingColorPresets(const std::string &controller_serial, PSMoveProtocol::Response_ResultTrackerSettings* settings) const override;
     void setTrackingColorPreset(const std::string &controller_serial, eCommonTrackingColorID color, const CommonHSVColorRange *preset) override;
     void getTrackingColorPreset(const std::string &controller_serial, eCommonTrackingColorID color, CommonHSVColorRange *out_preset) const override;
+    void setExclusionAreas(const CommonScreenRect *areas, int area_count) override;
+    int getExclusionAreas(CommonScreenRect *out_areas, int max_area_count) const override;
 
     // -- Getters
     inline const PS3EyeTrackerConfig &getConfig() const
     { return cfg; }
 
 private:
+    /// Re-open the video capture at the capture mode stored in the config
+    bool reopenVideoCaptureForCaptureMode();
+
+    /// Capture watchdog recovery: stop the wedged frame grabber (abandoning
+    /// its thread if it won't exit) and bring the capture path back up
+    bool restartWedgedVideoCapture(float seconds_since_last_frame);
+
     PS3EyeTrackerConfig cfg;
     std::string USBDevicePath;
+    int CameraIndex;
     class PSEyeVideoCapture *VideoCapture;
+    class PSEyeAsyncFrameGrabber *FrameGrabber;
     class PSEyeCaptureData *CaptureData;
-    ITrackerInterface::eDriverType DriverType;    
-    
+    ITrackerInterface::eDriverType DriverType;
+
+    // Authoritative cache of the camera's exposure/gain settings. Seeded by
+    // a single read-back at open; after that every get is served from the
+    // cache and every set updates the cache first, so the settings request
+    // handlers never trigger USB control transfers on the capture bus.
+    double CachedExposure;
+    double CachedGain;
+
     // Read Controller State
     int NextPollSequenceNumber;
-    std::deque<PS3EyeTrackerState> TrackerStates;
+    DeviceStateRingBuffer<PS3EyeTrackerState, PS3EYE_STATE_BUFFER_MAX> TrackerStates;
+    std::chrono::time_point<std::chrono::high_resolution_clock> LastFrameCaptureTimestamp;
+
+    // Capture watchdog restart rate limit (epoch until the first restart)
+    std::chrono::time_point<std::chrono::high_resolution_clock> LastCaptureRestartTime;
 };
 #endif // PS3EYE_TRACKER_H
@@ -0,0 +1,341 @@
+//-- includes -----
+#include "PSEyeAsyncFrameGrabber.h"
+#include "DeviceDataReadySignal.h"
+#include "PSEyeVideoCapture.h"
+#include "ServerUtility.h"
+#include "ServiceClock.h"
+#include "ThreadCpuMonitor.h"
+
+#include <chrono>
+
+//-- constants -----
+// Bit in the shared buffer state flagging a frame the reader hasn't fetched yet
+static const int k_fresh_frame_bit = 0x4;
+static const int k_buffer_index_mask = 0x3;
+
+// Smoothing factor for the measured capture rate EMA. At 0.1 a renegotiated
+// frame rate settles in the telemetry within a couple dozen frames.
+static const float k_capture_rate_ema_alpha = 0.1f;
+
+//-- public methods -----
+PSEyeAsyncFrameGrabber::PSEyeAsyncFrameGrabber(
+    PSEyeVideoCapture *video_capture,
+    unsigned int affinity_mask,
+    int priority_offset)
+    : m_video_capture(video_capture)
+    , m_thread_affinity_mask(affinity_mask)
+    , m_thread_priority_offset(priority_offset)
+    , m_shared_buffer_state(1)
+    , m_write_buffer_index(0)
+    , m_read_buffer_index(2)
+    , m_measured_capture_rate_fps(0.f)
+    , m_dropped_frame_count(0)
+    , m_last_frame_delivery_time_us(0)
+    , m_has_delivered_frame(false)
+    , m_claimed_property_slot_count(0)
+    , m_shutdown_requested(false)
+    , m_capture_thread_exited(false)
+    , m_capture_thread_started(false)
+{
+    for (int slot_index = 0; slot_index < k_max_queued_properties; ++slot_index)
+    {
+        m_property_change_slots[slot_index].property_id = -1;
+        m_property_change_slots[slot_index].value.store(0.);
+        m_property_change_slots[slot_index].pending.store(false);
+    }
+}
+
+// The high_resolution_clock time in microseconds, for the atomic
+// last-frame-delivery stamp
+static long long now_us()
+{
+    return
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+}
+
+PSEyeAsyncFrameGrabber::~PSEyeAsyncFrameGrabber()
+{
+    shutdown();
+}
+
+bool PSEyeAsyncFrameGrabber::startup()
+{
+    if (!m_capture_thread_started && m_video_capture != nullptr)
+    {
+        // Until the first frame arrives the silence is measured from startup,
+        // so a camera still spinning up doesn't look like a wedge
+        m_last_frame_delivery_time_us.store(now_us(), std::memory_order_relaxed);
+        m_has_delivered_frame.store(false, std::memory_order_relaxed);
+
+        m_shutdown_requested = false;
+        m_capture_thread_exited = false;
+        m_capture_thread = std::thread(&PSEyeAsyncFrameGrabber::captureThreadFunc, this);
+        m_capture_thread_started = true;
+    }
+
+    return m_capture_thread_started;
+}
+
+void PSEyeAsyncFrameGrabber::shutdown()
+{
+    if (m_capture_thread_started)
+    {
+        m_shutdown_requested = true;
+        m_capture_thread.join();
+        m_capture_thread_started = false;
+    }
+}
+
+bool PSEyeAsyncFrameGrabber::shutdownWithTimeout(float timeout_seconds)
+{
+    bool bThreadExited = true;
+
+    if (m_capture_thread_started)
+    {
+        m_shutdown_requested = true;
+
+        // std::thread has no timed join, so poll the thread's exit flag
+        const std::chrono::time_point<std::chrono::high_resolution_clock> wait_start =
+            std::chrono::high_resolution_clock::now();
+        const std::chrono::duration<float> timeout(timeout_seconds);
+
+        while (!m_capture_thread_exited &&
+               (std::chrono::high_resolution_clock::now() - wait_start) < timeout)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        if (m_capture_thread_exited)
+        {
+            // The thread is past its loop - the join is immediate
+            m_capture_thread.join();
+        }
+        else
+        {
+            // Wedged inside the driver. Abandon the thread; if the driver
+            // call ever returns the thread sees the shutdown request and
+            // exits on its own, which is why this object must now be leaked
+            // instead of deleted.
+            m_capture_thread.detach();
+            bThreadExited = false;
+        }
+
+        m_capture_thread_started = false;
+    }
+
+    return bThreadExited;
+}
+
+bool PSEyeAsyncFrameGrabber::fetchLatestFrame(
+    cv::Mat &out_frame,
+    std::chrono::time_point<std::chrono::high_resolution_clock> &out_capture_time)
+{
+    bool bNewFrameAvailable = false;
+
+    if ((m_shared_buffer_state.load(std::memory_order_acquire) & k_fresh_frame_bit) != 0)
+    {
+        // Trade our buffer for the shared one, clearing the fresh-frame bit.
+        // The capture thread may publish again between the check and the
+        // exchange, in which case we simply get the even newer frame.
+        const int previous_state =
+            m_shared_buffer_state.exchange(m_read_buffer_index, std::memory_order_acq_rel);
+
+        m_read_buffer_index = previous_state & k_buffer_index_mask;
+        bNewFrameAvailable = true;
+    }
+
+    if (bNewFrameAvailable)
+    {
+        out_frame = m_frame_buffers[m_read_buffer_index];
+        out_capture_time = m_frame_capture_times[m_read_buffer_index];
+    }
+
+    return bNewFrameAvailable;
+}
+
+bool PSEyeAsyncFrameGrabber::queuePropertyChange(int property_id, double value)
+{
+    // Reuse the slot already claimed for this property, if any
+    for (int slot_index = 0; slot_index < m_claimed_property_slot_count; ++slot_index)
+    {
+        PropertyChangeSlot &slot = m_property_change_slots[slot_index];
+
+        if (slot.property_id == property_id)
+        {
+            slot.value.store(value, std::memory_order_relaxed);
+            slot.pending.store(true, std::memory_order_release);
+            return true;
+        }
+    }
+
+    if (m_claimed_property_slot_count < k_max_queued_properties)
+    {
+        PropertyChangeSlot &slot = m_property_change_slots[m_claimed_property_slot_count];
+
+        // The property id and value must be visible before the pending flag:
+        // the capture thread only reads a slot after seeing pending set
+        slot.property_id = property_id;
+        slot.value.store(value, std::memory_order_relaxed);
+        slot.pending.store(true, std::memory_order_release);
+
+        ++m_claimed_property_slot_count;
+        return true;
+    }
+
+    return false;
+}
+
+float PSEyeAsyncFrameGrabber::getSecondsSinceLastFrame() const
+{
+    const long long elapsed_us =
+        now_us() - m_last_frame_delivery_time_us.load(std::memory_order_relaxed);
+
+    return static_cast<float>(elapsed_us) / 1000000.f;
+}
+
+//-- protected methods -----
+void PSEyeAsyncFrameGrabber::captureThreadFunc()
+{
+    ThreadCpuMonitor::registerCurrentThread("frame_grabber");
+
+    // Apply any configured scheduling constraints before entering the capture
+    // loop so camera I/O isn't preempted by other processes on the same core
+    if (m_thread_affinity_mask != 0)
+    {
+        ServerUtility::set_current_thread_affinity_mask(m_thread_affinity_mask);
+    }
+    if (m_thread_priority_offset != 0)
+    {
+        ServerUtility::set_current_thread_priority(m_thread_priority_offset);
+    }
+    ServerUtility::register_current_thread_multimedia_class("Games");
+
+    // Previous frame's delivery time, for the capture rate measurement
+    std::chrono::time_point<std::chrono::high_resolution_clock> last_capture_time;
+    bool last_capture_time_valid = false;
+
+    // Prefer the direct PS3EYEDriver path: raw Bayer bytes go straight from
+    // the driver's transfer queue into the triple buffer, skipping the
+    // per-frame cv::VideoCapture grab()/retrieve() emulation. The cv adapter
+    // path stays in use for the CLEYE/generic webcam backends.
+    int direct_width = 0, direct_height = 0;
+    const bool bDirectBayerCapture =
+        m_video_capture->getDirectBayerFrameDimensions(direct_width, direct_height);
+
+    if (bDirectBayerCapture)
+    {
+        // Size the triple buffer once up front; the direct path writes into
+        // preallocated Mats and never reallocates per frame
+        for (int buffer_index = 0; buffer_index < 3; ++buffer_index)
+        {
+            m_frame_buffers[buffer_index].create(direct_height, direct_width, CV_8UC1);
+        }
+    }
+
+    while (!m_shutdown_requested)
+    {
+        // Apply any property writes queued from the service thread before
+        // grabbing the next frame. This thread owns the camera handle, so
+        // the control transfer can't race a frame read, and the new value
+        // is in effect for the very next frame captured.
+        applyQueuedPropertyChanges();
+
+        cv::Mat &write_frame = m_frame_buffers[m_write_buffer_index];
+
+        // Re-assert the buffer geometry in direct mode - a no-op in steady
+        // state, but fetchLatestFrame swaps the reader's Mat into the buffer
+        // ring, so a freshly swapped-in Mat may still be empty
+        if (bDirectBayerCapture)
+        {
+            write_frame.create(direct_height, direct_width, CV_8UC1);
+        }
+
+        // Blocking on frame availability is fine here - this thread has
+        // nothing else to do and the driver paces us at the camera frame rate
+        const bool bFrameCaptured =
+            bDirectBayerCapture
+            ? m_video_capture->retrieveDirectBayerFrame(write_frame.ptr<unsigned char>(0))
+            : m_video_capture->grab() && m_video_capture->retrieve(write_frame);
+
+        if (bFrameCaptured)
+        {
+            // Stamp the frame the moment the driver hands it over. retrieve()
+            // returns as soon as the USB transfer for the frame completed, so
+            // this is as close to true capture time as we can observe without
+            // driver support, and it is immune to service thread scheduling.
+            m_frame_capture_times[m_write_buffer_index] = ServiceClock::now();
+
+            // Feed the capture watchdog's silence timer
+            m_last_frame_delivery_time_us.store(now_us(), std::memory_order_relaxed);
+            m_has_delivered_frame.store(true, std::memory_order_relaxed);
+
+            // Fold this frame's delivery interval into the measured rate
+            if (last_capture_time_valid)
+            {
+                const std::chrono::duration<float> frame_interval =
+                    m_frame_capture_times[m_write_buffer_index] - last_capture_time;
+
+                if (frame_interval.count() > 0.f)
+                {
+                    const float instantaneous_fps = 1.f / frame_interval.count();
+                    const float smoothed_fps = m_measured_capture_rate_fps.load(std::memory_order_relaxed);
+
+                    m_measured_capture_rate_fps.store(
+                        (smoothed_fps > 0.f)
+                        ? smoothed_fps + k_capture_rate_ema_alpha*(instantaneous_fps - smoothed_fps)
+                        : instantaneous_fps,
+                        std::memory_order_relaxed);
+                }
+            }
+            last_capture_time = m_frame_capture_times[m_write_buffer_index];
+            last_capture_time_valid = true;
+
+            // Publish the finished frame and take back whichever buffer
+            // was sitting in the shared slot
+            const int previous_state =
+                m_shared_buffer_state.exchange(
+                    m_write_buffer_index | k_fresh_frame_bit, std::memory_order_acq_rel);
+
+            m_write_buffer_index = previous_state & k_buffer_index_mask;
+
+            // If the fresh bit was still set, the frame we published last
+            // time was never fetched - it just got overwritten
+            if ((previous_state & k_fresh_frame_bit) != 0)
+            {
+                m_dropped_frame_count.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            // Wake the service thread so tracking starts on this frame
+            // immediately instead of at the next tick boundary
+            DeviceDataReadySignal::notifyDataReady();
+        }
+        else
+        {
+            // The camera had no frame for us (still spinning up or stalled).
+            // Don't busy-wait on a dead capture.
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    ThreadCpuMonitor::unregisterCurrentThread();
+
+    // Last store the thread makes - tells a timed shutdown the join is safe
+    m_capture_thread_exited = true;
+}
+
+void PSEyeAsyncFrameGrabber::applyQueuedPropertyChanges()
+{
+    for (int slot_index = 0; slot_index < k_max_queued_properties; ++slot_index)
+    {
+        PropertyChangeSlot &slot = m_property_change_slots[slot_index];
+
+        if (slot.pending.exchange(false, std::memory_order_acquire))
+        {
+            // A concurrent re-queue of the same property can re-set the
+            // pending flag after this exchange - the property just gets
+            // written twice with the newest value, which is harmless
+            m_video_capture->set(slot.property_id, slot.value.load(std::memory_order_relaxed));
+        }
+    }
+}
@@ -0,0 +1,149 @@
+#ifndef PSEYE_ASYNC_FRAME_GRABBER_H
+#define PSEYE_ASYNC_FRAME_GRABBER_H
+
+//-- includes -----
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <opencv2/core/core.hpp>
+
+//-- definitions -----
+/// Owns a capture thread that continuously pulls frames from a PSEyeVideoCapture
+/// into a lock-free triple-buffered "latest frame" slot. The service thread can
+/// then fetch the freshest frame without ever blocking on camera I/O.
+class PSEyeAsyncFrameGrabber
+{
+public:
+    /// affinity_mask / priority_offset are applied to the capture thread each
+    /// time it starts (0 = leave scheduling to the OS)
+    PSEyeAsyncFrameGrabber(
+        class PSEyeVideoCapture *video_capture,
+        unsigned int affinity_mask,
+        int priority_offset);
+    ~PSEyeAsyncFrameGrabber();
+
+    /// Spin up the capture thread. Returns false if the thread failed to start.
+    bool startup();
+
+    /// Stop and join the capture thread. Safe to call when not running.
+    void shutdown();
+
+    /// Stop the capture thread, waiting at most timeout_seconds for it to
+    /// exit. A thread wedged inside the camera driver (libusb hangs) never
+    /// honors the shutdown request, so after the timeout it is detached and
+    /// abandoned rather than blocking the service thread forever.
+    /// Returns false if the thread had to be abandoned - the grabber and the
+    /// video capture it reads from must then be leaked, not deleted, since
+    /// the wedged thread still references both.
+    bool shutdownWithTimeout(float timeout_seconds);
+
+    inline bool getIsRunning() const
+    {
+        return m_capture_thread_started;
+    }
+
+    /// Frame delivery rate measured at the capture thread, smoothed over the
+    /// inter-frame intervals the driver actually produced. A camera silently
+    /// renegotiated down to 30fps by USB contention shows up here immediately.
+    inline float getMeasuredCaptureRateFps() const
+    {
+        return m_measured_capture_rate_fps.load(std::memory_order_relaxed);
+    }
+
+    /// Frames the capture thread published that were overwritten before the
+    /// service thread fetched them
+    inline std::uint64_t getDroppedFrameCount() const
+    {
+        return m_dropped_frame_count.load(std::memory_order_relaxed);
+    }
+
+    /// Seconds since the capture thread last pulled a frame off the camera
+    /// driver (measured from thread startup until the first frame arrives).
+    /// A camera delivering at even 30fps never goes silent for more than a
+    /// few tens of milliseconds, so a large value here means the capture
+    /// path is wedged.
+    float getSecondsSinceLastFrame() const;
+
+    /// False until the capture thread has delivered at least one frame since
+    /// the last startup() (cameras can take most of a second to spin up)
+    inline bool getHasEverDeliveredFrame() const
+    {
+        return m_has_delivered_frame.load(std::memory_order_relaxed);
+    }
+
+    /// Swap the freshest captured frame into out_frame without blocking.
+    /// out_capture_time is the time the capture thread pulled the frame off
+    /// the camera driver - i.e. frame delivery time, free of any scheduling
+    /// delay on the calling thread.
+    /// Returns false if no new frame has arrived since the last fetch.
+    bool fetchLatestFrame(
+        cv::Mat &out_frame,
+        std::chrono::time_point<std::chrono::high_resolution_clock> &out_capture_time);
+
+    /// Queue a camera property write to be applied by the capture thread
+    /// between frames. The USB control transfer happens on the thread that
+    /// already owns the camera handle, so the caller never blocks on the bus
+    /// and the write can't race a frame read. Property values are absolute,
+    /// so repeated writes to the same property coalesce - only the latest
+    /// queued value reaches the camera.
+    /// Returns false if the slot table is full (it is sized for the handful
+    /// of properties the tracker drives) and the write was not queued.
+    bool queuePropertyChange(int property_id, double value);
+
+protected:
+    void captureThreadFunc();
+    void applyQueuedPropertyChanges();
+
+private:
+    class PSEyeVideoCapture *m_video_capture;
+    unsigned int m_thread_affinity_mask;
+    int m_thread_priority_offset;
+
+    // Triple buffer used as the latest-frame slot.
+    // The capture thread exclusively owns the buffer at m_write_buffer_index,
+    // the service thread exclusively owns the buffer at m_read_buffer_index
+    // and the third buffer sits in m_shared_buffer_state waiting to be
+    // exchanged. The fresh-frame bit of the shared state flags a frame the
+    // reader hasn't seen yet.
+    cv::Mat m_frame_buffers[3];
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_frame_capture_times[3];
+    std::atomic_int m_shared_buffer_state;
+    int m_write_buffer_index;
+    int m_read_buffer_index;
+
+    // Capture health telemetry, written by the capture thread
+    std::atomic<float> m_measured_capture_rate_fps;
+    std::atomic<std::uint64_t> m_dropped_frame_count;
+
+    // When the capture thread last delivered a frame, in microseconds on the
+    // high_resolution_clock epoch (stamped with the startup time until the
+    // first frame arrives). Written by the capture thread, read by the
+    // capture watchdog on the service thread.
+    std::atomic<long long> m_last_frame_delivery_time_us;
+    std::atomic_bool m_has_delivered_frame;
+
+    // Camera property writes queued from the service thread, drained by the
+    // capture thread between frames. One slot per distinct property: slots
+    // are claimed by the service thread (the only writer) and never
+    // released, and a slot's property_id is published before its first
+    // pending store so the capture thread only reads ids behind the flag.
+    enum { k_max_queued_properties = 4 };
+    struct PropertyChangeSlot
+    {
+        int property_id;
+        std::atomic<double> value;
+        std::atomic_bool pending;
+    };
+    PropertyChangeSlot m_property_change_slots[k_max_queued_properties];
+    int m_claimed_property_slot_count;
+
+    std::thread m_capture_thread;
+    std::atomic_bool m_shutdown_requested;
+    // Set by the capture thread just before it returns, so a timed shutdown
+    // can tell a slow exit from a thread wedged inside the driver
+    std::atomic_bool m_capture_thread_exited;
+    bool m_capture_thread_started;
+};
+
+#endif // PSEYE_ASYNC_FRAME_GRABBER_H
@@ -71,9 +71,10 @@ the DLL that comes with PSMoveService.
 class PSEYECaptureCAM_CLMULTI : public cv::IVideoCapture
 {
 public:
-    PSEYECaptureCAM_CLMULTI(int _index)
+    PSEYECaptureCAM_CLMULTI(int _index, int _width, int _height, int _fps)
         : m_index(-1), m_width(-1), m_height(-1),
-        m_frame(NULL), m_frame4ch(NULL)
+        m_frame(NULL), m_frame4ch(NULL),
+        m_requestedWidth(_width), m_requestedHeight(_height), m_requestedFps(_fps)
     {
         open(_index);
     }
@@ -219,7 +220,9 @@ protected:
         {
             std::cout << "Attempting to open camera " << _index << " of " << cams << "." << std::endl;
             GUID guid = CLEyeGetCameraUUID(_index);
-            m_eye = CLEyeCreateCamera(guid, CLEYE_COLOR_PROCESSED, CLEYE_VGA, 75);
+            const CLEyeCameraResolution resolution =
+                (m_requestedWidth <= 320) ? CLEYE_QVGA : CLEYE_VGA;
+            m_eye = CLEyeCreateCamera(guid, CLEYE_COLOR_PROCESSED, resolution, (float)m_requestedFps);
             CLEyeCameraGetFrameDimensions(m_eye, m_width, m_height);
             
             m_frame4ch = cvCreateImage(cvSize(m_width, m_height), IPL_DEPTH_8U, 4);
@@ -247,6 +250,7 @@ protected:
     
     
     int m_index, m_width, m_height;
+    int m_requestedWidth, m_requestedHeight, m_requestedFps;
     PBYTE pCapBuffer;
     IplImage* m_frame;
     IplImage* m_frame4ch;
@@ -262,9 +266,10 @@ protected:
 class PSEYECaptureCAM_PS3EYE : public cv::IVideoCapture
 {
 public:
-    PSEYECaptureCAM_PS3EYE(int _index)
+    PSEYECaptureCAM_PS3EYE(int _index, int _width, int _height, int _fps)
     : m_index(-1), m_width(-1), m_height(-1), m_widthStep(-1),
-    m_size(-1), m_MatBayer(0, 0, CV_8UC1)
+    m_size(-1),
+    m_requestedWidth(_width), m_requestedHeight(_height), m_requestedFps(_fps)
     {
         //CoInitialize(NULL);
         open(_index);
@@ -351,11 +356,35 @@ public:
         return eye->isStreaming();
     }
 
+    // Direct path used by PSEyeVideoCapture::retrieveDirectBayerFrame():
+    // the next frame goes from the driver's transfer queue straight into
+    // dest, with no cv::OutputArray plumbing in between
+    bool retrieveBayerFrame(unsigned char *dest)
+    {
+        if (!eye)
+        {
+            return false;
+        }
+
+        eye->getFrame(dest);
+
+        return true;
+    }
+
+    void getFrameDimensions(int &out_width, int &out_height) const
+    {
+        out_width = m_width;
+        out_height = m_height;
+    }
+
     bool retrieveFrame(int outputType, cv::OutputArray outArray)
     {
-        eye->getFrame(m_MatBayer.data);
+        // Deliver the raw single-channel Bayer frame straight from the driver.
+        // Debayering is fused with the HSV conversion downstream in the
+        // tracking pipeline instead of paying a full-frame conversion here.
+        outArray.create(m_height, m_width, CV_8UC1);
+        eye->getFrame(outArray.getMat().data);
 
-        cv::cvtColor(m_MatBayer, outArray, CV_BayerGB2BGR);
         return true;
     }
 
@@ -397,7 +426,7 @@ protected:
             
             eye = devices[_index];
             
-            if (eye && eye->init(640, 480, 60, ps3eye::PS3EYECam::EOutputFormat::Bayer))
+            if (eye && eye->init(m_requestedWidth, m_requestedHeight, m_requestedFps, ps3eye::PS3EYECam::EOutputFormat::Bayer))
             {
                 // Change any default settings here
                 
@@ -429,12 +458,11 @@ protected:
         m_widthStep = eye->getRowBytes(); // just width * 1 byte per pixel.
         m_height = eye->getHeight();
         m_size = m_widthStep * m_height;
-        m_MatBayer.create(cv::Size(m_width, m_height), CV_8UC1);
     }
 
     int m_index, m_width, m_height, m_widthStep;
     size_t m_size;
-    cv::Mat m_MatBayer;
+    int m_requestedWidth, m_requestedHeight, m_requestedFps;
     ps3eye::PS3EYECam::PS3EYERef eye;
 };
 
@@ -476,6 +504,8 @@ bool PSEyeVideoCapture::open(int index)
         release();
     }
 
+    m_bayerFrame = false;
+
 	// Try to open a PS3EYE-specific camera capture
     // Only works for CLEYE_MULTICAM and PS3EYEDRIVER
     icap = pseyeVideoCapture_create(index);
@@ -603,6 +633,42 @@ std::string PSEyeVideoCapture::getUniqueIndentifier() const
     return m_indentifier;
 }
 
+bool PSEyeVideoCapture::retrieveDirectBayerFrame(unsigned char *dest)
+{
+#ifdef HAVE_PS3EYE
+    if (m_bayerFrame && !icap.empty())
+    {
+        cv::Ptr<PSEYECaptureCAM_PS3EYE> ps3eye_capture = icap.dynamicCast<PSEYECaptureCAM_PS3EYE>();
+
+        if (ps3eye_capture)
+        {
+            return ps3eye_capture->retrieveBayerFrame(dest);
+        }
+    }
+#endif
+
+    return false;
+}
+
+bool PSEyeVideoCapture::getDirectBayerFrameDimensions(int &out_width, int &out_height) const
+{
+#ifdef HAVE_PS3EYE
+    if (m_bayerFrame && !icap.empty())
+    {
+        cv::Ptr<PSEYECaptureCAM_PS3EYE> ps3eye_capture = icap.dynamicCast<PSEYECaptureCAM_PS3EYE>();
+
+        if (ps3eye_capture)
+        {
+            ps3eye_capture->getFrameDimensions(out_width, out_height);
+
+            return true;
+        }
+    }
+#endif
+
+    return false;
+}
+
 cv::Ptr<cv::IVideoCapture> PSEyeVideoCapture::pseyeVideoCapture_create(int index)
 {
     // https://github.com/Itseez/opencv/blob/09e6c82190b558e74e2e6a53df09844665443d6d/modules/videoio/src/cap.cpp#L432
@@ -636,7 +702,7 @@ cv::Ptr<cv::IVideoCapture> PSEyeVideoCapture::pseyeVideoCapture_create(int index
 #ifdef HAVE_CLEYE
             case PSEYE_CAP_CLMULTI:
                 {
-                    capture = cv::makePtr<PSEYECaptureCAM_CLMULTI>(index);
+                    capture = cv::makePtr<PSEYECaptureCAM_CLMULTI>(index, m_requestedWidth, m_requestedHeight, m_requestedFps);
                     m_indentifier = capture.dynamicCast<PSEYECaptureCAM_CLMULTI>()->getUniqueIndentifier();
                 }
                 break;
@@ -659,7 +725,7 @@ cv::Ptr<cv::IVideoCapture> PSEyeVideoCapture::pseyeVideoCapture_create(int index
 #ifdef HAVE_PS3EYE
             case PSEYE_CAP_PS3EYE:
                 {
-                    capture = cv::makePtr<PSEYECaptureCAM_PS3EYE>(index);
+                    capture = cv::makePtr<PSEYECaptureCAM_PS3EYE>(index, m_requestedWidth, m_requestedHeight, m_requestedFps);
                     m_indentifier = capture.dynamicCast<PSEYECaptureCAM_PS3EYE>()->getUniqueIndentifier();
                 }
                 break;
@@ -667,6 +733,9 @@ cv::Ptr<cv::IVideoCapture> PSEyeVideoCapture::pseyeVideoCapture_create(int index
         }
         if (capture && capture->isOpened())
         {
+#ifdef HAVE_PS3EYE
+            m_bayerFrame = (capture->getCaptureDomain() == PSEYE_CAP_PS3EYE);
+#endif
             return capture;
         }
 #endif
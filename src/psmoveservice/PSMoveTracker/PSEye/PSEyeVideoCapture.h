@@ -33,7 +33,16 @@ public:
     */
     PSEyeVideoCapture(int camindex)
         : m_index(-1) {open(camindex);} // Constructor is same as base class
-    
+
+    /// Set the frame dimensions and rate requested at the next open().
+    /// Backends that only support one mode (CL Eye Driver DShow) ignore this.
+    void setRequestedCaptureMode(int width, int height, int fps)
+    {
+        m_requestedWidth = width;
+        m_requestedHeight = height;
+        m_requestedFps = fps;
+    }
+
     /// Attempts to open a device using different drivers in the order outlined above.
     /*
     If a PS3 Eye device is not found, fall back to base class cv::VideoCapture::open(index)
@@ -48,10 +57,29 @@ public:
 
     /// Get the unique identifier for the camera
     std::string getUniqueIndentifier() const;
-    
+
+    /// True if retrieve() delivers raw single-channel Bayer frames (PS3EYEDriver path)
+    /// rather than converted BGR frames
+    bool getIsBayerFrame() const { return m_bayerFrame; }
+
+    /// Direct PS3EYEDriver frame access, bypassing the cv::VideoCapture
+    /// grab()/retrieve() emulation. Blocks for the next frame and writes the
+    /// raw Bayer bytes straight from the driver's transfer queue into dest
+    /// (sized from getDirectBayerFrameDimensions). Returns false on every
+    /// other backend - the cv adapter path stays in use there.
+    bool retrieveDirectBayerFrame(unsigned char *dest);
+
+    /// Frame geometry of the direct Bayer path.
+    /// Returns false on non-PS3EYEDriver backends.
+    bool getDirectBayerFrameDimensions(int &out_width, int &out_height) const;
+
 protected:
     int m_index; /**< Keep track of index. Necessary for PSEYE_CLEYE_DRIVER */
     std::string m_indentifier; /**< Filled in when the tracker is opened */
+    bool m_bayerFrame = false; /**< True when the PS3EYEDriver capture delivers raw Bayer frames */
+    int m_requestedWidth = 640; /**< Capture mode requested at the next open() */
+    int m_requestedHeight = 480;
+    int m_requestedFps = 60;
 
 private:
     /// Get the camera capture. If successful, we will have a functional cv::Ptr<CvCapture> \ref cap member variable.
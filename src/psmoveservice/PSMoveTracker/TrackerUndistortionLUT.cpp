@@ -0,0 +1,212 @@
+//-- includes -----
+#include "TrackerUndistortionLUT.h"
+#include "MathUtility.h"
+#include "ServerUtility.h"
+
+#include "opencv2/calib3d/calib3d.hpp"
+
+#include <algorithm>
+#include <fstream>
+
+//-- constants ----
+// Header of the on-disk undistortion map cache
+static const uint32_t k_undistort_lut_magic = 0x4C555350; // 'PSUL'
+static const uint32_t k_undistort_lut_version = 1;
+
+//-- public methods -----
+TrackerUndistortionLUT::TrackerUndistortionLUT(
+    const cv::Matx33f &camera_matrix,
+    const cv::Matx<float, 5, 1> &distortions,
+    int width, int height,
+    const std::string &cache_directory)
+    : m_camera_matrix(camera_matrix)
+    , m_distortions(distortions)
+    , m_width(width)
+    , m_height(height)
+    , m_cache_directory(cache_directory)
+{
+    m_calibration_hash = computeCalibrationHash();
+    m_normalized_map = cv::Mat(m_height, m_width, CV_32FC2);
+
+    if (!loadFromCacheFile())
+    {
+        buildMap();
+        saveToCacheFile();
+    }
+}
+
+void TrackerUndistortionLUT::undistortContourNormalized(
+    const t_opencv_float_contour &distorted_contour,
+    t_opencv_float_contour &out_undistorted_contour) const
+{
+    out_undistorted_contour.resize(distorted_contour.size());
+
+    for (size_t point_index = 0; point_index < distorted_contour.size(); ++point_index)
+    {
+        out_undistorted_contour[point_index] = sampleNormalized(distorted_contour[point_index]);
+    }
+}
+
+void TrackerUndistortionLUT::undistortContourPixel(
+    const t_opencv_float_contour &distorted_contour,
+    t_opencv_float_contour &out_undistorted_contour) const
+{
+    const float fx = m_camera_matrix.val[0];
+    const float fy = m_camera_matrix.val[4];
+    const float cx = m_camera_matrix.val[2];
+    const float cy = m_camera_matrix.val[5];
+
+    out_undistorted_contour.resize(distorted_contour.size());
+
+    for (size_t point_index = 0; point_index < distorted_contour.size(); ++point_index)
+    {
+        const cv::Point2f normalized = sampleNormalized(distorted_contour[point_index]);
+
+        out_undistorted_contour[point_index] = cv::Point2f(normalized.x*fx + cx, normalized.y*fy + cy);
+    }
+}
+
+//-- private methods -----
+/// Bilinear sample of the normalized undistortion map at a pixel location
+cv::Point2f TrackerUndistortionLUT::sampleNormalized(const cv::Point2f &pixel) const
+{
+    const float x = clampf(pixel.x, 0.f, static_cast<float>(m_width - 1));
+    const float y = clampf(pixel.y, 0.f, static_cast<float>(m_height - 1));
+
+    const int x0 = std::min(static_cast<int>(x), m_width - 2);
+    const int y0 = std::min(static_cast<int>(y), m_height - 2);
+    const float tx = x - static_cast<float>(x0);
+    const float ty = y - static_cast<float>(y0);
+
+    const cv::Vec2f &m00 = m_normalized_map.at<cv::Vec2f>(y0, x0);
+    const cv::Vec2f &m01 = m_normalized_map.at<cv::Vec2f>(y0, x0 + 1);
+    const cv::Vec2f &m10 = m_normalized_map.at<cv::Vec2f>(y0 + 1, x0);
+    const cv::Vec2f &m11 = m_normalized_map.at<cv::Vec2f>(y0 + 1, x0 + 1);
+
+    const cv::Vec2f top = m00 + (m01 - m00)*tx;
+    const cv::Vec2f bottom = m10 + (m11 - m10)*tx;
+    const cv::Vec2f result = top + (bottom - top)*ty;
+
+    return cv::Point2f(result.val[0], result.val[1]);
+}
+
+/// FNV-1a over the intrinsics, distortion coefficients and frame size
+uint64_t TrackerUndistortionLUT::computeCalibrationHash() const
+{
+    uint64_t hash = 0xcbf29ce484222325ull;
+
+    auto hash_bytes = [&hash](const void *data, size_t size)
+    {
+        const unsigned char *bytes = static_cast<const unsigned char *>(data);
+        for (size_t byte_index = 0; byte_index < size; ++byte_index)
+        {
+            hash ^= bytes[byte_index];
+            hash *= 0x100000001b3ull;
+        }
+    };
+
+    hash_bytes(m_camera_matrix.val, sizeof(m_camera_matrix.val));
+    hash_bytes(m_distortions.val, sizeof(m_distortions.val));
+    hash_bytes(&m_width, sizeof(m_width));
+    hash_bytes(&m_height, sizeof(m_height));
+
+    return hash;
+}
+
+std::string TrackerUndistortionLUT::getCacheFilePath() const
+{
+    char filename[64];
+    ServerUtility::format_string(
+        filename, sizeof(filename), "undistort_lut_%016llx.bin",
+        static_cast<unsigned long long>(m_calibration_hash));
+
+    return m_cache_directory + "/" + filename;
+}
+
+/// Run the iterative solver once per pixel to fill the normalized map
+void TrackerUndistortionLUT::buildMap()
+{
+    std::vector<cv::Point2f> row_points(m_width);
+    std::vector<cv::Point2f> undistorted_row(m_width);
+
+    for (int y = 0; y < m_height; ++y)
+    {
+        for (int x = 0; x < m_width; ++x)
+        {
+            row_points[x] = cv::Point2f(static_cast<float>(x), static_cast<float>(y));
+        }
+
+        cv::undistortPoints(row_points, undistorted_row, m_camera_matrix, m_distortions);
+
+        cv::Vec2f *map_row = m_normalized_map.ptr<cv::Vec2f>(y);
+        for (int x = 0; x < m_width; ++x)
+        {
+            map_row[x] = cv::Vec2f(undistorted_row[x].x, undistorted_row[x].y);
+        }
+    }
+}
+
+bool TrackerUndistortionLUT::loadFromCacheFile()
+{
+    if (m_cache_directory.empty())
+    {
+        return false;
+    }
+
+    bool bLoadedOk = false;
+    std::ifstream in(getCacheFilePath(), std::ifstream::in | std::ifstream::binary);
+
+    if (in.is_open())
+    {
+        uint32_t magic = 0, version = 0;
+        uint64_t calibration_hash = 0;
+        int32_t width = 0, height = 0;
+
+        in.read(reinterpret_cast<char *>(&magic), sizeof(magic));
+        in.read(reinterpret_cast<char *>(&version), sizeof(version));
+        in.read(reinterpret_cast<char *>(&calibration_hash), sizeof(calibration_hash));
+        in.read(reinterpret_cast<char *>(&width), sizeof(width));
+        in.read(reinterpret_cast<char *>(&height), sizeof(height));
+
+        if (in.good() &&
+            magic == k_undistort_lut_magic &&
+            version == k_undistort_lut_version &&
+            calibration_hash == m_calibration_hash &&
+            width == m_width && height == m_height)
+        {
+            const std::streamsize data_size =
+                static_cast<std::streamsize>(m_width)*m_height*sizeof(cv::Vec2f);
+
+            in.read(reinterpret_cast<char *>(m_normalized_map.data), data_size);
+            bLoadedOk = in.good();
+        }
+    }
+
+    return bLoadedOk;
+}
+
+void TrackerUndistortionLUT::saveToCacheFile() const
+{
+    if (m_cache_directory.empty())
+    {
+        return;
+    }
+
+    std::ofstream out(
+        getCacheFilePath(),
+        std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+
+    if (out.is_open())
+    {
+        const int32_t width = m_width, height = m_height;
+        const std::streamsize data_size =
+            static_cast<std::streamsize>(m_width)*m_height*sizeof(cv::Vec2f);
+
+        out.write(reinterpret_cast<const char *>(&k_undistort_lut_magic), sizeof(k_undistort_lut_magic));
+        out.write(reinterpret_cast<const char *>(&k_undistort_lut_version), sizeof(k_undistort_lut_version));
+        out.write(reinterpret_cast<const char *>(&m_calibration_hash), sizeof(m_calibration_hash));
+        out.write(reinterpret_cast<const char *>(&width), sizeof(width));
+        out.write(reinterpret_cast<const char *>(&height), sizeof(height));
+        out.write(reinterpret_cast<const char *>(m_normalized_map.data), data_size);
+    }
+}
@@ -0,0 +1,62 @@
+#ifndef TRACKER_UNDISTORTION_LUT_H
+#define TRACKER_UNDISTORTION_LUT_H
+
+//-- includes -----
+#include "opencv2/core/core.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//-- typedefs ----
+typedef std::vector<cv::Point2f> t_opencv_float_contour;
+
+//-- definitions -----
+/// Precomputed per-pixel undistortion map for one tracker calibration.
+///
+/// cv::undistortPoints runs an iterative solver per point, which shows up hot
+/// when undistorting large contours every frame. Instead the solver runs once
+/// per pixel when the tracker opens (filling a map of normalized undistorted
+/// coordinates) and contours are undistorted by bilinear interpolation into
+/// that map. The map is persisted to cache_directory keyed by a hash of the
+/// calibration, so reopening a tracker with unchanged intrinsics skips the
+/// rebuild entirely. An empty cache_directory disables the on-disk cache.
+class TrackerUndistortionLUT
+{
+public:
+    TrackerUndistortionLUT(
+        const cv::Matx33f &camera_matrix,
+        const cv::Matx<float, 5, 1> &distortions,
+        int width, int height,
+        const std::string &cache_directory);
+
+    /// Undistort a contour into normalized camera space (what
+    /// cv::undistortPoints returns when no new projection matrix is given)
+    void undistortContourNormalized(
+        const t_opencv_float_contour &distorted_contour,
+        t_opencv_float_contour &out_undistorted_contour) const;
+
+    /// Undistort a contour and reproject it back into pixel space (what
+    /// cv::undistortPoints returns when the camera matrix is passed as P)
+    void undistortContourPixel(
+        const t_opencv_float_contour &distorted_contour,
+        t_opencv_float_contour &out_undistorted_contour) const;
+
+private:
+    cv::Point2f sampleNormalized(const cv::Point2f &pixel) const;
+    uint64_t computeCalibrationHash() const;
+    std::string getCacheFilePath() const;
+    void buildMap();
+    bool loadFromCacheFile();
+    void saveToCacheFile() const;
+
+    cv::Matx33f m_camera_matrix;
+    cv::Matx<float, 5, 1> m_distortions;
+    int m_width;
+    int m_height;
+    std::string m_cache_directory;
+    uint64_t m_calibration_hash;
+    cv::Mat m_normalized_map; // CV_32FC2, normalized undistorted coords per pixel
+};
+
+#endif // TRACKER_UNDISTORTION_LUT_H
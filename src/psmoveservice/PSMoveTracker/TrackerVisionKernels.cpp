@@ -0,0 +1,199 @@
+//-- includes -----
+#include "TrackerVisionKernels.h"
+
+#include <algorithm>
+
+//-- private methods -----
+/// RGB -> HSV using OpenCV's 8-bit conventions (H in [0,180))
+static inline void rgb8ToHSV8(const int r, const int g, const int b, unsigned char *out_hsv)
+{
+    const int v = std::max(r, std::max(g, b));
+    const int lo = std::min(r, std::min(g, b));
+    const int delta = v - lo;
+
+    const int s = (v != 0) ? (255*delta) / v : 0;
+    int h = 0;
+    if (delta != 0)
+    {
+        if (v == r)
+        {
+            h = (30*(g - b)) / delta;
+        }
+        else if (v == g)
+        {
+            h = 60 + (30*(b - r)) / delta;
+        }
+        else
+        {
+            h = 120 + (30*(r - g)) / delta;
+        }
+
+        if (h < 0)
+        {
+            h += 180;
+        }
+    }
+
+    out_hsv[0] = static_cast<unsigned char>(h);
+    out_hsv[1] = static_cast<unsigned char>(s);
+    out_hsv[2] = static_cast<unsigned char>(v);
+}
+
+//-- public methods -----
+void fusedBayerGBToHSV(
+    const unsigned char *bayer_pixels, size_t bayer_row_stride,
+    unsigned char *hsv_pixels, size_t hsv_row_stride,
+    int width, int height)
+{
+    const int even_rows = height & ~1;
+    const int even_cols = width & ~1;
+
+    for (int y = 0; y < even_rows; y += 2)
+    {
+        const unsigned char *bayer_row0 = bayer_pixels + y*bayer_row_stride;
+        const unsigned char *bayer_row1 = bayer_pixels + (y + 1)*bayer_row_stride;
+        unsigned char *hsv_row0 = hsv_pixels + y*hsv_row_stride;
+        unsigned char *hsv_row1 = hsv_pixels + (y + 1)*hsv_row_stride;
+
+        for (int x = 0; x < even_cols; x += 2)
+        {
+            const int g = (bayer_row0[x] + bayer_row1[x + 1]) / 2;
+            const int r = bayer_row0[x + 1];
+            const int b = bayer_row1[x];
+
+            unsigned char hsv[3];
+            rgb8ToHSV8(r, g, b, hsv);
+
+            unsigned char *cell0 = hsv_row0 + 3*x;
+            unsigned char *cell1 = hsv_row1 + 3*x;
+            cell0[0] = hsv[0]; cell0[1] = hsv[1]; cell0[2] = hsv[2];
+            cell0[3] = hsv[0]; cell0[4] = hsv[1]; cell0[5] = hsv[2];
+            cell1[0] = hsv[0]; cell1[1] = hsv[1]; cell1[2] = hsv[2];
+            cell1[3] = hsv[0]; cell1[4] = hsv[1]; cell1[5] = hsv[2];
+        }
+    }
+}
+
+void fusedBayerGBToHSVDecimated(
+    const unsigned char *bayer_pixels, size_t bayer_row_stride,
+    int bayer_width, int bayer_height,
+    unsigned char *hsv_pixels, size_t hsv_row_stride,
+    int hsv_width, int hsv_height,
+    int decimation)
+{
+    for (int y = 0; y < hsv_height; ++y)
+    {
+        const int src_y = decimation*y;
+
+        if (src_y + 1 >= bayer_height)
+        {
+            break;
+        }
+
+        const unsigned char *bayer_row0 = bayer_pixels + src_y*bayer_row_stride;
+        const unsigned char *bayer_row1 = bayer_pixels + (src_y + 1)*bayer_row_stride;
+        unsigned char *hsv_row = hsv_pixels + y*hsv_row_stride;
+
+        for (int x = 0; x < hsv_width; ++x)
+        {
+            const int src_x = decimation*x;
+
+            if (src_x + 1 >= bayer_width)
+            {
+                break;
+            }
+
+            const int g = (bayer_row0[src_x] + bayer_row1[src_x + 1]) / 2;
+            const int r = bayer_row0[src_x + 1];
+            const int b = bayer_row1[src_x];
+
+            rgb8ToHSV8(r, g, b, hsv_row + 3*x);
+        }
+    }
+}
+
+static inline unsigned char rgbBoundsTest(
+    const int r, const int g, const int b,
+    const RGBRangeThreshold &bounds)
+{
+    return
+        (r >= bounds.r_min && r <= bounds.r_max &&
+         g >= bounds.g_min && g <= bounds.g_max &&
+         b >= bounds.b_min && b <= bounds.b_max)
+        ? 0xFF : 0x00;
+}
+
+void computeBayerGBRGBRangeMaskDecimated(
+    const unsigned char *bayer_pixels, size_t bayer_row_stride,
+    int bayer_width, int bayer_height,
+    unsigned char *mask_pixels, size_t mask_row_stride,
+    int mask_width, int mask_height,
+    int decimation,
+    const RGBRangeThreshold &bounds)
+{
+    for (int y = 0; y < mask_height; ++y)
+    {
+        const int src_y = decimation*y;
+
+        if (src_y + 1 >= bayer_height)
+        {
+            break;
+        }
+
+        const unsigned char *bayer_row0 = bayer_pixels + src_y*bayer_row_stride;
+        const unsigned char *bayer_row1 = bayer_pixels + (src_y + 1)*bayer_row_stride;
+        unsigned char *mask_row = mask_pixels + y*mask_row_stride;
+
+        for (int x = 0; x < mask_width; ++x)
+        {
+            const int src_x = decimation*x;
+
+            if (src_x + 1 >= bayer_width)
+            {
+                break;
+            }
+
+            const int g = (bayer_row0[src_x] + bayer_row1[src_x + 1]) / 2;
+            const int r = bayer_row0[src_x + 1];
+            const int b = bayer_row1[src_x];
+
+            mask_row[x] = rgbBoundsTest(r, g, b, bounds);
+        }
+    }
+}
+
+void computeBGRRGBRangeMaskDecimated(
+    const unsigned char *bgr_pixels, size_t bgr_row_stride,
+    int bgr_width, int bgr_height,
+    unsigned char *mask_pixels, size_t mask_row_stride,
+    int mask_width, int mask_height,
+    int decimation,
+    const RGBRangeThreshold &bounds)
+{
+    for (int y = 0; y < mask_height; ++y)
+    {
+        const int src_y = decimation*y;
+
+        if (src_y >= bgr_height)
+        {
+            break;
+        }
+
+        const unsigned char *bgr_row = bgr_pixels + src_y*bgr_row_stride;
+        unsigned char *mask_row = mask_pixels + y*mask_row_stride;
+
+        for (int x = 0; x < mask_width; ++x)
+        {
+            const int src_x = decimation*x;
+
+            if (src_x >= bgr_width)
+            {
+                break;
+            }
+
+            const unsigned char *bgr_pixel = bgr_row + 3*src_x;
+
+            mask_row[x] = rgbBoundsTest(bgr_pixel[2], bgr_pixel[1], bgr_pixel[0], bounds);
+        }
+    }
+}
@@ -0,0 +1,56 @@
+#ifndef TRACKER_VISION_KERNELS_H
+#define TRACKER_VISION_KERNELS_H
+
+//-- includes -----
+#include "HSVRangeThreshold.h"
+
+#include <cstddef>
+
+//-- definitions -----
+/// Fused debayer + HSV conversion over a raw Bayer buffer.
+/// The PS3Eye sensor pattern is GRBG (OpenCV's BayerGB): each even-aligned
+/// 2x2 cell holds [G R / B G]. The cell is demosaiced as one RGB sample
+/// (greens averaged) and converted to HSV once, and the result written to all
+/// four pixels of the cell. One pass, no intermediate BGR buffer, and a
+/// quarter of the HSV conversions of the two-stage path.
+/// The buffer must start on an even-aligned pixel so the Bayer phase is preserved.
+void fusedBayerGBToHSV(
+    const unsigned char *bayer_pixels, size_t bayer_row_stride,
+    unsigned char *hsv_pixels, size_t hsv_row_stride,
+    int width, int height);
+
+/// Demosaic and convert every decimation'th Bayer cell into a downscaled
+/// HSV image (hsv_width x hsv_height). Nearest-cell sampling: good enough
+/// to localize candidate blobs, a fraction of the cost of a full conversion.
+void fusedBayerGBToHSVDecimated(
+    const unsigned char *bayer_pixels, size_t bayer_row_stride,
+    int bayer_width, int bayer_height,
+    unsigned char *hsv_pixels, size_t hsv_row_stride,
+    int hsv_width, int hsv_height,
+    int decimation);
+
+/// Classify every decimation'th Bayer cell straight against a precomputed
+/// RGB bounding box and write a downscaled 0/255 mask. Pure integer
+/// compares on the raw sensor bytes - no demosaic output, no HSV
+/// conversion - which makes it the cheapest possible coarse localization
+/// pass. Same nearest-cell sampling as fusedBayerGBToHSVDecimated.
+void computeBayerGBRGBRangeMaskDecimated(
+    const unsigned char *bayer_pixels, size_t bayer_row_stride,
+    int bayer_width, int bayer_height,
+    unsigned char *mask_pixels, size_t mask_row_stride,
+    int mask_width, int mask_height,
+    int decimation,
+    const RGBRangeThreshold &bounds);
+
+/// Same decimated RGB box classification for interleaved BGR sources.
+/// Fuses the nearest-neighbor downscale and the threshold into one pass
+/// over the source instead of a resize followed by an HSV convert + mask.
+void computeBGRRGBRangeMaskDecimated(
+    const unsigned char *bgr_pixels, size_t bgr_row_stride,
+    int bgr_width, int bgr_height,
+    unsigned char *mask_pixels, size_t mask_row_stride,
+    int mask_width, int mask_height,
+    int decimation,
+    const RGBRangeThreshold &bounds);
+
+#endif // TRACKER_VISION_KERNELS_H
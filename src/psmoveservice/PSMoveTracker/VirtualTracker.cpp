@@ -0,0 +1,806 @@
+// -- includes -----
+#include "VirtualTracker.h"
+#include "ServerLog.h"
+#include "ServerUtility.h"
+#include "MathUtility.h"
+#include "PSMoveProtocol.pb.h"
+#include "TrackerDeviceEnumerator.h"
+
+#include <algorithm>
+#include <math.h>
+#include <string.h>
+
+// -- constants -----
+// BGR colors for the synthesized blobs, one per tracking color preset,
+// in eCommonTrackingColorID order
+static const unsigned char k_blob_colors[eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES][3] = {
+    { 255, 0, 255 },    // Magenta
+    { 255, 255, 0 },    // Cyan
+    { 0, 255, 255 },    // Yellow
+    { 0, 0, 255 },      // Red
+    { 0, 255, 0 },      // Green
+    { 255, 0, 0 },      // Blue
+};
+
+// -- public methods
+// -- Virtual Tracker Config
+const int VirtualTrackerConfig::CONFIG_VERSION = 1;
+
+VirtualTrackerConfig::VirtualTrackerConfig(const std::string &fnamebase)
+    : PSMoveConfig(fnamebase)
+    , max_poll_failure_count(100)
+    , frame_width(640)
+    , frame_height(480)
+    , frame_rate(60.0)
+    , blob_count(1)
+    , blob_radius(20.0)
+    , session_capture_file()
+    , session_capture_tracker_id(0)
+    , exposure(32)
+    , gain(32)
+    , focalLengthX(554.2563) // pixels
+    , focalLengthY(554.2563) // pixels
+    , principalX(320.0) // pixels
+    , principalY(240.0) // pixels
+    , hfov(60.0) // degrees
+    , vfov(45.0) // degrees
+    , zNear(10.0) // cm
+    , zFar(200.0) // cm
+    , distortionK1(0.0) // synthetic pinhole camera, no lens distortion
+    , distortionK2(0.0)
+    , distortionK3(0.0)
+    , distortionP1(0.0)
+    , distortionP2(0.0)
+{
+    pose.clear();
+
+	SharedColorPresets.table_name.clear();
+    for (int preset_index = 0; preset_index < eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES; ++preset_index)
+    {
+        SharedColorPresets.color_presets[preset_index] = k_default_color_presets[preset_index];
+    }
+};
+
+const boost::property_tree::ptree
+VirtualTrackerConfig::config2ptree()
+{
+    boost::property_tree::ptree pt;
+
+    pt.put("version", VirtualTrackerConfig::CONFIG_VERSION);
+    pt.put("max_poll_failure_count", max_poll_failure_count);
+    pt.put("frame_width", frame_width);
+    pt.put("frame_height", frame_height);
+    pt.put("frame_rate", frame_rate);
+    pt.put("blob_count", blob_count);
+    pt.put("blob_radius", blob_radius);
+    pt.put("session_capture_file", session_capture_file);
+    pt.put("session_capture_tracker_id", session_capture_tracker_id);
+    pt.put("exposure", exposure);
+	pt.put("gain", gain);
+    pt.put("focalLengthX", focalLengthX);
+    pt.put("focalLengthY", focalLengthY);
+    pt.put("principalX", principalX);
+    pt.put("principalY", principalY);
+    pt.put("hfov", hfov);
+    pt.put("vfov", vfov);
+    pt.put("zNear", zNear);
+    pt.put("zFar", zFar);
+
+    pt.put("pose.orientation.w", pose.Orientation.w);
+    pt.put("pose.orientation.x", pose.Orientation.x);
+    pt.put("pose.orientation.y", pose.Orientation.y);
+    pt.put("pose.orientation.z", pose.Orientation.z);
+    pt.put("pose.position.x", pose.PositionCm.x);
+    pt.put("pose.position.y", pose.PositionCm.y);
+    pt.put("pose.position.z", pose.PositionCm.z);
+
+	writeColorPropertyPresetTable(&SharedColorPresets, pt);
+
+	for (auto &controller_preset_table : DeviceColorPresets)
+	{
+		writeColorPropertyPresetTable(&controller_preset_table, pt);
+	}
+
+    return pt;
+}
+
+void
+VirtualTrackerConfig::ptree2config(const boost::property_tree::ptree &pt)
+{
+    int config_version = pt.get<int>("version", 0);
+    if (config_version == VirtualTrackerConfig::CONFIG_VERSION)
+    {
+        max_poll_failure_count = pt.get<long>("max_poll_failure_count", 100);
+        frame_width = std::max(pt.get<int>("frame_width", frame_width), 64);
+        frame_height = std::max(pt.get<int>("frame_height", frame_height), 64);
+        frame_rate = clampf(static_cast<float>(pt.get<double>("frame_rate", frame_rate)), 1.f, 240.f);
+        blob_count = std::min(std::max(pt.get<int>("blob_count", blob_count), 0), static_cast<int>(eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES));
+        blob_radius = std::max(pt.get<double>("blob_radius", blob_radius), 1.0);
+        session_capture_file = pt.get<std::string>("session_capture_file", "");
+        session_capture_tracker_id = std::max(pt.get<int>("session_capture_tracker_id", 0), 0);
+        exposure = pt.get<double>("exposure", 32);
+		gain = pt.get<double>("gain", 32);
+        focalLengthX = pt.get<double>("focalLengthX", focalLengthX);
+        focalLengthY = pt.get<double>("focalLengthY", focalLengthY);
+        principalX = pt.get<double>("principalX", principalX);
+        principalY = pt.get<double>("principalY", principalY);
+        hfov = pt.get<double>("hfov", 60.0);
+        vfov = pt.get<double>("vfov", 45.0);
+        zNear = pt.get<double>("zNear", 10.0);
+        zFar = pt.get<double>("zFar", 200.0);
+
+        pose.Orientation.w = pt.get<float>("pose.orientation.w", 1.0);
+        pose.Orientation.x = pt.get<float>("pose.orientation.x", 0.0);
+        pose.Orientation.y = pt.get<float>("pose.orientation.y", 0.0);
+        pose.Orientation.z = pt.get<float>("pose.orientation.z", 0.0);
+        pose.PositionCm.x = pt.get<float>("pose.position.x", 0.0);
+        pose.PositionCm.y = pt.get<float>("pose.position.y", 0.0);
+        pose.PositionCm.z = pt.get<float>("pose.position.z", 0.0);
+
+		// Read the default preset table
+		readColorPropertyPresetTable(pt, &SharedColorPresets);
+
+		// Read all of the controller preset tables
+		const std::string controller_prefix("controller_");
+		const std::string hmd_prefix("hmd_");
+		for(auto iter = pt.begin(); iter != pt.end(); iter++)
+		{
+			const std::string &entry_name= iter->first;
+
+			if (entry_name.compare(0, controller_prefix.length(), controller_prefix) == 0 ||
+				entry_name.compare(0, hmd_prefix.length(), hmd_prefix) == 0)
+			{
+				CommonHSVColorRangeTable table;
+
+				table.table_name= entry_name;
+				for (int preset_index = 0; preset_index < eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES; ++preset_index)
+				{
+					table.color_presets[preset_index] = k_default_color_presets[preset_index];
+				}
+
+				readColorPropertyPresetTable(pt, &table);
+
+				DeviceColorPresets.push_back(table);
+			}
+		}
+    }
+    else
+    {
+        SERVER_LOG_WARNING("VirtualTrackerConfig") <<
+            "Config version " << config_version << " does not match expected version " <<
+            VirtualTrackerConfig::CONFIG_VERSION << ", Using defaults.";
+    }
+}
+
+const CommonHSVColorRangeTable *
+VirtualTrackerConfig::getColorRangeTable(const std::string &table_name) const
+{
+	const CommonHSVColorRangeTable *table= &SharedColorPresets;
+
+	if (table_name.length() > 0)
+	{
+		for (auto &entry : DeviceColorPresets)
+		{
+			if (entry.table_name == table_name)
+			{
+				table= &entry;
+			}
+		}
+	}
+
+	return table;
+}
+
+inline CommonHSVColorRangeTable *
+VirtualTrackerConfig::getOrAddColorRangeTable(const std::string &table_name)
+{
+	CommonHSVColorRangeTable *table= nullptr;
+
+	if (table_name.length() > 0)
+	{
+		for (auto &entry : DeviceColorPresets)
+		{
+			if (entry.table_name == table_name)
+			{
+				table= &entry;
+			}
+		}
+
+		if (table == nullptr)
+		{
+			CommonHSVColorRangeTable Table;
+
+			Table.table_name= table_name;
+			for (int preset_index = 0; preset_index < eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES; ++preset_index)
+			{
+				Table.color_presets[preset_index] = k_default_color_presets[preset_index];
+			}
+
+			DeviceColorPresets.push_back(Table);
+			table= &DeviceColorPresets[DeviceColorPresets.size() - 1];
+		}
+	}
+	else
+	{
+		table= &SharedColorPresets;
+	}
+
+	return table;
+}
+
+// -- Virtual Tracker
+VirtualTracker::VirtualTracker()
+    : cfg()
+    , DevicePath()
+    , VirtualTrackerIndex(-1)
+    , FrameBuffer(nullptr)
+    , FrameCounter(0)
+    , CaptureReplay(nullptr)
+    , bHavePendingChunk(false)
+    , bHaveReplayBase(false)
+    , ReplayBaseTimestampUs(0)
+    , NextPollSequenceNumber(0)
+    , TrackerStates()
+{
+}
+
+VirtualTracker::~VirtualTracker()
+{
+    if (getIsOpen())
+    {
+        SERVER_LOG_ERROR("~VirtualTracker") << "Tracker deleted without calling close() first!";
+    }
+}
+
+// -- IDeviceInterface
+bool VirtualTracker::matchesDeviceEnumerator(const DeviceEnumerator *enumerator) const
+{
+    // Down-cast the enumerator so we can use the correct get_path.
+    const TrackerDeviceEnumerator *pEnum = static_cast<const TrackerDeviceEnumerator *>(enumerator);
+
+    bool matches = false;
+
+    if (pEnum->get_device_type() == CommonDeviceState::VirtualTracker)
+    {
+        std::string enumerator_path = pEnum->get_path();
+
+        matches = (enumerator_path == DevicePath);
+    }
+
+    return matches;
+}
+
+bool VirtualTracker::open(const DeviceEnumerator *enumerator)
+{
+    const TrackerDeviceEnumerator *tracker_enumerator = static_cast<const TrackerDeviceEnumerator *>(enumerator);
+    const char *cur_dev_path = tracker_enumerator->get_path();
+
+    bool bSuccess = false;
+
+    if (getIsOpen())
+    {
+        SERVER_LOG_WARNING("VirtualTracker::open") << "VirtualTracker(" << cur_dev_path << ") already open. Ignoring request.";
+        bSuccess = true;
+    }
+    else
+    {
+        SERVER_LOG_INFO("VirtualTracker::open") << "Opening VirtualTracker(" << cur_dev_path << ")";
+
+        DevicePath = cur_dev_path;
+        VirtualTrackerIndex = tracker_enumerator->get_virtual_tracker_index();
+
+        cfg = VirtualTrackerConfig(
+            ServerUtility::format_string("VirtualTrackerConfig_%d", VirtualTrackerIndex));
+
+		// Load the virtual tracker config
+        cfg.load();
+		// Save the config back out again in case defaults changed
+		cfg.save();
+
+        // When a session capture is configured, replay its camera frames
+        // instead of synthesizing blobs
+        if (cfg.session_capture_file.length() > 0)
+        {
+            CaptureReplay = new SessionCaptureReader();
+
+            bool bReplayUsable = false;
+            if (CaptureReplay->open(cfg.session_capture_file))
+            {
+                // Scan for the first frame of the requested tracker stream
+                // and adopt its recorded geometry (in memory only)
+                SessionCaptureChunkHeader header;
+                std::vector<unsigned char> payload;
+
+                while (CaptureReplay->readNextChunk(header, payload))
+                {
+                    if (header.chunk_type == SessionCapture::ChunkType_CameraFrame &&
+                        header.stream_id == static_cast<unsigned int>(cfg.session_capture_tracker_id) &&
+                        payload.size() >= sizeof(SessionCaptureCameraFrameInfo))
+                    {
+                        SessionCaptureCameraFrameInfo frame_info;
+                        memcpy(&frame_info, payload.data(), sizeof(frame_info));
+
+                        cfg.frame_width = frame_info.width;
+                        cfg.frame_height = frame_info.height;
+                        bReplayUsable = true;
+                        break;
+                    }
+                }
+
+                CaptureReplay->rewind();
+            }
+
+            if (!bReplayUsable)
+            {
+                SERVER_LOG_ERROR("VirtualTracker::open") <<
+                    "No camera frames for tracker stream " << cfg.session_capture_tracker_id <<
+                    " in session capture: " << cfg.session_capture_file << " - synthesizing frames instead";
+
+                delete CaptureReplay;
+                CaptureReplay = nullptr;
+            }
+        }
+
+        FrameBuffer = new unsigned char[cfg.frame_width*cfg.frame_height*3];
+        memset(FrameBuffer, 0, cfg.frame_width*cfg.frame_height*3);
+
+        const std::chrono::time_point<std::chrono::high_resolution_clock> now =
+            std::chrono::high_resolution_clock::now();
+        NextFrameDeadline = now;
+        LastFrameCaptureTimestamp = now;
+        bHavePendingChunk = false;
+        bHaveReplayBase = false;
+
+        bSuccess = true;
+    }
+
+    return bSuccess;
+}
+
+bool VirtualTracker::getIsOpen() const
+{
+    return FrameBuffer != nullptr;
+}
+
+bool VirtualTracker::getIsReadyToPoll() const
+{
+    return getIsOpen();
+}
+
+IDeviceInterface::ePollResult VirtualTracker::poll()
+{
+    IDeviceInterface::ePollResult result = IDeviceInterface::_PollResultFailure;
+
+    if (getIsOpen())
+    {
+        const std::chrono::time_point<std::chrono::high_resolution_clock> now =
+            std::chrono::high_resolution_clock::now();
+
+        // Synthesize a new frame each time the frame period elapses,
+        // otherwise report no new data just like a real camera would
+        if (CaptureReplay != nullptr)
+        {
+            // Recorded frames replay on their own original timeline
+            result = pollReplayFrame(now)
+                ? IControllerInterface::_PollResultSuccessNewData
+                : IControllerInterface::_PollResultSuccessNoData;
+        }
+        else if (now < NextFrameDeadline)
+        {
+            result = IControllerInterface::_PollResultSuccessNoData;
+        }
+        else
+        {
+            const std::chrono::microseconds frame_period(
+                static_cast<long long>(1000000.0 / cfg.frame_rate));
+
+            synthesizeVideoFrame();
+            LastFrameCaptureTimestamp = now;
+
+            // Schedule the next frame. If polling fell behind don't try to
+            // make up the missed frames - a real camera drops them too.
+            NextFrameDeadline += frame_period;
+            if (NextFrameDeadline < now)
+            {
+                NextFrameDeadline = now + frame_period;
+            }
+
+            result = IControllerInterface::_PollResultSuccessNewData;
+        }
+
+        {
+            VirtualTrackerState newState;
+
+            // Increment the sequence for every new polling packet
+            newState.PollSequenceNumber = NextPollSequenceNumber;
+            ++NextPollSequenceNumber;
+
+            // The ring recycles its oldest slot once full - no allocation
+            TrackerStates.push(newState);
+        }
+    }
+
+    return result;
+}
+
+void VirtualTracker::close()
+{
+    if (CaptureReplay != nullptr)
+    {
+        delete CaptureReplay;
+        CaptureReplay = nullptr;
+    }
+
+    if (FrameBuffer != nullptr)
+    {
+        delete[] FrameBuffer;
+        FrameBuffer = nullptr;
+    }
+}
+
+bool VirtualTracker::pollReplayFrame(
+    const std::chrono::time_point<std::chrono::high_resolution_clock> &now)
+{
+    // Make sure the next frame of our stream is buffered. open() verified the
+    // capture contains at least one, so the rewind can't loop forever.
+    while (!bHavePendingChunk)
+    {
+        SessionCaptureChunkHeader header;
+
+        if (CaptureReplay->readNextChunk(header, PendingChunkPayload))
+        {
+            if (header.chunk_type == SessionCapture::ChunkType_CameraFrame &&
+                header.stream_id == static_cast<unsigned int>(cfg.session_capture_tracker_id) &&
+                PendingChunkPayload.size() >= sizeof(SessionCaptureCameraFrameInfo))
+            {
+                PendingChunkHeader = header;
+                bHavePendingChunk = true;
+
+                // The first frame of each playback pass rebases the clock so
+                // the recorded inter-frame timing is preserved across loops
+                if (!bHaveReplayBase)
+                {
+                    ReplayBaseTimestampUs = header.timestamp_us;
+                    ReplayStartTime = now;
+                    bHaveReplayBase = true;
+                }
+            }
+        }
+        else
+        {
+            // End of the capture - loop back to the start
+            CaptureReplay->rewind();
+            bHaveReplayBase = false;
+        }
+    }
+
+    // Publish the frame once its recorded timestamp has been reached
+    const unsigned long long elapsed_us =
+        static_cast<unsigned long long>(
+            std::chrono::duration_cast<std::chrono::microseconds>(now - ReplayStartTime).count());
+
+    if (PendingChunkHeader.timestamp_us - ReplayBaseTimestampUs > elapsed_us)
+    {
+        return false;
+    }
+
+    const size_t frame_buffer_size =
+        static_cast<size_t>(cfg.frame_width) * static_cast<size_t>(cfg.frame_height) * 3;
+    const size_t pixel_bytes =
+        std::min(PendingChunkPayload.size() - sizeof(SessionCaptureCameraFrameInfo), frame_buffer_size);
+
+    memcpy(FrameBuffer, PendingChunkPayload.data() + sizeof(SessionCaptureCameraFrameInfo), pixel_bytes);
+
+    LastFrameCaptureTimestamp = now;
+    bHavePendingChunk = false;
+    ++FrameCounter;
+
+    return true;
+}
+
+long VirtualTracker::getMaxPollFailureCount() const
+{
+    return cfg.max_poll_failure_count;
+}
+
+CommonDeviceState::eDeviceType VirtualTracker::getDeviceType() const
+{
+    return CommonDeviceState::VirtualTracker;
+}
+
+const CommonDeviceState *VirtualTracker::getState(int lookBack) const
+{
+    return TrackerStates.getLookBackState(lookBack);
+}
+
+ITrackerInterface::eDriverType VirtualTracker::getDriverType() const
+{
+    // No real driver behind the synthetic frames
+    return ITrackerInterface::Generic_Webcam;
+}
+
+std::string VirtualTracker::getUSBDevicePath() const
+{
+    return DevicePath;
+}
+
+bool VirtualTracker::getVideoFrameDimensions(
+    int *out_width,
+    int *out_height,
+    int *out_stride) const
+{
+    if (out_width != nullptr)
+    {
+        *out_width = cfg.frame_width;
+    }
+
+    if (out_height != nullptr)
+    {
+        *out_height = cfg.frame_height;
+    }
+
+    if (out_stride != nullptr)
+    {
+        *out_stride = cfg.frame_width * 3;
+    }
+
+    return true;
+}
+
+bool VirtualTracker::getIsVideoFrameBayer() const
+{
+    return false;
+}
+
+std::chrono::time_point<std::chrono::high_resolution_clock> VirtualTracker::getVideoFrameCaptureTimestamp() const
+{
+    return LastFrameCaptureTimestamp;
+}
+
+float VirtualTracker::getMeasuredCaptureRateFps() const
+{
+    // Synthetic frames are generated on demand at the configured rate
+    return static_cast<float>(cfg.frame_rate);
+}
+
+uint64_t VirtualTracker::getDroppedFrameCount() const
+{
+    return 0;
+}
+
+const unsigned char *VirtualTracker::getVideoFrameBuffer() const
+{
+    return FrameBuffer;
+}
+
+void VirtualTracker::loadSettings()
+{
+    cfg.load();
+}
+
+void VirtualTracker::saveSettings()
+{
+    cfg.save();
+}
+
+void VirtualTracker::setExposure(double value, bool bUpdateConfig)
+{
+    // No sensor to poke - just remember the value
+	if (bUpdateConfig)
+	{
+		cfg.exposure = value;
+	}
+}
+
+double VirtualTracker::getExposure() const
+{
+    return cfg.exposure;
+}
+
+void VirtualTracker::setGain(double value, bool bUpdateConfig)
+{
+	if (bUpdateConfig)
+	{
+		cfg.gain = value;
+	}
+}
+
+double VirtualTracker::getGain() const
+{
+	return cfg.gain;
+}
+
+void VirtualTracker::getCameraIntrinsics(
+    float &outFocalLengthX, float &outFocalLengthY,
+    float &outPrincipalX, float &outPrincipalY,
+    float &outDistortionK1, float &outDistortionK2, float &outDistortionK3,
+    float &outDistortionP1, float &outDistortionP2) const
+{
+    outFocalLengthX = static_cast<float>(cfg.focalLengthX);
+    outFocalLengthY = static_cast<float>(cfg.focalLengthY);
+    outPrincipalX = static_cast<float>(cfg.principalX);
+    outPrincipalY = static_cast<float>(cfg.principalY);
+    outDistortionK1 = static_cast<float>(cfg.distortionK1);
+    outDistortionK2 = static_cast<float>(cfg.distortionK2);
+    outDistortionK3 = static_cast<float>(cfg.distortionK3);
+    outDistortionP1 = static_cast<float>(cfg.distortionP1);
+    outDistortionP2 = static_cast<float>(cfg.distortionP2);
+}
+
+void VirtualTracker::setCameraIntrinsics(
+    float focalLengthX, float focalLengthY,
+    float principalX, float principalY,
+    float distortionK1, float distortionK2, float distortionK3,
+    float distortionP1, float distortionP2)
+{
+    cfg.focalLengthX = focalLengthX;
+    cfg.focalLengthY = focalLengthY;
+    cfg.principalX = principalX;
+    cfg.principalY = principalY;
+    cfg.distortionK1 = distortionK1;
+    cfg.distortionK2 = distortionK2;
+    cfg.distortionK3 = distortionK3;
+    cfg.distortionP1 = distortionP1;
+    cfg.distortionP2 = distortionP2;
+}
+
+CommonDevicePose VirtualTracker::getTrackerPose() const
+{
+    return cfg.pose;
+}
+
+void VirtualTracker::setTrackerPose(
+    const struct CommonDevicePose *pose)
+{
+    cfg.pose = *pose;
+    cfg.save();
+}
+
+void VirtualTracker::getFOV(float &outHFOV, float &outVFOV) const
+{
+    outHFOV = static_cast<float>(cfg.hfov);
+    outVFOV = static_cast<float>(cfg.vfov);
+}
+
+void VirtualTracker::getZRange(float &outZNear, float &outZFar) const
+{
+    outZNear = static_cast<float>(cfg.zNear);
+    outZFar = static_cast<float>(cfg.zFar);
+}
+
+void VirtualTracker::gatherTrackerOptions(
+    PSMoveProtocol::Response_ResultTrackerSettings* settings) const
+{
+    // No camera hardware options to expose
+}
+
+bool VirtualTracker::setOptionIndex(
+    const std::string &option_name,
+    int option_index)
+{
+    return false;
+}
+
+bool VirtualTracker::getOptionIndex(
+    const std::string &option_name,
+    int &out_option_index) const
+{
+    return false;
+}
+
+void VirtualTracker::gatherTrackingColorPresets(
+	const std::string &controller_serial,
+    PSMoveProtocol::Response_ResultTrackerSettings* settings) const
+{
+	const CommonHSVColorRangeTable *table= cfg.getColorRangeTable(controller_serial);
+
+    for (int list_index = 0; list_index < MAX_TRACKING_COLOR_TYPES; ++list_index)
+    {
+        const CommonHSVColorRange &hsvRange = table->color_presets[list_index];
+        const eCommonTrackingColorID colorType = static_cast<eCommonTrackingColorID>(list_index);
+
+        PSMoveProtocol::TrackingColorPreset *colorPreset= settings->add_color_presets();
+        colorPreset->set_color_type(static_cast<PSMoveProtocol::TrackingColorType>(colorType));
+        colorPreset->set_hue_center(hsvRange.hue_range.center);
+        colorPreset->set_hue_range(hsvRange.hue_range.range);
+        colorPreset->set_saturation_center(hsvRange.saturation_range.center);
+        colorPreset->set_saturation_range(hsvRange.saturation_range.range);
+        colorPreset->set_value_center(hsvRange.value_range.center);
+        colorPreset->set_value_range(hsvRange.value_range.range);
+    }
+}
+
+void VirtualTracker::setTrackingColorPreset(
+	const std::string &controller_serial,
+    eCommonTrackingColorID color,
+    const CommonHSVColorRange *preset)
+{
+	CommonHSVColorRangeTable *table= cfg.getOrAddColorRangeTable(controller_serial);
+
+    table->color_presets[color] = *preset;
+    cfg.save();
+}
+
+void VirtualTracker::getTrackingColorPreset(
+	const std::string &controller_serial,
+    eCommonTrackingColorID color,
+    CommonHSVColorRange *out_preset) const
+{
+	const CommonHSVColorRangeTable *table= cfg.getColorRangeTable(controller_serial);
+
+    *out_preset = table->color_presets[color];
+}
+
+void VirtualTracker::setExclusionAreas(
+	const CommonScreenRect *areas,
+	int area_count)
+{
+	const int clamped_count = std::min(area_count, static_cast<int>(ITrackerInterface::MAX_EXCLUSION_AREAS));
+
+	cfg.ExclusionAreas.assign(areas, areas + clamped_count);
+	cfg.save();
+}
+
+int VirtualTracker::getExclusionAreas(
+	CommonScreenRect *out_areas,
+	int max_area_count) const
+{
+	const int area_count = std::min(static_cast<int>(cfg.ExclusionAreas.size()), max_area_count);
+
+	for (int area_index = 0; area_index < area_count; ++area_index)
+	{
+		out_areas[area_index] = cfg.ExclusionAreas[area_index];
+	}
+
+	return area_count;
+}
+
+// -- private methods -----
+void VirtualTracker::synthesizeVideoFrame()
+{
+    const int width = cfg.frame_width;
+    const int height = cfg.frame_height;
+    const int stride = width * 3;
+
+    // Dim gray background so the blobs are the only saturated pixels
+    memset(FrameBuffer, 24, stride*height);
+
+    // Each blob orbits the image center at its own radius and phase.
+    // One full revolution every ~5 seconds at the configured frame rate.
+    const float orbit_step = k_real_two_pi / (5.f * static_cast<float>(cfg.frame_rate));
+    const float orbit_angle = static_cast<float>(FrameCounter) * orbit_step;
+    const float blob_radius = static_cast<float>(cfg.blob_radius);
+
+    for (int blob_index = 0; blob_index < cfg.blob_count; ++blob_index)
+    {
+        const float phase = orbit_angle + static_cast<float>(blob_index) * (k_real_two_pi / static_cast<float>(cfg.blob_count));
+        const float orbit_radius = static_cast<float>(std::min(width, height)) * 0.25f + static_cast<float>(blob_index) * blob_radius;
+        const float center_x = static_cast<float>(width) * 0.5f + orbit_radius * cosf(phase);
+        const float center_y = static_cast<float>(height) * 0.5f + orbit_radius * sinf(phase);
+        const unsigned char *blob_color = k_blob_colors[blob_index % eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES];
+
+        const int min_y = std::max(static_cast<int>(center_y - blob_radius), 0);
+        const int max_y = std::min(static_cast<int>(center_y + blob_radius), height - 1);
+
+        // Fill the blob one scanline span at a time
+        for (int y = min_y; y <= max_y; ++y)
+        {
+            const float dy = static_cast<float>(y) - center_y;
+            const float half_span = sqrtf(std::max(blob_radius*blob_radius - dy*dy, 0.f));
+
+            const int min_x = std::max(static_cast<int>(center_x - half_span), 0);
+            const int max_x = std::min(static_cast<int>(center_x + half_span), width - 1);
+            unsigned char *row = FrameBuffer + y*stride + min_x*3;
+
+            for (int x = min_x; x <= max_x; ++x)
+            {
+                row[0] = blob_color[0];
+                row[1] = blob_color[1];
+                row[2] = blob_color[2];
+                row += 3;
+            }
+        }
+    }
+
+    ++FrameCounter;
+}
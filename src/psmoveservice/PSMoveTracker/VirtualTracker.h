@@ -0,0 +1,182 @@
+#ifndef VIRTUAL_TRACKER_H
+#define VIRTUAL_TRACKER_H
+
+// -- includes -----
+#include "PSMoveConfig.h"
+#include "DeviceEnumerator.h"
+#include "DeviceInterface.h"
+#include "DeviceStateRingBuffer.h"
+#include "SessionCapture.h"
+#include <string>
+#include <vector>
+#include <chrono>
+
+#define VIRTUAL_TRACKER_STATE_BUFFER_MAX 16
+
+// -- pre-declarations -----
+namespace PSMoveProtocol
+{
+    class Response_ResultTrackerSettings;
+};
+
+// -- definitions -----
+class VirtualTrackerConfig : public PSMoveConfig
+{
+public:
+    VirtualTrackerConfig(const std::string &fnamebase = "VirtualTrackerConfig");
+
+    virtual const boost::property_tree::ptree config2ptree();
+    virtual void ptree2config(const boost::property_tree::ptree &pt);
+
+	const CommonHSVColorRangeTable *getColorRangeTable(const std::string &table_name) const;
+	inline CommonHSVColorRangeTable *getOrAddColorRangeTable(const std::string &table_name);
+
+    long max_poll_failure_count;
+    int frame_width;
+    int frame_height;
+    double frame_rate;
+    int blob_count;
+    double blob_radius;
+    // Session capture to replay camera frames from instead of synthesizing
+    // blobs (empty = synthetic); see SessionCapture.h
+    std::string session_capture_file;
+    int session_capture_tracker_id;
+    double exposure;
+	double gain;
+    double focalLengthX;
+    double focalLengthY;
+    double principalX;
+    double principalY;
+    double hfov;
+    double vfov;
+    double zNear;
+    double zFar;
+    double distortionK1;
+    double distortionK2;
+    double distortionK3;
+    double distortionP1;
+    double distortionP2;
+
+    CommonDevicePose pose;
+	CommonHSVColorRangeTable SharedColorPresets;
+	std::vector<CommonHSVColorRangeTable> DeviceColorPresets;
+	std::vector<CommonScreenRect> ExclusionAreas;
+
+    static const int CONFIG_VERSION;
+};
+
+struct VirtualTrackerState : public CommonDeviceState
+{
+    VirtualTrackerState()
+    {
+        clear();
+    }
+
+    void clear()
+    {
+        CommonDeviceState::clear();
+        DeviceType = CommonDeviceState::VirtualTracker;
+    }
+};
+
+/// A synthetic tracking camera used for load testing. Generates frames with
+/// colored blobs orbiting the image center at a configurable resolution and
+/// rate, so multi-camera scaling of TrackerManager, the vision pipeline and
+/// the shared memory video streams can be exercised without physical hardware.
+/// Enumerated when TrackerManagerConfig::virtual_tracker_count is non-zero.
+///
+/// When the config names a session capture file, the tracker replays that
+/// capture's camera frames at their original timing (looping) instead of
+/// synthesizing blobs, so field-recorded sessions can be re-run on the bench.
+class VirtualTracker : public ITrackerInterface {
+public:
+    VirtualTracker();
+    virtual ~VirtualTracker();
+
+    // -- IDeviceInterface
+    bool matchesDeviceEnumerator(const DeviceEnumerator *enumerator) const override;
+    bool open(const DeviceEnumerator *enumerator) override;
+    bool getIsOpen() const override;
+    bool getIsReadyToPoll() const override;
+    IDeviceInterface::ePollResult poll() override;
+    void close() override;
+    long getMaxPollFailureCount() const override;
+    static CommonDeviceState::eDeviceType getDeviceTypeStatic()
+    { return CommonDeviceState::VirtualTracker; }
+    CommonDeviceState::eDeviceType getDeviceType() const override;
+    const CommonDeviceState *getState(int lookBack = 0) const override;
+
+    // -- ITrackerInterface
+    ITrackerInterface::eDriverType getDriverType() const override;
+    std::string getUSBDevicePath() const override;
+    bool getVideoFrameDimensions(int *out_width, int *out_height, int *out_stride) const override;
+    const unsigned char *getVideoFrameBuffer() const override;
+    bool getIsVideoFrameBayer() const override;
+    std::chrono::time_point<std::chrono::high_resolution_clock> getVideoFrameCaptureTimestamp() const override;
+    float getMeasuredCaptureRateFps() const override;
+    uint64_t getDroppedFrameCount() const override;
+    void loadSettings() override;
+    void saveSettings() override;
+    void setExposure(double value, bool bUpdateConfig) override;
+    double getExposure() const override;
+	void setGain(double value, bool bUpdateConfig) override;
+	double getGain() const override;
+    void getCameraIntrinsics(
+        float &outFocalLengthX, float &outFocalLengthY,
+        float &outPrincipalX, float &outPrincipalY,
+        float &outDistortionK1, float &outDistortionK2, float &outDistortionK3,
+        float &outDistortionP1, float &outDistortionP2) const override;
+    void setCameraIntrinsics(
+        float focalLengthX, float focalLengthY,
+        float principalX, float principalY,
+        float distortionK1, float distortionK2, float distortionK3,
+        float distortionP1, float distortionP2) override;
+    CommonDevicePose getTrackerPose() const override;
+    void setTrackerPose(const struct CommonDevicePose *pose) override;
+    void getFOV(float &outHFOV, float &outVFOV) const override;
+    void getZRange(float &outZNear, float &outZFar) const override;
+    void gatherTrackerOptions(PSMoveProtocol::Response_ResultTrackerSettings* settings) const override;
+    bool setOptionIndex(const std::string &option_name, int option_index) override;
+    bool getOptionIndex(const std::string &option_name, int &out_option_index) const override;
+    void gatherTrackingColorPresets(const std::string &controller_serial, PSMoveProtocol::Response_ResultTrackerSettings* settings) const override;
+    void setTrackingColorPreset(const std::string &controller_serial, eCommonTrackingColorID color, const CommonHSVColorRange *preset) override;
+    void getTrackingColorPreset(const std::string &controller_serial, eCommonTrackingColorID color, CommonHSVColorRange *out_preset) const override;
+    void setExclusionAreas(const CommonScreenRect *areas, int area_count) override;
+    int getExclusionAreas(CommonScreenRect *out_areas, int max_area_count) const override;
+
+    // -- Getters
+    inline const VirtualTrackerConfig &getConfig() const
+    { return cfg; }
+
+private:
+    // Repaint the frame buffer with the blobs at their current positions
+    void synthesizeVideoFrame();
+
+    // Copy the next due recorded frame into the frame buffer;
+    // returns true when a new frame was published
+    bool pollReplayFrame(const std::chrono::time_point<std::chrono::high_resolution_clock> &now);
+
+    VirtualTrackerConfig cfg;
+    std::string DevicePath;
+    int VirtualTrackerIndex;
+    unsigned char *FrameBuffer;
+
+    // Monotonic count of frames synthesized, drives the blob animation
+    int FrameCounter;
+    std::chrono::time_point<std::chrono::high_resolution_clock> NextFrameDeadline;
+
+    // Session capture replay state (null when synthesizing)
+    SessionCaptureReader *CaptureReplay;
+    SessionCaptureChunkHeader PendingChunkHeader;
+    std::vector<unsigned char> PendingChunkPayload;
+    bool bHavePendingChunk;
+    bool bHaveReplayBase;
+    unsigned long long ReplayBaseTimestampUs;
+    std::chrono::time_point<std::chrono::high_resolution_clock> ReplayStartTime;
+
+    // Read Tracker State
+    int NextPollSequenceNumber;
+    DeviceStateRingBuffer<VirtualTrackerState, VIRTUAL_TRACKER_STATE_BUFFER_MAX> TrackerStates;
+    std::chrono::time_point<std::chrono::high_resolution_clock> LastFrameCaptureTimestamp;
+};
+#endif // VIRTUAL_TRACKER_H
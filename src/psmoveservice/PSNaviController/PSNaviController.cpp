@@ -19,7 +19,6 @@
 #define PSNAVI_BTADDR_GET_SIZE 16
 #define PSNAVI_BTADDR_SIZE 6
 #define PSNAVI_BTADDR_SET_SIZE 10
-#define PSNAVI_STATE_BUFFER_MAX 16
 
 //###bwalker $TODO This haven't been tested yet
 // https://code.google.com/p/moveonpc/wiki/HIDReports
@@ -245,6 +244,13 @@ PSNaviController::setTrackingColorID(const eCommonTrackingColorID tracking_color
 	return false;
 }
 
+bool
+PSNaviController::setFilterWarmStartState(const std::vector<double> &values)
+{
+	// The navi has no pose filter state to persist
+	return false;
+}
+
 bool 
 PSNaviController::setHostBluetoothAddress(const std::string &new_host_bt_addr)
 {
@@ -495,13 +501,18 @@ PSNaviController::poll()
             newState.PollSequenceNumber= NextPollSequenceNumber;
             ++NextPollSequenceNumber;
 
+            // Record when the report was drained to keep parity with the other
+            // controllers (the navi has no pose filter consuming the timestamps)
+            newState.PollTimestamp= std::chrono::high_resolution_clock::now();
+            newState.bPollTimestampValid= true;
+
             // Buttons
             newState.AllButtons = 
                 (InData->buttons2) |               // |-|L2|L1|-|-|Circle|-|Cross
                 (InData->buttons1 << 8) |          // |Left|Down|Right|Up|-|-|L3|-
                 ((InData->buttons3 & 0x01) << 16); // |-|-|-|-|-|-|-|PS
         
-            unsigned int lastButtons = ControllerStates.empty() ? 0 : ControllerStates.back().AllButtons;
+            unsigned int lastButtons = ControllerStates.empty() ? 0 : ControllerStates.back()->AllButtons;
 
             newState.Circle = getButtonState(newState.AllButtons, lastButtons, Btn_CIRCLE);
             newState.Cross = getButtonState(newState.AllButtons, lastButtons, Btn_CROSS);
@@ -513,14 +524,8 @@ PSNaviController::poll()
             // Other
             newState.Battery = static_cast<CommonControllerState::BatteryLevel>(InData->battery);
 
-            // Make room for new entry if at the max queue size
-            if (ControllerStates.size() >= PSNAVI_STATE_BUFFER_MAX)
-            {
-                ControllerStates.erase(ControllerStates.begin(),
-                                        ControllerStates.begin()+ControllerStates.size()-PSNAVI_STATE_BUFFER_MAX);
-            }
-
-            ControllerStates.push_back(newState);
+            // The ring recycles its oldest slot once full - no allocation
+            ControllerStates.push(newState);
         }
     }
 
@@ -531,14 +536,10 @@ const CommonDeviceState *
 PSNaviController::getState(
     int lookBack) const
 {
-    const int queueSize= static_cast<int>(ControllerStates.size());
-    const CommonDeviceState * result=
-        (lookBack < queueSize) ? &ControllerStates.at(queueSize - lookBack - 1) : nullptr;
-
-    return result;
+    return ControllerStates.getLookBackState(lookBack);
 }
 
-long 
+long
 PSNaviController::getMaxPollFailureCount() const
 {
     return cfg.max_poll_failure_count;
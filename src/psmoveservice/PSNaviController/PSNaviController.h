@@ -4,10 +4,12 @@
 #include "PSMoveConfig.h"
 #include "DeviceEnumerator.h"
 #include "DeviceInterface.h"
+#include "DeviceStateRingBuffer.h"
 #include "hidapi.h"
 #include <string>
 #include <vector>
-#include <deque>
+
+#define PSNAVI_STATE_BUFFER_MAX 16
 
 struct PSNaviHIDDetails {
     std::string Device_path;
@@ -100,6 +102,7 @@ public:
     virtual void close() override;
     virtual bool setHostBluetoothAddress(const std::string &address) override;
 	virtual bool setTrackingColorID(const eCommonTrackingColorID tracking_color_id) override;
+	virtual bool setFilterWarmStartState(const std::vector<double> &values) override;
 
     // -- Getters
     virtual bool getIsBluetooth() const override;
@@ -129,7 +132,7 @@ private:
 
     // Read Controller State
     int NextPollSequenceNumber;
-    std::deque<PSNaviControllerState> ControllerStates;
+    DeviceStateRingBuffer<PSNaviControllerState, PSNAVI_STATE_BUFFER_MAX> ControllerStates;
     PSNaviDataInput* InData;                        // Buffer to copy hidapi reports into
 };
 #endif // PSMOVE_CONTROLLER_H
\ No newline at end of file
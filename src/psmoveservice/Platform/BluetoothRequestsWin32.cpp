@@ -84,6 +84,11 @@ POSSIBILITY OF SUCH DAMAGE.
  */
 #define CONN_CHECK_DELAY 300
 
+/* the delay (in milliseconds) between worker thread checks for a pending
+ * main-thread action to be serviced by the service loop
+ */
+#define MAIN_THREAD_ACTION_POLL_DELAY 50
+
 
 // -- definitions -----
 class BluetoothAsyncOperationState
@@ -234,6 +239,8 @@ public:
     enum eStatus
     {
         start,
+        findBluetoothRadio,
+        registerHostAddress,
         setupBluetoothRadio,
         deviceScan,
         attemptConnection,
@@ -245,11 +252,22 @@ public:
         failed,
     };
 
+    // Result of a main-thread action the worker thread is parked on
+    // (registering the host address has to touch the controller view,
+    // which is only safe from the service thread)
+    enum eMainThreadActionResult
+    {
+        mainThreadActionPending,
+        mainThreadActionSucceeded,
+        mainThreadActionFailed,
+    };
+
     HANDLE hRadio;
     BLUETOOTH_RADIO_INFO radioInfo;
     BLUETOOTH_DEVICE_INFO deviceInfo;
     std::string controller_serial_string;
     std::string host_address_string;
+    std::string assigned_host_address_string;
     CommonDeviceState::eDeviceType controller_device_type;
 
     // Attempt Counters
@@ -257,6 +275,8 @@ public:
     int connectionAttemptCount;
     int verifyConnectionCount;
 
+    volatile LONG mainThreadActionResult;
+
     virtual void initialize(const int id) override
     {
         BluetoothAsyncOperationState::initialize(id);
@@ -268,10 +288,30 @@ public:
         deviceInfo.dwSize= sizeof(BLUETOOTH_DEVICE_INFO);
         controller_serial_string.clear();
         host_address_string.clear();
+        assigned_host_address_string.clear();
         controller_device_type= CommonDeviceState::SUPPORTED_CONTROLLER_TYPE_COUNT;
         scanCount= 0;
         connectionAttemptCount= 0;
         verifyConnectionCount= 0;
+        mainThreadActionResult= mainThreadActionPending;
+    }
+
+    void setMainThreadActionResult_MainThread(eMainThreadActionResult result)
+    {
+        assert(isMainThread());
+
+        // Atomically publish the action result to the worker thread
+        InterlockedCompareExchange(&mainThreadActionResult, static_cast<LONG>(result), mainThreadActionResult);
+    }
+
+    eMainThreadActionResult getMainThreadActionResult_WorkerThread()
+    {
+        assert(isWorkerThread());
+
+        // Atomically fetch the action result posted by the main thread
+        LONG result= InterlockedCompareExchange(&mainThreadActionResult, mainThreadActionResult, mainThreadActionResult);
+
+        return static_cast<eMainThreadActionResult>(result);
     }
 
     void dispose()
@@ -590,65 +630,42 @@ AsyncBluetoothPairDeviceRequest::start()
     state->controller_serial_string= m_controllerView->getSerial();
     state->controller_device_type= m_controllerView->getControllerDeviceType();
 
+    // Snapshot the host address currently assigned on the controller so the
+    // worker thread can do the already-paired check without touching the view
+    state->assigned_host_address_string= m_controllerView->getAssignedHostBluetoothAddress();
+
     // Make sure the controller we're working with is a USB connection
     if (success && m_controllerView->getIsOpen() && m_controllerView->getIsBluetooth())
     {
-        SERVER_LOG_ERROR("AsyncBluetoothPairDeviceRequest") 
-            << "Controller " << controller_id 
+        SERVER_LOG_ERROR("AsyncBluetoothPairDeviceRequest")
+            << "Controller " << controller_id
             << " isn't an open USB device";
         success= false;
     }
 
-    // Find the bluetooth address of the host adapter
+    // Kick off the worker thread to do the rest of the work.
+    // Radio discovery happens on the worker thread too - opening a handle to
+    // the radio can stall on the BT stack for hundreds of milliseconds and
+    // used to visibly hitch tracking when run from the service loop here.
     if (success)
     {
-        success= AsyncBluetoothPairDeviceRequest__findBluetoothRadio(state);
-    }
-
-    // Make sure the controller isn't already paired with this host adapter
-    if (m_controllerView->getAssignedHostBluetoothAddress() != state->host_address_string)
-    {
-        // Assign this host address on the controller.
-        // NOTE: This needs to be done on the main thread since the controller view isn't thread safe.
-        if (success)
-        {
-            success= AsyncBluetoothPairDeviceRequest__registerHostAddress(m_controllerView, state);
-        }
-
-        // Kick off the worker thread to do the rest of the work
-        if (success)
-        {
-            state->worker_thread_handle=
-                CreateThread( 
-                    NULL,                        // default security attributes
-                    0,                           // use default stack size  
-                    AsyncBluetoothPairDeviceThreadFunction,       // thread function pointer
-                    m_internal_state,            // argument to thread function 
-                    0,                           // use default creation flags 
-                    NULL);                       // returns the thread identifier
-
-            if (state->worker_thread_handle == NULL)
-            {
-                SERVER_LOG_ERROR("AsyncBluetoothPairDeviceRequest") << "Failed to start worker thread!";
-                success= false;
-            }
-        }
+        state->worker_thread_handle=
+            CreateThread(
+                NULL,                        // default security attributes
+                0,                           // use default stack size
+                AsyncBluetoothPairDeviceThreadFunction,       // thread function pointer
+                m_internal_state,            // argument to thread function
+                0,                           // use default creation flags
+                NULL);                       // returns the thread identifier
 
-        if (success)
+        if (state->worker_thread_handle == NULL)
         {
-            m_status = AsyncBluetoothRequest::running;
+            SERVER_LOG_ERROR("AsyncBluetoothPairDeviceRequest") << "Failed to start worker thread!";
+            success= false;
         }
     }
-    else
-    {
-        SERVER_LOG_INFO("AsyncBluetoothPairDeviceRequest") << "Controller already paired";
-        m_status= AsyncBluetoothRequest::succeeded;
-    }
 
-    if (!success)
-    {
-        m_status = AsyncBluetoothRequest::failed;
-    }
+    m_status = success ? AsyncBluetoothRequest::running : AsyncBluetoothRequest::failed;
 
     return success;
 }
@@ -660,19 +677,63 @@ AsyncBluetoothPairDeviceThreadFunction(LPVOID lpParam)
 
     state->worker_thread_id = GetCurrentThreadId();
 
-    bool isCompleted= false; 
+    bool isCompleted= false;
     const int controller_id= state->getControllerID();
 
-    state->setSubStatus_WorkerThread(BluetoothPairDeviceState::setupBluetoothRadio);
+    state->setSubStatus_WorkerThread(BluetoothPairDeviceState::findBluetoothRadio);
 
     while (!isCompleted)
     {
-        const BluetoothPairDeviceState::eStatus subStatus= 
+        const BluetoothPairDeviceState::eStatus subStatus=
             state->getSubStatus_WorkerThread<BluetoothPairDeviceState::eStatus>();
         BluetoothPairDeviceState::eStatus nextSubStatus= subStatus;
 
         switch(subStatus)
         {
+        case BluetoothPairDeviceState::findBluetoothRadio:
+            {
+                if (AsyncBluetoothPairDeviceRequest__findBluetoothRadio(state))
+                {
+                    if (state->assigned_host_address_string != state->host_address_string)
+                    {
+                        // Park here until the main thread has registered the
+                        // host address with the controller (a USB write only
+                        // safe from the service thread)
+                        nextSubStatus= BluetoothPairDeviceState::registerHostAddress;
+                    }
+                    else
+                    {
+                        SERVER_MT_LOG_INFO("AsyncBluetoothPairDeviceRequest") << "Controller already paired";
+                        nextSubStatus= BluetoothPairDeviceState::success;
+                    }
+                }
+                else
+                {
+                    nextSubStatus= BluetoothPairDeviceState::failed;
+                }
+            } break;
+
+        case BluetoothPairDeviceState::registerHostAddress:
+            {
+                const BluetoothPairDeviceState::eMainThreadActionResult actionResult=
+                    state->getMainThreadActionResult_WorkerThread();
+
+                if (actionResult == BluetoothPairDeviceState::mainThreadActionSucceeded)
+                {
+                    nextSubStatus= BluetoothPairDeviceState::setupBluetoothRadio;
+                }
+                else if (actionResult == BluetoothPairDeviceState::mainThreadActionFailed ||
+                        state->getIsCanceled_WorkerThread())
+                {
+                    nextSubStatus= BluetoothPairDeviceState::failed;
+                }
+                else
+                {
+                    // The service loop hasn't serviced the request yet
+                    Sleep(MAIN_THREAD_ACTION_POLL_DELAY);
+                }
+            } break;
+
         case BluetoothPairDeviceState::setupBluetoothRadio:
             {
                 nextSubStatus= AsyncBluetoothPairDeviceRequest__setupBluetoothRadio(state);
@@ -725,11 +786,24 @@ AsyncBluetoothPairDeviceRequest::update()
     {
         // Tell the client about the sub status change
         send_progress_notification_to_client(
-            m_connectionId, 
-            m_controllerView->getDeviceID(), 
-            static_cast<int>(subStatus), 
+            m_connectionId,
+            m_controllerView->getDeviceID(),
+            static_cast<int>(subStatus),
             BluetoothPairDeviceState::k_total_steps);
 
+        // The worker thread parks on this stage until we've written the host
+        // address to the controller - the view is only safe to touch here
+        if (subStatus == BluetoothPairDeviceState::registerHostAddress)
+        {
+            const bool bRegistered=
+                AsyncBluetoothPairDeviceRequest__registerHostAddress(m_controllerView, state);
+
+            state->setMainThreadActionResult_MainThread(
+                bRegistered
+                ? BluetoothPairDeviceState::mainThreadActionSucceeded
+                : BluetoothPairDeviceState::mainThreadActionFailed);
+        }
+
         // See if the worker thread has completed it's work
         if (subStatus == BluetoothPairDeviceState::success ||
             subStatus == BluetoothPairDeviceState::failed)
@@ -787,16 +861,16 @@ AsyncBluetoothPairDeviceRequest::getDescription()
 static bool
 AsyncBluetoothPairDeviceRequest__findBluetoothRadio(BluetoothPairDeviceState *state)
 {
-    assert(state->isMainThread());
+    assert(state->isWorkerThread());
     bool bSuccess= true;
 
-    if (find_first_bluetooth_radio(&state->hRadio) && state->hRadio != INVALID_HANDLE_VALUE) 
+    if (find_first_bluetooth_radio(&state->hRadio) && state->hRadio != INVALID_HANDLE_VALUE)
     {
-        SERVER_LOG_INFO("AsyncBluetoothPairDeviceRequest") << "Found a bluetooth radio";
+        SERVER_MT_LOG_INFO("AsyncBluetoothPairDeviceRequest") << "Found a bluetooth radio";
     }
     else
     {
-        SERVER_LOG_ERROR("AsyncBluetoothPairDeviceRequest") << "Failed to find a bluetooth radio";
+        SERVER_MT_LOG_ERROR("AsyncBluetoothPairDeviceRequest") << "Failed to find a bluetooth radio";
         bSuccess= false;
     }
 
@@ -805,12 +879,12 @@ AsyncBluetoothPairDeviceRequest__findBluetoothRadio(BluetoothPairDeviceState *st
         DWORD result= BluetoothGetRadioInfo(state->hRadio, &state->radioInfo);
         if (result == ERROR_SUCCESS)
         {
-            SERVER_LOG_INFO("AsyncBluetoothPairDeviceRequest") << "Retrieved radio info";
+            SERVER_MT_LOG_INFO("AsyncBluetoothPairDeviceRequest") << "Retrieved radio info";
             state->host_address_string= bluetooth_address_to_string(&state->radioInfo.address);
         }
         else
         {
-            SERVER_LOG_ERROR("AsyncBluetoothPairDeviceRequest") 
+            SERVER_MT_LOG_ERROR("AsyncBluetoothPairDeviceRequest")
                 << "Failed to retrieve radio info (Error Code: "
                 << std::hex << std::setfill('0') << std::setw(8) << result;
             bSuccess= false;
@@ -0,0 +1,30 @@
+#ifndef DEVICE_HOTPLUG_LISTENER_H
+#define DEVICE_HOTPLUG_LISTENER_H
+
+//-- definitions -----
+/// Platform wrapper around OS device arrival/removal notifications
+/// (WM_DEVICECHANGE on Windows). The device managers use the change flag to
+/// trigger an enumerator rescan only when something actually changed, instead
+/// of paying for a full HID tree enumeration every reconnect interval.
+class DeviceHotplugListener
+{
+public:
+    virtual ~DeviceHotplugListener() {}
+
+    /// Start listening for notifications.
+    /// Returns false if the platform has no hotplug support, in which case the
+    /// caller should fall back to periodic rescans.
+    virtual bool startup() = 0;
+
+    /// Stop listening for notifications. Safe to call when not started.
+    virtual void shutdown() = 0;
+
+    /// True if any device was added or removed since the last call.
+    /// Reading the flag clears it.
+    virtual bool fetchAndClearDeviceChangeFlag() = 0;
+};
+
+/// Allocate the hotplug listener implementation for this platform
+DeviceHotplugListener *allocate_device_hotplug_listener();
+
+#endif // DEVICE_HOTPLUG_LISTENER_H
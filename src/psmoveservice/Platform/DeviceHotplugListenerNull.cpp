@@ -0,0 +1,29 @@
+//-- includes -----
+#include "DeviceHotplugListener.h"
+
+//-- definitions -----
+/// Placeholder for platforms without a hotplug notification implementation.
+/// startup() fails so the device managers keep their periodic rescans.
+class DeviceHotplugListenerNull : public DeviceHotplugListener
+{
+public:
+    bool startup() override
+    {
+        return false;
+    }
+
+    void shutdown() override
+    {
+    }
+
+    bool fetchAndClearDeviceChangeFlag() override
+    {
+        return false;
+    }
+};
+
+//-- public interface -----
+DeviceHotplugListener *allocate_device_hotplug_listener()
+{
+    return new DeviceHotplugListenerNull();
+}
@@ -0,0 +1,171 @@
+//-- includes -----
+#include "DeviceHotplugListener.h"
+#include "ServerLog.h"
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <dbt.h>
+
+#include <atomic>
+#include <thread>
+
+//-- constants -----
+static const char *k_notification_window_class_name = "PSMoveServiceDeviceNotificationWindow";
+
+// GUID_DEVINTERFACE_HID - interface class for the controllers
+static const GUID k_hid_device_interface_guid =
+    { 0x4D1E55B2, 0xF16F, 0x11CF, { 0x88, 0xCB, 0x00, 0x11, 0x11, 0x00, 0x00, 0x30 } };
+
+// GUID_DEVINTERFACE_USB_DEVICE - interface class for the trackers
+static const GUID k_usb_device_interface_guid =
+    { 0xA5DCBF10, 0x6530, 0x11D2, { 0x90, 0x1F, 0x00, 0xC0, 0x4F, 0xB9, 0x51, 0xED } };
+
+//-- definitions -----
+/// Runs a message-only window on its own thread and flips an atomic flag
+/// whenever a WM_DEVICECHANGE arrival/removal broadcast comes in
+class DeviceHotplugListenerWin32 : public DeviceHotplugListener
+{
+public:
+    DeviceHotplugListenerWin32()
+        : m_message_window_handle(nullptr)
+        , m_bDeviceChangePending(false)
+        , m_bShutdownRequested(false)
+        , m_bMessageThreadStarted(false)
+    {
+    }
+
+    virtual ~DeviceHotplugListenerWin32()
+    {
+        shutdown();
+    }
+
+    bool startup() override
+    {
+        if (!m_bMessageThreadStarted)
+        {
+            m_message_thread = std::thread(&DeviceHotplugListenerWin32::messageThreadFunc, this);
+            m_bMessageThreadStarted = true;
+
+            SERVER_LOG_INFO("DeviceHotplugListenerWin32::startup") <<
+                "Listening for WM_DEVICECHANGE notifications";
+        }
+
+        return m_bMessageThreadStarted;
+    }
+
+    void shutdown() override
+    {
+        if (m_bMessageThreadStarted)
+        {
+            m_bShutdownRequested = true;
+
+            // Wake the message loop so it notices the shutdown request
+            if (m_message_window_handle != nullptr)
+            {
+                PostMessage(static_cast<HWND>(m_message_window_handle), WM_QUIT, 0, 0);
+            }
+
+            m_message_thread.join();
+            m_bMessageThreadStarted = false;
+        }
+    }
+
+    bool fetchAndClearDeviceChangeFlag() override
+    {
+        return m_bDeviceChangePending.exchange(false, std::memory_order_acq_rel);
+    }
+
+protected:
+    static LRESULT CALLBACK windowProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
+    {
+        if (msg == WM_DEVICECHANGE &&
+            (wParam == DBT_DEVICEARRIVAL || wParam == DBT_DEVICEREMOVECOMPLETE))
+        {
+            DeviceHotplugListenerWin32 *listener =
+                reinterpret_cast<DeviceHotplugListenerWin32 *>(GetWindowLongPtr(hwnd, GWLP_USERDATA));
+
+            if (listener != nullptr)
+            {
+                listener->m_bDeviceChangePending.store(true, std::memory_order_release);
+            }
+
+            return TRUE;
+        }
+
+        return DefWindowProc(hwnd, msg, wParam, lParam);
+    }
+
+    void messageThreadFunc()
+    {
+        WNDCLASSEXA window_class;
+        memset(&window_class, 0, sizeof(window_class));
+        window_class.cbSize = sizeof(window_class);
+        window_class.lpfnWndProc = windowProc;
+        window_class.lpszClassName = k_notification_window_class_name;
+        RegisterClassExA(&window_class);
+
+        // Message-only window - never visible, just a notification sink
+        HWND hwnd = CreateWindowExA(
+            0, k_notification_window_class_name, nullptr, 0,
+            0, 0, 0, 0, HWND_MESSAGE, nullptr, nullptr, nullptr);
+
+        if (hwnd == nullptr)
+        {
+            SERVER_LOG_ERROR("DeviceHotplugListenerWin32::messageThreadFunc") <<
+                "Failed to create the notification window";
+            return;
+        }
+
+        SetWindowLongPtr(hwnd, GWLP_USERDATA, reinterpret_cast<LONG_PTR>(this));
+        m_message_window_handle = hwnd;
+
+        // Register for arrival/removal of HID (controllers) and
+        // USB (trackers) interface class devices
+        HDEVNOTIFY device_notify_handles[2];
+        const GUID interface_guids[2] = { k_hid_device_interface_guid, k_usb_device_interface_guid };
+        for (int guid_index = 0; guid_index < 2; ++guid_index)
+        {
+            DEV_BROADCAST_DEVICEINTERFACE notification_filter;
+            memset(&notification_filter, 0, sizeof(notification_filter));
+            notification_filter.dbcc_size = sizeof(notification_filter);
+            notification_filter.dbcc_devicetype = DBT_DEVTYP_DEVICEINTERFACE;
+            notification_filter.dbcc_classguid = interface_guids[guid_index];
+
+            device_notify_handles[guid_index] =
+                RegisterDeviceNotification(hwnd, &notification_filter, DEVICE_NOTIFY_WINDOW_HANDLE);
+        }
+
+        MSG message;
+        while (!m_bShutdownRequested && GetMessage(&message, nullptr, 0, 0) > 0)
+        {
+            TranslateMessage(&message);
+            DispatchMessage(&message);
+        }
+
+        for (int guid_index = 0; guid_index < 2; ++guid_index)
+        {
+            if (device_notify_handles[guid_index] != nullptr)
+            {
+                UnregisterDeviceNotification(device_notify_handles[guid_index]);
+            }
+        }
+
+        m_message_window_handle = nullptr;
+        DestroyWindow(hwnd);
+        UnregisterClassA(k_notification_window_class_name, nullptr);
+    }
+
+private:
+    void *m_message_window_handle;
+    std::atomic_bool m_bDeviceChangePending;
+    std::atomic_bool m_bShutdownRequested;
+
+    std::thread m_message_thread;
+    bool m_bMessageThreadStarted;
+};
+
+//-- public interface -----
+DeviceHotplugListener *allocate_device_hotplug_listener()
+{
+    return new DeviceHotplugListenerWin32();
+}
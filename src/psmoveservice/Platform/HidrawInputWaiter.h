@@ -0,0 +1,42 @@
+#ifndef HIDRAW_INPUT_WAITER_H
+#define HIDRAW_INPUT_WAITER_H
+
+//-- definitions -----
+/// Event-driven wakeup source for a controller polling thread.
+///
+/// On Linux the path hidapi reports for a controller is the /dev/hidrawN node
+/// itself, so a second non-blocking handle on the same node can sit in epoll
+/// and wake the polling thread the moment an input report lands - instead of
+/// the thread sleeping on a learned report cadence and draining speculatively.
+/// The kernel gives each open handle its own copy of every input report, so
+/// waiting on this handle never steals data from the hidapi handle the
+/// controller reads through; the copies are simply discarded after each wait.
+///
+/// On platforms without hidraw (Windows, OSX) openDevicePath() always fails
+/// and callers fall back to their timed polling schedule.
+class HidrawInputWaiter
+{
+public:
+    HidrawInputWaiter();
+    ~HidrawInputWaiter();
+
+    /// Open the given hidraw device node for readiness waits.
+    /// Returns false if the path isn't a hidraw node or can't be opened.
+    bool openDevicePath(const char *device_path);
+
+    /// Close the device and epoll handles. Safe to call when not open.
+    void close();
+
+    bool getIsOpen() const;
+
+    /// Block until an input report arrives on the device or the timeout
+    /// expires, then discard the queued report copies.
+    /// Returns true if woken by a report, false on timeout or error.
+    bool waitForInputReport(int timeout_milliseconds);
+
+private:
+    int m_device_fd;
+    int m_epoll_fd;
+};
+
+#endif // HIDRAW_INPUT_WAITER_H
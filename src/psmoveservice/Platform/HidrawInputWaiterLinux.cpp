@@ -0,0 +1,122 @@
+//-- includes -----
+#include "HidrawInputWaiter.h"
+#include "ServerLog.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+//-- constants -----
+// Every hidraw node lives under this prefix; anything else isn't a device we
+// can wait on (e.g. a Bluetooth address string on another hidapi backend)
+static const char *k_hidraw_path_prefix= "/dev/hidraw";
+
+//-- public methods -----
+HidrawInputWaiter::HidrawInputWaiter()
+    : m_device_fd(-1)
+    , m_epoll_fd(-1)
+{
+}
+
+HidrawInputWaiter::~HidrawInputWaiter()
+{
+    close();
+}
+
+bool HidrawInputWaiter::openDevicePath(const char *device_path)
+{
+    close();
+
+    if (device_path == nullptr ||
+        strncmp(device_path, k_hidraw_path_prefix, strlen(k_hidraw_path_prefix)) != 0)
+    {
+        return false;
+    }
+
+    // Read-only and non-blocking: this handle only ever signals readiness and
+    // drains its own copy of the reports, it never writes to the device
+    m_device_fd= open(device_path, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+    if (m_device_fd < 0)
+    {
+        SERVER_MT_LOG_WARNING("HidrawInputWaiter::openDevicePath") <<
+            "Failed to open " << device_path << " (errno " << errno << "). " <<
+            "Falling back to timed polling.";
+        return false;
+    }
+
+    m_epoll_fd= epoll_create1(EPOLL_CLOEXEC);
+    if (m_epoll_fd < 0)
+    {
+        close();
+        return false;
+    }
+
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events= EPOLLIN;
+    event.data.fd= m_device_fd;
+
+    if (epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, m_device_fd, &event) != 0)
+    {
+        close();
+        return false;
+    }
+
+    SERVER_MT_LOG_INFO("HidrawInputWaiter::openDevicePath") <<
+        "Waiting on " << device_path << " for input report readiness";
+
+    return true;
+}
+
+void HidrawInputWaiter::close()
+{
+    if (m_epoll_fd >= 0)
+    {
+        ::close(m_epoll_fd);
+        m_epoll_fd= -1;
+    }
+
+    if (m_device_fd >= 0)
+    {
+        ::close(m_device_fd);
+        m_device_fd= -1;
+    }
+}
+
+bool HidrawInputWaiter::getIsOpen() const
+{
+    return m_epoll_fd >= 0;
+}
+
+bool HidrawInputWaiter::waitForInputReport(int timeout_milliseconds)
+{
+    if (m_epoll_fd < 0)
+    {
+        return false;
+    }
+
+    struct epoll_event event;
+    int ready_count= epoll_wait(m_epoll_fd, &event, 1, timeout_milliseconds);
+
+    if (ready_count < 0)
+    {
+        // A signal cut the wait short; treat it like a timeout
+        return false;
+    }
+
+    if (ready_count == 0)
+    {
+        return false;
+    }
+
+    // Drain this handle's copies of the queued reports so the fd goes back to
+    // not-ready. The hidapi handle the controller actually reads through gets
+    // its own copies from the kernel and is unaffected.
+    unsigned char discard_buffer[128];
+    while (read(m_device_fd, discard_buffer, sizeof(discard_buffer)) > 0)
+        ;
+
+    return true;
+}
@@ -0,0 +1,38 @@
+//-- includes -----
+#include "HidrawInputWaiter.h"
+
+//-- public methods -----
+// No hidraw on this platform; openDevicePath() always fails so the polling
+// thread stays on its timed drain schedule.
+HidrawInputWaiter::HidrawInputWaiter()
+    : m_device_fd(-1)
+    , m_epoll_fd(-1)
+{
+}
+
+HidrawInputWaiter::~HidrawInputWaiter()
+{
+}
+
+bool HidrawInputWaiter::openDevicePath(const char *device_path)
+{
+    (void)device_path;
+
+    return false;
+}
+
+void HidrawInputWaiter::close()
+{
+}
+
+bool HidrawInputWaiter::getIsOpen() const
+{
+    return false;
+}
+
+bool HidrawInputWaiter::waitForInputReport(int timeout_milliseconds)
+{
+    (void)timeout_milliseconds;
+
+    return false;
+}
@@ -20,6 +20,24 @@ namespace USBDeviceInterface
 DEFINE_GUID( GUID_DEVCLASS_IMAGE, 0x6bdd1fc6L, 0x810f, 0x11d0, 0xbe, 0xc7, 0x08, 0x00, 0x2b, 0xe2, 0x09, 0x2f );
 
 //-- private definitions -----
+// Walking the SetupDi device tree and hitting the registry takes milliseconds
+// per call and the answers don't change while a device stays plugged in,
+// so cache the results of previous property fetches
+struct DriverRegPropertyCacheEntry
+{
+    USBDeviceInterface::DeviceClass device_class;
+    int vendor_id;
+    int product_id;
+    char property_name[64];
+    char property_value[128];
+    bool bFetchSuccess;
+};
+
+static const int k_max_cached_reg_properties= 8;
+static DriverRegPropertyCacheEntry g_reg_property_cache[k_max_cached_reg_properties];
+static int g_reg_property_cache_count= 0;
+
+
 class DeviceInfoIterator
 {
 public:
@@ -98,6 +116,25 @@ namespace USBDeviceInterface
         bool success= false;
         const GUID *deviceClassGUID= NULL;
 
+        // Return the cached answer if we already looked this property up
+        for (int cache_index= 0; cache_index < g_reg_property_cache_count; ++cache_index)
+        {
+            const DriverRegPropertyCacheEntry &entry= g_reg_property_cache[cache_index];
+
+            if (entry.device_class == deviceClass &&
+                entry.vendor_id == vendor_id &&
+                entry.product_id == product_id &&
+                strcmp(entry.property_name, property_name) == 0)
+            {
+                if (entry.bFetchSuccess)
+                {
+                    StringCchCopyA(buffer, buffer_size, entry.property_value);
+                }
+
+                return entry.bFetchSuccess;
+            }
+        }
+
         switch (deviceClass)
         {
         case USBDeviceInterface::Camera:
@@ -152,6 +189,29 @@ namespace USBDeviceInterface
             }
         }
 
+        // Remember the result (including failures) so later calls for the
+        // same property skip the device tree walk
+        if (g_reg_property_cache_count < k_max_cached_reg_properties)
+        {
+            DriverRegPropertyCacheEntry &entry= g_reg_property_cache[g_reg_property_cache_count];
+
+            entry.device_class= deviceClass;
+            entry.vendor_id= vendor_id;
+            entry.product_id= product_id;
+            StringCchCopyA(entry.property_name, sizeof(entry.property_name), property_name);
+            if (success)
+            {
+                StringCchCopyA(entry.property_value, sizeof(entry.property_value), buffer);
+            }
+            else
+            {
+                entry.property_value[0]= '\0';
+            }
+            entry.bFetchSuccess= success;
+
+            ++g_reg_property_cache_count;
+        }
+
         return success;
     }
 };
@@ -0,0 +1,236 @@
+//-- includes -----
+#include "AllocationTracker.h"
+
+#if defined(PSMOVE_TRACK_ALLOCATIONS)
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+//-- constants -----
+// Deepest nesting of trace scopes tracked per thread; deeper scopes keep
+// attributing to the scope at the cap rather than losing allocations
+static const int k_max_scope_depth = 16;
+
+// Distinct scope names tracked; attribution falls into the overflow bucket
+// once the table fills (scope names are string literals, so this is bounded
+// by the number of SERVER_TRACE_SCOPE sites, not by runtime behavior)
+static const int k_max_tracked_scopes = 64;
+
+static const char *k_no_scope_name = "(no scope)";
+static const char *k_overflow_scope_name = "(scope table full)";
+
+//-- private definitions -----
+struct ScopeSlot
+{
+    // Scope names are string literals, so pointer identity is name identity
+    std::atomic<const char *> scope_name;
+    std::atomic<unsigned long long> allocation_count;
+    std::atomic<unsigned long long> allocation_bytes;
+    std::atomic<unsigned long long> free_count;
+};
+
+//-- statics -----
+// Slot 0 is the no-scope bucket, slot 1 the overflow bucket; both are live
+// from the first use so the hooks never have to test for them
+static ScopeSlot g_scope_slots[k_max_tracked_scopes];
+static std::atomic_bool g_fixed_slots_assigned(false);
+
+static thread_local const char *tl_scope_stack[k_max_scope_depth];
+static thread_local int tl_scope_depth = 0;
+
+// Guards against the hooks recursing through themselves
+static thread_local bool tl_in_allocation_hook = false;
+
+//-- private methods -----
+static void assign_fixed_slots()
+{
+    bool expected = false;
+    if (g_fixed_slots_assigned.compare_exchange_strong(expected, true))
+    {
+        g_scope_slots[0].scope_name.store(k_no_scope_name, std::memory_order_release);
+        g_scope_slots[1].scope_name.store(k_overflow_scope_name, std::memory_order_release);
+    }
+}
+
+static ScopeSlot *find_or_insert_slot(const char *scope_name)
+{
+    assign_fixed_slots();
+
+    for (int slot_index = 0; slot_index < k_max_tracked_scopes; ++slot_index)
+    {
+        ScopeSlot &slot = g_scope_slots[slot_index];
+        const char *slot_name = slot.scope_name.load(std::memory_order_acquire);
+
+        if (slot_name == scope_name)
+        {
+            return &slot;
+        }
+
+        if (slot_name == nullptr)
+        {
+            const char *expected = nullptr;
+            if (slot.scope_name.compare_exchange_strong(expected, scope_name))
+            {
+                return &slot;
+            }
+
+            // Another thread claimed this slot; it may have claimed it for
+            // the same name we want
+            if (expected == scope_name)
+            {
+                return &slot;
+            }
+        }
+    }
+
+    return &g_scope_slots[1]; // overflow bucket
+}
+
+static ScopeSlot *current_slot()
+{
+    const char *scope_name =
+        (tl_scope_depth > 0)
+        ? tl_scope_stack[std::min(tl_scope_depth, k_max_scope_depth) - 1]
+        : k_no_scope_name;
+
+    return find_or_insert_slot(scope_name);
+}
+
+//-- public methods -----
+namespace AllocationTracker
+{
+    void pushScope(const char *scope_name)
+    {
+        if (tl_scope_depth < k_max_scope_depth)
+        {
+            tl_scope_stack[tl_scope_depth] = scope_name;
+        }
+        ++tl_scope_depth;
+    }
+
+    void popScope()
+    {
+        --tl_scope_depth;
+    }
+
+    void recordAllocation(const std::size_t size)
+    {
+        if (tl_in_allocation_hook)
+        {
+            return;
+        }
+        tl_in_allocation_hook = true;
+
+        ScopeSlot *slot = current_slot();
+        slot->allocation_count.fetch_add(1, std::memory_order_relaxed);
+        slot->allocation_bytes.fetch_add(size, std::memory_order_relaxed);
+
+        tl_in_allocation_hook = false;
+    }
+
+    void recordFree()
+    {
+        if (tl_in_allocation_hook)
+        {
+            return;
+        }
+        tl_in_allocation_hook = true;
+
+        ScopeSlot *slot = current_slot();
+        slot->free_count.fetch_add(1, std::memory_order_relaxed);
+
+        tl_in_allocation_hook = false;
+    }
+
+    void getStats(std::vector<ScopeAllocationStats> &out_stats)
+    {
+        out_stats.clear();
+
+        for (int slot_index = 0; slot_index < k_max_tracked_scopes; ++slot_index)
+        {
+            ScopeSlot &slot = g_scope_slots[slot_index];
+            const char *slot_name = slot.scope_name.load(std::memory_order_acquire);
+
+            if (slot_name == nullptr)
+            {
+                break; // slots fill in order
+            }
+
+            ScopeAllocationStats stats;
+            stats.scope_name = slot_name;
+            stats.allocation_count = slot.allocation_count.load(std::memory_order_relaxed);
+            stats.allocation_bytes = slot.allocation_bytes.load(std::memory_order_relaxed);
+            stats.free_count = slot.free_count.load(std::memory_order_relaxed);
+
+            // Skip buckets that never saw an allocation (the overflow bucket
+            // in particular is usually idle)
+            if (stats.allocation_count > 0 || stats.free_count > 0)
+            {
+                out_stats.push_back(stats);
+            }
+        }
+    }
+};
+
+//-- global allocation hooks -----
+void *operator new(std::size_t size)
+{
+    void *ptr = std::malloc(size != 0 ? size : 1);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    AllocationTracker::recordAllocation(size);
+
+    return ptr;
+}
+
+void *operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    void *ptr = std::malloc(size != 0 ? size : 1);
+    if (ptr != nullptr)
+    {
+        AllocationTracker::recordAllocation(size);
+    }
+
+    return ptr;
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &nothrow) noexcept
+{
+    return operator new(size, nothrow);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    if (ptr != nullptr)
+    {
+        AllocationTracker::recordFree();
+        std::free(ptr);
+    }
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    operator delete(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    operator delete(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept
+{
+    operator delete(ptr);
+}
+
+#endif // PSMOVE_TRACK_ALLOCATIONS
@@ -0,0 +1,47 @@
+#ifndef ALLOCATION_TRACKER_H
+#define ALLOCATION_TRACKER_H
+
+//-- includes -----
+#include <vector>
+
+//-- definitions -----
+/// Opt-in heap allocation accounting, compiled in with the
+/// PSMOVE_TRACK_ALLOCATIONS CMake option. When enabled, overridden global
+/// new/delete attribute every allocation to the innermost SERVER_TRACE_SCOPE
+/// marker active on the allocating thread, so a GET_SERVICE_STATISTICS scrape
+/// answers "which pipeline stage is hitting the allocator?" without an
+/// external profiler. All bookkeeping is lock-free and allocation-free so the
+/// hooks can run inside operator new itself.
+namespace AllocationTracker
+{
+    struct ScopeAllocationStats
+    {
+        const char *scope_name;
+        unsigned long long allocation_count;
+        unsigned long long allocation_bytes;
+        unsigned long long free_count;
+    };
+
+#if defined(PSMOVE_TRACK_ALLOCATIONS)
+    /// Maintained by ScopeTracer - the innermost active trace scope on the
+    /// calling thread is the attribution bucket for its allocations
+    void pushScope(const char *scope_name);
+    void popScope();
+
+    /// Called by the overridden global new/delete
+    void recordAllocation(const std::size_t size);
+    void recordFree();
+
+    /// Counts are monotonic since service startup
+    void getStats(std::vector<ScopeAllocationStats> &out_stats);
+
+    inline bool getIsAvailable() { return true; }
+#else
+    inline void pushScope(const char *) {}
+    inline void popScope() {}
+    inline void getStats(std::vector<ScopeAllocationStats> &) {}
+    inline bool getIsAvailable() { return false; }
+#endif // PSMOVE_TRACK_ALLOCATIONS
+};
+
+#endif // ALLOCATION_TRACKER_H
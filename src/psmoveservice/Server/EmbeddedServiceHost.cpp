@@ -0,0 +1,180 @@
+//-- includes -----
+#include "EmbeddedServiceHost.h"
+#include "ConfigWriter.h"
+#include "DeviceManager.h"
+#include "ServerLog.h"
+#include "ServerNetworkManager.h"
+#include "ServerRequestHandler.h"
+#include "ServerTracer.h"
+#include "ServiceClock.h"
+#include "PSMoveProtocol.pb.h"
+
+#include <boost/asio.hpp>
+
+//-- constants -----
+// The network manager needs a port for its constructor but never binds it
+// in embedded mode
+static const unsigned int k_embedded_unused_port = 0;
+
+//-- definitions -----
+class EmbeddedServiceHostImpl
+{
+public:
+    EmbeddedServiceHostImpl()
+        : m_io_service()
+        , m_device_manager()
+        , m_request_handler(&m_device_manager)
+        , m_network_manager(&m_io_service, k_embedded_unused_port, &m_request_handler)
+    {
+    }
+
+    bool startup(const std::string &log_level)
+    {
+        bool success= true;
+
+        log_init(log_level);
+
+        /** Calibrate the service clock before anything takes a timestamp */
+        ServiceClock::calibrate();
+
+        /** Register the socket-free network manager singleton so that
+            notification and async response sends have somewhere to go */
+        if (!m_network_manager.startup_embedded())
+        {
+            SERVER_LOG_FATAL("EmbeddedServiceHost") << "Failed to initialize the embedded network manager";
+            success= false;
+        }
+
+        /** Setup the controller manager */
+        if (success)
+        {
+            if (!m_device_manager.startup())
+            {
+                SERVER_LOG_FATAL("EmbeddedServiceHost") << "Failed to initialize the controller manager";
+                success= false;
+            }
+        }
+
+        /** Setup the request handler */
+        if (success)
+        {
+            if (!m_request_handler.startup())
+            {
+                SERVER_LOG_FATAL("EmbeddedServiceHost") << "Failed to initialize the service request handler";
+                success= false;
+            }
+        }
+
+        return success;
+    }
+
+    void update()
+    {
+        /** Update any async requests still waiting to complete */
+        m_request_handler.update();
+
+        /**
+         Update the list of active tracked controllers
+         Publish state to the shared memory streams
+         */
+        m_device_manager.update();
+
+        /** Close out and write any trace capture whose window has elapsed */
+        ServerTracer::update();
+    }
+
+    void shutdown()
+    {
+        // Release any streams the embedded client still has active
+        m_request_handler.handle_client_connection_stopped(EmbeddedServiceHost::k_embedded_connection_id);
+
+        // Kill any pending request state
+        m_request_handler.shutdown();
+
+        // Unregister the network manager singleton
+        m_network_manager.shutdown_embedded();
+
+        // Disconnect any actively connected controllers
+        m_device_manager.shutdown();
+
+        // Make sure every queued config save reaches the disk before we exit
+        ConfigWriter::shutdown();
+    }
+
+    ResponsePtr handle_request(RequestPtr request)
+    {
+        return m_request_handler.handle_request(EmbeddedServiceHost::k_embedded_connection_id, request);
+    }
+
+    void handle_input_data_frame(DeviceInputDataFramePtr data_frame)
+    {
+        // Stamp the frame as coming from the embedded connection so it lands
+        // in the same per-connection state that handle_request() uses
+        data_frame->set_connection_id(EmbeddedServiceHost::k_embedded_connection_id);
+
+        m_request_handler.handle_input_data_frame(data_frame);
+    }
+
+    void set_response_callback(
+        IEmbeddedServiceInterface::t_embedded_response_callback callback,
+        void *userdata)
+    {
+        m_network_manager.set_embedded_response_sink(callback, userdata);
+    }
+
+private:
+    // Required by the network manager constructor; never run in embedded mode
+    boost::asio::io_service m_io_service;
+
+    DeviceManager m_device_manager;
+    ServerRequestHandler m_request_handler;
+    ServerNetworkManager m_network_manager;
+};
+
+//-- public interface -----
+// No real client connections exist in embedded mode, so any id is free
+const int EmbeddedServiceHost::k_embedded_connection_id = 0;
+
+EmbeddedServiceHost::EmbeddedServiceHost()
+    : m_implementation_ptr(new EmbeddedServiceHostImpl)
+{
+}
+
+EmbeddedServiceHost::~EmbeddedServiceHost()
+{
+    if (m_implementation_ptr != nullptr)
+    {
+        delete m_implementation_ptr;
+        m_implementation_ptr= nullptr;
+    }
+}
+
+bool EmbeddedServiceHost::startup(const std::string &log_level)
+{
+    return m_implementation_ptr->startup(log_level);
+}
+
+void EmbeddedServiceHost::shutdown()
+{
+    m_implementation_ptr->shutdown();
+}
+
+ResponsePtr EmbeddedServiceHost::handle_request(RequestPtr request)
+{
+    return m_implementation_ptr->handle_request(request);
+}
+
+void EmbeddedServiceHost::handle_input_data_frame(DeviceInputDataFramePtr data_frame)
+{
+    m_implementation_ptr->handle_input_data_frame(data_frame);
+}
+
+void EmbeddedServiceHost::set_response_callback(t_embedded_response_callback callback, void *userdata)
+{
+    m_implementation_ptr->set_response_callback(callback, userdata);
+}
+
+void EmbeddedServiceHost::update()
+{
+    m_implementation_ptr->update();
+}
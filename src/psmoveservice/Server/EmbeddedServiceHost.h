@@ -0,0 +1,45 @@
+#ifndef EMBEDDED_SERVICE_HOST_H
+#define EMBEDDED_SERVICE_HOST_H
+
+//-- includes -----
+#include "PSMoveProtocolInterface.h"
+#include <string>
+
+//-- definitions -----
+/// Hosts the PSMove service in-process for tools that link both
+/// psmoveclient and psmoveservice. Owns the device manager, the request
+/// handler and a socket-free network manager; client requests bind directly
+/// to ServerRequestHandler calls and controller/tracker data rides the
+/// same-host shared memory streams, so offline batch analysis runs never
+/// touch the loopback network.
+///
+/// Usage: construct, startup(), hand to ClientPSMoveAPI::startup_embedded(),
+/// then drive the combined client+service loop via ClientPSMoveAPI::update().
+class EmbeddedServiceHost : public IEmbeddedServiceInterface
+{
+public:
+    EmbeddedServiceHost();
+    virtual ~EmbeddedServiceHost();
+
+    /// Starts the device manager and request handler.
+    /// No sockets get bound, so a networked service can run alongside.
+    bool startup(const std::string &log_level= "info");
+
+    /// Tears down any embedded client streams and stops the service
+    void shutdown();
+
+    // -- IEmbeddedServiceInterface
+    virtual ResponsePtr handle_request(RequestPtr request) override;
+    virtual void handle_input_data_frame(DeviceInputDataFramePtr data_frame) override;
+    virtual void set_response_callback(t_embedded_response_callback callback, void *userdata) override;
+    virtual void update() override;
+
+    /// Connection id the embedded client's requests and streams run under
+    static const int k_embedded_connection_id;
+
+private:
+    // private implementation - same lifetime as the EmbeddedServiceHost
+    class EmbeddedServiceHostImpl *m_implementation_ptr;
+};
+
+#endif // EMBEDDED_SERVICE_HOST_H
@@ -0,0 +1,164 @@
+//-- includes -----
+#include "HitchWatchdog.h"
+#include "ServerLog.h"
+#include "ThreadCpuMonitor.h"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+//-- constants -----
+// A stage running longer than this is reported as a stall
+static const double k_stall_threshold_milliseconds = 100.0;
+
+// How often the watchdog thread samples the service thread's progress
+static const int k_watchdog_sample_interval_milliseconds = 20;
+
+static const char *k_stage_names[HitchWatchdog::k_stage_count] = {
+    "idle",
+    "request_handler",
+    "device_update",
+    "network_inbound"
+};
+
+//-- statics -----
+static std::atomic_int g_current_stage(HitchWatchdog::Stage_Idle);
+static std::atomic_int g_active_device_id(-1);
+static std::atomic<unsigned long long> g_stage_entry_microseconds(0);
+
+static std::atomic_uint g_stall_counts[HitchWatchdog::k_stage_count];
+static std::atomic<unsigned long long> g_worst_stall_microseconds[HitchWatchdog::k_stage_count];
+
+static std::thread g_watchdog_thread;
+static std::atomic_bool g_shutdown_requested(false);
+static bool g_watchdog_thread_started = false;
+
+//-- private prototypes -----
+static unsigned long long now_microseconds();
+static void watchdog_thread_proc();
+
+//-- public interface -----
+namespace HitchWatchdog
+{
+    void startup()
+    {
+        if (!g_watchdog_thread_started)
+        {
+            for (int stage_index = 0; stage_index < k_stage_count; ++stage_index)
+            {
+                g_stall_counts[stage_index].store(0, std::memory_order_release);
+                g_worst_stall_microseconds[stage_index].store(0, std::memory_order_release);
+            }
+
+            g_stage_entry_microseconds.store(now_microseconds(), std::memory_order_release);
+            g_shutdown_requested.store(false, std::memory_order_release);
+            g_watchdog_thread = std::thread(watchdog_thread_proc);
+            g_watchdog_thread_started = true;
+        }
+    }
+
+    void shutdown()
+    {
+        if (g_watchdog_thread_started)
+        {
+            g_shutdown_requested.store(true, std::memory_order_release);
+            g_watchdog_thread.join();
+            g_watchdog_thread_started = false;
+        }
+    }
+
+    void enterStage(const eStage stage)
+    {
+        const unsigned long long now = now_microseconds();
+        const int previous_stage = g_current_stage.load(std::memory_order_acquire);
+        const unsigned long long stage_duration =
+            now - g_stage_entry_microseconds.load(std::memory_order_acquire);
+
+        // Close out the previous stage, counting it if it overran the threshold
+        if (previous_stage != Stage_Idle &&
+            stage_duration >= static_cast<unsigned long long>(k_stall_threshold_milliseconds*1000.0))
+        {
+            g_stall_counts[previous_stage].fetch_add(1, std::memory_order_acq_rel);
+
+            unsigned long long worst =
+                g_worst_stall_microseconds[previous_stage].load(std::memory_order_acquire);
+            while (stage_duration > worst &&
+                !g_worst_stall_microseconds[previous_stage].compare_exchange_weak(worst, stage_duration))
+            {
+            }
+        }
+
+        g_active_device_id.store(-1, std::memory_order_release);
+        g_current_stage.store(stage, std::memory_order_release);
+        g_stage_entry_microseconds.store(now, std::memory_order_release);
+    }
+
+    void setActiveDeviceId(const int device_id)
+    {
+        g_active_device_id.store(device_id, std::memory_order_release);
+    }
+
+    const char *getStageName(const eStage stage)
+    {
+        return k_stage_names[stage];
+    }
+
+    unsigned int getStallCount(const eStage stage)
+    {
+        return g_stall_counts[stage].load(std::memory_order_acquire);
+    }
+
+    float getWorstStallMilliseconds(const eStage stage)
+    {
+        return static_cast<float>(
+            g_worst_stall_microseconds[stage].load(std::memory_order_acquire)) / 1000.f;
+    }
+};
+
+//-- private functions -----
+static unsigned long long now_microseconds()
+{
+    return static_cast<unsigned long long>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+static void watchdog_thread_proc()
+{
+    ThreadCpuMonitor::registerCurrentThread("hitch_watchdog");
+
+    // The stage entry timestamp of the last in-progress stall already
+    // reported, so one long stall logs exactly one in-progress report
+    unsigned long long last_reported_entry = 0;
+
+    while (!g_shutdown_requested.load(std::memory_order_acquire))
+    {
+        std::this_thread::sleep_for(
+            std::chrono::milliseconds(k_watchdog_sample_interval_milliseconds));
+
+        const int stage = g_current_stage.load(std::memory_order_acquire);
+        const unsigned long long stage_entry =
+            g_stage_entry_microseconds.load(std::memory_order_acquire);
+        const unsigned long long stalled_microseconds = now_microseconds() - stage_entry;
+
+        if (stage != HitchWatchdog::Stage_Idle &&
+            stage_entry != last_reported_entry &&
+            stalled_microseconds >= static_cast<unsigned long long>(k_stall_threshold_milliseconds*1000.0))
+        {
+            const int device_id = g_active_device_id.load(std::memory_order_acquire);
+
+            // Report the stall while it is still in progress - if the service
+            // thread is wedged for good this is the only report we'll get
+            SERVER_LOG_ERROR("HitchWatchdog") << "Service thread stalled in stage '"
+                << k_stage_names[stage] << "'"
+                << (device_id >= 0 ? " on device " : "")
+                << (device_id >= 0 ? std::to_string(device_id) : std::string())
+                << " for " << (stalled_microseconds / 1000) << "ms (and counting)";
+
+            last_reported_entry = stage_entry;
+        }
+    }
+
+    ThreadCpuMonitor::unregisterCurrentThread();
+}
@@ -0,0 +1,41 @@
+#ifndef HITCH_WATCHDOG_H
+#define HITCH_WATCHDOG_H
+
+//-- definitions -----
+/// Watches the service thread's progress through its update stages from a
+/// low-frequency sampling thread. When a stage overruns the stall threshold
+/// a structured report naming the stage, the active device and the stall
+/// duration is logged through SERVER_LOG_ERROR, so production hitches leave
+/// evidence without anyone watching a profiler. Per-stage stall counters are
+/// kept for the GET_SERVICE_STATISTICS protocol request.
+namespace HitchWatchdog
+{
+    enum eStage
+    {
+        Stage_Idle,
+        Stage_RequestHandler,
+        Stage_DeviceUpdate,
+        Stage_NetworkInbound,
+
+        k_stage_count
+    };
+
+    /// Spin up the watchdog sampling thread
+    void startup();
+    void shutdown();
+
+    /// Called from the service thread when it enters a new update stage.
+    /// Also closes out the previous stage, counting it as a stall if it
+    /// overran the threshold.
+    void enterStage(const eStage stage);
+
+    /// Called around per-device work inside Stage_DeviceUpdate so stall
+    /// reports can name the device (-1 = no specific device)
+    void setActiveDeviceId(const int device_id);
+
+    const char *getStageName(const eStage stage);
+    unsigned int getStallCount(const eStage stage);
+    float getWorstStallMilliseconds(const eStage stage);
+};
+
+#endif // HITCH_WATCHDOG_H
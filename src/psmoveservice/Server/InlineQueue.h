@@ -0,0 +1,134 @@
+#ifndef INLINE_QUEUE_H
+#define INLINE_QUEUE_H
+
+//-- includes -----
+#include <cassert>
+#include <utility>
+#include <vector>
+
+//-- definitions -----
+/// FIFO queue with fixed-capacity inline storage.
+///
+/// The first t_inline_capacity elements live in a ring buffer embedded in the
+/// queue itself, so the common small-backlog case on the per-tick send paths
+/// never touches the heap. Only when a burst exceeds the inline capacity do
+/// the extra elements spill into an overflow std::vector, which keeps its
+/// capacity across bursts.
+///
+/// Elements must be default constructible and assignable; popped slots are
+/// reset to a default constructed element so that ref-counted payloads get
+/// released as soon as they leave the queue.
+template <typename t_element, int t_inline_capacity>
+class InlineQueue
+{
+public:
+    InlineQueue()
+        : m_ring_head(0)
+        , m_ring_count(0)
+        , m_overflow_head(0)
+    {
+    }
+
+    int size() const
+    {
+        return m_ring_count + static_cast<int>(m_overflow.size()) - m_overflow_head;
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    void push_back(const t_element &element)
+    {
+        if (m_ring_count < t_inline_capacity && m_overflow_head == static_cast<int>(m_overflow.size()))
+        {
+            m_ring[(m_ring_head + m_ring_count) % t_inline_capacity]= element;
+            ++m_ring_count;
+        }
+        else
+        {
+            m_overflow.push_back(element);
+        }
+    }
+
+    const t_element &operator[](int index) const
+    {
+        assert(index >= 0 && index < size());
+
+        if (index < m_ring_count)
+        {
+            return m_ring[(m_ring_head + index) % t_inline_capacity];
+        }
+        else
+        {
+            return m_overflow[m_overflow_head + (index - m_ring_count)];
+        }
+    }
+
+    void pop_front()
+    {
+        assert(size() > 0);
+
+        if (m_ring_count > 0)
+        {
+            // Release the payload as soon as it leaves the queue
+            m_ring[m_ring_head]= t_element();
+            m_ring_head= (m_ring_head + 1) % t_inline_capacity;
+            --m_ring_count;
+
+            // Refill the ring from the overflow so the fast path stays warm
+            if (m_overflow_head < static_cast<int>(m_overflow.size()))
+            {
+                m_ring[(m_ring_head + m_ring_count) % t_inline_capacity]= m_overflow[m_overflow_head];
+                m_overflow[m_overflow_head]= t_element();
+                ++m_overflow_head;
+                ++m_ring_count;
+            }
+        }
+        else
+        {
+            m_overflow[m_overflow_head]= t_element();
+            ++m_overflow_head;
+        }
+
+        // The overflow is fully drained - recycle its storage
+        if (m_overflow_head == static_cast<int>(m_overflow.size()) && m_overflow_head > 0)
+        {
+            m_overflow.clear();
+            m_overflow_head= 0;
+        }
+    }
+
+    void clear()
+    {
+        while (size() > 0)
+        {
+            pop_front();
+        }
+    }
+
+    void swap(InlineQueue &other)
+    {
+        for (int slot_index= 0; slot_index < t_inline_capacity; ++slot_index)
+        {
+            std::swap(m_ring[slot_index], other.m_ring[slot_index]);
+        }
+        std::swap(m_ring_head, other.m_ring_head);
+        std::swap(m_ring_count, other.m_ring_count);
+        m_overflow.swap(other.m_overflow);
+        std::swap(m_overflow_head, other.m_overflow_head);
+    }
+
+private:
+    t_element m_ring[t_inline_capacity];
+    int m_ring_head;
+    int m_ring_count;
+
+    // Elements past the inline capacity, in FIFO order starting at
+    // m_overflow_head. Cleared (but not shrunk) once fully drained.
+    std::vector<t_element> m_overflow;
+    int m_overflow_head;
+};
+
+#endif // INLINE_QUEUE_H
@@ -2,17 +2,25 @@
 #define BOOST_LIB_DIAGNOSTIC
 
 #include "PSMoveService.h"
+#include "ConfigWriter.h"
 #include "ServerNetworkManager.h"
 #include "ServerRequestHandler.h"
+#include "DeviceDataReadySignal.h"
 #include "DeviceManager.h"
 #include "ProtocolVersion.h"
+#include "HitchWatchdog.h"
 #include "ServerLog.h"
+#include "ServerTracer.h"
+#include "ServiceClock.h"
+#include "ServicePerfCounters.h"
 #include "SharedTrackerState.h"
+#include "StartupPhaseProfiler.h"
 #include "TrackerManager.h"
 
 #include <boost/asio.hpp>
 #include <boost/application.hpp>
 #include <boost/program_options.hpp>
+#include <algorithm>
 #include <fstream>
 #include <cstdio>
 #include <string>
@@ -33,6 +41,13 @@
 
 const int PSMOVE_SERVER_PORT = 9512;
 
+// Ticks that overrun their deadline by more than this many periods re-anchor
+// the schedule instead of running update() back to back to catch up
+const int SERVER_TICK_MAX_CATCH_UP_PERIODS = 4;
+
+// How often the main loop logs its scheduling drift metrics
+const int SERVER_TICK_DRIFT_REPORT_INTERVAL_SECONDS = 60;
+
 //-- definitions -----
 class PSMoveServiceImpl
 {
@@ -67,6 +82,18 @@ public:
                 m_status = context.find<boost::application::status>();
 
 				const TrackerManagerConfig &cfg = DeviceManager::getInstance()->m_tracker_manager->getConfig();
+				const std::chrono::milliseconds tick_period(cfg.tracker_sleep_ms);
+
+				// Schedule update() against absolute deadlines instead of sleeping a fixed
+				// amount after each tick. A fixed sleep adds the update cost to every period,
+				// so the effective tick rate (and with it the filter dT) drifts with load.
+				std::chrono::steady_clock::time_point next_tick_deadline =
+					std::chrono::steady_clock::now() + tick_period;
+				std::chrono::steady_clock::time_point last_drift_report_time =
+					std::chrono::steady_clock::now();
+				std::chrono::steady_clock::duration max_tick_overrun(0);
+				int ticks_since_drift_report = 0;
+				int overrun_ticks_since_drift_report = 0;
 
                 while (m_status->state() != boost::application::status::stoped)
                 {
@@ -75,7 +102,63 @@ public:
                         update();
                     }
 
-					std::this_thread::sleep_for(std::chrono::milliseconds(cfg.tracker_sleep_ms));
+					const std::chrono::steady_clock::time_point tick_end_time =
+						std::chrono::steady_clock::now();
+					++ticks_since_drift_report;
+
+					if (tick_end_time > next_tick_deadline)
+					{
+						// The update overran its deadline
+						const std::chrono::steady_clock::duration overrun = tick_end_time - next_tick_deadline;
+
+						++overrun_ticks_since_drift_report;
+						max_tick_overrun = std::max(max_tick_overrun, overrun);
+
+						if (overrun > tick_period*SERVER_TICK_MAX_CATCH_UP_PERIODS)
+						{
+							// Too far behind to make up tick by tick (debugger pause, system sleep, ...).
+							// Re-anchor the schedule at the present rather than spinning through
+							// back to back updates until it catches up.
+							next_tick_deadline = tick_end_time + tick_period;
+						}
+						else
+						{
+							// Slightly behind - skip the sleep and let the schedule catch up
+							next_tick_deadline += tick_period;
+						}
+					}
+					else
+					{
+						// Sleep until either a producer thread (HID poll, frame
+						// capture, network inbound) reports new data or the tick
+						// deadline passes. An early data wake runs update()
+						// immediately and leaves the deadline in place, so the
+						// deadline schedule still bounds the tick rate from below
+						// on a quiet system.
+						if (!DeviceDataReadySignal::waitForDataUntil(next_tick_deadline))
+						{
+							next_tick_deadline += tick_period;
+						}
+					}
+
+					// Periodically report how well the loop is holding its schedule
+					if (tick_end_time - last_drift_report_time >=
+						std::chrono::seconds(SERVER_TICK_DRIFT_REPORT_INTERVAL_SECONDS))
+					{
+						if (overrun_ticks_since_drift_report > 0)
+						{
+							SERVER_LOG_INFO("PSMoveService") << "Tick overran its deadline "
+								<< overrun_ticks_since_drift_report << " of " << ticks_since_drift_report
+								<< " times (worst overrun "
+								<< std::chrono::duration_cast<std::chrono::microseconds>(max_tick_overrun).count()
+								<< "us)";
+						}
+
+						last_drift_report_time = tick_end_time;
+						ticks_since_drift_report = 0;
+						overrun_ticks_since_drift_report = 0;
+						max_tick_overrun = std::chrono::steady_clock::duration(0);
+					}
                 }
             }
             else
@@ -140,6 +223,12 @@ private:
     {
         bool success= true;
 
+        /** Calibrate the service clock before anything takes a timestamp */
+        StartupPhaseProfiler::beginPhase("clock_calibration");
+        ServiceClock::calibrate();
+
+        StartupPhaseProfiler::beginPhase("shared_memory_dir");
+
 		/** Make sure the shared memory directory exists (if non-default path is defined) */
 		#if defined(BOOST_INTERPROCESS_SHARED_DIR_PATH)
 		boost::filesystem::path shared_mem_dir(BOOST_INTERPROCESS_SHARED_DIR_PATH);
@@ -157,6 +246,8 @@ private:
         /** Start listening for client connections */
         if (success)
         {
+            StartupPhaseProfiler::beginPhase("network_bind");
+
             if (!m_network_manager.startup())
             {
                 SERVER_LOG_FATAL("PSMoveService") << "Failed to initialize the service network manager";
@@ -177,6 +268,8 @@ private:
         /** Setup the request handler */
         if (success)
         {
+            StartupPhaseProfiler::beginPhase("request_handler");
+
             if (!m_request_handler.startup())
             {
                 SERVER_LOG_FATAL("PSMoveService") << "Failed to initialize the service request handler";
@@ -184,27 +277,55 @@ private:
             }
         }
 
+        /** Watch for service thread stalls once everything else is up */
+        if (success)
+        {
+            StartupPhaseProfiler::beginPhase("hitch_watchdog");
+            HitchWatchdog::startup();
+        }
+
+        /** Log the per-phase startup timing table now that we're ready */
+        if (success)
+        {
+            StartupPhaseProfiler::complete();
+        }
+
         return success;
     }
 
     /// Called in the application loop.
     void update()
     {
+        ServicePerfCounters::increment(ServicePerfCounters::Counter_MainLoopTicks);
+
         /** Update an async requests still waiting to complete */
+        HitchWatchdog::enterStage(HitchWatchdog::Stage_RequestHandler);
         m_request_handler.update();
 
         /**
          Update the list of active tracked controllers
          Send controller updates to the client
          */
+        HitchWatchdog::enterStage(HitchWatchdog::Stage_DeviceUpdate);
         m_device_manager.update();
 
         /** Process incoming/outgoing networking requests */
+        HitchWatchdog::enterStage(HitchWatchdog::Stage_NetworkInbound);
         m_network_manager.update();
+
+        /** Close out and write any trace capture whose window has elapsed */
+        ServerTracer::update();
+
+        /** The time between updates doesn't count toward any stage */
+        HitchWatchdog::enterStage(HitchWatchdog::Stage_Idle);
     }
 
     void shutdown()
     {
+        // Stop the watchdog before tearing anything down so shutdown work
+        // doesn't get reported as a stall
+        HitchWatchdog::shutdown();
+
         // Kill any pending request state
         m_request_handler.shutdown();
 
@@ -213,6 +334,9 @@ private:
 
         // Disconnect any actively connected controllers
         m_device_manager.shutdown();
+
+        // Make sure every queued config save reaches the disk before we exit
+        ConfigWriter::shutdown();
     }
 
     void handle_termination_signal()
@@ -1,23 +1,160 @@
 //-- includes -----
 #include "ServerLog.h"
+#include "ThreadCpuMonitor.h"
 
+#include <atomic>
 #include <chrono>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <mutex>
 #include <ostream>
+#include <thread>
 
 #ifdef _MSC_VER
 #pragma warning (disable: 4996) // 'This function or variable may be unsafe': localtime
 #endif
 
+//-- constants -----
+// Capacity of the pending-line ring (must be a power of two).
+// Lines enqueued while the ring is full are dropped and counted.
+static const size_t k_log_ring_capacity = 4096;
+
+// How long the flush thread sleeps between drains
+static const int k_log_flush_interval_milliseconds = 2;
+
 //-- globals -----
 e_log_severity_level g_min_log_level= _log_severity_level_info;
 std::ostream *g_console_stream= nullptr;
 std::ostream *g_file_stream = nullptr;
 std::mutex *g_logger_mutex = nullptr;
 
+// Bounded multi-producer ring of formatted lines (Vyukov style: each cell
+// carries a sequence number producers and the consumer rendezvous on).
+// Producers only copy the line and bump two atomics; all stream I/O happens
+// on the flush thread so logging never blocks the service or device threads.
+struct LogRingCell
+{
+	std::atomic<size_t> sequence;
+	std::string line;
+};
+static LogRingCell g_log_ring[k_log_ring_capacity];
+static std::atomic<size_t> g_log_enqueue_pos(0);
+static size_t g_log_dequeue_pos = 0; // flush thread only
+static std::atomic<unsigned long long> g_dropped_line_count(0);
+
+static std::thread g_log_flush_thread;
+static std::atomic_bool g_log_flush_shutdown(false);
+static bool g_log_flush_thread_started = false;
+
+//-- private implementation -----
+static bool log_ring_try_enqueue(std::string &&line)
+{
+	size_t pos = g_log_enqueue_pos.load(std::memory_order_relaxed);
+
+	for (;;)
+	{
+		LogRingCell &cell = g_log_ring[pos & (k_log_ring_capacity - 1)];
+		const size_t seq = cell.sequence.load(std::memory_order_acquire);
+		const intptr_t dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+		if (dif == 0)
+		{
+			// The cell is free at this position - try to claim it
+			if (g_log_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+			{
+				cell.line = std::move(line);
+				cell.sequence.store(pos + 1, std::memory_order_release);
+				return true;
+			}
+		}
+		else if (dif < 0)
+		{
+			// The consumer hasn't freed this cell yet - the ring is full
+			return false;
+		}
+		else
+		{
+			// Another producer claimed this position - retry at the new tail
+			pos = g_log_enqueue_pos.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+static bool log_ring_try_dequeue(std::string &out_line)
+{
+	LogRingCell &cell = g_log_ring[g_log_dequeue_pos & (k_log_ring_capacity - 1)];
+	const size_t seq = cell.sequence.load(std::memory_order_acquire);
+
+	if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(g_log_dequeue_pos + 1) < 0)
+	{
+		return false; // nothing published at this position yet
+	}
+
+	out_line = std::move(cell.line);
+	cell.sequence.store(g_log_dequeue_pos + k_log_ring_capacity, std::memory_order_release);
+	++g_log_dequeue_pos;
+
+	return true;
+}
+
+static void log_write_line_to_streams(const std::string &line)
+{
+	if (g_console_stream != nullptr)
+	{
+		*g_console_stream << line << "\n";
+	}
+
+	if (g_file_stream != nullptr)
+	{
+		*g_file_stream << line << "\n";
+	}
+}
+
+static void log_flush_thread_proc()
+{
+	ThreadCpuMonitor::registerCurrentThread("log_flush");
+
+	while (!g_log_flush_shutdown.load(std::memory_order_acquire))
+	{
+		std::string line;
+		bool bWroteAnything = false;
+
+		while (log_ring_try_dequeue(line))
+		{
+			log_write_line_to_streams(line);
+			bWroteAnything = true;
+		}
+
+		// Report overflow drops from this drain interval
+		const unsigned long long dropped = g_dropped_line_count.exchange(0, std::memory_order_acq_rel);
+		if (dropped > 0)
+		{
+			log_write_line_to_streams(
+				log_get_timestamp_prefix() + "ServerLog - Dropped " +
+				std::to_string(dropped) + " log lines (ring overflow)");
+			bWroteAnything = true;
+		}
+
+		if (bWroteAnything)
+		{
+			// One flush per drain rather than one per line
+			if (g_console_stream != nullptr)
+			{
+				g_console_stream->flush();
+			}
+			if (g_file_stream != nullptr)
+			{
+				g_file_stream->flush();
+			}
+		}
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(k_log_flush_interval_milliseconds));
+	}
+
+	ThreadCpuMonitor::unregisterCurrentThread();
+}
+
 //-- public implementation -----
 void log_init(const std::string &log_level, const std::string &log_filename)
 {
@@ -56,10 +193,37 @@ void log_init(const std::string &log_level, const std::string &log_filename)
 		g_file_stream = new std::ofstream(log_filename, std::ofstream::out);
 	}
 	g_logger_mutex = new std::mutex();
+
+	// Initialize the ring cells and spin up the background flush thread
+	for (size_t cell_index = 0; cell_index < k_log_ring_capacity; ++cell_index)
+	{
+		g_log_ring[cell_index].sequence.store(cell_index, std::memory_order_relaxed);
+		g_log_ring[cell_index].line.clear();
+	}
+	g_log_enqueue_pos.store(0, std::memory_order_release);
+	g_log_dequeue_pos = 0;
+	g_dropped_line_count.store(0, std::memory_order_release);
+	g_log_flush_shutdown.store(false, std::memory_order_release);
+	g_log_flush_thread = std::thread(log_flush_thread_proc);
+	g_log_flush_thread_started = true;
 }
 
 void log_dispose()
 {
+	// Stop the flush thread, then drain whatever it hadn't written yet
+	if (g_log_flush_thread_started)
+	{
+		g_log_flush_shutdown.store(true, std::memory_order_release);
+		g_log_flush_thread.join();
+		g_log_flush_thread_started = false;
+
+		std::string line;
+		while (log_ring_try_dequeue(line))
+		{
+			log_write_line_to_streams(line);
+		}
+	}
+
 	if (g_console_stream != nullptr)
 	{
 		g_console_stream->flush();
@@ -69,7 +233,7 @@ void log_dispose()
 
 	if (g_file_stream != nullptr)
 	{
-		g_console_stream->flush();
+		g_file_stream->flush();
 		delete g_file_stream;
 		g_file_stream = nullptr;
 	}
@@ -114,16 +278,23 @@ void LoggerStream::write_line()
 {
 	if (m_bEmitLine)
 	{
-		const std::string line = m_lineBuffer.str();
+		std::string line = m_lineBuffer.str();
 
-		if (g_console_stream != nullptr)
+		if (g_log_flush_thread_started)
 		{
-			*g_console_stream << line << std::endl;
+			// Hand the formatted line to the flush thread. The enqueue is
+			// lock-free and never blocks; on overflow the line is dropped
+			// and the flush thread reports the drop count.
+			if (!log_ring_try_enqueue(std::move(line)))
+			{
+				g_dropped_line_count.fetch_add(1, std::memory_order_acq_rel);
+			}
 		}
-
-		if (g_file_stream != nullptr)
+		else
 		{
-			*g_file_stream << line << std::endl;
+			// Logging before log_init/after log_dispose falls back to
+			// writing synchronously on the calling thread
+			log_write_line_to_streams(line);
 		}
 	}
 }
@@ -135,7 +306,7 @@ ThreadSafeLoggerStream::ThreadSafeLoggerStream(bool bEmit) :
 
 void ThreadSafeLoggerStream::write_line()
 {
-	std::lock_guard<std::mutex> lock(*g_logger_mutex);
-
+	// The ring enqueue is multi-producer safe, so no lock is needed anymore.
+	// The class stays so call sites declaring cross-thread intent keep working.
 	LoggerStream::write_line();
 }
\ No newline at end of file
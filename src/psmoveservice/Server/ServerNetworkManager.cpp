@@ -2,21 +2,36 @@
 #include "ServerNetworkManager.h"
 #include "ServerRequestHandler.h"
 #include "ServerLog.h"
+#include "ServerTracer.h"
+#include "ServicePerfCounters.h"
+#include "DeviceDataReadySignal.h"
 #include "packedmessage.h"
+#include "ControllerStreamPacket.h"
 #include "PSMoveProtocolInterface.h"
 #include "PSMoveProtocol.pb.h"
+#include "ProtocolMessageArena.h"
+#include "InlineQueue.h"
 #include <cassert>
 #include <iostream>
 #include <string>
 #include <sstream>
+#include <unordered_map>
 #include <vector>
 #include <deque>
+#include <mutex>
+#include <thread>
 #include <boost/asio.hpp>
 #include <boost/bind.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/cstdint.hpp>
 #include <boost/enable_shared_from_this.hpp>
 
+//-- constants -----
+// Capacity reserved in the TCP response write buffer per connection.
+// Big enough for the largest common responses (controller/tracker lists) so
+// that steady-state packing never touches the allocator.
+static const size_t k_response_write_buffer_reserve_size= 4096;
+
 //-- pre-declarations -----
 using namespace std;
 namespace asio = boost::asio;
@@ -27,8 +42,10 @@ using boost::uint8_t;
 class ClientConnection;
 typedef boost::shared_ptr<ClientConnection> ClientConnectionPtr;
 
-typedef map<int, ClientConnectionPtr> t_client_connection_map;
-typedef map<int, ClientConnectionPtr>::iterator t_client_connection_map_iter;
+// Hashed on the connection id so per-packet response/data-frame routing is a
+// constant time lookup regardless of how many monitoring clients are attached
+typedef unordered_map<int, ClientConnectionPtr> t_client_connection_map;
+typedef unordered_map<int, ClientConnectionPtr>::iterator t_client_connection_map_iter;
 typedef std::pair<int, ClientConnectionPtr> t_id_client_connection_pair;
 
 //-- private implementation -----
@@ -36,6 +53,8 @@ class IServerNetworkEventListener
 {
 public:
 	virtual void handle_client_connection_stopped(int connection_id) = 0;
+	virtual void handle_client_request_received(int connection_id, RequestPtr request) = 0;
+	virtual void handle_udp_data_frame_write_complete() = 0;
 };
 
 // -ClientConnection-
@@ -59,15 +78,13 @@ public:
     static ClientConnectionPtr create(
         IServerNetworkEventListener* network_event_listener,
         asio::io_service& io_service_ref,
-        udp::socket& udp_socket_ref, 
-        ServerRequestHandler &request_handler_ref)
+        udp::socket& udp_socket_ref)
     {
         return ClientConnectionPtr(
             new ClientConnection(
                 network_event_listener, 
                 io_service_ref, 
-                udp_socket_ref, 
-                request_handler_ref));
+                udp_socket_ref));
     }
 
     int get_connection_id() const
@@ -152,16 +169,6 @@ public:
         return m_connection_started && !m_connection_stopped;
     }
 
-    bool has_pending_udp_write() const
-    {
-        return m_connection_started && m_has_pending_udp_write;
-    }
-
-    bool has_queued_controller_data_frames() const
-    {
-        return m_connection_started && m_pending_dataframes.size() > 0;
-    }
-
     void add_tcp_response_to_write_queue(ResponsePtr response)
     {
         m_pending_responses.push_back(response);
@@ -177,25 +184,48 @@ public:
             {
                 if (m_pending_responses.size() > 0)
                 {
-                    ResponsePtr response= m_pending_responses.front();
+                    // Pack every queued response into its own buffer and hand
+                    // asio the whole set as one gathered write - a single
+                    // syscall flushes the entire control channel backlog.
+                    // The gather list is a grow-only member so building it
+                    // doesn't allocate either.
+                    m_gather_buffers.clear();
+
+                    m_tcp_write_response_count= 0;
+                    while (m_tcp_write_response_count < static_cast<int>(m_pending_responses.size()))
+                    {
+                        ResponsePtr response= m_pending_responses[m_tcp_write_response_count];
 
-                    m_packed_response.set_msg(response);
-                    m_packed_response.pack(m_response_write_buffer);
+                        if (m_tcp_write_response_count >= static_cast<int>(m_response_write_buffers.size()))
+                        {
+                            m_response_write_buffers.push_back(data_buffer());
+                            m_response_write_buffers.back().reserve(k_response_write_buffer_reserve_size);
+                        }
 
-                    SERVER_LOG_DEBUG("ClientConnection::start_tcp_write_queued_response") << "Sending TCP response";
-                    SERVER_LOG_DEBUG("   ") << show_hex(m_response_write_buffer);
-                    SERVER_LOG_DEBUG("   ") << m_packed_response.get_msg()->ByteSize() << " bytes";
+                        data_buffer &write_buffer= m_response_write_buffers[m_tcp_write_response_count];
+
+                        m_packed_response.set_msg(response);
+                        m_packed_response.pack(write_buffer);
+
+                        SERVER_LOG_DEBUG("ClientConnection::start_tcp_write_queued_response") << "Sending TCP response";
+                        SERVER_LOG_DEBUG("   ") << show_hex(write_buffer);
+                        SERVER_LOG_DEBUG("   ") << m_packed_response.get_msg()->ByteSize() << " bytes";
+
+                        m_gather_buffers.push_back(boost::asio::buffer(write_buffer));
+
+                        ++m_tcp_write_response_count;
+                    }
 
                     // The queue should prevent us from writing more than one request as once
                     assert(!m_has_pending_tcp_write);
                     m_has_pending_tcp_write= true;
                     write_in_progress= true;
 
-                    // Start an asynchronous operation to send a heartbeat message.
-                    // NOTE: Even if the write completes immediate, the callback will only be called from io_service::poll()
+                    // Start an asynchronous operation to send the responses.
+                    // NOTE: The completion callback runs on the network io thread
                     boost::asio::async_write(
                         m_tcp_socket, 
-                        boost::asio::buffer(m_response_write_buffer),
+                        m_gather_buffers,
                         boost::bind(&ClientConnection::handle_write_response_complete, this, _1));
                 }
             }
@@ -210,7 +240,26 @@ public:
     
     void add_device_data_frame_to_write_queue(DeviceOutputDataFramePtr data_frame)
     {
-        m_pending_dataframes.push_back(data_frame);
+        PendingDataFrame pending_dataframe;
+
+        pending_dataframe.protobuf_frame= data_frame;
+        m_pending_dataframes.push_back(pending_dataframe);
+    }
+
+    void add_controller_stream_packet_to_write_queue(ControllerStreamPacketPtr packet)
+    {
+        PendingDataFrame pending_dataframe;
+
+        pending_dataframe.stream_packet= packet;
+        m_pending_dataframes.push_back(pending_dataframe);
+    }
+
+    void add_controller_stream_delta_to_write_queue(ControllerStreamDeltaBufferPtr delta_buffer)
+    {
+        PendingDataFrame pending_dataframe;
+
+        pending_dataframe.delta_buffer= delta_buffer;
+        m_pending_dataframes.push_back(pending_dataframe);
     }
 
     bool start_udp_write_queued_device_data_frame()
@@ -223,33 +272,120 @@ public:
             {
                 if (m_pending_dataframes.size() > 0)
                 {
-                    DeviceOutputDataFramePtr dataframe= m_pending_dataframes.front();
+                    // Coalesce as many queued data frames as fit into one datagram.
+                    // Each record keeps its own length header so the receiver can
+                    // walk the records until the datagram is exhausted.
+                    int total_size= 0;
 
-                    m_packed_output_dataframe.set_msg(dataframe);
-                    if (m_packed_output_dataframe.pack(m_output_dataframe_buffer, sizeof(m_output_dataframe_buffer)))
+                    m_udp_write_dataframe_count= 0;
+                    while (m_udp_write_dataframe_count < static_cast<int>(m_pending_dataframes.size()))
                     {
-                        int msg_size= m_packed_output_dataframe.get_msg()->ByteSize();
+                        const PendingDataFrame &pending_dataframe= m_pending_dataframes[m_udp_write_dataframe_count];
+
+                        if (pending_dataframe.stream_packet)
+                        {
+                            // Fixed-layout controller stream packet.
+                            // Copied straight into the datagram behind a length header.
+                            const int packed_size= HEADER_SIZE + static_cast<int>(sizeof(ControllerStreamPacket));
+
+                            if (total_size + packed_size >= static_cast<int>(sizeof(m_output_dataframe_buffer)))
+                            {
+                                // Datagram is full. The rest go out in the next one.
+                                break;
+                            }
+
+                            uint8_t *record= m_output_dataframe_buffer + total_size;
+
+                            record[0]= static_cast<uint8_t>((sizeof(ControllerStreamPacket) >> 24) & 0xFF);
+                            record[1]= static_cast<uint8_t>((sizeof(ControllerStreamPacket) >> 16) & 0xFF);
+                            record[2]= static_cast<uint8_t>((sizeof(ControllerStreamPacket) >> 8) & 0xFF);
+                            record[3]= static_cast<uint8_t>(sizeof(ControllerStreamPacket) & 0xFF);
+                            memcpy(record + HEADER_SIZE, pending_dataframe.stream_packet.get(), sizeof(ControllerStreamPacket));
+
+                            total_size+= packed_size;
+                        }
+                        else if (pending_dataframe.delta_buffer)
+                        {
+                            // Delta-encoded controller stream record.
+                            // Already packed by the request handler - copied
+                            // into the datagram behind a length header.
+                            const int delta_size= static_cast<int>(pending_dataframe.delta_buffer->size());
+                            const int packed_size= HEADER_SIZE + delta_size;
+
+                            if (total_size + packed_size >= static_cast<int>(sizeof(m_output_dataframe_buffer)))
+                            {
+                                // Datagram is full. The rest go out in the next one.
+                                break;
+                            }
+
+                            uint8_t *record= m_output_dataframe_buffer + total_size;
+
+                            record[0]= static_cast<uint8_t>((delta_size >> 24) & 0xFF);
+                            record[1]= static_cast<uint8_t>((delta_size >> 16) & 0xFF);
+                            record[2]= static_cast<uint8_t>((delta_size >> 8) & 0xFF);
+                            record[3]= static_cast<uint8_t>(delta_size & 0xFF);
+                            memcpy(record + HEADER_SIZE, pending_dataframe.delta_buffer->data(), delta_size);
+
+                            total_size+= packed_size;
+                        }
+                        else
+                        {
+                            // Protobuf data frame
+                            m_packed_output_dataframe.set_msg(pending_dataframe.protobuf_frame);
+
+                            const int packed_size= HEADER_SIZE + m_packed_output_dataframe.get_msg()->ByteSize();
+
+                            if (total_size + packed_size >= static_cast<int>(sizeof(m_output_dataframe_buffer)))
+                            {
+                                // Datagram is full. The rest go out in the next one.
+                                break;
+                            }
+
+                            if (!m_packed_output_dataframe.pack(
+                                    m_output_dataframe_buffer + total_size,
+                                    sizeof(m_output_dataframe_buffer) - total_size))
+                            {
+                                break;
+                            }
+
+                            total_size+= packed_size;
+                        }
+
+                        ++m_udp_write_dataframe_count;
+                    }
 
-                        SERVER_LOG_DEBUG("ClientConnection::start_udp_write_queued_device_data_frame") << "Sending UDP DataFrame";
-                        SERVER_LOG_DEBUG("   ") << show_hex(m_output_dataframe_buffer, HEADER_SIZE+msg_size);
-                        SERVER_LOG_DEBUG("   ") << msg_size << " bytes";
+                    if (m_udp_write_dataframe_count > 0)
+                    {
+                        SERVER_LOG_DEBUG("ClientConnection::start_udp_write_queued_device_data_frame")
+                            << "Sending UDP datagram with " << m_udp_write_dataframe_count << " DataFrame(s)";
+                        SERVER_LOG_DEBUG("   ") << show_hex(m_output_dataframe_buffer, total_size);
+                        SERVER_LOG_DEBUG("   ") << total_size << " bytes";
 
-                        // The queue should prevent us from writing more than one data frame at once
+                        // The queue should prevent us from writing more than one datagram at once
                         assert(!m_has_pending_udp_write);
                         m_has_pending_udp_write= true;
                         write_in_progress= true;
 
-                        // Start an asynchronous operation to send the data frame
-                        // NOTE: Even if the write completes immediate, the callback will only be called from io_service::poll()
+                        ServicePerfCounters::increment(ServicePerfCounters::Counter_UdpDatagramsSent);
+                        ServicePerfCounters::increment(
+                            ServicePerfCounters::Counter_UdpDataFramesSent,
+                            static_cast<uint64_t>(m_udp_write_dataframe_count));
+
+                        // Start an asynchronous operation to send the data frames
+                        // NOTE: The completion callback runs on the network io thread
                         m_udp_socket_ref.async_send_to(
-                            boost::asio::buffer(m_output_dataframe_buffer, sizeof(m_output_dataframe_buffer)),
+                            boost::asio::buffer(m_output_dataframe_buffer, total_size),
                             m_udp_remote_endpoint,
                             boost::bind(&ClientConnection::handle_udp_write_device_data_frame_complete, this, _1));
                     }
                     else
                     {
-                        SERVER_LOG_ERROR("ClientConnection::start_udp_write_queued_device_data_frame") 
-                            << "DataFrame too big to fit in packet!";
+                        // A single data frame that can't fit in a datagram would
+                        // wedge the queue forever - drop it instead
+                        SERVER_LOG_ERROR("ClientConnection::start_udp_write_queued_device_data_frame")
+                            << "DataFrame too big to fit in packet! Dropping.";
+                        m_pending_dataframes.pop_front();
+                        ServicePerfCounters::increment(ServicePerfCounters::Counter_UdpDataFramesDropped);
                     }
                 }
             }
@@ -269,7 +405,6 @@ private:
 
     int m_connection_id;
 
-    ServerRequestHandler &m_request_handler_ref;
     tcp::socket m_tcp_socket;
     udp::socket &m_udp_socket_ref;
     udp::endpoint m_udp_remote_endpoint;
@@ -278,14 +413,40 @@ private:
     vector<uint8_t> m_request_read_buffer;
     PackedMessage<PSMoveProtocol::Request> m_packed_request;
 
-    vector<uint8_t> m_response_write_buffer;
+    // One packed buffer per response coalesced into the in-flight gathered
+    // write. The vector only ever grows so the buffers keep their capacity
+    // across writes.
+    vector<data_buffer> m_response_write_buffers;
     PackedMessage<PSMoveProtocol::Response> m_packed_response;
 
-    uint8_t m_output_dataframe_buffer[HEADER_SIZE+MAX_OUTPUT_DATA_FRAME_MESSAGE_SIZE];
+    // Grow-only scratch list of asio buffer views for the gathered write
+    vector<boost::asio::const_buffer> m_gather_buffers;
+
+    // Number of queued responses coalesced into the in-flight gathered write,
+    // popped off the pending queue when the send completes
+    int m_tcp_write_response_count;
+
+    uint8_t m_output_dataframe_buffer[MAX_OUTPUT_DATA_FRAME_DATAGRAM_SIZE];
     PackedMessage<PSMoveProtocol::DeviceOutputDataFrame> m_packed_output_dataframe;
 
-    deque<ResponsePtr> m_pending_responses;
-    deque<DeviceOutputDataFramePtr> m_pending_dataframes;
+    // Number of queued data frames coalesced into the in-flight datagram,
+    // popped off the pending queue when the send completes
+    int m_udp_write_dataframe_count;
+
+    // A queued data frame is either a protobuf frame (trackers and HMDs),
+    // a fixed-layout controller stream packet or a delta-encoded stream record
+    struct PendingDataFrame
+    {
+        DeviceOutputDataFramePtr protobuf_frame;
+        ControllerStreamPacketPtr stream_packet;
+        ControllerStreamDeltaBufferPtr delta_buffer;
+    };
+
+    // Queues drained by the gathered TCP/UDP writes. Backlogs are nearly
+    // always a handful of entries, so the inline storage keeps the per-tick
+    // send path off the heap entirely.
+    InlineQueue<ResponsePtr, 16> m_pending_responses;
+    InlineQueue<PendingDataFrame, 32> m_pending_dataframes;
     
     bool m_connection_started;
     bool m_connection_stopped;
@@ -295,20 +456,21 @@ private:
     ClientConnection(
         IServerNetworkEventListener *network_event_listener,
         asio::io_service& io_service_ref,
-        udp::socket& udp_socket_ref , 
-        ServerRequestHandler &request_handler_ref)
+        udp::socket& udp_socket_ref)
         : m_network_event_listener(network_event_listener)
         , m_connection_id(next_connection_id)
-        , m_request_handler_ref(request_handler_ref)
         , m_tcp_socket(io_service_ref)
         , m_udp_socket_ref(udp_socket_ref)
         , m_udp_remote_endpoint()
         , m_is_udp_remote_endpoint_bound(false)
         , m_request_read_buffer()
-        , m_packed_request(std::shared_ptr<PSMoveProtocol::Request>(new PSMoveProtocol::Request()))
-        , m_response_write_buffer()
+        , m_packed_request(allocate_message_on_arena<PSMoveProtocol::Request>())
+        , m_response_write_buffers()
         , m_packed_response()
+        , m_gather_buffers()
+        , m_tcp_write_response_count(0)
         , m_packed_output_dataframe()
+        , m_udp_write_dataframe_count(0)
         , m_pending_responses()
         , m_pending_dataframes()
         , m_connection_started(false)
@@ -317,6 +479,13 @@ private:
         , m_has_pending_udp_write(false)
     {
         memset(m_output_dataframe_buffer, 0, sizeof(m_output_dataframe_buffer));
+
+        // pack() resizes the write buffer to fit each response. Reserving the
+        // capacity up front means those resizes just adjust the logical size
+        // instead of reallocating on the streaming path.
+        m_response_write_buffers.push_back(data_buffer());
+        m_response_write_buffers.back().reserve(k_response_write_buffer_reserve_size);
+
         next_connection_id++;
     }
 
@@ -420,8 +589,9 @@ private:
     }
 
     // Called when enough data was read into m_readbuf for a complete request
-    // message. 
-    // Parse the request, execute it and send back a response.
+    // message.
+    // Parse the request and hand it off to the main thread for processing.
+    // The response comes back later through a posted send.
     //
     void handle_tcp_request()
     {
@@ -429,21 +599,19 @@ private:
         {
             RequestPtr request = m_packed_request.get_msg();
 
-            SERVER_LOG_DEBUG("ClientConnection::handle_tcp_request") 
-                << "Handle request type " << request->request_id() 
+            SERVER_LOG_DEBUG("ClientConnection::handle_tcp_request")
+                << "Handle request type " << request->request_id()
                 << " on connection id to client " << m_connection_id;
 
-            ResponsePtr response = m_request_handler_ref.handle_request(m_connection_id, request);            
-            if (response)
-            {
-                add_tcp_response_to_write_queue(response);
-            }
+            m_network_event_listener->handle_client_request_received(m_connection_id, request);
 
-            start_tcp_write_queued_response();
+            // The queued request keeps a reference to the parsed message,
+            // so give the unpacker a fresh arena-backed one for the next request
+            m_packed_request.set_msg(allocate_message_on_arena<PSMoveProtocol::Request>());
         }
         else
         {
-            SERVER_LOG_ERROR("ClientConnection::handle_tcp_request") 
+            SERVER_LOG_ERROR("ClientConnection::handle_tcp_request")
                 << "Failed to parse request on connection " << m_connection_id;
             stop();
         }
@@ -462,10 +630,14 @@ private:
             // no longer is there a pending write
             m_has_pending_tcp_write= false;
 
-            // Remove the response from the pending send queue now that it's sent
-            m_pending_responses.pop_front();
+            // Remove the responses that went out in the gathered write
+            while (m_tcp_write_response_count > 0 && m_pending_responses.size() > 0)
+            {
+                m_pending_responses.pop_front();
+                --m_tcp_write_response_count;
+            }
 
-            // If there are more requests waiting to be sent, start sending the next one
+            // If more responses queued up while the write was in flight, flush them
             start_tcp_write_queued_response();
         }
         else
@@ -489,8 +661,15 @@ private:
             // no longer is there a pending write
             m_has_pending_udp_write= false;
 
-            // Remove the dataframe from the pending send queue now that it's sent
-            m_pending_dataframes.pop_front();
+            // Remove the coalesced dataframes from the pending send queue now that they're sent
+            while (m_udp_write_dataframe_count > 0 && m_pending_dataframes.size() > 0)
+            {
+                m_pending_dataframes.pop_front();
+                --m_udp_write_dataframe_count;
+            }
+
+            // Give the network manager a chance to start the next queued write
+            m_network_event_listener->handle_udp_data_frame_write_complete();
         }
         else
         {
@@ -511,13 +690,21 @@ public:
     ServerNetworkManagerImpl(asio::io_service &io_service, unsigned int port, ServerRequestHandler &requestHandler)
         : m_request_handler_ref(requestHandler)
         , m_io_service(io_service)
-        , m_tcp_acceptor(m_io_service, tcp::endpoint(tcp::v4(), port))
-        , m_udp_socket(m_io_service, udp::endpoint(udp::v4(), port))
+        , m_port(port)
+        , m_tcp_acceptor(m_io_service)
+        , m_udp_socket(m_io_service)
         , m_udp_connecting_remote_endpoint()
         , m_packed_input_dataframe(std::shared_ptr<PSMoveProtocol::DeviceInputDataFrame>(new PSMoveProtocol::DeviceInputDataFrame()))
         , m_udp_connection_result_write_buffer(false)
         , m_has_pending_udp_read(false)
         , m_connections()
+        , m_udp_bound_connections()
+        , m_inbound_message_mutex()
+        , m_inbound_messages()
+        , m_io_thread()
+        , m_embedded_mode(false)
+        , m_embedded_response_sink(nullptr)
+        , m_embedded_response_sink_userdata(nullptr)
     {
         memset(m_input_dataframe_buffer, 0, sizeof(m_input_dataframe_buffer));
     }
@@ -536,16 +723,24 @@ public:
     void start_connection_accept()
     {
         SERVER_LOG_DEBUG("ServerNetworkManager::start_tcp_accept") << "Start waiting for a new TCP connection";
-        
+
+        // Bind the listen sockets now rather than in the constructor so that
+        // an embedded (in-process) network manager never claims the port
+        m_tcp_acceptor.open(tcp::v4());
+        m_tcp_acceptor.set_option(tcp::acceptor::reuse_address(true));
+        m_tcp_acceptor.bind(tcp::endpoint(tcp::v4(), m_port));
+        m_tcp_acceptor.listen();
+        m_udp_socket.open(udp::v4());
+        m_udp_socket.bind(udp::endpoint(udp::v4(), m_port));
+
         // Create a new connection to handle a client.
-        // Passing a reference to a request handler to each connection poses no problem 
-        // since the server is single-threaded.
+        // Connections only ever get touched on the network thread - requests
+        // are queued off to the main thread through the event listener.
         ClientConnectionPtr new_connection = 
             ClientConnection::create(
                 this, 
                 m_tcp_acceptor.get_io_service(), 
-                m_udp_socket, 
-                m_request_handler_ref);
+                m_udp_socket);
 
         // Add the connection to the list
         t_id_client_connection_pair map_entry(new_connection->get_connection_id(), new_connection);
@@ -562,29 +757,65 @@ public:
         start_udp_read_input_data_frame();
     }
 
-    void poll()
+    void start_network_thread()
     {
-        bool keep_polling= true;
-        int iteration_count= 0;
-        const static int k_max_iteration_count= 32;
+        SERVER_LOG_INFO("ServerNetworkManager::start_network_thread") << "Starting the network io thread";
+
+        // All socket callbacks execute on this thread from here on out.
+        // The run() call is kept alive between callbacks by the pending
+        // accept/read operations (and the signal handler registered by the service).
+        m_io_thread= std::thread(&ServerNetworkManagerImpl::run_network_thread, this);
+    }
 
-        while (keep_polling && iteration_count < k_max_iteration_count)
+    void stop_network_thread()
+    {
+        if (m_io_thread.joinable())
         {
-            // Start any pending writes on the UDP socket that can be started
-            start_udp_queued_data_frame_write();
+            SERVER_LOG_INFO("ServerNetworkManager::stop_network_thread") << "Stopping the network io thread";
 
-            // This call can execute any of the following callbacks:
-            // * TCP request has finished reading
-            // * TCP response has finished writing
-            // * UDP data frame has finished writing
-            m_io_service.poll();
+            // Abandon any outstanding async operations 
+            // (including the signal handler's async_wait) so run() returns
+            m_io_service.stop();
+            m_io_thread.join();
+        }
+    }
+
+    /// Called once per service update() on the main thread.
+    /// Drains the messages the network thread queued since the last update
+    /// and hands them to the request handler.
+    void process_inbound_messages()
+    {
+        InlineQueue<InboundClientMessage, 16> messages;
 
-            // In the event that a UDP data frame write completed immediately,
-            // we should start another UDP data frame write.
-            keep_polling= has_queued_controller_data_frames_ready_to_start();
+        {
+            std::lock_guard<std::mutex> lock(m_inbound_message_mutex);
 
-            // ... but don't re-run this too many times
-            ++iteration_count;
+            messages.swap(m_inbound_messages);
+        }
+
+        for (int message_index= 0; message_index < messages.size(); ++message_index)
+        {
+            const InboundClientMessage &message= messages[message_index];
+
+            switch (message.message_type)
+            {
+            case InboundClientMessage::_request:
+                {
+                    ResponsePtr response= m_request_handler_ref.handle_request(message.connection_id, message.request);
+
+                    if (response)
+                    {
+                        send_response(message.connection_id, response);
+                    }
+                }
+                break;
+            case InboundClientMessage::_input_data_frame:
+                m_request_handler_ref.handle_input_data_frame(message.data_frame);
+                break;
+            case InboundClientMessage::_connection_stopped:
+                m_request_handler_ref.handle_client_connection_stopped(message.connection_id);
+                break;
+            }
         }
     }
 
@@ -622,15 +853,110 @@ public:
         }
 
         m_connections.clear();
+        m_udp_bound_connections.clear();
+    }
+
+    void set_embedded_mode(bool bEmbedded)
+    {
+        m_embedded_mode= bEmbedded;
+    }
+
+    void set_embedded_response_sink(ServerNetworkManager::t_embedded_response_sink sink, void *userdata)
+    {
+        m_embedded_response_sink= sink;
+        m_embedded_response_sink_userdata= userdata;
     }
 
     void send_notification(int connection_id, ResponsePtr response)
     {
-        t_client_connection_map_iter entry = m_connections.find(connection_id);
+        // Notifications have an invalid response ID
+        response->set_request_id(-1);
+
+        if (m_embedded_mode)
+        {
+            deliver_embedded_response(response);
+            return;
+        }
 
+        // The connection map and sockets belong to the network thread
+        m_io_service.post(boost::bind(&ServerNetworkManagerImpl::send_response_internal, this, connection_id, response));
+    }
+
+    void send_notification_to_all_clients(ResponsePtr response)
+    {
         // Notifications have an invalid response ID
         response->set_request_id(-1);
-        
+
+        if (m_embedded_mode)
+        {
+            deliver_embedded_response(response);
+            return;
+        }
+
+        m_io_service.post(boost::bind(&ServerNetworkManagerImpl::send_response_to_all_clients_internal, this, response));
+    }
+
+    void send_response(int connection_id, ResponsePtr response)
+    {
+        if (m_embedded_mode)
+        {
+            deliver_embedded_response(response);
+            return;
+        }
+
+        m_io_service.post(boost::bind(&ServerNetworkManagerImpl::send_response_internal, this, connection_id, response));
+    }
+
+    void send_device_data_frame(int connection_id, DeviceOutputDataFramePtr data_frame)
+    {
+        // Embedded clients read device state through the shared memory
+        // streams, so network data frames have nowhere to go
+        if (m_embedded_mode)
+        {
+            return;
+        }
+
+        m_io_service.post(boost::bind(&ServerNetworkManagerImpl::send_device_data_frame_internal, this, connection_id, data_frame));
+    }
+
+    void send_controller_stream_packet(int connection_id, ControllerStreamPacketPtr packet)
+    {
+        if (m_embedded_mode)
+        {
+            return;
+        }
+
+        m_io_service.post(boost::bind(&ServerNetworkManagerImpl::send_controller_stream_packet_internal, this, connection_id, packet));
+    }
+
+    void send_controller_stream_delta(int connection_id, ControllerStreamDeltaBufferPtr delta_buffer)
+    {
+        if (m_embedded_mode)
+        {
+            return;
+        }
+
+        m_io_service.post(boost::bind(&ServerNetworkManagerImpl::send_controller_stream_delta_internal, this, connection_id, delta_buffer));
+    }
+
+    void deliver_embedded_response(ResponsePtr response)
+    {
+        if (m_embedded_response_sink != nullptr)
+        {
+            m_embedded_response_sink(response, m_embedded_response_sink_userdata);
+        }
+        else
+        {
+            SERVER_LOG_DEBUG("ServerNetworkManager::send_notification")
+                << "Dropping response_type " << response->type()
+                << " - no embedded response sink registered";
+        }
+    }
+
+    void send_response_internal(int connection_id, ResponsePtr response)
+    {
+        t_client_connection_map_iter entry = m_connections.find(connection_id);
+
         if (entry != m_connections.end())
         {
             ClientConnectionPtr connection= entry->second;
@@ -650,14 +976,11 @@ public:
         }
     }
 
-    void send_notification_to_all_clients(ResponsePtr response)
+    void send_response_to_all_clients_internal(ResponsePtr response)
     {
         SERVER_LOG_DEBUG("ServerNetworkManager::send_notification") 
             << "Sending response_type " << response->type() << "to all clients";
 
-        // Notifications have an invalid response ID
-        response->set_request_id(-1);
-
         for (t_client_connection_map_iter iter= m_connections.begin(); iter != m_connections.end(); ++iter)
         {
             ClientConnectionPtr connection= iter->second;
@@ -670,8 +993,10 @@ public:
         }
     }
 
-    void send_device_data_frame(int connection_id, DeviceOutputDataFramePtr data_frame)
+    void send_device_data_frame_internal(int connection_id, DeviceOutputDataFramePtr data_frame)
     {
+        SERVER_TRACE_SCOPE("ClientConnection::send_device_data_frame");
+
         t_client_connection_map_iter entry = m_connections.find(connection_id);
 
         if (entry != m_connections.end())
@@ -687,11 +1012,55 @@ public:
         }
         else
         {
-            SERVER_LOG_ERROR("ServerNetworkManager::send_device_data_frame") 
+            SERVER_LOG_ERROR("ServerNetworkManager::send_device_data_frame")
                 << "Can't send data_frame to unknown connection " << connection_id;
         }
     }
 
+    void send_controller_stream_packet_internal(int connection_id, ControllerStreamPacketPtr packet)
+    {
+        t_client_connection_map_iter entry = m_connections.find(connection_id);
+
+        if (entry != m_connections.end())
+        {
+            ClientConnectionPtr connection= entry->second;
+
+            SERVER_LOG_TRACE("ServerNetworkManager::send_controller_stream_packet")
+                << "Sending stream packet to connection " << connection_id;
+
+            connection->add_controller_stream_packet_to_write_queue(packet);
+
+            start_udp_queued_data_frame_write();
+        }
+        else
+        {
+            SERVER_LOG_ERROR("ServerNetworkManager::send_controller_stream_packet")
+                << "Can't send stream packet to unknown connection " << connection_id;
+        }
+    }
+
+    void send_controller_stream_delta_internal(int connection_id, ControllerStreamDeltaBufferPtr delta_buffer)
+    {
+        t_client_connection_map_iter entry = m_connections.find(connection_id);
+
+        if (entry != m_connections.end())
+        {
+            ClientConnectionPtr connection= entry->second;
+
+            SERVER_LOG_TRACE("ServerNetworkManager::send_controller_stream_delta")
+                << "Sending stream delta to connection " << connection_id;
+
+            connection->add_controller_stream_delta_to_write_queue(delta_buffer);
+
+            start_udp_queued_data_frame_write();
+        }
+        else
+        {
+            SERVER_LOG_ERROR("ServerNetworkManager::send_controller_stream_delta")
+                << "Can't send stream delta to unknown connection " << connection_id;
+        }
+    }
+
     // -- IServerNetworkEventListener ----
 	virtual void handle_client_connection_stopped(int connection_id) override
     {
@@ -702,17 +1071,69 @@ public:
             m_connections.erase(entry);
         }
 
-        // Tell the request handler to clean up any state associated with this connection
-        m_request_handler_ref.handle_client_connection_stopped(connection_id);
+        for (auto iter= m_udp_bound_connections.begin(); iter != m_udp_bound_connections.end(); ++iter)
+        {
+            if ((*iter)->get_connection_id() == connection_id)
+            {
+                m_udp_bound_connections.erase(iter);
+                break;
+            }
+        }
+
+        // Queue the disconnect so that the request handler cleans up
+        // any state associated with this connection on the main thread
+        InboundClientMessage message;
+        message.message_type= InboundClientMessage::_connection_stopped;
+        message.connection_id= connection_id;
+
+        enqueue_inbound_message(message);
+    }
+
+	virtual void handle_client_request_received(int connection_id, RequestPtr request) override
+    {
+        // Queue the request for the main thread - the request handler
+        // touches device state that the network thread doesn't own
+        InboundClientMessage message;
+        message.message_type= InboundClientMessage::_request;
+        message.connection_id= connection_id;
+        message.request= request;
+
+        enqueue_inbound_message(message);
+    }
+
+	virtual void handle_udp_data_frame_write_complete() override
+    {
+        // The UDP socket is free again - start the next queued data frame write
+        start_udp_queued_data_frame_write();
     }
 
 private:
+    // A message received on the network thread waiting 
+    // to be processed on the main thread
+    struct InboundClientMessage
+    {
+        enum eMessageType
+        {
+            _request,
+            _input_data_frame,
+            _connection_stopped
+        };
+
+        eMessageType message_type;
+        int connection_id;
+        RequestPtr request;
+        DeviceInputDataFramePtr data_frame;
+    };
+
     // Process and responds to incoming PSMoveService request
     ServerRequestHandler &m_request_handler_ref;
     
     // Core i/o functionality for TCP/UDP sockets
     asio::io_service &m_io_service;
-    
+
+    // Port the listen sockets bind to in start_connection_accept()
+    unsigned int m_port;
+
     // Handles waiting for and accepting new TCP connections
     tcp::acceptor m_tcp_acceptor;
 
@@ -734,8 +1155,46 @@ private:
 
     // A mapping from connection_id -> ClientConnectionPtr
     t_client_connection_map m_connections;
+    // Dense list of connections with a bound UDP endpoint (i.e. active
+    // streamers). The per-tick data frame scheduling walks this instead of
+    // every accepted connection - most extra clients are TCP-only monitors.
+    vector<ClientConnectionPtr> m_udp_bound_connections;
+
+    // Messages queued by the network thread for the main thread
+    std::mutex m_inbound_message_mutex;
+    InlineQueue<InboundClientMessage, 16> m_inbound_messages;
+
+    // The thread that services all of the socket i/o
+    std::thread m_io_thread;
+
+    // True when hosted in-process by an EmbeddedServiceHost: no sockets are
+    // bound, no network thread runs, and outbound responses/notifications
+    // are handed to the embedded response sink on the calling thread
+    bool m_embedded_mode;
+    ServerNetworkManager::t_embedded_response_sink m_embedded_response_sink;
+    void *m_embedded_response_sink_userdata;
 
 protected:
+    void run_network_thread()
+    {
+        m_io_service.run();
+
+        SERVER_LOG_INFO("ServerNetworkManager::run_network_thread") << "Network io thread halted";
+    }
+
+    void enqueue_inbound_message(const InboundClientMessage &message)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_inbound_message_mutex);
+
+            m_inbound_messages.push_back(message);
+        }
+
+        // Wake the service thread so the request is handled now rather than
+        // at the next tick boundary
+        DeviceDataReadySignal::notifyDataReady();
+    }
+
     void handle_tcp_accept(ClientConnectionPtr connection, const boost::system::error_code& error)
     {        
         // A new client has connected
@@ -832,12 +1291,26 @@ protected:
                     // Associate this udp remote endpoint with the given connection id
                     connection->bind_udp_remote_endpoint(m_udp_connecting_remote_endpoint);
 
+                    // The connection is now an active streamer - add it to the
+                    // dense list the data frame scheduling iterates
+                    m_udp_bound_connections.push_back(connection);
+
                     // Tell the client that this was a valid connection id
                     start_udp_send_connection_result(true);
                 }
 
-                // Process the incoming data frame
-                m_request_handler_ref.handle_input_data_frame(data_frame);
+                // Queue the incoming data frame for the main thread
+                InboundClientMessage message;
+                message.message_type= InboundClientMessage::_input_data_frame;
+                message.connection_id= data_frame->connection_id();
+                message.data_frame= data_frame;
+
+                enqueue_inbound_message(message);
+
+                // The queued data frame keeps a reference to the parsed message,
+                // so give the unpacker a fresh one for the next data frame
+                m_packed_input_dataframe.set_msg(
+                    DeviceInputDataFramePtr(new PSMoveProtocol::DeviceInputDataFrame()));
             }
             else 
             {
@@ -880,45 +1353,21 @@ protected:
 
     void start_udp_queued_data_frame_write()
     {
-        for (t_client_connection_map_iter iter= m_connections.begin(); iter != m_connections.end(); ++iter)
+        // Only connections with a bound UDP endpoint can have queued data
+        // frames, so skip the TCP-only monitoring clients entirely
+        for (auto iter= m_udp_bound_connections.begin(); iter != m_udp_bound_connections.end(); ++iter)
         {
-            ClientConnectionPtr connection= iter->second;
+            ClientConnectionPtr connection= *iter;
 
             if (connection->start_udp_write_queued_device_data_frame())
             {
-                SERVER_LOG_TRACE("ServerNetworkManager::start_udp_queued_data_frame_write") 
-                    << "Send queued UDP data on connection id: " << iter->first;
-
-                // Don't start a write on any other connection until this one is finished 
-                break;
-            }
-        }        
-    }
-
-    bool has_queued_controller_data_frames_ready_to_start()
-    {
-        bool has_queued_write_ready_to_start= false;
-        bool udp_socket_available= true;
-
-        for (t_client_connection_map_iter iter= m_connections.begin(); iter != m_connections.end(); ++iter)
-        {
-            ClientConnectionPtr connection= iter->second;
+                SERVER_LOG_TRACE("ServerNetworkManager::start_udp_queued_data_frame_write")
+                    << "Send queued UDP data on connection id: " << connection->get_connection_id();
 
-            if (connection->has_pending_udp_write())
-            {
-                // Can't start any new udp write until any current udp write is done
-                udp_socket_available= false;
+                // Don't start a write on any other connection until this one is finished
                 break;
             }
-
-            if (connection->has_queued_controller_data_frames())
-            {
-                // Found a connection with a pending udp write ready to go
-                has_queued_write_ready_to_start= true;
-            }
         }
-
-        return udp_socket_available && has_queued_write_ready_to_start;
     }
 };
 
@@ -953,23 +1402,58 @@ bool ServerNetworkManager::startup()
     m_instance= this;
     
     implementation_ptr->start_connection_accept();
+    implementation_ptr->start_network_thread();
+
+    return true;
+}
+
+bool ServerNetworkManager::startup_embedded()
+{
+    m_instance= this;
+
+    // No sockets get bound and no network thread starts - requests arrive by
+    // direct handle_request() calls and outbound traffic goes to the sink
+    implementation_ptr->set_embedded_mode(true);
 
     return true;
 }
 
+void ServerNetworkManager::set_embedded_response_sink(t_embedded_response_sink sink, void *userdata)
+{
+    implementation_ptr->set_embedded_response_sink(sink, userdata);
+}
+
 void ServerNetworkManager::update()
 {
-    implementation_ptr->poll();
+    implementation_ptr->process_inbound_messages();
 }
 
 void ServerNetworkManager::shutdown()
 {
-    
+    // Halt the network thread before touching the connections from this thread
+    implementation_ptr->stop_network_thread();
     implementation_ptr->close_all_connections();
+
+    // Deliver any final connection-stopped cleanup to the request handler
+    implementation_ptr->process_inbound_messages();
     
     m_instance= NULL;
 }
 
+void ServerNetworkManager::shutdown_embedded()
+{
+    // There are no sockets or network thread to tear down
+    implementation_ptr->set_embedded_response_sink(nullptr, nullptr);
+    implementation_ptr->set_embedded_mode(false);
+
+    m_instance= NULL;
+}
+
+void ServerNetworkManager::send_response(int connection_id, ResponsePtr response)
+{
+    implementation_ptr->send_response(connection_id, response);
+}
+
 void ServerNetworkManager::send_notification(int connection_id, ResponsePtr response)
 {
     implementation_ptr->send_notification(connection_id, response);
@@ -984,3 +1468,13 @@ void ServerNetworkManager::send_device_data_frame(int connection_id, DeviceOutpu
 {
     implementation_ptr->send_device_data_frame(connection_id, data_frame);
 }
+
+void ServerNetworkManager::send_controller_stream_packet(int connection_id, ControllerStreamPacketPtr packet)
+{
+    implementation_ptr->send_controller_stream_packet(connection_id, packet);
+}
+
+void ServerNetworkManager::send_controller_stream_delta(int connection_id, ControllerStreamDeltaBufferPtr delta_buffer)
+{
+    implementation_ptr->send_controller_stream_delta(connection_id, delta_buffer);
+}
@@ -2,6 +2,7 @@
 #define SERVER_NETWORK_MANAGER_H
 
 //-- includes -----
+#include "ControllerStreamPacket.h"
 #include "PSMoveProtocolInterface.h"
 
 //-- pre-declarations -----
@@ -31,30 +32,56 @@ public:
 
     static ServerNetworkManager *get_instance() { return m_instance; }
 
+    /// Callback an in-process client registers to receive the responses and
+    /// notifications that would otherwise be written to its TCP socket
+    typedef void (*t_embedded_response_sink)(ResponsePtr response, void *userdata);
+
     /// Called first by PSMoveService::startup()
     /**
-     Calls ServerNetworkManagerImpl::start_connection_accept()
+     Starts accepting connections and spins up the network io thread
      */
     bool startup();
-    
+
+    /// Called by EmbeddedServiceHost::startup() instead of startup()
+    /**
+     Makes this the active network manager singleton without binding any
+     sockets or starting the network io thread. Responses and notifications
+     get handed to the embedded response sink on the calling thread; device
+     data frames are dropped since embedded clients read device state
+     through the shared memory streams.
+     */
+    bool startup_embedded();
+
+    /// Registers the in-process client's response/notification sink
+    void set_embedded_response_sink(t_embedded_response_sink sink, void *userdata);
+
     /// Called last by PSMoveService::update()
     /**
-     Calls ServerNetworkManagerImpl::poll()
+     Processes requests and data frames queued by the network io thread
      */
     void update();
     
     /// Called last by PSMoveService::shutdown()
     /**
-     Calls ServerNetworkManagerImpl::close_all_connections()
+     Halts the network io thread and closes all client connections
      */
     void shutdown();
 
+    /// Called by EmbeddedServiceHost::shutdown() instead of shutdown()
+    void shutdown_embedded();
+
+    void send_response(int connection_id, ResponsePtr response);
+
     void send_notification(int connection_id, ResponsePtr response);
     
     void send_notification_to_all_clients(ResponsePtr response);
     
     void send_device_data_frame(int connection_id, DeviceOutputDataFramePtr data_frame);
 
+    void send_controller_stream_packet(int connection_id, ControllerStreamPacketPtr packet);
+
+    void send_controller_stream_delta(int connection_id, ControllerStreamDeltaBufferPtr delta_buffer);
+
 private:
     /// Must use the overloaded constructor
     ServerNetworkManager();
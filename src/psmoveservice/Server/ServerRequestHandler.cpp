@@ -4,8 +4,10 @@
 #include "BluetoothRequests.h"
 #include "BluetoothQueries.h"
 #include "ControllerManager.h"
+#include "ControllerStreamPacket.h"
 #include "DeviceManager.h"
 #include "DeviceEnumerator.h"
+#include "HitchWatchdog.h"
 #include "MathEigen.h"
 #include "HMDManager.h"
 #include "MorpheusHMD.h"
@@ -16,24 +18,50 @@
 #include "PSDualShock4Controller.h"
 #include "PSMoveController.h"
 #include "PSMoveProtocol.pb.h"
+#include "ProtocolMessageArena.h"
 #include "ServerControllerView.h"
 #include "ServerDeviceView.h"
 #include "ServerNetworkManager.h"
 #include "ServerTrackerView.h"
 #include "ServerHMDView.h"
 #include "ServerLog.h"
+#include "ServerTracer.h"
 #include "ServerUtility.h"
+#include "ServicePerfCounters.h"
+#include "StartupPhaseProfiler.h"
+#include "AllocationTracker.h"
+#include "ThreadCpuMonitor.h"
 #include "TrackerManager.h"
 
 #include <cassert>
 #include <bitset>
 #include <map>
+#include <string.h>
 #include <boost/shared_ptr.hpp>
 
 //-- pre-declarations -----
 class ServerRequestHandlerImpl;
 typedef boost::shared_ptr<ServerRequestHandlerImpl> ServerRequestHandlerImplPtr;
 
+//-- constants -----
+// Publish a full controller stream packet every N updates; the packets in
+// between are delta-encoded against the last full packet (the "keyframe").
+// Deltas are always built against the keyframe rather than the previous
+// packet so a dropped UDP datagram only costs the receiver the frames until
+// the next keyframe, not the rest of the stream.
+static const int k_controller_stream_keyframe_interval= 30;
+
+// EMA blend weight for a connection's delivery latency estimate. Echo
+// samples arrive a couple of times a second, so this settles in roughly
+// ten seconds while still riding out one-off scheduling spikes.
+static const float k_client_latency_ema_alpha= 0.1f;
+
+// Connections subscribed to the same controller with the same stream format
+// share one generated packet per publish. The cache is a per-publish linear
+// scan, so it stays small; spectate setups use one or two formats in
+// practice, and a format beyond the cache just generates its own packet.
+static const int k_max_shared_packet_formats= 8;
+
 //-- definitions -----
 struct RequestConnectionState
 {
@@ -42,9 +70,19 @@ struct RequestConnectionState
     std::bitset<TrackerManager::k_max_devices> active_tracker_streams;
     std::bitset<HMDManager::k_max_devices> active_hmd_streams;
     AsyncBluetoothRequest *pending_bluetooth_request;
+    ResponsePtr pending_bluetooth_response;
     ControllerStreamInfo active_controller_stream_info[ControllerManager::k_max_devices];
     TrackerStreamInfo active_tracker_stream_info[TrackerManager::k_max_devices];
     HMDStreamInfo active_hmd_stream_info[HMDManager::k_max_devices];
+    // Bitmask of the streaming wire formats the client advertised at connect
+    // (PSM_STREAM_FORMAT_FLAG_*). Connections that never register predate
+    // format negotiation: they get full packed packets but no deltas.
+    int supported_stream_formats;
+    // Smoothed one-way delivery latency estimate for this connection, built
+    // from the service timestamps the client echoes back in its input data
+    // frames (see handle_data_frame__controller_packet).
+    // -1 until the first echo arrives.
+    float smoothed_client_latency_seconds;
 
     RequestConnectionState()
         : connection_id(-1)
@@ -52,6 +90,9 @@ struct RequestConnectionState
         , active_tracker_streams()
         , active_hmd_streams()
         , pending_bluetooth_request(nullptr)
+        , pending_bluetooth_response()
+        , supported_stream_formats(PSM_STREAM_FORMAT_FLAG_PROTOBUF | PSM_STREAM_FORMAT_FLAG_PACKED)
+        , smoothed_client_latency_seconds(-1.f)
     {
         for (int index = 0; index < ControllerManager::k_max_devices; ++index)
         {
@@ -81,6 +122,60 @@ struct RequestContext
     RequestPtr request;
 };
 
+//-- statics -----
+/// Pack the chunks of \p packet that differ from \p base into a delta record.
+/// Chunk 0 is always included since it carries the packet sequence number.
+static ControllerStreamDeltaBufferPtr
+build_controller_stream_delta(
+    const ControllerStreamPacket &base,
+    const ControllerStreamPacket &packet)
+{
+    const uint8_t *base_bytes= reinterpret_cast<const uint8_t *>(&base);
+    const uint8_t *packet_bytes= reinterpret_cast<const uint8_t *>(&packet);
+
+    uint32_t chunk_mask= 0;
+    int chunk_count= 0;
+
+    for (int chunk_index= 0; chunk_index < CONTROLLER_STREAM_DELTA_CHUNK_COUNT; ++chunk_index)
+    {
+        const int chunk_offset= chunk_index*CONTROLLER_STREAM_DELTA_CHUNK_SIZE;
+
+        if (chunk_index == 0 ||
+            memcmp(base_bytes+chunk_offset, packet_bytes+chunk_offset, CONTROLLER_STREAM_DELTA_CHUNK_SIZE) != 0)
+        {
+            chunk_mask|= (1u << chunk_index);
+            ++chunk_count;
+        }
+    }
+
+    ControllerStreamDeltaHeader header;
+    header.magic= CONTROLLER_STREAM_DELTA_MAGIC;
+    header.version= PSM_CONTROLLER_STREAM_PACKET_VERSION;
+    header.chunk_count= static_cast<uint8_t>(chunk_count);
+    header.pad= 0;
+    header.controller_id= packet.controller_id;
+    header.base_sequence_num= base.sequence_num;
+    header.chunk_mask= chunk_mask;
+
+    ControllerStreamDeltaBufferPtr delta_buffer(
+        new std::vector<uint8_t>(sizeof(ControllerStreamDeltaHeader) + chunk_count*CONTROLLER_STREAM_DELTA_CHUNK_SIZE));
+    uint8_t *write_ptr= delta_buffer->data();
+
+    memcpy(write_ptr, &header, sizeof(header));
+    write_ptr+= sizeof(header);
+
+    for (int chunk_index= 0; chunk_index < CONTROLLER_STREAM_DELTA_CHUNK_COUNT; ++chunk_index)
+    {
+        if ((chunk_mask & (1u << chunk_index)) != 0)
+        {
+            memcpy(write_ptr, packet_bytes + chunk_index*CONTROLLER_STREAM_DELTA_CHUNK_SIZE, CONTROLLER_STREAM_DELTA_CHUNK_SIZE);
+            write_ptr+= CONTROLLER_STREAM_DELTA_CHUNK_SIZE;
+        }
+    }
+
+    return delta_buffer;
+}
+
 //-- private implementation -----
 class ServerRequestHandlerImpl
 {
@@ -88,7 +183,59 @@ public:
     ServerRequestHandlerImpl(DeviceManager &deviceManager)
         : m_device_manager(deviceManager)
         , m_connection_state_map()
+        , m_current_response()
+        , m_current_response_deferred(false)
     {
+        memset(m_request_handler_table, 0, sizeof(m_request_handler_table));
+
+        // Controller Requests
+        register_request_handler(PSMoveProtocol::Request_RequestType_GET_CONTROLLER_LIST, &ServerRequestHandlerImpl::handle_request__get_controller_list);
+        register_request_handler(PSMoveProtocol::Request_RequestType_START_CONTROLLER_DATA_STREAM, &ServerRequestHandlerImpl::handle_request__start_controller_data_stream);
+        register_request_handler(PSMoveProtocol::Request_RequestType_STOP_CONTROLLER_DATA_STREAM, &ServerRequestHandlerImpl::handle_request__stop_controller_data_stream);
+        register_request_handler(PSMoveProtocol::Request_RequestType_RESET_ORIENTATION, &ServerRequestHandlerImpl::handle_request__reset_orientation);
+        register_request_handler(PSMoveProtocol::Request_RequestType_UNPAIR_CONTROLLER, &ServerRequestHandlerImpl::handle_request__unpair_controller);
+        register_request_handler(PSMoveProtocol::Request_RequestType_PAIR_CONTROLLER, &ServerRequestHandlerImpl::handle_request__pair_controller);
+        register_request_handler(PSMoveProtocol::Request_RequestType_CANCEL_BLUETOOTH_REQUEST, &ServerRequestHandlerImpl::handle_request__cancel_bluetooth_request);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_LED_TRACKING_COLOR, &ServerRequestHandlerImpl::handle_request__set_led_tracking_color);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_CONTROLLER_MAGNETOMETER_CALIBRATION, &ServerRequestHandlerImpl::handle_request__set_controller_magnetometer_calibration);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_CONTROLLER_ACCELEROMETER_CALIBRATION, &ServerRequestHandlerImpl::handle_request__set_controller_accelerometer_calibration);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_CONTROLLER_GYROSCOPE_CALIBRATION, &ServerRequestHandlerImpl::handle_request__set_controller_gyroscope_calibration);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_OPTICAL_NOISE_CALIBRATION, &ServerRequestHandlerImpl::handle_request__set_optical_noise_calibration);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_ORIENTATION_FILTER, &ServerRequestHandlerImpl::handle_request__set_orientation_filter);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_POSITION_FILTER, &ServerRequestHandlerImpl::handle_request__set_position_filter);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_CONTROLLER_PREDICTION_TIME, &ServerRequestHandlerImpl::handle_request__set_controller_prediction_time);
+
+        // Tracker Requests
+        register_request_handler(PSMoveProtocol::Request_RequestType_GET_TRACKER_LIST, &ServerRequestHandlerImpl::handle_request__get_tracker_list);
+        register_request_handler(PSMoveProtocol::Request_RequestType_START_TRACKER_DATA_STREAM, &ServerRequestHandlerImpl::handle_request__start_tracker_data_stream);
+        register_request_handler(PSMoveProtocol::Request_RequestType_STOP_TRACKER_DATA_STREAM, &ServerRequestHandlerImpl::handle_request__stop_tracker_data_stream);
+        register_request_handler(PSMoveProtocol::Request_RequestType_GET_TRACKER_SETTINGS, &ServerRequestHandlerImpl::handle_request__get_tracker_settings);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_TRACKER_EXPOSURE, &ServerRequestHandlerImpl::handle_request__set_tracker_exposure);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_TRACKER_GAIN, &ServerRequestHandlerImpl::handle_request__set_tracker_gain);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_TRACKER_OPTION, &ServerRequestHandlerImpl::handle_request__set_tracker_option);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_TRACKER_COLOR_PRESET, &ServerRequestHandlerImpl::handle_request__set_tracker_color_preset);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_TRACKER_POSE, &ServerRequestHandlerImpl::handle_request__set_tracker_pose);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_TRACKER_INTRINSICS, &ServerRequestHandlerImpl::handle_request__set_tracker_intrinsics);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SAVE_TRACKER_PROFILE, &ServerRequestHandlerImpl::handle_request__save_tracker_profile);
+        register_request_handler(PSMoveProtocol::Request_RequestType_RELOAD_TRACKER_SETTINGS, &ServerRequestHandlerImpl::handle_request__reload_tracker_settings);
+        register_request_handler(PSMoveProtocol::Request_RequestType_APPLY_TRACKER_PROFILE, &ServerRequestHandlerImpl::handle_request__apply_tracker_profile);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SEARCH_FOR_NEW_TRACKERS, &ServerRequestHandlerImpl::handle_request__search_for_new_trackers);
+        register_request_handler(PSMoveProtocol::Request_RequestType_GET_TRACKING_SPACE_SETTINGS, &ServerRequestHandlerImpl::handle_request__get_tracking_space_settings);
+        register_request_handler(PSMoveProtocol::Request_RequestType_CAPTURE_TRACKER_EXCLUSION_AREAS, &ServerRequestHandlerImpl::handle_request__capture_tracker_exclusion_areas);
+
+        // HMD Requests
+        register_request_handler(PSMoveProtocol::Request_RequestType_GET_HMD_LIST, &ServerRequestHandlerImpl::handle_request__get_hmd_list);
+        register_request_handler(PSMoveProtocol::Request_RequestType_START_HMD_DATA_STREAM, &ServerRequestHandlerImpl::handle_request__start_hmd_data_stream);
+        register_request_handler(PSMoveProtocol::Request_RequestType_STOP_HMD_DATA_STREAM, &ServerRequestHandlerImpl::handle_request__stop_hmd_data_stream);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_HMD_ACCELEROMETER_CALIBRATION, &ServerRequestHandlerImpl::handle_request__set_hmd_accelerometer_calibration);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_HMD_GYROSCOPE_CALIBRATION, &ServerRequestHandlerImpl::handle_request__set_hmd_gyroscope_calibration);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_HMD_PREDICTION_TIME, &ServerRequestHandlerImpl::handle_request__set_hmd_prediction_time);
+
+        // General Service Requests
+        register_request_handler(PSMoveProtocol::Request_RequestType_GET_SERVICE_VERSION, &ServerRequestHandlerImpl::handle_request__get_service_version);
+        register_request_handler(PSMoveProtocol::Request_RequestType_GET_SERVICE_STATISTICS, &ServerRequestHandlerImpl::handle_request__get_service_statistics);
+        register_request_handler(PSMoveProtocol::Request_RequestType_START_TRACE_CAPTURE, &ServerRequestHandlerImpl::handle_request__start_trace_capture);
+        register_request_handler(PSMoveProtocol::Request_RequestType_REGISTER_STREAM_CAPABILITIES, &ServerRequestHandlerImpl::handle_request__register_stream_capabilities);
     }
 
     virtual ~ServerRequestHandlerImpl()
@@ -158,6 +305,19 @@ public:
 
                 if (delete_request)
                 {
+                    // Post the deferred response now that the request is resolved
+                    if (connection_state->pending_bluetooth_response)
+                    {
+                        connection_state->pending_bluetooth_response->set_result_code(
+                            connection_state->pending_bluetooth_request->getStatusCode() == AsyncBluetoothRequest::succeeded
+                            ? PSMoveProtocol::Response_ResultCode_RESULT_OK
+                            : PSMoveProtocol::Response_ResultCode_RESULT_ERROR);
+
+                        ServerNetworkManager::get_instance()->send_response(
+                            connection_id, connection_state->pending_bluetooth_response);
+                        connection_state->pending_bluetooth_response= ResponsePtr();
+                    }
+
                     delete connection_state->pending_bluetooth_request;
                     connection_state->pending_bluetooth_request= nullptr;
                 }
@@ -172,177 +332,36 @@ public:
         context.request= request;
         context.connection_state= FindOrCreateConnectionState(connection_id);
 
-        // All responses track which request they came from
-        PSMoveProtocol::Response *response= nullptr;
+        // Constant time dispatch off the request type
+        t_request_handler_method handler_method=
+            (request->type() >= 0 && request->type() < PSMoveProtocol::Request_RequestType_RequestType_ARRAYSIZE)
+            ? m_request_handler_table[request->type()]
+            : nullptr;
 
-        switch (request->type())
+        if (handler_method == nullptr)
         {
-            // Controller Requests
-            case PSMoveProtocol::Request_RequestType_GET_CONTROLLER_LIST:
-                response = new PSMoveProtocol::Response;
-                handle_request__get_controller_list(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_START_CONTROLLER_DATA_STREAM:
-                response = new PSMoveProtocol::Response;
-                handle_request__start_controller_data_stream(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_STOP_CONTROLLER_DATA_STREAM:
-                response = new PSMoveProtocol::Response;
-                handle_request__stop_controller_data_stream(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_RESET_ORIENTATION:
-                response = new PSMoveProtocol::Response;
-                handle_request__reset_orientation(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_UNPAIR_CONTROLLER:
-                response = new PSMoveProtocol::Response;
-                handle_request__unpair_controller(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_PAIR_CONTROLLER:
-                response = new PSMoveProtocol::Response;
-                handle_request__pair_controller(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_CANCEL_BLUETOOTH_REQUEST:
-                response = new PSMoveProtocol::Response;
-                handle_request__cancel_bluetooth_request(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_LED_TRACKING_COLOR:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_led_tracking_color(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_CONTROLLER_MAGNETOMETER_CALIBRATION:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_controller_magnetometer_calibration(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_CONTROLLER_ACCELEROMETER_CALIBRATION:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_controller_accelerometer_calibration(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_CONTROLLER_GYROSCOPE_CALIBRATION:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_controller_gyroscope_calibration(context, response);
-                break;
-			case PSMoveProtocol::Request_RequestType_SET_OPTICAL_NOISE_CALIBRATION:
-				response = new PSMoveProtocol::Response;
-				handle_request__set_optical_noise_calibration(context, response);
-				break;
-			case PSMoveProtocol::Request_RequestType_SET_ORIENTATION_FILTER:
-				response = new PSMoveProtocol::Response;
-				handle_request__set_orientation_filter(context, response);
-				break;
-			case PSMoveProtocol::Request_RequestType_SET_POSITION_FILTER:
-				response = new PSMoveProtocol::Response;
-				handle_request__set_position_filter(context, response);
-				break;
-			case PSMoveProtocol::Request_RequestType_SET_CONTROLLER_PREDICTION_TIME:
-				response = new PSMoveProtocol::Response;
-				handle_request__set_controller_prediction_time(context, response);
-				break;
-
-            // Tracker Requests
-            case PSMoveProtocol::Request_RequestType_GET_TRACKER_LIST:
-                response = new PSMoveProtocol::Response;
-                handle_request__get_tracker_list(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_START_TRACKER_DATA_STREAM:
-                response = new PSMoveProtocol::Response;
-                handle_request__start_tracker_data_stream(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_STOP_TRACKER_DATA_STREAM:
-                response = new PSMoveProtocol::Response;
-                handle_request__stop_tracker_data_stream(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_GET_TRACKER_SETTINGS:
-                response = new PSMoveProtocol::Response;
-                handle_request__get_tracker_settings(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_TRACKER_EXPOSURE:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_tracker_exposure(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_TRACKER_GAIN:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_tracker_gain(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_TRACKER_OPTION:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_tracker_option(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_TRACKER_COLOR_PRESET:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_tracker_color_preset(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_TRACKER_POSE:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_tracker_pose(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_TRACKER_INTRINSICS:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_tracker_intrinsics(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SAVE_TRACKER_PROFILE:
-                response = new PSMoveProtocol::Response;
-                handle_request__save_tracker_profile(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_RELOAD_TRACKER_SETTINGS:
-                response = new PSMoveProtocol::Response;
-                handle_request__reload_tracker_settings(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_APPLY_TRACKER_PROFILE:
-                response = new PSMoveProtocol::Response;
-                handle_request__apply_tracker_profile(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SEARCH_FOR_NEW_TRACKERS:
-                response = new PSMoveProtocol::Response;
-                handle_request__search_for_new_trackers(context, response);
-                break;
-			case PSMoveProtocol::Request_RequestType_GET_TRACKING_SPACE_SETTINGS:
-				response = new PSMoveProtocol::Response;
-				handle_request__get_tracking_space_settings(context, response);
-				break;
-
-            // HMD Requests
-            case PSMoveProtocol::Request_RequestType_GET_HMD_LIST:
-				response = new PSMoveProtocol::Response;
-                handle_request__get_hmd_list(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_START_HMD_DATA_STREAM:
-				response = new PSMoveProtocol::Response;
-                handle_request__start_hmd_data_stream(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_STOP_HMD_DATA_STREAM:
-				response = new PSMoveProtocol::Response;
-                handle_request__stop_hmd_data_stream(context, response);
-                break;                
-			case PSMoveProtocol::Request_RequestType_SET_HMD_ACCELEROMETER_CALIBRATION:
-				response = new PSMoveProtocol::Response;
-				handle_request__set_hmd_accelerometer_calibration(context, response);
-				break;
-			case PSMoveProtocol::Request_RequestType_SET_HMD_GYROSCOPE_CALIBRATION:
-				response = new PSMoveProtocol::Response;
-				handle_request__set_hmd_gyroscope_calibration(context, response);
-				break;
-			case PSMoveProtocol::Request_RequestType_SET_HMD_PREDICTION_TIME:
-				response = new PSMoveProtocol::Response;
-				handle_request__set_hmd_prediction_time(context, response);
-				break;
-
-			// General Service Requests
-			case PSMoveProtocol::Request_RequestType_GET_SERVICE_VERSION:
-				response = new PSMoveProtocol::Response;
-				handle_request__get_service_version(context, response);
-				break;
-
-            default:
-                assert(0 && "Whoops, bad request!");
-        }
-
-        if (response != nullptr)
-        {
-            response->set_request_id(request->request_id());
-        }
-
-        return ResponsePtr(response);
+            SERVER_LOG_ERROR("ServerRequestHandler") << "No handler registered for request type " << request->type();
+            assert(0 && "Whoops, bad request!");
+
+            return ResponsePtr();
+        }
+
+        // All responses track which request they came from.
+        // Arena-backed so the submessages the handler fills in come out of
+        // one arena block instead of individual heap allocations.
+        ResponsePtr response= allocate_message_on_arena<PSMoveProtocol::Response>();
+        response->set_request_id(request->request_id());
+
+        // Handlers that kick off long running work call defer_response() to claim
+        // the response and post it back through the network manager when done
+        m_current_response= response;
+        m_current_response_deferred= false;
+
+        (this->*handler_method)(context, response.get());
+
+        m_current_response= ResponsePtr();
+
+        return m_current_response_deferred ? ResponsePtr() : response;
     }
 
     void handle_input_data_frame(DeviceInputDataFramePtr data_frame)
@@ -377,6 +396,9 @@ public:
 
                 delete connection_state->pending_bluetooth_request;
                 connection_state->pending_bluetooth_request= nullptr;
+
+                // The connection is gone so there is no one to answer
+                connection_state->pending_bluetooth_response= ResponsePtr();
             }
 
             // Clean up any controller state related to this connection
@@ -408,6 +430,12 @@ public:
 					{
 						m_device_manager.getControllerViewPtr(controller_id)->stopTracking();
 					}
+
+					// Halt any shared memory streams this connection has going
+					if (streamInfo.use_shared_memory)
+					{
+						controller_view->stopSharedMemoryStream();
+					}
 				}
             }
 
@@ -420,10 +448,18 @@ public:
 					m_device_manager.getTrackerViewPtr(tracker_id)->loadSettings();
 				}
 
-				// Halt any shared memory streams this connection has going
+				// Halt any video streams this connection has going
 				if (connection_state->active_tracker_stream_info[tracker_id].streaming_video_data)
                 {
-                    m_device_manager.getTrackerViewPtr(tracker_id)->stopSharedMemoryVideoStream();
+                    if (connection_state->active_tracker_stream_info[tracker_id].streaming_compressed_video)
+                    {
+                        m_device_manager.getTrackerViewPtr(tracker_id)->stopCompressedVideoStream();
+                    }
+                    else
+                    {
+                        m_device_manager.getTrackerViewPtr(tracker_id)->stopSharedMemoryVideoStream(
+                            connection_state->active_tracker_stream_info[tracker_id].half_resolution_video);
+                    }
                 }
             }
 
@@ -451,11 +487,23 @@ public:
         }
     }
 
-    void publish_controller_data_frame(
-         ServerControllerView *controller_view, 
-         ServerRequestHandler::t_generate_controller_data_frame_for_stream callback)
+    void publish_controller_stream_packet(
+         ServerControllerView *controller_view,
+         ServerRequestHandler::t_generate_controller_stream_packet callback)
     {
         int controller_id= controller_view->getDeviceID();
+        const std::chrono::time_point<std::chrono::high_resolution_clock> now=
+            std::chrono::high_resolution_clock::now();
+
+        // Packet contents depend only on the stream's include flags (plus the
+        // per-connection prediction horizon), so connections asking for the
+        // same format this publish share one generated packet - the shared_ptr
+        // refcount keeps it alive through every in-flight send. Generation
+        // cost becomes O(formats) instead of O(clients), which matters when
+        // many same-host spectators stream the same controller.
+        int shared_packet_format_keys[k_max_shared_packet_formats];
+        ControllerStreamPacketPtr shared_packets[k_max_shared_packet_formats];
+        int shared_packet_count= 0;
 
         // Notify any connections that care about the controller update
         for (t_connection_state_iter iter= m_connection_state_map.begin(); iter != m_connection_state_map.end(); ++iter)
@@ -465,15 +513,148 @@ public:
 
             if (connection_state->active_controller_streams.test(controller_id))
             {
-                const ControllerStreamInfo &streamInfo=
+                ControllerStreamInfo &streamInfo=
                     connection_state->active_controller_stream_info[controller_id];
 
-                // Fill out a data frame specific to this stream using the given callback
-                DeviceOutputDataFramePtr data_frame(new PSMoveProtocol::DeviceOutputDataFrame);
-                callback(controller_view, &streamInfo, data_frame.get());
+                // Shared memory subscribers poll the ring directly - no UDP send
+                if (streamInfo.use_shared_memory)
+                {
+                    continue;
+                }
 
-                // Send the controller data frame over the network
-                ServerNetworkManager::get_instance()->send_device_data_frame(connection_id, data_frame);
+                // Throttle connections that asked for a reduced update rate
+                if (streamInfo.max_update_rate > 0.f)
+                {
+                    const std::chrono::duration<float, std::micro> time_since_last_publish=
+                        now - streamInfo.last_publish_timestamp;
+                    const float min_publish_interval_us= 1.0e6f / streamInfo.max_update_rate;
+
+                    // Skip this update if it landed too soon after the last published one
+                    if (time_since_last_publish.count() < min_publish_interval_us)
+                    {
+                        continue;
+                    }
+
+                    streamInfo.last_publish_timestamp= now;
+                }
+
+                // Hand the packet generator this connection's measured
+                // delivery latency so the pose can be predicted out to the
+                // client's consumption time (opt-in via the device manager
+                // config; 0 leaves the prediction horizon unchanged)
+                streamInfo.smoothed_client_latency_seconds=
+                    (m_device_manager.getApplyClientLatencyPrediction() &&
+                     connection_state->smoothed_client_latency_seconds >= 0.f)
+                    ? connection_state->smoothed_client_latency_seconds
+                    : 0.f;
+
+                // A connection with a measured latency estimate gets its pose
+                // predicted out to its own consumption time, so its packet
+                // can't be shared with anyone else
+                const bool bShareablePacket= streamInfo.smoothed_client_latency_seconds <= 0.f;
+                const int format_key=
+                    (streamInfo.include_position_data ? 0x01 : 0) |
+                    (streamInfo.include_physics_data ? 0x02 : 0) |
+                    (streamInfo.include_raw_sensor_data ? 0x04 : 0) |
+                    (streamInfo.include_calibrated_sensor_data ? 0x08 : 0) |
+                    (streamInfo.include_raw_tracker_data ? 0x10 : 0);
+
+                ControllerStreamPacketPtr packet;
+
+                if (bShareablePacket)
+                {
+                    for (int cache_index= 0; cache_index < shared_packet_count; ++cache_index)
+                    {
+                        if (shared_packet_format_keys[cache_index] == format_key)
+                        {
+                            packet= shared_packets[cache_index];
+                            break;
+                        }
+                    }
+                }
+
+                if (packet == nullptr)
+                {
+                    // First connection asking for this format - fill out a
+                    // stream packet for it using the given callback
+                    packet= ControllerStreamPacketPtr(new ControllerStreamPacket);
+                    callback(controller_view, &streamInfo, packet.get());
+                    ServicePerfCounters::increment(ServicePerfCounters::Counter_DataFrameAllocations);
+
+                    if (bShareablePacket && shared_packet_count < k_max_shared_packet_formats)
+                    {
+                        shared_packet_format_keys[shared_packet_count]= format_key;
+                        shared_packets[shared_packet_count]= packet;
+                        ++shared_packet_count;
+                    }
+                }
+
+                // Deltas only flow to clients that advertised support for
+                // them at connect; everyone else gets full packets every
+                // frame (the protobuf controller frame path is gone, so the
+                // packed packet is the floor this build can serve)
+                const bool bUseDeltaEncoding =
+                    (connection_state->supported_stream_formats & PSM_STREAM_FORMAT_FLAG_DELTA) != 0;
+
+                if (bUseDeltaEncoding &&
+                    streamInfo.frames_since_keyframe >= 0 &&
+                    streamInfo.frames_since_keyframe < k_controller_stream_keyframe_interval)
+                {
+                    // Send only the chunks that changed since the last keyframe
+                    ControllerStreamDeltaBufferPtr delta_buffer=
+                        build_controller_stream_delta(streamInfo.last_keyframe_packet, *packet);
+
+                    ServerNetworkManager::get_instance()->send_controller_stream_delta(connection_id, delta_buffer);
+                    ++streamInfo.frames_since_keyframe;
+                }
+                else
+                {
+                    // Time for a new keyframe - send the full packet and
+                    // remember it as the base for the following deltas
+                    streamInfo.last_keyframe_packet= *packet;
+                    streamInfo.frames_since_keyframe= 0;
+
+                    ServerNetworkManager::get_instance()->send_controller_stream_packet(connection_id, packet);
+                }
+            }
+        }
+    }
+
+    void publish_controller_button_event(
+        ServerControllerView *controller_view,
+        unsigned int pressed_buttons,
+        unsigned int released_buttons,
+        unsigned int all_buttons)
+    {
+        const int controller_id= controller_view->getDeviceID();
+        ResponsePtr notification;
+
+        // Notify any connections streaming this controller
+        for (t_connection_state_iter iter= m_connection_state_map.begin(); iter != m_connection_state_map.end(); ++iter)
+        {
+            const int connection_id= iter->first;
+            RequestConnectionStatePtr connection_state= iter->second;
+
+            if (connection_state->active_controller_streams.test(controller_id))
+            {
+                // The notification is identical for every connection -
+                // build it lazily once and share it
+                if (notification == nullptr)
+                {
+                    notification = ResponsePtr(new PSMoveProtocol::Response);
+                    notification->set_type(PSMoveProtocol::Response_ResponseType_CONTROLLER_BUTTON_EVENT);
+                    notification->set_request_id(-1);
+                    notification->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
+
+                    PSMoveProtocol::Response_ResultControllerButtonEvent *button_event =
+                        notification->mutable_result_controller_button_event();
+                    button_event->set_controller_id(controller_id);
+                    button_event->set_pressed_buttons(static_cast<int>(pressed_buttons));
+                    button_event->set_released_buttons(static_cast<int>(released_buttons));
+                    button_event->set_all_buttons(static_cast<int>(all_buttons));
+                }
+
+                ServerNetworkManager::get_instance()->send_notification(connection_id, notification);
             }
         }
     }
@@ -498,13 +679,56 @@ public:
                 // Fill out a data frame specific to this stream using the given callback
                 DeviceOutputDataFramePtr data_frame(new PSMoveProtocol::DeviceOutputDataFrame);
                 callback(tracker_view, &streamInfo, data_frame);
+                data_frame->set_publish_tick_id(
+                    static_cast<int64_t>(m_device_manager.getPublishTickId()));
+                ServicePerfCounters::increment(ServicePerfCounters::Counter_DataFrameAllocations);
 
                 // Send the tracker data frame over the network
                 ServerNetworkManager::get_instance()->send_device_data_frame(connection_id, data_frame);
             }
         }
     }
-    
+
+    void publish_tracker_video_frame(
+        class ServerTrackerView *tracker_view,
+        const unsigned char *jpeg_data, int jpeg_size,
+        int width, int height, int sequence_num)
+    {
+        int tracker_id = tracker_view->getDeviceID();
+        ResponsePtr notification;
+
+        // Notify any connections following the compressed video stream.
+        // The frame contents are the same for every subscriber, so one
+        // notification is built lazily and shared across the sends.
+        for (t_connection_state_iter iter = m_connection_state_map.begin(); iter != m_connection_state_map.end(); ++iter)
+        {
+            int connection_id = iter->first;
+            RequestConnectionStatePtr connection_state = iter->second;
+
+            if (connection_state->active_tracker_streams.test(tracker_id) &&
+                connection_state->active_tracker_stream_info[tracker_id].streaming_compressed_video)
+            {
+                if (notification == nullptr)
+                {
+                    notification = ResponsePtr(new PSMoveProtocol::Response);
+                    notification->set_type(PSMoveProtocol::Response_ResponseType_TRACKER_VIDEO_FRAME);
+                    notification->set_request_id(-1);
+                    notification->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
+
+                    PSMoveProtocol::Response_ResultTrackerVideoFrame *video_frame =
+                        notification->mutable_result_tracker_video_frame();
+                    video_frame->set_tracker_id(tracker_id);
+                    video_frame->set_sequence_num(sequence_num);
+                    video_frame->set_width(width);
+                    video_frame->set_height(height);
+                    video_frame->set_jpeg_data(jpeg_data, jpeg_size);
+                }
+
+                ServerNetworkManager::get_instance()->send_notification(connection_id, notification);
+            }
+        }
+    }
+
     void publish_hmd_data_frame(
         class ServerHMDView *hmd_view,
         ServerRequestHandler::t_generate_hmd_data_frame_for_stream callback)
@@ -525,6 +749,9 @@ public:
                 // Fill out a data frame specific to this stream using the given callback
                 DeviceOutputDataFramePtr data_frame(new PSMoveProtocol::DeviceOutputDataFrame);
                 callback(hmd_view, &streamInfo, data_frame);
+                data_frame->set_publish_tick_id(
+                    static_cast<int64_t>(m_device_manager.getPublishTickId()));
+                ServicePerfCounters::increment(ServicePerfCounters::Counter_DataFrameAllocations);
 
                 // Send the hmd data frame over the network
                 ServerNetworkManager::get_instance()->send_device_data_frame(connection_id, data_frame);
@@ -581,6 +808,19 @@ protected:
 
         response->set_type(PSMoveProtocol::Response_ResponseType_CONTROLLER_LIST);
 
+        // If the client's cached copy of the list is still current, skip
+        // rebuilding the entries and just tell it the cache is valid
+        const int list_generation = m_device_manager.m_controller_manager->getDeviceListGeneration();
+
+        list->set_list_generation(list_generation);
+
+        if (request.cached_list_generation() == list_generation)
+        {
+            list->set_cached_list_valid(true);
+            response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
+            return;
+        }
+
         // Get the address of the bluetooth adapter cached at startup
         list->set_host_serial(m_device_manager.m_controller_manager->getCachedBluetoothHostAddress());
 
@@ -727,6 +967,8 @@ protected:
                 streamInfo.include_calibrated_sensor_data = request.include_calibrated_sensor_data();
                 streamInfo.include_raw_tracker_data = request.include_raw_tracker_data();
 				streamInfo.disable_roi = request.disable_roi();
+                streamInfo.max_update_rate = request.max_update_rate();
+                streamInfo.use_shared_memory = request.use_shared_memory();
 
 				SERVER_LOG_INFO("ServerRequestHandler") << "Start controller(" << controller_id << ") stream ("
 					<< "pos=" << streamInfo.include_position_data
@@ -755,6 +997,11 @@ protected:
 					controller_view->pushDisableROI();
 				}
 
+                if (streamInfo.use_shared_memory)
+                {
+                    controller_view->startSharedMemoryStream();
+                }
+
                 response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
             }
             else
@@ -797,6 +1044,11 @@ protected:
                     controller_view->clearLEDOverride();
                 }
 
+                if (streamInfo.use_shared_memory)
+                {
+                    controller_view->stopSharedMemoryStream();
+                }
+
 				SERVER_LOG_INFO("ServerRequestHandler") << "Stop controller(" << controller_id << ") stream";
 
                 context.connection_state->active_controller_streams.set(controller_id, false);
@@ -867,7 +1119,8 @@ protected:
 				{
 					SERVER_LOG_INFO("ServerRequestHandler") << "Async bluetooth request(" << description << ") started.";
 
-					response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
+					// Answer with the final result when the async request completes
+					context.connection_state->pending_bluetooth_response= defer_response();
 				}
 				else
 				{
@@ -919,7 +1172,8 @@ protected:
 						<< context.connection_state->pending_bluetooth_request->getDescription()
 						<< ") started.";
 
-					response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
+					// Answer with the final result when the async request completes
+					context.connection_state->pending_bluetooth_response= defer_response();
 				}
 				else
 				{
@@ -966,7 +1220,18 @@ protected:
                 << ") Canceled.";
 
             context.connection_state->pending_bluetooth_request->cancel(AsyncBluetoothRequest::userRequested);
-            
+
+            // Resolve the deferred pair/unpair response as canceled
+            if (context.connection_state->pending_bluetooth_response)
+            {
+                context.connection_state->pending_bluetooth_response->set_result_code(
+                    PSMoveProtocol::Response_ResultCode_RESULT_CANCELED);
+
+                ServerNetworkManager::get_instance()->send_response(
+                    connection_id, context.connection_state->pending_bluetooth_response);
+                context.connection_state->pending_bluetooth_response= ResponsePtr();
+            }
+
             response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
         }
         else
@@ -1008,6 +1273,9 @@ protected:
 
 				// Assign the new color to ourselves
 				ControllerView->setTrackingColorID(newColorID);
+
+				// The tracking color shows up in the controller list response
+				m_device_manager.m_controller_manager->bumpDeviceListGeneration();
 			}
 
             response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
@@ -1192,6 +1460,9 @@ protected:
 				if (bChanged)
 				{
 					config->save();
+
+					// The gyro gain setting shows up in the controller list response
+					m_device_manager.m_controller_manager->bumpDeviceListGeneration();
 				}
 
 				ControllerView->resetPoseFilter();
@@ -1315,6 +1586,9 @@ protected:
 					config->save();
 
 					ControllerView->resetPoseFilter();
+
+					// The filter name shows up in the controller list response
+					m_device_manager.m_controller_manager->bumpDeviceListGeneration();
 				}
 
 				response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
@@ -1330,6 +1604,9 @@ protected:
 					config->save();
 
 					ControllerView->resetPoseFilter();
+
+					// The filter name shows up in the controller list response
+					m_device_manager.m_controller_manager->bumpDeviceListGeneration();
 				}
 
 				response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
@@ -1368,6 +1645,9 @@ protected:
 					config->save();
 
 					ControllerView->resetPoseFilter();
+
+					// The filter name shows up in the controller list response
+					m_device_manager.m_controller_manager->bumpDeviceListGeneration();
 				}
 
 				response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
@@ -1383,6 +1663,9 @@ protected:
 					config->save();
 
 					ControllerView->resetPoseFilter();
+
+					// The filter name shows up in the controller list response
+					m_device_manager.m_controller_manager->bumpDeviceListGeneration();
 				}
 
 				response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
@@ -1419,6 +1702,9 @@ protected:
 				{
 					config->prediction_time = request.prediction_time();
 					config->save();
+
+					// The prediction time shows up in the controller list response
+					m_device_manager.m_controller_manager->bumpDeviceListGeneration();
 				}
 
 				response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
@@ -1432,6 +1718,9 @@ protected:
 				{
 					config->prediction_time = request.prediction_time();
 					config->save();
+
+					// The prediction time shows up in the controller list response
+					m_device_manager.m_controller_manager->bumpDeviceListGeneration();
 				}
 
 				response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
@@ -1473,6 +1762,19 @@ protected:
 
         response->set_type(PSMoveProtocol::Response_ResponseType_TRACKER_LIST);
 
+        // If the client's cached copy of the list is still current, skip
+        // rebuilding the entries and just tell it the cache is valid
+        const int list_generation = m_device_manager.m_tracker_manager->getDeviceListGeneration();
+
+        list->set_list_generation(list_generation);
+
+        if (context.request->request_get_tracker_list().cached_list_generation() == list_generation)
+        {
+            list->set_cached_list_valid(true);
+            response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
+            return;
+        }
+
         for (int tracker_id = 0; tracker_id < m_device_manager.getTrackerViewMaxCount(); ++tracker_id)
         {
             ServerTrackerViewPtr tracker_view = m_device_manager.getTrackerViewPtr(tracker_id);
@@ -1486,6 +1788,9 @@ protected:
                 case CommonControllerState::PS3EYE:
                     tracker_info->set_tracker_type(PSMoveProtocol::PS3EYE);
                     break;
+                case CommonControllerState::VirtualTracker:
+                    tracker_info->set_tracker_type(PSMoveProtocol::VIRTUAL_TRACKER);
+                    break;
                 default:
                     assert(0 && "Unhandled tracker type");
                 }
@@ -1567,6 +1872,23 @@ protected:
         }
 
 		list->set_global_forward_degrees(m_device_manager.m_tracker_manager->getConfig().global_forward_degrees);
+
+        // Attach the per-bus USB bandwidth plan so clients can warn when the
+        // cameras are plugged into an oversubscribed host controller
+        for (const USBBusBandwidthInfo &bus_info :
+            m_device_manager.m_tracker_manager->getUSBBusBandwidthInfo())
+        {
+            PSMoveProtocol::Response_ResultTrackerList_USBBusBandwidth *bus_bandwidth =
+                list->add_usb_bus_bandwidth();
+
+            bus_bandwidth->set_bus_number(bus_info.bus_number);
+            bus_bandwidth->set_camera_count(bus_info.camera_count);
+            bus_bandwidth->set_estimated_mbps(bus_info.estimated_mbps);
+            bus_bandwidth->set_budget_mbps(bus_info.budget_mbps);
+            bus_bandwidth->set_oversubscribed(bus_info.oversubscribed);
+            bus_bandwidth->set_feasible_frame_rate(bus_info.feasible_frame_rate);
+        }
+
         response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
     }
 
@@ -1593,9 +1915,20 @@ protected:
 
                 // Set control flags for the stream
                 streamInfo.streaming_video_data = true;
+                streamInfo.half_resolution_video = (request.stream_quality() == 1);
+                streamInfo.streaming_compressed_video = (request.stream_quality() == 2);
 
-                // Increment the number of stream listeners
-                tracker_view->startSharedMemoryVideoStream();
+                // Increment the number of stream listeners.
+                // Compressed video clients get MJPEG frames pushed over TCP
+                // instead of a shared memory block they couldn't map anyway.
+                if (streamInfo.streaming_compressed_video)
+                {
+                    tracker_view->startCompressedVideoStream();
+                }
+                else
+                {
+                    tracker_view->startSharedMemoryVideoStream(streamInfo.half_resolution_video);
+                }
 
                 // Return the name of the shared memory block the video frames will be written to
                 response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
@@ -1624,6 +1957,11 @@ protected:
 
             if (tracker_view->getIsOpen())
             {
+                const bool bWasHalfResolution =
+                    context.connection_state->active_tracker_stream_info[tracker_id].half_resolution_video;
+                const bool bWasCompressedVideo =
+                    context.connection_state->active_tracker_stream_info[tracker_id].streaming_compressed_video;
+
                 context.connection_state->active_tracker_streams.set(tracker_id, false);
                 context.connection_state->active_tracker_stream_info[tracker_id].Clear();
 
@@ -1634,7 +1972,14 @@ protected:
 				}
 
                 // Decrement the number of stream listeners
-                tracker_view->stopSharedMemoryVideoStream();
+                if (bWasCompressedVideo)
+                {
+                    tracker_view->stopCompressedVideoStream();
+                }
+                else
+                {
+                    tracker_view->stopSharedMemoryVideoStream(bWasHalfResolution);
+                }
 
                 response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
             }
@@ -1956,6 +2301,9 @@ protected:
                 tracker_view->setTrackerPose(&destPose);
                 tracker_view->saveSettings();
 
+                // The tracker pose shows up in the tracker list response
+                m_device_manager.m_tracker_manager->bumpDeviceListGeneration();
+
                 response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
             }
             else
@@ -1988,6 +2336,9 @@ protected:
                     intrinsics.tracker_p1(), intrinsics.tracker_p2());
                 tracker_view->saveSettings();
 
+                // The camera intrinsics show up in the tracker list response
+                m_device_manager.m_tracker_manager->bumpDeviceListGeneration();
+
                 response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
             }
             else
@@ -2127,6 +2478,46 @@ protected:
         }
     }
 
+    void handle_request__capture_tracker_exclusion_areas(
+        const RequestContext &context,
+        PSMoveProtocol::Response *response)
+    {
+        const int tracker_id = context.request->request_capture_tracker_exclusion_areas().tracker_id();
+
+        response->set_type(PSMoveProtocol::Response_ResponseType_GENERAL_RESULT);
+
+        if (ServerUtility::is_index_valid(tracker_id, m_device_manager.getTrackerViewMaxCount()))
+        {
+            ServerTrackerViewPtr tracker_view = m_device_manager.getTrackerViewPtr(tracker_id);
+            if (tracker_view->getIsOpen())
+            {
+                bool bSuccess = true;
+
+                if (context.request->request_capture_tracker_exclusion_areas().clear_existing())
+                {
+                    tracker_view->clearExclusionAreas();
+                }
+                else
+                {
+                    bSuccess = tracker_view->captureExclusionAreas();
+                }
+
+                response->set_result_code(
+                    bSuccess
+                    ? PSMoveProtocol::Response_ResultCode_RESULT_OK
+                    : PSMoveProtocol::Response_ResultCode_RESULT_ERROR);
+            }
+            else
+            {
+                response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_ERROR);
+            }
+        }
+        else
+        {
+            response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_ERROR);
+        }
+    }
+
     void handle_request__search_for_new_trackers(
         const RequestContext &context,
         PSMoveProtocol::Response *response)
@@ -2410,6 +2801,9 @@ protected:
 				{
 					config->prediction_time = request.prediction_time();
 					config->save();
+
+					// The prediction time shows up in the controller list response
+					m_device_manager.m_controller_manager->bumpDeviceListGeneration();
 				}
 
 				response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
@@ -2437,6 +2831,262 @@ protected:
 		response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
 	}
 
+	static void fill_latency_histogram_result(
+		const LatencyHistogram &histogram,
+		const char *stage_name,
+		PSMoveProtocol::Response_ResultServiceStatistics_LatencyHistogram *histogram_result)
+	{
+		histogram_result->set_stage_name(stage_name);
+
+		for (int bucket_index = 0; bucket_index < LatencyHistogram::k_bucket_count; ++bucket_index)
+		{
+			histogram_result->add_bucket_counts(histogram.getBucketSampleCount(bucket_index));
+		}
+
+		histogram_result->set_sample_count(histogram.getTotalSampleCount());
+		histogram_result->set_mean_microseconds(static_cast<float>(histogram.getMeanMicroseconds()));
+		histogram_result->set_max_microseconds(static_cast<float>(histogram.getMaxMicroseconds()));
+	}
+
+	void handle_request__get_service_statistics(
+		const RequestContext &context,
+		PSMoveProtocol::Response *response)
+	{
+		PSMoveProtocol::Response_ResultServiceStatistics* statistics_result = response->mutable_result_service_statistics();
+
+		response->set_type(PSMoveProtocol::Response_ResponseType_SERVICE_STATISTICS);
+
+		// Rates are computed over the interval since the previous scrape
+		const std::chrono::time_point<std::chrono::high_resolution_clock> now =
+			std::chrono::high_resolution_clock::now();
+		const float sample_interval_seconds =
+			m_perf_counter_snapshot.valid
+			? std::chrono::duration<float>(now - m_perf_counter_snapshot.timestamp).count()
+			: 0.f;
+		const bool bHaveInterval = sample_interval_seconds > 0.f;
+
+		for (int controller_id = 0; controller_id < m_device_manager.getControllerViewMaxCount(); ++controller_id)
+		{
+			ServerControllerViewPtr controller_view = m_device_manager.getControllerViewPtr(controller_id);
+
+			if (!controller_view->getIsOpen())
+			{
+				continue;
+			}
+
+			PSMoveProtocol::Response_ResultServiceStatistics_ControllerStatistics *controller_statistics =
+				statistics_result->add_controller_statistics();
+			const uint64_t poll_count = controller_view->getNewDataPollCount();
+
+			controller_statistics->set_controller_id(controller_id);
+			controller_statistics->set_new_data_poll_count(poll_count);
+			controller_statistics->set_poll_rate_hz(
+				bHaveInterval
+				? static_cast<float>(poll_count - m_perf_counter_snapshot.controller_poll_counts[controller_id]) / sample_interval_seconds
+				: 0.f);
+			m_perf_counter_snapshot.controller_poll_counts[controller_id] = poll_count;
+
+			controller_statistics->set_tracking_quality(controller_view->getTrackingQuality());
+			controller_statistics->set_avg_projection_fit_error(controller_view->getAvgProjectionFitError());
+			controller_statistics->set_avg_multicam_disagreement_cm(controller_view->getAvgMulticamDisagreementCm());
+			controller_statistics->set_avg_filter_innovation_cm(controller_view->getAvgFilterInnovationCm());
+
+			{
+				const IPoseFilter *pose_filter = controller_view->getPoseFilter();
+				int mag_update_interval_ticks = 0;
+				int mag_skipped_update_count = 0;
+
+				if (pose_filter != nullptr &&
+					pose_filter->getMagnetometerDecimationState(mag_update_interval_ticks, mag_skipped_update_count))
+				{
+					controller_statistics->set_mag_update_interval_ticks(mag_update_interval_ticks);
+					controller_statistics->set_mag_updates_skipped(static_cast<uint64_t>(mag_skipped_update_count));
+				}
+			}
+
+			fill_latency_histogram_result(
+				controller_view->getPollToFilterLatencyHistogram(),
+				"poll_to_filter",
+				controller_statistics->add_latency_histograms());
+			fill_latency_histogram_result(
+				controller_view->getFilterToPublishLatencyHistogram(),
+				"filter_to_publish",
+				controller_statistics->add_latency_histograms());
+			fill_latency_histogram_result(
+				controller_view->getPollToPublishLatencyHistogram(),
+				"poll_to_publish",
+				controller_statistics->add_latency_histograms());
+		}
+
+		for (int tracker_id = 0; tracker_id < m_device_manager.getTrackerViewMaxCount(); ++tracker_id)
+		{
+			ServerTrackerViewPtr tracker_view = m_device_manager.getTrackerViewPtr(tracker_id);
+
+			if (!tracker_view->getIsOpen())
+			{
+				continue;
+			}
+
+			PSMoveProtocol::Response_ResultServiceStatistics_TrackerStatistics *tracker_statistics =
+				statistics_result->add_tracker_statistics();
+			const uint64_t poll_count = tracker_view->getNewDataPollCount();
+
+			tracker_statistics->set_tracker_id(tracker_id);
+			tracker_statistics->set_new_data_poll_count(poll_count);
+			tracker_statistics->set_poll_rate_hz(
+				bHaveInterval
+				? static_cast<float>(poll_count - m_perf_counter_snapshot.tracker_poll_counts[tracker_id]) / sample_interval_seconds
+				: 0.f);
+			m_perf_counter_snapshot.tracker_poll_counts[tracker_id] = poll_count;
+
+			// Capture health telemetry - the fleet monitors scrape these to
+			// alarm on capture degradation before users feel it
+			{
+				const ITrackerInterface *tracker_device =
+					static_cast<const ITrackerInterface *>(tracker_view->getDevice());
+				const std::chrono::duration<float, std::milli> last_frame_age =
+					std::chrono::high_resolution_clock::now() - tracker_device->getVideoFrameCaptureTimestamp();
+
+				tracker_statistics->set_capture_rate_hz(tracker_device->getMeasuredCaptureRateFps());
+				tracker_statistics->set_last_frame_age_ms(last_frame_age.count());
+				tracker_statistics->set_dropped_frame_count(tracker_device->getDroppedFrameCount());
+			}
+		}
+
+		for (int stage_index = 0; stage_index < HitchWatchdog::k_stage_count; ++stage_index)
+		{
+			const HitchWatchdog::eStage stage = static_cast<HitchWatchdog::eStage>(stage_index);
+
+			if (stage == HitchWatchdog::Stage_Idle)
+			{
+				continue;
+			}
+
+			PSMoveProtocol::Response_ResultServiceStatistics_StallReport *stall_report =
+				statistics_result->add_stall_reports();
+
+			stall_report->set_stage_name(HitchWatchdog::getStageName(stage));
+			stall_report->set_stall_count(HitchWatchdog::getStallCount(stage));
+			stall_report->set_worst_stall_milliseconds(HitchWatchdog::getWorstStallMilliseconds(stage));
+		}
+
+		{
+			PSMoveProtocol::Response_ResultServiceStatistics_PerfCounters *perf_counters =
+				statistics_result->mutable_perf_counters();
+
+			uint64_t counter_values[ServicePerfCounters::k_counter_count];
+			for (int counter_index = 0; counter_index < ServicePerfCounters::k_counter_count; ++counter_index)
+			{
+				counter_values[counter_index] =
+					ServicePerfCounters::getCount(static_cast<ServicePerfCounters::eCounter>(counter_index));
+			}
+
+			auto counter_rate_hz = [&](const ServicePerfCounters::eCounter counter) {
+				return bHaveInterval
+					? static_cast<float>(counter_values[counter] - m_perf_counter_snapshot.counter_values[counter]) / sample_interval_seconds
+					: 0.f;
+			};
+
+			perf_counters->set_sample_interval_seconds(sample_interval_seconds);
+			perf_counters->set_main_loop_tick_count(counter_values[ServicePerfCounters::Counter_MainLoopTicks]);
+			perf_counters->set_main_loop_rate_hz(counter_rate_hz(ServicePerfCounters::Counter_MainLoopTicks));
+			perf_counters->set_udp_datagrams_sent(counter_values[ServicePerfCounters::Counter_UdpDatagramsSent]);
+			perf_counters->set_udp_datagram_rate_hz(counter_rate_hz(ServicePerfCounters::Counter_UdpDatagramsSent));
+			perf_counters->set_udp_data_frames_sent(counter_values[ServicePerfCounters::Counter_UdpDataFramesSent]);
+			perf_counters->set_udp_data_frame_rate_hz(counter_rate_hz(ServicePerfCounters::Counter_UdpDataFramesSent));
+			perf_counters->set_udp_data_frames_dropped(counter_values[ServicePerfCounters::Counter_UdpDataFramesDropped]);
+			perf_counters->set_data_frame_allocations(counter_values[ServicePerfCounters::Counter_DataFrameAllocations]);
+			perf_counters->set_data_frame_allocation_rate_hz(counter_rate_hz(ServicePerfCounters::Counter_DataFrameAllocations));
+
+			memcpy(m_perf_counter_snapshot.counter_values, counter_values, sizeof(counter_values));
+		}
+
+		{
+			std::vector<ThreadCpuMonitor::ThreadCpuSample> thread_samples;
+			ThreadCpuMonitor::sampleAll(thread_samples);
+
+			for (const ThreadCpuMonitor::ThreadCpuSample &thread_sample : thread_samples)
+			{
+				PSMoveProtocol::Response_ResultServiceStatistics_ThreadCpuUsage *thread_cpu_usage =
+					statistics_result->add_thread_cpu_usage();
+
+				thread_cpu_usage->set_thread_name(thread_sample.thread_name);
+				thread_cpu_usage->set_cpu_fraction(thread_sample.cpu_fraction);
+			}
+		}
+
+		// Machine-readable copy of the startup timing table the profiler
+		// logged at ready-state (identical on every scrape)
+		for (int phase_index = 0; phase_index < StartupPhaseProfiler::getPhaseCount(); ++phase_index)
+		{
+			PSMoveProtocol::Response_ResultServiceStatistics_StartupPhase *startup_phase =
+				statistics_result->add_startup_phases();
+
+			startup_phase->set_phase_name(StartupPhaseProfiler::getPhaseName(phase_index));
+			startup_phase->set_duration_milliseconds(StartupPhaseProfiler::getPhaseMilliseconds(phase_index));
+		}
+
+		// Only populated when the service was built with PSMOVE_TRACK_ALLOCATIONS
+		if (AllocationTracker::getIsAvailable())
+		{
+			std::vector<AllocationTracker::ScopeAllocationStats> allocation_stats;
+			AllocationTracker::getStats(allocation_stats);
+
+			for (const AllocationTracker::ScopeAllocationStats &scope_stats : allocation_stats)
+			{
+				PSMoveProtocol::Response_ResultServiceStatistics_ScopeAllocationStats *scope_allocation_stats =
+					statistics_result->add_scope_allocation_stats();
+
+				scope_allocation_stats->set_scope_name(scope_stats.scope_name);
+				scope_allocation_stats->set_allocation_count(scope_stats.allocation_count);
+				scope_allocation_stats->set_allocation_bytes(scope_stats.allocation_bytes);
+				scope_allocation_stats->set_free_count(scope_stats.free_count);
+			}
+		}
+
+		m_perf_counter_snapshot.timestamp = now;
+		m_perf_counter_snapshot.valid = true;
+
+		response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
+	}
+
+	void handle_request__start_trace_capture(
+		const RequestContext &context,
+		PSMoveProtocol::Response *response)
+	{
+		const PSMoveProtocol::Request_RequestStartTraceCapture &request =
+			context.request->request_start_trace_capture();
+
+		if (ServerTracer::startCapture(request.output_filename(), request.duration_seconds()))
+		{
+			response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
+		}
+		else
+		{
+			// A capture is already in flight
+			response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_ERROR);
+		}
+	}
+
+	void handle_request__register_stream_capabilities(
+		const RequestContext &context,
+		PSMoveProtocol::Response *response)
+	{
+		const int client_formats =
+			context.request->request_register_stream_capabilities().supported_stream_formats();
+
+		// Only ever stream formats in the intersection with what this build
+		// can produce; unknown future bits are dropped here
+		context.connection_state->supported_stream_formats =
+			client_formats & PSM_SUPPORTED_STREAM_FORMATS_MASK;
+
+		SERVER_LOG_INFO("ServerRequestHandler") << "Connection "
+			<< context.connection_state->connection_id
+			<< " registered stream capabilities mask " << client_formats;
+
+		response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
+	}
+
     // -- Data Frame Updates -----
     void handle_data_frame__controller_packet(
         RequestConnectionStatePtr connection_state,
@@ -2450,6 +3100,35 @@ protected:
             ServerControllerViewPtr controller_view = m_device_manager.getControllerViewPtr(controller_id);
             ControllerStreamInfo &streamInfo = connection_state->active_controller_stream_info[controller_id];
 
+            // Fold the echoed stream packet timestamp into this connection's
+            // latency estimate. The client has no clock in common with ours,
+            // so half the measured round trip stands in for the one-way
+            // delivery latency.
+            if (controllerDataPacket.echoed_service_timestamp_us() > 0)
+            {
+                const uint64_t now_us= static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch()).count());
+                const uint64_t echoed_us= static_cast<uint64_t>(controllerDataPacket.echoed_service_timestamp_us());
+
+                if (now_us > echoed_us)
+                {
+                    const float latency_sample= static_cast<float>(now_us - echoed_us) / 2.0e6f;
+
+                    if (connection_state->smoothed_client_latency_seconds >= 0.f)
+                    {
+                        connection_state->smoothed_client_latency_seconds+=
+                            k_client_latency_ema_alpha*
+                            (latency_sample - connection_state->smoothed_client_latency_seconds);
+                    }
+                    else
+                    {
+                        // First sample seeds the estimate
+                        connection_state->smoothed_client_latency_seconds= latency_sample;
+                    }
+                }
+            }
+
             // Don't consider this data frame if the controller is USB connected
             // or if the sequence number is old
             if (controller_view->getIsBluetooth() && 
@@ -2545,9 +3224,55 @@ protected:
         }
     }
 
+    // Called by a handler to claim ownership of its response.
+    // The response won't be sent when the handler returns - whoever completes
+    // the work posts it back through ServerNetworkManager::send_response()
+    ResponsePtr defer_response()
+    {
+        assert(m_current_response && "defer_response() called outside of a request handler");
+        m_current_response_deferred= true;
+
+        return m_current_response;
+    }
+
 private:
+    typedef void (ServerRequestHandlerImpl::*t_request_handler_method)(
+        const RequestContext &context, PSMoveProtocol::Response *response);
+
+    void register_request_handler(PSMoveProtocol::Request_RequestType request_type, t_request_handler_method handler_method)
+    {
+        assert(m_request_handler_table[request_type] == nullptr && "Handler already registered for this request type");
+        m_request_handler_table[request_type]= handler_method;
+    }
+
+    // Counter values captured at the previous GET_SERVICE_STATISTICS scrape,
+    // used to turn the monotonic perf counters into rates over the interval
+    struct PerfCounterSnapshot
+    {
+        bool valid;
+        std::chrono::time_point<std::chrono::high_resolution_clock> timestamp;
+        uint64_t counter_values[ServicePerfCounters::k_counter_count];
+        uint64_t controller_poll_counts[ControllerManager::k_max_devices];
+        uint64_t tracker_poll_counts[TrackerManager::k_max_devices];
+
+        PerfCounterSnapshot() : valid(false)
+        {
+            memset(counter_values, 0, sizeof(counter_values));
+            memset(controller_poll_counts, 0, sizeof(controller_poll_counts));
+            memset(tracker_poll_counts, 0, sizeof(tracker_poll_counts));
+        }
+    };
+
     DeviceManager &m_device_manager;
     t_connection_state_map m_connection_state_map;
+    PerfCounterSnapshot m_perf_counter_snapshot;
+
+    // Request type -> handler method lookup table
+    t_request_handler_method m_request_handler_table[PSMoveProtocol::Request_RequestType_RequestType_ARRAYSIZE];
+
+    // The response for the request currently being dispatched
+    ResponsePtr m_current_response;
+    bool m_current_response_deferred;
 };
 
 //-- public interface -----
@@ -2605,11 +3330,21 @@ void ServerRequestHandler::handle_client_connection_stopped(int connection_id)
     return m_implementation_ptr->handle_client_connection_stopped(connection_id);
 }
 
-void ServerRequestHandler::publish_controller_data_frame(
-    ServerControllerView *controller_view, 
-    t_generate_controller_data_frame_for_stream callback)
+void ServerRequestHandler::publish_controller_stream_packet(
+    ServerControllerView *controller_view,
+    t_generate_controller_stream_packet callback)
+{
+    return m_implementation_ptr->publish_controller_stream_packet(controller_view, callback);
+}
+
+void ServerRequestHandler::publish_controller_button_event(
+    ServerControllerView *controller_view,
+    unsigned int pressed_buttons,
+    unsigned int released_buttons,
+    unsigned int all_buttons)
 {
-    return m_implementation_ptr->publish_controller_data_frame(controller_view, callback);
+    return m_implementation_ptr->publish_controller_button_event(
+        controller_view, pressed_buttons, released_buttons, all_buttons);
 }
 
 void ServerRequestHandler::publish_tracker_data_frame(
@@ -2619,6 +3354,15 @@ void ServerRequestHandler::publish_tracker_data_frame(
     return m_implementation_ptr->publish_tracker_data_frame(tracker_view, callback);
 }
 
+void ServerRequestHandler::publish_tracker_video_frame(
+    class ServerTrackerView *tracker_view,
+    const unsigned char *jpeg_data, int jpeg_size,
+    int width, int height, int sequence_num)
+{
+    return m_implementation_ptr->publish_tracker_video_frame(
+        tracker_view, jpeg_data, jpeg_size, width, height, sequence_num);
+}
+
 void ServerRequestHandler::publish_hmd_data_frame(
     class ServerHMDView *hmd_view,
     t_generate_hmd_data_frame_for_stream callback)
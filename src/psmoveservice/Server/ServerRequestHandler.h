@@ -3,6 +3,9 @@
 
 // -- includes -----
 #include "PSMoveProtocolInterface.h"
+#include "ControllerStreamPacket.h"
+
+#include <chrono>
 
 // -- pre-declarations -----
 class DeviceManager;
@@ -22,6 +25,17 @@ struct ControllerStreamInfo
     bool led_override_active;
 	bool disable_roi;
     int last_data_input_sequence_number;
+    float max_update_rate; ///< Maximum publish rate in Hz (0 = service tick rate)
+    // Smoothed one-way delivery latency (seconds) measured for the owning
+    // connection via the stream packet timestamp echo. Added to the
+    // controller's prediction horizon when this stream's packets are
+    // generated; 0 until an estimate exists or when latency prediction
+    // is disabled in the device manager config
+    float smoothed_client_latency_seconds;
+    std::chrono::time_point<std::chrono::high_resolution_clock> last_publish_timestamp;
+    bool use_shared_memory; ///< Client polls the shared memory ring instead of UDP
+    int frames_since_keyframe; ///< -1 until the first keyframe goes out
+    ControllerStreamPacket last_keyframe_packet; ///< Base the next deltas are built against
 
     inline void Clear()
     {
@@ -33,17 +47,26 @@ struct ControllerStreamInfo
         led_override_active = false;
 		disable_roi = false;
 		last_data_input_sequence_number = -1;
+        max_update_rate = 0.f;
+        smoothed_client_latency_seconds = 0.f;
+        last_publish_timestamp = std::chrono::time_point<std::chrono::high_resolution_clock>();
+        use_shared_memory = false;
+        frames_since_keyframe = -1;
     }
 };
 
 struct TrackerStreamInfo
 {
     bool streaming_video_data;
+    bool half_resolution_video;
+    bool streaming_compressed_video; ///< MJPEG frames pushed over TCP instead of shared memory
 	bool has_temp_settings_override;
 
     inline void Clear()
     {
         streaming_video_data = false;
+        half_resolution_video = false;
+        streaming_compressed_video = false;
 		has_temp_settings_override = false;
     }
 };
@@ -87,16 +110,26 @@ public:
     void handle_client_connection_stopped(int connection_id);
 
     /// When publishing controller data to all listening connections
-    /// we need to provide a callback that will fill out a data frame given:
+    /// we need to provide a callback that will fill out a stream packet given:
     /// * A \ref ServerControllerView we want to publish to all listening connections
     /// * A \ref ControllerStreamInfo that describes what info the connection wants
     /// This callback will be called for each listening connection
-    typedef void (*t_generate_controller_data_frame_for_stream)(
+    typedef void (*t_generate_controller_stream_packet)(
             const class ServerControllerView *controller_view,
             const ControllerStreamInfo *stream_info,
-            PSMoveProtocol::DeviceOutputDataFrame *data_frame);
-    void publish_controller_data_frame(
-        class ServerControllerView *controller_view, t_generate_controller_data_frame_for_stream callback);
+            struct ControllerStreamPacket *packet);
+    void publish_controller_stream_packet(
+        class ServerControllerView *controller_view, t_generate_controller_stream_packet callback);
+
+    /// Push a CONTROLLER_BUTTON_EVENT notification to every connection
+    /// streaming the given controller, the same tick the transition was
+    /// polled. Sent on the reliable channel independent of the data frame
+    /// cadence so a press can't be swallowed by throttling or a dropped frame
+    void publish_controller_button_event(
+        class ServerControllerView *controller_view,
+        unsigned int pressed_buttons,
+        unsigned int released_buttons,
+        unsigned int all_buttons);
 
     /// When publishing tracker data to all listening connections
     /// we need to provide a callback that will fill out a data frame given:
@@ -109,7 +142,15 @@ public:
         DeviceOutputDataFramePtr &data_frame);
     void publish_tracker_data_frame(
         class ServerTrackerView *tracker_view, t_generate_tracker_data_frame_for_stream callback);
-        
+
+    /// Push an MJPEG-encoded video frame to every connection that started
+    /// the given tracker's data stream with the compressed video option
+    void publish_tracker_video_frame(
+        class ServerTrackerView *tracker_view,
+        const unsigned char *jpeg_data, int jpeg_size,
+        int width, int height, int sequence_num);
+
+
     /// When publishing hmd data to all listening connections
     /// we need to provide a callback that will fill out a data frame given:
     /// * A \ref ServerHMDView we want to publish to all listening connections
@@ -0,0 +1,143 @@
+//-- includes -----
+#include "ServerTracer.h"
+#include "ServerLog.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <thread>
+
+//-- constants -----
+// Capacity of the event ring. At ~2000 slices/second from a fully
+// instrumented 4-tracker pipeline this holds a bit over a minute of capture.
+static const int k_max_trace_events = 131072;
+
+// Longest capture a client may request
+static const float k_max_capture_duration_seconds = 60.f;
+
+//-- statics -----
+struct TraceEvent
+{
+    const char *name;
+    unsigned long long start_microseconds;
+    unsigned long long duration_microseconds;
+    size_t thread_id_hash;
+};
+
+static TraceEvent g_trace_events[k_max_trace_events];
+static std::atomic_int g_trace_event_count(0);
+static std::atomic_bool g_bIsCapturing(false);
+static std::string g_capture_filename;
+static unsigned long long g_capture_end_microseconds = 0;
+
+//-- private prototypes -----
+static bool write_trace_file();
+
+//-- public interface -----
+namespace ServerTracer
+{
+    bool startCapture(const std::string &filename, float duration_seconds)
+    {
+        if (g_bIsCapturing.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        const float clamped_duration =
+            (duration_seconds > 0.f && duration_seconds <= k_max_capture_duration_seconds)
+            ? duration_seconds
+            : k_max_capture_duration_seconds;
+
+        g_capture_filename = filename;
+        g_capture_end_microseconds =
+            nowMicroseconds() + static_cast<unsigned long long>(clamped_duration*1000000.f);
+        g_trace_event_count.store(0, std::memory_order_release);
+        g_bIsCapturing.store(true, std::memory_order_release);
+
+        SERVER_LOG_INFO("ServerTracer") << "Started " << clamped_duration
+            << "s trace capture to: " << g_capture_filename;
+
+        return true;
+    }
+
+    bool getIsCapturing()
+    {
+        return g_bIsCapturing.load(std::memory_order_acquire);
+    }
+
+    void update()
+    {
+        if (g_bIsCapturing.load(std::memory_order_acquire) &&
+            nowMicroseconds() >= g_capture_end_microseconds)
+        {
+            // Stop recording before draining the ring so producer threads
+            // quit appending while the file is written
+            g_bIsCapturing.store(false, std::memory_order_release);
+
+            if (write_trace_file())
+            {
+                SERVER_LOG_INFO("ServerTracer") << "Wrote trace capture to: " << g_capture_filename;
+            }
+            else
+            {
+                SERVER_LOG_ERROR("ServerTracer") << "Failed to write trace capture to: " << g_capture_filename;
+            }
+        }
+    }
+
+    void addSlice(const char *name, unsigned long long start_microseconds, unsigned long long duration_microseconds)
+    {
+        const int event_index = g_trace_event_count.fetch_add(1, std::memory_order_acq_rel);
+
+        // Drop slices once the ring is full rather than wrapping - the head
+        // of a hitch investigation matters more than the tail
+        if (event_index < k_max_trace_events)
+        {
+            TraceEvent &trace_event = g_trace_events[event_index];
+
+            trace_event.name = name;
+            trace_event.start_microseconds = start_microseconds;
+            trace_event.duration_microseconds = duration_microseconds;
+            trace_event.thread_id_hash = std::hash<std::thread::id>()(std::this_thread::get_id());
+        }
+    }
+
+    unsigned long long nowMicroseconds()
+    {
+        return static_cast<unsigned long long>(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+};
+
+//-- private functions -----
+static bool write_trace_file()
+{
+    FILE *fp = fopen(g_capture_filename.c_str(), "wt");
+    if (fp == nullptr)
+    {
+        return false;
+    }
+
+    const int event_count = std::min(g_trace_event_count.load(std::memory_order_acquire), k_max_trace_events);
+
+    // Complete-event ("ph":"X") form of the chrome://tracing JSON array format
+    fprintf(fp, "[\n");
+    for (int event_index = 0; event_index < event_count; ++event_index)
+    {
+        const TraceEvent &trace_event = g_trace_events[event_index];
+
+        fprintf(fp, "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%llu,\"ts\":%llu,\"dur\":%llu}%s\n",
+            trace_event.name,
+            static_cast<unsigned long long>(trace_event.thread_id_hash),
+            trace_event.start_microseconds,
+            trace_event.duration_microseconds,
+            (event_index + 1 < event_count) ? "," : "");
+    }
+    fprintf(fp, "]\n");
+    fclose(fp);
+
+    return true;
+}
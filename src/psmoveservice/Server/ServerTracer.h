@@ -0,0 +1,69 @@
+#ifndef SERVER_TRACER_H
+#define SERVER_TRACER_H
+
+//-- includes -----
+#include "AllocationTracker.h"
+
+#include <string>
+
+//-- macros -----
+/// Times the enclosing scope and records it as one slice in the active trace
+/// capture. Costs one atomic load when no capture is running. Define
+/// PSMOVE_DISABLE_TRACING to compile the instrumentation out entirely.
+#if defined(PSMOVE_DISABLE_TRACING)
+#define SERVER_TRACE_SCOPE(name)
+#else
+#define SERVER_TRACE_SCOPE(name) ServerTracer::ScopeTracer _server_trace_scope(name)
+#endif
+
+//-- definitions -----
+/// Records named, timestamped slices from any service thread into a fixed
+/// ring of events and writes them out as chrome://tracing JSON when the
+/// capture window closes. Open the file at chrome://tracing (or ui.perfetto.dev)
+/// to see the pipeline timeline across threads.
+namespace ServerTracer
+{
+    /// Begin recording trace events for the given number of seconds.
+    /// Returns false when a capture is already running.
+    bool startCapture(const std::string &filename, float duration_seconds);
+
+    bool getIsCapturing();
+
+    /// Called once per service tick; closes out the capture and writes the
+    /// trace file once the capture window has elapsed
+    void update();
+
+    /// Record one complete slice. Timestamps are microseconds on the
+    /// steady_clock timebase. Safe to call from any thread.
+    void addSlice(const char *name, unsigned long long start_microseconds, unsigned long long duration_microseconds);
+
+    /// Microseconds since an arbitrary fixed epoch (steady_clock based)
+    unsigned long long nowMicroseconds();
+
+    class ScopeTracer
+    {
+    public:
+        ScopeTracer(const char *name)
+            : m_name(name)
+            , m_start_microseconds(getIsCapturing() ? nowMicroseconds() : 0)
+        {
+            AllocationTracker::pushScope(name);
+        }
+
+        ~ScopeTracer()
+        {
+            AllocationTracker::popScope();
+
+            if (m_start_microseconds != 0 && getIsCapturing())
+            {
+                addSlice(m_name, m_start_microseconds, nowMicroseconds() - m_start_microseconds);
+            }
+        }
+
+    private:
+        const char *m_name;
+        unsigned long long m_start_microseconds;
+    };
+};
+
+#endif // SERVER_TRACER_H
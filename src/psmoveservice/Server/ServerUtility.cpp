@@ -10,6 +10,15 @@
 #include <sstream>
 #include <iomanip>
 
+#ifdef _WIN32
+#include <windows.h>
+#include <avrt.h>
+#pragma comment(lib, "Avrt.lib")
+#else
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 #ifdef _MSC_VER
 #pragma warning (disable: 4996) // 'This function or variable may be unsafe': vsnprintf
 #define vsnprintf _vsnprintf
@@ -191,4 +200,120 @@ namespace ServerUtility
 
         return success;
     }
+
+    bool set_current_thread_affinity_mask(unsigned int affinity_mask)
+    {
+        bool success = false;
+
+        if (affinity_mask != 0)
+        {
+    #if defined(_WIN32)
+            success = SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(affinity_mask)) != 0;
+    #elif defined(__linux__)
+            cpu_set_t cpu_set;
+
+            CPU_ZERO(&cpu_set);
+            for (unsigned int core_index = 0; core_index < sizeof(affinity_mask)*8; ++core_index)
+            {
+                if ((affinity_mask & (1u << core_index)) != 0)
+                {
+                    CPU_SET(core_index, &cpu_set);
+                }
+            }
+
+            success = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) == 0;
+    #else
+            // OS X only exposes affinity hints, not hard masks
+            success = false;
+    #endif
+        }
+
+        return success;
+    }
+
+    bool set_current_thread_priority(int priority_offset)
+    {
+        bool success = true;
+
+        // Clamp to the supported range
+        if (priority_offset < -2)
+        {
+            priority_offset = -2;
+        }
+        if (priority_offset > 2)
+        {
+            priority_offset = 2;
+        }
+
+        if (priority_offset != 0)
+        {
+    #if defined(_WIN32)
+            int win32_priority = THREAD_PRIORITY_NORMAL;
+
+            switch (priority_offset)
+            {
+            case -2:
+                win32_priority = THREAD_PRIORITY_LOWEST;
+                break;
+            case -1:
+                win32_priority = THREAD_PRIORITY_BELOW_NORMAL;
+                break;
+            case 1:
+                win32_priority = THREAD_PRIORITY_ABOVE_NORMAL;
+                break;
+            case 2:
+                win32_priority = THREAD_PRIORITY_HIGHEST;
+                break;
+            }
+
+            success = SetThreadPriority(GetCurrentThread(), win32_priority) != 0;
+    #else
+            if (priority_offset > 0)
+            {
+                // Round-robin realtime scheduling. Raising priority typically
+                // needs elevated privileges; failure leaves the default policy.
+                sched_param params;
+                params.sched_priority = sched_get_priority_min(SCHED_RR) + (priority_offset - 1);
+
+                success = pthread_setschedparam(pthread_self(), SCHED_RR, &params) == 0;
+            }
+            else
+            {
+                // There is no per-thread way to drop below the default
+                // SCHED_OTHER priority that works across POSIX systems
+                success = false;
+            }
+    #endif
+        }
+
+        return success;
+    }
+
+    bool register_current_thread_multimedia_class(const char *task_name)
+    {
+        bool success = false;
+
+    #if defined(_WIN32)
+        // MMCSS moves the thread into the multimedia scheduling class so the
+        // compositor and other normal-priority work can't starve it under load
+        DWORD task_index = 0;
+
+        success = AvSetMmThreadCharacteristicsA(task_name, &task_index) != NULL;
+    #elif defined(__linux__)
+        // Nearest equivalent is first-in-first-out realtime scheduling.
+        // Raising into a realtime class needs CAP_SYS_NICE; on failure the
+        // thread keeps its current policy.
+        (void)task_name;
+
+        sched_param params;
+        params.sched_priority = sched_get_priority_min(SCHED_FIFO);
+
+        success = pthread_setschedparam(pthread_self(), SCHED_FIFO, &params) == 0;
+    #else
+        // OS X exposes no MMCSS equivalent short of time-constraint policies
+        (void)task_name;
+    #endif
+
+        return success;
+    }
 };
\ No newline at end of file
@@ -44,6 +44,25 @@ namespace ServerUtility
     /// \param addr_buf_size The size of the target buffer
     /// \return true of the string could be parse and the target array could hold the octets
     bool bluetooth_string_address_to_bytes(const std::string &addr, unsigned char *addr_buff, const int addr_buf_size);
+
+    /// Restricts the calling thread to the CPU cores set in the given bitmask
+    /// \param affinity_mask Bit N set = the thread may run on core N. 0 is a no-op.
+    /// \return true if the mask was applied (unsupported on OS X)
+    bool set_current_thread_affinity_mask(unsigned int affinity_mask);
+
+    /// Adjusts the scheduling priority of the calling thread
+    /// \param priority_offset 0 leaves the platform default, positive raises the
+    /// priority (+2 = highest), negative lowers it. May require elevated
+    /// privileges to raise on non-Windows platforms.
+    /// \return true if the priority change was applied
+    bool set_current_thread_priority(int priority_offset);
+
+    /// Registers the calling thread with the multimedia class scheduler
+    /// (MMCSS) on Windows so it keeps the CPU under compositor/desktop load.
+    /// \param task_name An MMCSS task name, e.g. "Games" or "Pro Audio"
+    /// \return true if the registration was applied. On Linux the nearest
+    /// SCHED_FIFO equivalent is attempted; on OS X this is a no-op.
+    bool register_current_thread_multimedia_class(const char *task_name);
 };
 
 #endif // SERVER_REQUEST_HANDLER_H
\ No newline at end of file
@@ -0,0 +1,211 @@
+//-- includes -----
+#include "ServiceClock.h"
+#include "ServerLog.h"
+
+#include <cmath>
+#include <thread>
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#define SERVICE_CLOCK_HAS_RDTSC 1
+#elif defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>
+#define SERVICE_CLOCK_HAS_RDTSC 1
+#else
+#define SERVICE_CLOCK_HAS_RDTSC 0
+#endif
+
+//-- constants -----
+// Length of the TSC calibration window. Long enough that steady_clock
+// granularity contributes well under the acceptance tolerance, short enough
+// not to show up in the startup phase table.
+static const int k_calibration_window_ms = 20;
+
+// The frequency measured over the two half-windows must agree this closely,
+// or the TSC is judged unreliable (non-invariant, migrating across sockets)
+// and the steady_clock fallback is used instead
+static const double k_calibration_tolerance = 0.01;
+
+// Sanity bounds on the measured TSC frequency
+static const double k_min_plausible_tsc_hz = 2.0e8;   // 200 MHz
+static const double k_max_plausible_tsc_hz = 1.0e10;  // 10 GHz
+
+// Upward drift rate of the hardware clock sync estimator. Downward jumps
+// snap immediately (a smaller offset means a lower-latency delivery, which
+// is closer to the truth); upward the offset only creeps, following genuine
+// clock skew while riding out delivery jitter.
+static const double k_hardware_sync_drift_alpha = 0.01;
+
+//-- globals -----
+// Seconds per TSC tick when the fast path is active, 0 otherwise
+static double g_seconds_per_tsc_tick = 0.0;
+
+// Raw stamp taken at calibrate(); now_seconds() measures from here
+static uint64_t g_calibration_raw = 0;
+
+// high_resolution_clock anchor taken at calibrate(), so synthesized time
+// points stay comparable with direct high_resolution_clock reads
+static std::chrono::time_point<std::chrono::high_resolution_clock> g_calibration_time_point;
+
+static bool g_calibrated = false;
+
+//-- private methods -----
+static uint64_t read_tsc()
+{
+#if SERVICE_CLOCK_HAS_RDTSC
+    return static_cast<uint64_t>(__rdtsc());
+#else
+    return 0;
+#endif
+}
+
+static uint64_t steady_clock_ns()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+#if SERVICE_CLOCK_HAS_RDTSC
+// Measure the TSC rate over one sleep window
+static double measure_tsc_frequency(const int window_ms)
+{
+    const uint64_t tsc_start = read_tsc();
+    const std::chrono::time_point<std::chrono::steady_clock> time_start = std::chrono::steady_clock::now();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(window_ms));
+
+    const uint64_t tsc_end = read_tsc();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - time_start;
+
+    return (elapsed.count() > 0.0)
+        ? static_cast<double>(tsc_end - tsc_start) / elapsed.count()
+        : 0.0;
+}
+#endif
+
+//-- public methods -----
+namespace ServiceClock
+{
+    void calibrate()
+    {
+#if SERVICE_CLOCK_HAS_RDTSC
+        // Two half-windows: the average is the frequency estimate, the
+        // disagreement is the reliability test
+        const double frequency_a = measure_tsc_frequency(k_calibration_window_ms / 2);
+        const double frequency_b = measure_tsc_frequency(k_calibration_window_ms / 2);
+        const double frequency = (frequency_a + frequency_b) * 0.5;
+
+        const bool bPlausible =
+            frequency >= k_min_plausible_tsc_hz && frequency <= k_max_plausible_tsc_hz;
+        const bool bStable =
+            bPlausible &&
+            fabs(frequency_a - frequency_b) <= frequency * k_calibration_tolerance;
+
+        if (bStable)
+        {
+            g_seconds_per_tsc_tick = 1.0 / frequency;
+
+            SERVER_LOG_INFO("ServiceClock::calibrate")
+                << "Using TSC fast path, measured frequency "
+                << frequency / 1.0e6 << " MHz";
+        }
+        else
+        {
+            g_seconds_per_tsc_tick = 0.0;
+
+            SERVER_LOG_WARNING("ServiceClock::calibrate")
+                << "TSC calibration unstable (" << frequency_a << " Hz vs "
+                << frequency_b << " Hz), falling back to steady_clock";
+        }
+#else
+        g_seconds_per_tsc_tick = 0.0;
+
+        SERVER_LOG_INFO("ServiceClock::calibrate")
+            << "No TSC on this platform, using steady_clock";
+#endif
+
+        g_calibration_raw = now_raw();
+        g_calibration_time_point = std::chrono::high_resolution_clock::now();
+        g_calibrated = true;
+    }
+
+    uint64_t now_raw()
+    {
+        return (g_seconds_per_tsc_tick > 0.0) ? read_tsc() : steady_clock_ns();
+    }
+
+    double raw_delta_seconds(const uint64_t older_raw, const uint64_t newer_raw)
+    {
+        const double ticks = static_cast<double>(newer_raw - older_raw);
+
+        return (g_seconds_per_tsc_tick > 0.0) ? ticks * g_seconds_per_tsc_tick : ticks * 1.0e-9;
+    }
+
+    double now_seconds()
+    {
+        return raw_delta_seconds(g_calibration_raw, now_raw());
+    }
+
+    uint64_t now_microseconds()
+    {
+        return static_cast<uint64_t>(now_seconds() * 1.0e6);
+    }
+
+    std::chrono::time_point<std::chrono::high_resolution_clock> now()
+    {
+        // Before calibration (tools, unit tests) fall through to the
+        // standard clock so timestamps are still monotonic and comparable
+        if (!g_calibrated)
+        {
+            return std::chrono::high_resolution_clock::now();
+        }
+
+        const std::chrono::nanoseconds elapsed(
+            static_cast<int64_t>(now_seconds() * 1.0e9));
+
+        return
+            g_calibration_time_point +
+            std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(elapsed);
+    }
+
+    bool getIsUsingTscFastPath()
+    {
+        return g_seconds_per_tsc_tick > 0.0;
+    }
+
+    void hardware_clock_sync_reset(HardwareClockSync &sync)
+    {
+        sync.offset_seconds = 0.0;
+        sync.bValid = false;
+    }
+
+    double hardware_clock_sync_update(
+        HardwareClockSync &sync,
+        const double hardware_seconds,
+        const double service_receive_seconds)
+    {
+        const double raw_offset = service_receive_seconds - hardware_seconds;
+
+        if (!sync.bValid)
+        {
+            sync.offset_seconds = raw_offset;
+            sync.bValid = true;
+        }
+        else if (raw_offset < sync.offset_seconds)
+        {
+            // A smaller offset can only mean this sample was delivered with
+            // less jitter than any before it - adopt it outright
+            sync.offset_seconds = raw_offset;
+        }
+        else
+        {
+            // Larger offsets are jitter until they persist; creep upward so
+            // genuine clock skew is still followed
+            sync.offset_seconds +=
+                k_hardware_sync_drift_alpha * (raw_offset - sync.offset_seconds);
+        }
+
+        return hardware_seconds + sync.offset_seconds;
+    }
+}
@@ -0,0 +1,71 @@
+#ifndef SERVICE_CLOCK_H
+#define SERVICE_CLOCK_H
+
+//-- includes -----
+#include <chrono>
+#include <cstdint>
+
+//-- definitions -----
+/// Service-wide monotonic clock.
+/// std::chrono::high_resolution_clock maps inconsistently across platforms
+/// (on Windows it may alias the system clock) and every call goes through the
+/// OS timer path. This module calibrates the CPU timestamp counter against
+/// std::chrono::steady_clock once at startup and serves timestamps from the
+/// TSC afterwards - a few cycles per read - falling back to steady_clock on
+/// platforms without an invariant TSC. All timestamps that feed filter
+/// delta-time should come from here so they share one time base, which is
+/// also the reference the hardware clock sync estimators map USB/Bluetooth
+/// device timestamps onto.
+namespace ServiceClock
+{
+    /// Measure the TSC frequency against steady_clock and pick the fast
+    /// path. Call once at service startup, before any timestamps are taken;
+    /// timestamps requested earlier fall back to high_resolution_clock.
+    void calibrate();
+
+    /// Raw clock ticks: TSC counts on the fast path, steady_clock
+    /// nanoseconds on the fallback. The cheapest stamp to take; convert
+    /// with raw_delta_seconds.
+    uint64_t now_raw();
+
+    /// Seconds elapsed between two raw stamps
+    double raw_delta_seconds(const uint64_t older_raw, const uint64_t newer_raw);
+
+    /// Seconds since calibrate()
+    double now_seconds();
+
+    /// Microseconds since calibrate()
+    uint64_t now_microseconds();
+
+    /// The service time as a high_resolution_clock time point, anchored at
+    /// calibrate() so values stay comparable with time points taken directly
+    /// from high_resolution_clock at call sites that haven't converted yet
+    std::chrono::time_point<std::chrono::high_resolution_clock> now();
+
+    /// True when timestamps are served from the calibrated TSC
+    bool getIsUsingTscFastPath();
+
+    /// Running offset estimate between a device hardware clock (USB frame
+    /// counter, Bluetooth controller timestamp) and the service clock.
+    /// One instance per device clock; owned by the device that reads the
+    /// hardware stamps.
+    struct HardwareClockSync
+    {
+        double offset_seconds; ///< service_seconds - hardware_seconds
+        bool bValid;           ///< false until the first sample arrives
+    };
+
+    void hardware_clock_sync_reset(HardwareClockSync &sync);
+
+    /// Fold one (hardware timestamp, service receive time) pair into the
+    /// offset estimate and return the hardware stamp mapped into service
+    /// seconds. Scheduling and transport jitter only ever delay the receive
+    /// time, so the estimator snaps to the minimum-latency envelope and
+    /// drifts upward slowly to follow clock skew.
+    double hardware_clock_sync_update(
+        HardwareClockSync &sync,
+        const double hardware_seconds,
+        const double service_receive_seconds);
+};
+
+#endif // SERVICE_CLOCK_H
@@ -0,0 +1,27 @@
+//-- includes -----
+#include "ServicePerfCounters.h"
+
+#include <assert.h>
+#include <atomic>
+
+//-- globals -----
+// Zero-initialized at static storage duration, no startup call needed
+static std::atomic<std::uint64_t> g_counters[ServicePerfCounters::k_counter_count];
+
+//-- public methods -----
+namespace ServicePerfCounters
+{
+    void increment(const eCounter counter, const std::uint64_t amount)
+    {
+        assert(counter >= 0 && counter < k_counter_count);
+
+        g_counters[counter].fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    std::uint64_t getCount(const eCounter counter)
+    {
+        assert(counter >= 0 && counter < k_counter_count);
+
+        return g_counters[counter].load(std::memory_order_relaxed);
+    }
+};
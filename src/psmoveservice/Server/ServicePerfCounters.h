@@ -0,0 +1,33 @@
+#ifndef SERVICE_PERF_COUNTERS_H
+#define SERVICE_PERF_COUNTERS_H
+
+//-- includes -----
+#include <cstdint>
+
+//-- definitions -----
+/// Always-on monotonic performance counters scraped through the
+/// GET_SERVICE_STATISTICS protocol request. Every update is a single relaxed
+/// atomic increment, cheap enough to leave enabled in production builds so
+/// fleet monitoring can poll the service every few seconds and compute rates
+/// from successive scrapes.
+namespace ServicePerfCounters
+{
+    enum eCounter
+    {
+        Counter_MainLoopTicks,          // Service update loop iterations
+        Counter_UdpDatagramsSent,       // Datagrams handed to the UDP socket
+        Counter_UdpDataFramesSent,      // Device data frames coalesced into those datagrams
+        Counter_UdpDataFramesDropped,   // Data frames dropped because they couldn't fit a datagram
+        Counter_DataFrameAllocations,   // Protobuf output data frames allocated on the publish path
+
+        k_counter_count
+    };
+
+    /// Add to one counter. Safe to call from any thread.
+    void increment(const eCounter counter, const std::uint64_t amount = 1);
+
+    /// Monotonic value of one counter since service startup
+    std::uint64_t getCount(const eCounter counter);
+};
+
+#endif // SERVICE_PERF_COUNTERS_H
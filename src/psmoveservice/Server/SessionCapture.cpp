@@ -0,0 +1,494 @@
+//-- includes -----
+#include "SessionCapture.h"
+#include "ControllerInputLog.h"
+#include "ServerLog.h"
+#include "ThreadCpuMonitor.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include <string.h>
+
+//-- constants -----
+// "PSSC" - PlayStation Session Capture
+static const unsigned int k_session_capture_magic = 0x43535350;
+static const unsigned int k_session_capture_version = 1;
+
+static const size_t k_session_capture_serial_size = 32;
+
+// Upper bound on chunks waiting for the writer thread. At 640x480 BGR this
+// is roughly ten camera frames - enough to ride out a disk stall without
+// letting a slow disk grow the service's memory without bound.
+static const size_t k_max_queued_bytes = 8 * 1024 * 1024;
+
+static const int k_max_camera_streams = 8;
+
+//-- private definitions -----
+struct SessionCaptureFileHeader
+{
+    unsigned int magic;
+    unsigned int version;
+    unsigned int camera_frame_divisor;
+    unsigned int reserved;
+};
+
+/// Payload of a controller stream info chunk
+struct SessionCaptureControllerInfo
+{
+    unsigned int device_type;
+    unsigned int report_size;
+    char serial[k_session_capture_serial_size];
+};
+
+struct SessionCaptureState
+{
+    std::atomic_bool is_recording;
+
+    std::thread writer_thread;
+    std::ofstream stream;
+
+    std::mutex queue_mutex;
+    std::condition_variable queue_signal;
+    std::deque<std::vector<unsigned char>> chunk_queue;
+    size_t queued_bytes;
+    bool bShutdownRequested;
+
+    std::chrono::time_point<std::chrono::high_resolution_clock> recording_start_time;
+    int camera_frame_divisor;
+    unsigned int camera_frame_counts[k_max_camera_streams];
+    std::vector<std::string> controller_serials;
+
+    std::atomic_ullong dropped_chunk_count;
+
+    SessionCaptureState()
+        : is_recording(false)
+        , queued_bytes(0)
+        , bShutdownRequested(false)
+        , camera_frame_divisor(1)
+        , dropped_chunk_count(0)
+    {
+        memset(camera_frame_counts, 0, sizeof(camera_frame_counts));
+    }
+};
+
+static SessionCaptureState g_capture_state;
+
+//-- private methods -----
+static unsigned long long
+recording_timestamp_us()
+{
+    const std::chrono::time_point<std::chrono::high_resolution_clock> now =
+        std::chrono::high_resolution_clock::now();
+
+    return static_cast<unsigned long long>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            now - g_capture_state.recording_start_time).count());
+}
+
+/// Serialize one chunk and hand it to the writer thread,
+/// dropping it if the queue is at capacity
+static void
+enqueue_chunk(
+    const unsigned int chunk_type,
+    const unsigned int stream_id,
+    const unsigned char *payload_part1, const size_t payload_part1_size,
+    const unsigned char *payload_part2, const size_t payload_part2_size)
+{
+    SessionCaptureChunkHeader header;
+    header.chunk_type = chunk_type;
+    header.stream_id = stream_id;
+    header.timestamp_us = recording_timestamp_us();
+    header.payload_size = static_cast<unsigned int>(payload_part1_size + payload_part2_size);
+
+    const size_t chunk_size = sizeof(header) + header.payload_size;
+
+    std::vector<unsigned char> chunk(chunk_size);
+    memcpy(chunk.data(), &header, sizeof(header));
+    memcpy(chunk.data() + sizeof(header), payload_part1, payload_part1_size);
+    if (payload_part2 != nullptr)
+    {
+        memcpy(chunk.data() + sizeof(header) + payload_part1_size, payload_part2, payload_part2_size);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(g_capture_state.queue_mutex);
+
+        if (g_capture_state.queued_bytes + chunk_size > k_max_queued_bytes)
+        {
+            // Never stall the pipeline on a slow disk - drop and count
+            ++g_capture_state.dropped_chunk_count;
+            return;
+        }
+
+        g_capture_state.queued_bytes += chunk_size;
+        g_capture_state.chunk_queue.push_back(std::move(chunk));
+    }
+
+    g_capture_state.queue_signal.notify_one();
+}
+
+static void
+writer_thread_proc()
+{
+    ThreadCpuMonitor::registerCurrentThread("session_capture");
+
+    while (true)
+    {
+        std::vector<unsigned char> chunk;
+
+        {
+            std::unique_lock<std::mutex> lock(g_capture_state.queue_mutex);
+
+            g_capture_state.queue_signal.wait(lock, []
+            {
+                return !g_capture_state.chunk_queue.empty() || g_capture_state.bShutdownRequested;
+            });
+
+            if (g_capture_state.chunk_queue.empty())
+            {
+                // Shutdown requested and the queue has drained
+                break;
+            }
+
+            chunk = std::move(g_capture_state.chunk_queue.front());
+            g_capture_state.chunk_queue.pop_front();
+            g_capture_state.queued_bytes -= chunk.size();
+        }
+
+        g_capture_state.stream.write(reinterpret_cast<const char *>(chunk.data()), chunk.size());
+    }
+
+    ThreadCpuMonitor::unregisterCurrentThread();
+}
+
+//-- public methods -----
+bool
+SessionCapture::startRecording(const std::string &filename, int camera_frame_divisor)
+{
+    if (g_capture_state.is_recording)
+    {
+        SERVER_LOG_WARNING("SessionCapture::startRecording") << "A session capture is already running";
+        return false;
+    }
+
+    g_capture_state.stream.open(filename, std::ios::binary | std::ios::trunc);
+    if (!g_capture_state.stream.is_open())
+    {
+        SERVER_LOG_ERROR("SessionCapture::startRecording") << "Failed to open capture file for writing: " << filename;
+        return false;
+    }
+
+    g_capture_state.camera_frame_divisor = std::max(camera_frame_divisor, 1);
+
+    SessionCaptureFileHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = k_session_capture_magic;
+    header.version = k_session_capture_version;
+    header.camera_frame_divisor = static_cast<unsigned int>(g_capture_state.camera_frame_divisor);
+    g_capture_state.stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    g_capture_state.recording_start_time = std::chrono::high_resolution_clock::now();
+    memset(g_capture_state.camera_frame_counts, 0, sizeof(g_capture_state.camera_frame_counts));
+    g_capture_state.controller_serials.clear();
+    g_capture_state.dropped_chunk_count = 0;
+    g_capture_state.bShutdownRequested = false;
+
+    g_capture_state.writer_thread = std::thread(writer_thread_proc);
+    g_capture_state.is_recording = true;
+
+    SERVER_LOG_INFO("SessionCapture::startRecording") <<
+        "Recording session to: " << filename <<
+        " (every " << g_capture_state.camera_frame_divisor << " camera frame(s))";
+
+    return true;
+}
+
+void
+SessionCapture::stopRecording()
+{
+    if (!g_capture_state.is_recording)
+    {
+        return;
+    }
+
+    // Stop accepting new chunks before draining the queue
+    g_capture_state.is_recording = false;
+
+    {
+        std::lock_guard<std::mutex> lock(g_capture_state.queue_mutex);
+        g_capture_state.bShutdownRequested = true;
+    }
+    g_capture_state.queue_signal.notify_one();
+    g_capture_state.writer_thread.join();
+
+    g_capture_state.stream.close();
+
+    SERVER_LOG_INFO("SessionCapture::stopRecording") <<
+        "Session capture stopped (" << g_capture_state.dropped_chunk_count << " chunks dropped)";
+}
+
+bool
+SessionCapture::getIsRecording()
+{
+    return g_capture_state.is_recording;
+}
+
+bool
+SessionCapture::shouldRecordCameraFrame(int tracker_id)
+{
+    if (!g_capture_state.is_recording ||
+        tracker_id < 0 || tracker_id >= k_max_camera_streams)
+    {
+        return false;
+    }
+
+    // Temporal downsample: only record every Nth frame of each tracker
+    const unsigned int frame_count = g_capture_state.camera_frame_counts[tracker_id]++;
+
+    return frame_count % static_cast<unsigned int>(g_capture_state.camera_frame_divisor) == 0;
+}
+
+void
+SessionCapture::recordCameraFrame(
+    int tracker_id,
+    const unsigned char *bgr_buffer,
+    int width, int height, int stride)
+{
+    if (!g_capture_state.is_recording)
+    {
+        return;
+    }
+
+    SessionCaptureCameraFrameInfo frame_info;
+    frame_info.width = width;
+    frame_info.height = height;
+    frame_info.stride = stride;
+
+    enqueue_chunk(
+        ChunkType_CameraFrame,
+        static_cast<unsigned int>(tracker_id),
+        reinterpret_cast<const unsigned char *>(&frame_info), sizeof(frame_info),
+        bgr_buffer, static_cast<size_t>(stride) * static_cast<size_t>(height));
+}
+
+void
+SessionCapture::recordControllerReport(
+    const std::string &serial,
+    const CommonDeviceState::eDeviceType device_type,
+    const unsigned char *report_bytes,
+    const size_t report_size)
+{
+    if (!g_capture_state.is_recording)
+    {
+        return;
+    }
+
+    // Controller streams are keyed by a writer-assigned index;
+    // the first report from a serial emits the stream info chunk
+    unsigned int stream_id = 0;
+    bool bNewStream = true;
+
+    for (size_t serial_index = 0; serial_index < g_capture_state.controller_serials.size(); ++serial_index)
+    {
+        if (g_capture_state.controller_serials[serial_index] == serial)
+        {
+            stream_id = static_cast<unsigned int>(serial_index);
+            bNewStream = false;
+            break;
+        }
+    }
+
+    if (bNewStream)
+    {
+        stream_id = static_cast<unsigned int>(g_capture_state.controller_serials.size());
+        g_capture_state.controller_serials.push_back(serial);
+
+        SessionCaptureControllerInfo controller_info;
+        memset(&controller_info, 0, sizeof(controller_info));
+        controller_info.device_type = static_cast<unsigned int>(device_type);
+        controller_info.report_size = static_cast<unsigned int>(report_size);
+        strncpy(controller_info.serial, serial.c_str(), k_session_capture_serial_size - 1);
+
+        enqueue_chunk(
+            ChunkType_ControllerInfo,
+            stream_id,
+            reinterpret_cast<const unsigned char *>(&controller_info), sizeof(controller_info),
+            nullptr, 0);
+    }
+
+    enqueue_chunk(
+        ChunkType_ControllerReport,
+        stream_id,
+        report_bytes, report_size,
+        nullptr, 0);
+}
+
+unsigned long long
+SessionCapture::getDroppedChunkCount()
+{
+    return g_capture_state.dropped_chunk_count;
+}
+
+bool
+SessionCapture::exportControllerInputLog(
+    const std::string &capture_path,
+    const std::string &serial,
+    const std::string &out_path)
+{
+    SessionCaptureReader reader;
+
+    if (!reader.open(capture_path))
+    {
+        return false;
+    }
+
+    // First pass: find the stream info chunk for the requested serial
+    SessionCaptureChunkHeader header;
+    std::vector<unsigned char> payload;
+    bool bFoundStream = false;
+    unsigned int stream_id = 0;
+    SessionCaptureControllerInfo controller_info;
+
+    while (reader.readNextChunk(header, payload))
+    {
+        if (header.chunk_type == ChunkType_ControllerInfo &&
+            payload.size() == sizeof(controller_info))
+        {
+            memcpy(&controller_info, payload.data(), sizeof(controller_info));
+            controller_info.serial[k_session_capture_serial_size - 1] = '\0';
+
+            if (serial == controller_info.serial)
+            {
+                stream_id = header.stream_id;
+                bFoundStream = true;
+                break;
+            }
+        }
+    }
+
+    if (!bFoundStream)
+    {
+        SERVER_LOG_ERROR("SessionCapture::exportControllerInputLog") <<
+            "No controller stream with serial " << serial << " in capture: " << capture_path;
+        return false;
+    }
+
+    ControllerInputLogWriter log_writer(
+        out_path,
+        static_cast<CommonDeviceState::eDeviceType>(controller_info.device_type),
+        controller_info.report_size,
+        controller_info.serial);
+
+    if (!log_writer.getIsOpen())
+    {
+        return false;
+    }
+
+    // Second pass: copy the stream's reports with their original timestamps
+    reader.rewind();
+
+    int report_count = 0;
+    while (reader.readNextChunk(header, payload))
+    {
+        if (header.chunk_type == ChunkType_ControllerReport &&
+            header.stream_id == stream_id &&
+            payload.size() == controller_info.report_size)
+        {
+            log_writer.writeReportWithTimestamp(payload.data(), header.timestamp_us);
+            ++report_count;
+        }
+    }
+
+    SERVER_LOG_INFO("SessionCapture::exportControllerInputLog") <<
+        "Exported " << report_count << " input reports for controller " << serial << " to: " << out_path;
+
+    return report_count > 0;
+}
+
+// -- SessionCaptureReader --
+SessionCaptureReader::SessionCaptureReader()
+    : m_first_chunk_offset(0)
+{
+}
+
+bool
+SessionCaptureReader::open(const std::string &path)
+{
+    bool bSuccess = false;
+
+    m_stream.open(path, std::ios::binary);
+
+    if (m_stream.is_open())
+    {
+        SessionCaptureFileHeader header;
+
+        m_stream.read(reinterpret_cast<char *>(&header), sizeof(header));
+
+        if (m_stream.good() &&
+            header.magic == k_session_capture_magic &&
+            header.version == k_session_capture_version)
+        {
+            m_first_chunk_offset = m_stream.tellg();
+            bSuccess = true;
+        }
+        else
+        {
+            SERVER_LOG_ERROR("SessionCaptureReader::open") << "Not a valid session capture: " << path;
+            m_stream.close();
+        }
+    }
+    else
+    {
+        SERVER_LOG_ERROR("SessionCaptureReader::open") << "Failed to open session capture for reading: " << path;
+    }
+
+    return bSuccess;
+}
+
+bool
+SessionCaptureReader::getIsOpen() const
+{
+    return m_stream.is_open();
+}
+
+bool
+SessionCaptureReader::readNextChunk(
+    SessionCaptureChunkHeader &out_header,
+    std::vector<unsigned char> &out_payload)
+{
+    if (!m_stream.is_open())
+    {
+        return false;
+    }
+
+    m_stream.read(reinterpret_cast<char *>(&out_header), sizeof(out_header));
+    if (!m_stream.good())
+    {
+        return false;
+    }
+
+    out_payload.resize(out_header.payload_size);
+    m_stream.read(reinterpret_cast<char *>(out_payload.data()), out_header.payload_size);
+    if (!m_stream.good())
+    {
+        // Truncated trailing chunk (recording was cut off mid-write)
+        return false;
+    }
+
+    return true;
+}
+
+void
+SessionCaptureReader::rewind()
+{
+    if (m_stream.is_open())
+    {
+        m_stream.clear();
+        m_stream.seekg(m_first_chunk_offset);
+    }
+}
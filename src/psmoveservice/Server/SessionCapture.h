@@ -0,0 +1,114 @@
+#ifndef SESSION_CAPTURE_H
+#define SESSION_CAPTURE_H
+
+//-- includes -----
+#include "DeviceInterface.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+//-- definitions -----
+/// On-disk layout of one chunk header in a session capture file.
+/// Chunks follow the file header back to back; each carries its own
+/// payload size so readers can skip chunk types they don't care about.
+struct SessionCaptureChunkHeader
+{
+    unsigned int chunk_type;
+    unsigned int stream_id;
+    unsigned long long timestamp_us; // since the start of the recording
+    unsigned int payload_size;
+};
+
+/// Payload prefix for camera frame chunks; the BGR pixel data follows
+struct SessionCaptureCameraFrameInfo
+{
+    int width;
+    int height;
+    int stride;
+};
+
+/// Records a whole service session - camera frames (temporally downsampled)
+/// and raw controller input reports, all on one timestamp timebase - into a
+/// single streamed binary file so field-reported performance problems can be
+/// replayed on the bench. Chunks are serialized on the calling thread into a
+/// bounded queue and written out by a background thread; when the queue is
+/// full the chunk is dropped and counted instead of stalling the pipeline.
+///
+/// Replay: VirtualTracker plays back camera frame chunks at their original
+/// timing, and exportControllerInputLog() converts a controller stream into
+/// an input report log a VirtualController can replay.
+namespace SessionCapture
+{
+    enum eChunkType
+    {
+        ChunkType_CameraFrame = 1,
+        ChunkType_ControllerInfo = 2,
+        ChunkType_ControllerReport = 3,
+    };
+
+    /// Open the capture file and start the background writer thread.
+    /// Only every camera_frame_divisor-th frame of each tracker is recorded.
+    /// Returns false when a recording is already running.
+    bool startRecording(const std::string &filename, int camera_frame_divisor);
+
+    /// Flush the queue, join the writer thread and close the file
+    void stopRecording();
+
+    bool getIsRecording();
+
+    /// Advance the tracker's frame counter and report whether this frame
+    /// should be recorded (every camera_frame_divisor-th frame). Call once
+    /// per polled frame so callers can skip the BGR conversion for frames
+    /// that won't be kept; costs one atomic load when no recording is running.
+    bool shouldRecordCameraFrame(int tracker_id);
+
+    /// Record one BGR camera frame (gated by shouldRecordCameraFrame)
+    void recordCameraFrame(
+        int tracker_id,
+        const unsigned char *bgr_buffer,
+        int width, int height, int stride);
+
+    /// Record one raw controller input report. The first report from each
+    /// serial also emits a stream info chunk with the device type and
+    /// report size needed for replay.
+    void recordControllerReport(
+        const std::string &serial,
+        const CommonDeviceState::eDeviceType device_type,
+        const unsigned char *report_bytes,
+        const size_t report_size);
+
+    /// Chunks discarded because the writer queue was full
+    unsigned long long getDroppedChunkCount();
+
+    /// Extract the input report stream of the controller with the given
+    /// serial into a log that a VirtualController can replay
+    bool exportControllerInputLog(
+        const std::string &capture_path,
+        const std::string &serial,
+        const std::string &out_path);
+};
+
+/// Streams chunks back out of a session capture file. Loads nothing up
+/// front - callers iterate with readNextChunk() and rewind() to loop,
+/// so replaying long captures doesn't hold the frames in memory.
+class SessionCaptureReader
+{
+public:
+    SessionCaptureReader();
+
+    bool open(const std::string &path);
+    bool getIsOpen() const;
+
+    /// Read the next chunk header and payload; returns false at end of file
+    bool readNextChunk(SessionCaptureChunkHeader &out_header, std::vector<unsigned char> &out_payload);
+
+    /// Seek back to the first chunk
+    void rewind();
+
+private:
+    std::ifstream m_stream;
+    std::streampos m_first_chunk_offset;
+};
+
+#endif // SESSION_CAPTURE_H
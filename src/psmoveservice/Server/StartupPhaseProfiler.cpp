@@ -0,0 +1,112 @@
+//-- includes -----
+#include "StartupPhaseProfiler.h"
+#include "ServerLog.h"
+
+#include <assert.h>
+#include <chrono>
+
+//-- globals -----
+struct StartupPhaseEntry
+{
+    const char *phase_name;
+    float duration_milliseconds;
+};
+
+static StartupPhaseEntry g_phases[StartupPhaseProfiler::k_max_phases];
+static int g_phase_count= 0;
+static bool g_phase_running= false;
+static bool g_completed= false;
+static std::chrono::time_point<std::chrono::high_resolution_clock> g_phase_start_time;
+
+//-- private methods -----
+// Close the currently running phase, charging it the elapsed time
+static void close_running_phase()
+{
+    if (g_phase_running)
+    {
+        const std::chrono::duration<float, std::milli> elapsed=
+            std::chrono::high_resolution_clock::now() - g_phase_start_time;
+
+        g_phases[g_phase_count - 1].duration_milliseconds= elapsed.count();
+        g_phase_running= false;
+    }
+}
+
+//-- public methods -----
+namespace StartupPhaseProfiler
+{
+    void beginPhase(const char *phase_name)
+    {
+        assert(phase_name != nullptr);
+
+        if (g_completed)
+        {
+            return;
+        }
+
+        close_running_phase();
+
+        if (g_phase_count < k_max_phases)
+        {
+            g_phases[g_phase_count].phase_name= phase_name;
+            g_phases[g_phase_count].duration_milliseconds= 0.f;
+            ++g_phase_count;
+
+            g_phase_start_time= std::chrono::high_resolution_clock::now();
+            g_phase_running= true;
+        }
+    }
+
+    void complete()
+    {
+        if (g_completed)
+        {
+            return;
+        }
+
+        close_running_phase();
+        g_completed= true;
+
+        SERVER_LOG_INFO("StartupPhaseProfiler") <<
+            "Startup completed in " << getTotalMilliseconds() << "ms across " <<
+            g_phase_count << " phases:";
+
+        for (int phase_index= 0; phase_index < g_phase_count; ++phase_index)
+        {
+            SERVER_LOG_INFO("StartupPhaseProfiler") <<
+                "  " << g_phases[phase_index].phase_name << ": " <<
+                g_phases[phase_index].duration_milliseconds << "ms";
+        }
+    }
+
+    int getPhaseCount()
+    {
+        return g_phase_count;
+    }
+
+    const char *getPhaseName(int phase_index)
+    {
+        assert(phase_index >= 0 && phase_index < g_phase_count);
+
+        return g_phases[phase_index].phase_name;
+    }
+
+    float getPhaseMilliseconds(int phase_index)
+    {
+        assert(phase_index >= 0 && phase_index < g_phase_count);
+
+        return g_phases[phase_index].duration_milliseconds;
+    }
+
+    float getTotalMilliseconds()
+    {
+        float total_milliseconds= 0.f;
+
+        for (int phase_index= 0; phase_index < g_phase_count; ++phase_index)
+        {
+            total_milliseconds+= g_phases[phase_index].duration_milliseconds;
+        }
+
+        return total_milliseconds;
+    }
+};
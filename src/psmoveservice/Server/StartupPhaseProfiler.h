@@ -0,0 +1,32 @@
+#ifndef STARTUP_PHASE_PROFILER_H
+#define STARTUP_PHASE_PROFILER_H
+
+//-- definitions -----
+/// One-shot profiler for the service startup sequence. Each call to
+/// beginPhase() closes the phase that was running and starts timing the
+/// next, so the instrumented startup code stays a sequence of one-liners.
+/// complete() closes the final phase and logs the per-phase timing table
+/// through ServerLog; the recorded phases stay available afterwards so the
+/// GET_SERVICE_STATISTICS response can carry a machine-readable copy.
+/// Single threaded by design - startup runs entirely on the service thread.
+namespace StartupPhaseProfiler
+{
+    enum { k_max_phases= 16 };
+
+    /// Close the running phase (if any) and start timing phase_name.
+    /// phase_name must point at storage that outlives the service
+    /// (string literals); phases past k_max_phases are dropped.
+    void beginPhase(const char *phase_name);
+
+    /// Close the running phase and log the startup timing table.
+    /// Further beginPhase() calls are ignored.
+    void complete();
+
+    /// Number of recorded phases (stops growing once complete() ran)
+    int getPhaseCount();
+    const char *getPhaseName(int phase_index);
+    float getPhaseMilliseconds(int phase_index);
+    float getTotalMilliseconds();
+};
+
+#endif // STARTUP_PHASE_PROFILER_H
@@ -0,0 +1,178 @@
+//-- includes -----
+#include "ThreadCpuMonitor.h"
+
+#include <chrono>
+#include <mutex>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <time.h>
+#endif
+
+//-- private definitions -----
+struct RegisteredThread
+{
+    std::string name;
+
+#ifdef _WIN32
+    DWORD thread_id;
+    HANDLE thread_handle;
+#else
+    pthread_t thread_id;
+    clockid_t cpu_clock;
+#endif
+
+    // CPU time observed at the previous sampleAll() call
+    unsigned long long last_cpu_us;
+    bool bHaveLastSample;
+};
+
+//-- globals -----
+static std::mutex g_registry_mutex;
+static std::vector<RegisteredThread> g_registry;
+static std::chrono::time_point<std::chrono::high_resolution_clock> g_last_sample_time;
+static bool g_bHaveLastSampleTime = false;
+
+//-- private methods -----
+/// Total (user + kernel) CPU time the thread has consumed, in microseconds
+static unsigned long long
+read_thread_cpu_us(const RegisteredThread &entry)
+{
+#ifdef _WIN32
+    FILETIME creation_time, exit_time, kernel_time, user_time;
+
+    if (GetThreadTimes(entry.thread_handle, &creation_time, &exit_time, &kernel_time, &user_time))
+    {
+        ULARGE_INTEGER kernel_100ns, user_100ns;
+
+        kernel_100ns.LowPart = kernel_time.dwLowDateTime;
+        kernel_100ns.HighPart = kernel_time.dwHighDateTime;
+        user_100ns.LowPart = user_time.dwLowDateTime;
+        user_100ns.HighPart = user_time.dwHighDateTime;
+
+        return (kernel_100ns.QuadPart + user_100ns.QuadPart) / 10;
+    }
+
+    return 0;
+#else
+    struct timespec cpu_time;
+
+    if (clock_gettime(entry.cpu_clock, &cpu_time) == 0)
+    {
+        return
+            static_cast<unsigned long long>(cpu_time.tv_sec) * 1000000ULL +
+            static_cast<unsigned long long>(cpu_time.tv_nsec) / 1000ULL;
+    }
+
+    return 0;
+#endif
+}
+
+//-- public methods -----
+void
+ThreadCpuMonitor::registerCurrentThread(const std::string &thread_name)
+{
+    RegisteredThread entry;
+
+    entry.name = thread_name;
+    entry.last_cpu_us = 0;
+    entry.bHaveLastSample = false;
+
+#ifdef _WIN32
+    entry.thread_id = GetCurrentThreadId();
+
+    // GetCurrentThread() is a pseudo handle only meaningful on this thread -
+    // duplicate it so the sampler can query the thread from the service thread
+    if (!DuplicateHandle(
+            GetCurrentProcess(), GetCurrentThread(),
+            GetCurrentProcess(), &entry.thread_handle,
+            THREAD_QUERY_INFORMATION, FALSE, 0))
+    {
+        return;
+    }
+#else
+    entry.thread_id = pthread_self();
+
+    if (pthread_getcpuclockid(entry.thread_id, &entry.cpu_clock) != 0)
+    {
+        return;
+    }
+#endif
+
+    std::lock_guard<std::mutex> lock(g_registry_mutex);
+    g_registry.push_back(entry);
+}
+
+void
+ThreadCpuMonitor::unregisterCurrentThread()
+{
+#ifdef _WIN32
+    const DWORD thread_id = GetCurrentThreadId();
+#else
+    const pthread_t thread_id = pthread_self();
+#endif
+
+    std::lock_guard<std::mutex> lock(g_registry_mutex);
+
+    for (auto iter = g_registry.begin(); iter != g_registry.end(); ++iter)
+    {
+#ifdef _WIN32
+        if (iter->thread_id == thread_id)
+        {
+            CloseHandle(iter->thread_handle);
+            g_registry.erase(iter);
+            break;
+        }
+#else
+        if (pthread_equal(iter->thread_id, thread_id))
+        {
+            g_registry.erase(iter);
+            break;
+        }
+#endif
+    }
+}
+
+void
+ThreadCpuMonitor::sampleAll(std::vector<ThreadCpuSample> &out_samples)
+{
+    const std::chrono::time_point<std::chrono::high_resolution_clock> now =
+        std::chrono::high_resolution_clock::now();
+
+    std::lock_guard<std::mutex> lock(g_registry_mutex);
+
+    const unsigned long long wall_delta_us =
+        g_bHaveLastSampleTime
+        ? static_cast<unsigned long long>(
+            std::chrono::duration_cast<std::chrono::microseconds>(now - g_last_sample_time).count())
+        : 0;
+
+    out_samples.clear();
+    out_samples.reserve(g_registry.size());
+
+    for (RegisteredThread &entry : g_registry)
+    {
+        const unsigned long long cpu_us = read_thread_cpu_us(entry);
+
+        ThreadCpuSample sample;
+        sample.thread_name = entry.name;
+        sample.cpu_fraction = 0.f;
+
+        if (entry.bHaveLastSample && wall_delta_us > 0 && cpu_us >= entry.last_cpu_us)
+        {
+            sample.cpu_fraction =
+                static_cast<float>(cpu_us - entry.last_cpu_us) / static_cast<float>(wall_delta_us);
+        }
+
+        entry.last_cpu_us = cpu_us;
+        entry.bHaveLastSample = true;
+
+        out_samples.push_back(sample);
+    }
+
+    g_last_sample_time = now;
+    g_bHaveLastSampleTime = true;
+}
@@ -0,0 +1,37 @@
+#ifndef THREAD_CPU_MONITOR_H
+#define THREAD_CPU_MONITOR_H
+
+//-- includes -----
+#include <string>
+#include <vector>
+
+//-- definitions -----
+/// Tracks per-thread CPU usage of the service's named worker threads so
+/// operators can see which subsystem is saturating a core. Threads register
+/// themselves on entry to their thread proc; sampleAll() reads each thread's
+/// OS-reported CPU time and converts the delta since the previous sample
+/// into a fraction of one core. Scraped through GET_SERVICE_STATISTICS and
+/// rendered as utilization bars in the configtool tracker settings.
+namespace ThreadCpuMonitor
+{
+    struct ThreadCpuSample
+    {
+        std::string thread_name;
+        float cpu_fraction; // of one core over the sample interval, 0..1
+    };
+
+    /// Register the calling thread under a display name.
+    /// Call once at the top of the thread proc.
+    void registerCurrentThread(const std::string &thread_name);
+
+    /// Remove the calling thread from the registry.
+    /// Call before the thread proc returns.
+    void unregisterCurrentThread();
+
+    /// CPU usage of every registered thread since the previous sampleAll()
+    /// call. The first call (and the first call after a thread registers)
+    /// reports that thread at zero.
+    void sampleAll(std::vector<ThreadCpuSample> &out_samples);
+};
+
+#endif // THREAD_CPU_MONITOR_H
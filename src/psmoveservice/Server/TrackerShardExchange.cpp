@@ -0,0 +1,281 @@
+//-- includes -----
+#include "TrackerShardExchange.h"
+#include "ControllerManager.h"
+#include "ServerControllerView.h"
+#include "ServerLog.h"
+#include "SharedTrackerState.h" // BOOST_INTERPROCESS_SHARED_DIR_PATH
+
+#include <boost/interprocess/shared_memory_object.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <cstring>
+
+//-- constants -----
+static const char *k_shard_exchange_shared_memory_name = "psmove_tracker_shard_exchange";
+
+// How often a secondary shard retries attaching to the exchange while the
+// primary instance hasn't created it yet
+static const float k_attach_retry_period_seconds = 1.f;
+
+static_assert(
+    TrackerShardExchange::k_max_controllers >= ControllerManager::k_max_devices,
+    "shard exchange needs a slot for every controller");
+
+//-- definitions -----
+/// Memory layout of the exchange block. One seqlock protected observation
+/// slot per (shard, controller) pair - each shard only ever writes its own
+/// row, so no two processes contend on the same slot.
+struct TrackerShardExchangeSlot
+{
+    /// Odd while a write to the observation is in flight (seqlock).
+    /// Zero means the slot was never written.
+    volatile unsigned int write_sequence;
+    TrackerShardObservation observation;
+};
+
+struct TrackerShardExchangeHeader
+{
+    int shard_count;
+    TrackerShardExchangeSlot slots[TrackerShardExchange::k_max_shards][TrackerShardExchange::k_max_controllers];
+
+    TrackerShardExchangeHeader()
+        : shard_count(0)
+    {
+        std::memset(slots, 0, sizeof(slots));
+    }
+};
+
+//-- public methods -----
+TrackerShardExchange::TrackerShardExchange()
+    : m_shard_index(0)
+    , m_shard_count(1)
+    , m_shared_memory_object(nullptr)
+    , m_region(nullptr)
+    , m_last_attach_attempt()
+    , m_bAttachAttempted(false)
+{
+}
+
+TrackerShardExchange::~TrackerShardExchange()
+{
+    dispose();
+}
+
+bool TrackerShardExchange::initialize(int shard_index, int shard_count)
+{
+    bool bSuccess = true;
+
+    m_shard_index = shard_index;
+    m_shard_count = shard_count;
+
+    if (m_shard_index == 0)
+    {
+        // The primary shard owns the block lifetime
+        try
+        {
+            SERVER_LOG_INFO("TrackerShardExchange::initialize")
+                << "Allocating shard exchange shared memory: " << k_shard_exchange_shared_memory_name;
+
+            // Make sure the shared memory block has been removed first
+            boost::interprocess::shared_memory_object::remove(k_shard_exchange_shared_memory_name);
+
+            // Allow non admin-level processed to access the shared memory
+            boost::interprocess::permissions permissions;
+            permissions.set_unrestricted();
+
+            // Create the shared memory object
+            m_shared_memory_object =
+                new boost::interprocess::shared_memory_object(
+                    boost::interprocess::create_only,
+                    k_shard_exchange_shared_memory_name,
+                    boost::interprocess::read_write,
+                    permissions);
+
+            // Resize the shared memory
+            m_shared_memory_object->truncate(sizeof(TrackerShardExchangeHeader));
+
+            // Map all of the shared memory for read/write access
+            m_region = new boost::interprocess::mapped_region(*m_shared_memory_object, boost::interprocess::read_write);
+
+            // Initialize the exchange (call constructor using placement new)
+            TrackerShardExchangeHeader *header = new (getHeader()) TrackerShardExchangeHeader();
+
+            header->shard_count = m_shard_count;
+        }
+        catch (boost::interprocess::interprocess_exception* e)
+        {
+            dispose();
+            SERVER_LOG_ERROR("TrackerShardExchange::initialize")
+                << "Failed to allocate shard exchange shared memory: " << k_shard_exchange_shared_memory_name
+                << ", reason: " << e->what();
+            bSuccess = false;
+        }
+    }
+    else
+    {
+        // Secondary shards attach to the primary's block; if the primary
+        // isn't running yet this quietly retries from the publish path
+        ensureAttached();
+    }
+
+    return bSuccess;
+}
+
+void TrackerShardExchange::dispose()
+{
+    if (m_region != nullptr)
+    {
+        delete m_region;
+        m_region = nullptr;
+    }
+
+    if (m_shared_memory_object != nullptr)
+    {
+        delete m_shared_memory_object;
+        m_shared_memory_object = nullptr;
+    }
+
+    // Only the primary shard removes the block - a secondary restarting
+    // shouldn't tear the exchange out from under the others
+    if (m_shard_index == 0)
+    {
+        boost::interprocess::shared_memory_object::remove(k_shard_exchange_shared_memory_name);
+    }
+}
+
+void TrackerShardExchange::publishControllerObservation(
+    int controller_id,
+    const ControllerOpticalPoseEstimation *pose_estimation)
+{
+    if (controller_id < 0 || controller_id >= k_max_controllers || !ensureAttached())
+    {
+        return;
+    }
+
+    TrackerShardExchangeSlot &slot = getHeader()->slots[m_shard_index][controller_id];
+    TrackerShardObservation &observation = slot.observation;
+
+    ++slot.write_sequence; // odd: write in progress
+
+    observation.bCurrentlyTracking = pose_estimation->bCurrentlyTracking;
+    observation.position_cm = pose_estimation->position_cm;
+    observation.orientation = pose_estimation->orientation;
+    observation.bOrientationValid = pose_estimation->bOrientationValid;
+    observation.screen_area = pose_estimation->projection.screen_area;
+
+    if (pose_estimation->bCurrentlyTracking && pose_estimation->bValidTimestamps)
+    {
+        // Re-express the high resolution clock visibility timestamp as
+        // steady-clock microseconds so the primary can age it against its
+        // own steady clock
+        const std::chrono::duration<long long, std::micro> age_us =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::high_resolution_clock::now() - pose_estimation->last_visible_timestamp);
+        const long long now_us =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+
+        observation.capture_timestamp_us = static_cast<unsigned long long>(now_us - age_us.count());
+    }
+    else
+    {
+        observation.capture_timestamp_us = 0;
+    }
+
+    ++slot.write_sequence; // even: stable
+}
+
+bool TrackerShardExchange::readControllerObservation(
+    int shard_index,
+    int controller_id,
+    TrackerShardObservation &out_observation) const
+{
+    if (m_region == nullptr ||
+        shard_index < 0 || shard_index >= k_max_shards ||
+        controller_id < 0 || controller_id >= k_max_controllers)
+    {
+        return false;
+    }
+
+    const TrackerShardExchangeSlot &slot = getHeader()->slots[shard_index][controller_id];
+
+    // Retry a couple of times if the copy raced a write, same as the shared
+    // video frame readers; a slot that has never been written stays invalid
+    for (int attempt = 0; attempt < 3; ++attempt)
+    {
+        const unsigned int sequence_begin = slot.write_sequence;
+
+        if (sequence_begin == 0 || (sequence_begin & 1) != 0)
+        {
+            continue;
+        }
+
+        out_observation = slot.observation;
+
+        if (slot.write_sequence == sequence_begin)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//-- private methods -----
+TrackerShardExchangeHeader *TrackerShardExchange::getHeader() const
+{
+    return reinterpret_cast<TrackerShardExchangeHeader *>(m_region->get_address());
+}
+
+bool TrackerShardExchange::ensureAttached()
+{
+    if (m_region != nullptr)
+    {
+        return true;
+    }
+
+    // Don't hammer the (exception throwing) open while the primary is down
+    const std::chrono::time_point<std::chrono::steady_clock> now = std::chrono::steady_clock::now();
+    const std::chrono::duration<float> time_since_attempt = now - m_last_attach_attempt;
+
+    if (m_bAttachAttempted && time_since_attempt.count() < k_attach_retry_period_seconds)
+    {
+        return false;
+    }
+
+    m_last_attach_attempt = now;
+
+    try
+    {
+        m_shared_memory_object =
+            new boost::interprocess::shared_memory_object(
+                boost::interprocess::open_only,
+                k_shard_exchange_shared_memory_name,
+                boost::interprocess::read_write);
+
+        m_region = new boost::interprocess::mapped_region(*m_shared_memory_object, boost::interprocess::read_write);
+
+        SERVER_LOG_INFO("TrackerShardExchange::ensureAttached")
+            << "Shard " << m_shard_index << " attached to the tracker shard exchange";
+    }
+    catch (boost::interprocess::interprocess_exception* e)
+    {
+        (void)e;
+
+        if (m_shared_memory_object != nullptr)
+        {
+            delete m_shared_memory_object;
+            m_shared_memory_object = nullptr;
+        }
+
+        if (!m_bAttachAttempted)
+        {
+            SERVER_LOG_WARNING("TrackerShardExchange::ensureAttached")
+                << "Shard exchange not created yet (is the primary instance running?), will keep retrying";
+        }
+    }
+
+    m_bAttachAttempted = true;
+
+    return m_region != nullptr;
+}
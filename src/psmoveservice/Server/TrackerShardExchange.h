@@ -0,0 +1,92 @@
+#ifndef TRACKER_SHARD_EXCHANGE_H
+#define TRACKER_SHARD_EXCHANGE_H
+
+//-- includes -----
+#include "DeviceInterface.h"
+
+#include <chrono>
+
+//-- pre-declarations -----
+namespace boost {
+    namespace interprocess {
+        class shared_memory_object;
+        class mapped_region;
+    }
+}
+
+//-- definitions -----
+/// One optical observation published by a tracker shard for one controller
+struct TrackerShardObservation
+{
+    bool bCurrentlyTracking;
+    CommonDevicePosition position_cm;
+    CommonDeviceQuaternion orientation;
+    bool bOrientationValid;
+    // Average projection area across the shard's contributing trackers,
+    // the same visibility weight the multicam triangulation uses
+    float screen_area;
+    // Steady-clock microseconds when the newest contributing camera frame
+    // was captured. All shards run on the same host so readers can compare
+    // it against their own steady clock to age the observation.
+    unsigned long long capture_timestamp_us;
+};
+
+/// Shared memory exchange that lets multiple service instances ("shards")
+/// each drive a subset of the cameras on rigs too large for one process.
+/// Every secondary shard publishes its per-controller multicam optical
+/// estimate into its own slot each tick; the primary shard (index 0) folds
+/// the fresh remote observations into its own estimate before filtering.
+/// Slots are seqlock protected the same way the shared video frames are,
+/// so a stalled reader can at worst see a stale observation, never block
+/// a writer.
+class TrackerShardExchange
+{
+public:
+    static const int k_max_shards = 8;
+    // Comfortably above ControllerManager::k_max_devices (static_assert'd
+    // in the translation unit)
+    static const int k_max_controllers = 8;
+
+    TrackerShardExchange();
+    ~TrackerShardExchange();
+
+    /// The primary shard creates the shared memory block, secondary shards
+    /// attach to it (retrying quietly until the primary comes up)
+    bool initialize(int shard_index, int shard_count);
+    void dispose();
+
+    inline int getShardIndex() const
+    { return m_shard_index; }
+    inline int getShardCount() const
+    { return m_shard_count; }
+
+    /// Publish this shard's multicam optical estimate for the given controller
+    void publishControllerObservation(
+        int controller_id,
+        const struct ControllerOpticalPoseEstimation *pose_estimation);
+
+    /// Copy out the given shard's observation for the given controller.
+    /// Returns false if the exchange isn't attached, the slot was never
+    /// written, or a consistent copy couldn't be made.
+    bool readControllerObservation(
+        int shard_index,
+        int controller_id,
+        TrackerShardObservation &out_observation) const;
+
+private:
+    struct TrackerShardExchangeHeader *getHeader() const;
+    bool ensureAttached();
+
+    int m_shard_index;
+    int m_shard_count;
+
+    boost::interprocess::shared_memory_object *m_shared_memory_object;
+    boost::interprocess::mapped_region *m_region;
+
+    // Throttles the secondary shard re-attach attempts while the primary
+    // hasn't created the block yet
+    std::chrono::time_point<std::chrono::steady_clock> m_last_attach_attempt;
+    bool m_bAttachAttempted;
+};
+
+#endif // TRACKER_SHARD_EXCHANGE_H
@@ -0,0 +1,152 @@
+//-- includes -----
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+
+#include "HSVRangeThreshold.h"
+#include "unit_test.h"
+
+//-- constants -----
+// One pixel per hue value in OpenCV's [0,180] convention. Wide enough that
+// the SSE kernel path runs with a scalar tail remainder.
+static const int k_hue_sweep_width = 181;
+
+//-- public interface -----
+bool run_hsv_threshold_unit_tests()
+{
+	UNIT_TEST_MODULE_BEGIN("hsv_threshold")
+		UNIT_TEST_MODULE_CALL_TEST(hsv_threshold_test_range_mask_wrap);
+		UNIT_TEST_MODULE_CALL_TEST(hsv_threshold_test_range_mask_full_circle);
+		UNIT_TEST_MODULE_CALL_TEST(hsv_threshold_test_class_lut_full_circle);
+	UNIT_TEST_MODULE_END()
+}
+
+//-- private functions -----
+/// Fill a single-row HSV buffer with one pixel per hue value at the given
+/// saturation and value
+static void
+build_hue_sweep_row(unsigned char *hsv_pixels, unsigned char saturation, unsigned char value)
+{
+	for (int hue = 0; hue < k_hue_sweep_width; ++hue)
+	{
+		hsv_pixels[hue*3 + 0] = static_cast<unsigned char>(hue);
+		hsv_pixels[hue*3 + 1] = saturation;
+		hsv_pixels[hue*3 + 2] = value;
+	}
+}
+
+bool
+hsv_threshold_test_range_mask_wrap()
+{
+	UNIT_TEST_BEGIN("range mask hue wrap")
+
+	// hue_min > hue_max is the kernel's wrap convention: pass when
+	// hue >= 170 or hue <= 10
+	const HSVRangeThreshold wrap_threshold = { 170, 10, 100, 255, 100, 255 };
+
+	unsigned char hsv_pixels[k_hue_sweep_width * 3];
+	unsigned char mask_pixels[k_hue_sweep_width];
+
+	build_hue_sweep_row(hsv_pixels, 200, 200);
+	computeHSVRangeMask(
+		hsv_pixels, k_hue_sweep_width * 3,
+		mask_pixels, k_hue_sweep_width,
+		k_hue_sweep_width, 1,
+		wrap_threshold);
+
+	for (int hue = 0; success && hue < k_hue_sweep_width; ++hue)
+	{
+		const unsigned char expected = (hue >= 170 || hue <= 10) ? 0xFF : 0x00;
+
+		success = mask_pixels[hue] == expected;
+		assert(success);
+	}
+
+	UNIT_TEST_COMPLETE()
+}
+
+bool
+hsv_threshold_test_range_mask_full_circle()
+{
+	UNIT_TEST_BEGIN("range mask full hue circle")
+
+	// The threshold a maxed-out hue range slider (center +/- 90) produces.
+	// Folding that range would collapse to hue_min == hue_max, which the
+	// kernel reads as a single-hue test, so the conversion emits [0,180]
+	// explicitly - every hue must pass, gated only by saturation and value.
+	const HSVRangeThreshold full_circle_threshold = { 0, 180, 100, 255, 100, 255 };
+
+	unsigned char hsv_pixels[k_hue_sweep_width * 3];
+	unsigned char mask_pixels[k_hue_sweep_width];
+
+	build_hue_sweep_row(hsv_pixels, 200, 200);
+	computeHSVRangeMask(
+		hsv_pixels, k_hue_sweep_width * 3,
+		mask_pixels, k_hue_sweep_width,
+		k_hue_sweep_width, 1,
+		full_circle_threshold);
+
+	for (int hue = 0; success && hue < k_hue_sweep_width; ++hue)
+	{
+		success = mask_pixels[hue] == 0xFF;
+		assert(success);
+	}
+
+	// The saturation/value gates still apply at the full hue circle
+	if (success)
+	{
+		build_hue_sweep_row(hsv_pixels, 50, 200);
+		computeHSVRangeMask(
+			hsv_pixels, k_hue_sweep_width * 3,
+			mask_pixels, k_hue_sweep_width,
+			k_hue_sweep_width, 1,
+			full_circle_threshold);
+
+		for (int hue = 0; success && hue < k_hue_sweep_width; ++hue)
+		{
+			success = mask_pixels[hue] == 0x00;
+			assert(success);
+		}
+	}
+
+	UNIT_TEST_COMPLETE()
+}
+
+bool
+hsv_threshold_test_class_lut_full_circle()
+{
+	UNIT_TEST_BEGIN("class lut full hue circle")
+
+	// The same full-circle threshold flows into the multi-color classifier -
+	// every hue bit of its class must be set in the prebuilt hue table
+	const HSVRangeThreshold thresholds[2] = {
+		{ 0, 180, 100, 255, 100, 255 }, // full hue circle
+		{ 50, 70, 100, 255, 100, 255 }  // green
+	};
+	const unsigned char labels[2] = { 1, 2 };
+
+	HSVColorClassLUT class_lut;
+	buildHSVColorClassLUT(thresholds, 2, class_lut);
+
+	unsigned char hsv_pixels[k_hue_sweep_width * 3];
+	unsigned char label_pixels[k_hue_sweep_width];
+
+	build_hue_sweep_row(hsv_pixels, 200, 200);
+	computeHSVColorLabelMaskLUT(
+		hsv_pixels, k_hue_sweep_width * 3,
+		label_pixels, k_hue_sweep_width,
+		k_hue_sweep_width, 1,
+		class_lut,
+		labels);
+
+	// First matching threshold wins, so the full-circle class claims every
+	// hue - including the ones inside the green range
+	for (int hue = 0; success && hue < k_hue_sweep_width; ++hue)
+	{
+		success = label_pixels[hue] == 1;
+		assert(success);
+	}
+
+	UNIT_TEST_COMPLETE()
+}
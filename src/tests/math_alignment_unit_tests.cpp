@@ -12,6 +12,7 @@ bool run_math_alignment_unit_tests()
 {
 	UNIT_TEST_MODULE_BEGIN("math_alignment")
 		UNIT_TEST_MODULE_CALL_TEST(math_alignment_test_best_fit_exponential);
+		UNIT_TEST_MODULE_CALL_TEST(math_alignment_timed_best_fit_exponential);
 	UNIT_TEST_MODULE_END()
 }
 
@@ -43,7 +44,40 @@ math_alignment_test_best_fit_exponential()
 	success = is_nearly_equal(curve.x(), -0.00402157f, k_normal_epsilon);
 	assert(success);
 	success = is_nearly_equal(curve.y(), 0.4488802f, k_normal_epsilon);
-	assert(success);	
-	
+	assert(success);
+
+	UNIT_TEST_COMPLETE()
+}
+
+bool
+math_alignment_timed_best_fit_exponential()
+{
+	UNIT_TEST_BEGIN("best_fit_exponential timing floor")
+
+	const int k_sample_count = 10;
+	const int k_fit_iteration_count = 1000;
+	Eigen::Vector2f samples[k_sample_count] = {
+		Eigen::Vector2f(2161.6f, 0.00055f),
+		Eigen::Vector2f(1726.9f, 0.0011f),
+		Eigen::Vector2f(1124.6f, 0.00028f),
+		Eigen::Vector2f(704.2f, 0.00051f),
+		Eigen::Vector2f(367.1f, 0.0163f),
+		Eigen::Vector2f(262.2f, 0.2343f),
+		Eigen::Vector2f(172.9f, 0.529f),
+		Eigen::Vector2f(139.1f, 1.8f),
+		Eigen::Vector2f(108.5f, 1.316f),
+		Eigen::Vector2f(68.85f, 0.9238f)
+	};
+
+	// A generous ceiling (~5x the reference machine's median) so only a real
+	// regression in the fit math trips it, not scheduler noise
+	UNIT_TEST_TIMED_BLOCK_BEGIN(9, 25000.0)
+		for (int i = 0; i < k_fit_iteration_count; ++i)
+		{
+			Eigen::Vector2f curve;
+			eigen_alignment_fit_least_squares_exponential(samples, k_sample_count, &curve);
+		}
+	UNIT_TEST_TIMED_BLOCK_END()
+
 	UNIT_TEST_COMPLETE()
 }
\ No newline at end of file
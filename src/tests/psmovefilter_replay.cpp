@@ -0,0 +1,697 @@
+// Offline batch re-filtering over recorded controller sample streams.
+//
+// Runs each input session through one or more IPoseFilter configurations at
+// full speed (no realtime pacing), writing a filtered pose CSV per
+// session/filter pair plus per-run timing statistics. Sessions are processed
+// in parallel across worker threads, so a library of captures can be A/B'd
+// against filter tuning changes in minutes, entirely offline.
+//
+// Input files use the same CSV sample format test_kalman_filter consumes:
+// a device type line ("psmove" or "dualshock4"), a column header line, then
+// one TIME..GYRO_Z row per sample. The noise statistics the filter constants
+// are derived from come from a stationary capture when one is given via
+// --stationary, otherwise from the session stream itself.
+#include "DeviceInterface.h"
+#include "KalmanPoseFilter.h"
+#include "CompoundPoseFilter.h"
+#include "MathAlignment.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#if _MSC_VER
+#define strncasecmp(a, b, n) _strnicmp(a,b,n)
+#endif
+
+enum eControllerSampleFields
+{
+	FIELD_TIME,
+	FIELD_POSITION_X,
+	FIELD_POSITION_Y,
+	FIELD_POSITION_Z,
+	FIELD_AREA,
+	FIELD_ORIENTATION_W,
+	FIELD_ORIENTATION_X,
+	FIELD_ORIENTATION_Y,
+	FIELD_ORIENTATION_Z,
+	FIELD_ACCELEROMETER_X,
+	FIELD_ACCELEROMETER_Y,
+	FIELD_ACCELEROMETER_Z,
+	FIELD_MAGNETOMETER_X,
+	FIELD_MAGNETOMETER_Y,
+	FIELD_MAGNETOMETER_Z,
+	FIELD_GYROSCOPE_X,
+	FIELD_GYROSCOPE_Y,
+	FIELD_GYROSCOPE_Z,
+
+	FIELD_COUNT
+};
+
+struct ControllerSample
+{
+	float time; // seconds
+
+	// Optical readings in the world reference frame
+	float pos[3]; // cm
+	float area;
+	float ori[4];
+
+	// Sensor readings in the controller's reference frame
+	float acc[3]; // g-units
+	float mag[3]; // unit vector
+	float gyro[3]; // rad/s
+};
+static_assert(sizeof(ControllerSample) == sizeof(float)*FIELD_COUNT, "incorrect field count");
+
+// A named filter configuration the replay can run a session through
+struct FilterSpec
+{
+	const char *name;
+	bool bFullKalman; // monolithic KalmanPoseFilter instead of a compound filter
+	OrientationFilterType orientation_filter_type;
+	PositionFilterType position_filter_type;
+};
+
+static const FilterSpec k_filter_specs[] = {
+	{ "kalman", true, OrientationFilterTypeKalman, PositionFilterTypeKalman },
+	{ "compound-kalman", false, OrientationFilterTypeKalman, PositionFilterTypeKalman },
+	{ "complementary-marg", false, OrientationFilterTypeComplementaryMARG, PositionFilterTypeComplimentaryOpticalIMU },
+	{ "madgwick-marg", false, OrientationFilterTypeMadgwickMARG, PositionFilterTypeComplimentaryOpticalIMU },
+	{ "lowpass-optical", false, OrientationFilterTypeComplementaryMARG, PositionFilterTypeLowPassOptical },
+};
+static const int k_filter_spec_count = sizeof(k_filter_specs) / sizeof(k_filter_specs[0]);
+
+//-- sample stream -----
+class SampleStream
+{
+public:
+	SampleStream()
+		: m_controllerType(CommonDeviceState::PSMove)
+	{
+	}
+
+	bool load(const char *filename)
+	{
+		char line[512];
+		float columns[FIELD_COUNT];
+
+		FILE *fp = fopen(filename, "rt");
+		if (fp == nullptr)
+		{
+			return false;
+		}
+
+		line[sizeof(line) - 1] = 0;
+
+		// Device type line
+		if (fgets(line, sizeof(line) - 1, fp) != nullptr)
+		{
+			if (strncasecmp(line, "psmove", 6) == 0)
+			{
+				m_controllerType = CommonDeviceState::PSMove;
+			}
+			else if (strncasecmp(line, "dualshock4", 10) == 0)
+			{
+				m_controllerType = CommonDeviceState::PSDualShock4;
+			}
+			else
+			{
+				fclose(fp);
+				return false;
+			}
+		}
+
+		// Skip the column header line, then read the sample rows
+		fgets(line, sizeof(line) - 1, fp);
+		while (fgets(line, sizeof(line) - 1, fp) != nullptr)
+		{
+			const size_t len = strlen(line);
+			const char *last_start = &line[0];
+			int valid_columns = 0;
+
+			size_t cursor = 0;
+			while (cursor < len && valid_columns < FIELD_COUNT)
+			{
+				if (line[cursor] == ',' || line[cursor] == '\n')
+				{
+					line[cursor] = '\0';
+					columns[valid_columns] = static_cast<float>(atof(last_start));
+
+					cursor++;
+					valid_columns++;
+					last_start = &line[cursor];
+				}
+
+				cursor++;
+			}
+
+			if (valid_columns == FIELD_COUNT)
+			{
+				ControllerSample sample;
+
+				memcpy(&sample, columns, sizeof(float)*FIELD_COUNT);
+
+				// Normalize the magnetometer readings
+				float mag_scale = sqrtf(
+					sample.mag[0] * sample.mag[0] +
+					sample.mag[1] * sample.mag[1] +
+					sample.mag[2] * sample.mag[2]);
+				if (mag_scale > k_real_epsilon)
+				{
+					sample.mag[0] /= mag_scale;
+					sample.mag[1] /= mag_scale;
+					sample.mag[2] /= mag_scale;
+				}
+
+				// The recorded orientations use bulb-facing-the-camera as
+				// identity; undo that so they match the filter's upright
+				// identity pose (same convention as test_kalman_filter)
+				if (m_controllerType == CommonDeviceState::PSMove)
+				{
+					Eigen::Quaternionf artificial_rotation(Eigen::AngleAxisf(-k_real_half_pi, Eigen::Vector3f(1.f, 0.f, 0.f)));
+					Eigen::Quaternionf original_quat(sample.ori[0], sample.ori[1], sample.ori[2], sample.ori[3]);
+					Eigen::Quaternionf rotated_quat = (original_quat * artificial_rotation).normalized();
+
+					sample.ori[0] = rotated_quat.w();
+					sample.ori[1] = rotated_quat.x();
+					sample.ori[2] = rotated_quat.y();
+					sample.ori[3] = rotated_quat.z();
+				}
+
+				m_samples.push_back(sample);
+			}
+		}
+
+		fclose(fp);
+
+		return m_samples.size() > 1;
+	}
+
+	CommonDeviceState::eDeviceType getControllerType() const
+	{
+		return m_controllerType;
+	}
+
+	size_t getSampleCount() const
+	{
+		return m_samples.size();
+	}
+
+	const ControllerSample &getSample(size_t index) const
+	{
+		return m_samples.at(index);
+	}
+
+	void computeSliceStatistics(
+		const int field_index,
+		Eigen::Vector3f *out_mean,
+		Eigen::Vector3f *out_variance) const
+	{
+		std::vector<Eigen::Vector3f> sample_vectors;
+		for (const ControllerSample &sample : m_samples)
+		{
+			const float *raw_sample = reinterpret_cast<const float *>(&sample);
+
+			sample_vectors.push_back(
+				Eigen::Vector3f(raw_sample[field_index], raw_sample[field_index + 1], raw_sample[field_index + 2]));
+		}
+
+		Eigen::Vector3f mean, variance;
+		eigen_vector3f_compute_mean_and_variance(
+			sample_vectors.data(),
+			static_cast<int>(sample_vectors.size()),
+			&mean,
+			&variance);
+
+		if (out_mean)
+		{
+			*out_mean = mean;
+		}
+
+		if (out_variance)
+		{
+			*out_variance = variance;
+		}
+	}
+
+	float computeMeanTimeDelta() const
+	{
+		float previous_time = -1.f;
+		float mean_dt = 0.f;
+
+		for (const ControllerSample &sample : m_samples)
+		{
+			if (previous_time >= 0.f)
+			{
+				mean_dt += sample.time - previous_time;
+			}
+
+			previous_time = sample.time;
+		}
+
+		mean_dt /= static_cast<float>(m_samples.size() - 1);
+
+		return mean_dt;
+	}
+
+private:
+	std::vector<ControllerSample> m_samples;
+	CommonDeviceState::eDeviceType m_controllerType;
+};
+
+//-- filter construction -----
+// Derive the filter constants from the stationary capture's noise statistics,
+// the same quantities the live service pulls from the controller calibration
+static void
+build_filter_constants(
+	const SampleStream &stationary_stream,
+	const CommonDeviceState::eDeviceType controller_type,
+	PoseFilterSpace **out_pose_filter_space,
+	PoseFilterConstants &constants)
+{
+	PoseFilterSpace *pose_filter_space = new PoseFilterSpace();
+
+	if (controller_type == CommonDeviceState::PSDualShock4)
+	{
+		pose_filter_space->setIdentityGravity(Eigen::Vector3f(0.f, 0.922760189f, -0.385374635f));
+		pose_filter_space->setIdentityMagnetometer(Eigen::Vector3f::Zero()); // No magnetometer on DS4
+	}
+	else
+	{
+		pose_filter_space->setIdentityGravity(Eigen::Vector3f(0.f, 0.f, -1.f));
+		pose_filter_space->setIdentityMagnetometer(Eigen::Vector3f(0.234017432f, 0.873125494f, 0.42765367f));
+	}
+	pose_filter_space->setCalibrationTransform(*k_eigen_identity_pose_upright);
+	pose_filter_space->setSensorTransform(*k_eigen_sensor_transform_identity);
+
+	constants.orientation_constants.mean_update_time_delta = stationary_stream.computeMeanTimeDelta();
+	constants.orientation_constants.gravity_calibration_direction = pose_filter_space->getGravityCalibrationDirection();
+	constants.orientation_constants.magnetometer_calibration_direction = pose_filter_space->getMagnetometerCalibrationDirection();
+	stationary_stream.computeSliceStatistics(
+		FIELD_GYROSCOPE_X,
+		&constants.orientation_constants.gyro_drift,
+		&constants.orientation_constants.gyro_variance);
+	if (controller_type == CommonDeviceState::PSDualShock4)
+	{
+		constants.orientation_constants.magnetometer_drift = Eigen::Vector3f::Zero();
+		constants.orientation_constants.magnetometer_variance = Eigen::Vector3f::Zero();
+	}
+	else
+	{
+		constants.orientation_constants.magnetometer_drift = Eigen::Vector3f::Zero();
+		stationary_stream.computeSliceStatistics(
+			FIELD_MAGNETOMETER_X,
+			nullptr,
+			&constants.orientation_constants.magnetometer_variance);
+	}
+	constants.orientation_constants.orientation_variance_curve.A = 0.44888f;
+	constants.orientation_constants.orientation_variance_curve.B = -0.00402f;
+	constants.orientation_constants.orientation_variance_curve.MaxValue = 1.0f;
+	constants.orientation_constants.orientation_variance_curve.buildLUT();
+
+	Eigen::Vector3f accelerometer_drift;
+	stationary_stream.computeSliceStatistics(
+		FIELD_ACCELEROMETER_X,
+		&accelerometer_drift,
+		&constants.position_constants.accelerometer_variance);
+	constants.position_constants.accelerometer_drift =
+		accelerometer_drift - Eigen::Vector3f(0.f, 1.f, 0.f);
+	constants.position_constants.accelerometer_noise_radius = 0.0139137721f;
+	constants.position_constants.max_velocity = 1.0f;
+	constants.position_constants.mean_update_time_delta = stationary_stream.computeMeanTimeDelta();
+	constants.position_constants.gravity_calibration_direction = pose_filter_space->getGravityCalibrationDirection();
+	constants.position_constants.position_variance_curve.A = 0.44888f;
+	constants.position_constants.position_variance_curve.B = -0.00402f;
+	constants.position_constants.position_variance_curve.MaxValue = 1.0f;
+	constants.position_constants.position_variance_curve.buildLUT();
+
+	*out_pose_filter_space = pose_filter_space;
+}
+
+static IPoseFilter *
+create_filter(
+	const FilterSpec &spec,
+	const CommonDeviceState::eDeviceType controller_type,
+	const PoseFilterConstants &constants,
+	const Eigen::Vector3f &initial_position,
+	const Eigen::Quaternionf &initial_orientation)
+{
+	if (spec.bFullKalman)
+	{
+		KalmanPoseFilter *filter =
+			(controller_type == CommonDeviceState::PSDualShock4)
+			? static_cast<KalmanPoseFilter *>(new KalmanPoseFilterDS4())
+			: static_cast<KalmanPoseFilter *>(new KalmanPoseFilterPSMove());
+		filter->init(constants, initial_position, initial_orientation);
+
+		return filter;
+	}
+	else
+	{
+		CompoundPoseFilter *filter = new CompoundPoseFilter();
+		filter->init(
+			controller_type,
+			spec.orientation_filter_type, spec.position_filter_type,
+			constants,
+			initial_position, initial_orientation);
+
+		return filter;
+	}
+}
+
+//-- replay jobs -----
+// One session/filter pair queued for a worker thread
+struct ReplayJob
+{
+	const SampleStream *session;
+	std::string session_name; // session filename with directory and extension stripped
+	const FilterSpec *spec;
+};
+
+struct ReplayJobResult
+{
+	bool bSuccess;
+	size_t sample_count;
+	double stream_seconds; // recorded duration of the session
+	double filter_seconds; // wall time spent inside the filter updates
+};
+
+static ReplayJobResult
+run_replay_job(const ReplayJob &job, const std::string &output_dir, const SampleStream *stationary_stream)
+{
+	ReplayJobResult result;
+	result.bSuccess = false;
+	result.sample_count = job.session->getSampleCount();
+	result.stream_seconds = 0.0;
+	result.filter_seconds = 0.0;
+
+	const SampleStream &session = *job.session;
+	const CommonDeviceState::eDeviceType controller_type = session.getControllerType();
+
+	const ControllerSample &initial_sample = session.getSample(0);
+	const Eigen::Vector3f initial_pos(initial_sample.pos[0], initial_sample.pos[1], initial_sample.pos[2]);
+	const Eigen::Quaternionf initial_ori(initial_sample.ori[0], initial_sample.ori[1], initial_sample.ori[2], initial_sample.ori[3]);
+
+	// Derive the noise statistics from the stationary capture when one was
+	// given; a moving session's own statistics fold motion into the variance
+	const SampleStream &constants_stream =
+		(stationary_stream != nullptr) ? *stationary_stream : session;
+
+	PoseFilterSpace *pose_filter_space = nullptr;
+	PoseFilterConstants constants;
+	build_filter_constants(constants_stream, controller_type, &pose_filter_space, constants);
+
+	IPoseFilter *pose_filter =
+		create_filter(*job.spec, controller_type, constants, initial_pos, initial_ori);
+
+	const std::string output_path =
+		output_dir + "/" + job.session_name + "_" + job.spec->name + ".csv";
+	FILE *fp = fopen(output_path.c_str(), "wt");
+	if (fp == nullptr)
+	{
+		delete pose_filter;
+		delete pose_filter_space;
+
+		return result;
+	}
+
+	fprintf(fp, "TIME, POS_X, POS_Y, POS_Z, VEL_X, VEL_Y, VEL_Z, ORI_W, ORI_X, ORI_Y, ORI_Z, AVEL_X, AVEL_Y, AVEL_Z\n");
+
+	float last_time = session.getSample(0).time - session.computeMeanTimeDelta();
+
+	for (size_t sample_index = 0; sample_index < session.getSampleCount(); ++sample_index)
+	{
+		const ControllerSample &sample = session.getSample(sample_index);
+		const float dT = sample.time - last_time;
+		last_time = sample.time;
+
+		PoseSensorPacket sensorPacket;
+		sensorPacket.imu_accelerometer_g_units = Eigen::Vector3f(sample.acc[0], sample.acc[1], sample.acc[2]);
+		sensorPacket.imu_gyroscope_rad_per_sec = Eigen::Vector3f(sample.gyro[0], sample.gyro[1], sample.gyro[2]);
+		sensorPacket.imu_magnetometer_unit = Eigen::Vector3f(sample.mag[0], sample.mag[1], sample.mag[2]);
+		sensorPacket.optical_orientation = Eigen::Quaternionf(sample.ori[0], sample.ori[1], sample.ori[2], sample.ori[3]);
+		sensorPacket.tracking_projection_area_px_sqr = sample.area;
+		sensorPacket.optical_position_cm = Eigen::Vector3f(sample.pos[0], sample.pos[1], sample.pos[2]);
+
+		// Only the filter math itself is timed - the CSV write and packet
+		// staging aren't part of what's being A/B'd
+		const std::chrono::time_point<std::chrono::high_resolution_clock> update_start =
+			std::chrono::high_resolution_clock::now();
+
+		const PoseFilterPacket &filterPacket =
+			pose_filter_space->createFilterPacket(sensorPacket, pose_filter);
+		pose_filter->update(dT, filterPacket);
+
+		result.filter_seconds +=
+			std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - update_start).count();
+
+		const Eigen::Vector3f pos = pose_filter->getPositionCm();
+		const Eigen::Vector3f vel = pose_filter->getVelocityCmPerSec();
+		const Eigen::Quaternionf quat = pose_filter->getOrientation();
+		const Eigen::Vector3f ang_vel = pose_filter->getAngularVelocityRadPerSec();
+
+		fprintf(fp, "%f, %f, %f, %f, %f, %f, %f, %f, %f, %f, %f, %f, %f, %f\n",
+			sample.time,
+			pos.x(), pos.y(), pos.z(),
+			vel.x(), vel.y(), vel.z(),
+			quat.w(), quat.x(), quat.y(), quat.z(),
+			ang_vel.x(), ang_vel.y(), ang_vel.z());
+	}
+
+	fclose(fp);
+
+	result.stream_seconds =
+		session.getSample(session.getSampleCount() - 1).time - session.getSample(0).time;
+	result.bSuccess = true;
+
+	delete pose_filter;
+	delete pose_filter_space;
+
+	return result;
+}
+
+//-- main -----
+static std::string
+strip_to_basename(const std::string &path)
+{
+	size_t slash = path.find_last_of("/\\");
+	std::string name = (slash != std::string::npos) ? path.substr(slash + 1) : path;
+
+	size_t dot = name.find_last_of('.');
+	if (dot != std::string::npos)
+	{
+		name = name.substr(0, dot);
+	}
+
+	return name;
+}
+
+static const FilterSpec *
+find_filter_spec(const char *name)
+{
+	for (int spec_index = 0; spec_index < k_filter_spec_count; ++spec_index)
+	{
+		if (strcmp(k_filter_specs[spec_index].name, name) == 0)
+		{
+			return &k_filter_specs[spec_index];
+		}
+	}
+
+	return nullptr;
+}
+
+static void
+print_usage()
+{
+	printf("usage: psmovefilter_replay <output_dir> <session1.csv> [session2.csv ...]\n");
+	printf("           [--filters name1,name2,...] [--threads N] [--stationary capture.csv]\n");
+	printf("\n");
+	printf("Re-runs recorded controller sample sessions through pose filter\n");
+	printf("configurations at full speed and writes one filtered pose CSV per\n");
+	printf("session/filter pair into output_dir.\n");
+	printf("\n");
+	printf("available filters (default: kalman,complementary-marg):\n");
+	for (int spec_index = 0; spec_index < k_filter_spec_count; ++spec_index)
+	{
+		printf("  %s\n", k_filter_specs[spec_index].name);
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	if (argc < 3)
+	{
+		print_usage();
+		return -1;
+	}
+
+	const std::string output_dir = argv[1];
+	std::vector<std::string> session_paths;
+	std::vector<const FilterSpec *> specs;
+	std::string stationary_path;
+	int thread_count = static_cast<int>(std::thread::hardware_concurrency());
+
+	for (int arg_index = 2; arg_index < argc; ++arg_index)
+	{
+		if (strcmp(argv[arg_index], "--stationary") == 0 && arg_index + 1 < argc)
+		{
+			stationary_path = argv[++arg_index];
+		}
+		else if (strcmp(argv[arg_index], "--filters") == 0 && arg_index + 1 < argc)
+		{
+			char *filter_list = argv[++arg_index];
+
+			for (char *name = strtok(filter_list, ","); name != nullptr; name = strtok(nullptr, ","))
+			{
+				const FilterSpec *spec = find_filter_spec(name);
+
+				if (spec == nullptr)
+				{
+					printf("unknown filter: %s\n", name);
+					return -1;
+				}
+
+				specs.push_back(spec);
+			}
+		}
+		else if (strcmp(argv[arg_index], "--threads") == 0 && arg_index + 1 < argc)
+		{
+			thread_count = atoi(argv[++arg_index]);
+		}
+		else
+		{
+			session_paths.push_back(argv[arg_index]);
+		}
+	}
+
+	if (session_paths.size() == 0)
+	{
+		print_usage();
+		return -1;
+	}
+
+	if (specs.size() == 0)
+	{
+		// The default A/B: full Kalman against the complementary MARG compound
+		specs.push_back(find_filter_spec("kalman"));
+		specs.push_back(find_filter_spec("complementary-marg"));
+	}
+
+	if (thread_count < 1)
+	{
+		thread_count = 1;
+	}
+
+	SampleStream stationary_stream;
+	bool bHasStationaryStream = false;
+	if (stationary_path.length() > 0)
+	{
+		if (!stationary_stream.load(stationary_path.c_str()))
+		{
+			printf("failed to load stationary capture: %s\n", stationary_path.c_str());
+			return -1;
+		}
+
+		bHasStationaryStream = true;
+	}
+
+	// Load every session up front; the streams are shared read-only by the workers
+	std::vector<SampleStream> sessions(session_paths.size());
+	for (size_t session_index = 0; session_index < session_paths.size(); ++session_index)
+	{
+		if (!sessions[session_index].load(session_paths[session_index].c_str()))
+		{
+			printf("failed to load session: %s\n", session_paths[session_index].c_str());
+			return -1;
+		}
+	}
+
+	// Build the job list - every session crossed with every filter spec
+	std::vector<ReplayJob> jobs;
+	for (size_t session_index = 0; session_index < sessions.size(); ++session_index)
+	{
+		for (size_t spec_index = 0; spec_index < specs.size(); ++spec_index)
+		{
+			ReplayJob job;
+
+			job.session = &sessions[session_index];
+			job.session_name = strip_to_basename(session_paths[session_index]);
+			job.spec = specs[spec_index];
+
+			jobs.push_back(job);
+		}
+	}
+
+	printf("replaying %d session(s) through %d filter(s) on %d thread(s)\n",
+		static_cast<int>(sessions.size()), static_cast<int>(specs.size()), thread_count);
+
+	// Workers pull jobs off a shared cursor until the list is drained
+	std::atomic_int next_job_index(0);
+	std::mutex print_mutex;
+	std::atomic_int failed_job_count(0);
+
+	const std::chrono::time_point<std::chrono::high_resolution_clock> batch_start =
+		std::chrono::high_resolution_clock::now();
+
+	std::vector<std::thread> workers;
+	for (int worker_index = 0; worker_index < thread_count; ++worker_index)
+	{
+		workers.push_back(std::thread([&]() {
+			int job_index;
+
+			while ((job_index = next_job_index.fetch_add(1)) < static_cast<int>(jobs.size()))
+			{
+				const ReplayJob &job = jobs[job_index];
+				const ReplayJobResult result =
+					run_replay_job(job, output_dir, bHasStationaryStream ? &stationary_stream : nullptr);
+
+				std::lock_guard<std::mutex> lock(print_mutex);
+
+				if (result.bSuccess)
+				{
+					const double us_per_sample =
+						(result.sample_count > 0)
+						? result.filter_seconds * 1.0e6 / static_cast<double>(result.sample_count)
+						: 0.0;
+					const double realtime_multiplier =
+						(result.filter_seconds > 0.0) ? result.stream_seconds / result.filter_seconds : 0.0;
+
+					printf("%s | %-18s | %6d samples | %6.1fs stream | %7.1fms filter | %5.2f us/sample | %.0fx realtime\n",
+						job.session_name.c_str(), job.spec->name,
+						static_cast<int>(result.sample_count),
+						result.stream_seconds,
+						result.filter_seconds * 1000.0,
+						us_per_sample,
+						realtime_multiplier);
+				}
+				else
+				{
+					printf("%s | %-18s | FAILED (couldn't write output)\n",
+						job.session_name.c_str(), job.spec->name);
+					++failed_job_count;
+				}
+			}
+		}));
+	}
+
+	for (std::thread &worker : workers)
+	{
+		worker.join();
+	}
+
+	const double batch_seconds =
+		std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - batch_start).count();
+
+	printf("batch finished: %d job(s) in %.1fs, %d failed\n",
+		static_cast<int>(jobs.size()), batch_seconds, failed_job_count.load());
+
+	return (failed_job_count.load() == 0) ? 0 : -1;
+}
@@ -0,0 +1,252 @@
+//-- includes -----
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <chrono>
+
+#include "MathAlignment.h"
+#include "MathEigen.h"
+
+//-- constants -----
+static const int k_sample_quaternion_count = 16;
+static const int k_sample_ellipse_point_count = 16;
+static const int k_sample_ray_count = 4;
+static const int k_benchmark_iteration_count = 100000;
+
+// Each benchmark runs one discarded warmup trial and then k_benchmark_trial_count
+// timed trials; the median is reported so a stray scheduler hiccup in a single
+// trial can't fake a regression (or hide one).
+static const int k_benchmark_trial_count = 9;
+
+//-- definitions -----
+// Runs k_benchmark_iteration_count calls of one math routine and returns a
+// sink value so the optimizer can't discard the loop
+typedef float (*BenchmarkFunction)();
+
+struct BenchmarkResult
+{
+	const char *name;
+	double median_nanoseconds_per_call;
+	float sink;
+};
+
+//-- prototypes -----
+static BenchmarkResult run_benchmark(const char *name, BenchmarkFunction function);
+static float benchmark_body_ellipse_fit();
+static float benchmark_body_quaternion_average();
+static float benchmark_body_triangulation();
+static float benchmark_body_frame_alignment();
+static bool write_benchmark_report(const char *filename, const BenchmarkResult *results, const int result_count);
+
+//-- entry point -----
+int
+main(int argc, char* argv[])
+{
+	fprintf(stdout, "Running psmovemath micro-benchmarks (median of %d trials, %d iterations each).\n",
+		k_benchmark_trial_count, k_benchmark_iteration_count);
+
+	BenchmarkResult results[] = {
+		run_benchmark("least_squares_ellipse_fit", benchmark_body_ellipse_fit),
+		run_benchmark("quaternion_weighted_average", benchmark_body_quaternion_average),
+		run_benchmark("multi_ray_triangulation", benchmark_body_triangulation),
+		run_benchmark("vector_frame_alignment", benchmark_body_frame_alignment)
+	};
+	const int result_count = sizeof(results) / sizeof(results[0]);
+
+	// Optionally write the results somewhere a build script can diff them
+	if (argc >= 2)
+	{
+		if (!write_benchmark_report(argv[1], results, result_count))
+		{
+			printf("Failed to write benchmark file: %s", argv[1]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	return EXIT_SUCCESS;
+}
+
+//-- private functions -----
+static BenchmarkResult
+run_benchmark(const char *name, BenchmarkFunction function)
+{
+	double trial_nanoseconds[k_benchmark_trial_count];
+	float sink = 0.f;
+
+	// Warmup trial - pulls code and data into cache, result discarded
+	sink += function();
+
+	for (int trial_index = 0; trial_index < k_benchmark_trial_count; ++trial_index)
+	{
+		const auto start_time = std::chrono::high_resolution_clock::now();
+		sink += function();
+		const auto end_time = std::chrono::high_resolution_clock::now();
+
+		trial_nanoseconds[trial_index] =
+			static_cast<double>(
+				std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count());
+	}
+
+	std::sort(trial_nanoseconds, trial_nanoseconds + k_benchmark_trial_count);
+
+	BenchmarkResult result;
+	result.name = name;
+	result.median_nanoseconds_per_call =
+		trial_nanoseconds[k_benchmark_trial_count / 2] / static_cast<double>(k_benchmark_iteration_count);
+	result.sink = sink;
+
+	fprintf(stdout, "  %s - %.1f ns/call (sink=%f)\n",
+		result.name, result.median_nanoseconds_per_call, result.sink);
+
+	return result;
+}
+
+static void
+build_sample_quaternions(Eigen::Quaternionf *out_quaternions, float *out_weights)
+{
+	for (int sample_index = 0; sample_index < k_sample_quaternion_count; ++sample_index)
+	{
+		// Deterministic spread of small rotations about each axis
+		const float angle = 0.01f*static_cast<float>(sample_index + 1);
+		const Eigen::Vector3f axis =
+			(sample_index % 3 == 0) ? Eigen::Vector3f::UnitX()
+			: (sample_index % 3 == 1) ? Eigen::Vector3f::UnitY()
+			: Eigen::Vector3f::UnitZ();
+
+		out_quaternions[sample_index] = eigen_quaternion_angle_axis(angle, axis);
+		out_weights[sample_index] = 1.f / static_cast<float>(sample_index + 1);
+	}
+}
+
+static float
+benchmark_body_ellipse_fit()
+{
+	// Deterministic points on a rotated off-center ellipse
+	Eigen::Vector2f points[k_sample_ellipse_point_count];
+	for (int point_index = 0; point_index < k_sample_ellipse_point_count; ++point_index)
+	{
+		const float theta = k_real_two_pi*static_cast<float>(point_index) / static_cast<float>(k_sample_ellipse_point_count);
+
+		points[point_index] =
+			Eigen::Vector2f(3.f + 2.f*cosf(theta) - 0.5f*sinf(theta), -1.f + cosf(theta) + 1.5f*sinf(theta));
+	}
+
+	float sink = 0.f;
+	for (int iteration = 0; iteration < k_benchmark_iteration_count; ++iteration)
+	{
+		EigenFitEllipse ellipse;
+		if (eigen_alignment_fit_least_squares_ellipse(points, k_sample_ellipse_point_count, ellipse))
+		{
+			sink += ellipse.area;
+		}
+	}
+
+	return sink;
+}
+
+static float
+benchmark_body_quaternion_average()
+{
+	Eigen::Quaternionf quaternions[k_sample_quaternion_count];
+	float weights[k_sample_quaternion_count];
+	build_sample_quaternions(quaternions, weights);
+
+	float sink = 0.f;
+	for (int iteration = 0; iteration < k_benchmark_iteration_count; ++iteration)
+	{
+		Eigen::Quaternionf average;
+		if (eigen_quaternion_compute_normalized_weighted_average(
+				quaternions, weights, k_sample_quaternion_count, &average))
+		{
+			sink += average.w();
+		}
+	}
+
+	return sink;
+}
+
+static float
+benchmark_body_triangulation()
+{
+	// Rays from four tracker positions that nearly intersect at a target point
+	const Eigen::Vector3f target(10.f, 50.f, -30.f);
+	Eigen::Vector3f ray_origins[k_sample_ray_count];
+	Eigen::Vector3f ray_directions[k_sample_ray_count];
+	for (int ray_index = 0; ray_index < k_sample_ray_count; ++ray_index)
+	{
+		const float angle = k_real_two_pi*static_cast<float>(ray_index) / static_cast<float>(k_sample_ray_count);
+
+		ray_origins[ray_index] = Eigen::Vector3f(100.f*cosf(angle), 60.f, 100.f*sinf(angle));
+		// A centimeter of per-camera error keeps the solve from being degenerate-exact
+		const Eigen::Vector3f jittered_target = target + Eigen::Vector3f(0.f, static_cast<float>(ray_index), 0.f);
+		ray_directions[ray_index] = (jittered_target - ray_origins[ray_index]).normalized();
+	}
+
+	float sink = 0.f;
+	for (int iteration = 0; iteration < k_benchmark_iteration_count; ++iteration)
+	{
+		Eigen::Vector3f triangulated_point;
+		if (eigen_alignment_compute_point_closest_to_rays(
+				ray_origins, ray_directions, k_sample_ray_count, &triangulated_point))
+		{
+			sink += triangulated_point.y();
+		}
+	}
+
+	return sink;
+}
+
+static float
+benchmark_body_frame_alignment()
+{
+	// Identity gravity/magnetometer frame rotated by a small known quaternion,
+	// the same shape of problem the orientation filters solve every tick
+	const Eigen::Vector3f identity_g(0.f, 1.f, 0.f);
+	const Eigen::Vector3f identity_m(0.f, 0.6f, 0.8f);
+	const Eigen::Quaternionf true_rotation = eigen_quaternion_angle_axis(0.2f, Eigen::Vector3f(1.f, 2.f, 3.f).normalized());
+	const Eigen::Vector3f rotated_g = eigen_vector3f_clockwise_rotate(true_rotation, identity_g);
+	const Eigen::Vector3f rotated_m = eigen_vector3f_clockwise_rotate(true_rotation, identity_m);
+
+	const Eigen::Vector3f* from[2] = { &identity_g, &identity_m };
+	const Eigen::Vector3f* to[2] = { &rotated_g, &rotated_m };
+
+	float sink = 0.f;
+	for (int iteration = 0; iteration < k_benchmark_iteration_count; ++iteration)
+	{
+		Eigen::Quaternionf alignment;
+		if (eigen_alignment_quaternion_between_vector_frames(
+				from, to, 0.1f, Eigen::Quaternionf::Identity(), alignment))
+		{
+			sink += alignment.w();
+		}
+	}
+
+	return sink;
+}
+
+static bool
+write_benchmark_report(const char *filename, const BenchmarkResult *results, const int result_count)
+{
+	FILE *fp = fopen(filename, "wt");
+	if (fp == nullptr)
+	{
+		return false;
+	}
+
+	fprintf(fp, "{\n");
+	fprintf(fp, "  \"iteration_count\": %d,\n", k_benchmark_iteration_count);
+	fprintf(fp, "  \"trial_count\": %d,\n", k_benchmark_trial_count);
+	fprintf(fp, "  \"benchmarks\": [\n");
+	for (int result_index = 0; result_index < result_count; ++result_index)
+	{
+		fprintf(fp, "    {\"name\": \"%s\", \"median_ns_per_call\": %.1f}%s\n",
+			results[result_index].name,
+			results[result_index].median_nanoseconds_per_call,
+			(result_index + 1 < result_count) ? "," : "");
+	}
+	fprintf(fp, "  ]\n");
+	fprintf(fp, "}\n");
+	fclose(fp);
+
+	return true;
+}
@@ -1,6 +1,7 @@
 #include "DeviceInterface.h"
 #include "KalmanPoseFilter.h"
 #include "CompoundPoseFilter.h"
+#include "FilterProfile.h"
 #include "MathAlignment.h"
 
 #if defined(__linux) || defined (__APPLE__)
@@ -14,6 +15,12 @@
 #define strncasecmp(a, b, n) _strnicmp(a,b,n)
 #endif
 
+// Loose accuracy bounds the filtered state must stay within relative to the
+// raw optical samples. Both the double and the single precision filter builds
+// are expected to pass these.
+static const float k_max_allowed_mean_position_error_cm = 5.f;
+static const float k_max_allowed_mean_orientation_error_rad = 0.2f;
+
 enum eControllerSampleFields
 {
 	FIELD_TIME,
@@ -374,7 +381,7 @@ private:
 	FILE* m_fp;
 };
 
-static void apply_filter(
+static bool apply_filter(
 	const bool bUseCompoundFilter,
 	ControllerInputStream &stationary_stream,
 	ControllerInputStream &movement_stream,
@@ -389,12 +396,13 @@ static void init_filter_for_psmove(
 	const Eigen::Vector3f &initial_position, const Eigen::Quaternionf &initial_orientation,
 	const bool bUseCompoundFilter,
 	PoseFilterSpace **out_pose_filter_space, IPoseFilter **out_pose_filter);
+static bool write_benchmark_report(const char *filename);
 
 int main(int argc, char *argv[])
-{   
+{
 	if (argc < 4)
 	{
-		printf("usage test_kalman_filter <stationary_file.csv> <movement_file.csv> <output_file.csv>");
+		printf("usage test_kalman_filter <stationary_file.csv> <movement_file.csv> <output_file.csv> [benchmark_file.json]");
 		return -1;
 	}
 
@@ -412,14 +420,27 @@ int main(int argc, char *argv[])
 		return -1;
 	}
 
+	// Optionally record per-stage cycle counters while the filters run
+	const char *benchmark_filename = (argc >= 5) ? argv[4] : nullptr;
+	if (benchmark_filename != nullptr)
+	{
+		FilterProfile::reset();
+		FilterProfile::setIsEnabled(true);
+	}
+
 	FilterOutputStream compoundfilter_output_stream("compoundfilter_", argv[3]);
-	apply_filter(
-		true, // use compound orientation kalman + position kalman filter
-		stationary_stream,
-		movement_stream,
-		compoundfilter_output_stream);
+	if (!apply_filter(
+			true, // use compound orientation kalman + position kalman filter
+			stationary_stream,
+			movement_stream,
+			compoundfilter_output_stream))
+	{
+		printf("Compound filter output deviates too far from the optical samples");
+		return -1;
+	}
 
 	//###HipsterSloth $TODO full pose kalman filter doesn't work yet
+	// (which also keeps KalmanPoseFilter out of the benchmark report)
 	//FilterOutputStream posefilter_output_stream("posefilter_", argv[3]);
 	//apply_filter(
 	//	false, // use full pose kalman filter
@@ -427,10 +448,67 @@ int main(int argc, char *argv[])
 	//	movement_stream,
 	//	posefilter_output_stream);
 
+	if (benchmark_filename != nullptr)
+	{
+		FilterProfile::setIsEnabled(false);
+
+		if (!write_benchmark_report(benchmark_filename))
+		{
+			printf("Failed to write benchmark file: %s", benchmark_filename);
+			return -1;
+		}
+	}
+
 	return 0;
 }
 
-static void
+static bool
+write_benchmark_report(const char *filename)
+{
+	FILE *fp = fopen(filename, "wt");
+	if (fp == nullptr)
+	{
+		return false;
+	}
+
+	fprintf(fp, "{\n");
+	fprintf(fp, "  \"filters\": [\n");
+	for (int filter_index = 0; filter_index < FilterProfile::k_filter_count; ++filter_index)
+	{
+		const FilterProfile::eFilter filter = static_cast<FilterProfile::eFilter>(filter_index);
+
+		fprintf(fp, "    {\n");
+		fprintf(fp, "      \"name\": \"%s\",\n", FilterProfile::getFilterName(filter));
+		fprintf(fp, "      \"stages\": [\n");
+		for (int stage_index = 0; stage_index < FilterProfile::k_stage_count; ++stage_index)
+		{
+			const FilterProfile::eStage stage = static_cast<FilterProfile::eStage>(stage_index);
+			const unsigned long long total_cycles = FilterProfile::getTotalCycles(filter, stage);
+			const unsigned long long tick_count = FilterProfile::getSampleCount(filter, stage);
+			const double cycles_per_tick =
+				(tick_count > 0)
+				? static_cast<double>(total_cycles) / static_cast<double>(tick_count)
+				: 0.0;
+
+			fprintf(fp, "        {\"name\": \"%s\", \"tick_count\": %llu, \"total_cycles\": %llu, \"cycles_per_tick\": %.1f}%s\n",
+				FilterProfile::getStageName(stage),
+				tick_count,
+				total_cycles,
+				cycles_per_tick,
+				(stage_index + 1 < FilterProfile::k_stage_count) ? "," : "");
+		}
+		fprintf(fp, "      ]\n");
+		fprintf(fp, "    }%s\n", (filter_index + 1 < FilterProfile::k_filter_count) ? "," : "");
+	}
+	fprintf(fp, "  ]\n");
+	fprintf(fp, "}\n");
+
+	fclose(fp);
+
+	return true;
+}
+
+static bool
 apply_filter(
 	const bool bUseCompoundFilter,
 	ControllerInputStream &stationary_stream,
@@ -466,6 +544,15 @@ apply_filter(
 
 	float lastTime = movement_stream.getSample(0).time - stationary_stream.computeMeanTimeDelta();
 
+	// Accumulated deviation of the filtered state from the raw optical
+	// observations. The filter is expected to track the observations to
+	// within these bounds regardless of the scalar precision it was built
+	// with (see PSMOVE_USE_SINGLE_PRECISION_FILTERS).
+	float position_error_sum_cm = 0.f;
+	float position_error_max_cm = 0.f;
+	float orientation_error_sum_rad = 0.f;
+	int error_sample_count = 0;
+
 	movement_stream.reset();
 	while (movement_stream.hasNext())
 	{
@@ -480,12 +567,27 @@ apply_filter(
 		sensorPacket.tracking_projection_area_px_sqr = sample.area;
 		sensorPacket.optical_position_cm = Eigen::Vector3f(sample.pos[0], sample.pos[1], sample.pos[2]);
 
-		PoseFilterPacket filterPacket;
-		pose_filter_space->createFilterPacket(sensorPacket, pose_filter, filterPacket);
+		const PoseFilterPacket &filterPacket =
+			pose_filter_space->createFilterPacket(sensorPacket, pose_filter);
 
 		pose_filter->update(dT, filterPacket);
 
 		output_stream.writeFilterState(sample, pose_filter, sample.time);
+
+		if (pose_filter->getIsStateValid())
+		{
+			const float position_error_cm =
+				(pose_filter->getPositionCm() - sensorPacket.optical_position_cm).norm();
+			const float orientation_error_rad =
+				eigen_quaternion_unsigned_angle_between(
+					pose_filter->getOrientation(),
+					sensorPacket.optical_orientation.normalized());
+
+			position_error_sum_cm += position_error_cm;
+			position_error_max_cm = fmaxf(position_error_max_cm, position_error_cm);
+			orientation_error_sum_rad += orientation_error_rad;
+			++error_sample_count;
+		}
 	}
 
 	if (pose_filter_space != nullptr)
@@ -496,6 +598,22 @@ apply_filter(
 	{
 		delete pose_filter;
 	}
+
+	bool bWithinTolerance = false;
+	if (error_sample_count > 0)
+	{
+		const float mean_position_error_cm = position_error_sum_cm / static_cast<float>(error_sample_count);
+		const float mean_orientation_error_rad = orientation_error_sum_rad / static_cast<float>(error_sample_count);
+
+		printf("mean position error: %.3f cm (max %.3f cm), mean orientation error: %.4f rad\n",
+			mean_position_error_cm, position_error_max_cm, mean_orientation_error_rad);
+
+		bWithinTolerance =
+			mean_position_error_cm <= k_max_allowed_mean_position_error_cm &&
+			mean_orientation_error_rad <= k_max_allowed_mean_orientation_error_rad;
+	}
+
+	return bWithinTolerance;
 }
 
 static void
@@ -531,6 +649,7 @@ init_filter_for_psmove(
 	constants.orientation_constants.orientation_variance_curve.A = 0.0f;
 	constants.orientation_constants.orientation_variance_curve.B = 0.0f;
 	constants.orientation_constants.orientation_variance_curve.MaxValue = 0.0f;
+	constants.orientation_constants.orientation_variance_curve.buildLUT();
 
 	Eigen::Vector3f accelerometer_drift;
 	stationary_stream.computeSliceStatistics(
@@ -550,6 +669,7 @@ init_filter_for_psmove(
 	constants.position_constants.position_variance_curve.A = 0.44888f;
 	constants.position_constants.position_variance_curve.B = -0.00402f;
 	constants.position_constants.position_variance_curve.MaxValue = 1.0f;
+	constants.position_constants.position_variance_curve.buildLUT();
 	constants.position_constants.mean_update_time_delta = stationary_stream.computeMeanTimeDelta();
 	constants.position_constants.gravity_calibration_direction = pose_filter_space->getGravityCalibrationDirection();
 
@@ -605,6 +725,7 @@ init_filter_for_psdualshock4(
 	constants.orientation_constants.orientation_variance_curve.A = 0.44888f;
 	constants.orientation_constants.orientation_variance_curve.B = -0.00402f;
 	constants.orientation_constants.orientation_variance_curve.MaxValue = 1.0f;
+	constants.orientation_constants.orientation_variance_curve.buildLUT();
 
 	Eigen::Vector3f accelerometer_drift;
 	stationary_stream.computeSliceStatistics(
@@ -626,6 +747,7 @@ init_filter_for_psdualshock4(
 	constants.position_constants.position_variance_curve.A = 0.44888f;
 	constants.position_constants.position_variance_curve.B = -0.00402f;
 	constants.position_constants.position_variance_curve.MaxValue = 1.0f;
+	constants.position_constants.position_variance_curve.buildLUT();
 
 	if (bUseCompoundFilter)
 	{
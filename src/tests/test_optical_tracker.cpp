@@ -3,10 +3,24 @@
 #include "PSMoveController.h"
 #include "ServerLog.h"
 #include "PSEyeVideoCapture.h"
+#include "ClientPSMoveAPI.h"
+#include "ClientControllerView.h"
 #include "opencv2/opencv.hpp"
 #include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
 #include <Eigen/Dense>
 
+#if defined(__linux) || defined (__APPLE__)
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
 #ifndef HAVE_M_PI
 #ifndef M_PI
 #define M_PI    3.14159265358979323846264338327950288   /* pi */
@@ -48,7 +62,324 @@ void onMouse(int evt, int x, int y, int flags, void* param) {
     }
 }
 
-int main()
+//-- latency benchmark -----
+// Measures the end-to-end pipeline latency through a running PSMoveService by
+// blinking the controller bulb and timing how long the tracker projection
+// takes to react in the data stream:
+//   LED command -> bulb photons -> camera exposure -> vision -> filter ->
+//   data frame publish -> client receive
+// The LED command transport (bluetooth/USB) is part of the measured number,
+// so treat results as an upper bound that is stable run-to-run; a regression
+// in any pipeline stage shows up as a shift in the reported distribution.
+//
+// Usage: test_optical_tracker latency [cycle_count] [controller_id]
+// Requires PSMoveService running on localhost with the controller in view
+// of at least one calibrated tracker.
+
+static const int k_default_latency_cycle_count = 60;
+static const double k_latency_phase_timeout_ms = 5000.0;
+static const int k_latency_settle_frame_count = 30; // data frames idled between blink cycles
+
+class OpticalLatencyBenchmark
+{
+public:
+    enum eBenchmarkState
+    {
+        _benchmarkState_waitingForConnection,
+        _benchmarkState_waitingForTracking,
+        _benchmarkState_waitingForProjectionLost,
+        _benchmarkState_settling,
+        _benchmarkState_measuring
+    };
+
+    OpticalLatencyBenchmark(int controller_id, int cycle_count)
+        : m_keepRunning(true)
+        , m_bCompleted(false)
+        , m_controllerId(controller_id)
+        , m_cycleCount(cycle_count)
+        , m_controllerView(nullptr)
+        , m_startStreamRequestId(-1)
+        , m_lastSequenceNumber(-1)
+        , m_state(_benchmarkState_waitingForConnection)
+        , m_settleFramesRemaining(0)
+    {
+    }
+
+    int run()
+    {
+        int result= -1;
+
+        if (ClientPSMoveAPI::startup("localhost", "9512"))
+        {
+            m_phaseStartTime= std::chrono::high_resolution_clock::now();
+
+            while (m_keepRunning)
+            {
+                update();
+
+                sleep_millisecond(1);
+            }
+
+            if (m_bCompleted)
+            {
+                report_results();
+                result= 0;
+            }
+
+            if (m_controllerView != nullptr)
+            {
+                // Make sure the bulb is handed back to the service un-overridden
+                m_controllerView->SetLEDOverride(0, 0, 0);
+                ClientPSMoveAPI::update();
+
+                ClientPSMoveAPI::free_controller_view(m_controllerView);
+                m_controllerView= nullptr;
+            }
+
+            ClientPSMoveAPI::shutdown();
+        }
+        else
+        {
+            std::cerr << "OpticalLatencyBenchmark - Failed to initialize the client network manager" << std::endl;
+        }
+
+        return result;
+    }
+
+private:
+    void sleep_millisecond(int sleepMs)
+    {
+    #if defined(__linux) || defined (__APPLE__)
+        usleep(sleepMs * 1000);
+    #endif
+    #ifdef _WIN32
+        Sleep(sleepMs);
+    #endif
+    }
+
+    void set_state(eBenchmarkState new_state)
+    {
+        m_state= new_state;
+        m_phaseStartTime= std::chrono::high_resolution_clock::now();
+    }
+
+    void handle_client_psmove_event(ClientPSMoveAPI::eEventType event_type)
+    {
+        switch (event_type)
+        {
+        case ClientPSMoveAPI::connectedToService:
+            {
+                std::cout << "OpticalLatencyBenchmark - Connected to service" << std::endl;
+
+                m_controllerView= ClientPSMoveAPI::allocate_controller_view(m_controllerId);
+
+                // The raw tracker data carries the projection state we blink-test against
+                m_startStreamRequestId=
+                    ClientPSMoveAPI::start_controller_data_stream(
+                        m_controllerView,
+                        ClientPSMoveAPI::includePositionData | ClientPSMoveAPI::includeRawTrackerData);
+            }
+            break;
+        case ClientPSMoveAPI::failedToConnectToService:
+            std::cerr << "OpticalLatencyBenchmark - Failed to connect to service" << std::endl;
+            m_keepRunning= false;
+            break;
+        case ClientPSMoveAPI::disconnectedFromService:
+            std::cerr << "OpticalLatencyBenchmark - Disconnected from service" << std::endl;
+            m_keepRunning= false;
+            break;
+        case ClientPSMoveAPI::controllerListUpdated:
+            // A controller coming or going mid-run invalidates the measurement
+            std::cerr << "OpticalLatencyBenchmark - Controller list changed mid-run, aborting" << std::endl;
+            m_keepRunning= false;
+            break;
+        default:
+            break;
+        }
+    }
+
+    void handle_acquire_controller(ClientPSMoveAPI::eClientPSMoveResultCode resultCode)
+    {
+        if (resultCode == ClientPSMoveAPI::_clientPSMoveResultCode_ok)
+        {
+            std::cout << "OpticalLatencyBenchmark - Acquired controller "
+                << m_controllerView->GetControllerID()
+                << ", waiting for the tracker to see it" << std::endl;
+
+            set_state(_benchmarkState_waitingForTracking);
+        }
+        else
+        {
+            std::cerr << "OpticalLatencyBenchmark - Failed to acquire controller " << m_controllerId << std::endl;
+            m_keepRunning= false;
+        }
+    }
+
+    void update()
+    {
+        // Process incoming/outgoing networking requests
+        ClientPSMoveAPI::update();
+
+        // Poll events queued up by the call to ClientPSMoveAPI::update()
+        ClientPSMoveAPI::Message message;
+        while (ClientPSMoveAPI::poll_next_message(&message, sizeof(message)))
+        {
+            switch (message.payload_type)
+            {
+            case ClientPSMoveAPI::_messagePayloadType_Response:
+                if (m_startStreamRequestId != -1 &&
+                    message.response_data.request_id == m_startStreamRequestId)
+                {
+                    handle_acquire_controller(message.response_data.result_code);
+                    m_startStreamRequestId= -1;
+                }
+                break;
+            case ClientPSMoveAPI::_messagePayloadType_Event:
+                handle_client_psmove_event(message.event_data.event_type);
+                break;
+            }
+        }
+
+        const std::chrono::time_point<std::chrono::high_resolution_clock> now=
+            std::chrono::high_resolution_clock::now();
+
+        // Only react to freshly published data frames - re-reading the same
+        // frame between publishes would just re-detect the same projection
+        bool bNewDataFrame= false;
+        bool bProjectionVisible= false;
+
+        if (m_controllerView != nullptr &&
+            m_controllerView->GetOutputSequenceNum() != m_lastSequenceNumber)
+        {
+            m_lastSequenceNumber= m_controllerView->GetOutputSequenceNum();
+
+            bNewDataFrame= true;
+            bProjectionVisible= m_controllerView->GetRawTrackerData().ValidTrackerLocations > 0;
+        }
+
+        switch (m_state)
+        {
+        case _benchmarkState_waitingForConnection:
+            // Waiting on the connect event / stream acknowledge
+            break;
+        case _benchmarkState_waitingForTracking:
+            if (bNewDataFrame && bProjectionVisible)
+            {
+                std::cout << "OpticalLatencyBenchmark - Controller visible, running "
+                    << m_cycleCount << " blink cycles" << std::endl;
+
+                // A near-black override keeps the override active but makes
+                // the bulb dark enough to drop out of the color filter
+                m_controllerView->SetLEDOverride(1, 1, 1);
+                set_state(_benchmarkState_waitingForProjectionLost);
+            }
+            break;
+        case _benchmarkState_waitingForProjectionLost:
+            if (bNewDataFrame && !bProjectionVisible)
+            {
+                m_settleFramesRemaining= k_latency_settle_frame_count;
+                set_state(_benchmarkState_settling);
+            }
+            break;
+        case _benchmarkState_settling:
+            // Idle some frames so exposure/vision state from the previous
+            // cycle can't bleed into the next sample
+            if (bNewDataFrame)
+            {
+                --m_settleFramesRemaining;
+
+                if (m_settleFramesRemaining <= 0)
+                {
+                    // (0,0,0) clears the override service-side, restoring the
+                    // tracking color. Timestamp first so the publish on the
+                    // next update() call is inside the measured window.
+                    m_ledOnTime= now;
+                    m_controllerView->SetLEDOverride(0, 0, 0);
+                    set_state(_benchmarkState_measuring);
+                }
+            }
+            break;
+        case _benchmarkState_measuring:
+            if (bNewDataFrame && bProjectionVisible)
+            {
+                const std::chrono::duration<double, std::milli> latency= now - m_ledOnTime;
+
+                m_latencySamplesMs.push_back(latency.count());
+                std::cout << "OpticalLatencyBenchmark - Cycle "
+                    << m_latencySamplesMs.size() << "/" << m_cycleCount
+                    << ": " << std::fixed << std::setprecision(1) << latency.count() << "ms" << std::endl;
+
+                if (static_cast<int>(m_latencySamplesMs.size()) >= m_cycleCount)
+                {
+                    m_bCompleted= true;
+                    m_keepRunning= false;
+                }
+                else
+                {
+                    m_controllerView->SetLEDOverride(1, 1, 1);
+                    set_state(_benchmarkState_waitingForProjectionLost);
+                }
+            }
+            break;
+        }
+
+        // Any phase stuck longer than the timeout aborts the run
+        if (m_keepRunning)
+        {
+            const std::chrono::duration<double, std::milli> phaseTime= now - m_phaseStartTime;
+
+            if (phaseTime.count() > k_latency_phase_timeout_ms)
+            {
+                std::cerr << "OpticalLatencyBenchmark - Timed out in state "
+                    << static_cast<int>(m_state) << " after "
+                    << m_latencySamplesMs.size() << " samples, aborting" << std::endl;
+                m_keepRunning= false;
+            }
+        }
+    }
+
+    void report_results()
+    {
+        std::vector<double> sorted_samples= m_latencySamplesMs;
+        std::sort(sorted_samples.begin(), sorted_samples.end());
+
+        double sum= 0.0;
+        for (double sample : sorted_samples)
+        {
+            sum+= sample;
+        }
+
+        const size_t count= sorted_samples.size();
+        const double mean= sum / static_cast<double>(count);
+        const double median= sorted_samples[count / 2];
+        const double p95= sorted_samples[(count * 95) / 100];
+
+        std::cout << std::fixed << std::setprecision(1);
+        std::cout << "OpticalLatencyBenchmark - LED-to-projection latency over "
+            << count << " cycles (ms):" << std::endl;
+        std::cout << "  min: " << sorted_samples.front()
+            << "  mean: " << mean
+            << "  median: " << median
+            << "  p95: " << p95
+            << "  max: " << sorted_samples.back() << std::endl;
+    }
+
+    bool m_keepRunning;
+    bool m_bCompleted;
+    int m_controllerId;
+    int m_cycleCount;
+    ClientControllerView *m_controllerView;
+    ClientPSMoveAPI::t_request_id m_startStreamRequestId;
+    int m_lastSequenceNumber;
+    eBenchmarkState m_state;
+    int m_settleFramesRemaining;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_phaseStartTime;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_ledOnTime;
+    std::vector<double> m_latencySamplesMs;
+};
+
+//-- interactive color tracking debug -----
+static int run_interactive_color_debug()
 {
     log_init("info");
 
@@ -363,6 +694,23 @@ int main()
     hid_exit();
 
 	log_dispose();
-    
+
     return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    // "latency" runs the headless blink benchmark against a live service;
+    // no arguments keeps the original interactive color tracking debug
+    if (argc > 1 && strcmp(argv[1], "latency") == 0)
+    {
+        const int cycle_count= (argc > 2) ? atoi(argv[2]) : k_default_latency_cycle_count;
+        const int controller_id= (argc > 3) ? atoi(argv[3]) : 0;
+
+        OpticalLatencyBenchmark benchmark(controller_id, cycle_count);
+
+        return benchmark.run();
+    }
+
+    return run_interactive_color_debug();
 }
\ No newline at end of file
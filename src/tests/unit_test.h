@@ -2,6 +2,15 @@
 #ifndef __UNIT_TEST_H
 #define __UNIT_TEST_H
 
+#ifdef __cplusplus
+#include <algorithm>
+#include <chrono>
+#endif // __cplusplus
+
+//-- constants ----
+// Upper bound on trials a single timed assertion may request
+#define UNIT_TEST_MAX_TIMED_TRIALS 32
+
 //-- macros ----
 #define UNIT_TEST_SUITE_BEGIN() \
 	bool success = true; \
@@ -48,4 +57,99 @@ else \
  	fprintf(stdout, "    %s - %s\n", __test_name, success ? "PASSED" : "FAILED"); \
 	return success; \
 
+#ifdef __cplusplus
+/* Timed assertions - wrap a block and fail the test when its median runtime
+   over a number of trials exceeds a microsecond budget. Budgets are scaled by
+   a per-process machine calibration factor so a floor tuned on the reference
+   build machine doesn't false-positive on slower hardware (and a fast machine
+   doesn't silently tighten it):
+
+	UNIT_TEST_TIMED_BLOCK_BEGIN(9, 500.0)
+		code_under_test();
+	UNIT_TEST_TIMED_BLOCK_END()
+*/
+#define UNIT_TEST_TIMED_BLOCK_BEGIN(trial_count, budget_microseconds) \
+	{ \
+		const int __timed_trial_count = ((trial_count) < UNIT_TEST_MAX_TIMED_TRIALS) ? (trial_count) : UNIT_TEST_MAX_TIMED_TRIALS; \
+		const double __timed_budget_microseconds = (double)(budget_microseconds) * unit_test_machine_time_scale(); \
+		double __timed_trial_microseconds[UNIT_TEST_MAX_TIMED_TRIALS]; \
+		/* One extra leading trial is run and discarded as cache/branch warmup */ \
+		for (int __timed_trial = -1; __timed_trial < __timed_trial_count; ++__timed_trial) \
+		{ \
+			const std::chrono::high_resolution_clock::time_point __timed_start = \
+				std::chrono::high_resolution_clock::now(); \
+
+#define UNIT_TEST_TIMED_BLOCK_END() \
+			const double __timed_elapsed = \
+				std::chrono::duration<double, std::micro>( \
+					std::chrono::high_resolution_clock::now() - __timed_start).count(); \
+			if (__timed_trial >= 0) \
+			{ \
+				__timed_trial_microseconds[__timed_trial] = __timed_elapsed; \
+			} \
+		} \
+		const double __timed_median = unit_test_median(__timed_trial_microseconds, __timed_trial_count); \
+		if (__timed_median > __timed_budget_microseconds) \
+		{ \
+			fprintf(stdout, "    %s - timing floor exceeded (median %.1fus > budget %.1fus over %d trials)\n", \
+				__test_name, __timed_median, __timed_budget_microseconds, __timed_trial_count); \
+			success = false; \
+		} \
+	} \
+
+//-- timed assertion helpers ----
+inline double
+unit_test_median(double *values, const int count)
+{
+	std::sort(values, values + count);
+
+	return (count % 2 == 1)
+		? values[count / 2]
+		: 0.5*(values[count / 2 - 1] + values[count / 2]);
+}
+
+/* Ratio of this machine's speed to the reference machine the budgets were
+   tuned on, measured once per process from a fixed arithmetic workload.
+   Clamped to >= 1 so budgets only ever loosen on slower hardware. */
+inline double
+unit_test_machine_time_scale()
+{
+	static double cached_scale = 0.0;
+
+	if (cached_scale == 0.0)
+	{
+		/* Microseconds the calibration workload takes on the reference
+		   machine; re-tune when moving the CI floor to new hardware */
+		const double k_reference_workload_microseconds = 2000.0;
+		const int k_calibration_trial_count = 5;
+		double trial_microseconds[k_calibration_trial_count];
+
+		for (int trial = 0; trial < k_calibration_trial_count; ++trial)
+		{
+			const std::chrono::high_resolution_clock::time_point start =
+				std::chrono::high_resolution_clock::now();
+
+			/* Fixed mixed integer/float workload; the volatile sink keeps
+			   the optimizer from deleting it */
+			volatile double sink = 0.0;
+			for (int i = 1; i <= 200000; ++i)
+			{
+				sink = sink + 1.0 / (double)i;
+			}
+
+			trial_microseconds[trial] =
+				std::chrono::duration<double, std::micro>(
+					std::chrono::high_resolution_clock::now() - start).count();
+		}
+
+		const double median_microseconds =
+			unit_test_median(trial_microseconds, k_calibration_trial_count);
+
+		cached_scale = std::max(median_microseconds / k_reference_workload_microseconds, 1.0);
+	}
+
+	return cached_scale;
+}
+#endif // __cplusplus
+
 #endif // __UNIT_TEST_H
\ No newline at end of file
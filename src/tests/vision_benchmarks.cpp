@@ -0,0 +1,494 @@
+//-- includes -----
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "opencv2/opencv.hpp"
+
+#include "HSVRangeThreshold.h"
+#include "TrackerUndistortionLUT.h"
+#include "TrackerVisionKernels.h"
+#include "MathAlignment.h"
+
+//-- constants -----
+// PS3Eye native resolution - the frame geometry every stage runs at in the service
+static const int k_frame_width = 640;
+static const int k_frame_height = 480;
+
+// Each benchmark body processes this many frames worth of work per trial
+static const int k_benchmark_frame_count = 32;
+
+// Each benchmark runs one discarded warmup trial and then k_benchmark_trial_count
+// timed trials; the median is reported so a stray scheduler hiccup in a single
+// trial can't fake a regression (or hide one).
+static const int k_benchmark_trial_count = 9;
+
+// Synthetic tracking blob: a filled magenta circle on a dim gray background,
+// roughly the footprint of a PSMove bulb at arm's length
+static const int k_blob_center_x = 400;
+static const int k_blob_center_y = 240;
+static const int k_blob_radius = 40;
+
+// Magenta lands near hue 150 in OpenCV's [0,180) convention
+static const HSVRangeThreshold k_magenta_threshold = { 140, 160, 100, 255, 100, 255 };
+
+// PS3Eye-ish pinhole model used for the undistortion stages
+static const float k_focal_length = 554.26f;
+
+//-- definitions -----
+// Runs k_benchmark_frame_count frames through one pipeline stage and returns a
+// sink value so the optimizer can't discard the loop
+typedef float (*BenchmarkFunction)();
+
+struct BenchmarkResult
+{
+	const char *name;
+	double median_milliseconds_per_frame;
+	double megapixels_per_second;
+	float sink;
+};
+
+//-- prototypes -----
+static BenchmarkResult run_benchmark(const char *name, BenchmarkFunction function);
+static float benchmark_body_fused_bayer_to_hsv();
+static float benchmark_body_opencv_debayer_to_hsv();
+static float benchmark_body_hsv_range_mask();
+static float benchmark_body_hsv_label_mask_lut();
+static float benchmark_body_find_contours();
+static float benchmark_body_contour_undistort();
+static float benchmark_body_ellipse_fit();
+static bool write_benchmark_report(const char *filename, const BenchmarkResult *results, const int result_count);
+
+//-- entry point -----
+int
+main(int argc, char* argv[])
+{
+	fprintf(stdout, "Running vision pipeline stage benchmarks on synthetic %dx%d frames\n",
+		k_frame_width, k_frame_height);
+	fprintf(stdout, "(median of %d trials, %d frames each).\n",
+		k_benchmark_trial_count, k_benchmark_frame_count);
+
+	BenchmarkResult results[] = {
+		run_benchmark("fused_bayer_to_hsv", benchmark_body_fused_bayer_to_hsv),
+		run_benchmark("opencv_debayer_then_hsv", benchmark_body_opencv_debayer_to_hsv),
+		run_benchmark("hsv_range_mask", benchmark_body_hsv_range_mask),
+		run_benchmark("hsv_label_mask_lut", benchmark_body_hsv_label_mask_lut),
+		run_benchmark("find_contours", benchmark_body_find_contours),
+		run_benchmark("contour_undistort_lut", benchmark_body_contour_undistort),
+		run_benchmark("sphere_ellipse_fit", benchmark_body_ellipse_fit)
+	};
+	const int result_count = sizeof(results) / sizeof(results[0]);
+
+	// Optionally write the results somewhere a build script can diff them
+	if (argc >= 2)
+	{
+		if (!write_benchmark_report(argv[1], results, result_count))
+		{
+			printf("Failed to write benchmark file: %s", argv[1]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	return EXIT_SUCCESS;
+}
+
+//-- private functions -----
+static BenchmarkResult
+run_benchmark(const char *name, BenchmarkFunction function)
+{
+	double trial_nanoseconds[k_benchmark_trial_count];
+	float sink = 0.f;
+
+	// Warmup trial - pulls code and data into cache, result discarded
+	sink += function();
+
+	for (int trial_index = 0; trial_index < k_benchmark_trial_count; ++trial_index)
+	{
+		const auto start_time = std::chrono::high_resolution_clock::now();
+		sink += function();
+		const auto end_time = std::chrono::high_resolution_clock::now();
+
+		trial_nanoseconds[trial_index] =
+			static_cast<double>(
+				std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count());
+	}
+
+	std::sort(trial_nanoseconds, trial_nanoseconds + k_benchmark_trial_count);
+
+	const double nanoseconds_per_frame =
+		trial_nanoseconds[k_benchmark_trial_count / 2] / static_cast<double>(k_benchmark_frame_count);
+	const double frame_megapixels =
+		static_cast<double>(k_frame_width*k_frame_height) / (1024.0*1024.0);
+
+	BenchmarkResult result;
+	result.name = name;
+	result.median_milliseconds_per_frame = nanoseconds_per_frame / 1.0e6;
+	result.megapixels_per_second = frame_megapixels / (nanoseconds_per_frame / 1.0e9);
+	result.sink = sink;
+
+	fprintf(stdout, "  %s - %.3f ms/frame, %.1f Mpix/s (sink=%f)\n",
+		result.name, result.median_milliseconds_per_frame, result.megapixels_per_second, result.sink);
+
+	return result;
+}
+
+/// Paint the synthetic test scene into a BGR frame: dim gray background,
+/// bright magenta blob, and a sprinkling of deterministic noise speckles so
+/// the contour stage has clutter to reject like a real camera frame would
+static void
+build_sample_bgr_frame(cv::Mat &out_bgr_frame)
+{
+	out_bgr_frame = cv::Mat(k_frame_height, k_frame_width, CV_8UC3, cv::Scalar(32, 32, 32));
+
+	cv::circle(
+		out_bgr_frame,
+		cv::Point(k_blob_center_x, k_blob_center_y), k_blob_radius,
+		cv::Scalar(255, 0, 255), -1);
+
+	// Deterministic LCG speckle - single bright pixels that threshold as
+	// one-pixel blobs
+	uint32_t seed = 0x12345678;
+	for (int speckle_index = 0; speckle_index < 200; ++speckle_index)
+	{
+		seed = 1664525u*seed + 1013904223u;
+		const int x = static_cast<int>(seed % k_frame_width);
+		const int y = static_cast<int>((seed >> 16) % k_frame_height);
+
+		out_bgr_frame.at<cv::Vec3b>(y, x) = cv::Vec3b(255, 0, 255);
+	}
+}
+
+/// Re-mosaic the synthetic scene into a GRBG Bayer frame, the format the
+/// PS3Eye actually delivers to the fused conversion kernel
+static void
+build_sample_bayer_frame(const cv::Mat &bgr_frame, cv::Mat &out_bayer_frame)
+{
+	out_bayer_frame = cv::Mat(k_frame_height, k_frame_width, CV_8UC1);
+
+	for (int y = 0; y < k_frame_height; ++y)
+	{
+		for (int x = 0; x < k_frame_width; ++x)
+		{
+			const cv::Vec3b &bgr = bgr_frame.at<cv::Vec3b>(y, x);
+			const bool even_row = (y & 1) == 0;
+			const bool even_col = (x & 1) == 0;
+
+			// GRBG cell layout: [G R / B G]
+			unsigned char sample;
+			if (even_row)
+			{
+				sample = even_col ? bgr[1] : bgr[2];
+			}
+			else
+			{
+				sample = even_col ? bgr[0] : bgr[1];
+			}
+
+			out_bayer_frame.at<unsigned char>(y, x) = sample;
+		}
+	}
+}
+
+/// HSV copy of the synthetic scene, input to the threshold stages
+static void
+build_sample_hsv_frame(cv::Mat &out_hsv_frame)
+{
+	cv::Mat bgr_frame;
+	build_sample_bgr_frame(bgr_frame);
+
+	out_hsv_frame = cv::Mat(k_frame_height, k_frame_width, CV_8UC3);
+	cv::cvtColor(bgr_frame, out_hsv_frame, cv::COLOR_BGR2HSV);
+}
+
+/// Binary mask of the synthetic blob, input to the contour stage
+static void
+build_sample_mask_frame(cv::Mat &out_mask_frame)
+{
+	cv::Mat hsv_frame;
+	build_sample_hsv_frame(hsv_frame);
+
+	out_mask_frame = cv::Mat(k_frame_height, k_frame_width, CV_8UC1);
+	computeHSVRangeMask(
+		hsv_frame.ptr<unsigned char>(0), hsv_frame.step,
+		out_mask_frame.ptr<unsigned char>(0), out_mask_frame.step,
+		k_frame_width, k_frame_height,
+		k_magenta_threshold);
+}
+
+/// The undistortion map shared by the contour undistort and ellipse fit
+/// stages. Building it runs the iterative solver once per pixel, so it gets
+/// constructed once on first use (during the discarded warmup trial).
+static const TrackerUndistortionLUT &
+get_sample_undistortion_lut()
+{
+	static cv::Matx33f camera_matrix(
+		k_focal_length, 0.f, static_cast<float>(k_frame_width) / 2.f,
+		0.f, k_focal_length, static_cast<float>(k_frame_height) / 2.f,
+		0.f, 0.f, 1.f);
+	// Mild PS3Eye-like barrel distortion
+	static cv::Matx<float, 5, 1> distortions(-0.13f, 0.02f, 0.f, 0.f, 0.f);
+	// Empty cache directory - always build in memory, never touch the disk
+	static TrackerUndistortionLUT lut(
+		camera_matrix, distortions, k_frame_width, k_frame_height, std::string());
+
+	return lut;
+}
+
+/// The convex hull of the synthetic blob as a float contour, the shape the
+/// undistort and ellipse fit stages consume in production
+static void
+build_sample_blob_contour(t_opencv_float_contour &out_contour)
+{
+	cv::Mat mask_frame;
+	build_sample_mask_frame(mask_frame);
+
+	std::vector<std::vector<cv::Point>> contours;
+	cv::findContours(mask_frame, contours, CV_RETR_EXTERNAL, CV_CHAIN_APPROX_SIMPLE);
+
+	// Find the biggest contour - the blob, not a speckle
+	int biggest_index = -1;
+	double biggest_area = 0.0;
+	for (int contour_index = 0; contour_index < static_cast<int>(contours.size()); ++contour_index)
+	{
+		const double area = cv::contourArea(contours[contour_index]);
+		if (area > biggest_area)
+		{
+			biggest_area = area;
+			biggest_index = contour_index;
+		}
+	}
+
+	std::vector<cv::Point> convex_contour;
+	cv::convexHull(contours[biggest_index], convex_contour);
+
+	out_contour.clear();
+	for (auto it = convex_contour.begin(); it != convex_contour.end(); ++it)
+	{
+		out_contour.push_back(cv::Point2f(static_cast<float>(it->x), static_cast<float>(it->y)));
+	}
+}
+
+static float
+benchmark_body_fused_bayer_to_hsv()
+{
+	cv::Mat bgr_frame;
+	build_sample_bgr_frame(bgr_frame);
+
+	cv::Mat bayer_frame;
+	build_sample_bayer_frame(bgr_frame, bayer_frame);
+
+	cv::Mat hsv_frame(k_frame_height, k_frame_width, CV_8UC3);
+
+	float sink = 0.f;
+	for (int frame_index = 0; frame_index < k_benchmark_frame_count; ++frame_index)
+	{
+		fusedBayerGBToHSV(
+			bayer_frame.ptr<unsigned char>(0), bayer_frame.step,
+			hsv_frame.ptr<unsigned char>(0), hsv_frame.step,
+			k_frame_width, k_frame_height);
+
+		sink += static_cast<float>(hsv_frame.at<cv::Vec3b>(k_blob_center_y, k_blob_center_x)[0]);
+	}
+
+	return sink;
+}
+
+static float
+benchmark_body_opencv_debayer_to_hsv()
+{
+	cv::Mat bgr_frame;
+	build_sample_bgr_frame(bgr_frame);
+
+	cv::Mat bayer_frame;
+	build_sample_bayer_frame(bgr_frame, bayer_frame);
+
+	cv::Mat debayered_frame(k_frame_height, k_frame_width, CV_8UC3);
+	cv::Mat hsv_frame(k_frame_height, k_frame_width, CV_8UC3);
+
+	// The two-stage path the fused kernel replaced - kept as the baseline
+	// so the report shows what the fusion is worth on this machine
+	float sink = 0.f;
+	for (int frame_index = 0; frame_index < k_benchmark_frame_count; ++frame_index)
+	{
+		cv::cvtColor(bayer_frame, debayered_frame, cv::COLOR_BayerGB2BGR);
+		cv::cvtColor(debayered_frame, hsv_frame, cv::COLOR_BGR2HSV);
+
+		sink += static_cast<float>(hsv_frame.at<cv::Vec3b>(k_blob_center_y, k_blob_center_x)[0]);
+	}
+
+	return sink;
+}
+
+static float
+benchmark_body_hsv_range_mask()
+{
+	cv::Mat hsv_frame;
+	build_sample_hsv_frame(hsv_frame);
+
+	cv::Mat mask_frame(k_frame_height, k_frame_width, CV_8UC1);
+
+	float sink = 0.f;
+	for (int frame_index = 0; frame_index < k_benchmark_frame_count; ++frame_index)
+	{
+		computeHSVRangeMask(
+			hsv_frame.ptr<unsigned char>(0), hsv_frame.step,
+			mask_frame.ptr<unsigned char>(0), mask_frame.step,
+			k_frame_width, k_frame_height,
+			k_magenta_threshold);
+
+		sink += static_cast<float>(mask_frame.at<unsigned char>(k_blob_center_y, k_blob_center_x));
+	}
+
+	return sink;
+}
+
+static float
+benchmark_body_hsv_label_mask_lut()
+{
+	cv::Mat hsv_frame;
+	build_sample_hsv_frame(hsv_frame);
+
+	cv::Mat label_frame(k_frame_height, k_frame_width, CV_8UC1);
+
+	// Three active tracking colors, the multi-controller case the
+	// single-traversal labeling kernel exists for
+	const HSVRangeThreshold thresholds[3] = {
+		k_magenta_threshold,
+		{ 50, 70, 100, 255, 100, 255 },  // green
+		{ 100, 120, 100, 255, 100, 255 } // blue
+	};
+	const unsigned char labels[3] = { 1, 2, 3 };
+
+	HSVColorClassLUT class_lut;
+	buildHSVColorClassLUT(thresholds, 3, class_lut);
+
+	float sink = 0.f;
+	for (int frame_index = 0; frame_index < k_benchmark_frame_count; ++frame_index)
+	{
+		computeHSVColorLabelMaskLUT(
+			hsv_frame.ptr<unsigned char>(0), hsv_frame.step,
+			label_frame.ptr<unsigned char>(0), label_frame.step,
+			k_frame_width, k_frame_height,
+			class_lut,
+			labels);
+
+		sink += static_cast<float>(label_frame.at<unsigned char>(k_blob_center_y, k_blob_center_x));
+	}
+
+	return sink;
+}
+
+static float
+benchmark_body_find_contours()
+{
+	cv::Mat mask_frame;
+	build_sample_mask_frame(mask_frame);
+
+	cv::Mat scratch_mask(k_frame_height, k_frame_width, CV_8UC1);
+	std::vector<std::vector<cv::Point>> contours;
+
+	float sink = 0.f;
+	for (int frame_index = 0; frame_index < k_benchmark_frame_count; ++frame_index)
+	{
+		// findContours consumes its input, so hand it a scratch copy
+		mask_frame.copyTo(scratch_mask);
+
+		contours.clear();
+		cv::findContours(scratch_mask, contours, CV_RETR_EXTERNAL, CV_CHAIN_APPROX_SIMPLE);
+
+		sink += static_cast<float>(contours.size());
+	}
+
+	return sink;
+}
+
+static float
+benchmark_body_contour_undistort()
+{
+	const TrackerUndistortionLUT &lut = get_sample_undistortion_lut();
+
+	t_opencv_float_contour blob_contour;
+	build_sample_blob_contour(blob_contour);
+
+	t_opencv_float_contour undistorted_contour;
+
+	float sink = 0.f;
+	for (int frame_index = 0; frame_index < k_benchmark_frame_count; ++frame_index)
+	{
+		lut.undistortContourNormalized(blob_contour, undistorted_contour);
+
+		sink += undistorted_contour[0].x;
+	}
+
+	return sink;
+}
+
+static float
+benchmark_body_ellipse_fit()
+{
+	const TrackerUndistortionLUT &lut = get_sample_undistortion_lut();
+
+	t_opencv_float_contour blob_contour;
+	build_sample_blob_contour(blob_contour);
+
+	t_opencv_float_contour undistorted_contour;
+	lut.undistortContourNormalized(blob_contour, undistorted_contour);
+
+	std::vector<Eigen::Vector2f> eigen_contour;
+	for (auto it = undistorted_contour.begin(); it != undistorted_contour.end(); ++it)
+	{
+		eigen_contour.push_back(Eigen::Vector2f(it->x, it->y));
+	}
+
+	float sink = 0.f;
+	for (int frame_index = 0; frame_index < k_benchmark_frame_count; ++frame_index)
+	{
+		Eigen::Vector3f sphere_center;
+		EigenFitEllipse ellipse_projection;
+
+		eigen_alignment_fit_focal_cone_to_sphere(
+			eigen_contour.data(),
+			static_cast<int>(eigen_contour.size()),
+			2.25f, // PSMove bulb radius in cm
+			1,
+			&sphere_center,
+			&ellipse_projection);
+
+		sink += sphere_center.z() + ellipse_projection.area;
+	}
+
+	return sink;
+}
+
+static bool
+write_benchmark_report(const char *filename, const BenchmarkResult *results, const int result_count)
+{
+	FILE *fp = fopen(filename, "wt");
+	if (fp == nullptr)
+	{
+		return false;
+	}
+
+	fprintf(fp, "{\n");
+	fprintf(fp, "  \"frame_width\": %d,\n", k_frame_width);
+	fprintf(fp, "  \"frame_height\": %d,\n", k_frame_height);
+	fprintf(fp, "  \"frame_count\": %d,\n", k_benchmark_frame_count);
+	fprintf(fp, "  \"trial_count\": %d,\n", k_benchmark_trial_count);
+	fprintf(fp, "  \"benchmarks\": [\n");
+	for (int result_index = 0; result_index < result_count; ++result_index)
+	{
+		fprintf(fp, "    {\"name\": \"%s\", \"median_ms_per_frame\": %.3f, \"megapixels_per_second\": %.1f}%s\n",
+			results[result_index].name,
+			results[result_index].median_milliseconds_per_frame,
+			results[result_index].megapixels_per_second,
+			(result_index + 1 < result_count) ? "," : "");
+	}
+	fprintf(fp, "  ]\n");
+	fprintf(fp, "}\n");
+	fclose(fp);
+
+	return true;
+}
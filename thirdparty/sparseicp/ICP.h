@@ -72,6 +72,25 @@ namespace nanoflann {
 ///////////////////////////////////////////////////////////////////////////////
 /// Compute the rigid motion for point-to-point and point-to-plane distances
 namespace RigidMotionEstimator {
+    /// Orthogonal polar factor of a well-conditioned 3x3 covariance via scaled
+    /// Newton iteration (Higham). Converges quadratically, so a handful of 3x3
+    /// inverse-transposes replace a full SVD on the common case. Returns false
+    /// when the covariance is (near) rank deficient or reflective so the
+    /// caller can fall back to the SVD path.
+    inline bool polar_rotation(const Eigen::Matrix3d& sigma, Eigen::Matrix3d& rotation) {
+        if(sigma.determinant() < 1e-10) return false;
+        rotation = sigma;
+        for(int iteration = 0; iteration < 16; ++iteration) {
+            Eigen::Matrix3d rotation_inv_t = rotation.inverse().transpose();
+            /// Scale factor accelerates convergence when sigma is far from orthogonal
+            double scale = std::sqrt(std::sqrt(rotation_inv_t.squaredNorm()/rotation.squaredNorm()));
+            Eigen::Matrix3d next = 0.5*(scale*rotation + (1.0/scale)*rotation_inv_t);
+            bool converged = (next - rotation).cwiseAbs().maxCoeff() < 1e-12;
+            rotation = next;
+            if(converged) return true;
+        }
+        return false;
+    }
     /// @param Source (one 3D point per column)
     /// @param Target (one 3D point per column)
     /// @param Confidence weights
@@ -92,12 +111,21 @@ namespace RigidMotionEstimator {
         /// Compute transformation
         Eigen::Affine3d transformation;
         Eigen::Matrix3d sigma = X * w_normalized.asDiagonal() * Y.transpose();
-        Eigen::JacobiSVD<Eigen::Matrix3d> svd(sigma, Eigen::ComputeFullU | Eigen::ComputeFullV);
-        if(svd.matrixU().determinant()*svd.matrixV().determinant() < 0.0) {
-            Eigen::Vector3d S = Eigen::Vector3d::Ones(); S(2) = -1.0;
-            transformation.linear().noalias() = svd.matrixV()*S.asDiagonal()*svd.matrixU().transpose();
+        /// Closed-form fast path: the optimal rotation V*U^T is the transpose of
+        /// the polar factor of sigma. det(sigma) > 0 guarantees the polar factor
+        /// is a proper rotation, matching the SVD sign-correction test below.
+        Eigen::Matrix3d polar_factor;
+        if(polar_rotation(sigma, polar_factor)) {
+            transformation.linear().noalias() = polar_factor.transpose();
         } else {
-            transformation.linear().noalias() = svd.matrixV()*svd.matrixU().transpose();
+            /// Degenerate/reflective configuration: fall back to the SVD
+            Eigen::JacobiSVD<Eigen::Matrix3d> svd(sigma, Eigen::ComputeFullU | Eigen::ComputeFullV);
+            if(svd.matrixU().determinant()*svd.matrixV().determinant() < 0.0) {
+                Eigen::Vector3d S = Eigen::Vector3d::Ones(); S(2) = -1.0;
+                transformation.linear().noalias() = svd.matrixV()*S.asDiagonal()*svd.matrixU().transpose();
+            } else {
+                transformation.linear().noalias() = svd.matrixV()*svd.matrixU().transpose();
+            }
         }
         transformation.translation().noalias() = Y_mean - transformation.linear()*X_mean;
         /// Apply transformation
@@ -253,6 +281,20 @@ namespace SICP {
                         Parameters par = Parameters()) {
         /// Build kd-tree
         nanoflann::KDTreeAdaptor<Eigen::MatrixBase<Derived2>, 3, nanoflann::metric_L2_Simple> kdtree(Y);
+        point_to_point(X, Y, kdtree, par);
+    }
+    /// Sparse ICP with point to point using a caller supplied kd-tree over Y.
+    /// Lets a caller that registers repeatedly against the same target cloud
+    /// build the tree once and reuse it across calls.
+    /// @param Source (one 3D point per column)
+    /// @param Target (one 3D point per column)
+    /// @param Prebuilt kd-tree over the target
+    /// @param Parameters
+    template <typename Derived1, typename Derived2, typename KdTree>
+    void point_to_point(Eigen::MatrixBase<Derived1>& X,
+                        Eigen::MatrixBase<Derived2>& Y,
+                        const KdTree& kdtree,
+                        Parameters par) {
         /// Buffers
         Eigen::Matrix3Xd Q = Eigen::Matrix3Xd::Zero(3, X.cols());
         Eigen::Matrix3Xd Z = Eigen::Matrix3Xd::Zero(3, X.cols());